@@ -10,7 +10,11 @@ brake_pressure.add_subelement(name="status", datatype=BaseTypes.BOOL, is_optiona
 brake_service = vafpy.ModuleInterface(name="BrakeService", namespace="af::adas_demo_app::services")
 brake_service.add_data_element(name="brake_action", datatype=brake_pressure)
 brake_service.add_data_element(name="brake_summand_coefficient_FieldNotifier", datatype=BaseTypes.UINT64_T)
-brake_service.add_operation(name="brake_summand_coefficient_FieldGetter", out_parameter={"data": BaseTypes.UINT64_T})
+brake_service.add_operation(
+    name="brake_summand_coefficient_FieldGetter",
+    out_parameter={"data": BaseTypes.UINT64_T},
+    field_notifier="brake_summand_coefficient_FieldNotifier",
+)
 brake_service.add_operation(name="brake_summand_coefficient_FieldSetter", in_parameter={"data": BaseTypes.UINT64_T})
 brake_service.add_operation(
     name="SumTwoSummands",
@@ -54,7 +58,11 @@ image.add_subelement(name="B", datatype=uint8_vector_307200)
 image_service = vafpy.ModuleInterface(name="ImageService", namespace="af::adas_demo_app::services")
 image_service.add_data_element(name="camera_image", datatype=image)
 image_service.add_data_element(name="image_scaling_factor_FieldNotifier", datatype=BaseTypes.UINT64_T)
-image_service.add_operation(name="image_scaling_factor_FieldGetter", out_parameter={"data": BaseTypes.UINT64_T})
+image_service.add_operation(
+    name="image_scaling_factor_FieldGetter",
+    out_parameter={"data": BaseTypes.UINT64_T},
+    field_notifier="image_scaling_factor_FieldNotifier",
+)
 image_service.add_operation(name="image_scaling_factor_FieldSetter", in_parameter={"data": BaseTypes.UINT64_T})
 image_service.add_operation(
     name="GetImageSize", out_parameter={"width": BaseTypes.UINT16_T, "height": BaseTypes.UINT16_T}
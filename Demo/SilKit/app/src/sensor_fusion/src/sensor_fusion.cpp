@@ -45,17 +45,17 @@ void SensorFusion::Step1() {
     static std::uint64_t counter = 23;
     counter++;
     ImageServiceConsumer1_->image_scaling_factor_FieldSetter(counter);
-    vaf::Future<af::adas_demo_app::services::image_scaling_factor_FieldGetter::Output> getter_result =
-        ImageServiceConsumer1_->image_scaling_factor_FieldGetter();
-    if (vaf::is_future_ready(getter_result)) {
-      vaf::Result<af::adas_demo_app::services::image_scaling_factor_FieldGetter::Output> result{
-          getter_result.GetResult()};
-      if (result.HasValue()) {
-        vaf::OutputSyncStream{} << "Getter of Field results in: " << result.Value().data << "\n";
-      } else {
-        vaf::OutputSyncStream{} << "Getter received following error code: " << result.Error().UserMessage() << "\n";
-      }
-    }
+    // The reply is handled by a task of this module when it arrives, instead of polling the future in the next step
+    ImageServiceConsumer1_->image_scaling_factor_FieldGetter().Then(
+        executor_,
+        [](vaf::Result<af::adas_demo_app::services::image_scaling_factor_FieldGetter::Output> result) {
+          if (result.HasValue()) {
+            vaf::OutputSyncStream{} << "Getter of Field results in: " << result.Value().data << "\n";
+          } else {
+            vaf::OutputSyncStream{} << "Getter received following error code: " << result.Error().UserMessage()
+                                    << "\n";
+          }
+        });
     bool no_new_image{false};
 
     auto image1 = ImageServiceConsumer1_->GetAllocated_camera_image().InspectError(
@@ -101,13 +101,13 @@ void SensorFusion::Step1() {
   // }
   // vaf::OutputSyncStream{} << "\n";
 
-  vaf::Future<af::adas_demo_app::services::GetImageSize::Output> answer = ImageServiceConsumer1_->GetImageSize();
-  if (vaf::is_future_ready(answer)) {
-    auto result = answer.GetResult();
-    if (result.HasValue()) {
-      vaf::OutputSyncStream{} << "GetImageSize() yields: " << result.Value().width << "x" << result.Value().height << "\n";
-    }
-  }
+  ImageServiceConsumer1_->GetImageSize().Then(
+      [](vaf::Result<af::adas_demo_app::services::GetImageSize::Output> result) {
+        if (result.HasValue()) {
+          vaf::OutputSyncStream{} << "GetImageSize() yields: " << result.Value().width << "x" << result.Value().height
+                                  << "\n";
+        }
+      });
   return ::adas::interfaces::ObjectDetectionList{};  // dummy implementation
 }
 
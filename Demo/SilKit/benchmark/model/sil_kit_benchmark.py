@@ -0,0 +1,24 @@
+from datetime import timedelta
+
+from .application_modules import *
+from vaf import *
+
+# Number of receiver executables, each one is a SIL Kit participant with a subscriber of its own
+RECEIVERS = 4
+
+sender = Executable("SilKitBenchmarkSender", timedelta(milliseconds=1))
+sender.add_application_module(SilKitBenchmarkSender, [])
+sender.connect_provided_interface_to_silkit(
+    SilKitBenchmarkSender,
+    Instances.SilKitBenchmarkSender.ProvidedInterfaces.ImageServiceProvider,
+    "Silkit_ImageBenchmark",
+)
+
+for index in range(1, RECEIVERS + 1):
+    receiver = Executable(f"SilKitBenchmarkReceiver{index}", timedelta(milliseconds=10))
+    receiver.add_application_module(SilKitBenchmarkReceiver, [])
+    receiver.connect_consumed_interface_to_silkit(
+        SilKitBenchmarkReceiver,
+        Instances.SilKitBenchmarkReceiver.ConsumedInterfaces.ImageServiceConsumer,
+        "Silkit_ImageBenchmark",
+    )
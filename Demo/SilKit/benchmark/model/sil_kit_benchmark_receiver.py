@@ -0,0 +1,13 @@
+from datetime import timedelta
+from vaf import vafpy
+
+from .imported_models import *
+
+sil_kit_benchmark_receiver = vafpy.ApplicationModule(
+    name="SilKitBenchmarkReceiver", namespace="NsApplicationUnit::NsSilKitBenchmarkReceiver"
+)
+sil_kit_benchmark_receiver.add_consumed_interface(
+    instance_name="ImageServiceConsumer", interface=interfaces.Af.AdasDemoApp.Services.image_service
+)
+
+sil_kit_benchmark_receiver.add_task(task=vafpy.Task(name="ReportTask", period=timedelta(milliseconds=10)))
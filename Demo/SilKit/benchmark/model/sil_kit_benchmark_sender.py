@@ -0,0 +1,13 @@
+from datetime import timedelta
+from vaf import vafpy
+
+from .imported_models import *
+
+sil_kit_benchmark_sender = vafpy.ApplicationModule(
+    name="SilKitBenchmarkSender", namespace="NsApplicationUnit::NsSilKitBenchmarkSender"
+)
+sil_kit_benchmark_sender.add_provided_interface(
+    instance_name="ImageServiceProvider", interface=interfaces.Af.AdasDemoApp.Services.image_service
+)
+
+sil_kit_benchmark_sender.add_task(task=vafpy.Task(name="PublishTask", period=timedelta(milliseconds=1)))
@@ -0,0 +1,128 @@
+/*!********************************************************************************************************************
+ *  COPYRIGHT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  Copyright (c) 2024-2026 by Vector Informatik GmbH. All rights reserved.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -----------------------------------------------------------------------------------------------------------------*/
+/*!        \file  sil_kit_benchmark_receiver.cpp
+ *         \brief
+ *
+ *********************************************************************************************************************/
+
+#include "nsapplicationunit/nssilkitbenchmarkreceiver/sil_kit_benchmark_receiver.h"
+
+#include <algorithm>
+#include <iomanip>
+
+#include "vaf/output_sync_stream.h"
+
+namespace NsApplicationUnit {
+namespace NsSilKitBenchmarkReceiver {
+
+namespace {
+
+// A step ends once no image arrived for this time, the sender pauses longer between two steps
+constexpr std::chrono::milliseconds kIdleTime{500};
+
+// Percentile of sorted values in microseconds
+double Percentile(const std::vector<std::uint64_t>& values, double percentile) {
+  if (values.empty()) {
+    return 0.0;
+  }
+  const std::size_t index{static_cast<std::size_t>(percentile * static_cast<double>(values.size() - 1))};
+  return static_cast<double>(values[index]) / 1000.0;
+}
+
+std::uint64_t Now() {
+  return static_cast<std::uint64_t>(
+      std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+          .count());
+}
+
+}  // namespace
+
+/**********************************************************************************************************************
+  Constructor
+**********************************************************************************************************************/
+SilKitBenchmarkReceiver::SilKitBenchmarkReceiver(ConstructorToken&& token)
+    : SilKitBenchmarkReceiverBase(std::move(token)) {
+  statistics_.latencies.reserve(1U << 16U);
+  statistics_.round_trips.reserve(1U << 12U);
+
+  // Called on the receive thread of SIL Kit, so the latency does not include any wait for the executor
+  ImageServiceConsumer_->RegisterDataElementHandler_camera_image(
+      GetName(), [this](vaf::ConstDataPtr<const datatypes::Image> image) { OnImage(*image); });
+}
+
+void SilKitBenchmarkReceiver::OnImage(const datatypes::Image& image) {
+  const std::uint64_t now{Now()};
+  std::lock_guard<std::mutex> lock{mutex_};
+  if ((statistics_.samples != 0) && (statistics_.step != image.width)) {
+    Report();
+  }
+  if (statistics_.samples == 0) {
+    statistics_.step = image.width;
+    statistics_.payload_size = image.R.size() + image.G.size() + image.B.size();
+    statistics_.first_sample = std::chrono::steady_clock::now();
+  }
+  ++statistics_.samples;
+  statistics_.last_sample = std::chrono::steady_clock::now();
+  statistics_.latencies.push_back(now - std::min(now, image.timestamp));
+}
+
+/**********************************************************************************************************************
+  1 periodic task(s)
+**********************************************************************************************************************/
+// Task with name ReportTask and a period of 10ms.
+void SilKitBenchmarkReceiver::ReportTask() {
+  std::lock_guard<std::mutex> lock{mutex_};
+  if (statistics_.samples == 0) {
+    return;
+  }
+  if ((std::chrono::steady_clock::now() - statistics_.last_sample) > kIdleTime) {
+    Report();
+  } else if (!call_pending_) {
+    CallGetImageSize();
+  }
+}
+
+void SilKitBenchmarkReceiver::CallGetImageSize() {
+  // The round trip ends when the reply is handled by a task of this module, like a reply an application waits for
+  call_pending_ = true;
+  const std::uint64_t start{Now()};
+  ImageServiceConsumer_->GetImageSize().Then(
+      executor_, [this, start](vaf::Result<af::adas_demo_app::services::GetImageSize::Output> result) {
+        const std::uint64_t end{Now()};
+        std::lock_guard<std::mutex> lock{mutex_};
+        call_pending_ = false;
+        if (result.HasValue() && (statistics_.samples != 0)) {
+          statistics_.round_trips.push_back(end - start);
+        }
+      });
+}
+
+void SilKitBenchmarkReceiver::Report() {
+  StepStatistics& s{statistics_};
+  const double seconds{std::chrono::duration<double>(s.last_sample - s.first_sample).count()};
+  const double rate{(seconds > 0.0) ? (static_cast<double>(s.samples - 1) / seconds) : 0.0};
+  std::sort(s.latencies.begin(), s.latencies.end());
+  std::sort(s.round_trips.begin(), s.round_trips.end());
+
+  vaf::OutputSyncStream{} << std::fixed << std::setprecision(1) << "Step " << s.step << ": " << s.payload_size
+                          << " byte payload, " << s.samples << " samples, " << rate << " msgs/s, "
+                          << (rate * static_cast<double>(s.payload_size) / 1e6) << " MB/s, latency p50 "
+                          << Percentile(s.latencies, 0.5) << " us p99 " << Percentile(s.latencies, 0.99)
+                          << " us, round trip p50 " << Percentile(s.round_trips, 0.5) << " us p99 "
+                          << Percentile(s.round_trips, 0.99) << " us (" << s.round_trips.size() << " calls)\n";
+
+  s.samples = 0;
+  s.latencies.clear();
+  s.round_trips.clear();
+}
+
+}  // namespace NsSilKitBenchmarkReceiver
+}  // namespace NsApplicationUnit
@@ -0,0 +1,61 @@
+/*!********************************************************************************************************************
+ *  COPYRIGHT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  Copyright (c) 2024-2026 by Vector Informatik GmbH. All rights reserved.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -----------------------------------------------------------------------------------------------------------------*/
+/*!        \file  sil_kit_benchmark_receiver.h
+ *         \brief
+ *
+ *********************************************************************************************************************/
+
+#ifndef NSAPPLICATIONUNIT_SILKITBENCHMARKRECEIVER_SIL_KIT_BENCHMARK_RECEIVER_H
+#define NSAPPLICATIONUNIT_SILKITBENCHMARKRECEIVER_SIL_KIT_BENCHMARK_RECEIVER_H
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+#include "nsapplicationunit/nssilkitbenchmarkreceiver/sil_kit_benchmark_receiver_base.h"
+
+namespace NsApplicationUnit {
+namespace NsSilKitBenchmarkReceiver {
+
+// Measures the images of each step of the sender and reports throughput, latency and RPC round trip once it ends
+class SilKitBenchmarkReceiver : public SilKitBenchmarkReceiverBase {
+ public:
+  SilKitBenchmarkReceiver(ConstructorToken&& token);
+
+  void ReportTask() override;
+
+ private:
+  struct StepStatistics {
+    std::uint16_t step{0};
+    std::size_t payload_size{0};
+    std::uint64_t samples{0};
+    std::chrono::steady_clock::time_point first_sample{};
+    std::chrono::steady_clock::time_point last_sample{};
+    std::vector<std::uint64_t> latencies{};
+    std::vector<std::uint64_t> round_trips{};
+  };
+
+  void OnImage(const datatypes::Image& image);
+  void CallGetImageSize();
+  // Prints the statistics of the current step and clears them, the mutex must be held
+  void Report();
+
+  std::mutex mutex_{};
+  StepStatistics statistics_{};
+  bool call_pending_{false};
+};
+
+}  // namespace NsSilKitBenchmarkReceiver
+}  // namespace NsApplicationUnit
+
+#endif  // NSAPPLICATIONUNIT_SILKITBENCHMARKRECEIVER_SIL_KIT_BENCHMARK_RECEIVER_H
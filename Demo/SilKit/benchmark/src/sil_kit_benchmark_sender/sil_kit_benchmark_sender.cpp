@@ -0,0 +1,134 @@
+/*!********************************************************************************************************************
+ *  COPYRIGHT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  Copyright (c) 2024-2026 by Vector Informatik GmbH. All rights reserved.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -----------------------------------------------------------------------------------------------------------------*/
+/*!        \file  sil_kit_benchmark_sender.cpp
+ *         \brief
+ *
+ *********************************************************************************************************************/
+
+#include "nsapplicationunit/nssilkitbenchmarksender/sil_kit_benchmark_sender.h"
+
+#include <cstdlib>
+#include <sstream>
+#include <string>
+
+#include "vaf/output_sync_stream.h"
+
+namespace NsApplicationUnit {
+namespace NsSilKitBenchmarkSender {
+
+namespace {
+
+// Time for the receivers to subscribe before the first step, and to report a step before the next one
+constexpr std::chrono::seconds kStartDelay{3};
+constexpr std::chrono::seconds kPause{1};
+// Samples published per task execution at most, so a rate above 1000 Hz does not stall the executor
+constexpr std::uint64_t kMaxBurst{100};
+
+// Reads a comma separated list like 64,1024 from an environment variable
+std::vector<std::uint64_t> GetList(const char* name, std::vector<std::uint64_t> values) {
+  const char* value{std::getenv(name)};
+  if (value != nullptr) {
+    values.clear();
+    std::istringstream stream{value};
+    for (std::string item; std::getline(stream, item, ',');) {
+      values.push_back(std::stoull(item));
+    }
+  }
+  return values;
+}
+
+}  // namespace
+
+/**********************************************************************************************************************
+  Constructor
+**********************************************************************************************************************/
+SilKitBenchmarkSender::SilKitBenchmarkSender(ConstructorToken&& token) : SilKitBenchmarkSenderBase(std::move(token)) {
+  const std::vector<std::uint64_t> payload_sizes{
+      GetList("VAF_BENCHMARK_PAYLOAD_SIZES", {64, 1024, 16384, 262144, 921600})};
+  const std::vector<std::uint64_t> rates{GetList("VAF_BENCHMARK_RATES", {10, 100, 1000})};
+  step_duration_ = std::chrono::seconds{GetList("VAF_BENCHMARK_STEP_DURATION", {5}).at(0)};
+  for (const std::uint64_t payload_size : payload_sizes) {
+    for (const std::uint64_t rate : rates) {
+      steps_.push_back(Step{static_cast<std::size_t>(payload_size), rate});
+    }
+  }
+  step_start_ = std::chrono::steady_clock::now() + kStartDelay;
+
+  ImageServiceProvider_->RegisterOperationHandler_GetImageSize(
+      [this]() -> af::adas_demo_app::services::GetImageSize::Output {
+        af::adas_demo_app::services::GetImageSize::Output output{};
+        output.width = image_.width;
+        output.height = image_.height;
+        return output;
+      });
+}
+
+/**********************************************************************************************************************
+  1 periodic task(s)
+**********************************************************************************************************************/
+// Task with name PublishTask and a period of 1ms.
+void SilKitBenchmarkSender::PublishTask() {
+  if (step_index_ >= steps_.size()) {
+    return;
+  }
+  const std::chrono::steady_clock::time_point now{std::chrono::steady_clock::now()};
+  if (!step_running_) {
+    if (now < step_start_) {
+      return;
+    }
+    StartStep();
+  }
+  const std::chrono::steady_clock::duration elapsed{now - step_start_};
+  if (elapsed >= step_duration_) {
+    FinishStep(now);
+    return;
+  }
+
+  // Publishes the samples that are due since the start of the step
+  const std::uint64_t due{static_cast<std::uint64_t>(std::chrono::duration<double>(elapsed).count() *
+                                                     static_cast<double>(steps_[step_index_].rate))};
+  for (std::uint64_t burst = 0; (published_ < due) && (burst < kMaxBurst); ++burst) {
+    // Receivers on the same host read the same steady clock, so the publish time gives them the latency
+    image_.timestamp = static_cast<std::uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+            .count());
+    ImageServiceProvider_->Set_camera_image(image_);
+    ++published_;
+  }
+}
+
+void SilKitBenchmarkSender::StartStep() {
+  const Step& step{steps_[step_index_]};
+  // The payload is split over the color channels, the receivers tell the steps apart by the width
+  const std::size_t channel_size{step.payload_size / 3};
+  image_.R.assign(step.payload_size - (2 * channel_size), 0x52);
+  image_.G.assign(channel_size, 0x47);
+  image_.B.assign(channel_size, 0x42);
+  image_.width = static_cast<std::uint16_t>(step_index_ + 1);
+  image_.height = 1;
+  published_ = 0;
+  step_running_ = true;
+}
+
+void SilKitBenchmarkSender::FinishStep(std::chrono::steady_clock::time_point now) {
+  const Step& step{steps_[step_index_]};
+  vaf::OutputSyncStream{} << "Step " << (step_index_ + 1) << ": " << step.payload_size << " byte payload at "
+                          << step.rate << " Hz, " << published_ << " samples published\n";
+  ++step_index_;
+  step_running_ = false;
+  step_start_ = now + kPause;
+  if (step_index_ == steps_.size()) {
+    vaf::OutputSyncStream{} << "Benchmark finished\n";
+  }
+}
+
+}  // namespace NsSilKitBenchmarkSender
+}  // namespace NsApplicationUnit
@@ -0,0 +1,58 @@
+/*!********************************************************************************************************************
+ *  COPYRIGHT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  Copyright (c) 2024-2026 by Vector Informatik GmbH. All rights reserved.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -----------------------------------------------------------------------------------------------------------------*/
+/*!        \file  sil_kit_benchmark_sender.h
+ *         \brief
+ *
+ *********************************************************************************************************************/
+
+#ifndef NSAPPLICATIONUNIT_SILKITBENCHMARKSENDER_SIL_KIT_BENCHMARK_SENDER_H
+#define NSAPPLICATIONUNIT_SILKITBENCHMARKSENDER_SIL_KIT_BENCHMARK_SENDER_H
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "nsapplicationunit/nssilkitbenchmarksender/sil_kit_benchmark_sender_base.h"
+
+namespace NsApplicationUnit {
+namespace NsSilKitBenchmarkSender {
+
+// Publishes images of each payload size at each rate for one step of the benchmark
+class SilKitBenchmarkSender : public SilKitBenchmarkSenderBase {
+ public:
+  SilKitBenchmarkSender(ConstructorToken&& token);
+
+  void PublishTask() override;
+
+ private:
+  struct Step {
+    std::size_t payload_size;
+    std::uint64_t rate;
+  };
+
+  void StartStep();
+  void FinishStep(std::chrono::steady_clock::time_point now);
+
+  std::vector<Step> steps_{};
+  std::chrono::steady_clock::duration step_duration_{};
+  std::size_t step_index_{0};
+  bool step_running_{false};
+  // Start of the current step, or the end of the pause before the next one
+  std::chrono::steady_clock::time_point step_start_{};
+  std::uint64_t published_{0};
+  datatypes::Image image_{};
+};
+
+}  // namespace NsSilKitBenchmarkSender
+}  // namespace NsApplicationUnit
+
+#endif  // NSAPPLICATIONUNIT_SILKITBENCHMARKSENDER_SIL_KIT_BENCHMARK_SENDER_H
@@ -0,0 +1,81 @@
+# Copyright (c) 2024-2026 by Vector Informatik GmbH. All rights reserved.
+# SPDX-License-Identifier: Apache-2.0
+
+"""Source code for vaf analyze subcommands"""
+
+import json
+from pathlib import Path
+from typing import Optional
+
+import click
+
+from vaf import vafmodel
+from vaf.core.objects.analyze_cmd import AnalyzeCmd
+
+
+# pylint: disable-next=unused-argument
+def _parse_metrics_files(ctx: click.Context, param: click.Parameter, value: tuple[str, ...]) -> dict[str, Path]:
+    metrics_files: dict[str, Path] = {}
+    for item in value:
+        executable, separator, path = item.partition("=")
+        if not separator or not executable or not path:
+            raise click.BadParameter(f"{item} is no metrics file like MyExecutable=metrics.prom")
+        metrics_files[executable] = Path(path)
+    return metrics_files
+
+
+# vaf analyze chains #
+@click.command()
+@click.option(
+    "-p",
+    "--project-dir",
+    type=click.Path(exists=True, file_okay=False),
+    default=".",
+    help="Path to the integration project root directory",
+    show_default=True,
+)
+@click.option(
+    "-m",
+    "--metrics-file",
+    "metrics_files",
+    multiple=True,
+    callback=_parse_metrics_files,
+    help="Metrics export of an executable as <executable>=<file>, defaults to the file of its metrics export",
+)
+@click.option("--source", "sources", multiple=True, help="Module the chains start at, can be repeated")
+@click.option("--sink", "sinks", multiple=True, help="Module the chains end at, can be repeated")
+@click.option(
+    "--max-chains", type=click.IntRange(min=1), default=100, help="Maximum number of chains", show_default=True
+)
+@click.option(
+    "-o",
+    "--output-file",
+    type=click.Path(dir_okay=False, writable=True),
+    help="JSON file to write the chains with all their hops to",
+)
+# pylint: disable-next=too-many-arguments, too-many-positional-arguments
+def analyze_chains(
+    project_dir: str,
+    metrics_files: dict[str, Path],
+    sources: tuple[str, ...],
+    sinks: tuple[str, ...],
+    max_chains: int,
+    output_file: Optional[str] = None,
+) -> None:  # pylint: disable=missing-param-doc
+    """Compute the end-to-end latency of the cause-effect chains of an integration project.
+
+    The chains follow the RunAfter relations of the tasks and the data elements between the modules, from the
+    platform consumer modules or the first tasks to the platform provider modules or the last tasks. Each hop adds the
+    sample latency, the wait for the consuming task, its start lateness and its execution time, taken from the metrics
+    export of the executables. Run the executables with VAF_SAMPLE_TRACE=1 to measure the sample latencies.
+    """
+    path_project = Path(project_dir)
+    model = vafmodel.load_json(path_project / "model/vaf/model.json")
+    cmd = AnalyzeCmd()
+    chains = cmd.analyze(
+        model, cmd.read_metrics(model, metrics_files), list(sources), list(sinks), max_chains=max_chains
+    )
+    for line in AnalyzeCmd.format_report(chains):
+        click.echo(line)
+    if output_file is not None:
+        Path(output_file).write_text(json.dumps(chains, indent=2), encoding="utf-8")
@@ -0,0 +1,198 @@
+# Copyright (c) 2024-2026 by Vector Informatik GmbH. All rights reserved.
+# SPDX-License-Identifier: Apache-2.0
+
+"""Source code for vaf load subcommands"""
+
+import json
+from datetime import timedelta
+from pathlib import Path
+from typing import Optional
+
+import click
+
+from vaf.core.common.click_extension import cli_verbose_option
+from vaf.core.common.utils import ProjectType, get_project_type, time_str_to_microseconds
+from vaf.core.objects.load_cmd import LoadCmd, LoadParameters
+
+
+# pylint: disable-next=unused-argument
+def _parse_periods(ctx: click.Context, param: click.Parameter, value: Optional[str]) -> Optional[list[timedelta]]:
+    if value is None:
+        return None
+    periods: list[timedelta] = []
+    for time_str in value.split(","):
+        microseconds = time_str_to_microseconds(time_str.strip())
+        if microseconds is None:
+            raise click.BadParameter(f"{time_str} is no time like 10ms")
+        periods.append(timedelta(microseconds=microseconds))
+    return periods
+
+
+# pylint: disable-next=unused-argument
+def _parse_sizes(ctx: click.Context, param: click.Parameter, value: str) -> list[int]:
+    try:
+        return [int(size) for size in value.split(",")]
+    except ValueError as e:
+        raise click.BadParameter(f"{value} is no list of sizes like 64,1024") from e
+
+
+# vaf load generate #
+@click.command()
+@cli_verbose_option
+@click.option(
+    "-p",
+    "--project-dir",
+    type=click.Path(exists=True, file_okay=False, writable=True),
+    default=".",
+    help="Path to the integration project root directory",
+    show_default=True,
+)
+@click.option(
+    "--modules", type=click.IntRange(min=1), default=10, help="Number of application modules", show_default=True
+)
+@click.option("--tasks", type=click.IntRange(min=1), default=1, help="Periodic tasks per module", show_default=True)
+@click.option(
+    "--data-elements", type=click.IntRange(min=1), default=1, help="Data elements per module", show_default=True
+)
+@click.option(
+    "--fan-out", type=click.IntRange(min=0), default=1, help="Consumers of the data of each module", show_default=True
+)
+@click.option(
+    "--periods",
+    default="10ms",
+    callback=_parse_periods,
+    help="Task periods, assigned to the modules in turn",
+    show_default=True,
+)
+@click.option(
+    "--payload-sizes",
+    default="64",
+    callback=_parse_sizes,
+    help="Data element sizes in bytes, assigned to the modules in turn",
+    show_default=True,
+)
+@click.option(
+    "--communication",
+    type=click.Choice(["internal", "silkit", "shm"], case_sensitive=True),
+    default="internal",
+    help="Communication between the modules",
+    show_default=True,
+)
+@click.option(
+    "--executables",
+    type=click.IntRange(min=1),
+    default=1,
+    help="Executables the modules are distributed to, needs silkit or shm if more than one",
+    show_default=True,
+)
+@click.option(
+    "--executor-period",
+    callback=_parse_periods,
+    help="Executor period, defaults to the greatest common divisor of the periods",
+)
+@click.option(
+    "--metrics-dir",
+    default="/dev/shm",
+    help="Directory the executables export their metrics to",
+    show_default=True,
+)
+# pylint: disable-next=too-many-arguments, too-many-positional-arguments
+def load_generate(
+    project_dir: str,
+    modules: int,
+    tasks: int,
+    data_elements: int,
+    fan_out: int,
+    periods: list[timedelta],
+    payload_sizes: list[int],
+    communication: str,
+    executables: int,
+    metrics_dir: str,
+    executor_period: Optional[list[timedelta]] = None,
+    verbose: bool = False,
+) -> None:  # pylint: disable=missing-param-doc
+    """Generate a synthetic load project into an integration project.
+
+    Replaces the model and the application modules of the project, so use a new project created by
+    vaf project init integration. Build it with vaf make and measure it with vaf load run.
+    """
+    path_project = Path(project_dir)
+    if get_project_type(path_project) != ProjectType.INTEGRATION:
+        click.echo("\nNo VAF integration project found!")
+        return
+    parameters = LoadParameters(
+        modules=modules,
+        tasks=tasks,
+        data_elements=data_elements,
+        fan_out=fan_out,
+        periods=periods,
+        payload_sizes=payload_sizes,
+        communication=communication,
+        executables=executables,
+        executor_period=executor_period[0] if executor_period else None,
+        metrics_dir=metrics_dir,
+    )
+    try:
+        parameters.validate()
+    except ValueError as e:
+        raise click.BadParameter(str(e)) from e
+    LoadCmd().generate(path_project, parameters, verbose)
+
+
+# vaf load run #
+@click.command()
+@click.option(
+    "-p",
+    "--project-dir",
+    type=click.Path(exists=True, file_okay=False),
+    default=".",
+    help="Path to the integration project root directory",
+    show_default=True,
+)
+@click.option(
+    "-b",
+    "--build-dir",
+    type=click.Path(exists=True, file_okay=False),
+    help="Build directory of the project, defaults to build/Release in the project",
+)
+@click.option(
+    "-d",
+    "--duration",
+    type=click.FloatRange(min=0, min_open=True),
+    default=10.0,
+    help="Run time in seconds",
+    show_default=True,
+)
+@click.option(
+    "--sample-interval",
+    type=click.FloatRange(min=0, min_open=True),
+    default=1.0,
+    help="Interval of the CPU use samples in seconds",
+    show_default=True,
+)
+@click.option(
+    "-o",
+    "--output-file",
+    type=click.Path(dir_okay=False, writable=True),
+    help="JSON file to write all measurements to, including the CPU use and latency curves",
+)
+def load_run(
+    project_dir: str,
+    duration: float,
+    sample_interval: float,
+    build_dir: Optional[str] = None,
+    output_file: Optional[str] = None,
+) -> None:  # pylint: disable=missing-param-doc
+    """Run the executables of a project and report CPU use, jitter and latencies.
+
+    The executables are started with sample tracing and stopped after the duration. The executor statistics, the
+    task jitter and the sample latencies are read from their metrics export. A SIL Kit registry has to be started
+    before if the project uses SIL Kit.
+    """
+    path_project = Path(project_dir)
+    path_build = Path(build_dir) if build_dir is not None else path_project / "build/Release"
+    report = LoadCmd().run(path_project / "model/vaf/model.json", path_build, duration, sample_interval)
+    for line in LoadCmd.format_report(report):
+        click.echo(line)
+    if output_file is not None:
+        Path(output_file).write_text(json.dumps(report, indent=2), encoding="utf-8")
@@ -0,0 +1,36 @@
+# Copyright (c) 2024-2026 by Vector Informatik GmbH. All rights reserved.
+# SPDX-License-Identifier: Apache-2.0
+
+"""Source code for vaf log subcommands"""
+
+from pathlib import Path
+from typing import Optional
+
+import click
+
+from vaf.core.objects.log_cmd import LogCmd
+
+
+# vaf log decode #
+@click.command()
+@click.option(
+    "-i",
+    "--input-file",
+    help="Binary log file written by vaf::Logger.",
+    required=True,
+    type=click.Path(exists=True, dir_okay=False),
+)
+@click.option(
+    "-o",
+    "--output-file",
+    help="Text file to write the log lines to, they are printed if not set.",
+    type=click.Path(dir_okay=False, writable=True),
+)
+def log_decode(input_file: str, output_file: Optional[str] = None) -> None:  # pylint: disable=missing-param-doc
+    """Decode a binary log file into text."""
+    lines = LogCmd().decode(Path(input_file))
+    if output_file is None:
+        for line in lines:
+            click.echo(line)
+    else:
+        Path(output_file).write_text("".join(line + "\n" for line in lines), encoding="utf-8")
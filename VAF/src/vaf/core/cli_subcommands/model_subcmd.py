@@ -46,7 +46,17 @@ def model_import() -> None:
     type=click.Path(exists=True, dir_okay=False),
     prompt="Enter the path to the VSS catalogue file in JSON format",
 )
-def model_import_vss(project_dir: str, input_file: str) -> None:  # pylint: disable=missing-param-doc
+@click.option(
+    "-s",
+    "--signal",
+    "signals",
+    multiple=True,
+    help="Path or glob pattern of the VSS signals or branches to import, e.g. Vehicle.Cabin.*. Can be given "
+    "multiple times. Imports all signals if not set.",
+)
+def model_import_vss(  # pylint: disable=missing-param-doc
+    project_dir: str, input_file: str, signals: tuple[str, ...]
+) -> None:
     """Import the VAF model from a VSS input file."""
     # Look for project type in VAF_CFG_FILE in the project directory
     project_type = get_project_type(Path(project_dir))
@@ -58,7 +68,7 @@ def model_import_vss(project_dir: str, input_file: str) -> None:  # pylint: disa
     else:
         click.echo(f"Derive for model VSS from {input_file}.")
         cmd = ModelCmd()
-        cmd.import_vss(input_file, model_dir)
+        cmd.import_vss(input_file, model_dir, list(signals))
 
 
 # vaf model import ifex #
@@ -136,10 +136,10 @@ def is_source_file(file_path: Path) -> bool:  # pylint: disable=missing-param-do
 @click.option(
     "-t",
     "--type-variant",
-    help="Type variant of the generated data types.",
+    help="Type variant of the generated data types. pmr uses polymorphic allocators for the containers (C++17).",
     required=False,
     envvar="TYPE_VARIANT",
-    type=click.Choice(["std"], case_sensitive=False),
+    type=click.Choice(["std", "pmr"], case_sensitive=False),
     default="std",
     show_default=True,
 )
@@ -20,6 +20,7 @@ class PersistencyLibrary(TruthyEnum):
 
     NONE = ""
     LEVELDB = "leveldb"
+    MMAP = "mmap"
 
 
 VAF_CFG_FILE = ".vafconfig.json"
@@ -6,6 +6,7 @@
 import importlib.util
 import json
 import re
+from datetime import timedelta
 from enum import Enum
 from pathlib import Path
 from typing import Any, Callable, Dict, Tuple
@@ -34,6 +35,34 @@ def create_name_namespace_full_name(name: str, namespace: str) -> str:
     return "::".join([namespace, name])
 
 
+def timedelta_to_time_str(period: timedelta) -> str:
+    """Function to convert a timedelta to a time string, in microseconds if it is no multiple of a millisecond
+    Args:
+        period: time as timedelta
+    Returns:
+        Time string, e.g. "10ms" or "250us"
+    """
+    microseconds = period // timedelta(microseconds=1)
+    if microseconds % 1_000 == 0:
+        return f"{microseconds // 1_000}ms"
+    return f"{microseconds}us"
+
+
+def time_str_to_microseconds(time_str: str) -> int | None:
+    """Function to convert a time string to microseconds
+    Args:
+        time_str: time string with one of the units ns, us, ms or s
+    Returns:
+        Time in microseconds or None if the time string is invalid
+    """
+    nanoseconds_per_unit = {"ns": 1, "us": 1_000, "ms": 1_000_000, "s": 1_000_000_000}
+    for unit, nanoseconds in nanoseconds_per_unit.items():
+        value = time_str.removesuffix(unit)
+        if value != time_str:
+            return int(value) * nanoseconds // 1_000 if value.isdigit() else None
+    return None
+
+
 def concat_str_to_path(path: Path, concat_str: str) -> Path:
     """Function to concatenate a string to a path
     Args:
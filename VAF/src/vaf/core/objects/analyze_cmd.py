@@ -0,0 +1,433 @@
+# Copyright (c) 2024-2026 by Vector Informatik GmbH. All rights reserved.
+# SPDX-License-Identifier: Apache-2.0
+
+"""Implements the functionality of analysis-related commands."""
+
+from dataclasses import dataclass, field
+from pathlib import Path
+from typing import Any, Optional
+
+from vaf import vafmodel
+from vaf.core.common.utils import time_str_to_microseconds
+from vaf.core.objects.load_cmd import LoadCmd
+
+# Upper bound of the histogram buckets taken as the worst case of a measured latency
+_WORST_PERCENTILE = "p99"
+_PARTS = ("communication", "sampling", "lateness", "execution")
+
+
+@dataclass(frozen=True)
+class ChainNode:
+    """Task of an application module or platform module at the start or end of a chain
+
+    Attributes:
+        executable: Executable of the node, empty for platform modules outside of the model
+        module: Name of the application or platform module
+        task: Name of the task, empty for platform modules and for application modules without tasks
+    """
+
+    executable: str
+    module: str
+    task: str = ""
+
+    def __str__(self) -> str:
+        return f"{self.module}::{self.task}" if self.task else self.module
+
+
+@dataclass(frozen=True)
+class ChainEdge:
+    """Edge between two nodes of a chain
+
+    Attributes:
+        target: Node the edge leads to
+        via: Module the samples are exchanged through, empty if the target task runs after the source task
+        inputs: Paths of the sample latency metrics of the exchanged samples, see vaf_sample_latency_seconds
+        load_inputs: Consumed instance of the target module, see vaf_load_sample_latency_seconds
+    """
+
+    target: ChainNode
+    via: str = ""
+    inputs: tuple[str, ...] = ()
+    load_inputs: tuple[str, ...] = ()
+
+
+@dataclass
+class Timing:
+    """Typical and worst-case duration in seconds
+
+    Attributes:
+        typical: Mean or typical duration
+        worst: Worst-case duration
+        measured: False if the duration is missing in the metrics
+    """
+
+    typical: float = 0.0
+    worst: float = 0.0
+    measured: bool = True
+
+    def __add__(self, other: "Timing") -> "Timing":
+        return Timing(self.typical + other.typical, self.worst + other.worst, self.measured and other.measured)
+
+
+@dataclass
+class ChainGraph:
+    """Tasks and their cause-effect relations of a model
+
+    Attributes:
+        edges: Outgoing edges of each node
+        periods: Period of each task in seconds
+    """
+
+    edges: dict[ChainNode, list[ChainEdge]] = field(default_factory=dict)
+    periods: dict[ChainNode, float] = field(default_factory=dict)
+
+    def add_node(self, node: ChainNode) -> None:
+        """Adds a node without edges
+        Args:
+            node: The node
+        """
+        self.edges.setdefault(node, [])
+
+    def add_edge(self, source: ChainNode, edge: ChainEdge) -> None:
+        """Adds an edge and its nodes
+        Args:
+            source: Node the edge starts at
+            edge: The edge
+        """
+        self.add_node(source)
+        self.add_node(edge.target)
+        if edge not in self.edges[source]:
+            self.edges[source].append(edge)
+
+
+def _connection_key(module: vafmodel.PlatformModule) -> Optional[tuple[str, ...]]:
+    connection_point = module.ConnectionPointRef
+    if isinstance(connection_point, vafmodel.SILKITConnectionPoint):
+        return ("silkit", connection_point.SilkitInstance, connection_point.SilkitNamespace or "")
+    if isinstance(connection_point, vafmodel.SHMConnectionPoint):
+        return ("shm", connection_point.SegmentName)
+    return None
+
+
+class AnalyzeCmd:
+    """Class implementing the analysis-related commands"""
+
+    @staticmethod
+    def build_graph(model: vafmodel.MainModel) -> ChainGraph:  # pylint: disable=too-many-locals
+        """Builds the cause-effect graph of the tasks of a model
+        Tasks of a module are connected by their RunAfter relations. Samples are assumed to be published by the last
+        tasks of the providing module and read by the first tasks of the consuming module, in the order of RunAfter.
+        Platform consumer modules without a provider in the model start chains, platform provider modules without a
+        consumer in the model end them.
+        Args:
+            model: The model
+        Returns:
+            The graph
+        """
+        graph = ChainGraph()
+        # Entry and exit tasks of each application module, and the modules its interface instances are mapped to
+        entries: dict[tuple[str, str], list[ChainNode]] = {}
+        exits: dict[tuple[str, str], list[ChainNode]] = {}
+        providers: dict[tuple[str, str], list[tuple[str, str]]] = {}
+        consumers: dict[tuple[str, str], list[tuple[str, str, str]]] = {}
+        platform_modules: dict[str, vafmodel.PlatformModule] = {}
+
+        for executable in model.Executables:
+            for mapping in executable.ApplicationModules:
+                app_module = mapping.ApplicationModuleRef
+                key = (executable.Name, app_module.Name)
+                tasks = {task.Name: ChainNode(executable.Name, app_module.Name, task.Name) for task in app_module.Tasks}
+                for task in app_module.Tasks:
+                    graph.add_node(tasks[task.Name])
+                    microseconds = time_str_to_microseconds(task.Period)
+                    graph.periods[tasks[task.Name]] = (microseconds or 0) * 1e-6
+                    for predecessor in task.RunAfter:
+                        if predecessor in tasks:
+                            graph.add_edge(tasks[predecessor], ChainEdge(tasks[task.Name]))
+                successors = {p for task in app_module.Tasks for p in task.RunAfter if p in tasks}
+                if tasks:
+                    entries[key] = [tasks[t.Name] for t in app_module.Tasks if not set(t.RunAfter) & set(tasks)]
+                    exits[key] = [tasks[t.Name] for t in app_module.Tasks if t.Name not in successors]
+                else:
+                    # Modules without tasks only react to their handlers
+                    entries[key] = exits[key] = [ChainNode(executable.Name, app_module.Name)]
+                    graph.add_node(entries[key][0])
+
+                consumed = {ci.InstanceName for ci in app_module.ConsumedInterfaces}
+                for instance in mapping.InterfaceInstanceToModuleMappings:
+                    module = instance.ModuleRef
+                    platform_modules[module.Name] = module
+                    if instance.InstanceName in consumed:
+                        consumers.setdefault((executable.Name, module.Name), []).append(
+                            (executable.Name, app_module.Name, instance.InstanceName)
+                        )
+                    else:
+                        providers.setdefault((executable.Name, module.Name), []).append(key)
+
+        def connect(sources: list[ChainNode], module: vafmodel.PlatformModule, consumer: tuple[str, str, str]) -> None:
+            executable_name, app_module_name, instance_name = consumer
+            inputs = tuple(
+                f"{module.Name}.{de.Name} -> {app_module_name}" for de in module.ModuleInterfaceRef.DataElements
+            )
+            for source in sources:
+                for target in entries[(executable_name, app_module_name)]:
+                    graph.add_edge(source, ChainEdge(target, module.Name, inputs, (instance_name,)))
+
+        # Executable-internal communication
+        for (executable_name, module_name), module_consumers in consumers.items():
+            for provider in providers.get((executable_name, module_name), []):
+                for consumer in module_consumers:
+                    connect(exits[provider], platform_modules[module_name], consumer)
+
+        # Communication between executables and with the outside through the platform modules
+        consumer_modules = {m.Name: m for m in model.PlatformConsumerModules}
+        provider_modules = {m.Name: m for m in model.PlatformProviderModules}
+        for module_name, provider_module in provider_modules.items():
+            key = _connection_key(provider_module)
+            matching = [m for m in consumer_modules.values() if key is not None and _connection_key(m) == key]
+            for (_, name), module_providers in providers.items():
+                if name != module_name:
+                    continue
+                sources = [node for provider in module_providers for node in exits[provider]]
+                if not matching:
+                    sink = ChainNode("", module_name)
+                    for source in sources:
+                        graph.add_edge(source, ChainEdge(sink, module_name))
+                for consumer_module in matching:
+                    for (_, consumer_name), module_consumers in consumers.items():
+                        if consumer_name == consumer_module.Name:
+                            for consumer in module_consumers:
+                                connect(sources, consumer_module, consumer)
+        for module_name, consumer_module in consumer_modules.items():
+            key = _connection_key(consumer_module)
+            if key is not None and any(_connection_key(m) == key for m in provider_modules.values()):
+                continue
+            for (_, name), module_consumers in consumers.items():
+                if name == module_name:
+                    for consumer in module_consumers:
+                        connect([ChainNode("", module_name)], consumer_module, consumer)
+        return graph
+
+    @staticmethod
+    def find_chains(
+        graph: ChainGraph,
+        sources: Optional[list[str]] = None,
+        sinks: Optional[list[str]] = None,
+        max_chains: int = 100,
+    ) -> list[list[tuple[Optional[ChainEdge], ChainNode]]]:
+        """Finds the chains of a graph, the paths from a source to a sink that pass each module once
+        Args:
+            graph: The graph
+            sources: Modules the chains start at, by default the nodes without incoming edges
+            sinks: Modules the chains end at, by default the nodes without outgoing edges
+            max_chains: Maximum number of chains to find
+        Returns:
+            Per chain its nodes with the edge leading to each of them, None for the first one
+        """
+        targets = {edge.target for edges in graph.edges.values() for edge in edges}
+        if sources:
+            # Tasks of a source module that run after other tasks of it continue the chains of those
+            successors = {
+                edge.target
+                for node, edges in graph.edges.items()
+                for edge in edges
+                if edge.target.module == node.module
+            }
+            starts = [node for node in graph.edges if node.module in sources and node not in successors]
+        else:
+            starts = [node for node in graph.edges if node not in targets]
+
+        def is_sink(node: ChainNode) -> bool:
+            return node.module in sinks if sinks else not graph.edges[node]
+
+        chains: list[list[tuple[Optional[ChainEdge], ChainNode]]] = []
+        path: list[tuple[Optional[ChainEdge], ChainNode]] = []
+
+        def visit(edge: Optional[ChainEdge], node: ChainNode) -> None:
+            # Samples do not return into a module of the chain, that would be the start of another one
+            if len(chains) >= max_chains or any(
+                node == visited or (edge is not None and edge.via and node.module == visited.module)
+                for _, visited in path
+            ):
+                return
+            path.append((edge, node))
+            if is_sink(node) and len(path) > 1:
+                chains.append(list(path))
+            else:
+                for next_edge in graph.edges[node]:
+                    visit(next_edge, next_edge.target)
+            path.pop()
+
+        for start in starts:
+            visit(None, start)
+        return chains
+
+    @staticmethod
+    def __measurements(metrics: dict[str, list[tuple[str, dict[str, str], float]]]) -> dict[str, dict[Any, Timing]]:
+        tasks: dict[Any, Timing] = {}
+        lateness: dict[Any, Timing] = {}
+        communication: dict[Any, Timing] = {}
+        for executable, samples in metrics.items():
+            for name, labels, value in samples:
+                key = (executable, labels.get("module", ""), labels.get("task", ""))
+                if name == "vaf_task_mean_execution_time_seconds":
+                    tasks.setdefault(key, Timing()).typical = value
+                elif name == "vaf_task_max_execution_time_seconds":
+                    tasks.setdefault(key, Timing()).worst = value
+                elif name == "vaf_task_start_lateness_seconds" and labels.get("quantile") == "0.99":
+                    lateness.setdefault(key, Timing()).worst = value
+                elif name == "vaf_task_start_lateness_seconds" and labels.get("quantile") == "0.5":
+                    lateness.setdefault(key, Timing()).typical = value
+            for histogram, key_labels in (
+                ("vaf_sample_latency_seconds", ("path",)),
+                ("vaf_load_sample_latency_seconds", ("module", "input")),
+            ):
+                sums = {
+                    tuple(labels.get(k, "") for k in key_labels): value
+                    for name, labels, value in samples
+                    if name == f"{histogram}_sum"
+                }
+                for summary in LoadCmd.summarize_histograms(samples, histogram, key_labels):
+                    key = (executable, *(summary[k] for k in key_labels))
+                    if summary["count"] == 0:
+                        continue
+                    typical = sums.get(key[1:], 0.0) / summary["count"]
+                    communication[key] = Timing(typical, max(typical, summary[_WORST_PERCENTILE] or 0.0))
+        return {"tasks": tasks, "lateness": lateness, "communication": communication}
+
+    @staticmethod
+    def __communication(edge: ChainEdge, node: ChainNode, communication: dict[Any, Timing]) -> Timing:
+        timings = [
+            communication[(node.executable, path)] for path in edge.inputs if (node.executable, path) in communication
+        ]
+        timings += [
+            communication[(node.executable, node.module, instance)]
+            for instance in edge.load_inputs
+            if (node.executable, node.module, instance) in communication
+        ]
+        if not timings:
+            return Timing(measured=False)
+        return Timing(max(t.typical for t in timings), max(t.worst for t in timings))
+
+    def analyze(
+        self,
+        model: vafmodel.MainModel,
+        metrics: dict[str, list[tuple[str, dict[str, str], float]]],
+        sources: Optional[list[str]] = None,
+        sinks: Optional[list[str]] = None,
+        max_chains: int = 100,
+    ) -> list[dict[str, Any]]:
+        """Computes the end-to-end latency of the cause-effect chains of a model
+        The latency of a chain adds up, per hop, the communication latency of the samples, the time until the
+        periodic task of the consumer reads them, the start lateness of that task and its execution time. The typical
+        latency uses the means of the measurements and half a period of sampling, the worst case the 99th percentile
+        or the maximum and a whole period.
+        Args:
+            model: The model
+            metrics: Parsed metrics export of each executable, see LoadCmd.parse_metrics
+            sources: Modules the chains start at, by default the nodes without incoming edges
+            sinks: Modules the chains end at, by default the nodes without outgoing edges
+            max_chains: Maximum number of chains to analyze
+        Returns:
+            Per chain its hops, its latency and the hop that dominates it, ordered by the worst-case latency
+        """
+        graph = self.build_graph(model)
+        measurements = self.__measurements(metrics)
+
+        def execution(node: ChainNode) -> Timing:
+            if not node.task:
+                return Timing()
+            return measurements["tasks"].get((node.executable, node.module, node.task), Timing(measured=False))
+
+        chains: list[dict[str, Any]] = []
+        for chain in self.find_chains(graph, sources, sinks, max_chains):
+            hops: list[dict[str, Any]] = []
+            for edge, node in chain:
+                parts = {part: Timing() for part in _PARTS}
+                parts["execution"] = execution(node)
+                if edge is not None and edge.via:
+                    parts["communication"] = self.__communication(edge, node, measurements["communication"])
+                    period = graph.periods.get(node, 0.0)
+                    parts["sampling"] = Timing(period / 2, period)
+                    if node.task:
+                        parts["lateness"] = measurements["lateness"].get(
+                            (node.executable, node.module, node.task), Timing(measured=False)
+                        )
+                total = sum(parts.values(), Timing())
+                dominant_part = max(parts.items(), key=lambda item: item[1].worst)[0]
+                hops.append(
+                    {
+                        "node": str(node),
+                        "executable": node.executable,
+                        "via": edge.via if edge is not None else "",
+                        **{part: vars(timing) for part, timing in parts.items()},
+                        "typical": total.typical,
+                        "worst": total.worst,
+                        "measured": total.measured,
+                        "dominant_part": dominant_part,
+                    }
+                )
+            dominant = max(range(len(hops)), key=lambda index: hops[index]["worst"])
+            chains.append(
+                {
+                    "chain": [hop["node"] for hop in hops],
+                    "hops": hops,
+                    "typical": sum(hop["typical"] for hop in hops),
+                    "worst": sum(hop["worst"] for hop in hops),
+                    "measured": all(hop["measured"] for hop in hops),
+                    "dominant_hop": dominant,
+                }
+            )
+        chains.sort(key=lambda chain: chain["worst"], reverse=True)
+        return chains
+
+    @staticmethod
+    def read_metrics(
+        model: vafmodel.MainModel, metrics_files: Optional[dict[str, Path]] = None
+    ) -> dict[str, list[tuple[str, dict[str, str], float]]]:
+        """Reads the metrics export of each executable
+        Args:
+            model: The model
+            metrics_files: Metrics file per executable, by default the file of its metrics export
+        Returns:
+            The parsed metrics per executable, executables without a metrics file are missing
+        """
+        metrics: dict[str, list[tuple[str, dict[str, str], float]]] = {}
+        for executable in model.Executables:
+            path = (metrics_files or {}).get(executable.Name)
+            if path is None and executable.MetricsExport is not None:
+                path = Path(executable.MetricsExport.FilePath)
+            if path is not None and path.exists():
+                metrics[executable.Name] = LoadCmd.parse_metrics(path.read_text(encoding="utf-8"))
+        return metrics
+
+    @staticmethod
+    def format_report(chains: list[dict[str, Any]]) -> list[str]:
+        """Formats the latencies of the chains as text
+        Args:
+            chains: The chains returned by analyze
+        Returns:
+            The lines of the report
+        """
+
+        def microseconds(seconds: float) -> str:
+            return f"{seconds * 1e6:.1f}"
+
+        lines: list[str] = []
+        for chain in chains:
+            lines.append(
+                f"{' -> '.join(chain['chain'])}: {microseconds(chain['typical'])} us typical,"
+                f" {microseconds(chain['worst'])} us worst case{'' if chain['measured'] else ' (partly unmeasured)'}"
+            )
+            for index, hop in enumerate(chain["hops"]):
+                via = f" via {hop['via']}" if hop["via"] else ""
+                parts = ", ".join(
+                    f"{part} {microseconds(hop[part]['worst']) if hop[part]['measured'] else '-'}"
+                    for part in _PARTS
+                    if hop[part]["worst"] > 0 or not hop[part]["measured"]
+                )
+                marker = " <- dominant, mostly " + hop["dominant_part"] if index == chain["dominant_hop"] else ""
+                lines.append(f"  {hop['node']}{via}: {microseconds(hop['worst'])} us ({parts or '-'}){marker}")
+        if not chains:
+            lines.append("No chains found, select their ends with --source and --sink")
+        return lines
@@ -0,0 +1,391 @@
+# Copyright (c) 2024-2026 by Vector Informatik GmbH. All rights reserved.
+# SPDX-License-Identifier: Apache-2.0
+
+"""Implements the functionality of load-related commands."""
+
+import math
+import os
+import re
+import signal
+import subprocess
+import time
+from dataclasses import dataclass, field
+from datetime import timedelta
+from pathlib import Path
+from typing import Any
+
+from vaf import vafmodel, vafpy
+from vaf.core.common.utils import ProjectType, to_snake_case
+from vaf.vafgeneration import vaf_generate_project, vaf_load
+from vaf.vafpy.model_runtime import ModelRuntime
+
+LOAD_NAMESPACE = "load"
+
+_METRIC_LINE = re.compile(r"^(?P<name>[a-zA-Z_:][a-zA-Z0-9_:]*)(\{(?P<labels>.*)\})? (?P<value>\S+)$")
+_METRIC_LABEL = re.compile(r'(?P<key>[a-zA-Z_][a-zA-Z0-9_]*)="(?P<value>(?:[^"\\]|\\.)*)"')
+_PERCENTILES = (0.5, 0.9, 0.99)
+
+
+@dataclass
+class LoadParameters:  # pylint: disable=too-many-instance-attributes
+    """Parameters of a synthetic load project
+
+    Attributes:
+        modules: Number of application modules
+        tasks: Number of periodic tasks per module
+        data_elements: Number of data elements provided by each module
+        fan_out: Number of modules that consume the data elements of each module
+        periods: Periods of the tasks, assigned to the modules in turn
+        payload_sizes: Sizes of the data elements in bytes, assigned to the modules in turn, at least eight
+        communication: Communication between the modules, either internal, silkit or shm
+        executables: Number of executables the modules are distributed to in turn
+        executor_period: Period of the executors, defaults to the greatest common divisor of the periods
+        metrics_dir: Directory the executables export their metrics to
+    """
+
+    modules: int = 10
+    tasks: int = 1
+    data_elements: int = 1
+    fan_out: int = 1
+    periods: list[timedelta] = field(default_factory=lambda: [timedelta(milliseconds=10)])
+    payload_sizes: list[int] = field(default_factory=lambda: [64])
+    communication: str = "internal"
+    executables: int = 1
+    executor_period: timedelta | None = None
+    metrics_dir: str = "/dev/shm"
+
+    def validate(self) -> None:
+        """Checks that the parameters describe a valid project
+        Raises:
+            ValueError: If a parameter is out of range
+        """
+        if self.modules < 1 or self.tasks < 1 or self.data_elements < 1:
+            raise ValueError("The number of modules, tasks and data elements must be at least one")
+        if not 0 <= self.fan_out < self.modules:
+            raise ValueError("The fan-out must be below the number of modules")
+        if not self.periods or any(period <= timedelta(0) for period in self.periods):
+            raise ValueError("The periods must be positive")
+        if not self.payload_sizes or any(size < 8 for size in self.payload_sizes):
+            raise ValueError("The payload sizes must be at least eight bytes to carry the publish time")
+        if self.communication not in ("internal", "silkit", "shm"):
+            raise ValueError(f"Unknown communication {self.communication}")
+        if not 1 <= self.executables <= self.modules:
+            raise ValueError("The number of executables must be between one and the number of modules")
+        if self.executables > 1 and self.communication == "internal":
+            raise ValueError("Modules of several executables can only communicate via silkit or shm")
+        if self.executor_period is not None and any(
+            period % self.executor_period != timedelta(0) for period in self.periods
+        ):
+            raise ValueError("The periods must be multiples of the executor period")
+
+
+class LoadCmd:
+    """Class implementing the load-related commands"""
+
+    @staticmethod
+    def __executor_period(parameters: LoadParameters) -> timedelta:
+        if parameters.executor_period is not None:
+            return parameters.executor_period
+        microseconds = [period // timedelta(microseconds=1) for period in parameters.periods]
+        return timedelta(microseconds=math.gcd(*microseconds))
+
+    def build_model(self, parameters: LoadParameters) -> vafmodel.MainModel:
+        """Builds the model of a synthetic load project in the model runtime
+        Module i provides one interface with the data elements and consumes the interfaces of the fan-out modules
+        before it. Its tasks publish the data elements in turn.
+        Args:
+            parameters: Parameters of the project
+        Returns:
+            The main model of the model runtime
+        """
+        parameters.validate()
+        ModelRuntime().reset()
+
+        payloads: dict[int, vafpy.Array] = {}
+        interfaces: dict[int, vafpy.ModuleInterface] = {}
+        for size in parameters.payload_sizes:
+            if size not in payloads:
+                payloads[size] = vafpy.Array(f"Payload{size}", LOAD_NAMESPACE, vafpy.BaseTypes.UINT8_T, size)
+                interfaces[size] = vafpy.ModuleInterface(f"LoadInterface{size}", LOAD_NAMESPACE)
+                for index in range(parameters.data_elements):
+                    interfaces[size].add_data_element(f"sample{index}", payloads[size])
+
+        executor_period = self.__executor_period(parameters)
+        executables = [
+            vafpy.Executable(f"LoadExecutable{index}", executor_period) for index in range(parameters.executables)
+        ]
+        for executable in executables:
+            executable.export_metrics(f"{parameters.metrics_dir}/{to_snake_case(executable.Name)}.prom")
+
+        # The platform modules are named after the instances, so these are unique in the whole model
+        def output(index: int) -> str:
+            return f"Output{index}"
+
+        def input_from(provider: int, consumer: int) -> str:
+            return f"Input{provider}To{consumer}"
+
+        def providers(index: int) -> list[int]:
+            return [(index - distance) % parameters.modules for distance in range(1, parameters.fan_out + 1)]
+
+        def interface(index: int) -> vafpy.ModuleInterface:
+            return interfaces[parameters.payload_sizes[index % len(parameters.payload_sizes)]]
+
+        modules: list[vafpy.ApplicationModule] = []
+        for index in range(parameters.modules):
+            module = vafpy.ApplicationModule(f"LoadModule{index}", LOAD_NAMESPACE)
+            module.ImplementationProperties = vafmodel.ImplementationProperty(
+                InstallationPath=to_snake_case(module.Name)
+            )
+            module.add_provided_interface(output(index), interface(index))
+            for provider in providers(index):
+                module.add_consumed_interface(input_from(provider, index), interface(provider))
+            period = parameters.periods[index % len(parameters.periods)]
+            slots = max(1, period // executor_period)
+            task_mapping: list[tuple[str, timedelta, int]] = []
+            for task_index in range(parameters.tasks):
+                task = vafpy.Task(f"Task{task_index}", period)
+                module.add_task(task)
+                # Spread the tasks over the time slots of their period
+                task_mapping.append((task.Name, period, (index * parameters.tasks + task_index) % slots))
+            executables[index % parameters.executables].add_application_module(module, task_mapping)
+            modules.append(module)
+
+        for index, module in enumerate(modules):
+            executable = executables[index % parameters.executables]
+            if parameters.communication == "silkit":
+                executable.connect_provided_interface_to_silkit(module, output(index), module.Name)
+            elif parameters.communication == "shm":
+                executable.connect_provided_interface_to_shm(module, output(index), to_snake_case(module.Name))
+            for provider in providers(index):
+                if parameters.communication == "silkit":
+                    executable.connect_consumed_interface_to_silkit(
+                        module, input_from(provider, index), modules[provider].Name
+                    )
+                elif parameters.communication == "shm":
+                    executable.connect_consumed_interface_to_shm(
+                        module, input_from(provider, index), to_snake_case(modules[provider].Name)
+                    )
+                else:
+                    executable.connect_interfaces(
+                        modules[provider], output(provider), module, input_from(provider, index)
+                    )
+
+        return ModelRuntime().main_model
+
+    def generate(self, project_dir: Path, parameters: LoadParameters, verbose_mode: bool = False) -> None:
+        """Generates a synthetic load project into an integration project
+        The model is written to model/vaf/model.json and replaces the one of the Configuration as Code. The
+        application modules are generated completely into src/application_modules.
+        Args:
+            project_dir: Root directory of the integration project
+            parameters: Parameters of the project
+            verbose_mode: Flag to enable verbose mode
+        """
+        self.build_model(parameters)
+        model_file = project_dir / "model/vaf/model.json"
+        model_file.parent.mkdir(parents=True, exist_ok=True)
+        vafpy.save_main_model(model_file, project_type=ProjectType.INTEGRATION)
+
+        vaf_generate_project.generate_integration_project(
+            str(model_file), str(project_dir), "std", execute_merge=False, verbose_mode=verbose_mode
+        )
+        vaf_load.generate(ModelRuntime().main_model, project_dir, verbose_mode)
+
+    @staticmethod
+    def parse_metrics(text: str) -> list[tuple[str, dict[str, str], float]]:
+        """Parses metrics in the Prometheus text format
+        Args:
+            text: The metrics
+        Returns:
+            The name, labels and value of each sample
+        """
+        samples: list[tuple[str, dict[str, str], float]] = []
+        for line in text.splitlines():
+            match = _METRIC_LINE.match(line)
+            if line.startswith("#") or match is None:
+                continue
+            labels = {
+                label["key"]: label["value"].replace('\\"', '"').replace("\\\\", "\\")
+                for label in _METRIC_LABEL.finditer(match["labels"] or "")
+            }
+            samples.append((match["name"], labels, float(match["value"])))
+        return samples
+
+    @staticmethod
+    def summarize_histograms(
+        samples: list[tuple[str, dict[str, str], float]], name: str, key_labels: tuple[str, ...]
+    ) -> list[dict[str, Any]]:
+        """Summarizes the histograms of one name by percentiles and their cumulative distribution
+        The percentiles are the upper bounds of the buckets they fall into.
+        Args:
+            samples: Parsed metrics
+            name: Name of the histograms
+            key_labels: Labels that tell the histograms apart
+        Returns:
+            Per histogram its labels, count, percentiles and the fraction of values up to each bucket bound
+        """
+        buckets: dict[tuple[str, ...], list[tuple[float, float]]] = {}
+        for sample_name, labels, value in samples:
+            if sample_name == f"{name}_bucket":
+                buckets.setdefault(tuple(labels.get(key, "") for key in key_labels), []).append(
+                    (float(labels["le"]), value)
+                )
+        summaries: list[dict[str, Any]] = []
+        for key, cumulative in sorted(buckets.items()):
+            cumulative.sort()
+            count = cumulative[-1][1]
+            summary: dict[str, Any] = dict(zip(key_labels, key))
+            summary["count"] = int(count)
+            for percentile in _PERCENTILES:
+                summary[f"p{percentile * 100:g}"] = next(
+                    (bound for bound, value in cumulative if count > 0 and value >= percentile * count), None
+                )
+            summary["curve"] = [(bound, value / count if count > 0 else 0.0) for bound, value in cumulative]
+            summaries.append(summary)
+        return summaries
+
+    @staticmethod
+    def __cpu_seconds(pid: int) -> float:
+        # utime and stime follow the process name, which may contain spaces
+        fields = Path(f"/proc/{pid}/stat").read_text(encoding="utf-8").rsplit(")", 1)[1].split()
+        return (int(fields[11]) + int(fields[12])) / os.sysconf("SC_CLK_TCK")
+
+    @staticmethod
+    def __max_rss_kib(pid: int) -> int:
+        for line in Path(f"/proc/{pid}/status").read_text(encoding="utf-8").splitlines():
+            if line.startswith("VmHWM:"):
+                return int(line.split()[1])
+        return 0
+
+    # pylint: disable-next=too-many-locals
+    def run(self, model_file: Path, build_dir: Path, duration: float, sample_interval: float = 1.0) -> dict[str, Any]:
+        """Runs the executables of a project under load and measures them
+        The executables are started with sample tracing enabled and stopped with SIGTERM after the duration. Their CPU
+        use is sampled from /proc, the executor statistics, the task jitter and the sample latencies are read from
+        the metrics they export at the end.
+        Args:
+            model_file: Model of the project, the executables need a metrics export
+            build_dir: Build directory of the project
+            duration: Time to run the executables in seconds
+            sample_interval: Time between two samples of the CPU use in seconds
+        Returns:
+            The measurements of the executables, the task jitter and the sample latencies
+        Raises:
+            ValueError: If an executable has no metrics export
+            RuntimeError: If an executable stops before the end of the run
+        """
+        model = vafmodel.load_json(model_file)
+        for executable in model.Executables:
+            if executable.MetricsExport is None:
+                raise ValueError(f"Executable {executable.Name} has no metrics export")
+            Path(executable.MetricsExport.FilePath).unlink(missing_ok=True)
+
+        env = dict(os.environ, VAF_SAMPLE_TRACE="1")
+        processes: list[subprocess.Popen[bytes]] = []
+        for executable in model.Executables:
+            bin_dir = build_dir / "bin" / executable.Name / "bin"
+            processes.append(
+                subprocess.Popen(  # pylint: disable=consider-using-with
+                    [str(bin_dir / executable.Name)], cwd=bin_dir, env=env, stdout=subprocess.DEVNULL
+                )
+            )
+        start = time.monotonic()
+        cpu_curves: list[list[float]] = [[] for _ in processes]
+        max_rss: list[int] = [0 for _ in processes]
+        try:
+            last_cpu = [self.__cpu_seconds(process.pid) for process in processes]
+            last_time = start
+            while time.monotonic() - start < duration:
+                time.sleep(min(sample_interval, max(0.0, duration - (time.monotonic() - start))))
+                now = time.monotonic()
+                for index, process in enumerate(processes):
+                    if process.poll() is not None:
+                        raise RuntimeError(
+                            f"Executable {model.Executables[index].Name} stopped with {process.returncode}"
+                        )
+                    cpu = self.__cpu_seconds(process.pid)
+                    cpu_curves[index].append(100.0 * (cpu - last_cpu[index]) / (now - last_time))
+                    max_rss[index] = self.__max_rss_kib(process.pid)
+                    last_cpu[index] = cpu
+                last_time = now
+        finally:
+            for process in processes:
+                if process.poll() is None:
+                    process.send_signal(signal.SIGTERM)
+            for process in processes:
+                try:
+                    process.wait(timeout=10)
+                except subprocess.TimeoutExpired:
+                    process.kill()
+                    process.wait()
+
+        report: dict[str, Any] = {
+            "duration": duration,
+            "executables": [],
+            "task_jitter": [],
+            "sample_latency": [],
+            "communication_latency": [],
+        }
+        for index, executable in enumerate(model.Executables):
+            assert executable.MetricsExport is not None
+            metrics_file = Path(executable.MetricsExport.FilePath)
+            samples = self.parse_metrics(metrics_file.read_text(encoding="utf-8")) if metrics_file.exists() else []
+            values = {name: value for name, labels, value in samples if not labels}
+            curve = cpu_curves[index]
+            report["executables"].append(
+                {
+                    "name": executable.Name,
+                    "cpu_percent": sum(curve) / len(curve) if curve else 0.0,
+                    "cpu_percent_max": max(curve, default=0.0),
+                    "cpu_curve": curve,
+                    "max_rss_kib": max_rss[index],
+                    "time_slots": int(values.get("vaf_executor_time_slots_total", 0)),
+                    "overruns": int(values.get("vaf_executor_overruns_total", 0)),
+                    "skipped_time_slots": int(values.get("vaf_executor_skipped_time_slots_total", 0)),
+                    "max_time_slot_duration": values.get("vaf_executor_max_time_slot_duration_seconds", 0.0),
+                }
+            )
+            for name, key, key_labels in (
+                ("vaf_load_task_jitter_seconds", "task_jitter", ("module", "task")),
+                ("vaf_load_sample_latency_seconds", "sample_latency", ("module", "input")),
+                ("vaf_sample_latency_seconds", "communication_latency", ("path",)),
+            ):
+                for summary in self.summarize_histograms(samples, name, key_labels):
+                    report[key].append({"executable": executable.Name, **summary})
+        return report
+
+    @staticmethod
+    def format_report(report: dict[str, Any]) -> list[str]:
+        """Formats the summary of a run as text
+        Args:
+            report: The measurements returned by run
+        Returns:
+            The lines of the summary
+        """
+
+        def microseconds(seconds: float | None) -> str:
+            if seconds is None:
+                return "-"
+            return "+Inf" if math.isinf(seconds) else f"{seconds * 1e6:g}"
+
+        lines: list[str] = [f"Run of {report['duration']:g} s"]
+        for executable in report["executables"]:
+            lines.append(
+                f"{executable['name']}: CPU {executable['cpu_percent']:.1f} %"
+                f" (max {executable['cpu_percent_max']:.1f} %),"
+                f" max RSS {executable['max_rss_kib']} KiB, {executable['time_slots']} time slots,"
+                f" {executable['overruns']} overruns, {executable['skipped_time_slots']} skipped,"
+                f" max time slot {microseconds(executable['max_time_slot_duration'])} us"
+            )
+        for key, title, labels in (
+            ("task_jitter", "Task jitter", ("module", "task")),
+            ("sample_latency", "Sample latency from publishing to the handler", ("module", "input")),
+            ("communication_latency", "Latency of the executable-internal communication", ("path",)),
+        ):
+            if report[key]:
+                lines.append(f"{title} in us (p50 / p90 / p99), upper bounds of the histogram buckets:")
+            for summary in report[key]:
+                name = ".".join(summary[label] for label in labels)
+                percentiles = " / ".join(microseconds(summary[f"p{p * 100:g}"]) for p in _PERCENTILES)
+                lines.append(f"  {summary['executable']} {name}: {percentiles} ({summary['count']} values)")
+        return lines
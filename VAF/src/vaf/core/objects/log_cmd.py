@@ -0,0 +1,103 @@
+# Copyright (c) 2024-2026 by Vector Informatik GmbH. All rights reserved.
+# SPDX-License-Identifier: Apache-2.0
+
+"""Implements the functionality of log-related commands."""
+
+import struct
+from pathlib import Path
+
+# Format of the binary log output of vaf::Logger, see vaf::internal::SetBinaryLogOutput
+BINARY_LOG_MAGIC = b"VAFLOG1\0"
+_ENTRY_HEADER = struct.Struct("<IBBH")
+_KIND_TEXT = 0
+_KIND_INT64 = 1
+_KIND_UINT64 = 2
+_KIND_DOUBLE = 3
+_KIND_BOOL = 4
+_KIND_TEXT_DEFINITION = 5
+_KIND_TEXT_REFERENCE = 6
+_KIND_DROPPED = 7
+# Starts line value of a line start after a line cut by a full ring buffer, the cut line is dropped
+_STARTS_LINE_DROPPING_CUT_LINE = 2
+
+
+class LogCmd:  # pylint: disable=too-few-public-methods
+    """Class implementing the log-related commands"""
+
+    @staticmethod
+    def __format_value(kind: int, payload: bytes, texts: dict[int, str]) -> str:
+        """Formats the payload of an entry like the log writer does for std::cout
+        Args:
+            kind: Kind of the entry
+            payload: Payload of the entry
+            texts: Texts defined so far by their id, extended by text definitions
+        Returns:
+            The formatted text
+        Raises:
+            ValueError: If the kind is unknown or a text reference is not defined
+        """
+        if kind == _KIND_TEXT:
+            return payload.decode("utf-8", errors="replace")
+        if kind == _KIND_INT64:
+            return str(struct.unpack("<q", payload)[0])
+        if kind == _KIND_UINT64:
+            return str(struct.unpack("<Q", payload)[0])
+        if kind == _KIND_DOUBLE:
+            return f"{struct.unpack('<d', payload)[0]:g}"
+        if kind == _KIND_BOOL:
+            return "true" if payload[0] != 0 else "false"
+        if kind == _KIND_TEXT_DEFINITION:
+            text_id = struct.unpack_from("<I", payload)[0]
+            texts[text_id] = payload[4:].decode("utf-8", errors="replace")
+            return texts[text_id]
+        if kind == _KIND_TEXT_REFERENCE:
+            text_id = struct.unpack("<I", payload)[0]
+            if text_id not in texts:
+                raise ValueError(f"Log text {text_id} is used before its definition")
+            return texts[text_id]
+        raise ValueError(f"Unknown log entry kind {kind}")
+
+    def decode(self, log_file: Path) -> list[str]:
+        """Decodes a binary log file into the lines that would have been written to std::cout
+        The lines of each thread are assembled separately, so lines of different threads are never mixed.
+        Args:
+            log_file: Path to the binary log file
+        Returns:
+            The log lines in the order they were started
+        Raises:
+            ValueError: If the file is no binary log file of vaf::Logger
+        """
+        data = log_file.read_bytes()
+        if not data.startswith(BINARY_LOG_MAGIC):
+            raise ValueError(f"{log_file} is no binary log file")
+
+        lines: list[list[str] | None] = []
+        open_lines: dict[int, int] = {}
+        # Lines ended by dropped records, the next line start of the thread may drop them as they were cut
+        dropping_lines: dict[int, int] = {}
+        texts: dict[int, str] = {}
+        offset = len(BINARY_LOG_MAGIC)
+        while offset + _ENTRY_HEADER.size <= len(data):
+            thread, kind, starts_line, size = _ENTRY_HEADER.unpack_from(data, offset)
+            offset += _ENTRY_HEADER.size
+            payload = data[offset : offset + size]
+            offset += size
+            if len(payload) < size:
+                # Cut off by the end of the process
+                break
+            if kind == _KIND_DROPPED:
+                lines.append([f"[vaf: {struct.unpack('<Q', payload)[0]} log records dropped]"])
+                if thread in open_lines:
+                    dropping_lines[thread] = open_lines.pop(thread)
+                continue
+            text = self.__format_value(kind, payload, texts)
+            cut_line = dropping_lines.pop(thread, open_lines.get(thread)) if starts_line else None
+            if starts_line == _STARTS_LINE_DROPPING_CUT_LINE and cut_line is not None:
+                lines[cut_line] = None
+            if starts_line or thread not in open_lines:
+                open_lines[thread] = len(lines)
+                lines.append([])
+            line = lines[open_lines[thread]]
+            assert line is not None
+            line.append(text)
+        return ["".join(line) for line in lines if line is not None]
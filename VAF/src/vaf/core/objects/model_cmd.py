@@ -12,7 +12,7 @@ import pkgutil
 import re
 import sys
 from pathlib import Path
-from typing import Any
+from typing import Any, Optional
 
 from vaf.core.common.constants import VAF_CFG_FILE
 from vaf.core.common.exceptions import VafProjectGenerationError
@@ -68,10 +68,11 @@ class ModelCmd:  # pylint: disable=too-few-public-methods
         sys.path.pop(0)
         return list(modules)
 
-    def import_vss(self, input_file: str, model_dir: str) -> None:
+    def import_vss(self, input_file: str, model_dir: str, signal_filter: Optional[list[str]] = None) -> None:
         """
         :param input_file: JSON file of the input model.
         :param model_dir: Output directory to generate the resulting artifacts.
+        :param signal_filter: Paths or glob patterns of the signals to import, all signals if not set.
         """
         if model_dir is None or model_dir == "":
             # check if it's there is any vaf_config
@@ -79,7 +80,7 @@ class ModelCmd:  # pylint: disable=too-few-public-methods
                 model_dir = Path(self._vaf_config["vaf-artifacts"]["vaf-init-model"]).as_posix()
 
         if model_dir is not None:
-            vss_import.run_import(model_dir, input_file)
+            vss_import.run_import(model_dir, input_file, signal_filter)
             # Generate the initial model Python helper
             generate_cac_support(
                 Path(model_dir), "vss-derived-model.json", "vss", Path(model_dir), project_type=ProjectType.INTERFACE
@@ -11,6 +11,7 @@ class VafRecipe(ConanFile):
 
     def requirements(self):
         self.requires("gtest/1.13.0")
+        self.requires("benchmark/1.8.3")
 
         for dependency in load(self, Path(__file__).resolve().parent / "src-gen" / "conan_deps.list").splitlines():
             self.requires(dependency)
@@ -12,6 +12,9 @@ import warnings
 # External imports
 import click
 
+from vaf.core.cli_subcommands.analyze_subcmd import analyze_chains
+from vaf.core.cli_subcommands.load_subcmd import load_generate, load_run
+from vaf.core.cli_subcommands.log_subcmd import log_decode
 from vaf.core.cli_subcommands.make_subcmd import (
     make_build,
     make_clean,
@@ -124,6 +127,38 @@ make.add_command(name="install", cmd=make_install)
 make.add_command(name="clean", cmd=make_clean)
 
 
+# Command 'load'
+@cli.group()
+def load() -> None:
+    """Synthetic load projects for scaling tests."""
+
+
+# vaf load generate #
+load.add_command(name="generate", cmd=load_generate)
+# vaf load run #
+load.add_command(name="run", cmd=load_run)
+
+
+# Command 'analyze'
+@cli.group()
+def analyze() -> None:
+    """Analysis of the timing of integration projects."""
+
+
+# vaf analyze chains #
+analyze.add_command(name="chains", cmd=analyze_chains)
+
+
+# Command 'log'
+@cli.group()
+def log() -> None:
+    """Log-related commands."""
+
+
+# vaf log decode #
+log.add_command(name="decode", cmd=log_decode)
+
+
 # Command 'workspace'
 @cli.group()
 def workspace() -> None:
@@ -18,6 +18,8 @@ __all__ = [
     "generate_project",
     "generate_persistency",
     "generate_protobuf_serdes",
+    "generate_recording",
+    "generate_shm",
     "generate_silkit",
     "generate_std_vaf_data_types",
     "generate_core_library",
@@ -38,5 +40,7 @@ from .vaf_generate_project import generate_integration_project as generate_proje
 from .vaf_interface import generate_module_interfaces as generate_interface
 from .vaf_persistency import generate as generate_persistency
 from .vaf_protobuf_serdes import generate as generate_protobuf_serdes
+from .vaf_recording import generate as generate_recording
+from .vaf_shm import generate as generate_shm
 from .vaf_silkit import generate as generate_silkit
 from .vaf_std_data_types import generate as generate_std_vaf_data_types
@@ -3,9 +3,12 @@
 
 """Common generator functionality."""
 
-import filecmp
+import contextlib
+import multiprocessing
+import os
+from concurrent.futures import Future, ProcessPoolExecutor
 from pathlib import Path
-from typing import Any
+from typing import Any, Iterable, Iterator, NamedTuple, Optional
 
 from jinja2 import Environment, PackageLoader, select_autoescape
 
@@ -87,6 +90,21 @@ def time_str_to_milliseconds(s: str) -> int:
     raise ValueError("Invalid time string: " + s)
 
 
+def time_str_to_chrono(s: str) -> str:
+    """Converts a time string to a std::chrono duration. Example "10ms" -> std::chrono::milliseconds{ 10 }
+
+    Args:
+        s (str): The time string.
+
+    Returns:
+        str: The duration in milliseconds, or in microseconds if it is no multiple of a millisecond
+    """
+    microseconds = time_str_to_nanoseconds(s) // 1_000
+    if microseconds % 1_000 == 0:
+        return f"std::chrono::milliseconds{{ {microseconds // 1_000} }}"
+    return f"std::chrono::microseconds{{ {microseconds} }}"
+
+
 def time_str_to_nanoseconds(s: str) -> int:
     """Converts a time string to nanoseconds. Example "10ns" -> 10
 
@@ -110,6 +128,77 @@ def time_str_to_nanoseconds(s: str) -> int:
     raise ValueError("Invalid time string: " + s)
 
 
+# Files written or kept unchanged by the generators since the last call of start_generation, in generation order
+_generated_files: list[Path] = []
+
+
+def start_generation() -> None:
+    """Starts a generation run, forgets the files generated before"""
+    _generated_files.clear()
+
+
+def get_generated_files() -> list[Path]:
+    """Returns the files generated since the last call of start_generation
+
+    Returns:
+        list[Path]: The resolved paths of the files in generation order, a file is listed each time it is generated
+    """
+    return list(_generated_files)
+
+
+def mark_generated(paths: Iterable[Path]) -> None:
+    """Marks files as generated in this run without writing them, e.g. the unchanged files of a skipped generator
+
+    Args:
+        paths (Iterable[Path]): The files
+    """
+    _generated_files.extend(path.resolve() for path in paths)
+
+
+def write_generated_file(output_path: Path, content: str, verbose_mode: bool = False) -> bool:
+    """Writes a generated file unless it already has the content.
+    Unchanged files keep their modification time, so the build does not compile their dependents again.
+
+    Args:
+        output_path (Path): The file
+        content (str): The generated content
+        verbose_mode (bool): flag to enable verbose_mode mode
+
+    Returns:
+        bool: True if the file was written
+    """
+    _generated_files.append(output_path.resolve())
+    if output_path.is_file() and output_path.read_text(encoding="utf-8") == content:
+        return False
+    Path.mkdir(output_path.parent, parents=True, exist_ok=True)
+    with open(output_path, "w", encoding="utf-8") as f:
+        f.write(content)
+    if verbose_mode:
+        print(f"VAF: Generating {output_path}")
+    return True
+
+
+def remove_stale_files(directory: Path, verbose_mode: bool = False) -> None:
+    """Removes the files of a directory that were not generated since the last call of start_generation, and the
+    directories left empty
+
+    Args:
+        directory (Path): The directory, e.g. src-gen
+        verbose_mode (bool): flag to enable verbose_mode mode
+    """
+    if not directory.is_dir():
+        return
+    generated = set(_generated_files)
+    for path in sorted(directory.rglob("*"), key=lambda p: len(p.parts), reverse=True):
+        if path.is_dir() and not path.is_symlink():
+            if not any(path.iterdir()):
+                path.rmdir()
+        elif path.resolve() not in generated:
+            path.unlink()
+            if verbose_mode:
+                print(f"VAF: Removing {path}")
+
+
 class FileHelper:
     """Helper class for files to be generated"""
 
@@ -375,17 +464,144 @@ def split_full_type(full_type: str) -> tuple[str, str]:
     return full_type[separator + 2 :], full_type[0:separator]
 
 
+def _create_environment() -> Environment:
+    return Environment(
+        loader=PackageLoader("vaf.vafgeneration"),
+        autoescape=select_autoescape(),
+        trim_blocks=True,
+        lstrip_blocks=True,
+        keep_trailing_newline=True,
+    )
+
+
+def _render(env: Environment, template_path: str, file: FileHelper, postfix: str, kwargs: dict[str, Any]) -> str:
+    return env.get_template(template_path).render(
+        file_helper=file,
+        file_postfix=postfix,
+        to_camel_case=to_camel_case,
+        to_snake_case=to_snake_case,
+        data_type_to_str=data_type_to_str,
+        implicit_data_type_to_str=implicit_data_type_to_str,
+        add_namespace_to_name=add_namespace_to_name,
+        time_str_to_milliseconds=time_str_to_milliseconds,
+        time_str_to_chrono=time_str_to_chrono,
+        operation_get_return_type=operation_get_return_type,
+        **kwargs,
+    )
+
+
+def _write_rendered(output_path: Path, content: str, check_to_overwrite: bool, verbose_mode: bool) -> None:
+    if check_to_overwrite and output_path.exists() and Path.stat(output_path).st_size > 0:
+        # The existing file may have been changed by the user, so a different content goes next to it
+        _generated_files.append(output_path.resolve())
+        new_output_path = output_path.parent / (output_path.name + ".new~")
+        if output_path.read_text(encoding="utf-8") != content:
+            write_generated_file(new_output_path, content, verbose_mode)
+            if verbose_mode:
+                print(f"File {output_path} already exists, file is generated to {new_output_path}")
+        else:
+            new_output_path.unlink(missing_ok=True)
+        return
+
+    write_generated_file(output_path, content, verbose_mode)
+
+
+class _RenderJob(NamedTuple):
+    template_path: str
+    file: FileHelper
+    postfix: str
+    kwargs: dict[str, Any]
+    output_path: Path
+    check_to_overwrite: bool
+
+
+# Files to render within parallel_rendering, None if files are rendered right away
+_render_jobs: Optional[list[_RenderJob]] = None
+# Files the forked worker processes render, they inherit the files and their arguments, so only the rendered
+# contents are sent between the processes
+_forked_render_jobs: list[_RenderJob] = []
+# Environment of the worker process, created on its first job, so each worker compiles a template once
+_worker_env: Optional[Environment] = None
+# Fewer files render faster in the generating process than the worker processes start
+_MIN_PARALLEL_RENDER_JOBS = 16
+
+
+def _render_in_worker(start: int, stop: int) -> list[str]:
+    global _worker_env  # pylint: disable=global-statement
+    if _worker_env is None:
+        _worker_env = _create_environment()
+    return [
+        _render(_worker_env, job.template_path, job.file, job.postfix, job.kwargs)
+        for job in _forked_render_jobs[start:stop]
+    ]
+
+
+def get_rendering_workers() -> int:
+    """Returns the number of processes rendering the generated files, the environment variable VAF_GENERATION_JOBS
+    overrides the number of cores. Rendering needs processes started with fork, which inherit the imported model.
+
+    Returns:
+        int: The number of processes, 1 renders in the generating process
+    """
+    if "fork" not in multiprocessing.get_all_start_methods():
+        return 1
+    jobs = os.environ.get("VAF_GENERATION_JOBS", "")
+    return max(int(jobs), 1) if jobs.isdigit() else os.cpu_count() or 1
+
+
+@contextlib.contextmanager
+def parallel_rendering() -> Iterator[None]:
+    """Renders the files generated within the context by worker processes, one per core.
+    The files are rendered when the context ends and are written in generation order, as without the context. The
+    render arguments must not change until then.
+
+    Yields:
+        None: The context
+    """
+    global _render_jobs, _forked_render_jobs  # pylint: disable=global-statement
+    workers = get_rendering_workers()
+    if _render_jobs is not None or workers == 1:
+        yield
+        return
+    _render_jobs = []
+    try:
+        yield
+        jobs = _render_jobs
+    finally:
+        _render_jobs = None
+
+    contents: list[Optional[str]] = [None] * len(jobs)
+    if len(jobs) >= _MIN_PARALLEL_RENDER_JOBS:
+        # Several chunks per worker balance templates of different cost
+        chunk_size = -(-len(jobs) // (workers * 4))
+        _forked_render_jobs = jobs
+        try:
+            with ProcessPoolExecutor(max_workers=workers, mp_context=multiprocessing.get_context("fork")) as executor:
+                futures: list[tuple[int, Future[list[str]]]] = [
+                    (start, executor.submit(_render_in_worker, start, start + chunk_size))
+                    for start in range(0, len(jobs), chunk_size)
+                ]
+                for start, future in futures:
+                    try:
+                        contents[start : start + chunk_size] = future.result()
+                    except Exception:  # pylint: disable=broad-exception-caught
+                        # The chunk is rendered below, which raises the error again if rendering itself failed
+                        pass
+        finally:
+            _forked_render_jobs = []
+
+    env = _create_environment()
+    for job, content in zip(jobs, contents):
+        if content is None:
+            content = _render(env, job.template_path, job.file, job.postfix, job.kwargs)
+        _write_rendered(job.output_path, content, job.check_to_overwrite, job.kwargs.get("verbose_mode", False))
+
+
 class Generator:
     """Class for generating files."""
 
     def __init__(self) -> None:
-        self.env = Environment(
-            loader=PackageLoader("vaf.vafgeneration"),
-            autoescape=select_autoescape(),
-            trim_blocks=True,
-            lstrip_blocks=True,
-            keep_trailing_newline=True,
-        )
+        self.env = _create_environment()
         self.base_directory = Path.cwd()
 
     def set_base_directory(self, new_dir: Path) -> None:
@@ -405,41 +621,11 @@ class Generator:
         check_to_overwrite: bool,
         **kwargs: Any,
     ) -> None:
-        old_file_exists: bool = False
-        old_file_output_path: Path
-        if check_to_overwrite and output_path.exists() and Path.stat(output_path).st_size > 0:
-            old_file_exists = True
-            old_file_output_path = output_path
-            output_path = output_path.parent / (output_path.name + ".new~")
-
-        Path.mkdir(output_path.parent, parents=True, exist_ok=True)
-        with open(output_path, "w", encoding="utf-8") as f:
-            template = self.env.get_template(template_path)
-
-            content = template.render(
-                file_helper=file,
-                file_postfix=postfix,
-                to_camel_case=to_camel_case,
-                to_snake_case=to_snake_case,
-                data_type_to_str=data_type_to_str,
-                implicit_data_type_to_str=implicit_data_type_to_str,
-                add_namespace_to_name=add_namespace_to_name,
-                time_str_to_milliseconds=time_str_to_milliseconds,
-                operation_get_return_type=operation_get_return_type,
-                **kwargs,
-            )
-
-            f.write(content)
-
-        if kwargs.get("verbose_mode", False):
-            print(f"VAF: Generating {output_path}")
-
-        if old_file_exists:
-            if not filecmp.cmp(old_file_output_path, output_path):
-                if kwargs.get("verbose_mode", False):
-                    print(f"File {old_file_output_path} already exists, file is generated to {output_path}")
-            else:
-                output_path.unlink()
+        if _render_jobs is not None:
+            _render_jobs.append(_RenderJob(template_path, file, postfix, kwargs, output_path, check_to_overwrite))
+            return
+        content = _render(self.env, template_path, file, postfix, kwargs)
+        _write_rendered(output_path, content, check_to_overwrite, kwargs.get("verbose_mode", False))
 
     def generate_to_file(
         self,
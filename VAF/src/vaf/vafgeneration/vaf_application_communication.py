@@ -79,7 +79,7 @@ def generate(model: vafmodel.MainModel, output_dir: Path, verbose_mode: bool = F
 
     generator.set_base_directory(output_path)
     subdir_cmake = FileHelper("CMakeLists", "", True)
-    module_dir_names = list(set(module_dir_names))
+    module_dir_names = sorted(set(module_dir_names))
     generator.generate_to_file(
         subdir_cmake,
         ".txt",
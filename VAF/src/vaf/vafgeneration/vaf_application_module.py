@@ -13,6 +13,7 @@ Generates
 """
 
 import collections
+import math
 from pathlib import Path
 from typing import Any, Dict, List
 
@@ -22,7 +23,7 @@ from vaf.vafgeneration.vaf_cmake_common import data_type_definitions_exist
 from vaf.vafmodel import ApplicationModule
 from vaf.vafpy.model_runtime import ModelRuntime
 
-from .generation import FileHelper, Generator
+from .generation import FileHelper, Generator, time_str_to_chrono, time_str_to_nanoseconds
 from .vaf_generate_common import get_ancestor_file_suffix
 
 # pylint: disable=duplicate-code
@@ -33,6 +34,21 @@ user_files_dir_name = "implementation"
 test_files_dir_name = "test"
 
 
+def _get_test_executor_period(am: ApplicationModule) -> str:
+    """Gets the period of the executor that runs the tasks in the unit test, the greatest common divisor of theirs
+
+    Args:
+        am (ApplicationModule): The application module
+
+    Returns:
+        str: The period as std::chrono duration, empty if the module has no tasks
+    """
+    if len(am.Tasks) == 0:
+        return ""
+    microseconds = math.gcd(*[time_str_to_nanoseconds(t.Period) // 1_000 for t in am.Tasks])
+    return time_str_to_chrono(f"{max(microseconds, 1)}us")
+
+
 def _get_interface_type_by_instance(interfaces: list[Any], instance_name: str) -> str:
     for i in interfaces:
         if i["instance"] == instance_name:
@@ -344,6 +360,7 @@ def generate_app_unittest(
         f".cpp{get_ancestor_file_suffix(is_ancestor)}",
         "vaf_application_module/test_base_cpp.jinja",
         app_module=am,
+        executor_period=_get_test_executor_period(am),
         interfaces=interfaces,
         len=len,
         check_to_overwrite=True,
@@ -0,0 +1,113 @@
+# Copyright (c) 2024-2026 by Vector Informatik GmbH. All rights reserved.
+# SPDX-License-Identifier: Apache-2.0
+
+"""Generator for the benchmarks of the core library and the generated modules.
+Generates
+    - test-gen/benchmark/CMakeLists.txt
+    - test-gen/benchmark/src/core_benchmark.cpp
+    - test-gen/benchmark/src/communication_benchmark.cpp
+    - test-gen/benchmark/src/protobuf_benchmark.cpp
+    - test-gen/benchmark/src/persistency_benchmark.cpp
+"""
+
+from pathlib import Path
+from typing import Any
+
+from vaf import vafmodel
+from vaf.core.common.constants import PersistencyLibrary
+from vaf.core.common.utils import to_snake_case
+
+from .generation import FileHelper, Generator, get_used_persistency_libs
+
+
+def _get_communication_modules(model: vafmodel.MainModel) -> list[tuple[vafmodel.PlatformModule, FileHelper]]:
+    modules: dict[str, tuple[vafmodel.PlatformModule, FileHelper]] = {}
+    for executable in model.Executables:
+        for sm in executable.InternalCommunicationModules:
+            modules.setdefault(sm.Name, (sm, FileHelper(sm.Name, sm.Namespace)))
+    return [modules[name] for name in sorted(modules)]
+
+
+def _get_data_types(model: vafmodel.MainModel) -> list[dict[str, Any]]:
+    definitions = model.DataTypeDefinitions
+    data_types: list[dict[str, Any]] = [
+        {"namespace": data_type.Namespace, "name": data_type.Name, "is_vector": isinstance(data_type, vafmodel.Vector)}
+        for data_type in definitions.Arrays
+        + definitions.Vectors
+        + definitions.Maps
+        + definitions.Strings
+        + definitions.Enums
+        + definitions.Structs
+        + definitions.TypeRefs
+        if data_type.Namespace
+    ]
+    return sorted(data_types, key=lambda data_type: (data_type["namespace"], data_type["name"]))
+
+
+def generate(model: vafmodel.MainModel, output_dir: Path, verbose_mode: bool = False) -> None:
+    """Generate the benchmark target of an integration project
+
+    Args:
+        model (vafmodel.MainModel): The model
+        output_dir (Path): Base output directory
+        verbose_mode: flag to enable verbose_mode mode
+    """
+    generator = Generator()
+    generator.set_base_directory(output_dir / "test-gen/benchmark")
+
+    files: list[FileHelper] = [FileHelper("core_benchmark", "", True)]
+    libraries: list[str] = ["vaf_core"]
+    generator.generate_to_file(files[-1], ".cpp", "vaf_benchmark/core_benchmark_cpp.jinja", verbose_mode=verbose_mode)
+
+    modules = _get_communication_modules(model)
+    if modules:
+        files.append(FileHelper("communication_benchmark", "", True))
+        libraries += ["vaf_module_interfaces"] + [to_snake_case("vaf_" + module.Name) for module, _ in modules]
+        generator.generate_to_file(
+            files[-1],
+            ".cpp",
+            "vaf_benchmark/communication_benchmark_cpp.jinja",
+            modules=modules,
+            verbose_mode=verbose_mode,
+        )
+
+    data_types = _get_data_types(model)
+    if (model.is_silkit_used or model.is_persistency_used) and data_types:
+        files.append(FileHelper("protobuf_benchmark", "", True))
+        libraries += ["vaf_data_types", "vaf_protobuf", "vaf_protobuf_transformer"]
+        generator.generate_to_file(
+            files[-1],
+            ".cpp",
+            "vaf_benchmark/protobuf_benchmark_cpp.jinja",
+            namespaces=sorted({data_type["namespace"] for data_type in data_types}),
+            data_types=data_types,
+            verbose_mode=verbose_mode,
+        )
+
+    if model.is_persistency_used:
+        # Same wrappers as generated by the persistency generator
+        wrappers: list[tuple[FileHelper, str]] = []
+        used_libraries = get_used_persistency_libs(model) - {PersistencyLibrary.NONE} or {PersistencyLibrary.LEVELDB}
+        if PersistencyLibrary.LEVELDB in used_libraries:
+            wrappers.append((FileHelper("Persistency", "persistency"), "leveldb"))
+        if PersistencyLibrary.MMAP in used_libraries:
+            wrappers.append((FileHelper("MmapPersistency", "persistency"), "mmap"))
+        files.append(FileHelper("persistency_benchmark", "", True))
+        libraries.append("vaf_persistency")
+        generator.generate_to_file(
+            files[-1],
+            ".cpp",
+            "vaf_benchmark/persistency_benchmark_cpp.jinja",
+            wrappers=wrappers,
+            verbose_mode=verbose_mode,
+        )
+
+    generator.generate_to_file(
+        FileHelper("CMakeLists", "", True),
+        ".txt",
+        "vaf_benchmark/benchmark_cmake.jinja",
+        target_name="vaf_benchmark",
+        files=files,
+        libraries=libraries,
+        verbose_mode=verbose_mode,
+    )
@@ -88,6 +88,7 @@ def _generate_src_and_src_gen_cmake(
             ".txt",
             "common/cmake_subdirs.jinja",
             subdirs=subdirs_src_gen,
+            unity_build=True,
             verbose_mode=verbose_mode,
         )
 
@@ -110,11 +111,14 @@ def _generate_test_cmake(
     generator: Generator,
     model: vafmodel.MainModel,
     output_dir: Path,
+    generate_for_application_module: bool,
     verbose_mode: bool = False,
 ) -> None:
     subdirs_test: list[str] = []
     if model.has_module_interfaces or model.is_persistency_used:
         subdirs_test.append("mocks")
+    if not generate_for_application_module:
+        subdirs_test.append("benchmark")
 
     generator.set_base_directory(output_dir / "test-gen")
     generator.generate_to_file(
@@ -122,6 +126,7 @@ def _generate_test_cmake(
         ".txt",
         "common/cmake_subdirs.jinja",
         subdirs=subdirs_test,
+        unity_build=True,
         verbose_mode=verbose_mode,
     )
 
@@ -178,6 +183,10 @@ def _generate_src_gen_libs_cmake(  # pylint: disable=too-many-branches
 
         if model.is_silkit_used:
             libs_subdirs.append("platform_silkit")
+        if model.is_shm_used:
+            libs_subdirs.append("platform_shm")
+        if model.is_recording_used:
+            libs_subdirs.append("platform_recording")
 
     if len(libs_subdirs) > 0:
         generator.set_base_directory(output_dir / "src-gen/libs")
@@ -281,7 +290,9 @@ def generate(
     )
     if not is_ancestor:
         _generate_executables_cmake(generator, model, output_dir, verbose_mode=verbose_mode)
-        _generate_test_cmake(generator, model, output_dir, verbose_mode=verbose_mode)
+        _generate_test_cmake(
+            generator, model, output_dir, generate_for_application_module, verbose_mode=verbose_mode
+        )
         _generate_test_mocks_cmake(generator, model, output_dir, verbose_mode=verbose_mode)
 
     if data_type_definitions_exist(model) and not is_ancestor:
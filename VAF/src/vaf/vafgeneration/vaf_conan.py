@@ -11,10 +11,13 @@ from pathlib import Path
 from vaf import vafmodel
 
 from .generation import FileHelper, Generator
+from .vaf_silkit import get_used_compressions
 
 CONAN_DEPENDENCY_MAP = {
     "protobuf": ["protobuf/5.27.0"],
     "leveldb": ["leveldb/1.23"],
+    "lz4": ["lz4/1.9.4"],
+    "zstd": ["zstd/1.5.5"],
 }
 
 
@@ -25,11 +28,14 @@ def _generate_dependencies(generator: Generator, model: vafmodel.MainModel, verb
         deps.update(CONAN_DEPENDENCY_MAP["protobuf"])
         deps.update(CONAN_DEPENDENCY_MAP["leveldb"])
 
+    for compression in get_used_compressions(model):
+        deps.update(CONAN_DEPENDENCY_MAP["lz4" if compression == vafmodel.SampleCompression.LZ4 else "zstd"])
+
     generator.generate_to_file(
         FileHelper("conan_deps", "", True),
         ".list",
         "vaf_conan/conan_deps.list.jinja",
-        dependencies=deps,
+        dependencies=sorted(deps),
         verbose_mode=verbose_mode,
     )
 
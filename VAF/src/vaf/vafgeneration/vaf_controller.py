@@ -14,7 +14,7 @@ Generates
 # mypy: disable-error-code="union-attr"
 
 from pathlib import Path
-from typing import Any, List, Tuple
+from typing import Any, List, Optional, Tuple
 
 from vaf import vafmodel
 from vaf.core.common.utils import create_name_namespace_full_name, to_snake_case
@@ -183,7 +183,7 @@ def derive_persistency_set_function(file_name: str, iv: vafmodel.PersistencyInit
         output = f"""auto {file_name}_{iv.Key}_result = {file_name}->Get_{basetype_dict[name]}Value("{iv.Key}");
   if (!{file_name}_{iv.Key}_result.HasValue()) {{
     vaf::OutputSyncStream{{}} << "{file_name}: Key-Value {iv.Key} NOT initialized, set init value." << std::endl;
-    ReportErrorOfModule({file_name}_{iv.Key}_result.Error(), "ExecutableController::DoInitialize", false);
+    report_persistency_error({file_name}_{iv.Key}_result.Error(), false);
     {file_name}->Set_{basetype_dict[name]}Value("{iv.Key}", {_derive_value_str_from_value(iv.Value.InitValue)});
   }}"""
     else:
@@ -200,7 +200,7 @@ def derive_persistency_set_function(file_name: str, iv: vafmodel.PersistencyInit
         output = f"""auto {file_name}_{iv.Key}_result = {file_name}->Get_{fullname.rsplit("::", maxsplit=1)[-1]}Value("{iv.Key}");
   if (!{file_name}_{iv.Key}_result.HasValue()) {{
     vaf::OutputSyncStream{{}} << "{file_name}: Key-Value {iv.Key} NOT initialized, set init value." << std::endl;
-    ReportErrorOfModule({file_name}_{iv.Key}_result.Error(), "ExecutableController::DoInitialize", false);
+    report_persistency_error({file_name}_{iv.Key}_result.Error(), false);
     {implicit_data_type_to_str(name, namespace)} {file_name}_{iv.Key}_value = {{ {init_value} }};
     {file_name}->Set_{fullname.rsplit("::", maxsplit=1)[-1]}Value("{iv.Key}", {file_name}_{iv.Key}_value);
   }}"""
@@ -332,6 +332,103 @@ def get_task_mapping(
     return (offset, budget)
 
 
+def get_module_table(
+    exe: vafmodel.Executable,
+    communication_modules: list[vafmodel.PlatformModule],
+    shared_per_path: dict[str, str],
+) -> list[tuple[str, list[str], bool]]:
+    """Gets the modules of an executable in the order of their registration, as rows of its vaf::ModuleTable
+
+    Args:
+        exe (vafmodel.Executable): The executable
+        communication_modules (list[vafmodel.PlatformModule]): The communication modules of the executable
+        shared_per_path (dict[str, str]): Shared persistency paths and sync option
+
+    Returns:
+        list[tuple[str, list[str], bool]]: Per module its name, the words of its dependency set as hex literals and
+            whether it depends on a module of another executable
+    """
+    names = [m.Name for m in communication_modules] + [am.ApplicationModuleRef.Name for am in exe.ApplicationModules]
+    dependencies: list[list[str]] = [[] for _ in communication_modules] + [
+        get_dependencies_of_application_module(exe, am, shared_per_path)[0] for am in exe.ApplicationModules
+    ]
+    words = (len(names) + 63) // 64
+    rows: list[tuple[str, list[str], bool]] = []
+    for name, module_dependencies in zip(names, dependencies):
+        bits = [0] * words
+        for d in module_dependencies:
+            if d in names:
+                index = names.index(d)
+                bits[index // 64] |= 1 << (index % 64)
+        rows.append((name, [f"0x{b:x}" for b in bits], any(d not in names for d in module_dependencies)))
+    return rows
+
+
+def get_task_schedule(exe: vafmodel.Executable, executor: Optional[str] = None) -> list[tuple[str, str, int, int]]:
+    """Gets the periodic tasks of an executable, as entries of its vaf::TaskInfo table
+
+    Args:
+        exe (vafmodel.Executable): The executable
+        executor (Optional[str]): The named executor whose tasks are taken, the main executor if None
+
+    Returns:
+        list[tuple[str, str, int, int]]: Per task the name of its module, its name, its period in nanoseconds and
+            its offset
+    """
+    schedule: list[tuple[str, str, int, int]] = []
+    for am in exe.ApplicationModules:
+        offsets = {r.TaskName: get_task_mapping(r, am)[0] for r in am.TaskMapping}
+        executors = {r.TaskName: r.Executor for r in am.TaskMapping}
+        for task in am.ApplicationModuleRef.Tasks:
+            if executors.get(task.Name) != executor:
+                continue
+            offset = offsets.get(task.Name, task.PreferredOffset if task.PreferredOffset is not None else 0)
+            schedule.append((am.ApplicationModuleRef.Name, task.Name, time_str_to_nanoseconds(task.Period), offset))
+    return schedule
+
+
+def get_numa_nodes(
+    exe: vafmodel.Executable, communication_modules: list[vafmodel.PlatformModule]
+) -> dict[str, int]:
+    """Gets the NUMA node each module of an executable is constructed on
+
+    Args:
+        exe (vafmodel.Executable): The executable
+        communication_modules (list[vafmodel.PlatformModule]): The communication modules of the executable
+
+    Returns:
+        dict[str, int]: Per module name its NUMA node, modules without a NUMA node are left out. An application
+            module takes the node of the executor all its tasks run on unless it sets one. A platform module takes
+            the node of the application modules mapped to it if they all share one.
+    """
+    executor_nodes: dict[Optional[str], Optional[int]] = {None: exe.ExecutorNumaNode}
+    executor_nodes.update({ex.Name: ex.ExecutorNumaNode for ex in exe.Executors})
+
+    nodes: dict[str, int] = {}
+    for am in exe.ApplicationModules:
+        node = am.NumaNode
+        if node is None:
+            executors = {r.TaskName: r.Executor for r in am.TaskMapping}
+            used_executors = {executors.get(task.Name) for task in am.ApplicationModuleRef.Tasks} or {None}
+            if len(used_executors) == 1:
+                node = executor_nodes.get(used_executors.pop())
+        if node is not None:
+            nodes[am.ApplicationModuleRef.Name] = node
+
+    for m in communication_modules:
+        mapped_nodes = {
+            nodes.get(am.ApplicationModuleRef.Name)
+            for am in exe.ApplicationModules
+            for mapping in am.InterfaceInstanceToModuleMappings
+            if mapping.ModuleRef.Name == m.Name
+        }
+        if len(mapped_nodes) == 1:
+            node = mapped_nodes.pop()
+            if node is not None:
+                nodes[m.Name] = node
+    return nodes
+
+
 # Locals use seems reasonable. Generator could become an argument but not really a benefit there
 def generate(  # pylint: disable=too-many-locals, too-many-branches, too-many-statements
     model: vafmodel.MainModel,
@@ -348,7 +445,8 @@ def generate(  # pylint: disable=too-many-locals, too-many-branches, too-many-st
         verbose_mode: flag to enable verbose_mode mode
 
     Raises:
-        ValueError: If there is a interface mapping problem
+        ValueError: If there is a interface mapping problem or the SIL Kit virtual time is used without SIL Kit or
+            with executors of the executable
     """
     generator = Generator()
 
@@ -382,7 +480,8 @@ def generate(  # pylint: disable=too-many-locals, too-many-branches, too-many-st
                     )
                     > 0
                 ):
-                    if not _is_vsf_platform_module(e, mapping.ModuleRef):
+                    # A platform consumer module is shared by all consumers of its connection point
+                    if not _is_vsf_platform_module(e, mapping.ModuleRef) and mapping.ModuleRef not in consumed_modules:
                         consumed_modules.append(mapping.ModuleRef)
                 elif (
                     len(
@@ -403,6 +502,14 @@ def generate(  # pylint: disable=too-many-locals, too-many-branches, too-many-st
         folder_name = to_snake_case(e.Name)
         generator.set_base_directory(output_path / folder_name)
 
+        uses_silkit = any(
+            m.OriginalEcoSystem == vafmodel.OriginalEcoSystemEnum.SILKIT for m in consumed_modules + provided_modules
+        )
+        if e.ExecutorTimeSource == vafmodel.TimeSource.SILKIT_VIRTUAL_TIME and not uses_silkit:
+            raise ValueError(f"Executable {e.Name} uses the SIL Kit virtual time without SIL Kit platform modules")
+        if e.ExecutorTimeSource == vafmodel.TimeSource.SILKIT_VIRTUAL_TIME and len(e.Executors) > 0:
+            raise ValueError(f"Executable {e.Name} uses the SIL Kit virtual time with executors of its own")
+
         exe_controller_file = None
         if not is_ancestor:
             exe_controller_file = FileHelper("ExecutableController", "executable_controller")
@@ -410,6 +517,7 @@ def generate(  # pylint: disable=too-many-locals, too-many-branches, too-many-st
                 exe_controller_file,
                 ".h",
                 "vaf_controller/executable_controller_h.jinja",
+                executable=e,
             )
             generator.generate_to_file(
                 exe_controller_file,
@@ -423,8 +531,18 @@ def generate(  # pylint: disable=too-many-locals, too-many-branches, too-many-st
                 get_full_type_of_platform_module=get_full_type_of_platform_module,
                 get_include_of_application_module=get_include_of_application_module,
                 get_task_mapping=get_task_mapping,
+                module_table=get_module_table(e, consumed_modules + provided_modules, shared_per_path),
+                task_schedule=get_task_schedule(e),
+                executor_period_ns=time_str_to_nanoseconds(e.ExecutorPeriod),
+                executor_schedules=[
+                    (ex.Name, time_str_to_nanoseconds(ex.ExecutorPeriod), get_task_schedule(e, ex.Name))
+                    for ex in e.Executors
+                ],
                 executable=e,
                 communication_modules=consumed_modules + provided_modules,
+                numa_nodes=get_numa_nodes(e, consumed_modules + provided_modules),
+                uses_silkit=uses_silkit,
+                uses_virtual_time=e.ExecutorTimeSource == vafmodel.TimeSource.SILKIT_VIRTUAL_TIME,
                 vafmodel=vafmodel,
                 isinstance=isinstance,
                 shared_per_path=shared_per_path,
@@ -4,12 +4,15 @@
 """Generator for vaf core library.
 Generates
     Core library
+    Conan recipe of its prebuilt package
 """
 
 from pathlib import Path
 from typing import Any
 
-from .generation import FileHelper, Generator
+from vaf.core.common.constants import get_package_version
+
+from .generation import FileHelper, Generator, write_generated_file
 
 
 def __generate_internal(
@@ -51,12 +54,18 @@ def generate(
     """
     output_path = output_dir / "src-gen/libs/core_library"
 
+    # The pmr variant is the std library with containers over polymorphic allocators
+    use_pmr = type_variant == "pmr"
+    lib_type = "std" if use_pmr else type_variant
+
     generator = Generator()
     generator.set_base_directory(output_path)
 
-    __generate_internal("vaf_core_library/common/src/", output_path, "cpp", "", verbose_mode, lib_type=type_variant)
     __generate_internal(
-        "vaf_core_library/common/include/", output_path, "h", "vaf", verbose_mode, lib_type=type_variant
+        "vaf_core_library/common/src/", output_path, "cpp", "", verbose_mode, lib_type=lib_type, use_pmr=use_pmr
+    )
+    __generate_internal(
+        "vaf_core_library/common/include/", output_path, "h", "vaf", verbose_mode, lib_type=lib_type, use_pmr=use_pmr
     )
     __generate_internal(
         "vaf_core_library/common/include/internal/",
@@ -64,18 +73,29 @@ def generate(
         "h",
         "vaf/internal",
         verbose_mode,
-        lib_type=type_variant,
+        lib_type=lib_type,
+        use_pmr=use_pmr,
     )
 
-    __generate_internal("vaf_core_library/std/src/", output_path, "cpp", "", verbose_mode)
-    __generate_internal("vaf_core_library/std/include/", output_path, "h", "vaf", verbose_mode)
-    __generate_internal("vaf_core_library/std/include/tl/", output_path, "h", "tl", verbose_mode)
-    __generate_internal("vaf_core_library/std/include/internal/", output_path, "h", "vaf/internal", verbose_mode)
+    __generate_internal("vaf_core_library/std/src/", output_path, "cpp", "", verbose_mode, use_pmr=use_pmr)
+    __generate_internal("vaf_core_library/std/include/", output_path, "h", "vaf", verbose_mode, use_pmr=use_pmr)
+    __generate_internal("vaf_core_library/std/include/tl/", output_path, "h", "tl", verbose_mode, use_pmr=use_pmr)
+    __generate_internal(
+        "vaf_core_library/std/include/internal/", output_path, "h", "vaf/internal", verbose_mode, use_pmr=use_pmr
+    )
 
     generator.generate_to_file(
         FileHelper("CMakeLists", "", True),
         ".txt",
         "vaf_core_library/common/cmake.jinja",
         verbose_mode=verbose_mode,
-        lib_type=type_variant,
+        lib_type=lib_type,
+        use_pmr=use_pmr,
+    )
+    generator.generate_to_file(
+        FileHelper("conanfile", "", True),
+        ".py",
+        "vaf_core_library/common/conanfile.jinja",
+        verbose_mode=verbose_mode,
     )
+    write_generated_file(output_path / "version.txt", get_package_version() + "\n", verbose_mode)
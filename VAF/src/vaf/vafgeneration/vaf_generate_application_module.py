@@ -13,13 +13,20 @@ from vaf.vafpy import import_model
 from vaf.vafpy.model_runtime import ModelRuntime
 
 # Utils
+from .generation import remove_stale_files, start_generation
 from .vaf_application_module import generate_app_module_project_files
 
 # Build system files generators
 from .vaf_cmake_common import generate as generate_cmake_common
 from .vaf_conan import generate as generate_conan_deps
 from .vaf_core_library import generate as generate_core_library
-from .vaf_generate_common import format_files, get_ancestor_model, is_source_file, merge_after_regeneration
+from .vaf_generate_common import (
+    GenerationManifest,
+    format_files,
+    get_ancestor_model,
+    is_source_file,
+    merge_after_regeneration,
+)
 
 # VAF generators
 from .vaf_interface import generate_module_interfaces as generate_interface
@@ -70,7 +77,6 @@ def generate_application_module(  # pylint: disable=too-many-arguments, too-many
         execute_merge (bool): Flag to enable/disable automatic merge changes after regeneration
         verbose_mode (bool): Flag to enable verbose mode
     Raises:
-        SystemError: If there is a system-related error during cleanup.
         ValueError: If the given model contains more or less application modules than one.
     """
     list_merge_relevant_files: List[str] = []
@@ -96,14 +102,10 @@ def generate_application_module(  # pylint: disable=too-many-arguments, too-many
     # (first time: if src-gen folder only contains one file - conan_deps.list)
     execute_merge &= len(list((path_output_dir / "src-gen").glob("*"))) != 1
 
-    for subdir_name in ["src-gen", "test"]:
-        if (path_output_dir / subdir_name).is_dir():
-            try:
-                shutil.rmtree(path_output_dir / subdir_name)
-            except OSError as e:
-                raise SystemError(
-                    f'Folder "{(path_output_dir / subdir_name).absolute().as_posix()}" could not be removed due to {e}!'
-                ) from e
+    # Unchanged files are kept and generators with unchanged inputs skipped, see generate_integration_project
+    start_generation()
+    manifest = GenerationManifest(path_output_dir)
+    model_json = main_model.model_dump_json()
 
     generate_conan_deps(main_model, path_output_dir, verbose_mode)
 
@@ -135,17 +137,34 @@ def generate_application_module(  # pylint: disable=too-many-arguments, too-many
         )
 
     _print_info("VAF GENERATE APP-MODULE: STEP 3", "Generating core support files")
-    generate_core_library(path_output_dir, type_variant, verbose_mode=verbose_mode)
+    manifest.run(
+        "core_library",
+        type_variant,
+        lambda: generate_core_library(path_output_dir, type_variant, verbose_mode=verbose_mode),
+        verbose_mode,
+    )
 
     _print_info(
         "VAF GENERATE APP-MODULE: STEP 4",
         f"Generating datatypes using {type_variant} generator",
     )
-    generate_vaf_std_data_types(path_output_dir, verbose_mode)
+    manifest.run(
+        "std_data_types",
+        main_model.DataTypeDefinitions.model_dump_json(),
+        lambda: generate_vaf_std_data_types(path_output_dir, verbose_mode),
+        verbose_mode,
+    )
     if main_model.is_silkit_used or main_model.is_persistency_used:
-        generate_protobuf_serdes(path_output_dir, verbose_mode)
+        manifest.run(
+            "protobuf_serdes", model_json, lambda: generate_protobuf_serdes(path_output_dir, verbose_mode), verbose_mode
+        )
     if main_model.is_persistency_used:
-        generate_persistency(main_model, path_output_dir, verbose_mode)
+        manifest.run(
+            "persistency",
+            model_json,
+            lambda: generate_persistency(main_model, path_output_dir, verbose_mode),
+            verbose_mode,
+        )
 
     # must run as last generator
     # No files to merge when generating for app-modules
@@ -156,6 +175,9 @@ def generate_application_module(  # pylint: disable=too-many-arguments, too-many
         verbose_mode=verbose_mode,
     )
     print("SUCCESS: Datatypes generated!")
+    manifest.save()
+    for subdir_name in ["src-gen", "test"]:
+        remove_stale_files(path_output_dir / subdir_name, verbose_mode)
 
     format_files(
         project_dir=project_dir,
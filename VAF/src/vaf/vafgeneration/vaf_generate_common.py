@@ -3,19 +3,31 @@
 
 """Generator library for generating the complete VAF project."""
 
+import functools
+import hashlib
+import json
 import shutil
 import subprocess
 from pathlib import Path
-from typing import List
+from typing import Any, Callable, List
 
 from vaf import vafmodel
-from vaf.core.common.constants import SUFFIX
+from vaf.core.common.constants import SUFFIX, get_package_version
 
 # Utils
 from vaf.core.common.utils import (
     concat_str_to_path,
 )
 
+from .generation import (
+    get_generated_files,
+    mark_generated,
+    parallel_rendering,
+    write_generated_file,
+)
+
+GENERATION_MANIFEST = "src-gen/generation_manifest.json"
+
 
 def __file_has_conflict(file_path: Path) -> bool:
     """Function to check if file contains conflicts
@@ -295,3 +307,81 @@ def get_ancestor_model(input_file: str) -> vafmodel.MainModel | None:
     # check for "ancestor" model.json (model.json~)
     ancestor_json = concat_str_to_path(Path(input_file), SUFFIX["old_file"])
     return vafmodel.load_json(ancestor_json) if ancestor_json.is_file() else None
+
+
+@functools.cache
+def _get_generator_hash() -> str:
+    """Returns the hash of the generators and their templates, so a new VAF version regenerates everything"""
+    generator_hash = hashlib.sha256(get_package_version().encode("utf-8"))
+    package_dir = Path(__file__).parent
+    for path in sorted(package_dir.rglob("*")):
+        if path.is_file() and path.suffix in (".py", ".jinja"):
+            generator_hash.update(path.relative_to(package_dir).as_posix().encode("utf-8"))
+            generator_hash.update(path.read_bytes())
+    return generator_hash.hexdigest()
+
+
+class GenerationManifest:
+    """Hashes of the inputs of the generators of a project and the files they generated, stored in
+    src-gen/generation_manifest.json. A generator whose inputs and files did not change since the last generation is
+    skipped, its files are kept as they are.
+    """
+
+    def __init__(self, project_dir: Path) -> None:
+        self.project_dir = project_dir
+        self.path = project_dir / GENERATION_MANIFEST
+        self.entries: dict[str, dict[str, Any]] = {}
+        try:
+            self.entries = json.loads(self.path.read_text(encoding="utf-8"))["Generators"]
+        except (OSError, ValueError, KeyError, TypeError):
+            # Without a valid manifest all generators run
+            self.entries = {}
+
+    def __files_unchanged(self, entry: dict[str, Any]) -> bool:
+        for file in entry["Files"]:
+            path = self.project_dir / file["Path"]
+            if not path.is_file():
+                return False
+            stat = path.stat()
+            if stat.st_mtime_ns != file["ModificationTime"] or stat.st_size != file["Size"]:
+                return False
+        return True
+
+    def run(self, name: str, inputs: str, generator: Callable[[], Any], verbose_mode: bool = False) -> None:
+        """Runs a generator unless its inputs and the files it generated last time did not change.
+        The generator renders its files in parallel, see parallel_rendering.
+
+        Args:
+            name (str): Unique name of the generator call
+            inputs (str): Everything the generator reads, e.g. the JSON of the model parts it uses
+            generator (Callable[[], Any]): Calls the generator
+            verbose_mode (bool): flag to enable verbose mode
+        """
+        input_hash = hashlib.sha256((_get_generator_hash() + name + inputs).encode("utf-8")).hexdigest()
+        entry = self.entries.get(name)
+        if entry is not None and entry.get("Hash") == input_hash and self.__files_unchanged(entry):
+            mark_generated(self.project_dir / file["Path"] for file in entry["Files"])
+            if verbose_mode:
+                print(f"VAF: Skipping unchanged generator {name}")
+            return
+
+        start = len(get_generated_files())
+        with parallel_rendering():
+            generator()
+        files: list[dict[str, Any]] = []
+        project_dir = self.project_dir.resolve()
+        for path in dict.fromkeys(get_generated_files()[start:]):
+            if path.is_file() and path.is_relative_to(project_dir):
+                stat = path.stat()
+                files.append(
+                    {
+                        "Path": path.relative_to(project_dir).as_posix(),
+                        "ModificationTime": stat.st_mtime_ns,
+                        "Size": stat.st_size,
+                    }
+                )
+        self.entries[name] = {"Hash": input_hash, "Files": files}
+
+    def save(self) -> None:
+        """Writes the manifest"""
+        write_generated_file(self.path, json.dumps({"Generators": self.entries}, indent=2) + "\n")
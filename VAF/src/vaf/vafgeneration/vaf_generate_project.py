@@ -3,7 +3,7 @@
 
 """Generator library for generating the complete VAF project."""
 
-import shutil
+import functools
 from pathlib import Path
 from typing import Any, Callable, Dict, List
 
@@ -15,6 +15,8 @@ from .vaf_application_communication import (
     generate as generate_application_communication,
 )
 from .vaf_application_module import generate_app_module_files_for_integration_project
+from .vaf_benchmark import generate as generate_benchmark
+from .vaf_memory_estimate import generate as generate_memory_estimate
 
 # Build system files generators
 from .vaf_cmake_common import generate as generate_cmake_common
@@ -24,10 +26,19 @@ from .vaf_core_library import generate as generate_core_library
 
 # Platform Generators
 # VAF generators
-from .vaf_generate_common import format_files, get_ancestor_model, is_source_file, merge_after_regeneration
+from .generation import remove_stale_files, start_generation
+from .vaf_generate_common import (
+    GenerationManifest,
+    format_files,
+    get_ancestor_model,
+    is_source_file,
+    merge_after_regeneration,
+)
 from .vaf_interface import generate_module_interfaces as generate_interface
 from .vaf_persistency import generate as generate_persistency
 from .vaf_protobuf_serdes import generate as generate_protobuf_serdes
+from .vaf_recording import generate as generate_recording
+from .vaf_shm import generate as generate_shm
 from .vaf_silkit import generate as generate_silkit
 from .vaf_std_data_types import generate as generate_vaf_std_data_types
 
@@ -59,6 +70,8 @@ def get_ecosystems(model: vafmodel.MainModel) -> List[str]:
 
 ECOSYSTEM_FUNCTION_DICT: Dict[str, Callable[[vafmodel.MainModel, Path, bool], Any]] = {
     "SILKIT": generate_silkit,
+    "SHM": generate_shm,
+    "RECORDING": generate_recording,
 }
 
 
@@ -86,7 +99,6 @@ def generate_integration_project(
         verbose_mode (bool): Flag to enable verbose mode
     Raises:
         ValueError: If the path to the project root directory is invalid.
-        SystemError: If there is a system-related error during cleanup.
 
     """
     # clean model runtime before every run
@@ -99,28 +111,18 @@ def generate_integration_project(
     import_model(model_file)
     main_model = ModelRuntime().main_model
 
-    delete_folder_src_gen: Path = path_project_dir / "src-gen"
-    if delete_folder_src_gen.exists():
-        try:
-            shutil.rmtree(delete_folder_src_gen)
-        except OSError as e:
-            raise SystemError(
-                f'Folder "{delete_folder_src_gen.absolute().as_posix()}" could not be removed because of {e}!'
-            ) from e
-
-    delete_folder_test_gen: Path = path_project_dir / "test-gen"
-    if delete_folder_test_gen.exists():
-        try:
-            shutil.rmtree(delete_folder_test_gen)
-        except OSError as e:
-            raise SystemError(
-                f'Folder "{delete_folder_test_gen.absolute().as_posix()}" could not be removed because of {e}!'
-            ) from e
+    # Generated files are only written if their content changed and generators with unchanged inputs are skipped, so
+    # the build only compiles what the model change affects. Files no generator produced anymore are removed at the end.
+    start_generation()
+    manifest = GenerationManifest(path_project_dir)
+    model_json = main_model.model_dump_json()
 
     # This generator needs to run before calling get_paths()
     generate_conan_deps(main_model, path_project_dir, verbose_mode)
 
-    generate_interface(main_model, path_project_dir, verbose_mode)
+    manifest.run(
+        "interface", model_json, lambda: generate_interface(main_model, path_project_dir, verbose_mode), verbose_mode
+    )
 
     # Load "ancestor" model.json if available and 3-way-merge is enabled
     ancestor_model = get_ancestor_model(model_file) if execute_merge else None
@@ -143,7 +145,12 @@ def generate_integration_project(
                 verbose_mode=verbose_mode,
             )
 
-        generate_application_communication(main_model, path_project_dir, verbose_mode)
+        manifest.run(
+            "application_communication",
+            model_json,
+            lambda: generate_application_communication(main_model, path_project_dir, verbose_mode),
+            verbose_mode,
+        )
 
     list_merge_relevant_files += generate_controller(main_model, path_project_dir, verbose_mode=verbose_mode)
     if ancestor_model is not None:
@@ -156,14 +163,45 @@ def generate_integration_project(
 
     # only generate platform dir for used ecosystems
     for ecosystem in get_ecosystems(main_model):
-        ECOSYSTEM_FUNCTION_DICT[ecosystem](main_model, path_project_dir, verbose_mode)
+        manifest.run(
+            ecosystem,
+            model_json,
+            functools.partial(ECOSYSTEM_FUNCTION_DICT[ecosystem], main_model, path_project_dir, verbose_mode),
+            verbose_mode,
+        )
 
-    generate_core_library(path_project_dir, type_variant, verbose_mode=verbose_mode)
-    generate_vaf_std_data_types(path_project_dir, verbose_mode)
+    manifest.run(
+        "core_library",
+        type_variant,
+        lambda: generate_core_library(path_project_dir, type_variant, verbose_mode=verbose_mode),
+        verbose_mode,
+    )
+    manifest.run(
+        "std_data_types",
+        main_model.DataTypeDefinitions.model_dump_json(),
+        lambda: generate_vaf_std_data_types(path_project_dir, verbose_mode),
+        verbose_mode,
+    )
     if main_model.is_silkit_used or main_model.is_persistency_used:
-        generate_protobuf_serdes(path_project_dir, verbose_mode)
+        manifest.run(
+            "protobuf_serdes", model_json, lambda: generate_protobuf_serdes(path_project_dir, verbose_mode), verbose_mode
+        )
     if main_model.is_persistency_used:
-        generate_persistency(main_model, path_project_dir, verbose_mode)
+        manifest.run(
+            "persistency",
+            model_json,
+            lambda: generate_persistency(main_model, path_project_dir, verbose_mode),
+            verbose_mode,
+        )
+    manifest.run(
+        "benchmark", model_json, lambda: generate_benchmark(main_model, path_project_dir, verbose_mode), verbose_mode
+    )
+    manifest.run(
+        "memory_estimate",
+        model_json,
+        lambda: generate_memory_estimate(main_model, path_project_dir, verbose_mode),
+        verbose_mode,
+    )
 
     # must run as last generator
     list_merge_relevant_files += generate_cmake_common(
@@ -181,6 +219,10 @@ def generate_integration_project(
             verbose_mode=verbose_mode,
         )
 
+    manifest.save()
+    remove_stale_files(path_project_dir / "src-gen", verbose_mode)
+    remove_stale_files(path_project_dir / "test-gen", verbose_mode)
+
     format_files(
         project_dir=project_dir,
         list_files=[Path(project_dir) / f for f in list_merge_relevant_files if is_source_file(Path(project_dir) / f)],
@@ -56,7 +56,7 @@ def generate_interfaces(
                 verbose_mode=verbose_mode,
             )
 
-    include_files = list(set(include_files))
+    include_files = sorted(set(include_files))
 
     consumer_file = FileHelper(interface.Name + "Consumer", interface.Namespace)
     generator.generate_to_file(
@@ -115,7 +115,7 @@ def generate_interfaces_mocks(
             include_files.append(FileHelper(o.Name, out_parameter_type_namespace).get_include())
 
     include_files.append(get_include(interface.Name + "_consumer", interface.Namespace))
-    include_files = list(set(include_files))
+    include_files = sorted(set(include_files))
 
     consumer_file = FileHelper(interface.Name + "ConsumerMock", interface.Namespace)
     generator.generate_to_file(
@@ -130,7 +130,8 @@ def generate_interfaces_mocks(
         verbose_mode=verbose_mode,
     )
 
-    include_files.remove(get_include(interface.Name + "_consumer", interface.Namespace))
+    # The consumer mock is rendered later within parallel_rendering, so its include files are left as they are
+    include_files = [f for f in include_files if f != get_include(interface.Name + "_consumer", interface.Namespace)]
     include_files.append(get_include(interface.Name + "_provider", interface.Namespace))
     provided_file = FileHelper(interface.Name + "ProviderMock", interface.Namespace)
     generator.generate_to_file(
@@ -0,0 +1,86 @@
+# Copyright (c) 2024-2026 by Vector Informatik GmbH. All rights reserved.
+# SPDX-License-Identifier: Apache-2.0
+
+"""Generator for the application modules of a synthetic load project, see vaf load generate.
+Generates
+    - src/application_modules/<module>/CMakeLists.txt
+    - src/application_modules/<module>/implementation/CMakeLists.txt
+    - src/application_modules/<module>/implementation/include/<module>.h
+    - src/application_modules/<module>/implementation/src/<module>.cpp
+"""
+
+from pathlib import Path
+from typing import Any
+
+from vaf import vafmodel
+from vaf.core.common.utils import to_snake_case
+
+from .generation import FileHelper, Generator
+
+
+def _get_tasks(am: vafmodel.ApplicationModule) -> list[dict[str, Any]]:
+    # The data elements of the provided interface are published by the tasks in turn
+    data_elements = [
+        data_element for pi in am.ProvidedInterfaces for data_element in pi.ModuleInterfaceRef.DataElements
+    ]
+    return [
+        {
+            "task": task,
+            "data_elements": data_elements[index :: len(am.Tasks)],
+        }
+        for index, task in enumerate(am.Tasks)
+    ]
+
+
+def generate(model: vafmodel.MainModel, output_dir: Path, verbose_mode: bool = False) -> None:
+    """Generate the implementations of the application modules of a synthetic load project
+
+    Args:
+        model (vafmodel.MainModel): The model
+        output_dir (Path): Base output directory
+        verbose_mode: flag to enable verbose_mode mode
+    """
+    generator = Generator()
+    for am in model.ApplicationModules:
+        module_dir = output_dir / "src/application_modules" / to_snake_case(am.Name)
+        if am.ImplementationProperties is not None and am.ImplementationProperties.InstallationPath is not None:
+            module_dir = output_dir / "src/application_modules" / am.ImplementationProperties.InstallationPath
+
+        generator.set_base_directory(module_dir)
+        generator.generate_to_file(
+            FileHelper("CMakeLists", "", True),
+            ".txt",
+            "common/cmake_subdirs.jinja",
+            subdirs=["implementation"],
+            verbose_mode=verbose_mode,
+        )
+
+        generator.set_base_directory(module_dir / "implementation")
+        app_file = FileHelper(am.Name, am.Namespace)
+        tasks = _get_tasks(am)
+        generator.generate_to_file(
+            app_file,
+            ".h",
+            "vaf_load/module_h.jinja",
+            app_module=am,
+            tasks=tasks,
+            base_include=FileHelper(am.Name + "Base", am.Namespace).get_include(),
+            verbose_mode=verbose_mode,
+        )
+        generator.generate_to_simple_file(
+            app_file,
+            ".cpp",
+            "vaf_load/module_cpp.jinja",
+            app_module=am,
+            tasks=tasks,
+            verbose_mode=verbose_mode,
+        )
+        generator.generate_to_file(
+            FileHelper("CMakeLists", "", True),
+            ".txt",
+            "vaf_load/cmake_implementation.jinja",
+            target_name=to_snake_case(am.Name),
+            files=[app_file],
+            libraries=[to_snake_case("Vaf" + am.Name + "Base")],
+            verbose_mode=verbose_mode,
+        )
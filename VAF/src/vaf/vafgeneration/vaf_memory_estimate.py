@@ -0,0 +1,221 @@
+# Copyright (c) 2024-2026 by Vector Informatik GmbH. All rights reserved.
+# SPDX-License-Identifier: Apache-2.0
+
+"""Generator for the static estimate of the memory the communication modules hold.
+Generates
+    - src-gen/memory_estimate.json
+"""
+
+import json
+from pathlib import Path
+from typing import Any, Callable, NamedTuple, Optional
+
+from vaf import vafmodel
+
+from .generation import data_type_to_str, write_generated_file
+from .vaf_silkit import is_flat_data_type
+
+_BASE_TYPE_SIZES = {
+    "int8_t": 1,
+    "int16_t": 2,
+    "int32_t": 4,
+    "int64_t": 8,
+    "uint8_t": 1,
+    "uint16_t": 2,
+    "uint32_t": 4,
+    "uint64_t": 8,
+    "float": 4,
+    "double": 8,
+    "bool": 1,
+}
+# Sizes of the containers of the C++ standard library on 64-bit targets, without their elements
+_STRING_SIZE = 32
+_VECTOR_SIZE = 24
+_MAP_SIZE = 48
+_ENUM_SIZE = 4
+# Virtual table, payload pointer, reference count and stamp of the block a data pointer shares its sample in
+_SAMPLE_BLOCK_HEADER_SIZE = 40
+# Lock, data pointer and sequence number of a slot of a sample history
+_HISTORY_SLOT_SIZE = 24
+# Samples up to this size of a fixed layout are stored inline by the communication modules
+_MAX_INLINE_SAMPLE_SIZE = 64
+
+
+class _Layout(NamedTuple):
+    size: int
+    alignment: int
+    # The type holds strings, vectors or maps, whose elements are not part of the estimate
+    dynamic: bool
+
+
+def _align(value: int, alignment: int) -> int:
+    return (value + alignment - 1) // alignment * alignment
+
+
+def _layout(data_type: vafmodel.DataType, model: vafmodel.MainModel) -> _Layout:
+    # pylint: disable=too-many-return-statements, too-many-branches
+    if data_type.is_cpp_base_type:
+        size = _BASE_TYPE_SIZES[data_type.Name]
+        return _Layout(size, size, False)
+    definitions = model.DataTypeDefinitions
+
+    def _matches(definition: vafmodel.DataType) -> bool:
+        return data_type.Name == definition.Name and data_type.Namespace == definition.Namespace
+
+    for string in definitions.Strings:
+        if _matches(string):
+            if string.MaxSize is not None:
+                # The size followed by the terminated characters
+                return _Layout(_align(8 + string.MaxSize + 1, 8), 8, False)
+            return _Layout(_STRING_SIZE, 8, True)
+    for vector in definitions.Vectors:
+        if _matches(vector):
+            if vector.StructOfArrays:
+                return _struct_of_arrays_layout(vector, model)
+            if vector.MaxSize is not None:
+                return _static_vector_layout(_layout(vector.TypeRef, model), vector.MaxSize)
+            return _Layout(_VECTOR_SIZE, 8, True)
+    for map_entry in definitions.Maps:
+        if _matches(map_entry):
+            if map_entry.MaxSize is not None:
+                key = _layout(map_entry.MapKeyTypeRef, model)
+                value = _layout(map_entry.MapValueTypeRef, model)
+                entry_alignment = max(key.alignment, value.alignment)
+                entry = _Layout(
+                    _align(_align(key.size, value.alignment) + value.size, entry_alignment),
+                    entry_alignment,
+                    key.dynamic or value.dynamic,
+                )
+                return _static_vector_layout(entry, map_entry.MaxSize)
+            if map_entry.Container is vafmodel.MapContainer.FLAT_SORTED:
+                return _Layout(_VECTOR_SIZE, 8, True)
+            if map_entry.Container is vafmodel.MapContainer.HASH:
+                # The entries and the table of their indices
+                return _Layout(2 * _VECTOR_SIZE, 8, True)
+            return _Layout(_MAP_SIZE, 8, True)
+    if any(_matches(e) for e in definitions.Enums):
+        return _Layout(_ENUM_SIZE, _ENUM_SIZE, False)
+    for a in definitions.Arrays:
+        if _matches(a):
+            element = _layout(a.TypeRef, model)
+            return _Layout(element.size * a.Size, element.alignment, element.dynamic)
+    for t in definitions.TypeRefs:
+        if _matches(t):
+            return _layout(t.TypeRef, model)
+    for st in definitions.Structs:
+        if _matches(st):
+            return _struct_layout(st, model)
+    for variant in definitions.Variants:
+        if _matches(variant):
+            alternatives = [_layout(ref, model) for ref in variant.VariantTypeRefs]
+            alignment = max([8] + [a.alignment for a in alternatives])
+            size = max([0] + [a.size for a in alternatives])
+            return _Layout(_align(size + 1, alignment), alignment, any(a.dynamic for a in alternatives))
+    raise ValueError(f"Unknown data type {data_type_to_str(data_type)}")
+
+
+def _static_vector_layout(element: _Layout, capacity: int) -> _Layout:
+    # The size followed by the inline elements, see vaf::StaticVector
+    alignment = max(element.alignment, 8)
+    return _Layout(_align(_align(8, element.alignment) + element.size * capacity, alignment), alignment, element.dynamic)
+
+
+def _struct_of_arrays_layout(vector: vafmodel.Vector, model: vafmodel.MainModel) -> _Layout:
+    # One column per member of the element struct, see the generated structure-of-arrays vector
+    element = next(
+        st
+        for st in model.DataTypeDefinitions.Structs
+        if st.Name == vector.TypeRef.Name and st.Namespace == vector.TypeRef.Namespace
+    )
+    capacity = vector.MaxSize
+    if capacity is not None:
+        return _struct_layout(element, model, lambda member: _static_vector_layout(member, capacity))
+    return _struct_layout(element, model, lambda _: _Layout(_VECTOR_SIZE, 8, True))
+
+
+def _struct_layout(
+    struct: vafmodel.Struct, model: vafmodel.MainModel, column: Optional[Callable[[_Layout], _Layout]] = None
+) -> _Layout:
+    size = 0
+    alignment = 1
+    dynamic = False
+    for sub in struct.SubElements:
+        member = _layout(sub.TypeRef, model)
+        if sub.IsOptional:
+            # The value is followed by the flag whether it is set
+            member = _Layout(_align(member.size + 1, member.alignment), member.alignment, member.dynamic)
+        if column is not None:
+            member = column(member)
+        size = _align(size, member.alignment) + member.size
+        alignment = max(alignment, member.alignment)
+        dynamic = dynamic or member.dynamic
+    return _Layout(_align(max(size, 1), alignment), alignment, dynamic)
+
+
+def _sample_block_size(layout: _Layout) -> int:
+    alignment = max(layout.alignment, 8)
+    return _align(_align(_SAMPLE_BLOCK_HEADER_SIZE, alignment) + layout.size, alignment)
+
+
+def _estimate_data_element(
+    data_element: vafmodel.DataElement, internal: bool, consumers: int, model: vafmodel.MainModel
+) -> dict[str, Any]:
+    layout = _layout(data_element.TypeRef, model)
+    block = _sample_block_size(layout)
+    inline = internal and layout.size <= _MAX_INLINE_SAMPLE_SIZE and is_flat_data_type(data_element.TypeRef, model)
+    # The latest sample, stored inline or in a block of its own
+    samples = 1
+    size = (8 + _align(layout.size, 8)) if inline else block
+    pool = data_element.SamplePoolSize if internal and data_element.SamplePoolSize is not None else 0
+    history = data_element.HistoryDepth if internal and data_element.HistoryDepth is not None else 0
+    size += pool * block + history * (_HISTORY_SLOT_SIZE + block)
+    return {
+        "Name": data_element.Name,
+        "DataType": data_type_to_str(data_element.TypeRef),
+        "SampleBytes": layout.size,
+        "Dynamic": layout.dynamic,
+        "Samples": samples + pool + history,
+        "PoolCapacity": pool,
+        "HistoryDepth": history,
+        "Consumers": consumers,
+        "Bytes": size,
+    }
+
+
+def _estimate_executable(executable: vafmodel.Executable, model: vafmodel.MainModel) -> dict[str, Any]:
+    internal_modules = {m.Name for m in executable.InternalCommunicationModules}
+    consumer_modules = internal_modules | {m.Name for m in model.PlatformConsumerModules}
+    modules: dict[str, vafmodel.PlatformModule] = {}
+    consumers: dict[str, int] = {}
+    for mapping in executable.ApplicationModules:
+        consumed = {ci.InstanceName for ci in mapping.ApplicationModuleRef.ConsumedInterfaces}
+        for instance in mapping.InterfaceInstanceToModuleMappings:
+            module: Optional[vafmodel.PlatformModule] = instance.ModuleRef
+            if module is None or module.Name not in consumer_modules:
+                continue
+            modules.setdefault(module.Name, module)
+            consumers[module.Name] = consumers.get(module.Name, 0) + (instance.InstanceName in consumed)
+
+    estimates: list[dict[str, Any]] = []
+    for name in sorted(modules):
+        data_elements = [
+            _estimate_data_element(de, name in internal_modules, consumers[name], model)
+            for de in modules[name].ModuleInterfaceRef.DataElements
+        ]
+        estimates.append(
+            {"Name": name, "Bytes": sum(de["Bytes"] for de in data_elements), "DataElements": data_elements}
+        )
+    return {"Name": executable.Name, "Bytes": sum(m["Bytes"] for m in estimates), "Modules": estimates}
+
+
+def generate(model: vafmodel.MainModel, output_dir: Path, verbose_mode: bool = False) -> None:
+    """Generate the memory estimate of an integration project
+
+    Args:
+        model (vafmodel.MainModel): The model
+        output_dir (Path): Base output directory
+        verbose_mode: flag to enable verbose_mode mode
+    """
+    estimate = {"Executables": [_estimate_executable(executable, model) for executable in model.Executables]}
+    content = json.dumps(estimate, indent=2) + "\n"
+    write_generated_file(output_dir / "src-gen/memory_estimate.json", content, verbose_mode)
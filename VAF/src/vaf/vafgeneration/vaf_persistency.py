@@ -7,9 +7,10 @@ from pathlib import Path
 from typing import Any
 
 from vaf import vafmodel
+from vaf.core.common.constants import PersistencyLibrary
 
 from ..core.common.utils import create_name_namespace_full_name
-from .generation import FileHelper, Generator
+from .generation import FileHelper, Generator, get_used_persistency_libs
 
 
 def _get_used_namespaces_and_name(
@@ -62,8 +63,7 @@ def _get_includes(model: vafmodel.MainModel) -> list[str]:
         includes.append(
             '#include "' + type_ref.Namespace.replace("::", "/") + "/impl_type_" + type_ref.Name.lower() + '.h"'
         )
-    includes = list(set(includes))
-    return includes
+    return sorted(set(includes))
 
 
 # pylint: disable=too-many-locals, too-many-statements
@@ -132,48 +132,54 @@ def _generate_interface(
 
     generator.set_base_directory(output_dir / "src-gen/libs/persistency")
 
-    # Depending on the used persistency library, add wrapper and cmake dependencies
+    # Depending on the used persistency libraries, add wrappers and cmake dependencies
+    # Projects without executables, like application module projects, keep LevelDB
+    used_libraries = get_used_persistency_libs(model) - {PersistencyLibrary.NONE} or {PersistencyLibrary.LEVELDB}
     cmake_libraries = []
     cmake_find_packages = []
-    jinja_per_h_file = ""
-    jinja_per_cpp_file = ""
     extra_includes: list[Any] = []
-    cmake_find_packages.append("leveldb")
-    cmake_libraries.append("leveldb::leveldb")
-    jinja_per_h_file = "vaf_persistency/persistency_module_h_leveldb.jinja"
-    jinja_per_cpp_file = "vaf_persistency/persistency_module_cpp_leveldb.jinja"
-
-    generator.generate_to_file(
-        module_file,
-        ".h",
-        jinja_per_h_file,
-        module_name=module_name,
-        namespaces=import_datatype_namespaces,
-        datatype_names=import_datatype_names,
-        proto_basetype_dict=proto_basetype_dict,
-        interface_file=interface_file,
-        kvs_interface_file=kvs_interface_file,
-        verbose_mode=verbose_mode,
-    )
+    module_files: list[FileHelper] = []
+    wrappers: list[tuple[FileHelper, str, str]] = []
+    if PersistencyLibrary.LEVELDB in used_libraries:
+        cmake_find_packages.append("leveldb")
+        cmake_libraries.append("leveldb::leveldb")
+        wrappers.append((module_file, module_name, "leveldb"))
+    if PersistencyLibrary.MMAP in used_libraries:
+        wrappers.append((FileHelper("Mmap" + module_name, "persistency"), "Mmap" + module_name, "mmap"))
+
+    for wrapper_file, wrapper_name, library in wrappers:
+        module_files.append(wrapper_file)
+        generator.generate_to_file(
+            wrapper_file,
+            ".h",
+            f"vaf_persistency/persistency_module_h_{library}.jinja",
+            module_name=wrapper_name,
+            namespaces=import_datatype_namespaces,
+            datatype_names=import_datatype_names,
+            proto_basetype_dict=proto_basetype_dict,
+            interface_file=interface_file,
+            kvs_interface_file=kvs_interface_file,
+            verbose_mode=verbose_mode,
+        )
 
-    generator.generate_to_file(
-        module_file,
-        ".cpp",
-        jinja_per_cpp_file,
-        module_name=module_name,
-        namespaces=import_datatype_namespaces,
-        datatype_names=import_datatype_names,
-        proto_basetype_dict=proto_basetype_dict,
-        kvs_interface_file=kvs_interface_file,
-        verbose_mode=verbose_mode,
-    )
+        generator.generate_to_file(
+            wrapper_file,
+            ".cpp",
+            f"vaf_persistency/persistency_module_cpp_{library}.jinja",
+            module_name=wrapper_name,
+            namespaces=import_datatype_namespaces,
+            datatype_names=import_datatype_names,
+            proto_basetype_dict=proto_basetype_dict,
+            kvs_interface_file=kvs_interface_file,
+            verbose_mode=verbose_mode,
+        )
 
     generator.generate_to_file(
         FileHelper("CMakeLists", "", True),
         ".txt",
         "vaf_persistency/module_cmake.jinja",
         target_name="vaf_persistency",
-        files=[module_file],
+        files=module_files,
         packages=cmake_find_packages,
         libraries=[
             "vaf_core",
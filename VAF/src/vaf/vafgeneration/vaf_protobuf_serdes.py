@@ -57,6 +57,18 @@ def data_type_to_proto_type(data_type: vafmodel.DataType) -> str:
     return result
 
 
+def is_bytes_sequence(sequence: vafmodel.Array | vafmodel.Vector) -> bool:
+    """Check if an array or vector is serialized as protobuf bytes field instead of a repeated uint32 field
+
+    Args:
+        sequence (vafmodel.Array | vafmodel.Vector): The array or vector
+
+    Returns:
+        bool: True for uint8_t elements unless ProtobufBytes is switched off
+    """
+    return sequence.ProtobufBytes and sequence.TypeRef.Name == "uint8_t" and sequence.TypeRef.Namespace == ""
+
+
 def __add_datatype_double_colon(datatype: vafmodel.DataType) -> str:
     return "::" if not datatype.is_base_type else ""
 
@@ -116,6 +128,10 @@ def _get_operation_parameter_list_with_out(operation: vafmodel.Operation) -> str
     return parameter_str
 
 
+def _get_in_parameter_names(operation: vafmodel.Operation, prefix: str) -> str:
+    return ", ".join(prefix + p.Name for p in operation.Parameters if not p.is_direction_out)
+
+
 def _add_namespace_to_import(data_type: vafmodel.DataTypeRef, namespace: str, used_namespaces: List[str]) -> bool:
     return (
         not data_type.is_cpp_base_type
@@ -168,7 +184,7 @@ def _get_namespace_imports(
                         else []
                     )
         # make imports List unique
-        namespace_imports[namespace] = list(set(namespace_imports[namespace]))
+        namespace_imports[namespace] = sorted(set(namespace_imports[namespace]))
 
     return namespace_imports
 
@@ -225,6 +241,7 @@ def _generate_proto_files(
             namespace_data=data,
             len=len,
             data_type_to_proto_type=data_type_to_proto_type,
+            is_bytes_sequence=is_bytes_sequence,
             imports=namespace_imports[namespace],
             verbose_mode=verbose_mode,
         )
@@ -336,6 +353,7 @@ def _generate_transformer_files(
     verbose_mode: bool = False,
 ) -> None:
     generator.set_base_directory(output_path)
+    transformer_files: List[FileHelper] = []
 
     for namespace, data in ModelRuntime().element_by_namespace.items():
         if not namespace:
@@ -343,8 +361,6 @@ def _generate_transformer_files(
 
         includes: List[str] = [
             '#include "protobuf_' + namespace.replace("::", "_") + '.pb.h"',
-            "#include <cstdlib>",
-            '#include "vaf/output_sync_stream.h"',
         ]
         for vector_array_typeref in (
             list(data.get("Arrays", {}).values())
@@ -362,7 +378,7 @@ def _generate_transformer_files(
         for string in data.get("Strings", {}).values():
             if isinstance(string, vafmodel.String):
                 includes.append(_get_impl_type_include(string))
-        for enum in data.get("Enums:", {}).values():
+        for enum in data.get("Enums", {}).values():
             if isinstance(enum, vafmodel.VafEnum):
                 includes.append(_get_impl_type_include(enum))
         for struct in data.get("Structs", {}).values():
@@ -372,16 +388,54 @@ def _generate_transformer_files(
         includes = list(set(includes))
         includes.sort()
 
+        # The transformers are defined out of line, so only the transformer library compiles their definitions
+        transformer_file = FileHelper("protobuf_transformer", "protobuf::" + namespace, False)
+        transformer_files.append(transformer_file)
+        for postfix, template, file_includes in (
+            (".h", "vaf_protobuf/data_type_transformer.jinja", includes),
+            (
+                ".cpp",
+                "vaf_protobuf/data_type_transformer_cpp.jinja",
+                ["#include <algorithm>", "#include <cstdlib>", "#include <type_traits>", "#include <utility>"],
+            ),
+        ):
+            generator.generate_to_file(
+                transformer_file,
+                postfix,
+                template,
+                includes=file_includes,
+                namespace=namespace,
+                proto_namespace=namespace.replace("::", "_"),
+                include_namespace=namespace.replace("::", "/"),
+                namespace_data=data,
+                data_type_to_proto_type=data_type_to_proto_type,
+                is_bytes_sequence=is_bytes_sequence,
+                verbose_mode=verbose_mode,
+            )
+
+        # The codec uses the same VAF types and the codecs of the same namespaces, but no protobuf classes
+        codec_includes = {
+            include.replace("/protobuf_transformer.h", "/protobuf_codec.h")
+            for include in includes
+            if include.startswith('#include "')
+            and not include.endswith('.pb.h"')
+            and "output_sync_stream" not in include
+        }
+        codec_includes |= {
+            '#include "protobuf/wire/codec.h"',
+            "#include <cstddef>",
+            "#include <cstdint>",
+            "#include <utility>",
+        }
+
         generator.generate_to_file(
-            FileHelper("protobuf_transformer", "protobuf::" + namespace, False),
+            FileHelper("protobuf_codec", "protobuf::" + namespace, False),
             ".h",
-            "vaf_protobuf/data_type_transformer.jinja",
-            includes=includes,
+            "vaf_protobuf/data_type_codec.jinja",
+            includes=sorted(codec_includes),
             namespace=namespace,
-            proto_namespace=namespace.replace("::", "_"),
-            include_namespace=namespace.replace("::", "/"),
             namespace_data=data,
-            data_type_to_proto_type=data_type_to_proto_type,
+            is_bytes_sequence=is_bytes_sequence,
             verbose_mode=verbose_mode,
         )
 
@@ -422,12 +476,40 @@ def _generate_transformer_files(
             verbose_mode=verbose_mode,
         )
 
+        generator.generate_to_file(
+            FileHelper(
+                "protobuf_codec",
+                "protobuf::interface::" + interface.Namespace + "::" + interface.Name,
+                False,
+            ),
+            ".h",
+            "vaf_protobuf/interface_codec.jinja",
+            interface=interface,
+            out_parameter_type_namespace=out_parameter_type_namespace,
+            operation_with_out_parameters=operation_with_out_parameters,
+            imports=import_datatype_namespaces,
+            get_operation_parameter_list_with_in=_get_operation_parameter_list_with_in,
+            get_operation_parameter_list_with_out=_get_operation_parameter_list_with_out,
+            get_in_parameter_names=_get_in_parameter_names,
+            add_double_colon=__add_double_colon,
+            add_datatype_double_colon=__add_datatype_double_colon,
+            verbose_mode=verbose_mode,
+        )
+
+    generator.generate_to_file(
+        FileHelper("Codec", "protobuf::wire"),
+        ".h",
+        "vaf_protobuf/wire_codec_h.jinja",
+        verbose_mode=verbose_mode,
+    )
+
     generator.generate_to_file(
         FileHelper("CMakeLists", "", True),
         ".txt",
-        "common/cmake_interface_library.jinja",
+        "common/cmake_library.jinja",
         target_name="vaf_protobuf_transformer",
-        libraries=["vaf_module_interfaces"],
+        files=transformer_files,
+        libraries=["vaf_module_interfaces", "vaf_protobuf"],
         verbose_mode=verbose_mode,
     )
 
@@ -0,0 +1,101 @@
+# Copyright (c) 2024-2026 by Vector Informatik GmbH. All rights reserved.
+# SPDX-License-Identifier: Apache-2.0
+
+"""Generator library for shared memory communication modules."""
+# pylint: disable=duplicate-code
+
+from pathlib import Path
+
+from vaf import vafmodel
+from vaf.core.common.utils import to_snake_case
+
+from .generation import FileHelper, Generator
+
+
+def _generate_modules(
+    modules: list[vafmodel.PlatformModule],
+    kind: str,
+    output_path: Path,
+    generator: Generator,
+    verbose_mode: bool = False,
+) -> None:
+    subdirs: list[str] = []
+
+    for m in modules:
+        if m.OriginalEcoSystem == vafmodel.OriginalEcoSystemEnum.SHM:
+            assert m.ConnectionPointRef
+            assert isinstance(m.ConnectionPointRef, vafmodel.SHMConnectionPoint)
+            subdirs.append(to_snake_case(m.Name))
+            generator.set_base_directory(output_path / f"platform_{kind}_modules" / to_snake_case(m.Name))
+            interface_file = FileHelper(m.ModuleInterfaceRef.Name + kind.capitalize(), m.ModuleInterfaceRef.Namespace)
+            module_file = FileHelper(m.Name, m.Namespace)
+
+            generator.generate_to_file(
+                module_file,
+                ".h",
+                f"vaf_shm/{kind}_module_h.jinja",
+                module=m,
+                interface_file=interface_file,
+                verbose_mode=verbose_mode,
+            )
+
+            generator.generate_to_file(
+                module_file,
+                ".cpp",
+                f"vaf_shm/{kind}_module_cpp.jinja",
+                module=m,
+                segment_name=m.ConnectionPointRef.SegmentName,
+                slot_count=m.ConnectionPointRef.SlotCount,
+                verbose_mode=verbose_mode,
+            )
+
+            generator.generate_to_file(
+                FileHelper("CMakeLists", "", True),
+                ".txt",
+                "vaf_shm/module_cmake.jinja",
+                target_name="vaf_" + to_snake_case(m.Name),
+                files=[module_file],
+                libraries=[
+                    "vaf_core",
+                    "vaf_module_interfaces",
+                    "Threads::Threads",
+                ],
+                verbose_mode=verbose_mode,
+            )
+
+    generator.set_base_directory(output_path / f"platform_{kind}_modules")
+    generator.generate_to_file(
+        FileHelper("CMakeLists", "", True),
+        ".txt",
+        "common/cmake_subdirs.jinja",
+        subdirs=subdirs,
+        verbose_mode=verbose_mode,
+    )
+
+
+def generate(model: vafmodel.MainModel, output_dir: Path, verbose_mode: bool = False) -> None:
+    """Generates the shared memory communication modules
+
+    Args:
+        model (vafmodel.MainModel): The main model
+        output_dir (Path): The output path
+        verbose_mode: flag to enable verbose_mode mode
+    """
+    output_path = output_dir / "src-gen/libs/platform_shm"
+    generator = Generator()
+    _generate_modules(model.PlatformConsumerModules, "consumer", output_path, generator, verbose_mode)
+    _generate_modules(model.PlatformProviderModules, "provider", output_path, generator, verbose_mode)
+
+    subdirs: list[str] = []
+    if model.has_platform_consumers:
+        subdirs.append("platform_consumer_modules")
+    if model.has_platform_providers:
+        subdirs.append("platform_provider_modules")
+    generator.set_base_directory(output_path)
+    generator.generate_to_file(
+        FileHelper("CMakeLists", "", True),
+        ".txt",
+        "common/cmake_subdirs.jinja",
+        subdirs=subdirs,
+        verbose_mode=verbose_mode,
+    )
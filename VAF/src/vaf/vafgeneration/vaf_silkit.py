@@ -15,6 +15,18 @@ from .generation import (
     has_exactly_one_output_parameter,
 )
 
+# Pending calls per operation of a consumer if the connection point does not set RpcMaxInFlight
+_DEFAULT_RPC_MAX_IN_FLIGHT = 16
+# Serialized samples of fewer bytes are sent uncompressed if the data element does not set CompressionThreshold
+_DEFAULT_COMPRESSION_THRESHOLD = 1024
+# Calls that may wait for a dispatched operation handler if the operation does not set HandlerQueueSize
+_DEFAULT_HANDLER_QUEUE_SIZE = 16
+# CMake package and target of the library of each compression
+_COMPRESSION_LIBRARIES = {
+    vafmodel.SampleCompression.LZ4: ("lz4", "lz4::lz4"),
+    vafmodel.SampleCompression.ZSTD: ("zstd", "zstd::libzstd"),
+}
+
 
 # pylint: disable=too-many-branches
 # pylint: disable=too-many-nested-blocks
@@ -63,6 +75,204 @@ def get_data_type_definition_of_parameter(data_type: vafmodel.DataType, model: v
 # pylint: enable=too-many-nested-blocks
 
 
+def is_flat_data_type(data_type: vafmodel.DataType, model: vafmodel.MainModel) -> bool:
+    """Check if a data type has a fixed layout and can be sent over SIL Kit as it is in memory
+
+    Args:
+        data_type (vafmodel.DataType): The data type
+        model (vafmodel.MainModel): The model
+
+    Returns:
+        bool: True for base types, enums and arrays, type refs, structs and vectors, strings and maps with a
+            MaxSize that only consist of these
+    """
+    # pylint: disable=too-many-return-statements, too-many-branches
+    if data_type.is_cpp_base_type:
+        return True
+    if model.DataTypeDefinitions is None:
+        return False
+    definitions = model.DataTypeDefinitions
+
+    def _matches(data: vafmodel.DataType) -> bool:
+        return data_type.Name == data.Name and data_type.Namespace == data.Namespace
+
+    if any(_matches(e) for e in definitions.Enums):
+        return True
+    for a in definitions.Arrays:
+        if _matches(a):
+            return is_flat_data_type(a.TypeRef, model)
+    for t in definitions.TypeRefs:
+        if _matches(t):
+            return is_flat_data_type(t.TypeRef, model)
+    for v in definitions.Vectors:
+        if _matches(v):
+            return v.MaxSize is not None and is_flat_data_type(v.TypeRef, model)
+    for s in definitions.Strings:
+        if _matches(s):
+            return s.MaxSize is not None
+    for m in definitions.Maps:
+        if _matches(m):
+            return (
+                m.MaxSize is not None
+                and is_flat_data_type(m.MapKeyTypeRef, model)
+                and is_flat_data_type(m.MapValueTypeRef, model)
+            )
+    for st in definitions.Structs:
+        if _matches(st):
+            return all(not sub.IsOptional and is_flat_data_type(sub.TypeRef, model) for sub in st.SubElements)
+    return False
+
+
+def get_min_publish_interval(data_element: vafmodel.DataElement) -> str:
+    """Get the minimum interval between two published samples of a data element
+
+    Args:
+        data_element (vafmodel.DataElement): The data element
+
+    Returns:
+        str: The interval as std::chrono duration, zero if the publish rate is not limited
+    """
+    if data_element.MaxPublishRate is None:
+        return "std::chrono::microseconds{ 0 }"
+    return f"std::chrono::microseconds{{ {max(1, round(1_000_000 / data_element.MaxPublishRate))} }}"
+
+
+def get_compression(data_element: vafmodel.DataElement) -> str:
+    """Get the compression of the samples of a data element
+
+    Args:
+        data_element (vafmodel.DataElement): The data element
+
+    Returns:
+        str: The vaf::silkit::Compression enumerator, empty if the samples are not compressed
+    """
+    if data_element.Compression is None:
+        return ""
+    if data_element.Compression == vafmodel.SampleCompression.ZSTD:
+        return "vaf::silkit::Compression::kZstd"
+    return "vaf::silkit::Compression::kLz4"
+
+
+def get_compression_threshold(data_element: vafmodel.DataElement) -> str:
+    """Get the size from which on the samples of a data element are compressed
+
+    Args:
+        data_element (vafmodel.DataElement): The data element
+
+    Returns:
+        str: The size in bytes as C++ literal
+    """
+    threshold = data_element.CompressionThreshold
+    return f"{_DEFAULT_COMPRESSION_THRESHOLD if threshold is None else threshold}U"
+
+
+def get_handler_queue_size(operation: vafmodel.Operation) -> str:
+    """Get the number of calls that may wait for an operation handler with a HandlerDispatch
+
+    Args:
+        operation (vafmodel.Operation): The operation
+
+    Returns:
+        str: The number of calls as C++ literal
+    """
+    queue_size = operation.HandlerQueueSize
+    return f"{_DEFAULT_HANDLER_QUEUE_SIZE if queue_size is None else queue_size}U"
+
+
+def get_delta_layout(data_element: vafmodel.DataElement, model: vafmodel.MainModel) -> str:
+    """Get the layout that the deltas of a data element with DeltaKeyframeInterval are computed over
+
+    Args:
+        data_element (vafmodel.DataElement): The data element
+        model (vafmodel.MainModel): The main model
+
+    Raises:
+        ValueError: If the data element is not of a struct type
+
+    Returns:
+        str: The vaf::silkit::DeltaLayout enumerator, empty if the data element is published as a whole
+    """
+    if data_element.DeltaKeyframeInterval is None:
+        return ""
+    if get_data_type_definition_of_parameter(data_element.TypeRef, model) != "Structs":
+        raise ValueError(
+            f"Data element {data_element.Name} has DeltaKeyframeInterval set, but it is not of a struct type"
+        )
+    if is_flat_data_type(data_element.TypeRef, model):
+        return "vaf::silkit::DeltaLayout::kFlat"
+    return "vaf::silkit::DeltaLayout::kProtobuf"
+
+
+def get_used_compressions(model: vafmodel.MainModel) -> set[vafmodel.SampleCompression]:
+    """Get the compressions of the data elements of the SIL Kit modules
+
+    Args:
+        model (vafmodel.MainModel): The main model
+
+    Returns:
+        set[vafmodel.SampleCompression]: The used compressions
+    """
+    return {
+        de.Compression
+        for m in model.PlatformProviderModules + model.PlatformConsumerModules
+        if m.OriginalEcoSystem == vafmodel.OriginalEcoSystemEnum.SILKIT
+        for de in m.ModuleInterfaceRef.DataElements
+        if de.Compression is not None
+    }
+
+
+def _batches_data_elements(module: vafmodel.PlatformModule, connection_point: vafmodel.SILKITConnectionPoint) -> bool:
+    """Checks if a module sends or receives its data elements in batches
+
+    Args:
+        module (vafmodel.PlatformModule): The platform module
+        connection_point (vafmodel.SILKITConnectionPoint): The connection point of the module
+
+    Returns:
+        bool: True if batching is enabled and the interface has data elements
+    """
+    return bool(connection_point.BatchDataElements) and len(module.ModuleInterfaceRef.DataElements) > 0
+
+
+def _get_used_elements(module: vafmodel.PlatformModule, model: vafmodel.MainModel) -> tuple[set[str], set[str]]:
+    """Gets the data elements and operations of a consumer module used by the application modules mapped to it
+
+    Args:
+        module (vafmodel.PlatformModule): The platform consumer module
+        model (vafmodel.MainModel): The model
+
+    Returns:
+        tuple[set[str], set[str]]: The names of the used data elements and operations. All of them are used if an
+            application module does not list the ones it uses or if the module is not mapped.
+    """
+    all_data_elements = {de.Name for de in module.ModuleInterfaceRef.DataElements}
+    all_operations = {op.Name for op in module.ModuleInterfaceRef.Operations}
+    used_data_elements: set[str] = set()
+    used_operations: set[str] = set()
+    is_mapped = False
+    for executable in model.Executables:
+        for app_module in executable.ApplicationModules:
+            for mapping in app_module.InterfaceInstanceToModuleMappings:
+                if mapping.ModuleRef.Name != module.Name:
+                    continue
+                for consumed in app_module.ApplicationModuleRef.ConsumedInterfaces:
+                    if consumed.InstanceName != mapping.InstanceName:
+                        continue
+                    is_mapped = True
+                    used_data_elements |= (
+                        all_data_elements if consumed.UsedDataElements is None else set(consumed.UsedDataElements)
+                    )
+                    used_operations |= all_operations if consumed.UsedOperations is None else set(consumed.UsedOperations)
+    if not is_mapped:
+        return all_data_elements, all_operations
+
+    # A field is answered from its notifications
+    for op in module.ModuleInterfaceRef.Operations:
+        if op.Name in used_operations and op.FieldNotifier:
+            used_data_elements.add(op.FieldNotifier)
+    return used_data_elements, used_operations
+
+
 def _get_in_parameter_list_comma_separated(operation: vafmodel.Operation) -> str:
     parameter_str = ""
     is_first = True
@@ -96,6 +306,8 @@ def _generate_provider_modules(
             silkit_instance_is_optional = m.ConnectionPointRef.SilkitInstanceIsOptional
             silkit_namespace = m.ConnectionPointRef.SilkitNamespace
             silkit_namespace_is_optional = m.ConnectionPointRef.SilkitNamespaceIsOptional
+            batch_data_elements = _batches_data_elements(m, m.ConnectionPointRef)
+            direct_protobuf_codec = bool(m.ConnectionPointRef.DirectProtobufCodec)
 
             generator.generate_to_file(
                 module_file,
@@ -103,6 +315,12 @@ def _generate_provider_modules(
                 "vaf_silkit/provider_module_h.jinja",
                 module=m,
                 interface_file=interface_file,
+                batch_data_elements=batch_data_elements,
+                direct_protobuf_codec=direct_protobuf_codec,
+                get_min_publish_interval=get_min_publish_interval,
+                get_delta_layout=get_delta_layout,
+                get_handler_queue_size=get_handler_queue_size,
+                model=model,
                 verbose_mode=verbose_mode,
             )
 
@@ -112,12 +330,20 @@ def _generate_provider_modules(
                 "vaf_silkit/provider_module_cpp.jinja",
                 module=m,
                 interface_file=interface_file,
+                batch_data_elements=batch_data_elements,
+                direct_protobuf_codec=direct_protobuf_codec,
+                get_min_publish_interval=get_min_publish_interval,
+                get_compression=get_compression,
+                get_compression_threshold=get_compression_threshold,
+                get_delta_layout=get_delta_layout,
+                get_handler_queue_size=get_handler_queue_size,
                 silkit_instance=silkit_instance,
                 silkit_instance_is_optional=silkit_instance_is_optional,
                 silkit_namespace=silkit_namespace,
                 silkit_namespace_is_optional=silkit_namespace_is_optional,
                 has_exactly_one_output_parameter=has_exactly_one_output_parameter,
                 get_data_type_definition_of_parameter=get_data_type_definition_of_parameter,
+                is_flat_data_type=is_flat_data_type,
                 str=str,
                 model=model,
                 get_in_parameter_list_comma_separated=_get_in_parameter_list_comma_separated,
@@ -135,6 +361,7 @@ def _generate_provider_modules(
                     "vaf_module_interfaces",
                     "vaf_module_interfaces",
                     "SilKit::SilKit",
+                    "vaf_silkit_participant",
                     "vaf_protobuf",
                     "vaf_protobuf_transformer",
                 ],
@@ -173,13 +400,29 @@ def _generate_consumer_modules(
             silkit_instance_is_optional = m.ConnectionPointRef.SilkitInstanceIsOptional
             silkit_namespace = m.ConnectionPointRef.SilkitNamespace
             silkit_namespace_is_optional = m.ConnectionPointRef.SilkitNamespaceIsOptional
+            rpc_max_in_flight = m.ConnectionPointRef.RpcMaxInFlight or _DEFAULT_RPC_MAX_IN_FLIGHT
+            rpc_timeout = m.ConnectionPointRef.RpcTimeout
+            used_data_elements, used_operations = _get_used_elements(m, model)
+            batch_data_elements = _batches_data_elements(m, m.ConnectionPointRef) and len(used_data_elements) > 0
+            direct_protobuf_codec = bool(m.ConnectionPointRef.DirectProtobufCodec)
+            lazy_deserialization = bool(m.ConnectionPointRef.LazyDeserialization)
 
             generator.generate_to_file(
                 module_file,
                 ".h",
                 "vaf_silkit/consumer_module_h.jinja",
                 module=m,
+                used_data_elements=used_data_elements,
+                used_operations=used_operations,
+                batch_data_elements=batch_data_elements,
+                direct_protobuf_codec=direct_protobuf_codec,
+                lazy_deserialization=lazy_deserialization,
                 interface_file=interface_file,
+                rpc_max_in_flight=rpc_max_in_flight,
+                rpc_timeout=rpc_timeout,
+                get_delta_layout=get_delta_layout,
+                is_flat_data_type=is_flat_data_type,
+                model=model,
                 verbose_mode=verbose_mode,
             )
 
@@ -188,12 +431,21 @@ def _generate_consumer_modules(
                 ".cpp",
                 "vaf_silkit/consumer_module_cpp.jinja",
                 module=m,
+                used_data_elements=used_data_elements,
+                used_operations=used_operations,
+                batch_data_elements=batch_data_elements,
+                direct_protobuf_codec=direct_protobuf_codec,
+                lazy_deserialization=lazy_deserialization,
+                rpc_timeout=rpc_timeout,
+                get_compression=get_compression,
+                get_delta_layout=get_delta_layout,
                 silkit_instance=silkit_instance,
                 silkit_instance_is_optional=silkit_instance_is_optional,
                 silkit_namespace=silkit_namespace,
                 silkit_namespace_is_optional=silkit_namespace_is_optional,
                 has_exactly_one_output_parameter=has_exactly_one_output_parameter,
                 get_data_type_definition_of_parameter=get_data_type_definition_of_parameter,
+                is_flat_data_type=is_flat_data_type,
                 str=str,
                 model=model,
                 get_in_parameter_list_comma_separated=_get_in_parameter_list_comma_separated,
@@ -210,6 +462,7 @@ def _generate_consumer_modules(
                     "vaf_core",
                     "vaf_module_interfaces",
                     "SilKit::SilKit",
+                    "vaf_silkit_participant",
                     "vaf_protobuf",
                     "vaf_protobuf_transformer",
                 ],
@@ -226,6 +479,126 @@ def _generate_consumer_modules(
     )
 
 
+def _generate_participant(
+    model: vafmodel.MainModel,
+    output_path: Path,
+    generator: Generator,
+    verbose_mode: bool = False,
+) -> None:
+    generator.set_base_directory(output_path / "participant")
+    participant_file = FileHelper("Participant", "vaf::silkit")
+    files = [participant_file]
+    packages: list[str] = []
+    libraries = ["vaf_core", "SilKit::SilKit"]
+
+    generator.generate_to_file(
+        participant_file,
+        ".h",
+        "vaf_silkit/participant_h.jinja",
+        verbose_mode=verbose_mode,
+    )
+
+    generator.generate_to_file(
+        participant_file,
+        ".cpp",
+        "vaf_silkit/participant_cpp.jinja",
+        verbose_mode=verbose_mode,
+    )
+
+    generator.generate_to_file(
+        FileHelper("SerializationBuffer", "vaf::silkit"),
+        ".h",
+        "vaf_silkit/serialization_buffer_h.jinja",
+        verbose_mode=verbose_mode,
+    )
+
+    generator.generate_to_file(
+        FileHelper("FlatWireFormat", "vaf::silkit"),
+        ".h",
+        "vaf_silkit/flat_wire_format_h.jinja",
+        verbose_mode=verbose_mode,
+    )
+
+    generator.generate_to_file(
+        FileHelper("ReceptionArena", "vaf::silkit"),
+        ".h",
+        "vaf_silkit/reception_arena_h.jinja",
+        verbose_mode=verbose_mode,
+    )
+
+    generator.generate_to_file(
+        FileHelper("LazySample", "vaf::silkit"),
+        ".h",
+        "vaf_silkit/lazy_sample_h.jinja",
+        verbose_mode=verbose_mode,
+    )
+
+    generator.generate_to_file(
+        FileHelper("SampleBatch", "vaf::silkit"),
+        ".h",
+        "vaf_silkit/sample_batch_h.jinja",
+        verbose_mode=verbose_mode,
+    )
+
+    generator.generate_to_file(
+        FileHelper("PublishThrottle", "vaf::silkit"),
+        ".h",
+        "vaf_silkit/publish_throttle_h.jinja",
+        verbose_mode=verbose_mode,
+    )
+
+    generator.generate_to_file(
+        FileHelper("SampleDelta", "vaf::silkit"),
+        ".h",
+        "vaf_silkit/sample_delta_h.jinja",
+        verbose_mode=verbose_mode,
+    )
+
+    generator.generate_to_file(
+        FileHelper("PendingCalls", "vaf::silkit"),
+        ".h",
+        "vaf_silkit/pending_calls_h.jinja",
+        verbose_mode=verbose_mode,
+    )
+
+    generator.generate_to_file(
+        FileHelper("RpcDispatch", "vaf::silkit"),
+        ".h",
+        "vaf_silkit/rpc_dispatch_h.jinja",
+        verbose_mode=verbose_mode,
+    )
+
+    # The compression is only built with the libraries of the algorithms the data elements use
+    compressions = get_used_compressions(model)
+    if compressions:
+        compression_file = FileHelper("SampleCompression", "vaf::silkit")
+        for suffix in (".h", ".cpp"):
+            generator.generate_to_file(
+                compression_file,
+                suffix,
+                f"vaf_silkit/sample_compression_{suffix[1:]}.jinja",
+                lz4=vafmodel.SampleCompression.LZ4 in compressions,
+                zstd=vafmodel.SampleCompression.ZSTD in compressions,
+                verbose_mode=verbose_mode,
+            )
+        files.append(compression_file)
+        for compression in sorted(compressions):
+            package, library = _COMPRESSION_LIBRARIES[compression]
+            packages.append(package)
+            libraries.append(library)
+
+    generator.generate_to_file(
+        FileHelper("CMakeLists", "", True),
+        ".txt",
+        "vaf_silkit/module_cmake.jinja",
+        target_name="vaf_silkit_participant",
+        files=files,
+        packages=packages,
+        libraries=libraries,
+        verbose_mode=verbose_mode,
+    )
+
+
 # pylint: disable=too-many-locals
 def generate(model: vafmodel.MainModel, output_dir: Path, verbose_mode: bool = False) -> None:
     """Generates the middleware wrappers for silkit
@@ -242,8 +615,10 @@ def generate(model: vafmodel.MainModel, output_dir: Path, verbose_mode: bool = F
     generator = Generator()
     _generate_consumer_modules(model, output_path, generator, verbose_mode)
     _generate_provider_modules(model, output_path, generator, verbose_mode)
+    _generate_participant(model, output_path, generator, verbose_mode)
 
-    subdirs: list[str] = []
+    # The participant is shared by all SIL Kit modules of an executable
+    subdirs: list[str] = ["participant"]
     if model.has_platform_consumers:
         subdirs.append("platform_consumer_modules")
     if model.has_platform_providers:
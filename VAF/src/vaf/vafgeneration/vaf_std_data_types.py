@@ -19,6 +19,34 @@ def _get_file_helper(data_type: vafmodel.DataType) -> FileHelper:
     return FileHelper(data_type.Name, data_type.Namespace)
 
 
+def _get_struct_of_arrays_element(vaf_vector: vafmodel.Vector) -> vafmodel.Struct | None:
+    """Gets the struct whose members are the columns of a vector with StructOfArrays
+
+    Args:
+        vaf_vector (vafmodel.Vector): The vector
+
+    Raises:
+        ValueError: If the elements of the vector are not of a struct type with members
+
+    Returns:
+        vafmodel.Struct | None: The element struct, None if the vector is not in a structure-of-arrays layout
+    """
+    if not vaf_vector.StructOfArrays:
+        return None
+    element = (
+        ModelRuntime()
+        .element_by_namespace.get(vaf_vector.TypeRef.Namespace, {})
+        .get("Structs", {})
+        .get(vaf_vector.TypeRef.Name)
+    )
+    if not isinstance(element, vafmodel.Struct) or not element.SubElements:
+        raise ValueError(
+            f"Vector {vaf_vector.Namespace}::{vaf_vector.Name} has StructOfArrays set, "
+            "but its elements are not of a struct type with members"
+        )
+    return element
+
+
 # pylint: disable-next=too-many-locals,too-many-branches
 def generate(output_dir: Path, verbose_mode: bool = False) -> None:
     """Generate VAF data types
@@ -79,7 +107,7 @@ def generate(output_dir: Path, verbose_mode: bool = False) -> None:
             includes: list[str] = []
             for sub in vaf_struct.SubElements:
                 includes.append(get_data_type_include(sub.TypeRef))
-            includes = list(set(includes))
+            includes = sorted(set(includes))
             if "" in includes:
                 includes.remove("")
             generator.generate_to_file(
@@ -108,8 +136,13 @@ def generate(output_dir: Path, verbose_mode: bool = False) -> None:
             generator.generate_to_file(
                 FileHelper("impl_type_" + vaf_vector.Name.lower(), namespace),
                 ".h",
-                "vaf_std_data_types/vector_h.jinja",
+                (
+                    "vaf_std_data_types/struct_of_arrays_h.jinja"
+                    if vaf_vector.StructOfArrays
+                    else "vaf_std_data_types/vector_h.jinja"
+                ),
                 vaf_vector=vaf_vector,
+                vaf_struct=_get_struct_of_arrays_element(vaf_vector),
                 get_file_helper=_get_file_helper,
                 get_data_type_include=get_data_type_include,
                 verbose_mode=verbose_mode,
@@ -726,7 +726,7 @@ def _convert_ifex_property_to_vaf_operations(
     name, ns = _split_type_name(vaf_type)
     type_ref = vafmodel.DataType(Name=name, Namespace=ns.lower())
 
-    # Create getter operation: Get<PropertyName>() -> value
+    # Create getter operation: Get<PropertyName>() -> value, answered from the data element of the property
     getter = vafmodel.Operation(
         Name=f"Get{ifex_property.name}",
         Parameters=[
@@ -736,6 +736,7 @@ def _convert_ifex_property_to_vaf_operations(
                 Direction=vafmodel.ParameterDirection.OUT,
             )
         ],
+        FieldNotifier=ifex_property.name,
     )
 
     # Create setter operation: Set<PropertyName>(value) -> void
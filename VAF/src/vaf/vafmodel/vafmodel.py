@@ -3,12 +3,17 @@
 
 """Base data model library of Vehicle Application Framework"""  # pylint: disable=too-many-lines
 
+import hashlib
 import json
+import os
+import pickle
+import sys
 from collections import OrderedDict
 from enum import Enum
 from pathlib import Path
 from typing import Any, Callable, Dict, List, Literal, Optional, Union, get_origin
 
+import pydantic
 from pydantic import (
     BaseModel,
     Field,
@@ -114,6 +119,76 @@ base_types = [
 
 data_types = ["Strings", "Enums", "Arrays", "Vectors", "Maps", "Structs", "TypeRefs", "Variants"]
 
+# Key of the ModelIndex in the validation context of load_json
+MODEL_INDEX_KEY = "__vaf_model_index__"
+
+
+class ModelIndex:
+    """Name to element indices of a raw model, built once per load so that references resolve without scanning the
+    model. The referenced elements are validated once and shared by all references to them.
+    """
+
+    def __init__(self, raw_model: Dict[str, Any]) -> None:
+        self.data_type_names: set[str] = set()
+        for data_type in data_types:
+            for element in (raw_model.get("DataTypeDefinitions") or {}).get(data_type) or []:
+                self.data_type_names.add(element["Name"])
+        self.module_interfaces: Dict[str, Dict[str, Any]] = {}
+        for m in raw_model.get("ModuleInterfaces", []):
+            self.module_interfaces.setdefault(m["Namespace"] + "::" + m["Name"], m)
+        self.application_modules: Dict[str, Dict[str, Any]] = {}
+        for m in raw_model.get("ApplicationModules", []):
+            self.application_modules.setdefault(m["Namespace"] + "::" + m["Name"], m)
+        self.platform_modules: Dict[str, Dict[str, Any]] = {}
+        platform_modules = raw_model.get("PlatformConsumerModules", []) + raw_model.get("PlatformProviderModules", [])
+        for e in raw_model.get("Executables", []):
+            platform_modules = platform_modules + e.get("InternalCommunicationModules", [])
+        for m in platform_modules:
+            self.platform_modules.setdefault(m["Namespace"] + "::" + m["Name"], m)
+        self.connection_points: Dict[str, tuple[str, Dict[str, Any]]] = {}
+        for configuration, cls in (
+            ("SILKITAdditionalConfiguration", "SILKITConnectionPoint"),
+            ("SHMAdditionalConfiguration", "SHMConnectionPoint"),
+            ("RecordingAdditionalConfiguration", "RecordingConnectionPoint"),
+        ):
+            for m in (raw_model.get(configuration) or {}).get("ConnectionPoints", []):
+                self.connection_points.setdefault(m["Name"], (cls, m))
+        self._validated: Dict[tuple[str, str], Any] = {}
+
+    def validated(self, kind: str, key: str, cls: type[BaseModel], raw: Dict[str, Any], context: Dict[str, Any]) -> Any:
+        """Validates a referenced element on its first reference
+
+        Args:
+            kind (str): The kind of the element, so equal names of different kinds do not collide
+            key (str): The reference of the element
+            cls (type[BaseModel]): The model class of the element
+            raw (Dict[str, Any]): The raw element
+            context (Dict[str, Any]): The validation context
+
+        Returns:
+            The validated element
+        """
+        if (kind, key) not in self._validated:
+            self._validated[(kind, key)] = cls.model_validate(raw, context=context)
+        return self._validated[(kind, key)]
+
+
+def get_model_index(context: Any) -> ModelIndex:
+    """Returns the index of the model that is validated
+
+    Args:
+        context: The validation context, the raw model and its index
+
+    Returns:
+        ModelIndex: The index of load_json or an index of the raw model if the context has none
+    """
+    assert isinstance(context, dict)
+    index = context.get(MODEL_INDEX_KEY)
+    if index is None:
+        index = ModelIndex(context)
+    return index
+
+
 
 def validate_type_ref(raw: str | DataType, info: ValidationInfo) -> DataType:
     """Validates a data type reference.
@@ -139,13 +214,8 @@ def validate_type_ref(raw: str | DataType, info: ValidationInfo) -> DataType:
     if (len(namespace) == 0 or namespace == "std") and name in base_types:
         return DataType(Name=name, Namespace=namespace)
 
-    assert isinstance(info.context, dict)
-    data_type_definition = info.context["DataTypeDefinitions"]
-    for data_type in data_types:
-        if data_type in data_type_definition and data_type_definition[data_type] is not None:
-            for element in data_type_definition[data_type]:
-                if element["Name"] == name:
-                    return DataType(Name=name, Namespace=namespace)
+    if name in get_model_index(info.context).data_type_names:
+        return DataType(Name=name, Namespace=namespace)
 
     raise ModelReferenceError("Reference not found: " + raw)
 
@@ -169,10 +239,19 @@ class BaseType(str, Enum):
 
 class OriginalEcoSystemEnum(str, Enum):
     SILKIT = "SILKIT"
+    SHM = "SHM"
+    RECORDING = "RECORDING"
 
 
 class String(DataType):
-    pass
+    MaxSize: Annotated[
+        Optional[int],
+        Field(
+            ge=1,
+            description="Maximum number of characters. The string is generated as a container with inline storage of \
+                        this capacity instead of one that allocates on the heap, characters beyond it are dropped.",
+        ),
+    ] = None
 
 
 class EnumLiteral(VafBaseModel):
@@ -189,15 +268,61 @@ class VafEnum(DataType):
 class Array(DataType):
     TypeRef: DataTypeRef
     Size: int
+    ProtobufBytes: Annotated[
+        bool,
+        Field(
+            description="Elements of type uint8_t are serialized as protobuf bytes field and copied in one go. \
+                        False keeps the repeated uint32 field of earlier versions for existing consumers of the \
+                        .proto files and persisted values.",
+        ),
+    ] = True
     _validate_TypeRef = field_validator("TypeRef", mode="before")(validate_type_ref)
 
 
+class MapContainer(str, Enum):
+    """Enum of the containers a map is generated as"""
+
+    TREE = "Tree"
+    FLAT_SORTED = "FlatSorted"
+    HASH = "Hash"
+
+
 class Map(DataType):
     MapKeyTypeRef: DataTypeRef
     MapValueTypeRef: DataTypeRef
+    MaxSize: Annotated[
+        Optional[int],
+        Field(
+            ge=1,
+            description="Maximum number of entries. The map is generated as a container with inline storage of \
+                        this capacity instead of one that allocates on the heap, entries beyond it are dropped.",
+        ),
+    ] = None
+    Container: Annotated[
+        Optional[MapContainer],
+        Field(
+            description="Container of the map: Tree for a std::map, FlatSorted for entries sorted in one vector, \
+                        Hash for an open addressing hash map on one vector that iterates in insertion order and needs \
+                        a vaf::hash of the key type. Defaults to Tree, or to the inline storage if MaxSize is set.",
+        ),
+    ] = None
     _validate_MapKeyTypeRef = field_validator("MapKeyTypeRef", mode="before")(validate_type_ref)
     _validate_MapValueTypeRef = field_validator("MapValueTypeRef", mode="before")(validate_type_ref)
 
+    @model_validator(mode="after")
+    def check_container(self) -> Self:
+        """Checks that a map with inline storage keeps its entries sorted
+
+        Raises:
+            ValueError: Raised if the container does not allocate and MaxSize is set
+
+        Returns:
+            The Map
+        """
+        if self.MaxSize is not None and self.Container not in (None, MapContainer.FLAT_SORTED):
+            raise ValueError(f"Map {self.Name} with a MaxSize is sorted in its inline storage and takes no Container")
+        return self
+
 
 class TypeRef(DataType):
     TypeRef: DataTypeRef
@@ -221,6 +346,30 @@ class Struct(DataType):
 class Vector(DataType):
     Name: str
     TypeRef: DataTypeRef
+    MaxSize: Annotated[
+        Optional[int],
+        Field(
+            ge=1,
+            description="Maximum number of elements. The vector is generated as a container with inline storage of \
+                        this capacity instead of one that allocates on the heap, elements beyond it are dropped.",
+        ),
+    ] = None
+    ProtobufBytes: Annotated[
+        bool,
+        Field(
+            description="Elements of type uint8_t are serialized as protobuf bytes field and copied in one go. \
+                        False keeps the repeated uint32 field of earlier versions for existing consumers of the \
+                        .proto files and persisted values.",
+        ),
+    ] = True
+    StructOfArrays: Annotated[
+        bool,
+        Field(
+            description="Elements of a struct type are stored in a structure-of-arrays layout, one vector per member \
+                        of the struct. The generated container keeps the element access of a vector through proxies \
+                        and loops over a single member read it contiguously.",
+        ),
+    ] = False
     _validate_TypeRef = field_validator("TypeRef", mode="before")(validate_type_ref)
 
 
@@ -423,10 +572,97 @@ class DataTypeDefinition(VafBaseModel):
                 setattr(self, data_type, current_data + new_data)
 
 
+class HandlerQueuePolicy(str, Enum):
+    """Enum of the strategies if the handler queue of a data element is full"""
+
+    DROP_OLDEST = "DropOldest"
+    DROP_NEWEST = "DropNewest"
+    BLOCK = "Block"
+
+
+class OperationHandlerDispatch(str, Enum):
+    """Enum of the threads that run the operation handler of a SIL Kit provider module"""
+
+    EXECUTOR = "Executor"
+    WORKER_POOL = "WorkerPool"
+
+
+class SampleCompression(str, Enum):
+    """Enum of the algorithms that compress the samples of a data element sent over SIL Kit"""
+
+    LZ4 = "LZ4"
+    ZSTD = "Zstd"
+
+
 class DataElement(VafBaseModel):
     Name: str
     TypeRef: DataTypeRef
     InitialValue: Optional[str] = None
+    SamplePoolSize: Annotated[
+        Optional[int],
+        Field(
+            ge=1,
+            description="Number of preallocated samples of the data element. Allocated samples are recycled once \
+                        the last reader releases them, so publishing does not allocate heap memory.",
+        ),
+    ] = None
+    HistoryDepth: Annotated[
+        Optional[int],
+        Field(
+            ge=1,
+            description="Number of latest samples of the data element that are kept for consumers, which read all \
+                        samples published since their last read with GetAllocatedHistory_<element>.",
+        ),
+    ] = None
+    HandlerQueueSize: Annotated[
+        Optional[int],
+        Field(
+            ge=1,
+            description="Number of samples queued per data element handler. If set, the handlers are called by an \
+                        event-driven task of the subscribing module instead of by the provider.",
+        ),
+    ] = None
+    HandlerQueueOverflowPolicy: Annotated[
+        Optional[HandlerQueuePolicy],
+        Field(description="Behavior if a handler queue is full. Defaults to DropOldest."),
+    ] = None
+    PublishOnChange: Optional[bool] = Field(
+        default=None,
+        description="Skips publishing a sample that equals the last published one. Used by SIL Kit provider modules.",
+    )
+    MaxPublishRate: Annotated[
+        Optional[float],
+        Field(
+            gt=0,
+            description="Maximum number of samples published per second. Samples set faster are held back and the \
+                        latest one is published once the interval has passed. Used by SIL Kit provider modules.",
+        ),
+    ] = None
+    Compression: Annotated[
+        Optional[SampleCompression],
+        Field(
+            description="Compresses the serialized samples sent over SIL Kit, e.g. camera images between the hosts \
+                        of a distributed co-simulation. Providers and consumers of an interface instance only match \
+                        if both use the same setting.",
+        ),
+    ] = None
+    CompressionThreshold: Annotated[
+        Optional[int],
+        Field(
+            ge=0,
+            description="Serialized samples smaller than this number of bytes are sent uncompressed, 1024 if not \
+                        set. Samples that do not get smaller are also sent uncompressed.",
+        ),
+    ] = None
+    DeltaKeyframeInterval: Annotated[
+        Optional[int],
+        Field(
+            ge=1,
+            description="Publishes the samples of a struct over SIL Kit as the members that differ from the last \
+                        full sample, which is sent every this number of samples. Providers and consumers of an \
+                        interface instance only match if both use the setting.",
+        ),
+    ] = None
     _validate_TypeRef = field_validator("TypeRef", mode="before")(validate_type_ref)
 
 
@@ -470,6 +706,48 @@ class Parameter(VafBaseModel):
 class Operation(VafBaseModel):
     Name: str
     Parameters: list[Parameter] = []
+    FieldNotifier: Optional[str] = Field(
+        default=None,
+        description="Name of the data element of the interface that notifies the value this operation gets, e.g. \
+                     X_FieldNotifier for the getter X_FieldGetter of a field. Consumers answer the operation from \
+                     the latest notified value and only call the provider until the first one is received. The \
+                     operation has no in parameters and one out parameter of the type of the data element.",
+    )
+    HandlerDispatch: Annotated[
+        Optional[OperationHandlerDispatch],
+        Field(
+            description="Runs the handler of a SIL Kit provider module in the executor of the module or in worker \
+                        threads of the operation instead of in the SIL Kit thread that received the call.",
+        ),
+    ] = None
+    HandlerConcurrency: Annotated[
+        Optional[int],
+        Field(ge=1, description="Number of worker threads with the WorkerPool dispatch, 1 if not set."),
+    ] = None
+    HandlerQueueSize: Annotated[
+        Optional[int],
+        Field(
+            ge=1,
+            description="Number of calls that may wait for the handler with a dispatch, 16 if not set. Further calls \
+                        are not answered and fail at the consumer once they time out.",
+        ),
+    ] = None
+
+    @model_validator(mode="after")
+    def check_handler_dispatch(self) -> Self:
+        """Checks that the handler settings are only used with a dispatch that supports them
+
+        Raises:
+            ValueError: Raised if a setting is used without a matching dispatch
+
+        Returns:
+            The Operation
+        """
+        if self.HandlerConcurrency is not None and self.HandlerDispatch is not OperationHandlerDispatch.WORKER_POOL:
+            raise ValueError(f"HandlerConcurrency of operation {self.Name} needs the WorkerPool dispatch")
+        if self.HandlerQueueSize is not None and self.HandlerDispatch is None:
+            raise ValueError(f"HandlerQueueSize of operation {self.Name} needs a HandlerDispatch")
+        return self
 
     @property
     def has_any_parameter_in(self) -> bool:
@@ -539,6 +817,35 @@ class ModuleInterface(VafBaseModel):
         ),
     ] = []
 
+    @model_validator(mode="after")
+    def check_field_notifiers(self) -> Self:
+        """Checks that the operations answered from a field notifier match its data element
+
+        Raises:
+            ValueError: Raised if the data element does not exist or does not match the parameters
+
+        Returns:
+            The Module Interface
+        """
+        for op in self.Operations:
+            if op.FieldNotifier is None:
+                continue
+            de = next((d for d in self.DataElements if d.Name == op.FieldNotifier), None)
+            if de is None:
+                raise ValueError(
+                    f"Field notifier {op.FieldNotifier} of operation {op.Name} is no data element of {self.Name}"
+                )
+            if (
+                len(op.Parameters) != 1
+                or not op.Parameters[0].is_direction_out
+                or (op.Parameters[0].TypeRef.Namespace, op.Parameters[0].TypeRef.Name)
+                != (de.TypeRef.Namespace, de.TypeRef.Name)
+            ):
+                raise ValueError(
+                    f"Operation {op.Name} needs exactly one out parameter of the type of its field notifier {de.Name}"
+                )
+        return self
+
     def __hash__(self) -> int:
         return hash(repr(self))
 
@@ -576,10 +883,9 @@ def resolve_module_interface_ref(raw: str | ModuleInterface, info: ValidationInf
         ModuleInterface: The module interface.
     """
     if isinstance(raw, str):
-        assert isinstance(info.context, dict)
-        for m in info.context["ModuleInterfaces"]:
-            if m["Namespace"] + "::" + m["Name"] == raw:
-                return ModuleInterface.model_validate(m, context=info.context)
+        index = get_model_index(info.context)
+        if raw in index.module_interfaces:
+            return index.validated("ModuleInterface", raw, ModuleInterface, index.module_interfaces[raw], info.context)
         raise ModelReferenceError("Reference not found: " + raw)
     return raw
 
@@ -622,14 +928,15 @@ def resolve_data_element_ref(raw: str | DataElementRef, info: ValidationInfo) ->
         DataElementRef: The data element reference.
     """
     if isinstance(raw, str):
-        assert isinstance(info.context, dict)
-        for m in info.context["ModuleInterfaces"]:
-            if m["Namespace"] + "::" + m["Name"] == "::".join(raw.split("::")[:-1]):
-                for d in m["DataElements"]:
-                    if d["Name"] == raw.split("::")[-1]:
-                        de = DataElement.model_validate(d, context=info.context)
-                        mi = ModuleInterface.model_validate(m, context=info.context)
-                        return DataElementRef(DataElement=de, ModuleInterface=mi)
+        index = get_model_index(info.context)
+        interface_ref, _, name = raw.rpartition("::")
+        if interface_ref in index.module_interfaces:
+            m = index.module_interfaces[interface_ref]
+            for d in m["DataElements"]:
+                if d["Name"] == name:
+                    de = index.validated("DataElement", raw, DataElement, d, info.context)
+                    mi = index.validated("ModuleInterface", interface_ref, ModuleInterface, m, info.context)
+                    return DataElementRef(DataElement=de, ModuleInterface=mi)
         raise ModelReferenceError("Reference not found: " + raw)
     return raw
 
@@ -672,14 +979,15 @@ def resolve_operation_ref(raw: str | OperationRef, info: ValidationInfo) -> Oper
         OperationRef: The OperationRef.
     """
     if isinstance(raw, str):
-        assert isinstance(info.context, dict)
-        for m in info.context["ModuleInterfaces"]:
-            if m["Namespace"] + "::" + m["Name"] == "::".join(raw.split("::")[:-1]):
-                for o in m["Operations"]:
-                    if o["Name"] == raw.split("::")[-1]:
-                        o = Operation.model_validate(o, context=info.context)
-                        mi = ModuleInterface.model_validate(m, context=info.context)
-                        return OperationRef(Operation=o, ModuleInterface=mi)
+        index = get_model_index(info.context)
+        interface_ref, _, name = raw.rpartition("::")
+        if interface_ref in index.module_interfaces:
+            m = index.module_interfaces[interface_ref]
+            for o in m["Operations"]:
+                if o["Name"] == name:
+                    op = index.validated("Operation", raw, Operation, o, info.context)
+                    mi = index.validated("ModuleInterface", interface_ref, ModuleInterface, m, info.context)
+                    return OperationRef(Operation=op, ModuleInterface=mi)
         raise ModelReferenceError("Reference not found: " + raw)
     return raw
 
@@ -694,8 +1002,38 @@ class ApplicationModuleConsumedInterface(VafBaseModel):
     InstanceName: str
     ModuleInterfaceRef: ModuleInterfaceRefType
     IsOptional: bool = False
+    UsedDataElements: Optional[list[str]] = Field(
+        default=None,
+        description="The data elements the application module reads or handles, all if not set. Platform modules \
+                    only subscribe to the data elements used by one of the application modules mapped to them.",
+    )
+    UsedOperations: Optional[list[str]] = Field(
+        default=None,
+        description="The operations the application module calls, all if not set. Platform modules only create \
+                    the clients of the operations used by one of the application modules mapped to them.",
+    )
     _resolve_ModuleInterfaceRef = field_validator("ModuleInterfaceRef", mode="before")(resolve_module_interface_ref)
 
+    @model_validator(mode="after")
+    def check_used_elements(self) -> Self:
+        """Checks that the used data elements and operations are part of the interface
+
+        Raises:
+            ValueError: Raised if a used data element or operation is not part of the interface
+
+        Returns:
+            The ApplicationModuleConsumedInterface
+        """
+        data_elements = {de.Name for de in self.ModuleInterfaceRef.DataElements}
+        for name in self.UsedDataElements or []:
+            if name not in data_elements:
+                raise ValueError(f"Used data element {name} of {self.InstanceName} is not part of its interface")
+        operations = {op.Name for op in self.ModuleInterfaceRef.Operations}
+        for name in self.UsedOperations or []:
+            if name not in operations:
+                raise ValueError(f"Used operation {name} of {self.InstanceName} is not part of its interface")
+        return self
+
 
 class SILKITConnectionPoint(VafBaseModel):
     Name: str
@@ -707,6 +1045,28 @@ class SILKITConnectionPoint(VafBaseModel):
     SilkitNamespaceIsOptional: Optional[bool] = Field(
         default=None, description="Indicates if the SIL Kit Namespace is optional or mandatory for discovery"
     )
+    RpcMaxInFlight: Annotated[
+        Optional[int],
+        Field(ge=1, le=65535, description="Maximum number of pending calls per operation of a consumer, 16 if not set"),
+    ] = None
+    RpcTimeout: Optional[str] = Field(
+        default=None, description="Time after which a pending call fails, e.g. 100ms. Calls do not time out if not set"
+    )
+    BatchDataElements: Optional[bool] = Field(
+        default=None,
+        description="Sends the data elements set within one executor time slot as one message. Providers and \
+                    consumers of an interface instance only match if both use the same setting.",
+    )
+    DirectProtobufCodec: Optional[bool] = Field(
+        default=None,
+        description="Encodes and decodes the protobuf messages directly from and to the VAF types, without protobuf \
+                    objects in between. The messages stay the same, so providers and consumers need not match.",
+    )
+    LazyDeserialization: Optional[bool] = Field(
+        default=None,
+        description="Keeps the received samples of a consumer serialized until they are read or a handler of an \
+                    active module is called with them, so samples that are overwritten unread are never parsed.",
+    )
 
 
 class SILKITAdditionalConfigurationType(VafBaseModel):
@@ -715,11 +1075,49 @@ class SILKITAdditionalConfigurationType(VafBaseModel):
     )
 
 
-def serialize_connection_point_ref(m: SILKITConnectionPoint) -> str:
+class SHMConnectionPoint(VafBaseModel):
+    Name: str
+    SegmentName: str = Field(
+        description="Name of the POSIX shared memory segments of the Platform Module, one per data element"
+    )
+    SlotCount: Annotated[
+        Optional[int],
+        Field(ge=2, description="Number of sample slots of the ring in each shared memory segment"),
+    ] = None
+
+
+class SHMAdditionalConfigurationType(VafBaseModel):
+    ConnectionPoints: list[SHMConnectionPoint] = Field(
+        description="A connection point in shared memory maps a platform module to its segments."
+    )
+
+
+class RecordingConnectionPoint(VafBaseModel):
+    Name: str
+    FilePath: str = Field(
+        description="Path of the recording, written by a platform provider module and read by a platform consumer module"
+    )
+    ReplaySpeed: Annotated[
+        Optional[float],
+        Field(
+            gt=0,
+            description="Pace of the replay relative to the recording, e.g. 1.0 for real time. The consumer replays \
+                        as fast as its handlers run if not set",
+        ),
+    ] = None
+
+
+class RecordingAdditionalConfigurationType(VafBaseModel):
+    ConnectionPoints: list[RecordingConnectionPoint] = Field(
+        description="A connection point of a recording maps a platform module to its file."
+    )
+
+
+def serialize_connection_point_ref(m: SILKITConnectionPoint | SHMConnectionPoint | RecordingConnectionPoint) -> str:
     """Serializes a ConnectionPoint reference
 
     Args:
-        m (SILKITConnectionPoint): The ConnectionPoint
+        m (SILKITConnectionPoint | SHMConnectionPoint | RecordingConnectionPoint): The ConnectionPoint
 
     Returns:
         str: The ConnectionPoint reference
@@ -728,19 +1126,19 @@ def serialize_connection_point_ref(m: SILKITConnectionPoint) -> str:
 
 
 ConnectionPointRefType = Annotated[
-    Optional[SILKITConnectionPoint],
+    Optional[SILKITConnectionPoint | SHMConnectionPoint | RecordingConnectionPoint],
     WithJsonSchema({"type": "string"}),
     PlainSerializer(serialize_connection_point_ref, return_type=str),
 ]
 
 
 def resolve_connection_point_ref(
-    raw: str | None | SILKITConnectionPoint, info: ValidationInfo
-) -> SILKITConnectionPoint | None:
+    raw: str | None | SILKITConnectionPoint | SHMConnectionPoint | RecordingConnectionPoint, info: ValidationInfo
+) -> SILKITConnectionPoint | SHMConnectionPoint | RecordingConnectionPoint | None:
     """Resolves a ConnectionPoint reference
 
     Args:
-        raw (str | None | SILKITConnectionPoint): A ConnectionPoint
+        raw (str | None | SILKITConnectionPoint | SHMConnectionPoint | RecordingConnectionPoint): A ConnectionPoint
           reference or a ConnectionPoint
         info (ValidationInfo): The validation info.
 
@@ -748,17 +1146,21 @@ def resolve_connection_point_ref(
         ModelReferenceError: If the reference was not found.
 
     Returns:
-        SILKITConnectionPoint | None: The ConnectionPoint or None if the
+        SILKITConnectionPoint | SHMConnectionPoint | RecordingConnectionPoint | None: The ConnectionPoint or None if the
           input was None
     """
     if raw is None:
         return raw
     if isinstance(raw, str):
-        assert isinstance(info.context, dict)
-        if "SILKITAdditionalConfiguration" in info.context and info.context["SILKITAdditionalConfiguration"]:
-            for m in info.context["SILKITAdditionalConfiguration"]["ConnectionPoints"]:
-                if m["Name"] == raw:
-                    return SILKITConnectionPoint.model_validate(m, context=info.context)
+        index = get_model_index(info.context)
+        if raw in index.connection_points:
+            kind, m = index.connection_points[raw]
+            cls: type[VafBaseModel] = {
+                "SILKITConnectionPoint": SILKITConnectionPoint,
+                "SHMConnectionPoint": SHMConnectionPoint,
+                "RecordingConnectionPoint": RecordingConnectionPoint,
+            }[kind]
+            return index.validated(kind, raw, cls, m, info.context)
         raise ModelReferenceError("Reference not found: " + raw)
 
     return raw
@@ -788,6 +1190,14 @@ class PlatformModule(VafBaseModel):
             expected = "SILKITConnectionPoint"
             if isinstance(self.ConnectionPointRef, SILKITConnectionPoint):
                 return self
+        if self.OriginalEcoSystem == OriginalEcoSystemEnum.SHM:
+            expected = "SHMConnectionPoint"
+            if isinstance(self.ConnectionPointRef, SHMConnectionPoint):
+                return self
+        if self.OriginalEcoSystem == OriginalEcoSystemEnum.RECORDING:
+            expected = "RecordingConnectionPoint"
+            if isinstance(self.ConnectionPointRef, RecordingConnectionPoint):
+                return self
         if self.OriginalEcoSystem is None:
             expected = "None"
             if self.ConnectionPointRef is None:
@@ -810,6 +1220,14 @@ class ApplicationModuleTasks(VafBaseModel):
     Period: str
     PreferredOffset: Optional[int] = None
     RunAfter: list[str] = []
+    Priority: Annotated[
+        Optional[int],
+        Field(
+            ge=0,
+            description="Priority of the task. If the executor sheds load, tasks with lower priority are dropped \
+                        first. Among independent tasks of a time slot, tasks with higher priority run first.",
+        ),
+    ] = None
 
 
 class ApplicationModule(VafBaseModel):
@@ -879,10 +1297,11 @@ def resolve_application_module_ref(raw: str | ApplicationModule, info: Validatio
         ApplicationModule: The ApplicationModule
     """
     if isinstance(raw, str):
-        assert isinstance(info.context, dict)
-        for m in info.context["ApplicationModules"]:
-            if m["Namespace"] + "::" + m["Name"] == raw:
-                return ApplicationModule.model_validate(m, context=info.context)
+        index = get_model_index(info.context)
+        if raw in index.application_modules:
+            return index.validated(
+                "ApplicationModule", raw, ApplicationModule, index.application_modules[raw], info.context
+            )
         raise ModelReferenceError("Reference not found: " + raw)
     return raw
 
@@ -920,17 +1339,11 @@ def resolve_platform_module_ref(raw: str | PlatformModule, info: ValidationInfo)
         PlatformModule: The PlatformModule
     """
     if isinstance(raw, str):
-        assert isinstance(info.context, dict)
-        for m in info.context.get("PlatformConsumerModules", []) + info.context.get("PlatformProviderModules", []):
-            if m["Namespace"] + "::" + m["Name"] == raw:
-                return PlatformModule.model_validate(m, context=info.context)
         # How to check if the reference is in the same executable?
         # Eventually consolidate together with PlatformModule
-        for e in info.context["Executables"]:
-            if "InternalCommunicationModules" in e:
-                for m in e["InternalCommunicationModules"]:
-                    if m["Namespace"] + "::" + m["Name"] == raw:
-                        return PlatformModule.model_validate(m, context=info.context)
+        index = get_model_index(info.context)
+        if raw in index.platform_modules:
+            return index.validated("PlatformModule", raw, PlatformModule, index.platform_modules[raw], info.context)
         raise ModelReferenceError("Reference not found: " + raw)
     return raw
 
@@ -945,12 +1358,56 @@ class ExecutableTaskMapping(VafBaseModel):
     TaskName: str
     Offset: Optional[int] = None
     Budget: Optional[str] = None
+    Executor: Optional[str] = Field(
+        default=None,
+        description="Name of the executor of the executable that runs the task. Defaults to the executor of the \
+                    executable that is configured by ExecutorPeriod.",
+    )
+
+
+class ModuleRestartPolicy(str, Enum):
+    """Enum of the ways a module is started again after it stopped being operational, e.g. by a critical error"""
+
+    IMMEDIATE = "Immediate"
+    BACKOFF = "Backoff"
+    NEVER = "Never"
 
 
 class ExecutableApplicationModuleMapping(VafBaseModel):
     ApplicationModuleRef: ApplicationModuleRefType
     InterfaceInstanceToModuleMappings: list[InterfaceInstanceToModuleMapping]
     TaskMapping: list[ExecutableTaskMapping] = []
+    NumaNode: Annotated[
+        Optional[int],
+        Field(
+            ge=0,
+            description="NUMA node whose memory holds the sample pools, history rings and caches of the module and \
+                        of the platform modules only it is mapped to. Defaults to the ExecutorNumaNode of the \
+                        executor its tasks run on.",
+        ),
+    ] = None
+    StartupTimeLimit: Annotated[
+        Optional[str],
+        Field(
+            description="Time the module may take from Start until it reports operational, e.g. 500ms. The module \
+                        is stopped when it takes longer. Defaults to 300s.",
+        ),
+    ] = None
+    RestartPolicy: Annotated[
+        Optional[ModuleRestartPolicy],
+        Field(
+            description="Restart of the module after it stopped being operational, without restarting the \
+                        executable. Immediate starts it again 100ms after it stopped, no policy restarts it sooner. \
+                        Defaults to Immediate.",
+        ),
+    ] = None
+    RestartDelay: Annotated[
+        Optional[str],
+        Field(
+            description="Delay of the first restart with the Backoff policy, e.g. 100ms. It doubles with each \
+                        restart until the module is operational again. Defaults to 100ms.",
+        ),
+    ] = None
     _resolve_ApplicationModuleRef = field_validator("ApplicationModuleRef", mode="before")(
         resolve_application_module_ref
     )
@@ -976,12 +1433,59 @@ class ExecutableApplicationModuleMapping(VafBaseModel):
         """
         return OriginalEcoSystemEnum.SILKIT in self.used_environment
 
+    @property
+    def is_shm_used(self) -> bool:
+        """check if shared memory communication is used
+        Returns:
+            status if shared memory communication is used
+        """
+        return OriginalEcoSystemEnum.SHM in self.used_environment
+
+    @property
+    def is_recording_used(self) -> bool:
+        """check if recordings are used
+        Returns:
+            status if recordings are used
+        """
+        return OriginalEcoSystemEnum.RECORDING in self.used_environment
+
+
+class PersistencyTuningProfile(str, Enum):
+    """Enum of the LevelDB settings of a persistency file"""
+
+    READ_HEAVY = "ReadHeavy"
+    WRITE_HEAVY = "WriteHeavy"
+    TINY = "Tiny"
+
 
 class PersistencyFileMapping(VafBaseModel):
     AppModuleName: str
     FileName: str
     FilePath: str
     Sync: str
+    GroupCommitInterval: Annotated[
+        Optional[str],
+        Field(
+            description="Collects the values set on the file and writes them once per interval, e.g. 100ms, with \
+                        one sync. Values set within the last interval are lost if the process dies. LevelDB only.",
+        ),
+    ] = None
+    CacheValues: Optional[bool] = Field(
+        default=None,
+        description="Keeps the values read from the file deserialized in memory, until they are set again. \
+                    LevelDB only.",
+    )
+    TuningProfile: Optional[PersistencyTuningProfile] = Field(
+        default=None,
+        description="Block cache, bloom filter and write buffer of the file: ReadHeavy for files mostly read, \
+                    WriteHeavy for files set often, Tiny for small files on devices with little memory. Defaults to \
+                    the LevelDB defaults. LevelDB only.",
+    )
+    CompactOnShutdown: Optional[bool] = Field(
+        default=None,
+        description="Compacts the file after the modules stopped, so the next start reads a compacted file. \
+                    Modules compact in their idle windows with Compact() of the persistency interface.",
+    )
 
 
 class ExecutablePersistencyMapping(VafBaseModel):
@@ -989,12 +1493,157 @@ class ExecutablePersistencyMapping(VafBaseModel):
     PersistencyFiles: list[PersistencyFileMapping] = []
 
 
+class ExecutableMetricsExport(VafBaseModel):
+    FilePath: Annotated[
+        str,
+        Field(
+            description="File the metrics of the executable are written to in the Prometheus text format, e.g. \
+                        below /dev/shm for the textfile collector of the Prometheus node exporter.",
+        ),
+    ]
+    Period: Annotated[
+        Optional[str],
+        Field(description="Period of writing the metrics, e.g. 1s. Defaults to 1s."),
+    ] = None
+
+
+class OverrunPolicy(str, Enum):
+    """Enum of the executor strategies if a time slot overruns"""
+
+    CATCH_UP = "CatchUp"
+    SKIP = "Skip"
+    DEGRADE = "Degrade"
+
+
+class SchedulingPolicy(str, Enum):
+    """Enum of the scheduling policies of the executor threads"""
+
+    OTHER = "Other"
+    FIFO = "Fifo"
+    ROUND_ROBIN = "RoundRobin"
+
+
+class TimeSource(str, Enum):
+    """Enum of the time sources that start the time slots of the executor"""
+
+    STEADY_CLOCK = "SteadyClock"
+    SILKIT_VIRTUAL_TIME = "SilKitVirtualTime"
+
+
+class ExecutableExecutor(VafBaseModel):
+    Name: str = Field(description="Name of the executor, which the task mappings refer to.")
+    ExecutorPeriod: str = Field(description="Time slot of the executor, e.g. 100ms.")
+    ExecutorWorkerThreads: Annotated[
+        Optional[int],
+        Field(ge=0, description="Number of worker threads of the executor, see Executable.ExecutorWorkerThreads."),
+    ] = None
+    ExecutorOverrunPolicy: Annotated[
+        Optional[OverrunPolicy],
+        Field(description="Behavior of the executor if a time slot overruns. Defaults to CatchUp."),
+    ] = None
+    ExecutorSchedulingPolicy: Annotated[
+        Optional[SchedulingPolicy],
+        Field(description="Scheduling policy of the executor and worker threads. Defaults to Other."),
+    ] = None
+    ExecutorThreadPriority: Annotated[
+        Optional[int],
+        Field(
+            ge=0,
+            le=99,
+            description="Real-time priority of the executor and worker threads for the Fifo and RoundRobin \
+                        scheduling policies.",
+        ),
+    ] = None
+    ExecutorCpuAffinity: Annotated[
+        Optional[list[Annotated[int, Field(ge=0)]]],
+        Field(description="CPUs the executor and worker threads may run on."),
+    ] = None
+    ExecutorNumaNode: Annotated[
+        Optional[int],
+        Field(
+            ge=0,
+            description="NUMA node whose CPUs the executor and worker threads run on if ExecutorCpuAffinity is not \
+                        set. The modules whose tasks run on the executor keep their samples in the memory of the node.",
+        ),
+    ] = None
+
+
 class Executable(VafBaseModel):
     Name: str
     ExecutorPeriod: str
+    ExecutorWorkerThreads: Annotated[
+        Optional[int],
+        Field(
+            ge=0,
+            description="Number of worker threads of the executor. Independent tasks of a time slot run concurrently \
+                        if more than one worker thread is configured. Zero selects one worker per hardware thread.",
+        ),
+    ] = None
+    ExecutorOverrunPolicy: Annotated[
+        Optional[OverrunPolicy],
+        Field(
+            description="Behavior of the executor if a time slot overruns. CatchUp executes the missed time slots \
+                        back-to-back, Skip drops the missed time slots and Degrade drops tasks of the lowest \
+                        priorities until the executor is on time again. Defaults to CatchUp.",
+        ),
+    ] = None
+    ExecutorSchedulingPolicy: Annotated[
+        Optional[SchedulingPolicy],
+        Field(description="Scheduling policy of the executor and worker threads. Defaults to Other."),
+    ] = None
+    ExecutorThreadPriority: Annotated[
+        Optional[int],
+        Field(
+            ge=0,
+            le=99,
+            description="Real-time priority of the executor and worker threads for the Fifo and RoundRobin \
+                        scheduling policies.",
+        ),
+    ] = None
+    ExecutorCpuAffinity: Annotated[
+        Optional[list[Annotated[int, Field(ge=0)]]],
+        Field(description="CPUs the executor and worker threads may run on."),
+    ] = None
+    ExecutorNumaNode: Annotated[
+        Optional[int],
+        Field(
+            ge=0,
+            description="NUMA node whose CPUs the executor and worker threads run on if ExecutorCpuAffinity is not \
+                        set. The modules whose tasks run on the executor keep their samples in the memory of the node.",
+        ),
+    ] = None
+    ExecutorLockMemory: Annotated[
+        Optional[bool],
+        Field(
+            description="Locks the memory of the process and prefaults the stack before the executor is created, \
+                        avoiding page faults at runtime.",
+        ),
+    ] = None
+    ExecutorTimeSource: Annotated[
+        Optional[TimeSource],
+        Field(
+            description="Time that starts the time slots of the executor. SilKitVirtualTime follows the simulation \
+                        steps of SIL Kit, so the executable runs as fast as its tasks allow. Requires SIL Kit \
+                        platform modules. Defaults to SteadyClock.",
+        ),
+    ] = None
+    Executors: Annotated[
+        list[ExecutableExecutor],
+        Field(
+            description="Further executors with a time slot and thread of their own, e.g. a slower one for \
+                        housekeeping tasks. Tasks are assigned to them by ExecutableTaskMapping.Executor.",
+        ),
+    ] = []
     InternalCommunicationModules: list[PlatformModule] = []
     ApplicationModules: list[ExecutableApplicationModuleMapping]
     PersistencyModule: Optional[ExecutablePersistencyMapping] = None
+    MetricsExport: Annotated[
+        Optional[ExecutableMetricsExport],
+        Field(
+            description="Periodic export of the executor statistics, the data element counts, the handler queue \
+                        depths, the sample pool usage and the persistency latencies.",
+        ),
+    ] = None
 
     @property
     def is_silkit_used(self) -> bool:
@@ -1004,6 +1653,22 @@ class Executable(VafBaseModel):
         """
         return any(am.is_silkit_used for am in self.ApplicationModules)
 
+    @property
+    def is_shm_used(self) -> bool:
+        """check if shared memory communication is used
+        Returns:
+            status if shared memory communication is used
+        """
+        return any(am.is_shm_used for am in self.ApplicationModules)
+
+    @property
+    def is_recording_used(self) -> bool:
+        """check if recordings are used
+        Returns:
+            status if recordings are used
+        """
+        return any(am.is_recording_used for am in self.ApplicationModules)
+
     def is_module_internal_communication(self, m: PlatformModule) -> bool:
         """check if a module is an internal comm module
         Args:
@@ -1013,6 +1678,31 @@ class Executable(VafBaseModel):
         """
         return any(m == icm for icm in self.InternalCommunicationModules)
 
+    @model_validator(mode="after")
+    def check_executors(self) -> Self:
+        """Checks that the executors have unique names and the task mappings refer to them
+
+        Raises:
+            ValueError: Raised if a name is invalid or used twice or a task mapping refers to an unknown executor
+
+        Returns:
+            The Executable
+        """
+        names = [executor.Name for executor in self.Executors]
+        for name in names:
+            if not name.isidentifier():
+                raise ValueError(f"Executor {name} of executable {self.Name} needs a name usable as C++ identifier")
+        if len(names) != len(set(names)):
+            raise ValueError(f"The executors of executable {self.Name} need unique names")
+        for am in self.ApplicationModules:
+            for mapping in am.TaskMapping:
+                if mapping.Executor is not None and mapping.Executor not in names:
+                    raise ValueError(
+                        f"Task {mapping.TaskName} of executable {self.Name} is mapped to the unknown executor "
+                        f"{mapping.Executor}"
+                    )
+        return self
+
 
 # all model element that have namespace & name
 ModelElement = ModelDataType | ModuleInterface | PlatformModule | ApplicationModule
@@ -1041,6 +1731,22 @@ class MainModel(VafBaseModel):
                         to generate unique interface names"
         ),
     ] = None
+    SHMAdditionalConfiguration: Annotated[
+        Optional[SHMAdditionalConfigurationType],
+        Field(
+            description="This information is used stage 2 of the Application Framework \
+                        generation. For shared memory, it defines the segments \
+                        of the platform modules"
+        ),
+    ] = None
+    RecordingAdditionalConfiguration: Annotated[
+        Optional[RecordingAdditionalConfigurationType],
+        Field(
+            description="This information is used stage 2 of the Application Framework \
+                        generation. For recordings, it defines the files \
+                        of the platform modules"
+        ),
+    ] = None
 
     @property
     def is_persistency_used(self) -> bool:
@@ -1062,6 +1768,28 @@ class MainModel(VafBaseModel):
             for module in self.PlatformConsumerModules + self.PlatformProviderModules
         )
 
+    @property
+    def is_shm_used(self) -> bool:
+        """check if shared memory communication is used
+        Returns:
+            status if shared memory communication is used
+        """
+        return any(
+            module.OriginalEcoSystem == OriginalEcoSystemEnum.SHM
+            for module in self.PlatformConsumerModules + self.PlatformProviderModules
+        )
+
+    @property
+    def is_recording_used(self) -> bool:
+        """check if recordings are used
+        Returns:
+            status if recordings are used
+        """
+        return any(
+            module.OriginalEcoSystem == OriginalEcoSystemEnum.RECORDING
+            for module in self.PlatformConsumerModules + self.PlatformProviderModules
+        )
+
     @property
     def has_module_interfaces(self) -> bool:
         """check if model has module interfaces
@@ -1144,8 +1872,55 @@ def generate_json_schema(path: str) -> None:
         json.dump(main_model_schema, f, indent=2)
 
 
+# Number of snapshots kept in the cache directory, the least recently used ones are removed beyond it
+_MAX_SNAPSHOTS = 32
+
+
+def _get_snapshot_path(content: bytes) -> Path | None:
+    """Returns the path of the validated snapshot of a JSON model.
+    The snapshots are only stored if VAF_MODEL_CACHE_DIR names a directory. They are unpickled when loaded, so the
+    directory must only be writable by trusted users. The name of a snapshot is the hash of the JSON model, of the VAF,
+    pydantic and Python versions and of this data model.
+
+    Args:
+        content (bytes): The content of the JSON file.
+
+    Returns:
+        Path | None: The path of the snapshot or None if the snapshots are disabled.
+    """
+    cache_dir = os.environ.get("VAF_MODEL_CACHE_DIR")
+    if not cache_dir:
+        return None
+    snapshot_hash = hashlib.sha256(get_package_version().encode("utf-8"))
+    snapshot_hash.update(pydantic.VERSION.encode("utf-8"))
+    snapshot_hash.update(sys.version.encode("utf-8"))
+    snapshot_hash.update(Path(__file__).read_bytes())
+    snapshot_hash.update(content)
+    return Path(cache_dir) / (snapshot_hash.hexdigest() + ".pickle")
+
+
+def _prune_snapshots(cache_dir: Path) -> None:
+    """Removes the least recently used snapshots beyond _MAX_SNAPSHOTS.
+
+    Args:
+        cache_dir (Path): The directory of the snapshots.
+    """
+    snapshots = []
+    for snapshot in cache_dir.glob("*.pickle"):
+        try:
+            snapshots.append((snapshot.stat().st_mtime, snapshot))
+        except OSError:
+            # Removed by a concurrent load
+            pass
+    snapshots.sort(reverse=True)
+    for _, snapshot in snapshots[_MAX_SNAPSHOTS:]:
+        snapshot.unlink(missing_ok=True)
+
+
 def load_json(path: str | Path) -> MainModel:
     """Loads a model from JSON, excluding the "version" key.
+    If VAF_MODEL_CACHE_DIR is set, the validated model is kept as snapshot there, so loading the same JSON model again
+    skips the validation. A snapshot that cannot be loaded is removed and the model is validated again.
 
     Args:
         path (str | Path): Path to the JSON file.
@@ -1153,10 +1928,38 @@ def load_json(path: str | Path) -> MainModel:
     Returns:
         MainModel: The imported model.
     """
-    with open(path, encoding="utf-8") as fh:
-        raw_model = json.load(fh)
-        raw_model.pop("version", None)  # Exclude the "version" key if it exists
-        return MainModel.model_validate(raw_model, context=raw_model)
+    content = Path(path).read_bytes()
+    snapshot_path = _get_snapshot_path(content)
+    if snapshot_path is not None and snapshot_path.is_file():
+        try:
+            snapshot = pickle.loads(snapshot_path.read_bytes())
+            if isinstance(snapshot, MainModel):
+                # Marks the snapshot as recently used for the pruning
+                os.utime(snapshot_path)
+                return snapshot
+        except Exception:  # pylint: disable=broad-exception-caught
+            pass
+        # An unreadable snapshot, e.g. of an interrupted write, is removed, validated and written again
+        try:
+            snapshot_path.unlink(missing_ok=True)
+        except OSError:
+            pass
+
+    raw_model = json.loads(content)
+    raw_model.pop("version", None)  # Exclude the "version" key if it exists
+    model = MainModel.model_validate(raw_model, context={**raw_model, MODEL_INDEX_KEY: ModelIndex(raw_model)})
+
+    if snapshot_path is not None:
+        try:
+            snapshot_path.parent.mkdir(parents=True, exist_ok=True)
+            temp_path = snapshot_path.with_suffix(f".{os.getpid()}.tmp")
+            temp_path.write_bytes(pickle.dumps(model, protocol=pickle.HIGHEST_PROTOCOL))
+            os.replace(temp_path, snapshot_path)
+            _prune_snapshots(snapshot_path.parent)
+        except (OSError, pickle.PicklingError):
+            # Without a writable cache directory every load validates the model
+            pass
+    return model
 
 
 if __name__ == "__main__":
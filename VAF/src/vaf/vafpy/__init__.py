@@ -6,6 +6,15 @@ Could be used to define the public interface of the module.
 
 # Import modules and objects that belong to the public interface
 from vaf.core.common.constants import PersistencyLibrary
+from vaf.vafmodel import (
+    HandlerQueuePolicy,
+    MapContainer,
+    ModuleRestartPolicy,
+    OverrunPolicy,
+    PersistencyTuningProfile,
+    SchedulingPolicy,
+    TimeSource,
+)
 
 from .core import BaseTypes
 from .datatypes import Array, Enum, Map, String, Struct, TypeRef, Vector
@@ -46,6 +55,13 @@ __all__ = [
     "Task",
     # Constants
     "PersistencyLibrary",
+    "PersistencyTuningProfile",
+    "HandlerQueuePolicy",
+    "MapContainer",
+    "OverrunPolicy",
+    "ModuleRestartPolicy",
+    "SchedulingPolicy",
+    "TimeSource",
     # Cleanup overriding
     "CleanupOverride",
 ]
@@ -174,6 +174,9 @@ class Map(vafmodel.Map, VafpyAbstractBase):
         namespace: str,
         key_type: VafpyAbstractBase | BaseTypesWrapper,
         value_type: VafpyAbstractBase | BaseTypesWrapper,
+        *,
+        max_size: Optional[int] = None,
+        container: Optional[vafmodel.MapContainer] = None,
     ) -> None:
         VafpyFactory.create(
             constructor=vafmodel.Map,
@@ -182,14 +185,16 @@ class Map(vafmodel.Map, VafpyAbstractBase):
             Namespace=namespace,
             MapKeyTypeRef=key_type.type_ref,
             MapValueTypeRef=value_type.type_ref,
+            MaxSize=max_size,
+            Container=container,
         )
 
 
 class String(vafmodel.String, VafpyAbstractBase):
     """The VAF::String datatype"""
 
-    def __init__(self, name: str, namespace: str) -> None:
-        VafpyFactory.create(constructor=vafmodel.String, obj=self, Name=name, Namespace=namespace)
+    def __init__(self, name: str, namespace: str, *, max_size: Optional[int] = None) -> None:
+        VafpyFactory.create(constructor=vafmodel.String, obj=self, Name=name, Namespace=namespace, MaxSize=max_size)
 
 
 class VafpyFactoryWithTypeRef(VafpyFactory, VafpyAbstractBase):
@@ -305,9 +310,20 @@ class Vector(vafmodel.Vector, VafpyAbstractBase):
         name: str,
         namespace: str,
         datatype: VafpyAbstractBase | BaseTypesWrapper,
+        *,
+        max_size: Optional[int] = None,
+        protobuf_bytes: bool = True,
+        struct_of_arrays: bool = False,
     ) -> None:
         VafpyFactoryWithTypeRef.create(
-            constructor=vafmodel.Vector, obj=self, Name=name, Namespace=namespace, TypeRef=datatype
+            constructor=vafmodel.Vector,
+            obj=self,
+            Name=name,
+            Namespace=namespace,
+            TypeRef=datatype,
+            MaxSize=max_size,
+            ProtobufBytes=protobuf_bytes,
+            StructOfArrays=struct_of_arrays,
         )
 
 
@@ -315,7 +331,21 @@ class Array(vafmodel.Array, VafpyAbstractBase):
     """The VAF::Array datatype"""
 
     # Array must have size compared to Vector
-    def __init__(self, name: str, namespace: str, datatype: VafpyAbstractBase | BaseTypesWrapper, size: int) -> None:
+    def __init__(
+        self,
+        name: str,
+        namespace: str,
+        datatype: VafpyAbstractBase | BaseTypesWrapper,
+        size: int,
+        *,
+        protobuf_bytes: bool = True,
+    ) -> None:
         VafpyFactoryWithTypeRef.create(
-            constructor=vafmodel.Array, obj=self, Name=name, Namespace=namespace, TypeRef=datatype, Size=size
+            constructor=vafmodel.Array,
+            obj=self,
+            Name=name,
+            Namespace=namespace,
+            TypeRef=datatype,
+            Size=size,
+            ProtobufBytes=protobuf_bytes,
         )
@@ -67,12 +67,38 @@ class ModuleInterface(vafmodel.ModuleInterface, VafpyAbstractBase):
             Namespace=namespace,
         )
 
-    def add_data_element(self, name: str, datatype: VafpyAbstractBase | BaseTypesWrapper) -> None:
+    def add_data_element(
+        self,
+        name: str,
+        datatype: VafpyAbstractBase | BaseTypesWrapper,
+        sample_pool_size: int | None = None,
+        history_depth: int | None = None,
+        handler_queue_size: int | None = None,
+        handler_queue_policy: vafmodel.HandlerQueuePolicy | None = None,
+        publish_on_change: bool | None = None,
+        max_publish_rate: float | None = None,
+        compression: vafmodel.SampleCompression | None = None,
+        compression_threshold: int | None = None,
+        delta_keyframe_interval: int | None = None,
+    ) -> None:
         """Add a data element to the module interface
 
         Args:
             name (str): Unique name for the data element
             datatype (VafpyAbstractBase | BaseTypesWrapper): VAF Datatype of the element
+            sample_pool_size (int, optional): Number of preallocated samples of the data element
+            history_depth (int, optional): Number of latest samples kept for GetAllocatedHistory_<element>
+            handler_queue_size (int, optional): Number of samples queued per handler, which makes the handlers run
+                asynchronously in the subscribing module
+            handler_queue_policy (vafmodel.HandlerQueuePolicy, optional): Behavior if a handler queue is full.
+                Defaults to dropping the oldest sample.
+            publish_on_change (bool, optional): Skip publishing samples that equal the last published one
+            max_publish_rate (float, optional): Maximum number of samples published per second
+            compression (vafmodel.SampleCompression, optional): Algorithm that compresses the samples sent over
+                SIL Kit
+            compression_threshold (int, optional): Samples smaller than this number of bytes are sent uncompressed
+            delta_keyframe_interval (int, optional): Publish only the changed members of a struct and the full sample
+                every this number of samples
 
         Raises:
             ModelError: If a data element with the same name already exists.
@@ -85,6 +111,15 @@ class ModuleInterface(vafmodel.ModuleInterface, VafpyAbstractBase):
             vafmodel.DataElement(
                 Name=name,
                 TypeRef=datatype.type_ref,
+                SamplePoolSize=sample_pool_size,
+                HistoryDepth=history_depth,
+                HandlerQueueSize=handler_queue_size,
+                HandlerQueueOverflowPolicy=handler_queue_policy,
+                PublishOnChange=publish_on_change,
+                MaxPublishRate=max_publish_rate,
+                Compression=compression,
+                CompressionThreshold=compression_threshold,
+                DeltaKeyframeInterval=delta_keyframe_interval,
             )
         )
 
@@ -101,6 +136,10 @@ class ModuleInterface(vafmodel.ModuleInterface, VafpyAbstractBase):
         in_parameter: dict[str, VafpyAbstractBase | BaseTypesWrapper] | None = None,
         out_parameter: dict[str, VafpyAbstractBase | BaseTypesWrapper] | None = None,
         inout_parameter: dict[str, VafpyAbstractBase | BaseTypesWrapper] | None = None,
+        field_notifier: str | None = None,
+        handler_dispatch: vafmodel.OperationHandlerDispatch | None = None,
+        handler_concurrency: int | None = None,
+        handler_queue_size: int | None = None,
     ) -> None:
         """
         Add an operation to the module interface.
@@ -113,6 +152,12 @@ class ModuleInterface(vafmodel.ModuleInterface, VafpyAbstractBase):
             Defaults to None.
             inout_parameter (dict[str, VafpyAbstractBase | BaseTypesWrapper], optional): Dictionary of input/output
             parameters. Defaults to None.
+            field_notifier (str, optional): Data element that notifies the value this getter returns, consumers
+            answer the operation from its latest value. Defaults to None.
+            handler_dispatch (vafmodel.OperationHandlerDispatch, optional): Runs the handler of a SIL Kit provider in
+            the executor of the module or in worker threads instead of in the SIL Kit thread. Defaults to None.
+            handler_concurrency (int, optional): Number of worker threads with the WorkerPool dispatch. Defaults to 1.
+            handler_queue_size (int, optional): Number of calls that may wait for the handler. Defaults to 16.
 
         Raises:
             ModelError: If an operation with the same name already exists.
@@ -142,7 +187,16 @@ class ModuleInterface(vafmodel.ModuleInterface, VafpyAbstractBase):
                 # borrow check typeref from vafpyAbstractDatatypeTyperef
                 VafpyFactoryWithTypeRef.check_typeref(datatype)
 
-        self.Operations.append(vafmodel.Operation(Name=name, Parameters=function_parameters))
+        self.Operations.append(
+            vafmodel.Operation(
+                Name=name,
+                Parameters=function_parameters,
+                FieldNotifier=field_notifier,
+                HandlerDispatch=handler_dispatch,
+                HandlerConcurrency=handler_concurrency,
+                HandlerQueueSize=handler_queue_size,
+            )
+        )
 
 
 class ApplicationModule(vafmodel.ApplicationModule, VafpyAbstractBase):
@@ -176,6 +230,8 @@ class ApplicationModule(vafmodel.ApplicationModule, VafpyAbstractBase):
         interface: ModuleInterface,
         interface_type: str,
         is_optional: bool = False,
+        used_data_elements: Optional[list[str]] = None,
+        used_operations: Optional[list[str]] = None,
     ) -> None:
         """Add a consumed interface to the AppModule
 
@@ -184,6 +240,8 @@ class ApplicationModule(vafmodel.ApplicationModule, VafpyAbstractBase):
             interface (vafpy.ModuleInterface): The module interface to add
             interface_type (str): consumed/provided
             is_optional (bool): Whether the interface is mandatory for the AppModule to start
+            used_data_elements (list[str], optional): The data elements the AppModule uses, all if not set
+            used_operations (list[str], optional): The operations the AppModule uses, all if not set
 
         Raises:
             ModelError: If a consumed interface with the same name already exists.
@@ -201,24 +259,50 @@ class ApplicationModule(vafmodel.ApplicationModule, VafpyAbstractBase):
             getattr(vafmodel, f"ApplicationModule{interface_type.capitalize()}Interface")(
                 InstanceName=instance_name,
                 ModuleInterfaceRef=interface,
-                # IsOptional is only available for Consumed
-                **({"IsOptional": is_optional} if interface_type == "consumed" else {}),
+                # IsOptional and the used elements are only available for Consumed
+                **(
+                    {
+                        "IsOptional": is_optional,
+                        "UsedDataElements": used_data_elements,
+                        "UsedOperations": used_operations,
+                    }
+                    if interface_type == "consumed"
+                    else {}
+                ),
             )
         )
         ModelRuntime().add_used_module_interfaces(interface)
 
-    def add_consumed_interface(self, instance_name: str, interface: ModuleInterface, is_optional: bool = False) -> None:
+    def add_consumed_interface(
+        self,
+        instance_name: str,
+        interface: ModuleInterface,
+        is_optional: bool = False,
+        used_data_elements: Optional[list[str]] = None,
+        used_operations: Optional[list[str]] = None,
+    ) -> None:
         """Add a consumed interface to the AppModule
 
         Args:
             instance_name (str): Unique name for the interface instance
             interface (vafpy.ModuleInterface): The module interface to add
             is_optional (bool): Whether the interface is mandatory for the AppModule to start
+            used_data_elements (list[str], optional): The data elements the AppModule reads or handles, all if not
+                set. Platform modules only subscribe to the used ones.
+            used_operations (list[str], optional): The operations the AppModule calls, all if not set. Platform
+                modules only create clients for the used ones.
 
         Raises:
             ModelError: If a consumed interface with the same name already exists.
         """
-        self.__add_interface(instance_name, interface, interface_type="consumed", is_optional=is_optional)
+        self.__add_interface(
+            instance_name,
+            interface,
+            interface_type="consumed",
+            is_optional=is_optional,
+            used_data_elements=used_data_elements,
+            used_operations=used_operations,
+        )
 
     def add_provided_interface(self, instance_name: str, interface: ModuleInterface) -> None:
         """Add a provided interface to the app module
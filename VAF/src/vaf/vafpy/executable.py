@@ -13,7 +13,7 @@ from typing import Any, List
 from vaf import vafmodel
 from vaf.core.common.constants import PersistencyLibrary
 
-from ..core.common.utils import create_name_namespace_full_name
+from ..core.common.utils import create_name_namespace_full_name, timedelta_to_time_str
 from .core import ModelError
 from .elements import ApplicationModule
 from .model_runtime import ModelRuntime
@@ -43,6 +43,11 @@ class _ExecutablePlatformConnector:  # pylint:disable=too-few-public-methods
         silkit_instance_is_optional: bool = False,
         silkit_namespace: str | None = None,
         silkit_namespace_is_optional: bool | None = None,
+        rpc_max_in_flight: int | None = None,
+        rpc_timeout: str | None = None,
+        batch_data_elements: bool | None = None,
+        direct_protobuf_codec: bool | None = None,
+        lazy_deserialization: bool | None = None,
     ) -> None:
         """Connects a module interface of an application module as a silkit consumer
 
@@ -56,6 +61,11 @@ class _ExecutablePlatformConnector:  # pylint:disable=too-few-public-methods
             silkit_instance_is_optional (bool): Indicates if Silkit Instance is optional or mandatory for discovery
             silkit_namespace (str): The SilKit Namespace
             silkit_namespace_is_optional (bool): Indicates if Silkit Namespace is optional or mandatory for discovery
+            rpc_max_in_flight (int): Maximum number of pending calls per operation of a consumer
+            rpc_timeout (str): Time after which a pending call of a consumer fails
+            batch_data_elements (bool): Sends the data elements set within one executor time slot as one message
+            direct_protobuf_codec (bool): Encodes the protobuf messages directly from and to the VAF types
+            lazy_deserialization (bool): Deserializes the samples of a consumer on first access
 
         Raises:
             ValueError: If the parameter interface_type and/or silkit_namespace_is_optional is wrongly specified
@@ -86,7 +96,7 @@ class _ExecutablePlatformConnector:  # pylint:disable=too-few-public-methods
             silkit_namespace=silkit_namespace,
         )
 
-        if interface_type == "consumer" and len(found_module) > 1:
+        if interface_type == "consumer" and len(found_module) > 0:
             pm = found_module[0]
         elif interface_type == "provider" and len(found_module) > 0:
             raise ModelError(
@@ -99,6 +109,11 @@ class _ExecutablePlatformConnector:  # pylint:disable=too-few-public-methods
                 SilkitInstanceIsOptional=silkit_instance_is_optional,
                 SilkitNamespace=silkit_namespace,
                 SilkitNamespaceIsOptional=silkit_namespace_is_optional,
+                RpcMaxInFlight=rpc_max_in_flight,
+                RpcTimeout=rpc_timeout,
+                BatchDataElements=batch_data_elements,
+                DirectProtobufCodec=direct_protobuf_codec,
+                LazyDeserialization=lazy_deserialization,
             )
             if self.__model.main_model.SILKITAdditionalConfiguration is None:
                 self.__model.main_model.SILKITAdditionalConfiguration = vafmodel.SILKITAdditionalConfigurationType(
@@ -123,6 +138,164 @@ class _ExecutablePlatformConnector:  # pylint:disable=too-few-public-methods
         # add the mapping
         self.__post_platform_connect_operations(am, interface, instance_name, pm)
 
+    def connect_interface_to_shm(  # pylint:disable=too-many-arguments,too-many-positional-arguments
+        self,
+        executable: vafmodel.Executable,
+        app_module: ApplicationModule,
+        instance_name: str,
+        interface_type: str,
+        segment_name: str,
+        slot_count: int | None = None,
+    ) -> None:
+        """Connects a module interface of an application module to a shared memory segment
+
+        Args:
+            executable: The executable
+            app_module (vafpy.ApplicationModule): Application module instance to
+            connect
+            instance_name (str): The interface instance name
+            interface_type (str): Type of interface (consumer/provider)
+            segment_name (str): Name of the shared memory segments
+            slot_count (int): Number of sample slots per data element
+
+        Raises:
+            ValueError: If the segment name is empty
+            ModelError: If the module interface has operations or if more than one provider is configured for the
+                        same segment
+        """
+        am = self.__ensure_app_module(executable, app_module)
+
+        interface = self.__find_interface(app_module, instance_name, interface_type)
+
+        if segment_name == "" or "/" in segment_name:
+            raise ValueError(f'connect interface to shm command found with invalid "segment_name" "{segment_name}"')
+
+        if interface.ModuleInterfaceRef.Operations:
+            raise ModelError(
+                f"Module Interface {interface.ModuleInterfaceRef.Name} has operations, which are not supported by shared memory platform modules"  # pylint: disable=line-too-long
+            )
+
+        found_module: List[vafmodel.PlatformModule] = self.__find_platform_module(
+            interface,
+            interface_type,
+            vafmodel.OriginalEcoSystemEnum.SHM,
+            segment_name=segment_name,
+        )
+
+        if interface_type == "consumer" and len(found_module) > 0:
+            pm = found_module[0]
+        elif interface_type == "provider" and len(found_module) > 0:
+            raise ModelError(
+                f"More than one shared memory provider configured for Module Interface {interface.ModuleInterfaceRef.Name} with segment {segment_name}"  # pylint: disable=line-too-long
+            )
+        else:
+            cp = vafmodel.SHMConnectionPoint(
+                Name=f"ConnectionPoint_{interface_type}_{instance_name}",
+                SegmentName=segment_name,
+                SlotCount=slot_count,
+            )
+            if self.__model.main_model.SHMAdditionalConfiguration is None:
+                self.__model.main_model.SHMAdditionalConfiguration = vafmodel.SHMAdditionalConfigurationType(
+                    ConnectionPoints=[]
+                )
+            # pylint-bug
+            # pylint: disable-next=no-member
+            self.__model.main_model.SHMAdditionalConfiguration.ConnectionPoints.append(cp)
+            pm = vafmodel.PlatformModule(
+                Name=f"{interface_type.capitalize()}ShmModule_{interface.ModuleInterfaceRef.Name}_{instance_name}",  # pylint:disable=line-too-long
+                Namespace=interface.ModuleInterfaceRef.Namespace,
+                ModuleInterfaceRef=interface.ModuleInterfaceRef,
+                OriginalEcoSystem=vafmodel.OriginalEcoSystemEnum.SHM,
+                ConnectionPointRef=cp,
+            )
+            (
+                self.__model.main_model.PlatformProviderModules
+                if interface_type == "provider"
+                else self.__model.main_model.PlatformConsumerModules
+            ).append(pm)
+
+        # add the mapping
+        self.__post_platform_connect_operations(am, interface, instance_name, pm)
+
+    def connect_interface_to_recording(  # pylint:disable=too-many-arguments,too-many-positional-arguments
+        self,
+        executable: vafmodel.Executable,
+        app_module: ApplicationModule,
+        instance_name: str,
+        interface_type: str,
+        file_path: str,
+        replay_speed: float | None = None,
+    ) -> None:
+        """Connects a module interface of an application module to a recording
+
+        Args:
+            executable: The executable
+            app_module (vafpy.ApplicationModule): Application module instance to
+            connect
+            instance_name (str): The interface instance name
+            interface_type (str): Type of interface, provider to record or consumer to replay
+            file_path (str): Path of the recording
+            replay_speed (float): Pace of the replay relative to the recording
+
+        Raises:
+            ValueError: If the file path is empty
+            ModelError: If the module interface has operations or if more than one provider is configured for the
+                        same recording
+        """
+        am = self.__ensure_app_module(executable, app_module)
+
+        interface = self.__find_interface(app_module, instance_name, interface_type)
+
+        if file_path == "" or '"' in file_path or "\\" in file_path:
+            raise ValueError(f'connect interface to recording command found with invalid "file_path" "{file_path}"')
+
+        if interface.ModuleInterfaceRef.Operations:
+            raise ModelError(
+                f"Module Interface {interface.ModuleInterfaceRef.Name} has operations, which are not supported by recordings"  # pylint: disable=line-too-long
+            )
+
+        found_module: List[vafmodel.PlatformModule] = self.__find_platform_module(
+            interface,
+            interface_type,
+            vafmodel.OriginalEcoSystemEnum.RECORDING,
+            file_path=file_path,
+        )
+
+        if interface_type == "consumer" and len(found_module) > 0:
+            pm = found_module[0]
+        elif interface_type == "provider" and len(found_module) > 0:
+            raise ModelError(
+                f"More than one recording provider configured for Module Interface {interface.ModuleInterfaceRef.Name} with file {file_path}"  # pylint: disable=line-too-long
+            )
+        else:
+            cp = vafmodel.RecordingConnectionPoint(
+                Name=f"ConnectionPoint_{interface_type}_{instance_name}",
+                FilePath=file_path,
+                ReplaySpeed=replay_speed,
+            )
+            if self.__model.main_model.RecordingAdditionalConfiguration is None:
+                self.__model.main_model.RecordingAdditionalConfiguration = (
+                    vafmodel.RecordingAdditionalConfigurationType(ConnectionPoints=[])
+                )
+            # pylint-bug
+            # pylint: disable-next=no-member
+            self.__model.main_model.RecordingAdditionalConfiguration.ConnectionPoints.append(cp)
+            pm = vafmodel.PlatformModule(
+                Name=f"{'Recorder' if interface_type == 'provider' else 'Replayer'}Module_{interface.ModuleInterfaceRef.Name}_{instance_name}",  # pylint:disable=line-too-long
+                Namespace=interface.ModuleInterfaceRef.Namespace,
+                ModuleInterfaceRef=interface.ModuleInterfaceRef,
+                OriginalEcoSystem=vafmodel.OriginalEcoSystemEnum.RECORDING,
+                ConnectionPointRef=cp,
+            )
+            (
+                self.__model.main_model.PlatformProviderModules
+                if interface_type == "provider"
+                else self.__model.main_model.PlatformConsumerModules
+            ).append(pm)
+
+        # add the mapping
+        self.__post_platform_connect_operations(am, interface, instance_name, pm)
+
     #### PRIVATE API ####
     @staticmethod
     def __ensure_app_module(
@@ -189,13 +362,27 @@ class _ExecutablePlatformConnector:  # pylint:disable=too-few-public-methods
         """
         valid: bool = False
         identifier: str = ""
-        connection_point_type: type[vafmodel.SILKITConnectionPoint]
+        connection_point_type: (
+            type[vafmodel.SILKITConnectionPoint]
+            | type[vafmodel.SHMConnectionPoint]
+            | type[vafmodel.RecordingConnectionPoint]
+        )
         match ecosystem:
             case vafmodel.OriginalEcoSystemEnum.SILKIT:
                 assert all(arg in kwargs for arg in ["silkit_instance", "silkit_namespace"])
                 identifier = kwargs["silkit_instance"]
                 connection_str = "SilKit Instance"
                 connection_point_type = vafmodel.SILKITConnectionPoint
+            case vafmodel.OriginalEcoSystemEnum.SHM:
+                assert "segment_name" in kwargs
+                identifier = kwargs["segment_name"]
+                connection_str = "segment"
+                connection_point_type = vafmodel.SHMConnectionPoint
+            case vafmodel.OriginalEcoSystemEnum.RECORDING:
+                assert "file_path" in kwargs
+                identifier = kwargs["file_path"]
+                connection_str = "file"
+                connection_point_type = vafmodel.RecordingConnectionPoint
 
         found_module = []
         for pm in (
@@ -209,6 +396,10 @@ class _ExecutablePlatformConnector:  # pylint:disable=too-few-public-methods
                     valid &= (pm.ConnectionPointRef.SilkitInstance == identifier) and (
                         pm.ConnectionPointRef.SilkitNamespace == kwargs["silkit_namespace"]
                     )
+                elif isinstance(pm.ConnectionPointRef, vafmodel.SHMConnectionPoint):
+                    valid &= pm.ConnectionPointRef.SegmentName == identifier
+                elif isinstance(pm.ConnectionPointRef, vafmodel.RecordingConnectionPoint):
+                    valid &= pm.ConnectionPointRef.FilePath == identifier
                 else:
                     valid = False
 
@@ -279,17 +470,33 @@ class Executable(vafmodel.Executable):
 
     _connector: _ExecutablePlatformConnector
 
-    def __init__(self, name: str, executor_period: timedelta | None = None) -> None:
+    def __init__(
+        self,
+        name: str,
+        executor_period: timedelta | None = None,
+        executor_worker_threads: int | None = None,
+        executor_overrun_policy: vafmodel.OverrunPolicy | None = None,
+    ) -> None:
         """Initialize an Executable with an optional executor_period
 
         Args:
             name (str): Executable name
             executor_period (datetime.timedelta, optional): Executor period. Defaults to an ideal value calculated using
             the tasks of all AppModules.
+            executor_worker_threads (int, optional): Number of executor worker threads. Defaults to a single-threaded
+            executor. Zero selects one worker per hardware thread.
+            executor_overrun_policy (vafmodel.OverrunPolicy, optional): Behavior of the executor if a time slot
+            overruns. Defaults to catching up the missed time slots.
         """
-        period_str = f"{int(executor_period.total_seconds() * 1000)}ms" if executor_period else "Default"
-
-        super().__init__(Name=name, ExecutorPeriod=period_str, ApplicationModules=[])
+        period_str = timedelta_to_time_str(executor_period) if executor_period else "Default"
+
+        super().__init__(
+            Name=name,
+            ExecutorPeriod=period_str,
+            ExecutorWorkerThreads=executor_worker_threads,
+            ExecutorOverrunPolicy=executor_overrun_policy,
+            ApplicationModules=[],
+        )
 
         ModelRuntime().main_model.Executables.append(self)
 
@@ -300,29 +507,140 @@ class Executable(vafmodel.Executable):
         Args:
             executor_period (datetime.timedelta): Executor period as timedelta
         """
-        self.ExecutorPeriod = f"{int(executor_period.total_seconds() * 1000)}ms"
+        self.ExecutorPeriod = timedelta_to_time_str(executor_period)
+
+    def set_executor_worker_threads(self, worker_threads: int) -> None:
+        """Method to set ExecutorWorkerThreads
+        Args:
+            worker_threads (int): Number of executor worker threads, zero for one per hardware thread
+        """
+        self.ExecutorWorkerThreads = worker_threads
+
+    def set_executor_overrun_policy(self, overrun_policy: vafmodel.OverrunPolicy) -> None:
+        """Method to set ExecutorOverrunPolicy
+        Args:
+            overrun_policy (vafmodel.OverrunPolicy): Behavior of the executor if a time slot overruns
+        """
+        self.ExecutorOverrunPolicy = overrun_policy
+
+    def set_executor_time_source(self, time_source: vafmodel.TimeSource) -> None:
+        """Method to set ExecutorTimeSource
+        Args:
+            time_source (vafmodel.TimeSource): Time that starts the time slots of the executor
+        """
+        self.ExecutorTimeSource = time_source
+
+    def set_executor_thread_attributes(  # pylint: disable=too-many-arguments, too-many-positional-arguments
+        self,
+        scheduling_policy: vafmodel.SchedulingPolicy | None = None,
+        priority: int | None = None,
+        cpu_affinity: list[int] | None = None,
+        lock_memory: bool | None = None,
+        numa_node: int | None = None,
+    ) -> None:
+        """Method to set the real-time attributes of the executor threads
+        Args:
+            scheduling_policy (vafmodel.SchedulingPolicy, optional): Scheduling policy of the executor threads
+            priority (int, optional): Real-time priority of the executor threads
+            cpu_affinity (list[int], optional): CPUs the executor threads may run on
+            lock_memory (bool, optional): Lock the process memory and prefault the stack
+            numa_node (int, optional): NUMA node whose CPUs the executor threads run on if no cpu_affinity is given,
+                and whose memory holds the samples of the modules running on the executor
+        """
+        self.ExecutorSchedulingPolicy = scheduling_policy
+        self.ExecutorThreadPriority = priority
+        self.ExecutorCpuAffinity = cpu_affinity
+        self.ExecutorLockMemory = lock_memory
+        self.ExecutorNumaNode = numa_node
+
+    def export_metrics(self, file_path: str, period: timedelta | None = None) -> None:
+        """Method to set MetricsExport
+        Args:
+            file_path (str): File the metrics are written to in the Prometheus text format, e.g. below /dev/shm
+            period (datetime.timedelta, optional): Period of writing the metrics. Defaults to one second.
+        """
+        self.MetricsExport = vafmodel.ExecutableMetricsExport(
+            FilePath=file_path, Period=timedelta_to_time_str(period) if period is not None else None
+        )
 
-    def add_application_module(
+    def add_executor(  # pylint: disable=too-many-arguments, too-many-positional-arguments
+        self,
+        name: str,
+        period: timedelta,
+        worker_threads: int | None = None,
+        overrun_policy: vafmodel.OverrunPolicy | None = None,
+        scheduling_policy: vafmodel.SchedulingPolicy | None = None,
+        priority: int | None = None,
+        cpu_affinity: list[int] | None = None,
+        numa_node: int | None = None,
+    ) -> None:
+        """Add an executor with a tick thread of its own, tasks are mapped to it by add_application_module
+        Args:
+            name (str): Name of the executor
+            period (datetime.timedelta): Period of one time slot of the executor
+            worker_threads (int, optional): Number of worker threads, zero for one per hardware thread
+            overrun_policy (vafmodel.OverrunPolicy, optional): Behavior of the executor if a time slot overruns
+            scheduling_policy (vafmodel.SchedulingPolicy, optional): Scheduling policy of the executor threads
+            priority (int, optional): Real-time priority of the executor threads
+            cpu_affinity (list[int], optional): CPUs the executor threads may run on
+            numa_node (int, optional): NUMA node whose CPUs the executor threads run on if no cpu_affinity is given,
+                and whose memory holds the samples of the modules running on the executor
+        """
+        self.Executors.append(
+            vafmodel.ExecutableExecutor(
+                Name=name,
+                ExecutorPeriod=timedelta_to_time_str(period),
+                ExecutorWorkerThreads=worker_threads,
+                ExecutorOverrunPolicy=overrun_policy,
+                ExecutorSchedulingPolicy=scheduling_policy,
+                ExecutorThreadPriority=priority,
+                ExecutorCpuAffinity=cpu_affinity,
+                ExecutorNumaNode=numa_node,
+            )
+        )
+
+    def add_application_module(  # pylint: disable=too-many-arguments, too-many-positional-arguments
         self,
         module: ApplicationModule,
-        task_mapping_info: list[tuple[str, timedelta, int]],
+        task_mapping_info: list[tuple[str, timedelta, int] | tuple[str, timedelta, int, str]],
+        startup_time_limit: timedelta | None = None,
+        restart_policy: vafmodel.ModuleRestartPolicy | None = None,
+        restart_delay: timedelta | None = None,
+        numa_node: int | None = None,
     ) -> None:
         """Add an application module to the executable
 
         Args:
             module (vafpy.ApplicationModule): Application module instance to add
             task_mapping_info (list[tuple[str, timedelta, int]]): Mapping info for tasks a list of tuples with
-            (task_name, budget, offset)
+            (task_name, budget, offset) or (task_name, budget, offset, executor) for a task that runs on an executor
+            added with add_executor
+            startup_time_limit (datetime.timedelta, optional): Time the module may take from Start until it reports
+            operational. Defaults to 300 seconds.
+            restart_policy (vafmodel.ModuleRestartPolicy, optional): Restart of the module after it stopped being
+            operational. Defaults to Immediate, which starts it again 100 milliseconds after it stopped.
+            restart_delay (datetime.timedelta, optional): First delay of the Backoff restart policy, doubled with each
+            restart until the module is operational. Defaults to 100 milliseconds.
+            numa_node (int, optional): NUMA node whose memory holds the samples of the module. Defaults to the NUMA
+            node of the executor its tasks run on.
         """
         task_mappings: list[vafmodel.ExecutableTaskMapping] = []
         for r in task_mapping_info:
-            budget_str = f"{int(r[1].total_seconds() * 1000)}ms"
-            task_mappings.append(vafmodel.ExecutableTaskMapping(TaskName=r[0], Offset=r[2], Budget=budget_str))
+            budget_str = timedelta_to_time_str(r[1])
+            task_mappings.append(
+                vafmodel.ExecutableTaskMapping(
+                    TaskName=r[0], Offset=r[2], Budget=budget_str, Executor=r[3] if len(r) > 3 else None
+                )
+            )
         self.ApplicationModules.append(
             vafmodel.ExecutableApplicationModuleMapping(
                 ApplicationModuleRef=module,
                 InterfaceInstanceToModuleMappings=[],
                 TaskMapping=task_mappings,
+                StartupTimeLimit=timedelta_to_time_str(startup_time_limit) if startup_time_limit else None,
+                RestartPolicy=restart_policy,
+                RestartDelay=timedelta_to_time_str(restart_delay) if restart_delay else None,
+                NumaNode=numa_node,
             )
         )
 
@@ -436,6 +754,11 @@ class Executable(vafmodel.Executable):
         silkit_instance_is_optional: bool = False,
         silkit_namespace: str | None = None,
         silkit_namespace_is_optional: bool | None = None,
+        rpc_max_in_flight: int | None = None,
+        rpc_timeout: str | None = None,
+        batch_data_elements: bool | None = None,
+        direct_protobuf_codec: bool | None = None,
+        lazy_deserialization: bool | None = None,
     ) -> None:
         """Connects a module interface of an application module as a silkit consumer
 
@@ -447,6 +770,14 @@ class Executable(vafmodel.Executable):
             silkit_instance_is_optional (bool): Indicates if Silkit Instance is optional or mandatory for discovery
             silkit_namespace (str): The SilKit Namespace
             silkit_namespace_is_optional (bool): Indicates if Silkit Namespace is optional or mandatory for discovery
+            rpc_max_in_flight (int, optional): Maximum number of pending calls per operation. Defaults to 16.
+            rpc_timeout (str, optional): Time after which a pending call fails, e.g. "100ms". Defaults to no timeout.
+            batch_data_elements (bool, optional): Receive the data elements as one message per executor time slot of
+                the provider. Must match the provider.
+            direct_protobuf_codec (bool, optional): Decode and encode the protobuf messages directly from and to the
+                VAF types. Need not match the provider.
+            lazy_deserialization (bool, optional): Deserialize a received sample when it is read or passed to a
+                handler instead of on reception. Need not match the provider.
         """
         self._connector.connect_interface_to_silkit(
             self,
@@ -457,6 +788,11 @@ class Executable(vafmodel.Executable):
             silkit_instance_is_optional=silkit_instance_is_optional,
             silkit_namespace=silkit_namespace,
             silkit_namespace_is_optional=silkit_namespace_is_optional,
+            rpc_max_in_flight=rpc_max_in_flight,
+            rpc_timeout=rpc_timeout,
+            batch_data_elements=batch_data_elements,
+            direct_protobuf_codec=direct_protobuf_codec,
+            lazy_deserialization=lazy_deserialization,
         )
 
     def connect_provided_interface_to_silkit(  # pylint: disable=too-many-arguments, too-many-positional-arguments
@@ -467,6 +803,8 @@ class Executable(vafmodel.Executable):
         silkit_instance_is_optional: bool = False,
         silkit_namespace: str | None = None,
         silkit_namespace_is_optional: bool | None = None,
+        batch_data_elements: bool | None = None,
+        direct_protobuf_codec: bool | None = None,
     ) -> None:
         """Connects a module interface of an application module as a silkit provider
 
@@ -478,6 +816,10 @@ class Executable(vafmodel.Executable):
             silkit_instance_is_optional (bool): Indicates if Silkit Instance is optional or mandatory for discovery
             silkit_namespace (str): The SilKit Namespace
             silkit_namespace_is_optional (bool): Indicates if Silkit Namespace is optional or mandatory for discovery
+            batch_data_elements (bool, optional): Send the data elements set within one executor time slot as one
+                message. Must match the consumers.
+            direct_protobuf_codec (bool, optional): Encode and decode the protobuf messages directly from and to the
+                VAF types. Need not match the consumers.
 
         """
         self._connector.connect_interface_to_silkit(
@@ -489,6 +831,103 @@ class Executable(vafmodel.Executable):
             silkit_instance_is_optional=silkit_instance_is_optional,
             silkit_namespace=silkit_namespace,
             silkit_namespace_is_optional=silkit_namespace_is_optional,
+            batch_data_elements=batch_data_elements,
+            direct_protobuf_codec=direct_protobuf_codec,
+        )
+
+    def connect_consumed_interface_to_shm(
+        self,
+        app_module: ApplicationModule,
+        instance_name: str,
+        segment_name: str,
+    ) -> None:
+        """Connects a module interface of an application module as a shared memory consumer
+
+        Args:
+            app_module (vafpy.ApplicationModule): Application module instance to
+            connect
+            instance_name (str): The interface instance name
+            segment_name (str): Name of the shared memory segments of the provider
+        """
+        self._connector.connect_interface_to_shm(
+            self,
+            app_module,
+            instance_name,
+            interface_type="consumer",
+            segment_name=segment_name,
+        )
+
+    def connect_provided_interface_to_shm(  # pylint: disable=too-many-arguments, too-many-positional-arguments
+        self,
+        app_module: ApplicationModule,
+        instance_name: str,
+        segment_name: str,
+        slot_count: int | None = None,
+    ) -> None:
+        """Connects a module interface of an application module as a shared memory provider
+
+        Args:
+            app_module (vafpy.ApplicationModule): Application module instance to
+            connect
+            instance_name (str): The interface instance name
+            segment_name (str): Name of the shared memory segments
+            slot_count (int, optional): Number of sample slots per data element. Defaults to 4.
+        """
+        self._connector.connect_interface_to_shm(
+            self,
+            app_module,
+            instance_name,
+            interface_type="provider",
+            segment_name=segment_name,
+            slot_count=slot_count,
+        )
+
+    def connect_consumed_interface_to_replay(
+        self,
+        app_module: ApplicationModule,
+        instance_name: str,
+        file_path: str,
+        replay_speed: float | None = None,
+    ) -> None:
+        """Connects a module interface of an application module to the replay of a recording
+
+        Args:
+            app_module (vafpy.ApplicationModule): Application module instance to
+            connect
+            instance_name (str): The interface instance name
+            file_path (str): Path of the recording
+            replay_speed (float, optional): Pace of the replay relative to the recording, e.g. 1.0 for real time.
+              Defaults to as fast as the handlers of the consumers run.
+        """
+        self._connector.connect_interface_to_recording(
+            self,
+            app_module,
+            instance_name,
+            interface_type="consumer",
+            file_path=file_path,
+            replay_speed=replay_speed,
+        )
+
+    def connect_provided_interface_to_recording(
+        self,
+        app_module: ApplicationModule,
+        instance_name: str,
+        file_path: str,
+    ) -> None:
+        """Connects a module interface of an application module to a recording of its samples
+
+        Args:
+            app_module (vafpy.ApplicationModule): Application module instance to
+            connect
+            instance_name (str): The interface instance name
+            file_path (str): Path of the recording, replaced on every start of the executable
+        """
+        self._connector.connect_interface_to_recording(
+            self,
+            app_module,
+            instance_name,
+            interface_type="provider",
+            file_path=file_path,
         )
 
     def connect_persistency_keyvalue_store(
@@ -498,7 +937,8 @@ class Executable(vafmodel.Executable):
         """Connects a persistency key value store
 
         Args:
-            library (PersistencyLibrary): The key value store name
+            library (PersistencyLibrary): The key value store name. LEVELDB suits any file, MMAP keeps small files
+                that are mostly read in a memory mapped log, which opens fast and is read without copies.
         """
         if self.PersistencyModule is None:
             self.PersistencyModule = vafmodel.ExecutablePersistencyMapping(PersistencyLibrary=library)
@@ -511,6 +951,10 @@ class Executable(vafmodel.Executable):
         file_name: str,
         file_path: str,
         sync: bool,
+        group_commit_interval: str | None = None,
+        cache_values: bool | None = None,
+        tuning_profile: vafmodel.PersistencyTuningProfile | None = None,
+        compact_on_shutdown: bool | None = None,
     ) -> None:
         """Connects a module interface of an application module as a silkit provider
 
@@ -520,6 +964,12 @@ class Executable(vafmodel.Executable):
             file_name (str): The file name used in the application module
             file_path (str): The path to the file realtive to ./
             sync (bool): Sync to storage on write.
+            group_commit_interval (str, optional): Write the values set on the file once per interval, e.g. "100ms".
+                Defaults to writing each value when it is set.
+            cache_values (bool, optional): Keep the values read from the file deserialized in memory.
+            tuning_profile (vafmodel.PersistencyTuningProfile, optional): Block cache, bloom filter and write buffer
+                of the file. Defaults to the LevelDB defaults.
+            compact_on_shutdown (bool, optional): Compact the file after the modules stopped.
 
         Raises:
             ModelError: If the application module was not found,
@@ -544,6 +994,10 @@ class Executable(vafmodel.Executable):
             FileName=file_name,
             FilePath=file_path,
             Sync="true" if sync else "false",
+            GroupCommitInterval=group_commit_interval,
+            CacheValues=cache_values,
+            TuningProfile=tuning_profile,
+            CompactOnShutdown=compact_on_shutdown,
         )
         if self.PersistencyModule is None:
             self.PersistencyModule = vafmodel.ExecutablePersistencyMapping()
@@ -551,5 +1005,14 @@ class Executable(vafmodel.Executable):
         for per_map in self.PersistencyModule.PersistencyFiles:
             if file_mapping.FilePath == per_map.FilePath and file_mapping.Sync != per_map.Sync:
                 raise ModelError("Shared file path must have same sync option: " + file_mapping.FilePath)
+            if (
+                file_mapping.FilePath == per_map.FilePath
+                and file_mapping.GroupCommitInterval != per_map.GroupCommitInterval
+            ):
+                raise ModelError("Shared file path must have same group commit interval: " + file_mapping.FilePath)
+            if file_mapping.FilePath == per_map.FilePath and file_mapping.CacheValues != per_map.CacheValues:
+                raise ModelError("Shared file path must have same cache option: " + file_mapping.FilePath)
+            if file_mapping.FilePath == per_map.FilePath and file_mapping.TuningProfile != per_map.TuningProfile:
+                raise ModelError("Shared file path must have same tuning profile: " + file_mapping.FilePath)
 
         self.PersistencyModule.PersistencyFiles.append(file_mapping)
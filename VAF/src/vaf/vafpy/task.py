@@ -10,6 +10,7 @@ from datetime import timedelta
 from typing_extensions import Self
 
 from vaf import vafmodel
+from vaf.core.common.utils import timedelta_to_time_str
 
 
 # pylint: disable-next=too-few-public-methods
@@ -22,13 +23,15 @@ class Task(vafmodel.ApplicationModuleTasks):
         period: timedelta,
         preferred_offset: int | None = None,
         run_after: list[Self] | None = None,
+        priority: int | None = None,
     ):
         vafmodel.ApplicationModuleTasks.__init__(
             self,
             Name=name,
-            Period=f"{int(period.total_seconds() * 1000)}ms",
+            Period=timedelta_to_time_str(period),
             PreferredOffset=preferred_offset,
             RunAfter=[task_.Name for task_ in run_after or []],
+            Priority=priority,
         )
 
     def add_run_after(self, task: Self) -> None:
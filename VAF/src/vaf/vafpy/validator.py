@@ -6,15 +6,20 @@
 import math
 import warnings
 from copy import deepcopy
+from datetime import timedelta
 from enum import Enum
-from typing import Callable, Dict, List, Tuple
+from typing import Any, Callable, Dict, List, Tuple
 
 import networkx as nx
 
 from vaf import vafmodel
 
 from ..core.common.utils import ProjectType as PType
-from ..core.common.utils import create_name_namespace_full_name
+from ..core.common.utils import (
+    create_name_namespace_full_name,
+    time_str_to_microseconds,
+    timedelta_to_time_str,
+)
 from ..vafmodel import Executable
 from .core import ModelError, VafpyAbstractBase, VafpyAbstractModelRuntime
 
@@ -460,11 +465,16 @@ class _Validator:
                 post_cleanup_job()
 
     def __validate_executable_executor_period(self, executable: Executable) -> None:
-        """Method to validate an executable's persistency
+        """Method to validate the periods of an executable's executors
         Args:
             exec: Executable to be validated
         """
-        # get all periodic tasks from all app modules belonging to the executable
+        executors = {
+            (app_module.ApplicationModuleRef.Name, mapping.TaskName): mapping.Executor
+            for app_module in executable.ApplicationModules
+            for mapping in app_module.TaskMapping
+        }
+        # get all periodic tasks from all app modules belonging to the executable, with the executor they run on
         periodic_tasks_data = [
             [
                 create_name_namespace_full_name(
@@ -472,36 +482,75 @@ class _Validator:
                     app_module.ApplicationModuleRef.Namespace,
                 ),
                 task.Name,
-                int(task.Period.rstrip("ms")),
+                task_period,
+                executors.get((app_module.ApplicationModuleRef.Name, task.Name)),
             ]
             for app_module in executable.ApplicationModules
             for task in app_module.ApplicationModuleRef.Tasks
-            if task.Period.rstrip("ms").isdigit()
+            if (task_period := time_str_to_microseconds(task.Period)) is not None
         ]
+        main_tasks_data = [data[:3] for data in periodic_tasks_data if data[3] is None]
+        if executable.ExecutorPeriod == "Default":
+            if main_tasks_data:
+                # calculate the common denominators of all PeriodicTasks
+                executable.ExecutorPeriod = timedelta_to_time_str(
+                    timedelta(microseconds=math.gcd(*[data[2] for data in main_tasks_data]))
+                )
+        else:
+            self.__validate_executor_period(executable, "ExecutorPeriod", executable.ExecutorPeriod, main_tasks_data)
+        for executor in executable.Executors:
+            self.__validate_executor_period(
+                executable,
+                f"ExecutorPeriod of Executor {executor.Name}",
+                executor.ExecutorPeriod,
+                [data[:3] for data in periodic_tasks_data if data[3] == executor.Name],
+            )
+
+    def __validate_executor_period(
+        self, executable: Executable, label: str, period: str, periodic_tasks_data: list[list[Any]]
+    ) -> None:
+        """Method to validate the period of one executor against the periods of the tasks that run on it
+        Args:
+            executable: Executable of the executor
+            label: Name of the period in the messages
+            period: Period of the executor
+            periodic_tasks_data: Application module, name and period in microseconds of the tasks of the executor
+        """
         if periodic_tasks_data:
             app_module_names, tasks_names, all_tasks_period = zip(*periodic_tasks_data)
+            executor_period = time_str_to_microseconds(period)
 
-            if executable.ExecutorPeriod == "Default":
-                # calculate the common denominators of all PeriodicTasks
-                executable.ExecutorPeriod = f"{math.gcd(*all_tasks_period)}ms"
-            elif executable.ExecutorPeriod.rstrip("ms").isdigit():
+            if executor_period is not None:
                 # ensure Executor Period <= the smallest task period
-                executor_period = int(executable.ExecutorPeriod.rstrip("ms"))
                 if executor_period > min(all_tasks_period):
                     # get tasks with the minimum
                     self.__hard_errors.append(
                         "\n".join(
                             [
-                                f"Invalid ExecutorPeriod of Executable {executable.Name}: {executable.ExecutorPeriod}!",
-                                f"Executor Period {executable.ExecutorPeriod} is longer than its Task(s)' period:",
+                                f"Invalid {label} of Executable {executable.Name}: {period}!",
+                                f"Executor Period {period} is longer than its Task(s)' period:",
                             ]
                             + [
-                                f"   AppModule: {app_module_names[idx]} - Task: {tasks_names[idx]} with period {task_period}ms"  # pylint:disable=line-too-long
+                                f"   AppModule: {app_module_names[idx]} - Task: {tasks_names[idx]} with period {task_period}us"  # pylint:disable=line-too-long
                                 for idx, task_period in enumerate(all_tasks_period)
                                 if executor_period > task_period
                             ]
                         )
                     )
+                # the executor rounds task periods down to a multiple of its period
+                elif any(task_period % executor_period != 0 for task_period in all_tasks_period):
+                    self.__light_warnings.append(
+                        "\n".join(
+                            [
+                                f"{label} {period} of Executable {executable.Name} is no divisor of all its Task(s)' periods, they are rounded down:",  # pylint:disable=line-too-long
+                            ]
+                            + [
+                                f"   AppModule: {app_module_names[idx]} - Task: {tasks_names[idx]} with period {task_period}us"  # pylint:disable=line-too-long
+                                for idx, task_period in enumerate(all_tasks_period)
+                                if task_period % executor_period != 0
+                            ]
+                        )
+                    )
 
     def __validate_executables(self) -> None:
         """Method to validate model's executables"""
@@ -575,6 +624,17 @@ class _Validator:
                         f" {app_module.Namespace}::{app_module.Name}, but is not part of it."
                     )
 
+            # run_after dependencies must form a DAG, otherwise the executor can not order the tasks
+            run_after_graph = nx.DiGraph()
+            for task in app_module.Tasks:
+                for run_after in task.RunAfter:
+                    run_after_graph.add_edge(run_after, task.Name)
+            for cycle in nx.simple_cycles(run_after_graph):
+                self.__hard_errors.append(
+                    f"Tasks {' -> '.join(cycle + cycle[:1])} of ApplicationModule"
+                    f" {app_module.Namespace}::{app_module.Name} have a cyclic 'run_after' dependency."
+                )
+
     def __validate_interface_connections(self) -> None:
         """Method to validate model's interface connections"""
         unconnected_interfaces = []
@@ -4,7 +4,8 @@
 """Module containing the VSS model."""
 
 from collections import defaultdict
-from typing import Any
+from fnmatch import fnmatchcase
+from typing import Any, Optional, Sequence
 
 from vaf import vafmodel
 
@@ -14,14 +15,17 @@ from . import vss_types
 class VSS:  # pylint: disable=too-few-public-methods
     """Class representing the VSS model"""
 
-    def __init__(self, vss_json: dict[str, Any]) -> None:
+    def __init__(self, vss_json: dict[str, Any], signal_filter: Optional[Sequence[str]] = None) -> None:
         """Instanciates a VSS Model
 
         Args:
             vss_json (dict[str, Any]): The complete VSS input as JSON dict
+            signal_filter (Optional[Sequence[str]]): Paths or glob patterns of the signals and branches to import,
+                e.g. Vehicle.Cabin.*. Branches without selected signals are left out. Imports all if not set.
         """
 
         self.datatypes_per_namespace: defaultdict[str, set[vss_types.BaseType]] = defaultdict(set)
+        self.signal_filter: list[str] = list(signal_filter) if signal_filter else []
 
         self._import_vss(vss_json)
 
@@ -55,11 +59,31 @@ class VSS:  # pylint: disable=too-few-public-methods
         self.datatypes_per_namespace.clear()
 
         for vss_key, vss_value in vss_json.items():
-            self._create_struct(vss_value=vss_value, namespace_with_name="vss::" + vss_key)
+            self._create_struct(
+                vss_value=vss_value, namespace_with_name="vss::" + vss_key, selected=self._is_selected(vss_key)
+            )
+
+    def _is_selected(self, path: str) -> bool:
+        """Checks whether a signal or branch is selected by the signal filter
+
+        Args:
+            path (str): The VSS path, e.g. Vehicle.Cabin.Door
+
+        Returns:
+            bool: True if there is no filter or one of its patterns matches the path
+        """
+        return not self.signal_filter or any(fnmatchcase(path, pattern) for pattern in self.signal_filter)
 
-    def _create_struct(self, vss_value: dict[str, Any], namespace_with_name: str) -> vss_types.StructType:
+    def _create_struct(
+        self, vss_value: dict[str, Any], namespace_with_name: str, selected: bool = True
+    ) -> Optional[vss_types.StructType]:
         """
         Creates a struct for a VSS (Vehicle Signal Specification) branch.
+        The children of a branch that is not selected by the signal filter are only imported if they are selected
+        themselves, such a branch without selected children is left out.
+
+        Returns:
+            The struct or None if the branch is left out.
 
         Raises:
             ValueError: If the 'type' in the vss_branch is not 'branch', or if required keys are missing or invalid.
@@ -69,14 +93,20 @@ class VSS:  # pylint: disable=too-few-public-methods
         if vss_value["type"] != "branch":
             raise ValueError("JSON does not contain a 'branch' type.")
         struct_type = vss_types.StructType(name=name, namespace=namespace.lower())
+        path = namespace_with_name.removeprefix("vss::").replace("::", ".")
 
         for subelement_key, subelement_value in vss_value["children"].items():
+            subelement_selected = selected or self._is_selected(f"{path}.{subelement_key}")
             if subelement_value["type"] == "branch":
-                struct_type.subelements.append(
-                    self._create_struct(
-                        vss_value=subelement_value, namespace_with_name=f"{namespace}::{name}::{subelement_key}"
-                    )
+                substruct = self._create_struct(
+                    vss_value=subelement_value,
+                    namespace_with_name=f"{namespace}::{name}::{subelement_key}",
+                    selected=subelement_selected,
                 )
+                if substruct is not None:
+                    struct_type.subelements.append(substruct)
+                continue
+            if not subelement_selected:
                 continue
             if "allowed" in subelement_value and subelement_value["datatype"] == "string":
                 struct_type.subelements.append(
@@ -105,6 +135,8 @@ class VSS:  # pylint: disable=too-few-public-methods
                 )
             )
 
+        if not selected and not struct_type.subelements:
+            return None
         self.datatypes_per_namespace[namespace.lower()].add(struct_type)
         return struct_type
 
@@ -5,16 +5,39 @@
 
 import json
 from pathlib import Path
+from typing import Any, Optional, Sequence
 
 from vaf.vafvssimport.vss.vss_model import VSS
 
+# Keys of a VSS node the import reads, all others like descriptions, comments and uuids are dropped while parsing
+_VSS_NODE_KEYS = {"type", "children", "datatype", "allowed", "arraysize", "min", "max"}
 
-def run_import(out_dir: str, input_file: str) -> bool:
+
+def _strip_vss_node(obj: dict[str, Any]) -> dict[str, Any]:
+    """Drops the keys of a VSS node the import does not read, called by the JSON decoder for each object
+
+    Args:
+        obj (dict[str, Any]): A decoded JSON object, a VSS node or the children of a branch
+
+    Returns:
+        dict[str, Any]: The object without the unused keys of a VSS node
+    """
+    # Children are objects of nodes, a node has its type as string
+    if not isinstance(obj.get("type"), str):
+        return obj
+    return {key: value for key, value in obj.items() if key in _VSS_NODE_KEYS}
+
+
+def run_import(out_dir: str, input_file: str, signal_filter: Optional[Sequence[str]] = None) -> bool:
     """Runs JSON import for the VSS catalog
+    The metadata of the signals is dropped while the JSON file is decoded, so only the structure and the datatypes
+    of the catalog are held in memory. The decoded catalog is released before the derived model is exported.
 
     Args:
         out_dir (str): The output directory for the vss.json model.
         input_file (str): JSON file to import.
+        signal_filter (Optional[Sequence[str]]): Paths or glob patterns of the signals and branches to import, e.g.
+            Vehicle.Cabin.*. Imports all signals if not set.
 
     Raises:
         OSError: Raised when files cannot be written
@@ -32,8 +55,7 @@ def run_import(out_dir: str, input_file: str) -> bool:
         # Import type definitions from IDLs
         if Path(input_file).is_file():
             with open(input_file, "r", encoding="utf-8") as f:
-                vss_json = json.load(f)
-                vss_model = VSS(vss_json)
+                vss_model = VSS(json.load(f, object_hook=_strip_vss_node), signal_filter)
 
             json_model = vss_model.export().model_dump_json(
                 indent=2, by_alias=True, exclude_unset=True, exclude_defaults=True
@@ -0,0 +1,111 @@
+# Copyright (c) 2024-2026 by Vector Informatik GmbH. All rights reserved.
+# SPDX-License-Identifier: Apache-2.0
+
+"""Tests of the cause-effect chain analysis."""
+
+# pylint: disable=missing-function-docstring
+# pylint: disable=missing-param-doc
+# pylint: disable=missing-type-doc
+# mypy: disable-error-code="no-untyped-def"
+
+from datetime import timedelta
+
+import pytest
+
+from vaf import vafmodel, vafpy
+from vaf.core.objects.analyze_cmd import AnalyzeCmd
+from vaf.core.objects.load_cmd import LoadCmd
+from vaf.vafpy.model_runtime import ModelRuntime
+
+METRICS = """\
+# TYPE vaf_task_mean_execution_time_seconds gauge
+vaf_task_mean_execution_time_seconds{module="AppA",task="Step1"} 0.0005
+vaf_task_mean_execution_time_seconds{module="AppA",task="Step2"} 0.001
+vaf_task_mean_execution_time_seconds{module="AppB",task="Task"} 0.002
+# TYPE vaf_task_max_execution_time_seconds gauge
+vaf_task_max_execution_time_seconds{module="AppA",task="Step1"} 0.001
+vaf_task_max_execution_time_seconds{module="AppA",task="Step2"} 0.002
+vaf_task_max_execution_time_seconds{module="AppB",task="Task"} 0.003
+# TYPE vaf_task_start_lateness_seconds summary
+vaf_task_start_lateness_seconds{module="AppB",task="Task",quantile="0.5"} 0.00001
+vaf_task_start_lateness_seconds{module="AppB",task="Task",quantile="0.99"} 0.0001
+# TYPE vaf_sample_latency_seconds histogram
+vaf_sample_latency_seconds_bucket{path="SignalAppAObjectsToAppBObjectsModule.value -> AppB",le="0.000256"} 0
+vaf_sample_latency_seconds_bucket{path="SignalAppAObjectsToAppBObjectsModule.value -> AppB",le="0.000512"} 10
+vaf_sample_latency_seconds_bucket{path="SignalAppAObjectsToAppBObjectsModule.value -> AppB",le="+Inf"} 10
+vaf_sample_latency_seconds_sum{path="SignalAppAObjectsToAppBObjectsModule.value -> AppB"} 0.004
+vaf_sample_latency_seconds_count{path="SignalAppAObjectsToAppBObjectsModule.value -> AppB"} 10
+"""
+
+
+def build_model() -> vafmodel.MainModel:
+    """Velocity from SIL Kit to AppA::Step1, Step2 after it, AppB::Task and its command to SIL Kit"""
+    ModelRuntime().reset()
+    interface = vafpy.ModuleInterface("Signal", "test")
+    interface.add_data_element("value", vafpy.BaseTypes.UINT64_T)
+
+    app_a = vafpy.ApplicationModule("AppA", "test")
+    app_a.add_consumed_interface("Velocity", interface)
+    app_a.add_provided_interface("Objects", interface)
+    step1 = vafpy.Task("Step1", timedelta(milliseconds=10))
+    app_a.add_task(step1)
+    app_a.add_task(vafpy.Task("Step2", timedelta(milliseconds=10), run_after=[step1]))
+
+    app_b = vafpy.ApplicationModule("AppB", "test")
+    app_b.add_consumed_interface("Objects", interface)
+    app_b.add_provided_interface("Command", interface)
+    app_b.add_task(vafpy.Task("Task", timedelta(milliseconds=20)))
+
+    executable = vafpy.Executable("MyExecutable", timedelta(milliseconds=10))
+    executable.add_application_module(
+        app_a, [("Step1", timedelta(milliseconds=10), 0), ("Step2", timedelta(milliseconds=10), 0)]
+    )
+    executable.add_application_module(app_b, [("Task", timedelta(milliseconds=20), 0)])
+    executable.connect_consumed_interface_to_silkit(app_a, "Velocity", "VelocityService")
+    executable.connect_interfaces(app_a, "Objects", app_b, "Objects")
+    executable.connect_provided_interface_to_silkit(app_b, "Command", "Actuator")
+    return ModelRuntime().main_model
+
+
+def test_find_chains():
+    graph = AnalyzeCmd.build_graph(build_model())
+
+    (chain,) = AnalyzeCmd.find_chains(graph)
+    assert [str(node) for _, node in chain] == [
+        "ConsumerModule_Signal_Velocity",
+        "AppA::Step1",
+        "AppA::Step2",
+        "AppB::Task",
+        "ProviderModule_Signal_Command",
+    ]
+    # Step2 runs after Step1, the other hops exchange samples
+    assert [edge.via if edge else None for edge, _ in chain] == [
+        None,
+        "ConsumerModule_Signal_Velocity",
+        "",
+        "SignalAppAObjectsToAppBObjectsModule",
+        "ProviderModule_Signal_Command",
+    ]
+
+    (partial,) = AnalyzeCmd.find_chains(graph, sources=["AppA"], sinks=["AppB"])
+    assert [str(node) for _, node in partial] == ["AppA::Step1", "AppA::Step2", "AppB::Task"]
+
+
+def test_analyze():
+    model = build_model()
+    (chain,) = AnalyzeCmd().analyze(model, {"MyExecutable": LoadCmd.parse_metrics(METRICS)})
+
+    hop = chain["hops"][3]
+    assert hop["node"] == "AppB::Task"
+    assert hop["communication"] == {"typical": pytest.approx(0.0004), "worst": 0.000512, "measured": True}
+    assert hop["sampling"] == {"typical": 0.01, "worst": 0.02, "measured": True}
+    assert hop["execution"]["worst"] == 0.003
+    assert hop["worst"] == pytest.approx(0.000512 + 0.02 + 0.0001 + 0.003)
+    assert hop["dominant_part"] == "sampling"
+    assert chain["dominant_hop"] == 3
+
+    # The latency of the samples from and to SIL Kit is not measured
+    assert not chain["hops"][1]["communication"]["measured"]
+    assert not chain["measured"]
+    assert chain["worst"] == pytest.approx(0.01 + 0.001 + 0.002 + hop["worst"])
+    assert "dominant, mostly sampling" in AnalyzeCmd.format_report([chain])[4]
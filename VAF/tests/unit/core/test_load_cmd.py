@@ -0,0 +1,104 @@
+# Copyright (c) 2024-2026 by Vector Informatik GmbH. All rights reserved.
+# SPDX-License-Identifier: Apache-2.0
+
+"""Tests of the synthetic load projects."""
+
+# pylint: disable=missing-function-docstring
+# pylint: disable=missing-param-doc
+# pylint: disable=missing-type-doc
+# mypy: disable-error-code="no-untyped-def"
+
+from datetime import timedelta
+from pathlib import Path
+
+import pytest
+
+from vaf import vafmodel
+from vaf.core.objects.load_cmd import LoadCmd, LoadParameters
+
+
+def test_build_model():
+    model = LoadCmd().build_model(
+        LoadParameters(
+            modules=4,
+            tasks=2,
+            data_elements=3,
+            fan_out=2,
+            periods=[timedelta(milliseconds=10), timedelta(milliseconds=20)],
+            payload_sizes=[64, 1024],
+        )
+    )
+
+    assert [array.Size for array in model.DataTypeDefinitions.Arrays] == [64, 1024]
+    assert [len(interface.DataElements) for interface in model.ModuleInterfaces] == [3, 3]
+    assert len(model.ApplicationModules) == 4
+    assert [ci.InstanceName for ci in model.ApplicationModules[0].ConsumedInterfaces] == ["Input3To0", "Input2To0"]
+    # Module 0 consumes the 1024 byte payload of module 3 and the 64 byte payload of module 2
+    assert [ci.ModuleInterfaceRef.Name for ci in model.ApplicationModules[0].ConsumedInterfaces] == [
+        "LoadInterface1024",
+        "LoadInterface64",
+    ]
+    assert [task.Period for task in model.ApplicationModules[1].Tasks] == ["20ms", "20ms"]
+
+    (executable,) = model.Executables
+    assert executable.ExecutorPeriod == "10ms"
+    assert executable.MetricsExport is not None
+    assert executable.MetricsExport.FilePath == "/dev/shm/load_executable0.prom"
+    # One communication module per provider, shared by its consumers
+    assert len(executable.InternalCommunicationModules) == 4
+    assert [mapping.Offset for mapping in executable.ApplicationModules[3].TaskMapping] == [0, 1]
+
+
+def test_build_model_silkit():
+    model = LoadCmd().build_model(LoadParameters(modules=3, fan_out=1, communication="silkit", executables=2))
+
+    assert [len(executable.ApplicationModules) for executable in model.Executables] == [2, 1]
+    assert not any(executable.InternalCommunicationModules for executable in model.Executables)
+    assert len(model.PlatformProviderModules) == 3
+    assert len(model.PlatformConsumerModules) == 3
+
+
+def test_build_model_invalid():
+    for parameters in [
+        LoadParameters(modules=2, fan_out=2),
+        LoadParameters(modules=2, executables=2),
+        LoadParameters(periods=[timedelta(milliseconds=15)], executor_period=timedelta(milliseconds=10)),
+        LoadParameters(payload_sizes=[4]),
+    ]:
+        with pytest.raises(ValueError):
+            LoadCmd().build_model(parameters)
+
+
+def test_generate(tmp_path: Path):
+    LoadCmd().generate(tmp_path, LoadParameters(modules=2, tasks=2, data_elements=3))
+
+    model = vafmodel.load_json(tmp_path / "model/vaf/model.json")
+    assert [am.Name for am in model.ApplicationModules] == ["LoadModule0", "LoadModule1"]
+    implementation = tmp_path / "src/application_modules/load_module1/implementation"
+    assert (implementation / "include/load/load_module1.h").is_file()
+    source = (implementation / "src/load_module1.cpp").read_text(encoding="utf-8")
+    assert "Input0To1_->RegisterDataElementHandler_sample2(" in source
+    # Task0 publishes sample0 and sample2, Task1 publishes sample1
+    task0 = source[source.index("void LoadModule1::Task0()") : source.index("void LoadModule1::Task1()")]
+    assert "Allocate_sample0()" in task0 and "Allocate_sample2()" in task0 and "Allocate_sample1()" not in task0
+    assert (tmp_path / "src-gen/executables/load_executable0/src/main.cpp").is_file()
+
+
+def test_summarize_histograms():
+    samples = LoadCmd.parse_metrics(
+        "# TYPE vaf_sample_latency_seconds histogram\n"
+        'vaf_sample_latency_seconds_bucket{path="A.b -> C",le="1e-06"} 0\n'
+        'vaf_sample_latency_seconds_bucket{path="A.b -> C",le="2e-06"} 90\n'
+        'vaf_sample_latency_seconds_bucket{path="A.b -> C",le="4e-06"} 99\n'
+        'vaf_sample_latency_seconds_bucket{path="A.b -> C",le="+Inf"} 100\n'
+        'vaf_sample_latency_seconds_sum{path="A.b -> C"} 0.0002\n'
+        'vaf_sample_latency_seconds_count{path="A.b -> C"} 100\n'
+        "vaf_executor_overruns_total 3\n"
+    )
+
+    assert samples[-1] == ("vaf_executor_overruns_total", {}, 3.0)
+    (summary,) = LoadCmd.summarize_histograms(samples, "vaf_sample_latency_seconds", ("path",))
+    assert summary["path"] == "A.b -> C"
+    assert summary["count"] == 100
+    assert (summary["p50"], summary["p90"], summary["p99"]) == (2e-06, 2e-06, 4e-06)
+    assert summary["curve"] == [(1e-06, 0.0), (2e-06, 0.9), (4e-06, 0.99), (float("inf"), 1.0)]
@@ -0,0 +1,78 @@
+# Copyright (c) 2024-2026 by Vector Informatik GmbH. All rights reserved.
+# SPDX-License-Identifier: Apache-2.0
+
+"""Tests of the binary log decoding."""
+
+# pylint: disable=missing-function-docstring
+# pylint: disable=missing-param-doc
+# pylint: disable=missing-type-doc
+# mypy: disable-error-code="no-untyped-def"
+
+import struct
+from pathlib import Path
+
+import pytest
+
+from vaf.core.objects.log_cmd import BINARY_LOG_MAGIC, LogCmd
+
+
+def entry(thread: int, kind: int, starts_line: bool, payload: bytes) -> bytes:
+    return struct.pack("<IBBH", thread, kind, 1 if starts_line else 0, len(payload)) + payload
+
+
+def test_decode(tmp_path: Path):
+    log_file = tmp_path / "app.vaflog"
+    log_file.write_bytes(
+        BINARY_LOG_MAGIC
+        + entry(1, 5, True, struct.pack("<I", 0) + b"[APP: Main] ")
+        + entry(2, 0, True, b"[THR: Second] value ")
+        + entry(1, 0, False, b"speed ")
+        + entry(1, 3, False, struct.pack("<d", 12.25))
+        + entry(2, 1, False, struct.pack("<q", -5))
+        + entry(1, 4, False, b"\x01")
+        + entry(1, 6, True, struct.pack("<I", 0))
+        + entry(1, 2, False, struct.pack("<Q", 18446744073709551615))
+        + entry(0, 7, True, struct.pack("<Q", 3))
+        # Cut off by the end of the process
+        + struct.pack("<IBBH", 1, 0, 1, 10)
+        + b"abc"
+    )
+
+    assert LogCmd().decode(log_file) == [
+        "[APP: Main] speed 12.25true",
+        "[THR: Second] value -5",
+        "[APP: Main] 18446744073709551615",
+        "[vaf: 3 log records dropped]",
+    ]
+
+
+def test_decode_cut_line(tmp_path: Path):
+    log_file = tmp_path / "app.vaflog"
+    log_file.write_bytes(
+        BINARY_LOG_MAGIC
+        + entry(1, 0, True, b"[APP: Main] complete")
+        + entry(1, 0, True, b"[APP: Main] cut by a full ")
+        + entry(2, 0, True, b"[THR: Second] other thread")
+        + entry(1, 7, False, struct.pack("<Q", 2))
+        # Starts line 2 drops the cut line before
+        + struct.pack("<IBBH", 1, 0, 2, 17)
+        + b"[APP: Main] next "
+    )
+
+    assert LogCmd().decode(log_file) == [
+        "[APP: Main] complete",
+        "[THR: Second] other thread",
+        "[vaf: 2 log records dropped]",
+        "[APP: Main] next ",
+    ]
+
+
+def test_decode_invalid(tmp_path: Path):
+    log_file = tmp_path / "app.vaflog"
+    log_file.write_bytes(b"plain text log\n")
+    with pytest.raises(ValueError):
+        LogCmd().decode(log_file)
+
+    log_file.write_bytes(BINARY_LOG_MAGIC + entry(1, 6, True, struct.pack("<I", 7)))
+    with pytest.raises(ValueError):
+        LogCmd().decode(log_file)
@@ -15,14 +15,17 @@
 
 #include "test/my_service_module.h"
 
+#include "vaf/allocation_tracking.h"
 #include "vaf/internal/data_ptr_helper.h"
 #include "vaf/internal/promise.h"
+#include "vaf/trace.h"
 
 namespace test {
 
 MyServiceModule::MyServiceModule(vaf::Executor& executor, vaf::String name, vaf::Vector<vaf::String> dependencies, vaf::ExecutableControllerInterface& executable_controller_interface)
   : vaf::ControlInterface(std::move(name), std::move(dependencies), executable_controller_interface, executor),
-    executor_{vaf::ControlInterface::executor_} {
+    executor_{vaf::ControlInterface::executor_},
+    handler_executor_{executor} {
 }
 
 vaf::Result<void> MyServiceModule::Init() noexcept {
@@ -39,126 +42,91 @@ void MyServiceModule::Stop() noexcept {
 void MyServiceModule::DeInit() noexcept  {
 }
 
-void MyServiceModule::StartEventHandlerForModule(const vaf::String& module) {
-  for(auto& handler_container : my_data_element1_handlers_) {
-    if(handler_container.owner_ == module) {
-      handler_container.is_active_ = true;
-    }
-  }
-  for(auto& handler_container : my_data_element2_handlers_) {
-    if(handler_container.owner_ == module) {
-      handler_container.is_active_ = true;
-    }
-  }
-
-  active_modules_.push_back(module);
+void MyServiceModule::StartEventHandlerForModule(vaf::ModuleId module) {
+  active_modules_.Insert(module);
 }
 
-void MyServiceModule::StopEventHandlerForModule(const vaf::String& module) {
-  for(auto& handler_container : my_data_element1_handlers_) {
-    if(handler_container.owner_ == module) {
-      handler_container.is_active_ = false;
-    }
-  }
-  for(auto& handler_container : my_data_element2_handlers_) {
-    if(handler_container.owner_ == module) {
-      handler_container.is_active_ = false;
-    }
-  }
+void MyServiceModule::StopEventHandlerForModule(vaf::ModuleId module) {
+  active_modules_.Erase(module);
+}
 
-  active_modules_.erase(std::remove(active_modules_.begin(), active_modules_.end(), module));
+vaf::Vector<vaf::MemoryUsage> MyServiceModule::GetMemoryUsage() const {
+  vaf::Vector<vaf::MemoryUsage> usage{};
+  usage.push_back(vaf::MemoryUsage{name_, "my_data_element1"});
+  my_data_element1_channel_.AddMemoryUsage(usage.back());
+  usage.push_back(vaf::MemoryUsage{name_, "my_data_element2"});
+  my_data_element2_channel_.AddMemoryUsage(usage.back());
+  return usage;
 }
 
 
 ::vaf::Result<::vaf::ConstDataPtr<const std::uint64_t>> MyServiceModule::GetAllocated_my_data_element1() {
-  return vaf::Result<vaf::ConstDataPtr<const std::uint64_t >>::FromValue( my_data_element1_sample_);
+  return vaf::Result<vaf::ConstDataPtr<const std::uint64_t >>::FromValue( my_data_element1_channel_.LoadSample());
 }
 
-std::uint64_t MyServiceModule::Get_my_data_element1() { return *my_data_element1_sample_; }
+std::uint64_t MyServiceModule::Get_my_data_element1() { return my_data_element1_channel_.Load(); }
 
 void MyServiceModule::RegisterDataElementHandler_my_data_element1(vaf::String owner, std::function<void(const ::vaf::ConstDataPtr<const std::uint64_t>)>&& f) {
-  StartEventHandlerForModule(owner);
-  my_data_element1_handlers_.emplace_back(owner, std::move(f));
-  if(std::find(active_modules_.begin(), active_modules_.end(), owner) != active_modules_.end()) {
-    my_data_element1_handlers_.back().is_active_ = true;
-  }
+  StartEventHandlerForModule(vaf::GetModuleId(owner));
+  my_data_element1_channel_.AddHandler(owner, vaf::internal::TraceHandler<std::uint64_t>("MyServiceModule.my_data_element1 -> " + owner, std::move(f)));
 }
 
 ::vaf::Result<::vaf::DataPtr<std::uint64_t>> MyServiceModule::Allocate_my_data_element1() {
-  std::unique_ptr< std::uint64_t > ptr{
-      std::make_unique< std::uint64_t >()};
-  return ::vaf::Result<vaf::DataPtr< std::uint64_t >>::FromValue(std::move(ptr));
+  VAF_ALLOCATION_SCOPE("MyServiceModule.my_data_element1 Allocate");
+  return ::vaf::Result<vaf::DataPtr< std::uint64_t >>::FromValue(my_data_element1_channel_.Allocate());
 }
 
 ::vaf::Result<void> MyServiceModule::SetAllocated_my_data_element1(::vaf::DataPtr<std::uint64_t>&& data) {
-  my_data_element1_sample_ = vaf::ConstDataPtr<const std::uint64_t>{std::move(vaf::internal::DataPtrHelper<std::uint64_t>::getRawPtr(data))};
-
-  for(auto& handler_container : my_data_element1_handlers_) {
-    if(handler_container.is_active_) {
-      handler_container.handler_(my_data_element1_sample_);
-    }
-  }
-
+  VAF_ALLOCATION_SCOPE("MyServiceModule.my_data_element1 Set");
+  my_data_element1_channel_.Publish(vaf::internal::DataPtrHelper<std::uint64_t>::toConstDataPtr(data), active_modules_);
   return vaf::Result<void>{};
 }
 
 ::vaf::Result<void> MyServiceModule::Set_my_data_element1(const std::uint64_t& data) {
-  std::unique_ptr< std::uint64_t > ptr{
-      std::make_unique< std::uint64_t >(data)};
-  my_data_element1_sample_ = vaf::ConstDataPtr<const std::uint64_t>{std::move(ptr)};
-
-  for(auto& handler_container : my_data_element1_handlers_) {
-    if(handler_container.is_active_) {
-      handler_container.handler_(my_data_element1_sample_);
-    }
-  }
-
+  VAF_ALLOCATION_SCOPE("MyServiceModule.my_data_element1 Set");
+  my_data_element1_channel_.Set(data, active_modules_);
   return vaf::Result<void>{};
 }
 
 ::vaf::Result<::vaf::ConstDataPtr<const std::uint64_t>> MyServiceModule::GetAllocated_my_data_element2() {
-  return vaf::Result<vaf::ConstDataPtr<const std::uint64_t >>::FromValue( my_data_element2_sample_);
+  return vaf::Result<vaf::ConstDataPtr<const std::uint64_t >>::FromValue( my_data_element2_channel_.LoadSample());
 }
 
-std::uint64_t MyServiceModule::Get_my_data_element2() { return *my_data_element2_sample_; }
+std::uint64_t MyServiceModule::Get_my_data_element2() { return my_data_element2_channel_.Load(); }
+
+::vaf::Result<::vaf::Vector<::vaf::ConstDataPtr<const std::uint64_t>>> MyServiceModule::GetAllocatedHistory_my_data_element2(std::uint64_t& last_sequence) {
+  return vaf::Result<vaf::Vector<vaf::ConstDataPtr<const std::uint64_t >>>::FromValue( my_data_element2_channel_.ReadSince(last_sequence));
+}
 
 void MyServiceModule::RegisterDataElementHandler_my_data_element2(vaf::String owner, std::function<void(const ::vaf::ConstDataPtr<const std::uint64_t>)>&& f) {
-  StartEventHandlerForModule(owner);
-  my_data_element2_handlers_.emplace_back(owner, std::move(f));
-  if(std::find(active_modules_.begin(), active_modules_.end(), owner) != active_modules_.end()) {
-    my_data_element2_handlers_.back().is_active_ = true;
-  }
+  StartEventHandlerForModule(vaf::GetModuleId(owner));
+  // The handler is called by an event-driven task of the owner, so a slow handler does not delay the provider
+  auto queue = std::make_shared<vaf::internal::HandlerQueue<std::uint64_t>>(8, vaf::internal::HandlerQueuePolicy::kDropNewest,
+      vaf::internal::TraceHandler<std::uint64_t>("MyServiceModule.my_data_element2 -> " + owner, std::move(f)),
+      vaf::MetricLabels{ {"module", "MyServiceModule"}, {"data_element", "my_data_element2"}, {"owner", owner} });
+  std::shared_ptr<vaf::TaskHandle> task{handler_executor_.RunOnEvent("my_data_element2_handler", [queue]() { queue->Drain(); }, owner)};
+  task->Start();
+  my_data_element2_channel_.AddHandler(owner, [queue, task](const vaf::ConstDataPtr<const std::uint64_t> sample) {
+    if(queue->Push(sample)) {
+      task->Trigger();
+    }
+  });
 }
 
 ::vaf::Result<::vaf::DataPtr<std::uint64_t>> MyServiceModule::Allocate_my_data_element2() {
-  std::unique_ptr< std::uint64_t > ptr{
-      std::make_unique< std::uint64_t >()};
-  return ::vaf::Result<vaf::DataPtr< std::uint64_t >>::FromValue(std::move(ptr));
+  VAF_ALLOCATION_SCOPE("MyServiceModule.my_data_element2 Allocate");
+  return ::vaf::Result<vaf::DataPtr< std::uint64_t >>::FromValue(my_data_element2_channel_.Allocate());
 }
 
 ::vaf::Result<void> MyServiceModule::SetAllocated_my_data_element2(::vaf::DataPtr<std::uint64_t>&& data) {
-  my_data_element2_sample_ = vaf::ConstDataPtr<const std::uint64_t>{std::move(vaf::internal::DataPtrHelper<std::uint64_t>::getRawPtr(data))};
-
-  for(auto& handler_container : my_data_element2_handlers_) {
-    if(handler_container.is_active_) {
-      handler_container.handler_(my_data_element2_sample_);
-    }
-  }
-
+  VAF_ALLOCATION_SCOPE("MyServiceModule.my_data_element2 Set");
+  my_data_element2_channel_.Publish(vaf::internal::DataPtrHelper<std::uint64_t>::toConstDataPtr(data), active_modules_);
   return vaf::Result<void>{};
 }
 
 ::vaf::Result<void> MyServiceModule::Set_my_data_element2(const std::uint64_t& data) {
-  std::unique_ptr< std::uint64_t > ptr{
-      std::make_unique< std::uint64_t >(data)};
-  my_data_element2_sample_ = vaf::ConstDataPtr<const std::uint64_t>{std::move(ptr)};
-
-  for(auto& handler_container : my_data_element2_handlers_) {
-    if(handler_container.is_active_) {
-      handler_container.handler_(my_data_element2_sample_);
-    }
-  }
-
+  VAF_ALLOCATION_SCOPE("MyServiceModule.my_data_element2 Set");
+  my_data_element2_channel_.Set(data, active_modules_);
   return vaf::Result<void>{};
 }
 
@@ -168,6 +136,7 @@ void MyServiceModule::RegisterOperationHandler_MyVoidOperation(std::function<voi
 }
 
 ::vaf::Future<void> MyServiceModule::MyVoidOperation(const std::uint64_t& in) {
+  VAF_TRACE_SCOPE("vaf.rpc", "MyVoidOperation", "MyServiceModule");
   ::vaf::internal::Promise<void> p;
 
   if(MyVoidOperation_handler_) {
@@ -186,6 +155,7 @@ void MyServiceModule::RegisterOperationHandler_MyOperation(std::function<test::M
 }
 
 ::vaf::Future<test::MyOperation::Output> MyServiceModule::MyOperation(const std::uint64_t& in, const std::uint64_t& inout) {
+  VAF_TRACE_SCOPE("vaf.rpc", "MyOperation", "MyServiceModule");
   ::vaf::internal::Promise<test::MyOperation::Output> p;
 
   if(MyOperation_handler_) {
@@ -198,4 +168,25 @@ void MyServiceModule::RegisterOperationHandler_MyOperation(std::function<test::M
   return ::vaf::internal::CreateVafFutureFromVafPromise<test::MyOperation::Output>(p);
 }
 
+void MyServiceModule::RegisterOperationHandler_my_data_element1_FieldGetter(std::function<test::my_data_element1_FieldGetter::Output()>&& f) {
+  my_data_element1_FieldGetter_handler_ = std::move(f);
+}
+
+::vaf::Future<test::my_data_element1_FieldGetter::Output> MyServiceModule::my_data_element1_FieldGetter() {
+  VAF_TRACE_SCOPE("vaf.rpc", "my_data_element1_FieldGetter", "MyServiceModule");
+  ::vaf::internal::Promise<test::my_data_element1_FieldGetter::Output> p;
+
+  // The field is answered from its latest notification, the handler only until the first one
+  if (my_data_element1_channel_.HasPublished()) {
+    p.set_value(test::my_data_element1_FieldGetter::Output{my_data_element1_channel_.Load()});
+  } else if(my_data_element1_FieldGetter_handler_) {
+    p.set_value(my_data_element1_FieldGetter_handler_());
+  } else {
+    vaf::Error error_code{::vaf::ErrorCode::kNotOk, "No operation handler registered for my_data_element1_FieldGetter."};
+    vaf::internal::SetVafErrorCodeToPromise(p, error_code);
+  }
+
+  return ::vaf::internal::CreateVafFutureFromVafPromise<test::my_data_element1_FieldGetter::Output>(p);
+}
+
 } // namespace test
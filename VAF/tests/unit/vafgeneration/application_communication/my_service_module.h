@@ -19,11 +19,13 @@
 #include <memory>
 
 #include "vaf/container_types.h"
-#include "vaf/receiver_handler_container.h"
 #include "vaf/controller_interface.h"
+#include "vaf/data_element_channel.h"
 #include "vaf/data_ptr.h"
 #include "vaf/executable_controller_interface.h"
+#include "vaf/module_id.h"
 #include "vaf/result.h"
+#include "vaf/internal/handler_queue.h"
 
 #include "test/my_interface_consumer.h"
 #include "test/my_interface_provider.h"
@@ -45,8 +47,9 @@ class MyServiceModule
   void Start() noexcept override;
   void Stop() noexcept override;
   void DeInit() noexcept override;
-  void StartEventHandlerForModule(const vaf::String& module) override;
-  void StopEventHandlerForModule(const vaf::String& module) override;
+  void StartEventHandlerForModule(vaf::ModuleId module) override;
+  void StopEventHandlerForModule(vaf::ModuleId module) override;
+  vaf::Vector<vaf::MemoryUsage> GetMemoryUsage() const override;
 
   ::vaf::Result<::vaf::ConstDataPtr<const std::uint64_t>> GetAllocated_my_data_element1() override;
   std::uint64_t Get_my_data_element1() override;
@@ -58,6 +61,7 @@ class MyServiceModule
   ::vaf::Result<::vaf::ConstDataPtr<const std::uint64_t>> GetAllocated_my_data_element2() override;
   std::uint64_t Get_my_data_element2() override;
   void RegisterDataElementHandler_my_data_element2(vaf::String owner, std::function<void(const ::vaf::ConstDataPtr<const std::uint64_t>)>&& f) override;
+  ::vaf::Result<::vaf::Vector<::vaf::ConstDataPtr<const std::uint64_t>>> GetAllocatedHistory_my_data_element2(std::uint64_t& last_sequence) override;
 
   ::vaf::Result<::vaf::DataPtr<std::uint64_t>> Allocate_my_data_element2() override;
   ::vaf::Result<void> SetAllocated_my_data_element2(::vaf::DataPtr<std::uint64_t>&& data) override;
@@ -67,18 +71,21 @@ class MyServiceModule
   void RegisterOperationHandler_MyVoidOperation(std::function<void(const std::uint64_t&)>&& f) override;
   ::vaf::Future<test::MyOperation::Output> MyOperation(const std::uint64_t& in, const std::uint64_t& inout) override;
   void RegisterOperationHandler_MyOperation(std::function<test::MyOperation::Output(const std::uint64_t&, const std::uint64_t&)>&& f) override;
+  ::vaf::Future<test::my_data_element1_FieldGetter::Output> my_data_element1_FieldGetter() override;
+  void RegisterOperationHandler_my_data_element1_FieldGetter(std::function<test::my_data_element1_FieldGetter::Output()>&& f) override;
 
  private:
   vaf::ModuleExecutor& executor_;
-  vaf::Vector<vaf::String> active_modules_;
+  // Runs the queued handlers in the context of the subscribing modules
+  vaf::Executor& handler_executor_;
+  vaf::ModuleSet active_modules_{};
 
-  vaf::ConstDataPtr<const std::uint64_t> my_data_element1_sample_{std::make_unique<std::uint64_t>()};
-  vaf::Vector<vaf::ReceiverHandlerContainer<std::function<void(const ::vaf::ConstDataPtr<const std::uint64_t>)>>> my_data_element1_handlers_;
-  vaf::ConstDataPtr<const std::uint64_t> my_data_element2_sample_{std::make_unique<std::uint64_t>()};
-  vaf::Vector<vaf::ReceiverHandlerContainer<std::function<void(const ::vaf::ConstDataPtr<const std::uint64_t>)>>> my_data_element2_handlers_;
+  vaf::DataElementChannel<std::uint64_t, vaf::ProvidedChannelPolicy<false, false>> my_data_element1_channel_{"my_data_element1", vaf::MetricLabels{ {"module", "MyServiceModule"}, {"data_element", "my_data_element1"} }, 0, 0 };
+  vaf::DataElementChannel<std::uint64_t, vaf::ProvidedChannelPolicy<false, true>> my_data_element2_channel_{"my_data_element2", vaf::MetricLabels{ {"module", "MyServiceModule"}, {"data_element", "my_data_element2"} }, 0, 4 };
 
   std::function<void(const std::uint64_t&)> MyVoidOperation_handler_;
   std::function<test::MyOperation::Output(const std::uint64_t&, const std::uint64_t&)> MyOperation_handler_;
+  std::function<test::my_data_element1_FieldGetter::Output()> my_data_element1_FieldGetter_handler_;
 
 };
 
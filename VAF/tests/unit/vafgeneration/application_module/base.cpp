@@ -26,8 +26,10 @@ MyApplicationModuleBase::MyApplicationModuleBase(ConstructorToken&& token)
       p_interface_instance_2_{std::move(token.p_interface_instance_2_)},
       persistency_my_file1_{std::move(token.persistency_my_file1_)}
   {
-  executor_.RunPeriodic("task1", std::chrono::milliseconds{ 10 }, [this]() { task1(); }, {}, token.task_offset_task1_, token.task_budget_task1_);
-  executor_.RunPeriodic("task2", std::chrono::milliseconds{ 20 }, [this]() { task2(); }, {"task1"}, token.task_offset_task2_, token.task_budget_task2_);
+  executor_.RunPeriodic(token.task_executor_task1_ != nullptr ? *token.task_executor_task1_ : token.executor_,
+    "task1", std::chrono::milliseconds{ 10 }, [this]() { task1(); }, {}, token.task_offset_task1_, token.task_budget_task1_);
+  executor_.RunPeriodic(token.task_executor_task2_ != nullptr ? *token.task_executor_task2_ : token.executor_,
+    "task2", std::chrono::milliseconds{ 20 }, [this]() { task2(); }, {"task1"}, token.task_offset_task2_, token.task_budget_task2_);
 }
 
 } // namespace apps
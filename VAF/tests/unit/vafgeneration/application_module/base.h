@@ -42,8 +42,12 @@ class MyApplicationModuleBase : public vaf::ControlInterface {
     std::shared_ptr<persistency::PersistencyInterface> persistency_my_file1_;
     uint64_t task_offset_task1_;
     std::chrono::nanoseconds task_budget_task1_;
+    // Executor of the executable the task is mapped to, the executor of the module if null
+    vaf::Executor* task_executor_task1_;
     uint64_t task_offset_task2_;
     std::chrono::nanoseconds task_budget_task2_;
+    // Executor of the executable the task is mapped to, the executor of the module if null
+    vaf::Executor* task_executor_task2_;
   };
 
   MyApplicationModuleBase(ConstructorToken&& token);
@@ -25,4 +25,14 @@ MyApplicationModuleBase::MyApplicationModuleBase(ConstructorToken&& token):
       persistency_my_file1_{std::move(token.persistency_my_file1_)}{
 }
 
+void MyApplicationModuleBase::RunTasksFor(std::chrono::nanoseconds duration) {
+  if (!test_executor_) {
+    test_time_source_ = std::make_shared<vaf::ManualTimeSource>();
+    test_executor_ = std::make_unique<vaf::Executor>(std::chrono::milliseconds{ 10 }, 1, test_time_source_);
+    test_executor_->RunPeriodic("task1", std::chrono::milliseconds{ 10 }, [this]() { task1(); }, "MyApplicationModule", {}, {}, 0, std::chrono::nanoseconds{0}, 0)->Start();
+    test_executor_->RunPeriodic("task2", std::chrono::milliseconds{ 20 }, [this]() { task2(); }, "MyApplicationModule", {}, {"task1"}, 0, std::chrono::nanoseconds{0}, 0)->Start();
+  }
+  test_time_source_->AdvanceBy(duration);
+}
+
 } // namespace apps
@@ -16,8 +16,10 @@
 #ifndef APPS_MY_APPLICATION_MODULE_BASE_H
 #define APPS_MY_APPLICATION_MODULE_BASE_H
 
+#include <chrono>
 #include <memory>
 #include "vaf/controller_interface.h"
+#include "vaf/executor.h"
 
 #include "test/my_interface_consumer.h"
 #include "test/my_interface_provider.h"
@@ -45,12 +47,23 @@ class MyApplicationModuleBase {
   virtual void task1() = 0;
   virtual void task2() = 0;
 
+  /*!
+   * \brief Runs the tasks for the given time on an executor that follows a vaf::ManualTimeSource, not the clock.
+   * The time slots are executed as fast as the tasks allow, the first call starts with the time slot at zero.
+   */
+  void RunTasksFor(std::chrono::nanoseconds duration);
+
  protected:
   std::shared_ptr<test::MyInterfaceConsumer> c_interface_instance_1_;
   std::shared_ptr<test::MyInterfaceConsumer> c_interface_instance_2_;
   std::shared_ptr<test::MyInterfaceProvider> p_interface_instance_1_;
   std::shared_ptr<test::MyInterfaceProvider> p_interface_instance_2_;
   std::shared_ptr<persistency::PersistencyInterface> persistency_my_file1_;
+
+ private:
+  std::shared_ptr<vaf::ManualTimeSource> test_time_source_{};
+  // Destroyed first, as its thread waits for the time source
+  std::unique_ptr<vaf::Executor> test_executor_{};
 };
 
 } // namespace apps
@@ -0,0 +1,61 @@
+/*!********************************************************************************************************************
+ *  COPYRIGHT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  Copyright (c) 2024-2026 by Vector Informatik GmbH. All rights reserved.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -----------------------------------------------------------------------------------------------------------------*/
+/*!        \file  communication_benchmark.cpp
+ *         \brief
+ *
+ *********************************************************************************************************************/
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+#include "benchmark/benchmark.h"
+#include "vaf/executable_controller_interface.h"
+#include "vaf/executor.h"
+#include "test/my_service_module.h"
+
+namespace {
+
+// Largest number of subscribing modules of a data element
+constexpr std::int64_t kMaxHandlers{16};
+
+class BenchmarkController final : public vaf::ExecutableControllerInterface {
+ public:
+  void ReportOperationalOfModule(vaf::String) override {}
+  void SkipStartingOfModule(vaf::String) override {}
+  void ReportErrorOfModule(const vaf::Error&, vaf::String, bool) override {}
+};
+
+vaf::String HandlerOwner(std::int64_t index) {
+  vaf::String owner{"BenchmarkConsumer"};
+  owner += std::to_string(index).c_str();
+  return owner;
+}
+
+// Set of my_data_element of MyServiceModule depending on the number of handlers it fans out to
+void BM_MyServiceModule_my_data_element(benchmark::State& state) {
+  vaf::Executor executor{std::chrono::milliseconds{10}};
+  BenchmarkController controller{};
+  test::MyServiceModule service_module{executor, "MyServiceModule", {}, controller};
+  for (std::int64_t i = 0; i < state.range(0); ++i) {
+    service_module.RegisterDataElementHandler_my_data_element(HandlerOwner(i), [](const ::vaf::ConstDataPtr<const test::MyStruct> sample) {
+      benchmark::DoNotOptimize(*sample);
+    });
+  }
+  const test::MyStruct value{};
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(service_module.Set_my_data_element(value));
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_MyServiceModule_my_data_element)->Arg(0)->RangeMultiplier(4)->Range(1, kMaxHandlers);
+
+}  // namespace
@@ -0,0 +1,145 @@
+/*!********************************************************************************************************************
+ *  COPYRIGHT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  Copyright (c) 2024-2026 by Vector Informatik GmbH. All rights reserved.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -----------------------------------------------------------------------------------------------------------------*/
+/*!        \file  core_benchmark.cpp
+ *         \brief
+ *
+ *********************************************************************************************************************/
+
+#include <array>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include "benchmark/benchmark.h"
+#include "vaf/data_ptr.h"
+#include "vaf/executor.h"
+#include "vaf/internal/data_ptr_helper.h"
+#include "vaf/internal/latest_value.h"
+#include "vaf/internal/sample_pool.h"
+
+namespace {
+
+// Time slots executed per benchmark iteration, so the hand-over to the executor thread is not measured
+constexpr std::uint64_t kTimeSlots{1000};
+
+using LargeSample = std::array<std::uint8_t, 1024>;
+
+/*!
+ * \brief Time source that lets the executor run a given number of time slots as fast as it can.
+ */
+class ManualTimeSource final : public vaf::TimeSource {
+ public:
+  bool WaitUntil(std::chrono::nanoseconds) override {
+    std::unique_lock<std::mutex> lock{mutex_};
+    if (remaining_ == 0) {
+      waiting_ = true;
+      done_.notify_all();
+      advanced_.wait(lock, [this]() { return (remaining_ != 0) || interrupted_; });
+      waiting_ = false;
+    }
+    if (interrupted_) {
+      return false;
+    }
+    --remaining_;
+    return true;
+  }
+
+  void Interrupt() override {
+    std::lock_guard<std::mutex> lock{mutex_};
+    interrupted_ = true;
+    advanced_.notify_all();
+  }
+
+  // Executes the given number of time slots and returns when the executor waits for the next one
+  void Advance(std::uint64_t time_slots) {
+    std::unique_lock<std::mutex> lock{mutex_};
+    remaining_ = time_slots;
+    advanced_.notify_all();
+    done_.wait(lock, [this]() { return (remaining_ == 0) && waiting_; });
+  }
+
+ private:
+  std::mutex mutex_{};
+  std::condition_variable advanced_{};
+  std::condition_variable done_{};
+  std::uint64_t remaining_{0};
+  bool waiting_{false};
+  bool interrupted_{false};
+};
+
+// Overhead of a time slot of the executor depending on the number of periodic tasks
+void BM_ExecutorTimeSlot(benchmark::State& state) {
+  auto time_source = std::make_shared<ManualTimeSource>();
+  vaf::Executor executor{std::chrono::milliseconds{1}, 1, time_source};
+  std::uint64_t executions{0};
+  vaf::Vector<std::shared_ptr<vaf::TaskHandle>> tasks{};
+  for (std::int64_t i = 0; i < state.range(0); ++i) {
+    vaf::String name{"task"};
+    name += std::to_string(i).c_str();
+    tasks.push_back(executor.RunPeriodic(name, std::chrono::milliseconds{1}, [&executions]() { ++executions; },
+                                         "BenchmarkModule", {}));
+    tasks.back()->Start();
+  }
+
+  for (auto _ : state) {
+    time_source->Advance(kTimeSlots);
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(kTimeSlots));
+  state.counters["executions"] = static_cast<double>(executions);
+}
+BENCHMARK(BM_ExecutorTimeSlot)->RangeMultiplier(4)->Range(1, 256)->UseRealTime();
+
+// Allocate, set and get of a sample on the heap, as done by Allocate_, SetAllocated_ and GetAllocated_
+template <typename T>
+void BM_DataPtr(benchmark::State& state) {
+  const T value{};
+  for (auto _ : state) {
+    vaf::DataPtr<T> sample{vaf::MakeDataPtr<T>()};
+    *sample = value;
+    const vaf::ConstDataPtr<const T> published{vaf::internal::DataPtrHelper<T>::toConstDataPtr(sample)};
+    benchmark::DoNotOptimize(*published);
+  }
+}
+BENCHMARK_TEMPLATE(BM_DataPtr, std::uint64_t);
+BENCHMARK_TEMPLATE(BM_DataPtr, LargeSample);
+
+// The same from the sample pool of a data element with a SamplePoolSize
+template <typename T>
+void BM_SamplePool(benchmark::State& state) {
+  vaf::internal::SamplePool<T> pool{4};
+  const T value{};
+  for (auto _ : state) {
+    vaf::DataPtr<T> sample{pool.Allocate()};
+    *sample = value;
+    const vaf::ConstDataPtr<const T> published{vaf::internal::DataPtrHelper<T>::toConstDataPtr(sample)};
+    benchmark::DoNotOptimize(*published);
+  }
+}
+BENCHMARK_TEMPLATE(BM_SamplePool, std::uint64_t);
+BENCHMARK_TEMPLATE(BM_SamplePool, LargeSample);
+
+// Set and Get of the latest value of a data element, small samples are stored inline
+template <typename T>
+void BM_LatestValue(benchmark::State& state) {
+  vaf::internal::LatestValue<T> latest_value{};
+  const T value{};
+  for (auto _ : state) {
+    latest_value.Store(value);
+    benchmark::DoNotOptimize(latest_value.Load());
+  }
+}
+BENCHMARK_TEMPLATE(BM_LatestValue, std::uint64_t);
+BENCHMARK_TEMPLATE(BM_LatestValue, LargeSample);
+
+}  // namespace
@@ -0,0 +1,88 @@
+/*!********************************************************************************************************************
+ *  COPYRIGHT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  Copyright (c) 2024-2026 by Vector Informatik GmbH. All rights reserved.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -----------------------------------------------------------------------------------------------------------------*/
+/*!        \file  persistency_benchmark.cpp
+ *         \brief
+ *
+ *********************************************************************************************************************/
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+
+#include "benchmark/benchmark.h"
+#include "vaf/container_types.h"
+#include "persistency/mmap_persistency.h"
+
+namespace {
+
+// Opens a new file below the temporary directory, a file left by an earlier run is removed first
+template <typename Persistency>
+bool OpenFile(benchmark::State& state, Persistency& persistency, const char* name) {
+  const std::filesystem::path path{std::filesystem::temp_directory_path() / name};
+  std::filesystem::remove_all(path);
+  if (!persistency.Open(path.string().c_str(), false).HasValue()) {
+    state.SkipWithError("Could not open the persistency file");
+    return false;
+  }
+  return true;
+}
+
+void BM_MmapPersistency_SetUInt64(benchmark::State& state) {
+  persistency::MmapPersistency persistency{};
+  if (!OpenFile(state, persistency, "vaf_benchmark_mmap")) {
+    return;
+  }
+  std::uint64_t value{0};
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(persistency.Set_UInt64Value("benchmark", ++value));
+  }
+}
+BENCHMARK(BM_MmapPersistency_SetUInt64);
+
+void BM_MmapPersistency_GetUInt64(benchmark::State& state) {
+  persistency::MmapPersistency persistency{};
+  if (!OpenFile(state, persistency, "vaf_benchmark_mmap")) {
+    return;
+  }
+  static_cast<void>(persistency.Set_UInt64Value("benchmark", 1));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(persistency.Get_UInt64Value("benchmark"));
+  }
+}
+BENCHMARK(BM_MmapPersistency_GetUInt64);
+
+void BM_MmapPersistency_SetString(benchmark::State& state) {
+  persistency::MmapPersistency persistency{};
+  if (!OpenFile(state, persistency, "vaf_benchmark_mmap")) {
+    return;
+  }
+  const vaf::String value(static_cast<std::size_t>(state.range(0)), 'x');
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(persistency.Set_StringValue("benchmark", value));
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_MmapPersistency_SetString)->RangeMultiplier(8)->Range(8, 4096);
+
+void BM_MmapPersistency_GetString(benchmark::State& state) {
+  persistency::MmapPersistency persistency{};
+  if (!OpenFile(state, persistency, "vaf_benchmark_mmap")) {
+    return;
+  }
+  static_cast<void>(persistency.Set_StringValue("benchmark", vaf::String(static_cast<std::size_t>(state.range(0)), 'x')));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(persistency.Get_StringValue("benchmark"));
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_MmapPersistency_GetString)->RangeMultiplier(8)->Range(8, 4096);
+
+}  // namespace
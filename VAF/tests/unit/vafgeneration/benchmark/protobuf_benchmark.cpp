@@ -0,0 +1,72 @@
+/*!********************************************************************************************************************
+ *  COPYRIGHT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  Copyright (c) 2024-2026 by Vector Informatik GmbH. All rights reserved.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -----------------------------------------------------------------------------------------------------------------*/
+/*!        \file  protobuf_benchmark.cpp
+ *         \brief
+ *
+ *********************************************************************************************************************/
+
+#include <cstddef>
+#include <cstdint>
+
+#include "benchmark/benchmark.h"
+#include "protobuf/test/protobuf_transformer.h"
+
+namespace {
+
+void BM_VafToProto_test_MyStruct(benchmark::State& state) {
+  ::test::MyStruct value{};
+  ::protobuf::test::MyStruct proto{};
+  for (auto _ : state) {
+    ::protobuf::test::MyStructVafToProto(value, proto);
+    benchmark::DoNotOptimize(proto);
+  }
+  state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(proto.ByteSizeLong()));
+}
+BENCHMARK(BM_VafToProto_test_MyStruct);
+
+void BM_ProtoToVaf_test_MyStruct(benchmark::State& state) {
+  ::test::MyStruct value{};
+  ::protobuf::test::MyStruct proto{};
+  ::protobuf::test::MyStructVafToProto(value, proto);
+  for (auto _ : state) {
+    ::protobuf::test::MyStructProtoToVaf(proto, value);
+    benchmark::DoNotOptimize(value);
+  }
+  state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(proto.ByteSizeLong()));
+}
+BENCHMARK(BM_ProtoToVaf_test_MyStruct);
+
+void BM_VafToProto_test_MyVector(benchmark::State& state) {
+  ::test::MyVector value{};
+  value.resize(static_cast<std::size_t>(state.range(0)));
+  ::protobuf::test::MyVector proto{};
+  for (auto _ : state) {
+    ::protobuf::test::MyVectorVafToProto(value, proto);
+    benchmark::DoNotOptimize(proto);
+  }
+  state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(proto.ByteSizeLong()));
+}
+BENCHMARK(BM_VafToProto_test_MyVector)->RangeMultiplier(8)->Range(1, 512);
+
+void BM_ProtoToVaf_test_MyVector(benchmark::State& state) {
+  ::test::MyVector value{};
+  value.resize(static_cast<std::size_t>(state.range(0)));
+  ::protobuf::test::MyVector proto{};
+  ::protobuf::test::MyVectorVafToProto(value, proto);
+  for (auto _ : state) {
+    ::protobuf::test::MyVectorProtoToVaf(proto, value);
+    benchmark::DoNotOptimize(value);
+  }
+  state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(proto.ByteSizeLong()));
+}
+BENCHMARK(BM_ProtoToVaf_test_MyVector)->RangeMultiplier(8)->Range(1, 512);
+
+}  // namespace
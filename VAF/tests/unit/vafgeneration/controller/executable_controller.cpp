@@ -15,6 +15,14 @@
 
 #include "executable_controller/executable_controller.h"
 
+#include <array>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "vaf/boot_profile.h"
+#include "vaf/module_table.h"
+#include "vaf/numa.h"
 #include "vaf/output_sync_stream.h"
 #include "test/my_module1.h"
 #include "test/my_module2.h"
@@ -25,83 +33,154 @@
 
 #include "persistency/persistency.h"
 #include "vaf/result.h"
+#include "vaf/silkit/participant.h"
 
 namespace executable_controller {
 
+namespace {
+
+// The modules in the order of their registration, their dependencies are taken from here on DoInitialize
+constexpr vaf::ModuleTable<6> kModuleTable{
+    { "MyModule3", "MyModule4", "MyModule1", "MyModule2", "MyApp1", "MyApp2" },
+    { 0x0, 0x0, 0x0, 0x0, 0xd, 0x0 },
+    { false, false, false, false, false, false }};
+static_assert(kModuleTable.HasUniqueNames(), "Each module of the executable needs a name of its own");
+static_assert(kModuleTable.IsAcyclic(), "The modules of the executable depend on each other in a cycle");
+
+// The periodic tasks of the application modules
+constexpr std::array<vaf::TaskInfo, 3> kTaskSchedule{ {
+    {"MyApp1", "R1", 10000000, 0},
+    {"MyApp1", "R2", 20000000, 1},
+    {"MyApp2", "R1", 10000000, 0}
+} };
+static_assert(vaf::IsScheduleValid(kTaskSchedule, 10000000), "A task period is shorter than the executor period");
+
+// The periodic tasks mapped to the executor Fast
+constexpr std::array<vaf::TaskInfo, 1> kTaskScheduleFast{ {
+    {"MyApp2", "R2", 20000000, 1}
+} };
+static_assert(vaf::IsScheduleValid(kTaskScheduleFast, 1000000), "A task period is shorter than the period of the executor Fast");
+
+}  // namespace
+
 ExecutableController::ExecutableController()
   : ExecutableControllerBase(),
-    executor_{} {
+    executor_{},
+    executor_Fast_{} {
 }
 
 void ExecutableController::DoInitialize() {
+  const vaf::BootProfile::Clock::time_point construction_start{vaf::BootProfile::Clock::now()};
   executor_ = std::make_unique<vaf::Executor>(std::chrono::milliseconds{ 10 });
-  auto Persistency_MyApp1_MyFile1 = std::make_shared<persistency::Persistency>();
-  ::vaf::Result<void> result_MyApp1_MyFile1 = Persistency_MyApp1_MyFile1->Open("./MyFile1.db", true);
-  if(!result_MyApp1_MyFile1.HasValue()){
-    vaf::OutputSyncStream{} << "Could not open persistency kvs storage: ./MyFile1.db." << std::endl;
-    ReportErrorOfModule(result_MyApp1_MyFile1.Error(), "ExecutableController::DoInitialize", true);
+  executor_Fast_ = std::make_unique<vaf::Executor>(std::chrono::milliseconds{ 1 });
+  vaf::ThreadAttributes executor_thread_attributes_Fast{};
+  executor_thread_attributes_Fast.scheduling_policy = vaf::SchedulingPolicy::kFifo;
+  executor_thread_attributes_Fast.priority = 60;
+  executor_thread_attributes_Fast.numa_node = 1;
+  ::vaf::Result<void> result_thread_attributes_Fast = executor_Fast_->SetThreadAttributes(executor_thread_attributes_Fast);
+  if(!result_thread_attributes_Fast.HasValue()){
+    vaf::OutputSyncStream{} << "Could not set executor Fast thread attributes: " << result_thread_attributes_Fast.Error().UserMessage() << std::endl;
+    ReportErrorOfModule(result_thread_attributes_Fast.Error(), "ExecutableController::DoInitialize", false);
   }
-  auto Persistency_MyApp2_MyFile2 = std::make_shared<persistency::Persistency>();
-  ::vaf::Result<void> result_MyApp2_MyFile2 = Persistency_MyApp2_MyFile2->Open("./MyFile2.db", true);
-  if(!result_MyApp2_MyFile2.HasValue()){
-    vaf::OutputSyncStream{} << "Could not open persistency kvs storage: ./MyFile2.db." << std::endl;
-    ReportErrorOfModule(result_MyApp2_MyFile2.Error(), "ExecutableController::DoInitialize", true);
+  ::vaf::Result<vaf::Vector<std::size_t>> result_numa_node_0 = vaf::NumaNodeCpus(0);
+  if(!result_numa_node_0.HasValue()){
+    vaf::OutputSyncStream{} << "Could not place modules on NUMA node 0: " << result_numa_node_0.Error().UserMessage() << std::endl;
+    ReportErrorOfModule(result_numa_node_0.Error(), "ExecutableController::DoInitialize", false);
   }
+  metrics_exporter_ = std::make_unique<vaf::MetricsExporter>(*executor_, "/dev/shm/my_executable.prom", std::chrono::milliseconds{ 1000 });
+  // Each file is opened and seeded with its init values on its own thread while the modules are constructed
+  std::mutex persistency_report_mutex{};
+  auto report_persistency_error = [this, &persistency_report_mutex](const vaf::Error& error, bool critical) {
+    std::lock_guard<std::mutex> lock{persistency_report_mutex};
+    ReportErrorOfModule(error, "ExecutableController::DoInitialize", critical);
+  };
+  std::vector<std::thread> persistency_threads{};
+  auto Persistency_MyApp1_MyFile1 = std::make_shared<persistency::Persistency>();
+  persistency_threads.emplace_back([&report_persistency_error, Persistency_MyApp1_MyFile1]() {
+    vaf::BootProfile::Scope boot_phase{"Open ./MyFile1.db"};
+    ::vaf::Result<void> result = Persistency_MyApp1_MyFile1->Open("./MyFile1.db", true, std::chrono::milliseconds{ 100 });
+    if(!result.HasValue()){
+      vaf::OutputSyncStream{} << "Could not open persistency kvs storage: ./MyFile1.db." << std::endl;
+      report_persistency_error(result.Error(), true);
+    }
+    Persistency_MyApp1_MyFile1->BeginBatch();
+    auto Persistency_MyApp1_MyFile1_Key1Array_result = Persistency_MyApp1_MyFile1->Get_MyArrayValue("Key1Array");
+    if (!Persistency_MyApp1_MyFile1_Key1Array_result.HasValue()) {
+      vaf::OutputSyncStream{} << "Persistency_MyApp1_MyFile1: Key-Value Key1Array NOT initialized, set init value." << std::endl;
+      report_persistency_error(Persistency_MyApp1_MyFile1_Key1Array_result.Error(), false);
+      test::MyArray Persistency_MyApp1_MyFile1_Key1Array_value = { 1,2,3 };
+      Persistency_MyApp1_MyFile1->Set_MyArrayValue("Key1Array", Persistency_MyApp1_MyFile1_Key1Array_value);
+    }
+    Persistency_MyApp1_MyFile1->CommitBatch();
+  });
+  auto Persistency_MyApp2_MyFile2 = std::make_shared<persistency::Persistency>();
+  persistency_threads.emplace_back([&report_persistency_error, Persistency_MyApp2_MyFile2]() {
+    vaf::BootProfile::Scope boot_phase{"Open ./MyFile2.db"};
+    ::vaf::Result<void> result = Persistency_MyApp2_MyFile2->Open("./MyFile2.db", true, std::chrono::microseconds{0}, true, persistency::Persistency::TuningProfile::kTiny);
+    if(!result.HasValue()){
+      vaf::OutputSyncStream{} << "Could not open persistency kvs storage: ./MyFile2.db." << std::endl;
+      report_persistency_error(result.Error(), true);
+    }
+    Persistency_MyApp2_MyFile2->BeginBatch();
+    auto Persistency_MyApp2_MyFile2_Key2Array_result = Persistency_MyApp2_MyFile2->Get_MyArrayValue("Key2Array");
+    if (!Persistency_MyApp2_MyFile2_Key2Array_result.HasValue()) {
+      vaf::OutputSyncStream{} << "Persistency_MyApp2_MyFile2: Key-Value Key2Array NOT initialized, set init value." << std::endl;
+      report_persistency_error(Persistency_MyApp2_MyFile2_Key2Array_result.Error(), false);
+      test::MyArray Persistency_MyApp2_MyFile2_Key2Array_value = { 2,3,4 };
+      Persistency_MyApp2_MyFile2->Set_MyArrayValue("Key2Array", Persistency_MyApp2_MyFile2_Key2Array_value);
+    }
+    Persistency_MyApp2_MyFile2->CommitBatch();
+  });
   auto Persistency_SharedFile1 = std::make_shared<persistency::Persistency>();
-    ::vaf::Result<void> result1 = Persistency_SharedFile1->Open("./MyFileShared.db", true);
-  if(!result1.HasValue()){
-    vaf::OutputSyncStream{} << "Could not open persistency kvs storage: ./MyFileShared.db." << std::endl;
-    ReportErrorOfModule(result1.Error(), "ExecutableController::DoInitialize", true);
-  }
-  auto Persistency_MyApp1_MyFile1_Key1Array_result = Persistency_MyApp1_MyFile1->Get_MyArrayValue("Key1Array");
-  if (!Persistency_MyApp1_MyFile1_Key1Array_result.HasValue()) {
-    vaf::OutputSyncStream{} << "Persistency_MyApp1_MyFile1: Key-Value Key1Array NOT initialized, set init value." << std::endl;
-    ReportErrorOfModule(Persistency_MyApp1_MyFile1_Key1Array_result.Error(), "ExecutableController::DoInitialize", false);
-    test::MyArray Persistency_MyApp1_MyFile1_Key1Array_value = { 1,2,3 };
-    Persistency_MyApp1_MyFile1->Set_MyArrayValue("Key1Array", Persistency_MyApp1_MyFile1_Key1Array_value);
-  }
-  auto Persistency_SharedFile1_Key1Int_result = Persistency_SharedFile1->Get_UInt8Value("Key1Int");
-  if (!Persistency_SharedFile1_Key1Int_result.HasValue()) {
-    vaf::OutputSyncStream{} << "Persistency_SharedFile1: Key-Value Key1Int NOT initialized, set init value." << std::endl;
-    ReportErrorOfModule(Persistency_SharedFile1_Key1Int_result.Error(), "ExecutableController::DoInitialize", false);
-    Persistency_SharedFile1->Set_UInt8Value("Key1Int", 1);
-  }
-  auto Persistency_MyApp2_MyFile2_Key2Array_result = Persistency_MyApp2_MyFile2->Get_MyArrayValue("Key2Array");
-  if (!Persistency_MyApp2_MyFile2_Key2Array_result.HasValue()) {
-    vaf::OutputSyncStream{} << "Persistency_MyApp2_MyFile2: Key-Value Key2Array NOT initialized, set init value." << std::endl;
-    ReportErrorOfModule(Persistency_MyApp2_MyFile2_Key2Array_result.Error(), "ExecutableController::DoInitialize", false);
-    test::MyArray Persistency_MyApp2_MyFile2_Key2Array_value = { 2,3,4 };
-    Persistency_MyApp2_MyFile2->Set_MyArrayValue("Key2Array", Persistency_MyApp2_MyFile2_Key2Array_value);
-  }
-  auto Persistency_SharedFile1_Key2Int_result = Persistency_SharedFile1->Get_UInt8Value("Key2Int");
-  if (!Persistency_SharedFile1_Key2Int_result.HasValue()) {
-    vaf::OutputSyncStream{} << "Persistency_SharedFile1: Key-Value Key2Int NOT initialized, set init value." << std::endl;
-    ReportErrorOfModule(Persistency_SharedFile1_Key2Int_result.Error(), "ExecutableController::DoInitialize", false);
-    Persistency_SharedFile1->Set_UInt8Value("Key2Int", 2);
-  }
+  persistency_threads.emplace_back([&report_persistency_error, Persistency_SharedFile1]() {
+    vaf::BootProfile::Scope boot_phase{"Open ./MyFileShared.db"};
+    ::vaf::Result<void> result = Persistency_SharedFile1->Open("./MyFileShared.db", true, std::chrono::microseconds{0}, false, persistency::Persistency::TuningProfile::kReadHeavy);
+    if(!result.HasValue()){
+      vaf::OutputSyncStream{} << "Could not open persistency kvs storage: ./MyFileShared.db." << std::endl;
+      report_persistency_error(result.Error(), true);
+    }
+    Persistency_SharedFile1->BeginBatch();
+    auto Persistency_SharedFile1_Key1Int_result = Persistency_SharedFile1->Get_UInt8Value("Key1Int");
+    if (!Persistency_SharedFile1_Key1Int_result.HasValue()) {
+      vaf::OutputSyncStream{} << "Persistency_SharedFile1: Key-Value Key1Int NOT initialized, set init value." << std::endl;
+      report_persistency_error(Persistency_SharedFile1_Key1Int_result.Error(), false);
+      Persistency_SharedFile1->Set_UInt8Value("Key1Int", 1);
+    }
+    auto Persistency_SharedFile1_Key2Int_result = Persistency_SharedFile1->Get_UInt8Value("Key2Int");
+    if (!Persistency_SharedFile1_Key2Int_result.HasValue()) {
+      vaf::OutputSyncStream{} << "Persistency_SharedFile1: Key-Value Key2Int NOT initialized, set init value." << std::endl;
+      report_persistency_error(Persistency_SharedFile1_Key2Int_result.Error(), false);
+      Persistency_SharedFile1->Set_UInt8Value("Key2Int", 2);
+    }
+    Persistency_SharedFile1->CommitBatch();
+  });
+  compacted_on_shutdown_.push_back(Persistency_SharedFile1);
 
-  auto MyModule3 = std::make_shared<test::MyModule3>(
+  // One SIL Kit participant for all SIL Kit modules of this executable
+  vaf::silkit::CreateParticipant("MyExecutable");
+
+  auto MyModule3 = vaf::ConstructOnNumaNode(0, [&]() { return std::make_shared<test::MyModule3>(
     *executor_,
     "MyModule3",
-    *this);
+    *this); });
 
-  auto MyModule4 = std::make_shared<test::MyModule4>(
+  auto MyModule4 = vaf::ConstructOnNumaNode(0, [&]() { return std::make_shared<test::MyModule4>(
     *executor_,
     "MyModule4",
-    *this);
+    *this); });
 
-  auto MyModule2 = std::make_shared<test::MyModule2>(
+  auto MyModule2 = vaf::ConstructOnNumaNode(0, [&]() { return std::make_shared<test::MyModule2>(
     *executor_,
     "MyModule2",
-    *this);
+    *this); });
 
-  auto MyModule1 = std::make_shared<test::MyModule1>(
+  auto MyModule1 = vaf::ConstructOnNumaNode(0, [&]() { return std::make_shared<test::MyModule1>(
     *executor_,
     "MyModule1",
     vaf::Vector<vaf::String>{},
-    *this);
+    *this); });
 
-  auto MyApp1 = std::make_shared<test::MyApp1>( test::MyApp1::ConstructorToken{
+  auto MyApp1 = vaf::ConstructOnNumaNode(0, [&]() { return std::make_shared<test::MyApp1>( test::MyApp1::ConstructorToken{
     "MyApp1",
     vaf::Vector<vaf::String>{
       {"MyModule1"},
@@ -118,9 +197,11 @@ void ExecutableController::DoInitialize() {
     Persistency_SharedFile1
 ,    0,
     std::chrono::nanoseconds{ 10000000 },
+    nullptr,
     1,
-    std::chrono::nanoseconds{ 0 }
-    });
+    std::chrono::nanoseconds{ 0 },
+    nullptr
+    }); });
 
   auto MyApp2 = std::make_shared<test::MyApp2>( test::MyApp2::ConstructorToken{
     "MyApp2",
@@ -132,9 +213,17 @@ void ExecutableController::DoInitialize() {
     Persistency_SharedFile1
 ,    0,
     std::chrono::nanoseconds{ 10000000 },
+    nullptr,
     1,
-    std::chrono::nanoseconds{ 0 }
+    std::chrono::nanoseconds{ 0 },
+    executor_Fast_.get()
     });
+  vaf::BootProfile::GetInstance().Record("Construct modules", construction_start);
+
+  // Joined before the modules are registered, so the files are ready when Init() runs
+  for (std::thread& persistency_thread : persistency_threads) {
+    persistency_thread.join();
+  }
 
   RegisterModule(MyModule3);
 
@@ -146,17 +235,31 @@ void ExecutableController::DoInitialize() {
 
   RegisterModule(MyApp1);
 
-  RegisterModule(MyApp2);
+  RegisterModule(MyApp2, std::chrono::milliseconds{ 500 });
+  SetRestartPolicy("MyApp2", vaf::RestartPolicy::kBackoff, std::chrono::milliseconds{ 50 });
+  SetModuleTable(kModuleTable.View());
 
   ExecutableControllerBase::DoInitialize();
 }
 
 void ExecutableController::DoStart() {
   ExecutableControllerBase::DoStart();
+  metrics_exporter_->Start();
 }
 
 void ExecutableController::DoShutdown() {
   ExecutableControllerBase::DoShutdown();
+  // After the modules stopped, so the compaction does not delay their last cycles
+  for (const std::shared_ptr<persistency::PersistencyInterface>& persistency : compacted_on_shutdown_) {
+    ::vaf::Result<void> result = persistency->Compact();
+    if (!result.HasValue()) {
+      vaf::OutputSyncStream{} << "Could not compact persistency kvs storage: " << result.Error().UserMessage() << std::endl;
+    }
+  }
+  compacted_on_shutdown_.clear();
+  // After the modules stopped, so the last export has their final counts
+  metrics_exporter_->Stop();
+  vaf::silkit::DestroyParticipant();
 }
 
 } // namespace executable_controller
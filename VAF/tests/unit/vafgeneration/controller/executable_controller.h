@@ -17,9 +17,12 @@
 #define EXECUTABLE_CONTROLLER_EXECUTABLE_CONTROLLER_H
 
 #include <memory>
+#include <vector>
 
 #include "vaf/executable_controller_base.h"
 #include "vaf/executor.h"
+#include "vaf/metrics.h"
+#include "persistency/persistency_interface.h"
 
 namespace executable_controller {
 
@@ -35,6 +38,10 @@ class ExecutableController final : public vaf::ExecutableControllerBase {
 
  private:
   std::unique_ptr<vaf::Executor> executor_;
+  std::unique_ptr<vaf::Executor> executor_Fast_;
+  std::unique_ptr<vaf::MetricsExporter> metrics_exporter_;
+  // The persistency files compacted by DoShutdown
+  std::vector<std::shared_ptr<persistency::PersistencyInterface>> compacted_on_shutdown_{};
 };
 
 } // namespace executable_controller
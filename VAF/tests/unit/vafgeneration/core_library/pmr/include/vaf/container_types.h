@@ -0,0 +1,60 @@
+/*!********************************************************************************************************************
+ *  COPYRIGHT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  Copyright (c) 2024-2026 by Vector Informatik GmbH. All rights reserved.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -----------------------------------------------------------------------------------------------------------------*/
+/*!        \file  container_types.h
+ *         \brief
+ *
+ *********************************************************************************************************************/
+
+#ifndef VAF_H_
+#define VAF_H_
+
+#include <cstdint>
+#include <map>
+#include <memory_resource>
+#include <string>
+#include <vector>
+
+namespace vaf {
+
+template <typename CharT, typename Traits = std::char_traits<CharT>, typename Allocator = std::pmr::polymorphic_allocator<CharT>>
+using basic_string = std::basic_string<CharT, Traits, Allocator>;
+using String = basic_string<char>;
+
+template <typename T, typename Allocator = std::pmr::polymorphic_allocator<T>>
+using Vector = std::vector<T, Allocator>;
+
+template <typename K, typename V, typename C = std::less<K>, typename Allocator = std::pmr::polymorphic_allocator<std::pair<K const, V>>>
+using Map = std::map<K, V, C, Allocator>;
+
+template <typename T>
+using hash = std::hash<T>;
+
+/*!
+ * \brief Memory resource of the samples, a synchronized pool.
+ * vaf::Runtime makes it the default resource, so all containers allocate from it unless given another one.
+ */
+std::pmr::memory_resource* SampleMemoryResource() noexcept;
+
+/*!
+ * \brief Memory resource for temporaries of the executor task running on the calling thread.
+ * Allocations are never freed individually, the whole arena is released after each execution of the task. So memory
+ * from it must not be kept beyond the task execution.
+ */
+std::pmr::memory_resource* TaskMemoryResource() noexcept;
+
+namespace internal {
+// Releases the arena of TaskMemoryResource, called by the executor after every task execution
+void ReleaseTaskMemory() noexcept;
+}  // namespace internal
+
+}  // namespace vaf
+
+#endif  // VAF_H_
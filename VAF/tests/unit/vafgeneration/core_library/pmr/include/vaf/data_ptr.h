@@ -0,0 +1,320 @@
+/*!********************************************************************************************************************
+ *  COPYRIGHT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  Copyright (c) 2024-2026 by Vector Informatik GmbH. All rights reserved.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -----------------------------------------------------------------------------------------------------------------*/
+/*!        \file  data_ptr.h
+ *         \brief
+ *
+ *********************************************************************************************************************/
+
+#ifndef VAF_DATA_PTR_H_
+#define VAF_DATA_PTR_H_
+
+#include "vaf/container_types.h"
+#include "vaf/logging.h"
+#include "vaf/sample_trace.h"
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace vaf {
+
+    namespace internal {
+        template<typename T>
+        class DataPtrHelper;
+
+        /*!
+         * \brief Reference count of a sample, shared by all data pointers that refer to it.
+         * The last data pointer that releases its reference deletes the block.
+         */
+        template<typename T>
+        class DataPtrBlock {
+        public:
+            DataPtrBlock(const DataPtrBlock &) = delete;
+            DataPtrBlock &operator=(const DataPtrBlock &) = delete;
+            virtual ~DataPtrBlock() = default;
+
+            T *Get() const noexcept { return payload_; }
+
+            void AddReference(std::size_t count = 1) noexcept {
+                references_.fetch_add(count, std::memory_order_relaxed);
+            }
+
+            void Release() noexcept {
+                if (references_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                    delete this;
+                }
+            }
+
+            bool IsUnique() const noexcept { return references_.load(std::memory_order_acquire) == 1; }
+
+            // Set by the provider before it publishes the sample, while sample tracing is enabled
+            const SampleStamp &Stamp() const noexcept { return stamp_; }
+            void SetStamp(const SampleStamp &stamp) noexcept { stamp_ = stamp; }
+
+            // Hands out a payload that was allocated separately, a payload inside the block stays there
+            virtual std::unique_ptr<T> ReleasePayload() noexcept { return nullptr; }
+
+        protected:
+            DataPtrBlock() = default;
+
+            T *payload_{nullptr};
+
+        private:
+            std::atomic<std::size_t> references_{1};
+            SampleStamp stamp_{};
+        };
+
+        // Block that holds the payload in the same allocation
+        template<typename T>
+        class InlineDataPtrBlock final : public DataPtrBlock<T> {
+        public:
+            template<typename... Args>
+            explicit InlineDataPtrBlock(Args &&... args) : value_(std::forward<Args>(args)...) {
+                this->payload_ = &value_;
+            }
+
+            // Samples are allocated from the sample memory resource instead of the global heap
+            static void *operator new(std::size_t size) {
+                return vaf::SampleMemoryResource()->allocate(size, alignof(InlineDataPtrBlock));
+            }
+
+            static void operator delete(void *block, std::size_t size) noexcept {
+                vaf::SampleMemoryResource()->deallocate(block, size, alignof(InlineDataPtrBlock));
+            }
+
+        private:
+            T value_;
+        };
+
+        // Block that takes over a payload allocated by the user
+        template<typename T>
+        class AdoptingDataPtrBlock final : public DataPtrBlock<T> {
+        public:
+            explicit AdoptingDataPtrBlock(std::unique_ptr<T> &&value) : value_{std::move(value)} {
+                this->payload_ = value_.get();
+            }
+
+            std::unique_ptr<T> ReleasePayload() noexcept override {
+                this->payload_ = nullptr;
+                return std::move(value_);
+            }
+
+        private:
+            std::unique_ptr<T> value_;
+        };
+    }  // namespace internal
+
+    template<typename T>
+    class DataPtr;
+
+    template<typename T>
+    class ConstDataPtr;
+
+    template<typename T, typename... Args>
+    DataPtr<T> MakeDataPtr(Args &&... args);
+
+    template<typename T, typename... Args>
+    ConstDataPtr<T> MakeConstDataPtr(Args &&... args);
+
+    template<typename T>
+    class DataPtr {
+        friend internal::DataPtrHelper<T>;
+        template<typename U, typename... Args>
+        friend DataPtr<U> MakeDataPtr(Args &&... args);
+
+    public:
+        DataPtr() noexcept = default;
+
+        DataPtr (const DataPtr& other) noexcept : block_{other.block_}, ptr_{other.ptr_} {
+          if (block_ != nullptr) {
+            block_->AddReference();
+          }
+        }
+
+        DataPtr (DataPtr&& other) noexcept : block_{other.block_}, ptr_{other.ptr_} {
+          other.block_ = nullptr;
+          other.ptr_ = nullptr;
+        }
+
+        DataPtr(std::unique_ptr<T> &&ptr) {
+            if (ptr) {
+                block_ = new internal::AdoptingDataPtrBlock<T>{std::move(ptr)};
+                ptr_ = block_->Get();
+            }
+        }
+
+        ~DataPtr() { Reset(); }
+
+        T &operator*() noexcept { return *(this->operator->()); }
+
+        T *operator->() const noexcept {
+            if (ptr_ != nullptr) {
+                return ptr_;
+            }
+            vaf::LoggerSingleton::getInstance()->default_logger_.LogFatal() << "DataPtr is empty";
+            std::abort();
+        }
+
+        DataPtr& operator=(const DataPtr& other) noexcept {
+          DataPtr copy{other};
+          Swap(copy);
+          return *this;
+        }
+
+        DataPtr& operator=(DataPtr&& other) noexcept {
+          DataPtr moved{std::move(other)};
+          Swap(moved);
+          return *this;
+        }
+
+        explicit operator bool() const { return ptr_ != nullptr; }
+
+    private:
+        // Takes over one reference of the block
+        explicit DataPtr(internal::DataPtrBlock<T> *block) noexcept : block_{block}, ptr_{block->Get()} {}
+
+        void Reset() noexcept {
+            if (block_ != nullptr) {
+                block_->Release();
+            }
+            block_ = nullptr;
+            ptr_ = nullptr;
+        }
+
+        void Swap(DataPtr &other) noexcept {
+            std::swap(block_, other.block_);
+            std::swap(ptr_, other.ptr_);
+        }
+
+        internal::DataPtrBlock<T> *block_{nullptr};
+        T *ptr_{nullptr};
+    };
+
+    template<typename T>
+    class ConstDataPtr {
+        // The block always holds the non-const type, so a DataPtr can be handed over without a copy
+        using Value = std::remove_const_t<T>;
+
+        friend internal::DataPtrHelper<Value>;
+        template<typename U, typename... Args>
+        friend ConstDataPtr<U> MakeConstDataPtr(Args &&... args);
+
+    public:
+        ConstDataPtr() noexcept = default;
+
+        ConstDataPtr (const ConstDataPtr& other) noexcept : block_{other.block_}, ptr_{other.ptr_} {
+          if (block_ != nullptr) {
+            block_->AddReference();
+          }
+        }
+
+        ConstDataPtr (ConstDataPtr&& other) noexcept : block_{other.block_}, ptr_{other.ptr_} {
+          other.block_ = nullptr;
+          other.ptr_ = nullptr;
+        }
+
+        ConstDataPtr(std::unique_ptr<T> &&ptr) {
+            if (ptr) {
+                // The payload is only ever accessed as const through this block
+                block_ = new internal::AdoptingDataPtrBlock<Value>{
+                    std::unique_ptr<Value>{const_cast<Value *>(ptr.release())}};
+                ptr_ = block_->Get();
+            }
+        }
+
+        ~ConstDataPtr() { Reset(); }
+
+        const T &operator*() const noexcept { return *(this->operator->()); }
+
+        const T *operator->() const noexcept {
+            if (ptr_ != nullptr) {
+                return ptr_;
+            }
+            vaf::LoggerSingleton::getInstance()->default_logger_.LogFatal() << "DataPtr is empty";
+            std::abort();
+        }
+
+        ConstDataPtr& operator=(const ConstDataPtr& other) noexcept {
+          ConstDataPtr copy{other};
+          Swap(copy);
+          return *this;
+        }
+
+        ConstDataPtr& operator=(ConstDataPtr&& other) noexcept {
+          ConstDataPtr moved{std::move(other)};
+          Swap(moved);
+          return *this;
+        }
+
+        explicit operator bool() const { return ptr_ != nullptr; }
+
+        // Moves the sample out if this is the only pointer to it, otherwise the caller gets a copy
+        std::unique_ptr<T> getRawPtr() {
+            if (block_ == nullptr) {
+                return std::unique_ptr<T>{};
+            }
+            std::unique_ptr<T> raw_ptr{};
+            if (block_->IsUnique()) {
+                raw_ptr = block_->ReleasePayload();
+                if (!raw_ptr) {
+                    raw_ptr = std::make_unique<T>(std::move(*block_->Get()));
+                }
+            } else {
+                raw_ptr = std::make_unique<T>(*ptr_);
+            }
+            Reset();
+            return raw_ptr;
+        };
+
+    private:
+        // Takes over one reference of the block
+        explicit ConstDataPtr(internal::DataPtrBlock<Value> *block) noexcept : block_{block}, ptr_{block->Get()} {}
+
+        void Reset() noexcept {
+            if (block_ != nullptr) {
+                block_->Release();
+            }
+            block_ = nullptr;
+            ptr_ = nullptr;
+        }
+
+        void Swap(ConstDataPtr &other) noexcept {
+            std::swap(block_, other.block_);
+            std::swap(ptr_, other.ptr_);
+        }
+
+        internal::DataPtrBlock<Value> *block_{nullptr};
+        const T *ptr_{nullptr};
+    };
+
+    /*!
+     * \brief Creates a sample and its reference count with a single allocation.
+     * \param args The arguments for the constructor of the sample.
+     */
+    template<typename T, typename... Args>
+    DataPtr<T> MakeDataPtr(Args &&... args) {
+        return DataPtr<T>{new internal::InlineDataPtrBlock<T>{std::forward<Args>(args)...}};
+    }
+
+    /*!
+     * \brief Creates a constant sample and its reference count with a single allocation.
+     * \param args The arguments for the constructor of the sample.
+     */
+    template<typename T, typename... Args>
+    ConstDataPtr<T> MakeConstDataPtr(Args &&... args) {
+        return ConstDataPtr<T>{new internal::InlineDataPtrBlock<std::remove_const_t<T>>{std::forward<Args>(args)...}};
+    }
+
+}  // namespace vaf
+
+#endif  // VAF_DATA_PTR_H_
@@ -0,0 +1,1008 @@
+/*!********************************************************************************************************************
+ *  COPYRIGHT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  Copyright (c) 2024-2026 by Vector Informatik GmbH. All rights reserved.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -----------------------------------------------------------------------------------------------------------------*/
+/*!        \file  executor.cpp
+ *         \brief
+ *
+ *********************************************************************************************************************/
+
+#include "vaf/executor.h"
+
+#include <alloca.h>
+#include <pthread.h>
+#include <sched.h>
+#include <sys/mman.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <numeric>
+#include <queue>
+
+#include "vaf/allocation_tracking.h"
+#include "vaf/numa.h"
+#include "vaf/output_sync_stream.h"
+#include "vaf/trace.h"
+
+namespace vaf {
+
+namespace {
+
+// Upper bound of the schedule table size, longer hyperperiods fall back to the evaluation of all tasks per time slot
+constexpr std::size_t kMaxScheduleTableEntries{65536};
+
+// Time slots shorter than this busy-wait for the default spin duration before they start
+constexpr std::chrono::microseconds kSpinPeriodLimit{1000};
+constexpr std::chrono::microseconds kDefaultSpinDuration{50};
+
+// Index of the histogram bucket of an execution time, i.e. the number of significant bits
+std::size_t HistogramBucket(uint64_t nanoseconds) {
+  std::size_t bucket{0};
+  while ((nanoseconds != 0) && (bucket < (TaskStatistics::kHistogramBuckets - 1))) {
+    nanoseconds >>= 1U;
+    ++bucket;
+  }
+  return bucket;
+}
+
+// Counters with a single writer do not need read-modify-write operations
+void Increment(std::atomic<uint64_t>& counter, uint64_t value = 1) {
+  counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+}
+
+vaf::Result<void> ApplyThreadAttributes(std::thread& thread, const ThreadAttributes& thread_attributes) {
+  int policy{SCHED_OTHER};
+  if (thread_attributes.scheduling_policy == SchedulingPolicy::kFifo) {
+    policy = SCHED_FIFO;
+  } else if (thread_attributes.scheduling_policy == SchedulingPolicy::kRoundRobin) {
+    policy = SCHED_RR;
+  }
+  sched_param parameter{};
+  parameter.sched_priority = thread_attributes.priority;
+  int error{pthread_setschedparam(thread.native_handle(), policy, &parameter)};
+  if (error != 0) {
+    return vaf::Result<void>::FromError(vaf::ErrorCode::kNotOk,
+                                        vaf::String{"Could not set scheduling policy: "} + std::strerror(error));
+  }
+
+  vaf::Vector<std::size_t> cpu_affinity{thread_attributes.cpu_affinity};
+  if (cpu_affinity.empty() && thread_attributes.numa_node.has_value()) {
+    vaf::Result<vaf::Vector<std::size_t>> node_cpus{NumaNodeCpus(*thread_attributes.numa_node)};
+    if (!node_cpus.HasValue()) {
+      return vaf::Result<void>::FromError(vaf::ErrorCode::kNotOk, node_cpus.Error().UserMessage());
+    }
+    cpu_affinity = std::move(node_cpus.Value());
+  }
+
+  if (!cpu_affinity.empty()) {
+    cpu_set_t cpus;
+    CPU_ZERO(&cpus);
+    for (std::size_t cpu: cpu_affinity) {
+      if (cpu >= CPU_SETSIZE) {
+        return vaf::Result<void>::FromError(vaf::ErrorCode::kNotOk,
+                                            vaf::String{"Invalid CPU in affinity: "} + std::to_string(cpu).c_str());
+      }
+      CPU_SET(cpu, &cpus);
+    }
+    error = pthread_setaffinity_np(thread.native_handle(), sizeof(cpus), &cpus);
+    if (error != 0) {
+      return vaf::Result<void>::FromError(vaf::ErrorCode::kNotOk,
+                                          vaf::String{"Could not set CPU affinity: "} + std::strerror(error));
+    }
+  }
+  return vaf::Result<void>{};
+}
+
+} // namespace
+
+vaf::Result<void> LockMemory(std::size_t stack_prefault_size) {
+  if (mlockall(MCL_CURRENT | MCL_FUTURE) != 0) {
+    return vaf::Result<void>::FromError(vaf::ErrorCode::kNotOk,
+                                        vaf::String{"Could not lock memory: "} + std::strerror(errno));
+  }
+
+  // Touch the stack area once, so later stack growth does not cause page faults
+  auto* stack{static_cast<volatile char*>(alloca(stack_prefault_size))};
+  for (std::size_t i = 0; i < stack_prefault_size; i += 4096) {
+    stack[i] = 0;
+  }
+  return vaf::Result<void>{};
+}
+
+std::chrono::nanoseconds TaskStatistics::Percentile(double percentile) const {
+  double rank{(std::clamp(percentile, 0.0, 100.0) / 100.0) * static_cast<double>(sampled_executions)};
+  uint64_t count{0};
+  for (std::size_t i = 0; i < kHistogramBuckets; ++i) {
+    count += histogram[i];
+    if ((count != 0) && (static_cast<double>(count) >= rank)) {
+      std::chrono::nanoseconds upper_bound{static_cast<std::chrono::nanoseconds::rep>((uint64_t{1} << i) - 1)};
+      return std::min(upper_bound, max_execution_time);
+    }
+  }
+  return max_execution_time;
+}
+
+std::size_t LatenessStatistics::Bucket(uint64_t nanoseconds) {
+  if (nanoseconds < kSubBuckets) {
+    return static_cast<std::size_t>(nanoseconds);
+  }
+  // Position of the most significant bit, the kSubBucketBits bits below it select the linear bucket
+  std::size_t magnitude{0};
+  for (uint64_t value{nanoseconds}; value > 1; value >>= 1U) {
+    ++magnitude;
+  }
+  std::size_t shift{magnitude - kSubBucketBits};
+  std::size_t sub_bucket{static_cast<std::size_t>((nanoseconds >> shift) & (kSubBuckets - 1))};
+  return std::min(((shift + 1) * kSubBuckets) + sub_bucket, kBuckets - 1);
+}
+
+std::chrono::nanoseconds LatenessStatistics::UpperBound(std::size_t bucket) {
+  if (bucket < kSubBuckets) {
+    return std::chrono::nanoseconds{static_cast<std::chrono::nanoseconds::rep>(bucket)};
+  }
+  std::size_t shift{(bucket / kSubBuckets) - 1};
+  uint64_t lower_bound{static_cast<uint64_t>(kSubBuckets + (bucket % kSubBuckets)) << shift};
+  return std::chrono::nanoseconds{static_cast<std::chrono::nanoseconds::rep>(lower_bound + (uint64_t{1} << shift) - 1)};
+}
+
+std::chrono::nanoseconds LatenessStatistics::Percentile(double percentile) const {
+  double rank{(std::clamp(percentile, 0.0, 100.0) / 100.0) * static_cast<double>(count)};
+  uint64_t cumulative{0};
+  for (std::size_t i = 0; i < kBuckets; ++i) {
+    cumulative += histogram[i];
+    if ((cumulative != 0) && (static_cast<double>(cumulative) >= rank)) {
+      return std::clamp(UpperBound(i), min, max);
+    }
+  }
+  return max;
+}
+
+namespace internal {
+
+void LatenessRecorder::Record(std::chrono::nanoseconds lateness) {
+  if (reset_requested_.load(std::memory_order_relaxed) && reset_requested_.exchange(false)) {
+    Clear();
+  }
+  auto nanoseconds{static_cast<uint64_t>(std::max(lateness.count(), std::chrono::nanoseconds::rep{0}))};
+  Increment(count_);
+  Increment(sum_, nanoseconds);
+  Increment(histogram_[LatenessStatistics::Bucket(nanoseconds)]);
+  if (nanoseconds < min_.load(std::memory_order_relaxed)) {
+    min_.store(nanoseconds, std::memory_order_relaxed);
+  }
+  if (nanoseconds > max_.load(std::memory_order_relaxed)) {
+    max_.store(nanoseconds, std::memory_order_relaxed);
+  }
+}
+
+void LatenessRecorder::Reset() { reset_requested_.store(true); }
+
+void LatenessRecorder::Clear() {
+  count_.store(0, std::memory_order_relaxed);
+  min_.store(UINT64_MAX, std::memory_order_relaxed);
+  max_.store(0, std::memory_order_relaxed);
+  sum_.store(0, std::memory_order_relaxed);
+  for (std::atomic<uint64_t>& bucket: histogram_) {
+    bucket.store(0, std::memory_order_relaxed);
+  }
+}
+
+LatenessStatistics LatenessRecorder::GetStatistics() const {
+  LatenessStatistics statistics{};
+  // A pending reset is not applied yet, the statistics already read as cleared
+  if (reset_requested_.load()) {
+    return statistics;
+  }
+  statistics.count = count_.load(std::memory_order_relaxed);
+  if (statistics.count != 0) {
+    statistics.min = std::chrono::nanoseconds{min_.load(std::memory_order_relaxed)};
+    statistics.max = std::chrono::nanoseconds{max_.load(std::memory_order_relaxed)};
+    statistics.sum = std::chrono::nanoseconds{sum_.load(std::memory_order_relaxed)};
+  }
+  for (std::size_t i = 0; i < LatenessStatistics::kBuckets; ++i) {
+    statistics.histogram[i] = histogram_[i].load(std::memory_order_relaxed);
+  }
+  return statistics;
+}
+
+} // namespace internal
+
+const vaf::String& TaskHandle::Name() const { return name_; }
+bool TaskHandle::IsActive() const { return is_active_->load(std::memory_order_acquire); }
+void TaskHandle::Execute() const { invoke_(callable_.get()); }
+uint64_t TaskHandle::Period() const { return period_; }
+void TaskHandle::Start() { is_active_->store(true, std::memory_order_release); }
+void TaskHandle::Stop() { is_active_->store(false, std::memory_order_release); }
+const vaf::String& TaskHandle::Owner() { return owner_; }
+const vaf::Vector<vaf::String>& TaskHandle::RunAfter() { return run_after_; }
+const vaf::Vector<vaf::String>& TaskHandle::RunAfterTasks() { return run_after_tasks_; }
+uint64_t TaskHandle::Offset() const { return offset_; }
+std::chrono::nanoseconds TaskHandle::Budget() const { return budget_; }
+uint32_t TaskHandle::Priority() const { return priority_; }
+
+TaskStatistics TaskHandle::GetStatistics() const {
+  TaskStatistics statistics{};
+  statistics.owner = owner_;
+  statistics.name = name_;
+  statistics.executions = counters_.executions.load(std::memory_order_relaxed);
+  statistics.skipped_executions = counters_.skipped_executions.load(std::memory_order_relaxed);
+  statistics.sampled_executions = counters_.sampled_executions.load(std::memory_order_relaxed);
+  statistics.budget_violations = counters_.budget_violations.load(std::memory_order_relaxed);
+  statistics.coalesced_events = counters_.coalesced_events.load(std::memory_order_relaxed);
+  if (statistics.sampled_executions != 0) {
+    statistics.min_execution_time =
+        std::chrono::nanoseconds{counters_.min_execution_time.load(std::memory_order_relaxed)};
+    statistics.max_execution_time =
+        std::chrono::nanoseconds{counters_.max_execution_time.load(std::memory_order_relaxed)};
+    statistics.mean_execution_time = std::chrono::nanoseconds{
+        counters_.total_execution_time.load(std::memory_order_relaxed) / statistics.sampled_executions};
+  }
+  for (std::size_t i = 0; i < TaskStatistics::kHistogramBuckets; ++i) {
+    statistics.histogram[i] = counters_.histogram[i].load(std::memory_order_relaxed);
+  }
+  statistics.start_lateness = counters_.start_lateness.GetStatistics();
+  statistics.allocations = counters_.allocations.load(std::memory_order_relaxed);
+  return statistics;
+}
+
+void TaskHandle::Trigger() {
+  if ((event_executor_ == nullptr) || !IsActive()) {
+    return;
+  }
+  if (event_pending_.exchange(true)) {
+    counters_.coalesced_events.fetch_add(1, std::memory_order_relaxed);
+    return;
+  }
+  event_executor_->TriggerEvent(*this);
+}
+
+void ManualTimeSource::AdvanceBy(std::chrono::nanoseconds duration) {
+  std::unique_lock<std::mutex> lock{mutex_};
+  now_ += duration;
+  condition_.notify_all();
+  condition_.wait(lock, [this]() { return interrupted_ || (waiting_for_ >= now_); });
+}
+
+std::chrono::nanoseconds ManualTimeSource::Now() const {
+  std::lock_guard<std::mutex> lock{mutex_};
+  return now_;
+}
+
+bool ManualTimeSource::WaitUntil(std::chrono::nanoseconds time) {
+  std::unique_lock<std::mutex> lock{mutex_};
+  waiting_for_ = time;
+  condition_.notify_all();
+  condition_.wait(lock, [this, time]() { return interrupted_ || (time < now_); });
+  return !interrupted_;
+}
+
+void ManualTimeSource::Interrupt() {
+  {
+    std::lock_guard<std::mutex> lock{mutex_};
+    interrupted_ = true;
+  }
+  condition_.notify_all();
+}
+
+Executor::Executor(std::chrono::microseconds running_period, std::size_t worker_threads,
+                   std::shared_ptr<TimeSource> time_source)
+  : running_period_{running_period},
+    time_source_{std::move(time_source)},
+    logger_{vaf::CreateLogger("E", "Executor")},
+    workers_{},
+    thread_{}
+{
+  task_sets_.push_back(std::make_unique<TaskSet>());
+  task_set_.store(task_sets_.back().get());
+  if (running_period_ < kSpinPeriodLimit) {
+    spin_duration_.store(std::min(kDefaultSpinDuration, running_period_ / 2).count());
+  }
+
+  if (worker_threads == 0) {
+    worker_threads = std::max(1U, std::thread::hardware_concurrency());
+  }
+  if (worker_threads > 1) {
+    workers_.reserve(worker_threads);
+    for (std::size_t i = 0; i < worker_threads; ++i) {
+      workers_.emplace_back([this]() { WorkerThread(); });
+    }
+  }
+  thread_ = std::thread{[this]() { ExecutorThread(); }};
+}
+
+Executor::~Executor() {
+  exit_requested_ = true;
+  if (time_source_) {
+    time_source_->Interrupt();
+  }
+  thread_.join();
+
+  {
+    std::lock_guard<std::mutex> lock{ready_mutex_};
+    workers_exit_requested_ = true;
+  }
+  ready_condition_.notify_all();
+  for (std::thread& worker: workers_) {
+    worker.join();
+  }
+}
+
+void Executor::ExecutorThread() {
+  uint64_t counter{0};
+  // Number of priority levels dropped by OverrunPolicy::kDegrade
+  std::size_t shed_levels{0};
+  std::chrono::steady_clock::time_point next_run{std::chrono::steady_clock::now()};
+  while (!exit_requested_) {
+    if (time_source_ && !WaitForTimeSource(counter)) {
+      break;
+    }
+    std::chrono::steady_clock::time_point start{std::chrono::steady_clock::now()};
+    if (time_source_) {
+      time_slot_start_ = start;
+    } else {
+      time_slot_start_ = next_run;
+      wake_up_lateness_.Record(start - next_run);
+    }
+    next_run += running_period_;
+#if defined(VAF_ALLOCATION_TRACKING)
+    const uint64_t allocations_before{time_slot_allocations_.load(std::memory_order_relaxed)};
+    const ThreadAllocationCounter allocations{};
+#endif
+    OverrunPolicy overrun_policy{overrun_policy_.load(std::memory_order_relaxed)};
+    if (overrun_policy != OverrunPolicy::kDegrade) {
+      shed_levels = 0;
+    }
+
+    TaskSet& task_set{AcquireTaskSet()};
+    std::size_t priority_levels{task_set.priority_levels.size()};
+    CollectDueTasks(task_set, counter, shed_levels);
+    if (workers_.empty()) {
+      for (TaskEntry* task: due_tasks_) {
+        ExecuteTask(*task);
+      }
+    } else if (!due_tasks_.empty()) {
+      ExecuteTasksOnWorkers(task_set);
+    }
+    ReleaseTaskSet();
+#if defined(VAF_ALLOCATION_TRACKING)
+    // The workers have added the allocations of their tasks already
+    const uint64_t own_allocations{allocations.Count().allocations};
+    if ((time_slot_allocations_.fetch_add(own_allocations, std::memory_order_relaxed) + own_allocations) !=
+        allocations_before) {
+      Increment(allocating_time_slots_);
+    }
+#endif
+
+    std::chrono::steady_clock::time_point end{std::chrono::steady_clock::now()};
+    auto duration{static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count())};
+    if (duration > max_time_slot_duration_.load(std::memory_order_relaxed)) {
+      max_time_slot_duration_.store(duration, std::memory_order_relaxed);
+    }
+    Increment(time_slots_);
+    if (!time_source_ && (end > next_run)) {
+      Increment(overruns_);
+      deadline_misses_.Record(end - next_run);
+#ifdef NDEBUG
+#else
+      logger_.LogWarn() << "Executor could not execute all tasks in time.";
+#endif
+      if (overrun_policy == OverrunPolicy::kSkip) {
+        // The time slot counter keeps following the time, so the tasks stay in phase after the skipped time slots
+        auto skipped{static_cast<uint64_t>((end - next_run) / running_period_) + 1};
+        next_run += skipped * running_period_;
+        counter += skipped;
+        Increment(skipped_time_slots_, skipped);
+      } else if ((overrun_policy == OverrunPolicy::kDegrade) && ((shed_levels + 1) < priority_levels)) {
+        ++shed_levels;
+      }
+    } else if (shed_levels != 0) {
+      --shed_levels;
+    }
+
+    ++counter;
+
+    if (!time_source_) {
+      WaitForNextTimeSlot(next_run);
+    }
+  }
+}
+
+void Executor::TriggerEvent(TaskHandle& task) {
+  {
+    std::lock_guard<std::mutex> lock{event_mutex_};
+    pending_events_.push_back(&task);
+  }
+  event_condition_.notify_one();
+}
+
+void Executor::WaitForNextTimeSlot(std::chrono::steady_clock::time_point next_run) {
+  std::chrono::steady_clock::time_point wake_up{
+      next_run - std::chrono::microseconds{spin_duration_.load(std::memory_order_relaxed)}};
+
+  // Event-driven tasks use the idle time up to the next time slot, a late time slot takes precedence over them
+  {
+    std::unique_lock<std::mutex> lock{event_mutex_};
+    while (event_condition_.wait_until(lock, wake_up, [this]() { return !pending_events_.empty(); })) {
+      TaskHandle* task{pending_events_.front()};
+      pending_events_.pop_front();
+
+      lock.unlock();
+      ExecuteEventTask(*task);
+      lock.lock();
+
+      if (std::chrono::steady_clock::now() >= wake_up) {
+        break;
+      }
+    }
+  }
+
+  // Busy-wait for the rest, which is more precise than waking up from a sleep
+  while (std::chrono::steady_clock::now() < next_run) {
+  }
+}
+
+bool Executor::WaitForTimeSource(uint64_t counter) {
+  if (!time_source_->WaitUntil(std::chrono::nanoseconds{running_period_} *
+                               static_cast<std::chrono::nanoseconds::rep>(counter))) {
+    return false;
+  }
+
+  // Event-driven tasks run at the start of the time slot, after the data that triggered them arrived. Triggers from
+  // these executions are left for the next time slot, so a task that triggers itself does not stop the time.
+  std::unique_lock<std::mutex> lock{event_mutex_};
+  for (std::size_t events{pending_events_.size()}; (events != 0) && !pending_events_.empty(); --events) {
+    TaskHandle* task{pending_events_.front()};
+    pending_events_.pop_front();
+
+    lock.unlock();
+    ExecuteEventTask(*task);
+    lock.lock();
+  }
+  return true;
+}
+
+void Executor::ExecuteEventTask(TaskHandle& task) {
+  // Triggers from now on request another execution, so no data arriving during the execution is missed
+  task.event_pending_.store(false);
+  if (task.IsActive()) {
+    ExecuteTask(TaskEntry{task.is_active_, task.invoke_, task.callable_.get(), 0, 0, task.Budget(), task.Priority(),
+                          &task.counters_, 0, 0, 0, 0, false, nullptr, &task});
+  }
+}
+
+Executor::TaskSet& Executor::AcquireTaskSet() {
+  // The executor thread announces the task set it reads before using it. Registrations only free task sets that are
+  // neither the latest one nor announced, so the announcement is validated against the latest task set again.
+  TaskSet* task_set{task_set_.load()};
+  while (true) {
+    task_set_in_use_.store(task_set);
+    TaskSet* latest{task_set_.load()};
+    if (latest == task_set) {
+      return *task_set;
+    }
+    task_set = latest;
+  }
+}
+
+void Executor::ReleaseTaskSet() { task_set_in_use_.store(nullptr, std::memory_order_release); }
+
+void Executor::CollectDueTasks(TaskSet& task_set, uint64_t counter, std::size_t shed_levels) {
+  due_tasks_.clear();
+
+  // The highest priority level is never dropped
+  uint32_t min_priority{0};
+  if ((shed_levels != 0) && !task_set.priority_levels.empty()) {
+    min_priority = task_set.priority_levels[std::min(shed_levels, task_set.priority_levels.size() - 1)];
+  }
+  auto add_due_task{[this, min_priority](TaskEntry& task) {
+    if (task.priority >= min_priority) {
+      due_tasks_.push_back(&task);
+    } else {
+      Increment(task.counters->skipped_executions);
+    }
+  }};
+
+  if (task_set.hyperperiod != 0) {
+    std::size_t slot{static_cast<std::size_t>(counter % task_set.hyperperiod)};
+    bool all_offsets_passed{counter >= task_set.max_offset};
+    for (std::size_t i = task_set.schedule_slots[slot]; i < task_set.schedule_slots[slot + 1]; ++i) {
+      TaskEntry* task{task_set.schedule_tasks[i]};
+      if (task->active->load(std::memory_order_acquire) && (all_offsets_passed || (counter >= task->offset))) {
+        add_due_task(*task);
+      }
+    }
+  } else {
+    for (TaskEntry& task: task_set.task_table) {
+      if (task.active->load(std::memory_order_acquire)) {
+        if (counter >= task.offset) {
+          if (((counter - task.offset) % task.period) == 0) {
+            add_due_task(task);
+          }
+        }
+      }
+    }
+  }
+}
+
+void Executor::ExecuteTasksOnWorkers(TaskSet& task_set) {
+  std::unique_lock<std::mutex> lock{ready_mutex_};
+  dispatched_task_set_ = &task_set;
+
+  std::fill(task_set.last_due_of_owner.begin(), task_set.last_due_of_owner.end(), nullptr);
+  for (TaskEntry* task: due_tasks_) {
+    task->is_due = true;
+    task->pending_predecessors = 0;
+    task->next_due_of_owner = nullptr;
+  }
+
+  // Only predecessors that are due in the same time slot delay a task
+  for (TaskEntry* task: due_tasks_) {
+    for (std::size_t i = task->successors_begin; i < task->successors_end; ++i) {
+      TaskEntry& successor{task_set.task_table[task_set.successor_table[i]]};
+      if (successor.is_due) {
+        ++successor.pending_predecessors;
+      }
+    }
+  }
+
+  // Tasks of one module never run concurrently, so the due tasks of each module are chained in topological order.
+  // Chaining them in the task graph instead would let two due tasks run at once if the task between them is not due.
+  for (TaskEntry* task: due_tasks_) {
+    TaskEntry*& last{task_set.last_due_of_owner[task->owner]};
+    if (last != nullptr) {
+      last->next_due_of_owner = task;
+      ++task->pending_predecessors;
+    }
+    last = task;
+  }
+
+  remaining_tasks_ = due_tasks_.size();
+  for (TaskEntry* task: due_tasks_) {
+    if (task->pending_predecessors == 0) {
+      ready_tasks_.push_back(task);
+    }
+  }
+  ready_condition_.notify_all();
+
+  done_condition_.wait(lock, [this]() { return remaining_tasks_ == 0; });
+  dispatched_task_set_ = nullptr;
+}
+
+void Executor::WorkerThread() {
+  std::unique_lock<std::mutex> lock{ready_mutex_};
+  while (true) {
+    ready_condition_.wait(lock, [this]() { return workers_exit_requested_ || !ready_tasks_.empty(); });
+    if (workers_exit_requested_) {
+      break;
+    }
+
+    TaskEntry* task{ready_tasks_.front()};
+    ready_tasks_.pop_front();
+
+    lock.unlock();
+#if defined(VAF_ALLOCATION_TRACKING)
+    const ThreadAllocationCounter allocations{};
+    ExecuteTask(*task);
+    time_slot_allocations_.fetch_add(allocations.Count().allocations, std::memory_order_relaxed);
+#else
+    ExecuteTask(*task);
+#endif
+    lock.lock();
+
+    task->is_due = false;
+    for (std::size_t i = task->successors_begin; i < task->successors_end; ++i) {
+      TaskEntry& successor{dispatched_task_set_->task_table[dispatched_task_set_->successor_table[i]]};
+      if (successor.is_due && (--successor.pending_predecessors == 0)) {
+        ready_tasks_.push_back(&successor);
+        ready_condition_.notify_one();
+      }
+    }
+    TaskEntry* next{task->next_due_of_owner};
+    if ((next != nullptr) && (--next->pending_predecessors == 0)) {
+      ready_tasks_.push_back(next);
+      ready_condition_.notify_one();
+    }
+
+    if (--remaining_tasks_ == 0) {
+      done_condition_.notify_one();
+    }
+  }
+}
+
+uint64_t Executor::PeriodInTimeSlots(const vaf::String& name, std::chrono::microseconds period,
+                                     const vaf::String& owner) {
+  // Every periodic task runs at most once per time slot, so the schedule never divides by a period of zero
+  if (period < running_period_) {
+    logger_.LogWarn() << "Period of task " << name.c_str() << " of " << owner.c_str()
+                << " is shorter than the executor period and is rounded up to it";
+    return 1;
+  }
+  if ((period % running_period_).count() != 0) {
+    logger_.LogWarn() << "Period of task " << name.c_str() << " of " << owner.c_str()
+                << " is no multiple of the executor period and is rounded down";
+  }
+  return static_cast<uint64_t>(period / running_period_);
+}
+
+void Executor::AddTask(std::shared_ptr<TaskHandle> handle) {
+  std::lock_guard<std::mutex> lock{registration_mutex_};
+  handle->is_active_ = &activation_flags_.emplace_back(handle->own_active_flag_.load());
+  tasks_.push_back(std::move(handle));
+
+  // Publish the new task set, the executor thread picks it up with its next time slot
+  task_sets_.push_back(BuildTaskSet());
+  TaskSet* latest{task_sets_.back().get()};
+  task_set_.store(latest);
+
+  TaskSet* in_use{task_set_in_use_.load()};
+  task_sets_.erase(std::remove_if(task_sets_.begin(), task_sets_.end(),
+                                  [latest, in_use](const std::unique_ptr<TaskSet>& task_set) {
+                                    return (task_set.get() != latest) && (task_set.get() != in_use);
+                                  }),
+                   task_sets_.end());
+}
+
+std::unique_ptr<Executor::TaskSet> Executor::BuildTaskSet() {
+  // Event-driven tasks are not part of the schedule
+  vaf::Vector<std::shared_ptr<TaskHandle>> periodic_tasks{};
+  std::copy_if(tasks_.begin(), tasks_.end(), std::back_inserter(periodic_tasks),
+               [](const std::shared_ptr<TaskHandle>& task) { return task->event_executor_ == nullptr; });
+  std::size_t task_count{periodic_tasks.size()};
+  vaf::Map<vaf::String, vaf::Vector<std::size_t>> tasks_of_owner{};
+  for (std::size_t i = 0; i < task_count; ++i) {
+    tasks_of_owner[periodic_tasks[i]->Owner()].push_back(i);
+  }
+
+  // Owner-level edges from run_after and task-level edges from run_after_tasks
+  vaf::Vector<vaf::Vector<std::size_t>> successors(task_count);
+  vaf::Vector<std::size_t> in_degree(task_count, 0);
+  auto add_edge = [&successors, &in_degree](std::size_t from, std::size_t to) {
+    successors[from].push_back(to);
+    ++in_degree[to];
+  };
+  for (std::size_t i = 0; i < task_count; ++i) {
+    TaskHandle& task{*periodic_tasks[i]};
+    for (const vaf::String& owner: task.RunAfter()) {
+      auto predecessors{tasks_of_owner.find(owner)};
+      if ((owner != task.Owner()) && (predecessors != tasks_of_owner.end())) {
+        for (std::size_t predecessor: predecessors->second) {
+          add_edge(predecessor, i);
+        }
+      }
+    }
+    for (const vaf::String& name: task.RunAfterTasks()) {
+      for (std::size_t predecessor: tasks_of_owner[task.Owner()]) {
+        if ((predecessor != i) && (periodic_tasks[predecessor]->Name() == name)) {
+          add_edge(predecessor, i);
+        }
+      }
+    }
+  }
+
+  // Topological order, ties are resolved by priority and then by registration order
+  auto lower_rank{[&periodic_tasks](std::size_t lhs, std::size_t rhs) {
+    if (periodic_tasks[lhs]->Priority() != periodic_tasks[rhs]->Priority()) {
+      return periodic_tasks[lhs]->Priority() < periodic_tasks[rhs]->Priority();
+    }
+    return lhs > rhs;
+  }};
+  std::priority_queue<std::size_t, vaf::Vector<std::size_t>, decltype(lower_rank)> ready{lower_rank};
+  for (std::size_t i = 0; i < task_count; ++i) {
+    if (in_degree[i] == 0) {
+      ready.push(i);
+    }
+  }
+  vaf::Vector<std::size_t> order{};
+  order.reserve(task_count);
+  while (!ready.empty()) {
+    std::size_t current{ready.top()};
+    ready.pop();
+    order.push_back(current);
+    for (std::size_t successor: successors[current]) {
+      if (--in_degree[successor] == 0) {
+        ready.push(successor);
+      }
+    }
+  }
+
+  if (order.size() != task_count) {
+    for (std::size_t i = 0; i < task_count; ++i) {
+      if (in_degree[i] != 0) {
+        logger_.LogFatal() << "Cyclic run_after dependency of task " << periodic_tasks[i]->Name().c_str() << " of "
+                     << periodic_tasks[i]->Owner().c_str();
+      }
+    }
+    std::abort();
+  }
+
+  // Dense module indices, the due tasks of each module are chained per time slot by ExecuteTasksOnWorkers
+  vaf::Map<vaf::String, std::size_t> owner_index{};
+  for (const auto& owner: tasks_of_owner) {
+    owner_index.emplace(owner.first, owner_index.size());
+  }
+
+  vaf::Vector<std::size_t> position(task_count);
+  for (std::size_t i = 0; i < task_count; ++i) {
+    position[order[i]] = i;
+  }
+
+  auto task_set{std::make_unique<TaskSet>()};
+  task_set->last_due_of_owner.assign(owner_index.size(), nullptr);
+  for (const std::shared_ptr<TaskHandle>& task: periodic_tasks) {
+    task_set->priority_levels.push_back(task->Priority());
+  }
+  std::sort(task_set->priority_levels.begin(), task_set->priority_levels.end());
+  task_set->priority_levels.erase(std::unique(task_set->priority_levels.begin(), task_set->priority_levels.end()),
+                                  task_set->priority_levels.end());
+
+  task_set->tasks.reserve(task_count);
+  task_set->task_table.reserve(task_count);
+  for (std::size_t current: order) {
+    TaskHandle& task{*periodic_tasks[current]};
+    std::size_t successors_begin{task_set->successor_table.size()};
+    for (std::size_t successor: successors[current]) {
+      task_set->successor_table.push_back(position[successor]);
+    }
+    task_set->task_table.push_back(TaskEntry{task.is_active_, task.invoke_, task.callable_.get(), task.Period(),
+                                             task.Offset(), task.Budget(), task.Priority(), &task.counters_,
+                                             owner_index[task.Owner()], successors_begin,
+                                             task_set->successor_table.size(), 0, false, nullptr, &task});
+    task_set->tasks.push_back(periodic_tasks[current]);
+  }
+
+  BuildScheduleTable(*task_set);
+  return task_set;
+}
+
+void Executor::BuildScheduleTable(TaskSet& task_set) {
+  // A task with period p and offset o is due in every time slot c >= o with c % p == o % p, so after the largest
+  // offset the schedule repeats with the least common multiple of all periods.
+  task_set.hyperperiod = 1;
+  task_set.max_offset = 0;
+  for (TaskEntry& task: task_set.task_table) {
+    task_set.hyperperiod = std::lcm(task_set.hyperperiod, task.period);
+    task_set.max_offset = std::max(task_set.max_offset, task.offset);
+    if (task_set.hyperperiod > kMaxScheduleTableEntries) {
+      break;
+    }
+  }
+
+  std::size_t entries{0};
+  if (task_set.hyperperiod <= kMaxScheduleTableEntries) {
+    for (TaskEntry& task: task_set.task_table) {
+      entries += static_cast<std::size_t>(task_set.hyperperiod / task.period);
+    }
+  }
+  if ((task_set.hyperperiod > kMaxScheduleTableEntries) || (entries > kMaxScheduleTableEntries)) {
+    task_set.hyperperiod = 0;
+    task_set.schedule_slots.clear();
+    task_set.schedule_tasks.clear();
+    return;
+  }
+
+  // Tasks are added in topological order, so every slot keeps the order of the task graph
+  vaf::Vector<vaf::Vector<TaskEntry*>> slots(static_cast<std::size_t>(task_set.hyperperiod));
+  for (TaskEntry& task: task_set.task_table) {
+    for (uint64_t slot = task.offset % task.period; slot < task_set.hyperperiod; slot += task.period) {
+      slots[static_cast<std::size_t>(slot)].push_back(&task);
+    }
+  }
+
+  task_set.schedule_slots.clear();
+  task_set.schedule_slots.reserve(slots.size() + 1);
+  task_set.schedule_tasks.clear();
+  task_set.schedule_tasks.reserve(entries);
+  for (vaf::Vector<TaskEntry*>& slot: slots) {
+    task_set.schedule_slots.push_back(task_set.schedule_tasks.size());
+    task_set.schedule_tasks.insert(task_set.schedule_tasks.end(), slot.begin(), slot.end());
+  }
+  task_set.schedule_slots.push_back(task_set.schedule_tasks.size());
+}
+
+void Executor::SetStatisticsSampleInterval(uint32_t sample_interval) {
+  statistics_sample_interval_.store(sample_interval, std::memory_order_relaxed);
+}
+
+void Executor::SetSpinDuration(std::chrono::microseconds spin_duration) {
+  spin_duration_.store(spin_duration.count(), std::memory_order_relaxed);
+}
+
+void Executor::SetOverrunPolicy(OverrunPolicy overrun_policy) {
+  overrun_policy_.store(overrun_policy, std::memory_order_relaxed);
+}
+
+vaf::Result<void> Executor::SetThreadAttributes(const ThreadAttributes& thread_attributes) {
+  vaf::Result<void> result{ApplyThreadAttributes(thread_, thread_attributes)};
+  for (std::thread& worker: workers_) {
+    if (!result.HasValue()) {
+      break;
+    }
+    result = ApplyThreadAttributes(worker, thread_attributes);
+  }
+  return result;
+}
+
+ExecutorStatistics Executor::GetStatistics() const {
+  ExecutorStatistics statistics{};
+  statistics.time_slots = time_slots_.load(std::memory_order_relaxed);
+  statistics.overruns = overruns_.load(std::memory_order_relaxed);
+  statistics.skipped_time_slots = skipped_time_slots_.load(std::memory_order_relaxed);
+  statistics.max_time_slot_duration =
+      std::chrono::nanoseconds{max_time_slot_duration_.load(std::memory_order_relaxed)};
+  statistics.wake_up_lateness = wake_up_lateness_.GetStatistics();
+  statistics.deadline_misses = deadline_misses_.GetStatistics();
+  statistics.time_slot_allocations = time_slot_allocations_.load(std::memory_order_relaxed);
+  statistics.allocating_time_slots = allocating_time_slots_.load(std::memory_order_relaxed);
+  return statistics;
+}
+
+vaf::Vector<TaskStatistics> Executor::GetTaskStatistics() {
+  std::lock_guard<std::mutex> lock{registration_mutex_};
+  vaf::Vector<TaskStatistics> statistics{};
+  statistics.reserve(tasks_.size());
+  for (const std::shared_ptr<TaskHandle>& task: tasks_) {
+    statistics.push_back(task->GetStatistics());
+  }
+  return statistics;
+}
+
+void Executor::ResetLatenessStatistics() {
+  std::lock_guard<std::mutex> lock{registration_mutex_};
+  wake_up_lateness_.Reset();
+  deadline_misses_.Reset();
+  for (const std::shared_ptr<TaskHandle>& task: tasks_) {
+    task->counters_.start_lateness.Reset();
+  }
+}
+
+std::chrono::microseconds Executor::RunningPeriod() const { return running_period_; }
+
+void Executor::ExecuteTask(const TaskEntry& task) {
+  VAF_TRACE_SCOPE("vaf.task", task.handle->Name().c_str(), task.handle->Owner().c_str());
+  // Temporaries of the task live until the end of its execution
+  struct TaskMemoryRelease {
+    ~TaskMemoryRelease() { vaf::internal::ReleaseTaskMemory(); }
+  } task_memory_release{};
+
+  TaskHandle::Counters& counters{*task.counters};
+#if defined(VAF_ALLOCATION_TRACKING)
+  // Also counts the allocations of the unsampled executions that return early
+  struct TaskAllocationCount {
+    ~TaskAllocationCount() { Increment(counter, allocations.Count().allocations); }
+    std::atomic<uint64_t>& counter;
+    ThreadAllocationCounter allocations;
+  } task_allocation_count{counters.allocations, ThreadAllocationCounter{}};
+#endif
+  uint64_t execution{counters.executions.load(std::memory_order_relaxed)};
+  counters.executions.store(execution + 1, std::memory_order_relaxed);
+
+  // Event-driven tasks have no scheduled start
+  uint32_t sample_interval{statistics_sample_interval_.load(std::memory_order_relaxed)};
+  if ((sample_interval == 0) || ((execution % sample_interval) != 0)) {
+    if ((sample_interval != 0) && (task.period != 0)) {
+      counters.start_lateness.Record(std::chrono::steady_clock::now() - time_slot_start_);
+    }
+    task.invoke(task.callable);
+    return;
+  }
+
+  auto start{std::chrono::steady_clock::now()};
+  if (task.period != 0) {
+    counters.start_lateness.Record(start - time_slot_start_);
+  }
+  task.invoke(task.callable);
+  auto end{std::chrono::steady_clock::now()};
+
+  std::chrono::nanoseconds execution_time{std::chrono::duration_cast<std::chrono::nanoseconds>(end - start)};
+  auto nanoseconds{static_cast<uint64_t>(execution_time.count())};
+  Increment(counters.sampled_executions);
+  Increment(counters.total_execution_time, nanoseconds);
+  Increment(counters.histogram[HistogramBucket(nanoseconds)]);
+  if (nanoseconds < counters.min_execution_time.load(std::memory_order_relaxed)) {
+    counters.min_execution_time.store(nanoseconds, std::memory_order_relaxed);
+  }
+  if (nanoseconds > counters.max_execution_time.load(std::memory_order_relaxed)) {
+    counters.max_execution_time.store(nanoseconds, std::memory_order_relaxed);
+  }
+
+  if ((task.budget.count() != 0) && (execution_time > task.budget)) {
+    Increment(counters.budget_violations);
+#ifdef NDEBUG
+#else
+    logger_.LogWarn() << "Budget violation of task from " << task.handle->Owner().c_str();
+#endif
+  }
+}
+
+ModuleExecutor::ModuleExecutor(Executor& executor, vaf::String name, vaf::Vector<vaf::String> dependencies)
+  : executor_{executor},
+    handles_{},
+    started_{false},
+    name_{std::move(name)},
+    dependencies_{std::move(dependencies)}
+{
+}
+
+void ModuleExecutor::Start() {
+  for (std::shared_ptr<TaskHandle>& handle: handles_) {
+    handle->Start();
+  }
+
+  std::lock_guard<std::mutex> lock{posted_tasks_mutex_};
+  started_ = true;
+  if (posted_tasks_) {
+    posted_tasks_->handle_->Start();
+    // Runs the callables posted while the module was stopped
+    posted_tasks_->handle_->Trigger();
+  }
+}
+
+void ModuleExecutor::Stop() {
+  for (std::shared_ptr<TaskHandle>& handle: handles_) {
+    handle->Stop();
+  }
+
+  std::lock_guard<std::mutex> lock{posted_tasks_mutex_};
+  started_ = false;
+  if (posted_tasks_) {
+    posted_tasks_->handle_->Stop();
+  }
+}
+
+std::shared_ptr<internal::PostedTasks> ModuleExecutor::GetPostedTasks() {
+  std::lock_guard<std::mutex> lock{posted_tasks_mutex_};
+  if (!posted_tasks_) {
+    auto posted_tasks{std::make_shared<internal::PostedTasks>()};
+    // The executor keeps the task, so it must not keep the posted tasks alive
+    posted_tasks->handle_ = executor_.RunOnEvent(
+        "posted_tasks",
+        [weak_posted_tasks = std::weak_ptr<internal::PostedTasks>{posted_tasks}]() {
+          if (std::shared_ptr<internal::PostedTasks> tasks{weak_posted_tasks.lock()}) {
+            tasks->Run();
+          }
+        },
+        name_);
+    if (started_) {
+      posted_tasks->handle_->Start();
+    }
+    posted_tasks_ = std::move(posted_tasks);
+  }
+  return posted_tasks_;
+}
+
+namespace internal {
+
+void PostedTasks::Run() {
+  {
+    std::lock_guard<std::mutex> lock{mutex_};
+    running_.swap(tasks_);
+  }
+  for (const Callable& task: running_) {
+    task.invoke(task.callable.get());
+  }
+  running_.clear();
+}
+
+} // namespace internal
+
+vaf::Vector<TaskStatistics> ModuleExecutor::GetStatistics() const {
+  vaf::Vector<TaskStatistics> statistics{};
+  statistics.reserve(handles_.size());
+  for (const std::shared_ptr<TaskHandle>& handle: handles_) {
+    statistics.push_back(handle->GetStatistics());
+  }
+  return statistics;
+}
+
+std::chrono::microseconds ModuleExecutor::RunningPeriod() const { return executor_.RunningPeriod(); }
+
+} // namespace vaf
@@ -0,0 +1,65 @@
+/*!********************************************************************************************************************
+ *  COPYRIGHT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  Copyright (c) 2024-2026 by Vector Informatik GmbH. All rights reserved.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -----------------------------------------------------------------------------------------------------------------*/
+/*!        \file  runtime.cpp
+ *         \brief
+ *
+ *********************************************************************************************************************/
+
+#include "vaf/runtime.h"
+#include "vaf/logging.h"
+#include "vaf/trace.h"
+
+#include <array>
+#include <cstddef>
+#include <memory_resource>
+
+#include "vaf/container_types.h"
+
+namespace vaf {
+
+    namespace {
+        // Initial buffer of the task arena of each thread, larger temporaries are allocated from the heap
+        constexpr std::size_t kTaskArenaSize{64U * 1024U};
+
+        struct TaskArena {
+            std::array<std::byte, kTaskArenaSize> buffer{};
+            std::pmr::monotonic_buffer_resource resource{buffer.data(), buffer.size()};
+        };
+
+        TaskArena &GetTaskArena() noexcept {
+            thread_local TaskArena arena{};
+            return arena;
+        }
+    } // namespace
+
+    std::pmr::memory_resource *SampleMemoryResource() noexcept {
+        // Never destroyed, so samples released during the static destruction stay valid
+        static std::pmr::memory_resource *resource{new std::pmr::synchronized_pool_resource{}};
+        return resource;
+    }
+
+    std::pmr::memory_resource *TaskMemoryResource() noexcept { return &GetTaskArena().resource; }
+
+    namespace internal {
+        void ReleaseTaskMemory() noexcept { GetTaskArena().resource.release(); }
+    } // namespace internal
+
+    Runtime::Runtime() {
+        vaf::LoggerSingleton::getInstance()->SetLogLevelVerbose();
+        vaf::InitializeTracing();
+        std::pmr::set_default_resource(SampleMemoryResource());
+    }
+
+    Runtime::~Runtime() {
+        vaf::LoggerSingleton::getInstance()->CleanLoggers();
+    }
+
+} // namespace vaf
@@ -0,0 +1,70 @@
+// Copyright (c) 2024-2026 by Vector Informatik GmbH. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+// A module coroutine compiled with C++20 awaits futures completed by another thread, also future variables.
+
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <thread>
+#include <utility>
+
+#include "vaf/coroutine.h"
+#include "vaf/executor.h"
+#include "vaf/future.h"
+#include "vaf/internal/promise.h"
+#include "vaf/result.h"
+
+namespace {
+
+// An operation implemented as a coroutine, it awaits a future variable
+vaf::Future<int> Twice(vaf::Future<int> input) {
+  vaf::Result<int> value{co_await input};
+  if (!value.HasValue()) {
+    co_return vaf::Result<int>{value.Error()};
+  }
+  co_return vaf::Result<int>{value.Value() * 2};
+}
+
+// Started on the module executor, it is resumed there after the awaited operation completed on another thread
+vaf::Task Update(vaf::ModuleExecutor& executor, vaf::Future<int> input, std::atomic<int>& output) {
+  vaf::Result<int> value{co_await Twice(std::move(input))};
+  co_await vaf::ResumeOn(executor);
+  output = value.HasValue() ? value.Value() : -1;
+}
+
+}  // namespace
+
+int main() {
+  // Swapping results of which only one has a value
+  vaf::Result<int> with_value{1};
+  vaf::Result<int> with_error{vaf::Result<int>::FromError(vaf::ErrorCode::kNotOk, "error")};
+  with_value.swap(with_error);
+  const bool is_swapped{!with_value.HasValue() && with_error.HasValue() && (with_error.Value() == 1)};
+
+  // Cancelling a future without a result or a state
+  vaf::Future<int> empty{};
+  empty.Cancel();
+
+  std::atomic<int> output{0};
+  {
+    vaf::Executor executor{std::chrono::milliseconds{1}};
+    vaf::ModuleExecutor module_executor{executor, "Module", {}};
+    module_executor.Start();
+
+    vaf::internal::Promise<int> promise{};
+    vaf::Spawn(module_executor, Update(module_executor, promise.get_future(), output));
+    std::thread completing{[&promise]() {
+      std::this_thread::sleep_for(std::chrono::milliseconds{20});
+      promise.set_value(21);
+    }};
+    completing.join();
+    for (int wait = 0; (wait < 1000) && (output == 0); ++wait) {
+      std::this_thread::sleep_for(std::chrono::milliseconds{1});
+    }
+    module_executor.Stop();
+  }
+
+  std::cout << "swapped=" << is_swapped << " output=" << output << std::endl;
+  return (is_swapped && (output == 42)) ? 0 : 1;
+}
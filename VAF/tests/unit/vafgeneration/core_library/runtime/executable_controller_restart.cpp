@@ -0,0 +1,117 @@
+// Copyright (c) 2024-2026 by Vector Informatik GmbH. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+// Modules that fail in Start() are restarted following their restart policy, at most once per minimum restart interval
+// and with their executor stopped.
+
+#include <signal.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <thread>
+
+#include "vaf/controller_interface.h"
+#include "vaf/executable_controller_base.h"
+#include "vaf/user_controller_interface.h"
+
+namespace {
+
+class NoUserController : public vaf::UserControllerInterface {
+ public:
+  void PreInitialize() override {}
+  void PostInitialize() override {}
+  void PreStart() override {}
+  void PostStart() override {}
+  void PreShutdown() override {}
+  void PostShutdown() override {}
+  void OnError(vaf::Error /*error*/, vaf::String /*name*/, bool /*critical*/) override {}
+};
+
+// Never becomes operational, Start() either reports a critical error or skips the start
+class FailingModule : public vaf::ControlInterface {
+ public:
+  FailingModule(vaf::String name, bool skip, vaf::ExecutableControllerInterface& controller, vaf::Executor& executor)
+    : vaf::ControlInterface{std::move(name), {}, controller, executor}, skip_{skip} {
+    executor_.RunPeriodic("Task", std::chrono::milliseconds{1}, [this]() { ++task_executions_; });
+  }
+
+  vaf::Result<void> Init() noexcept override { return {}; }
+  void Start() noexcept override {
+    ++starts_;
+    if (skip_) {
+      SkipStartingOfModule();
+    } else {
+      ReportError(vaf::Error{vaf::ErrorCode::kNotOk, "Start failed"}, true);
+    }
+  }
+  void Stop() noexcept override {}
+  void DeInit() noexcept override {}
+
+  std::atomic<int> starts_{0};
+  std::atomic<int> task_executions_{0};
+
+ private:
+  bool skip_;
+};
+
+class Controller : public vaf::ExecutableControllerBase {
+ public:
+  std::shared_ptr<FailingModule> failing_{};
+  std::shared_ptr<FailingModule> skipping_{};
+  std::shared_ptr<FailingModule> backoff_{};
+  std::shared_ptr<FailingModule> never_{};
+
+ protected:
+  void DoInitialize() override {
+    executor_ = std::make_unique<vaf::Executor>(std::chrono::milliseconds{1});
+    failing_ = std::make_shared<FailingModule>("Failing", false, *this, *executor_);
+    skipping_ = std::make_shared<FailingModule>("Skipping", true, *this, *executor_);
+    backoff_ = std::make_shared<FailingModule>("Backoff", false, *this, *executor_);
+    never_ = std::make_shared<FailingModule>("Never", false, *this, *executor_);
+    RegisterModule(failing_);
+    RegisterModule(skipping_);
+    RegisterModule(backoff_);
+    RegisterModule(never_);
+    SetRestartPolicy("Backoff", vaf::RestartPolicy::kBackoff, std::chrono::milliseconds{100});
+    SetRestartPolicy("Never", vaf::RestartPolicy::kNever);
+    ExecutableControllerBase::DoInitialize();
+  }
+
+ private:
+  std::unique_ptr<vaf::Executor> executor_{};
+};
+
+}  // namespace
+
+std::unique_ptr<vaf::UserControllerInterface> CreateUserController() { return std::make_unique<NoUserController>(); }
+
+int main() {
+  Controller controller{};
+  // The signals are blocked from here on, the signal handler thread of the controller receives them
+  std::thread shutdown{[]() {
+    std::this_thread::sleep_for(std::chrono::milliseconds{500});
+    kill(getpid(), SIGTERM);
+  }};
+  controller.Run();
+  shutdown.join();
+
+  const int failing_starts{controller.failing_->starts_};
+  const int skipping_starts{controller.skipping_->starts_};
+  const int backoff_starts{controller.backoff_->starts_};
+  const int never_starts{controller.never_->starts_};
+  const int task_executions{controller.failing_->task_executions_};
+  std::cout << "failing_starts=" << failing_starts << " skipping_starts=" << skipping_starts
+            << " backoff_starts=" << backoff_starts << " never_starts=" << never_starts
+            << " task_executions=" << task_executions << std::endl;
+  // One start and a restart every 100ms within 500ms
+  const auto is_restarted_periodically = [](int starts) { return (starts >= 2) && (starts <= 7); };
+  // Starts after 0ms, 100ms and 300ms, the next one would be after 700ms
+  const bool is_backed_off{(backoff_starts >= 2) && (backoff_starts <= 3)};
+  return (is_restarted_periodically(failing_starts) && is_restarted_periodically(skipping_starts) && is_backed_off &&
+          (never_starts == 1) && (task_executions == 0))
+             ? 0
+             : 1;
+}
@@ -0,0 +1,43 @@
+// Copyright (c) 2024-2026 by Vector Informatik GmbH. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+// The tasks of one module never run concurrently, also if a task between two due tasks of the module is not due.
+
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <thread>
+
+#include "vaf/executor.h"
+
+int main() {
+  std::atomic<int> running{0};
+  std::atomic<int> overlaps{0};
+  std::atomic<int> executions{0};
+  auto task = [&running, &overlaps, &executions]() {
+    if (running.fetch_add(1) != 0) {
+      ++overlaps;
+    }
+    std::this_thread::sleep_for(std::chrono::microseconds{200});
+    running.fetch_sub(1);
+    ++executions;
+  };
+
+  {
+    vaf::Executor executor{std::chrono::milliseconds{2}, 4};
+    // B is not due in every second time slot, so A and C are due without their predecessor B
+    auto a{executor.RunPeriodic("A", std::chrono::milliseconds{2}, task, "Module", {})};
+    auto b{executor.RunPeriodic("B", std::chrono::milliseconds{4}, task, "Module", {})};
+    auto c{executor.RunPeriodic("C", std::chrono::milliseconds{2}, task, "Module", {})};
+    a->Start();
+    b->Start();
+    c->Start();
+    std::this_thread::sleep_for(std::chrono::milliseconds{400});
+    a->Stop();
+    b->Stop();
+    c->Stop();
+  }
+
+  std::cout << "executions=" << executions << " overlaps=" << overlaps << std::endl;
+  return ((executions > 0) && (overlaps == 0)) ? 0 : 1;
+}
@@ -0,0 +1,49 @@
+// Copyright (c) 2024-2026 by Vector Informatik GmbH. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+// A task with a period shorter than the executor period runs once per time slot, with and without a schedule table.
+
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <thread>
+
+#include "vaf/executor.h"
+
+namespace {
+
+// Runs a task with a period of half a time slot for 200 time slots, optionally next to two tasks whose hyperperiod is
+// too long for a schedule table
+int RunShortPeriod(bool with_long_hyperperiod) {
+  std::atomic<int> executions{0};
+  {
+    vaf::Executor executor{std::chrono::milliseconds{1}};
+    auto short_task{executor.RunPeriodic("Short", std::chrono::microseconds{500}, [&executions]() { ++executions; },
+                                         "Module", {})};
+    short_task->Start();
+    if (with_long_hyperperiod) {
+      auto first{executor.RunPeriodic("First", std::chrono::milliseconds{257}, []() {}, "Module", {})};
+      auto second{executor.RunPeriodic("Second", std::chrono::milliseconds{263}, []() {}, "Module", {})};
+      first->Start();
+      second->Start();
+      std::this_thread::sleep_for(std::chrono::milliseconds{200});
+      first->Stop();
+      second->Stop();
+    } else {
+      std::this_thread::sleep_for(std::chrono::milliseconds{200});
+    }
+    short_task->Stop();
+  }
+  return executions;
+}
+
+}  // namespace
+
+int main() {
+  const int scheduled{RunShortPeriod(false)};
+  const int evaluated{RunShortPeriod(true)};
+  std::cout << "scheduled=" << scheduled << " evaluated=" << evaluated << std::endl;
+  // Once per time slot in about 200 time slots, twice per time slot would be about 400 executions
+  const auto is_once_per_slot = [](int executions) { return (executions >= 50) && (executions <= 250); };
+  return (is_once_per_slot(scheduled) && is_once_per_slot(evaluated)) ? 0 : 1;
+}
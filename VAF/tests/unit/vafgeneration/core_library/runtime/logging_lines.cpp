@@ -0,0 +1,89 @@
+// Copyright (c) 2024-2026 by Vector Informatik GmbH. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+// Lines logged by several threads at once are written whole, also if their ring buffers overflow.
+
+#include <unistd.h>
+
+#include <array>
+#include <cstdio>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "vaf/logging.h"
+
+namespace {
+
+constexpr std::size_t kThreads{8U};
+constexpr int kLines{4000};
+constexpr std::array<const char *, kThreads> kContexts{"T0", "T1", "T2", "T3", "T4", "T5", "T6", "T7"};
+
+void LogLines(std::size_t thread) {
+  vaf::Logger &logger{vaf::CreateLogger(kContexts[thread], "Thread")};
+  for (int line = 0; line < kLines; ++line) {
+    logger.LogInfo() << "thread " << thread << " line " << line << " of " << kLines << " end";
+  }
+}
+
+}  // namespace
+
+int main() {
+  vaf::LoggerSingleton::getInstance()->SetLogLevelInfo();
+
+  // The log writer writes to the file descriptor of std::cout, which is redirected to a file meanwhile
+  std::FILE *output{std::tmpfile()};
+  const int stdout_descriptor{dup(STDOUT_FILENO)};
+  dup2(fileno(output), STDOUT_FILENO);
+  std::vector<std::thread> threads{};
+  for (std::size_t thread = 0; thread < kThreads; ++thread) {
+    threads.emplace_back(LogLines, thread);
+  }
+  for (std::thread &thread: threads) {
+    thread.join();
+  }
+  vaf::internal::FlushLog();
+  dup2(stdout_descriptor, STDOUT_FILENO);
+
+  std::rewind(output);
+  std::string text{};
+  std::array<char, 4096> buffer{};
+  for (std::size_t size = std::fread(buffer.data(), 1U, buffer.size(), output); size > 0U;
+       size = std::fread(buffer.data(), 1U, buffer.size(), output)) {
+    text.append(buffer.data(), size);
+  }
+
+  std::array<int, kThreads> next_lines{};
+  std::size_t written{0U};
+  std::size_t broken{0U};
+  std::istringstream lines{text};
+  for (std::string line{}; std::getline(lines, line);) {
+    if ((line.rfind("[vaf: ", 0U) == 0U) && (line.find(" log records dropped]") != std::string::npos)) {
+      continue;
+    }
+    std::size_t thread{kThreads};
+    int number{-1};
+    int count{-1};
+    char context[8]{};
+    char end[8]{};
+    int consumed{0};
+    const int fields{std::sscanf(line.c_str(), "[%7[^:]: Thread] thread %zu line %d of %d %7s%n", context, &thread,
+                                 &number, &count, end, &consumed)};
+    const bool is_intact{(fields == 5) && (static_cast<std::size_t>(consumed) == line.size()) &&
+                         (thread < kThreads) && (std::string{context} == kContexts[thread]) &&
+                         (count == kLines) && (std::string{end} == "end") && (number >= next_lines[thread])};
+    if (!is_intact) {
+      if (broken < 5U) {
+        std::cerr << "Broken line: " << line << std::endl;
+      }
+      ++broken;
+      continue;
+    }
+    next_lines[thread] = number + 1;
+    ++written;
+  }
+  std::cout << "written=" << written << " broken=" << broken << std::endl;
+  return ((written > 0U) && (broken == 0U)) ? 0 : 1;
+}
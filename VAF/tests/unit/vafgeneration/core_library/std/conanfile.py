@@ -0,0 +1,43 @@
+from pathlib import Path
+
+from conan import ConanFile
+from conan.tools.cmake import CMake, CMakeToolchain, cmake_layout
+from conan.tools.files import load
+
+
+class VafCoreRecipe(ConanFile):
+    """Prebuilt core library of a VAF version and type variant, used by projects with the option
+    prebuilt_core_library instead of building it in each of them"""
+
+    name = "vaf_core"
+    settings = "os", "compiler", "build_type", "arch"
+    options = {"lto": [True, False], "allocation_tracking": [True, False]}
+    default_options = {"lto": True, "allocation_tracking": False}
+    exports = "version.txt"
+    exports_sources = "CMakeLists.txt", "include/*", "src/*"
+
+    def set_version(self):
+        self.version = load(self, Path(self.recipe_folder) / "version.txt").strip()
+
+    def layout(self):
+        cmake_layout(self)
+
+    def generate(self):
+        toolchain = CMakeToolchain(self)
+        toolchain.cache_variables["VAF_CORE_LIBRARY_LTO"] = bool(self.options.lto)
+        toolchain.cache_variables["VAF_ALLOCATION_TRACKING"] = bool(self.options.allocation_tracking)
+        toolchain.generate()
+
+    def build(self):
+        cmake = CMake(self)
+        cmake.configure()
+        cmake.build()
+
+    def package(self):
+        cmake = CMake(self)
+        cmake.install()
+
+    def package_info(self):
+        # The package brings its own CMake config with the vaf_core target
+        self.cpp_info.set_property("cmake_find_mode", "none")
+        self.cpp_info.builddirs = ["lib/cmake/vaf_core"]
@@ -19,6 +19,8 @@
 #include "vaf/error_domain.h"
 #include "vaf/executable_controller_interface.h"
 #include "vaf/executor.h"
+#include "vaf/memory_usage.h"
+#include "vaf/module_id.h"
 #include "vaf/result.h"
 
 namespace vaf {
@@ -47,16 +49,24 @@ class ControlInterface {
   virtual void OnError(const vaf::Error& error);
 
   vaf::String GetName();
+  vaf::ModuleId GetId() const noexcept;
   vaf::Vector<vaf::String> GetDependencies();
 
   void StartExecutor();
   void StopExecutor();
 
-  virtual void StartEventHandlerForModule(const vaf::String& module_name);
-  virtual void StopEventHandlerForModule(const vaf::String& module_name);
+  virtual void StartEventHandlerForModule(vaf::ModuleId module);
+  virtual void StopEventHandlerForModule(vaf::ModuleId module);
+
+  /*!
+   * \brief Returns the memory the module holds per data element, implemented by the communication modules.
+   * \return One entry per data element, none for modules without data elements
+   */
+  virtual vaf::Vector<vaf::MemoryUsage> GetMemoryUsage() const;
 
  protected:
   vaf::String name_;
+  vaf::ModuleId id_;
   vaf::Vector<vaf::String> dependencies_;
   ExecutableControllerInterface& executable_controller_interface_;
   vaf::ModuleExecutor executor_;
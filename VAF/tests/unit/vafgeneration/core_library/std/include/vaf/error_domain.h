@@ -16,7 +16,12 @@
 #ifndef VAF_ERROR_DOMAIN_H_
 #define VAF_ERROR_DOMAIN_H_
 
+#include <cstddef>
+#include <cstdint>
 #include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
 
 #include "vaf/container_types.h"
 
@@ -28,17 +33,98 @@ enum class ErrorCode {
   kUnknown,
 };
 
+/*!
+ * \brief The codes of a library or module that reports errors of its own.
+ * A domain is a constant that lives as long as the program and names its codes with static messages, so an Error of
+ * a domain stores no string.
+ */
+class ErrorDomain {
+ public:
+  using CodeType = std::int32_t;
+
+  constexpr explicit ErrorDomain(std::string_view name) noexcept : name_{name} {}
+
+  ErrorDomain(const ErrorDomain&) = delete;
+  ErrorDomain& operator=(const ErrorDomain&) = delete;
+
+  constexpr std::string_view Name() const noexcept { return name_; }
+
+  // The static message of a code
+  virtual std::string_view Message(CodeType code) const noexcept = 0;
+
+ protected:
+  ~ErrorDomain() = default;
+
+ private:
+  std::string_view name_;
+};
+
+// The domain of vaf::ErrorCode
+class VafErrorDomain final : public ErrorDomain {
+ public:
+  constexpr VafErrorDomain() noexcept : ErrorDomain{"vaf"} {}
+
+  std::string_view Message(CodeType code) const noexcept override {
+    switch (static_cast<ErrorCode>(code)) {
+      case ErrorCode::kOk:
+        return "Ok";
+      case ErrorCode::kNotOk:
+        return "Not ok";
+      default:
+        return "Unknown";
+    }
+  }
+};
+
+inline constexpr VafErrorDomain kVafErrorDomain{};
+
+/*!
+ * \brief An error code with its message.
+ * A message given as a string literal, as well as the message of a domain code, is referenced instead of copied, so
+ * negative results on the hot paths do not allocate. Only messages built at runtime are stored in a vaf::String.
+ */
 class Error {
  public:
-  Error(ErrorCode error_code, vaf::String message) : error_code_{error_code}, message_{message} {}
+  Error(ErrorCode error_code, vaf::String message)
+      : domain_{&kVafErrorDomain}, code_{static_cast<ErrorDomain::CodeType>(error_code)}, message_{std::move(message)} {}
+
+  // Keeps a reference to the string literal, so a char array that does not outlive the error is passed as vaf::String
+  template <std::size_t N>
+  Error(ErrorCode error_code, const char (&message)[N]) noexcept
+      : domain_{&kVafErrorDomain},
+        code_{static_cast<ErrorDomain::CodeType>(error_code)},
+        static_message_{message, std::char_traits<char>::length(message)} {}
+
+  // The error of a domain code, with the message of the domain
+  Error(const ErrorDomain& domain, ErrorDomain::CodeType code) noexcept
+      : domain_{&domain}, code_{code}, static_message_{domain.Message(code)} {}
 
   const vaf::String Message() const noexcept {
-    return vaf::String{std::to_string(static_cast<int>(error_code_)) + ": " + message_.c_str()};
+    const std::string_view message{MessageView()};
+    vaf::String result{std::to_string(code_).c_str()};
+    result += ": ";
+    result.append(message.data(), message.size());
+    return result;
+  }
+
+  void ThrowAsException() const {
+    const std::string_view message{MessageView()};
+    throw std::runtime_error(std::string{message.data(), message.size()});
+  }
+
+  const vaf::String UserMessage() const noexcept {
+    const std::string_view message{MessageView()};
+    return vaf::String{message.data(), message.size()};
+  }
+
+  // The message without a copy, valid as long as the error
+  std::string_view MessageView() const noexcept {
+    return static_message_.data() != nullptr ? static_message_ : std::string_view{message_.data(), message_.size()};
   }
 
-  void ThrowAsException() const { throw std::runtime_error(message_.c_str()); }
+  const ErrorDomain& Domain() const noexcept { return *domain_; }
 
-  const vaf::String UserMessage() const noexcept { return message_; }
+  ErrorDomain::CodeType Value() const noexcept { return code_; }
 
   Error(const Error&) = default;
   Error(Error&&) = default;
@@ -47,8 +133,10 @@ class Error {
   Error& operator=(Error&&) = default;
 
  private:
-  ErrorCode error_code_;
-  vaf::String message_;
+  const ErrorDomain* domain_;
+  ErrorDomain::CodeType code_;
+  std::string_view static_message_{};
+  vaf::String message_{};
 };
 }  // namespace vaf
 
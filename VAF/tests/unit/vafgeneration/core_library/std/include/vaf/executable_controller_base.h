@@ -20,18 +20,40 @@
  *  INCLUDES
  *********************************************************************************************************************/
 #include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
 #include <thread>
 
 #include "vaf/container_types.h"
 #include "vaf/controller_interface.h"
 #include "vaf/executable_controller_interface.h"
 #include "vaf/logging.h"
+#include "vaf/module_id.h"
 #include "vaf/module_states.h"
+#include "vaf/module_table.h"
 #include "vaf/runtime.h"
 #include "vaf/user_controller_interface.h"
 
 namespace vaf {
 
+/*!
+ * \brief How a module is started again after it stopped being operational, e.g. by a critical error or its startup time
+ * limit. The module stays initialized, so only Start() runs again and the other modules keep running. No policy starts
+ * a module again sooner than 100ms after it stopped, so a module that keeps failing in Start() does not busy-loop.
+ */
+enum class RestartPolicy : std::uint8_t {
+  // Started again 100ms after it stopped, as soon as its dependencies are operational
+  kImmediate,
+  // Started again after a delay that doubles with each restart until the module is operational again
+  kBackoff,
+  // Stays not operational until the executable shuts down
+  kNever
+};
+
 class ExecutableControllerBase : public vaf::ExecutableControllerInterface {
  public:
   ExecutableControllerBase();
@@ -46,7 +68,35 @@ class ExecutableControllerBase : public vaf::ExecutableControllerInterface {
   void Run(int argc, char* argv[], bool use_exec_mgr = false) noexcept;
   void InitiateShutdown() noexcept;
 
-  void RegisterModule(std::shared_ptr<vaf::ControlInterface> module);
+  /*!
+   * \brief Registers a module of this executable.
+   * \param module The module
+   * \param startup_time_limit Time the module may take from Start until it reports operational, it is stopped after
+   */
+  void RegisterModule(std::shared_ptr<vaf::ControlInterface> module,
+                      std::chrono::nanoseconds startup_time_limit = kDefaultStartupTimeLimit);
+  /*!
+   * \brief Sets how a registered module is started again after it stopped being operational.
+   * \param name The name of the module
+   * \param policy The restart policy
+   * \param delay Delay of the first restart with RestartPolicy::kBackoff
+   */
+  void SetRestartPolicy(const vaf::String& name, RestartPolicy policy,
+                        std::chrono::nanoseconds delay = kDefaultRestartDelay);
+  /*!
+   * \brief Sets the table of the registered modules generated for the executable.
+   * If it has the registered modules in the order of their registration, their dependencies are taken from the table
+   * instead of being looked up by name.
+   * \param table The table, a constant that outlives the executable controller
+   */
+  void SetModuleTable(vaf::ModuleTableView table) noexcept;
+
+  /*!
+   * \brief Returns the memory the registered modules hold, per module and data element.
+   * The numbers are read while the modules run, so they can be gathered at any time after the registration.
+   * \return The entries of all modules in the order of their registration
+   */
+  vaf::Vector<vaf::MemoryUsage> GetMemoryUsage() const;
 
   void ReportOperationalOfModule(vaf::String name) override;
   void SkipStartingOfModule(vaf::String name) override;
@@ -59,24 +109,62 @@ class ExecutableControllerBase : public vaf::ExecutableControllerInterface {
   void WaitForShutdown();
   bool IsShutdownRequested();
   void ChangeStateOfModule(vaf::String name, ModuleStates state);
+  void ChangeStateOfModule(std::size_t module_index, ModuleStates state);
   void StartModules();
-  void StartEventHandlersForModule(const vaf::String& module_name, const vaf::Vector<vaf::String>& dependencies);
-  void StopEventHandlersForModule(const vaf::String& module_name, const vaf::Vector<vaf::String>& dependencies);
+  void StartEventHandlersForModule(std::size_t module_index);
+  void StopEventHandlersForModule(std::size_t module_index);
   void CheckStartingModules();
+  // Wakes the loop of Run, e.g. after a module reported that it is operational
+  void NotifyController();
 
  private:
   class ModuleContainer {
    public:
-    ModuleContainer(vaf::String name, std::shared_ptr<vaf::ControlInterface> module, vaf::Vector<vaf::String> dependencies)
-      : name_{std::move(name)}, module_{std::move(module)}, dependencies_{std::move(dependencies)} {
+    ModuleContainer(vaf::String name, std::shared_ptr<vaf::ControlInterface> module, vaf::Vector<vaf::String> dependencies,
+                    std::chrono::nanoseconds startup_time_limit)
+      : name_{std::move(name)}, id_{module->GetId()}, module_{std::move(module)}, dependencies_{std::move(dependencies)},
+        startup_time_limit_{startup_time_limit} {
     }
     vaf::String name_;
+    vaf::ModuleId id_;
     std::shared_ptr<vaf::ControlInterface> module_;
     vaf::Vector<vaf::String> dependencies_;
+    // Indices into modules_, resolved once all modules are registered
+    vaf::Vector<std::size_t> dependency_indices_{};
+    vaf::Vector<std::size_t> dependent_indices_{};
+    bool has_unknown_dependency_{false};
     ModuleStates state_{ModuleStates::kNotInitialized};
-    uint64_t starting_counter_{0};
+    std::chrono::nanoseconds startup_time_limit_;
+    // Set when the module starts, it is stopped if it is still starting then
+    std::chrono::steady_clock::time_point startup_deadline_{};
+    RestartPolicy restart_policy_{RestartPolicy::kImmediate};
+    std::chrono::nanoseconds restart_delay_{kDefaultRestartDelay};
+    // Restarts since the module was operational, each one doubles the delay of the next with RestartPolicy::kBackoff
+    std::uint32_t restart_count_{0};
+    // The module is not started again before
+    std::chrono::steady_clock::time_point restart_time_{};
   };
 
+  static constexpr std::size_t kUnknownModule{static_cast<std::size_t>(-1)};
+  // Startup time limit of modules without one in the model
+  static constexpr std::chrono::seconds kDefaultStartupTimeLimit{300};
+  static constexpr std::chrono::milliseconds kDefaultRestartDelay{100};
+  // A module is not started again sooner after it stopped, whatever its restart policy
+  static constexpr std::chrono::milliseconds kMinRestartInterval{100};
+  // The backoff delay stops doubling after these restarts
+  static constexpr std::uint32_t kMaxRestartDoublings{6};
+  static constexpr std::size_t kMaxConcurrentModules{16};
+
+  std::size_t FindModule(const vaf::String& name) const;
+  void ResolveDependencies();
+  // Sets when the module that stopped being operational is started again, following its restart policy
+  static void ScheduleRestart(ModuleContainer& module);
+  // Waits for a state change, the shutdown, the startup time limit of a starting module or the restart of a module
+  void WaitForControllerEvent();
+  // Calls the function for each module index, on up to kMaxConcurrentModules threads, and waits for all
+  static void ForEachConcurrently(const vaf::Vector<std::size_t>& indices,
+                                  const std::function<void(std::size_t)>& function);
+
   void SetupExecutionManager();
   void ReportStateToExecutionManager(bool is_running);
 
@@ -93,9 +181,18 @@ class ExecutableControllerBase : public vaf::ExecutableControllerInterface {
 
   vaf::Logger& logger_;
   vaf::Vector<ModuleContainer> modules_;
+  // Index into modules_ per module identity, kUnknownModule for modules of other executables
+  vaf::Vector<std::size_t> module_indices_{};
+  vaf::ModuleTableView module_table_{};
   std::unique_ptr<UserControllerInterface> user_controller_;
 
   std::thread signal_handler_thread_;
+
+  std::mutex controller_mutex_{};
+  std::condition_variable controller_condition_{};
+  bool controller_event_{false};
+  std::mutex user_controller_mutex_{};
+  std::mutex event_handler_mutex_{};
 };
 
 }  // namespace vaf
@@ -18,20 +18,263 @@
 
 #include "vaf/logging.h"
 #include "vaf/container_types.h"
+#include "vaf/result.h"
 
+#include <array>
 #include <atomic>
 #include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
 #include <functional>
 #include <memory>
+#include <mutex>
+#include <optional>
 #include <thread>
+#include <type_traits>
 #include <utility>
 
 namespace vaf {
 
+    /*!
+     * \brief Histogram of how late something happened, in the style of an HDR histogram.
+     * Each power of two of nanoseconds is split into kSubBuckets linear buckets, so the bounds of a bucket differ by at
+     * most 1/kSubBuckets of the lateness it counts.
+     */
+    struct LatenessStatistics {
+        static constexpr std::size_t kSubBucketBits{3};
+        static constexpr std::size_t kSubBuckets{std::size_t{1} << kSubBucketBits};
+        // Lateness from 2^34ns, about 17s, on is counted in the last bucket
+        static constexpr std::size_t kBuckets{256};
+
+        uint64_t count{0};
+        std::chrono::nanoseconds min{0};
+        std::chrono::nanoseconds max{0};
+        std::chrono::nanoseconds sum{0};
+        std::array<uint64_t, kBuckets> histogram{};
+
+        // Index of the bucket that counts a lateness
+        static std::size_t Bucket(uint64_t nanoseconds);
+
+        // Greatest lateness counted in a bucket
+        static std::chrono::nanoseconds UpperBound(std::size_t bucket);
+
+        /*!
+         * \brief Estimates a percentile of the lateness from the histogram.
+         * \param percentile Percentile in the range from 0 to 100.
+         * \return Upper bound of the histogram bucket that contains the percentile.
+         */
+        std::chrono::nanoseconds Percentile(double percentile) const;
+    };
+
+    namespace internal {
+        /*!
+         * \brief Preallocated counters of a LatenessStatistics histogram.
+         * Record must only be called by one thread at a time, Reset and GetStatistics by any thread. A reset is
+         * applied by the next Record, so it never races with the recording.
+         */
+        class LatenessRecorder {
+        public:
+            void Record(std::chrono::nanoseconds lateness);
+
+            void Reset();
+
+            LatenessStatistics GetStatistics() const;
+
+        private:
+            void Clear();
+
+            std::atomic<bool> reset_requested_{false};
+            std::atomic<uint64_t> count_{0};
+            std::atomic<uint64_t> min_{UINT64_MAX};
+            std::atomic<uint64_t> max_{0};
+            std::atomic<uint64_t> sum_{0};
+            std::array<std::atomic<uint64_t>, LatenessStatistics::kBuckets> histogram_{};
+        };
+    } // namespace internal
+
+    /*!
+     * \brief Execution time statistics of one task.
+     * Execution times are only measured for sampled executions, see Executor::SetStatisticsSampleInterval.
+     */
+    struct TaskStatistics {
+        // Number of histogram buckets, bucket i counts execution times with i significant bits in nanoseconds
+        static constexpr std::size_t kHistogramBuckets{64};
+
+        vaf::String owner{};
+        vaf::String name{};
+        uint64_t executions{0};
+        // Executions dropped by the overrun policy
+        uint64_t skipped_executions{0};
+        uint64_t sampled_executions{0};
+        uint64_t budget_violations{0};
+        // Triggers of an event-driven task that were merged into an already pending execution
+        uint64_t coalesced_events{0};
+        std::chrono::nanoseconds min_execution_time{0};
+        std::chrono::nanoseconds max_execution_time{0};
+        std::chrono::nanoseconds mean_execution_time{0};
+        std::array<uint64_t, kHistogramBuckets> histogram{};
+        // Time from the scheduled start of the time slot to the start of the task, its spread is the start-time
+        // jitter. Only recorded for periodic tasks.
+        LatenessStatistics start_lateness{};
+        // Heap allocations of all executions, only counted with VAF_ALLOCATION_TRACKING, see vaf/allocation_tracking.h
+        uint64_t allocations{0};
+
+        /*!
+         * \brief Estimates a percentile of the sampled execution times from the histogram.
+         * \param percentile Percentile in the range from 0 to 100.
+         * \return Upper bound of the histogram bucket that contains the percentile.
+         */
+        std::chrono::nanoseconds Percentile(double percentile) const;
+    };
+
+    /*!
+     * \brief Time slot statistics of one executor.
+     */
+    struct ExecutorStatistics {
+        uint64_t time_slots{0};
+        // Time slots that did not finish before the start of the next time slot
+        uint64_t overruns{0};
+        // Time slots dropped by the overrun policy
+        uint64_t skipped_time_slots{0};
+        std::chrono::nanoseconds max_time_slot_duration{0};
+        // Time from the scheduled start of a time slot to the wake-up of the executor thread
+        LatenessStatistics wake_up_lateness{};
+        // Time from the end of an overrunning time slot back to the scheduled start of the next one
+        LatenessStatistics deadline_misses{};
+        // Heap allocations of the executor and worker threads within the time slots, including those of the tasks.
+        // Only counted with VAF_ALLOCATION_TRACKING, see vaf/allocation_tracking.h.
+        uint64_t time_slot_allocations{0};
+        // Time slots with at least one heap allocation, stays constant once the executable is in its steady state
+        uint64_t allocating_time_slots{0};
+    };
+
+    /*!
+     * \brief Behavior of the executor if the tasks of a time slot do not finish before the next time slot.
+     */
+    enum class OverrunPolicy : std::uint8_t {
+        // Execute the missed time slots back-to-back until the executor is on time again
+        kCatchUp,
+        // Drop the missed time slots and continue with the next time slot that is still ahead
+        kSkip,
+        // Catch up, but drop the tasks of the lowest priority level per overrun until the executor is on time again
+        kDegrade
+    };
+
+    /*!
+     * \brief Scheduling policy of the executor and worker threads.
+     */
+    enum class SchedulingPolicy : std::uint8_t {
+        // SCHED_OTHER, the default time sharing policy
+        kOther,
+        // SCHED_FIFO
+        kFifo,
+        // SCHED_RR
+        kRoundRobin
+    };
+
+    /*!
+     * \brief Operating system attributes of the executor and worker threads.
+     */
+    struct ThreadAttributes {
+        SchedulingPolicy scheduling_policy{SchedulingPolicy::kOther};
+        // Real-time priority, must be zero for SchedulingPolicy::kOther
+        int priority{0};
+        // CPUs the threads may run on, an empty list keeps the inherited affinity
+        vaf::Vector<std::size_t> cpu_affinity{};
+        // NUMA node whose CPUs the threads run on if no cpu_affinity is given, see vaf/numa.h
+        std::optional<std::size_t> numa_node{};
+    };
+
+    // Default size of the stack area that LockMemory prefaults
+    constexpr std::size_t kDefaultStackPrefaultSize{512U * 1024U};
+
+    /*!
+     * \brief Locks all current and future pages of the process into memory and prefaults the stack of the caller.
+     * Threads created afterwards, e.g. by an Executor, get their stacks locked as well.
+     * \param stack_prefault_size Size of the stack area of the calling thread that is touched.
+     * \return Error if the memory could not be locked.
+     */
+    vaf::Result<void> LockMemory(std::size_t stack_prefault_size = kDefaultStackPrefaultSize);
+
+    /*!
+     * \brief Source of the time that starts the time slots of an executor.
+     * Without a time source, the executor follows the steady clock. A time source replaces it, e.g. by the virtual
+     * time of a co-simulation, so time slots start as soon as the simulation grants them instead of in real time.
+     */
+    class TimeSource {
+    public:
+        virtual ~TimeSource() = default;
+
+        /*!
+         * \brief Blocks until the time slot that starts at the given time may be executed.
+         * \param time Start of the time slot relative to the start of the first time slot.
+         * \return False if the time does not advance anymore, e.g. because the simulation ended or Interrupt was
+         *         called. The executor then executes no further time slots.
+         */
+        virtual bool WaitUntil(std::chrono::nanoseconds time) = 0;
+
+        // Wakes up a blocked WaitUntil for good, called by the executor on destruction
+        virtual void Interrupt() = 0;
+    };
+
+    /*!
+     * \brief Time source that only advances when told to, for unit tests of tasks.
+     * The executor executes the time slots up to the time granted by AdvanceBy as fast as the tasks allow, and
+     * AdvanceBy returns once they are done. So a test of a behavior over seconds takes as long as its tasks run, and
+     * its checks after AdvanceBy always see the same number of executions.
+     */
+    class ManualTimeSource final : public TimeSource {
+    public:
+        ManualTimeSource() = default;
+
+        /*!
+         * \brief Advances the time and waits until the executor executed the time slots that start before it.
+         * \param duration Time to advance, the first call executes the time slot at zero.
+         */
+        void AdvanceBy(std::chrono::nanoseconds duration);
+
+        // Time up to which the time slots are granted
+        std::chrono::nanoseconds Now() const;
+
+        bool WaitUntil(std::chrono::nanoseconds time) override;
+
+        void Interrupt() override;
+
+    private:
+        mutable std::mutex mutex_{};
+        std::condition_variable condition_{};
+        std::chrono::nanoseconds now_{0};
+        // Start of the time slot the executor waits for, negative before it first waits
+        std::chrono::nanoseconds waiting_for_{-1};
+        bool interrupted_{false};
+    };
+
+    class Executor;
+
     class TaskHandle {
     public:
-        TaskHandle(vaf::String name, uint64_t period, std::function<void(void)> task, const vaf::String &owner,
-                       const vaf::Vector<vaf::String> &run_after, uint64_t offset, std::chrono::nanoseconds budget);
+        template<typename T>
+        TaskHandle(vaf::String name, uint64_t period, T &&task, const vaf::String &owner,
+                       const vaf::Vector<vaf::String> &run_after, uint64_t offset, std::chrono::nanoseconds budget,
+                       const vaf::Vector<vaf::String> &run_after_tasks = {}, uint32_t priority = 0)
+            : name_{std::move(name)},
+              period_{period},
+              callable_{new std::decay_t<T>(std::forward<T>(task)),
+                        [](void *callable) { delete static_cast<std::decay_t<T> *>(callable); }},
+              invoke_{[](void *callable) { (*static_cast<std::decay_t<T> *>(callable))(); }},
+              owner_{owner},
+              run_after_{run_after},
+              offset_{offset},
+              budget_{budget},
+              run_after_tasks_{run_after_tasks},
+              priority_{priority} {
+        }
+
+        TaskHandle(const TaskHandle &) = delete;
+
+        TaskHandle &operator=(const TaskHandle &) = delete;
 
         const vaf::String &Name() const;
 
@@ -49,24 +292,74 @@ namespace vaf {
 
         const vaf::Vector<vaf::String> &RunAfter();
 
+        const vaf::Vector<vaf::String> &RunAfterTasks();
+
         uint64_t Offset() const;
 
         std::chrono::nanoseconds Budget() const;
 
+        uint32_t Priority() const;
+
+        TaskStatistics GetStatistics() const;
+
+        /*!
+         * \brief Requests the execution of an event-driven task, e.g. from a data element handler.
+         * Triggers while an execution is still pending are coalesced into it. Triggers of inactive tasks and of
+         * periodic tasks are ignored.
+         */
+        void Trigger();
+
     private:
+        friend class Executor;
+
+        // Preallocated counters, each one is only written by the thread that currently executes the task
+        struct Counters {
+            std::atomic<uint64_t> executions{0};
+            std::atomic<uint64_t> skipped_executions{0};
+            std::atomic<uint64_t> sampled_executions{0};
+            std::atomic<uint64_t> budget_violations{0};
+            // Written by all triggering threads
+            std::atomic<uint64_t> coalesced_events{0};
+            std::atomic<uint64_t> min_execution_time{UINT64_MAX};
+            std::atomic<uint64_t> max_execution_time{0};
+            std::atomic<uint64_t> total_execution_time{0};
+            std::array<std::atomic<uint64_t>, TaskStatistics::kHistogramBuckets> histogram{};
+            internal::LatenessRecorder start_lateness{};
+            std::atomic<uint64_t> allocations{0};
+        };
+
         vaf::String name_;
-        bool is_active_{false};
+        std::atomic<bool> own_active_flag_{false};
+        // Points into the activation flags of the executor once the task is registered
+        std::atomic<bool> *is_active_{&own_active_flag_};
         uint64_t period_;
-        std::function<void(void)> task_;
+        std::unique_ptr<void, void (*)(void *)> callable_;
+        void (*invoke_)(void *);
         vaf::String owner_;
         vaf::Vector<vaf::String> run_after_;
         uint64_t offset_;
         std::chrono::nanoseconds budget_;
+        vaf::Vector<vaf::String> run_after_tasks_;
+        uint32_t priority_;
+        Counters counters_{};
+        // Set for tasks created by Executor::RunOnEvent
+        Executor *event_executor_{nullptr};
+        std::atomic<bool> event_pending_{false};
     };
 
     class Executor {
     public:
-        explicit Executor(std::chrono::milliseconds running_period);
+        /*!
+         * \brief Creates an executor with the given time slot period.
+         * \param running_period Period of one executor time slot.
+         * \param worker_threads Number of worker threads executing the tasks of a time slot. With one worker
+         *        thread all tasks are executed sequentially by the executor thread. With more than one, independent
+         *        tasks of a time slot run concurrently. Zero selects one worker per hardware thread.
+         * \param time_source Source of the time that starts the time slots, nullptr for the steady clock. With a time
+         *        source, time slots never overrun, as the time only advances once the tasks of a time slot are done.
+         */
+        explicit Executor(std::chrono::microseconds running_period, std::size_t worker_threads = 1,
+                          std::shared_ptr<TimeSource> time_source = nullptr);
 
         ~Executor();
 
@@ -78,8 +371,50 @@ namespace vaf {
 
         Executor &operator=(Executor &&) = delete;
 
+        /*!
+         * \brief Sets how often task execution times are measured, also in release builds.
+         * \param sample_interval Every sample_interval-th execution of a task is measured. One measures every
+         *        execution, zero disables the measurement and the start lateness of the tasks.
+         */
+        void SetStatisticsSampleInterval(uint32_t sample_interval);
+
+        /*!
+         * \brief Sets the behavior of the executor if a time slot overruns, the default is OverrunPolicy::kCatchUp.
+         * \param overrun_policy The overrun policy.
+         */
+        void SetOverrunPolicy(OverrunPolicy overrun_policy);
+
+        /*!
+         * \brief Sets how long the executor busy-waits before a time slot instead of sleeping.
+         * Waking up from a sleep is less precise than busy-waiting, so spinning reduces the jitter of short time
+         * slots at the cost of CPU time. The default is 50us for time slots shorter than 1ms and zero otherwise.
+         * \param spin_duration The busy-waiting duration.
+         */
+        void SetSpinDuration(std::chrono::microseconds spin_duration);
+
+        /*!
+         * \brief Applies scheduling policy, priority and CPU affinity to the executor thread and all worker threads.
+         * \param thread_attributes The thread attributes.
+         * \return Error if the attributes could not be applied, e.g. due to missing privileges.
+         */
+        vaf::Result<void> SetThreadAttributes(const ThreadAttributes &thread_attributes);
+
+        ExecutorStatistics GetStatistics() const;
+
+        vaf::Vector<TaskStatistics> GetTaskStatistics();
+
+        /*!
+         * \brief Clears the lateness histograms of the executor and of all tasks, e.g. between the phases of a test.
+         * The other statistics keep counting. Lateness that is recorded concurrently may still count to the previous
+         * phase.
+         */
+        void ResetLatenessStatistics();
+
+        // Period of one time slot, the shortest period of a task
+        std::chrono::microseconds RunningPeriod() const;
+
         template<typename T>
-        std::shared_ptr<TaskHandle> RunPeriodic(std::chrono::milliseconds period,
+        std::shared_ptr<TaskHandle> RunPeriodic(std::chrono::microseconds period,
                                                     T &&task,
                                                     const vaf::String &owner,
                                                     const vaf::Vector<vaf::String> &run_after,
@@ -91,72 +426,226 @@ namespace vaf {
 
         template<typename T>
         std::shared_ptr<TaskHandle> RunPeriodic(const vaf::String &name,
-                                                    std::chrono::milliseconds period,
+                                                    std::chrono::microseconds period,
                                                     T &&task,
                                                     const vaf::String &owner,
                                                     const vaf::Vector<vaf::String> &run_after,
                                                     const vaf::Vector<vaf::String> &run_after_tasks = {},
                                                     uint64_t offset = 0,
-                                                    std::chrono::nanoseconds budget = std::chrono::nanoseconds{0}) {
-            auto check_can_run = [this, &run_after, &run_after_tasks](
-                    vaf::Vector<std::shared_ptr<TaskHandle>>::iterator current_position) {
-                auto pos{std::next(current_position)};
-                bool can_run{true};
-                for (; pos != tasks_.end(); ++pos) {
-                    if (std::any_of(run_after.begin(), run_after.end(), [&pos](const vaf::String &run_after_element) {
-                        return pos->get()->Owner() == run_after_element;
-                    })) {
-                        can_run = false;
-                        break;
-                    }
-                    if (current_position->get()->Owner() == pos->get()->Owner()) {
-                        if (std::any_of(run_after_tasks.begin(), run_after_tasks.end(),
-                                        [&pos](const vaf::String &run_after_element) {
-                                            return pos->get()->Name() == run_after_element;
-                                        })) {
-                            can_run = false;
-                            break;
-                        }
-                    }
-                }
-
-                return can_run;
-            };
-
-            auto search_pos{tasks_.begin()};
-            for (; search_pos != tasks_.end(); ++search_pos) {
-                if (check_can_run(search_pos)) {
-                    break;
-                }
-            }
-
-            // TODO implement run_after_tasks
+                                                    std::chrono::nanoseconds budget = std::chrono::nanoseconds{0},
+                                                    uint32_t priority = 0) {
+            auto handle{std::make_shared<TaskHandle>(name, PeriodInTimeSlots(name, period, owner),
+                                                     std::forward<T>(task), owner, run_after, offset, budget,
+                                                     run_after_tasks, priority)};
+
+            AddTask(handle);
+            return handle;
+        }
 
-            auto insert_pos = tasks_.insert(search_pos,
-                                                std::make_unique<TaskHandle>(name, period / running_period_,
-                                                                                 std::forward<T>(task), owner,
-                                                                                 run_after, offset, budget));
-            return *insert_pos;
+        /*!
+         * \brief Registers an event-driven task that runs whenever TaskHandle::Trigger is called.
+         * Event-driven tasks are executed by the executor thread as soon as it is idle between two time slots, so they
+         * never run concurrently to the periodic tasks.
+         * \param name Name of the task.
+         * \param task Callable of the task.
+         * \param owner Name of the module the task belongs to.
+         * \param budget Execution time budget of the task.
+         * \return Handle to trigger, start and stop the task.
+         */
+        template<typename T>
+        std::shared_ptr<TaskHandle> RunOnEvent(const vaf::String &name, T &&task, const vaf::String &owner,
+                                               std::chrono::nanoseconds budget = std::chrono::nanoseconds{0}) {
+            auto handle{std::make_shared<TaskHandle>(name, 0, std::forward<T>(task), owner, vaf::Vector<vaf::String>{},
+                                                     0, budget)};
+            handle->event_executor_ = this;
+            AddTask(handle);
+            return handle;
         }
 
     private:
+        friend class TaskHandle;
+
+        // Hot data of a task as used in every time slot, names and dependencies stay in the TaskHandle
+        struct TaskEntry {
+            const std::atomic<bool> *active;
+            void (*invoke)(void *);
+            void *callable;
+            uint64_t period;
+            uint64_t offset;
+            std::chrono::nanoseconds budget;
+            uint32_t priority;
+            TaskHandle::Counters *counters;
+            // Index of the module of the task in TaskSet::last_due_of_owner
+            std::size_t owner;
+            // Successors in the task graph are stored from successors_begin up to successors_end in successor_table_
+            std::size_t successors_begin;
+            std::size_t successors_end;
+            // Scheduling state of the worker pool, guarded by ready_mutex_
+            std::size_t pending_predecessors;
+            bool is_due;
+            // The next due task of the same module in this time slot, which waits for this one
+            TaskEntry *next_due_of_owner;
+            TaskHandle *handle;
+        };
+
+        // Immutable snapshot of all registered tasks, published to the executor thread on every registration
+        struct TaskSet {
+            // Task table in topological order and the flattened successor lists of the task graph as table indices
+            vaf::Vector<std::shared_ptr<TaskHandle>> tasks{};
+            vaf::Vector<TaskEntry> task_table{};
+            vaf::Vector<std::size_t> successor_table{};
+            // Scheduling state of the worker pool per module, guarded by ready_mutex_
+            vaf::Vector<TaskEntry *> last_due_of_owner{};
+
+            // Static schedule over the hyperperiod, a hyperperiod of zero selects the evaluation of all tasks per time
+            // slot. The tasks of slot i are stored from schedule_slots[i] up to schedule_slots[i + 1] in
+            // schedule_tasks.
+            uint64_t hyperperiod{0};
+            uint64_t max_offset{0};
+            vaf::Vector<std::size_t> schedule_slots{};
+            vaf::Vector<TaskEntry *> schedule_tasks{};
+
+            // Distinct task priorities in ascending order
+            vaf::Vector<uint32_t> priority_levels{};
+        };
+
         void ExecutorThread();
 
-        void ExecuteTask(TaskHandle &task);
+        void WorkerThread();
+
+        void ExecuteTask(const TaskEntry &task);
 
-        std::chrono::milliseconds running_period_;
+        void ExecuteTasksOnWorkers(TaskSet &task_set);
+
+        void AddTask(std::shared_ptr<TaskHandle> handle);
+
+        // Period of a task in time slots, at least one time slot
+        uint64_t PeriodInTimeSlots(const vaf::String &name, std::chrono::microseconds period, const vaf::String &owner);
+
+        void TriggerEvent(TaskHandle &task);
+
+        void WaitForNextTimeSlot(std::chrono::steady_clock::time_point next_run);
+
+        bool WaitForTimeSource(uint64_t counter);
+
+        void ExecuteEventTask(TaskHandle &task);
+
+        std::unique_ptr<TaskSet> BuildTaskSet();
+
+        static void BuildScheduleTable(TaskSet &task_set);
+
+        TaskSet &AcquireTaskSet();
+
+        void ReleaseTaskSet();
+
+        void CollectDueTasks(TaskSet &task_set, uint64_t counter, std::size_t shed_levels);
+
+        std::chrono::microseconds running_period_;
+        std::shared_ptr<TimeSource> time_source_;
+
+        // Registration state, never locked by the executor thread
+        std::mutex registration_mutex_{};
         vaf::Vector<std::shared_ptr<TaskHandle>> tasks_{};
+        // Stable storage, so the activation flags of all tasks are densely packed
+        std::deque<std::atomic<bool>> activation_flags_{};
+        // Owns all published task sets that may still be read by the executor thread
+        vaf::Vector<std::unique_ptr<TaskSet>> task_sets_{};
+
+        // Latest published task set and the task set currently read by the executor thread
+        std::atomic<TaskSet *> task_set_{nullptr};
+        std::atomic<TaskSet *> task_set_in_use_{nullptr};
         std::atomic<bool> exit_requested_{false};
-        std::thread thread_;
+
+        // Triggered event-driven tasks, kept alive by tasks_
+        std::mutex event_mutex_{};
+        std::condition_variable event_condition_{};
+        std::deque<TaskHandle *> pending_events_{};
+
+        std::atomic<uint32_t> statistics_sample_interval_{1};
+        std::atomic<OverrunPolicy> overrun_policy_{OverrunPolicy::kCatchUp};
+        std::atomic<std::chrono::microseconds::rep> spin_duration_{0};
+        std::atomic<uint64_t> time_slots_{0};
+        std::atomic<uint64_t> overruns_{0};
+        std::atomic<uint64_t> skipped_time_slots_{0};
+        std::atomic<uint64_t> max_time_slot_duration_{0};
+        internal::LatenessRecorder wake_up_lateness_{};
+        internal::LatenessRecorder deadline_misses_{};
+        // Written by the executor thread and the workers
+        std::atomic<uint64_t> time_slot_allocations_{0};
+        std::atomic<uint64_t> allocating_time_slots_{0};
+        // Scheduled start of the current time slot, read by the tasks to record their start lateness
+        std::chrono::steady_clock::time_point time_slot_start_{};
         vaf::Logger &logger_;
+
+        std::mutex ready_mutex_{};
+        std::condition_variable ready_condition_{};
+        std::condition_variable done_condition_{};
+        std::deque<TaskEntry *> ready_tasks_{};
+        TaskSet *dispatched_task_set_{nullptr};
+        vaf::Vector<TaskEntry *> due_tasks_{};
+        std::size_t remaining_tasks_{0};
+        bool workers_exit_requested_{false};
+        vaf::Vector<std::thread> workers_{};
+        std::thread thread_;
     };
 
+    class ModuleExecutor;
+
+    namespace internal {
+        /*!
+         * \brief Callables posted to a module from any thread, executed once by an event-driven task of the module in
+         * the order they were posted.
+         */
+        class PostedTasks {
+        public:
+            template<typename T>
+            void Post(T &&task) {
+                {
+                    std::lock_guard<std::mutex> lock{mutex_};
+                    tasks_.push_back(Callable{
+                            std::unique_ptr<void, void (*)(void *)>{
+                                    new std::decay_t<T>(std::forward<T>(task)),
+                                    [](void *callable) { delete static_cast<std::decay_t<T> *>(callable); }},
+                            [](void *callable) { (*static_cast<std::decay_t<T> *>(callable))(); }});
+                }
+                handle_->Trigger();
+            }
+
+            // Posts a callable that is not owned by the queue, e.g. the resumption of a coroutine, without allocating
+            void Post(void (*invoke)(void *), void *context) {
+                {
+                    std::lock_guard<std::mutex> lock{mutex_};
+                    tasks_.push_back(Callable{std::unique_ptr<void, void (*)(void *)>{context, [](void *) {}}, invoke});
+                }
+                handle_->Trigger();
+            }
+
+            // Executes the callables posted so far, the ones posted meanwhile trigger the next execution
+            void Run();
+
+        private:
+            friend class vaf::ModuleExecutor;
+
+            struct Callable {
+                std::unique_ptr<void, void (*)(void *)> callable;
+                void (*invoke)(void *);
+            };
+
+            std::mutex mutex_{};
+            vaf::Vector<Callable> tasks_{};
+            // Callables taken by Run, swapped with tasks_ so both keep their capacity
+            vaf::Vector<Callable> running_{};
+            // Set before the posted tasks are handed out
+            std::shared_ptr<TaskHandle> handle_{};
+        };
+    } // namespace internal
+
     class ModuleExecutor {
     public:
         ModuleExecutor(Executor &executor, vaf::String name, vaf::Vector<vaf::String> dependencies);
 
         template<typename T>
-        void RunPeriodic(std::chrono::milliseconds period, T &&task, uint64_t offset = 0,
+        void RunPeriodic(std::chrono::microseconds period, T &&task, uint64_t offset = 0,
                          std::chrono::nanoseconds budget = std::chrono::nanoseconds{0}) {
             handles_.emplace_back(
                     executor_.RunPeriodic(period, std::move(task), name_, dependencies_, offset, budget));
@@ -167,11 +656,24 @@ namespace vaf {
         }
 
         template<typename T>
-        void RunPeriodic(const vaf::String &name, std::chrono::milliseconds period, T &&task,
+        void RunPeriodic(const vaf::String &name, std::chrono::microseconds period, T &&task,
                          vaf::Vector<vaf::String> task_dependencies = {}, uint64_t offset = 0,
-                         std::chrono::nanoseconds budget = std::chrono::nanoseconds{0}) {
-            handles_.emplace_back(executor_.RunPeriodic(name, period, std::move(task), name_, dependencies_,
-                                                        std::move(task_dependencies), offset, budget));
+                         std::chrono::nanoseconds budget = std::chrono::nanoseconds{0}, uint32_t priority = 0) {
+            RunPeriodic(executor_, name, period, std::forward<T>(task), std::move(task_dependencies), offset, budget,
+                        priority);
+        }
+
+        /*!
+         * \brief Registers a periodic task of this module with another executor of the executable, e.g. one with a
+         * longer time slot. The task is started and stopped with the module. Its dependencies only order it after
+         * the tasks of the same executor.
+         */
+        template<typename T>
+        void RunPeriodic(Executor &executor, const vaf::String &name, std::chrono::microseconds period, T &&task,
+                         vaf::Vector<vaf::String> task_dependencies = {}, uint64_t offset = 0,
+                         std::chrono::nanoseconds budget = std::chrono::nanoseconds{0}, uint32_t priority = 0) {
+            handles_.emplace_back(executor.RunPeriodic(name, period, std::forward<T>(task), name_, dependencies_,
+                                                       std::move(task_dependencies), offset, budget, priority));
 
             if (started_) {
                 handles_.back()->Start();
@@ -182,12 +684,48 @@ namespace vaf {
 
         void Stop();
 
+        /*!
+         * \brief Registers an event-driven task of this module, see Executor::RunOnEvent.
+         * \return Handle whose Trigger method requests an execution of the task.
+         */
+        template<typename T>
+        std::shared_ptr<TaskHandle> RunOnEvent(const vaf::String &name, T &&task,
+                                               std::chrono::nanoseconds budget = std::chrono::nanoseconds{0}) {
+            handles_.emplace_back(executor_.RunOnEvent(name, std::forward<T>(task), name_, budget));
+
+            if (started_) {
+                handles_.back()->Start();
+            }
+            return handles_.back();
+        }
+
+        /*!
+         * \brief Runs the callable once by an event-driven task of this module, e.g. to handle a result that arrived
+         * on another thread. Can be called from any thread. Callables posted while the module is stopped run after
+         * it is started again.
+         */
+        template<typename T>
+        void Post(T &&task) {
+            GetPostedTasks()->Post(std::forward<T>(task));
+        }
+
+        // Queue behind Post, which stays valid if it is kept beyond the lifetime of the module executor
+        std::shared_ptr<internal::PostedTasks> GetPostedTasks();
+
+        vaf::Vector<TaskStatistics> GetStatistics() const;
+
+        // Period of one time slot of the executor
+        std::chrono::microseconds RunningPeriod() const;
+
     private:
         Executor &executor_;
         vaf::Vector<std::shared_ptr<TaskHandle>> handles_;
         bool started_;
         vaf::String name_;
         vaf::Vector<vaf::String> dependencies_;
+        // Created with the first Post, guards started_ against the creation from another thread
+        std::mutex posted_tasks_mutex_{};
+        std::shared_ptr<internal::PostedTasks> posted_tasks_{};
     };
 
 } // namespace vaf
@@ -16,8 +16,19 @@
 #ifndef VAF_FUTURE_H_
 #define VAF_FUTURE_H_
 
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
 #include <future>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <utility>
 
+#include "vaf/container_types.h"
+#include "vaf/executor.h"
 #include "vaf/logging.h"
 #include "vaf/result.h"
 
@@ -27,35 +38,151 @@ namespace internal {
 template <typename T>
 class Promise;
 
-} // namespace internal
+struct FutureAccess;
 
+/*!
+ * \brief Result of an asynchronous operation, shared by a promise and its future.
+ * The first result that is set wins, later ones are ignored. This lets a timeout or a cancellation race with the
+ * real result. A continuation attached by the future is called by the thread that sets the result.
+ * Setting the result, attaching a continuation and checking for the result only use the atomic flags. The mutex and
+ * the condition variable are used if a thread blocks on the result.
+ */
+template <typename T>
+class FutureState {
+ public:
+  using Continuation = std::function<void(vaf::Result<T>)>;
+
+  FutureState() = default;
+  FutureState(const FutureState&) = delete;
+  FutureState& operator=(const FutureState&) = delete;
+  ~FutureState() = default;
+
+  // Returns false if the state already had a result
+  bool SetResult(vaf::Result<T>&& result) {
+    if ((flags_.fetch_or(kClaimed, std::memory_order_acquire) & kClaimed) != 0U) {
+      return false;
+    }
+    result_.emplace(std::move(result));
+    const std::uint8_t previous{flags_.fetch_or(kReady, std::memory_order_acq_rel)};
+    if ((previous & kWaiting) != 0U) {
+      // The waiter checks the flags under the mutex, so it waits already or sees the result
+      { std::lock_guard<std::mutex> lock{mutex_}; }
+      condition_.notify_all();
+    }
+    if ((previous & kHasContinuation) != 0U) {
+      Continuation continuation{std::move(continuation_)};
+      continuation(Take());
+    }
+    return true;
+  }
+
+  void SetContinuation(Continuation&& continuation) {
+    continuation_ = std::move(continuation);
+    // Whoever of this and SetResult comes second calls the continuation
+    if ((flags_.fetch_or(kHasContinuation, std::memory_order_acq_rel) & kReady) != 0U) {
+      Continuation ready_continuation{std::move(continuation_)};
+      ready_continuation(Take());
+    }
+  }
+
+  bool IsReady() const { return (flags_.load(std::memory_order_acquire) & kReady) != 0U; }
+
+  void Wait() const {
+    if (!IsReady()) {
+      flags_.fetch_or(kWaiting, std::memory_order_acq_rel);
+      std::unique_lock<std::mutex> lock{mutex_};
+      condition_.wait(lock, [this]() { return IsReady(); });
+    }
+  }
+
+  template <typename Clock, typename Duration>
+  bool WaitUntil(const std::chrono::time_point<Clock, Duration>& timeout_time) const {
+    if (IsReady()) {
+      return true;
+    }
+    flags_.fetch_or(kWaiting, std::memory_order_acq_rel);
+    std::unique_lock<std::mutex> lock{mutex_};
+    return condition_.wait_until(lock, timeout_time, [this]() { return IsReady(); });
+  }
+
+  // Waits for the result and moves it out, must only be called once
+  vaf::Result<T> Take() {
+    Wait();
+    vaf::Result<T> result{std::move(*result_)};
+    result_.reset();
+    return result;
+  }
+
+ private:
+  // A result is being set, later ones are ignored. Stays set after the result was taken
+  static constexpr std::uint8_t kClaimed{1U};
+  // The result is stored
+  static constexpr std::uint8_t kReady{2U};
+  static constexpr std::uint8_t kHasContinuation{4U};
+  // A thread waits or is about to wait on the condition variable
+  static constexpr std::uint8_t kWaiting{8U};
+
+  mutable std::atomic<std::uint8_t> flags_{0U};
+  mutable std::mutex mutex_{};
+  mutable std::condition_variable condition_{};
+  std::optional<vaf::Result<T>> result_{};
+  Continuation continuation_{};
+};
+
+}  // namespace internal
+
+/*!
+ * \brief Future of a vaf::Result<T>.
+ * A future whose result was set before it was created keeps the result itself, so it needs no shared state.
+ */
 template <typename T>
 class Future {
  public:
-  Future() : future_{} {}
+  Future() : state_{} {}
 
-  Future(Future&& future) : future_{std::move(future.future_)} {}
+  Future(Future&& future) noexcept : state_{std::move(future.state_)}, ready_{std::move(future.ready_)} {
+    future.ready_.reset();
+  }
   Future(const Future& other) = delete;
 
   Future& operator=(Future&& other) noexcept {
-    if (this != &other) future_ = std::move(other.future_);
+    if (this != &other) {
+      state_ = std::move(other.state_);
+      ready_ = std::move(other.ready_);
+      other.ready_.reset();
+    }
     return *this;
   }
   Future& operator=(const Future& other) = delete;
 
-  bool valid() const noexcept { return future_.valid(); }
+  bool valid() const noexcept { return (state_ != nullptr) || ready_.has_value(); }
 
-  void wait() const { future_.wait(); }
+  void wait() const {
+    if (!ready_.has_value()) {
+      state_->Wait();
+    }
+  }
 
   std::future_status wait_for(std::chrono::nanoseconds const& timeout_duration) const {
-    return future_.wait_for(timeout_duration);
+    return wait_until(std::chrono::steady_clock::now() + timeout_duration);
   }
 
-  std::future_status wait_until(const std::chrono::system_clock::time_point& timeout_time) const {
-    return wait_until(timeout_time);
+  template <typename Clock, typename Duration>
+  std::future_status wait_until(const std::chrono::time_point<Clock, Duration>& timeout_time) const {
+    return (ready_.has_value() || state_->WaitUntil(timeout_time)) ? std::future_status::ready
+                                                                    : std::future_status::timeout;
   }
 
-  vaf::Result<T> GetResult() { return future_.get(); }
+  // Waits for the result and returns it, the future is invalid afterwards
+  vaf::Result<T> GetResult() {
+    if (ready_.has_value()) {
+      vaf::Result<T> result{std::move(*ready_)};
+      ready_.reset();
+      return result;
+    }
+    std::shared_ptr<internal::FutureState<T>> state{std::move(state_)};
+    return state->Take();
+  }
 
   T get() {
     vaf::Result<T> res{GetResult()};
@@ -66,18 +193,142 @@ class Future {
     return std::move(res).Value();
   }
 
-  bool is_ready() const noexcept {
-    if (this->valid()) return future_.wait_for(std::chrono::milliseconds(0)) == std::future_status::ready;
-    return false;
+  bool is_ready() const noexcept { return ready_.has_value() || (valid() && state_->IsReady()); }
+
+  /*!
+   * \brief Calls a continuation with the result instead of waiting for it, the future is invalid afterwards.
+   * The continuation is called right away if the result is already there, otherwise by the thread that sets it, for
+   * example the communication thread of a platform module. So it should be short and must not block.
+   * \param continuation Callable taking a vaf::Result<T>
+   */
+  template <typename F>
+  void Then(F&& continuation) {
+    if (ready_.has_value()) {
+      std::forward<F>(continuation)(GetResult());
+      return;
+    }
+    std::shared_ptr<internal::FutureState<T>> state{std::move(state_)};
+    state->SetContinuation(typename internal::FutureState<T>::Continuation{std::forward<F>(continuation)});
+  }
+
+  /*!
+   * \brief Calls a continuation with the result from an event-driven task of the module executor, instead of polling
+   * the future in a periodic task. The continuation runs like the other tasks of the module, so it may take its time.
+   * The future is invalid afterwards.
+   * \param executor Module executor of the calling module, e.g. executor_
+   * \param continuation Callable taking a vaf::Result<T>
+   */
+  template <typename F>
+  void Then(vaf::ModuleExecutor& executor, F&& continuation) {
+    Then([posted_tasks = executor.GetPostedTasks(),
+          continuation = std::forward<F>(continuation)](vaf::Result<T> result) mutable {
+      posted_tasks->Post([continuation = std::move(continuation), result = std::move(result)]() mutable {
+        continuation(std::move(result));
+      });
+    });
+  }
+
+  /*!
+   * \brief Gives up waiting for the result. The future becomes ready with an error, and the result of the operation
+   * is dropped when it arrives.
+   */
+  void Cancel() {
+    // A future which keeps its result is ready already, so the result stays
+    if (!ready_.has_value() && (state_ != nullptr)) {
+      state_->SetResult(vaf::Result<T>{vaf::Error{vaf::ErrorCode::kNotOk, "Operation cancelled"}});
+    }
   }
 
  private:
-  std::future<vaf::Result<T>> future_;
-  Future(std::future<vaf::Result<T>>&& future) : future_{std::move(future)} {}
+  std::shared_ptr<internal::FutureState<T>> state_;
+  std::optional<vaf::Result<T>> ready_{};
+  explicit Future(std::shared_ptr<internal::FutureState<T>> state) : state_{std::move(state)} {}
+  explicit Future(vaf::Result<T>&& result) : state_{}, ready_{std::move(result)} {}
 
   friend vaf::internal::Promise<T>;
+  friend vaf::internal::FutureAccess;
+};
+
+namespace internal {
+
+// Creates the futures of the combinators
+struct FutureAccess {
+  template <typename T>
+  static Future<T> Create(std::shared_ptr<FutureState<T>> state) {
+    return Future<T>{std::move(state)};
+  }
 };
 
+}  // namespace internal
+
+/*!
+ * \brief Result of WhenAny
+ */
+template <typename T>
+struct WhenAnyResult {
+  // Position of the future that completed first
+  std::size_t index;
+  vaf::Result<T> result;
+};
+
+/*!
+ * \brief Combines futures into one that becomes ready when all of them are ready. The futures are invalid afterwards.
+ * \param futures Futures to wait for
+ * \return Future of the results, in the order of the futures
+ */
+template <typename T>
+Future<vaf::Vector<vaf::Result<T>>> WhenAll(vaf::Vector<Future<T>>&& futures) {
+  struct Collected {
+    explicit Collected(std::size_t count) : results(count), remaining{count} {}
+    vaf::Vector<std::optional<vaf::Result<T>>> results;
+    std::atomic<std::size_t> remaining;
+    std::shared_ptr<internal::FutureState<vaf::Vector<vaf::Result<T>>>> state{
+        std::make_shared<internal::FutureState<vaf::Vector<vaf::Result<T>>>>()};
+  };
+  auto collected{std::make_shared<Collected>(futures.size())};
+  Future<vaf::Vector<vaf::Result<T>>> combined{internal::FutureAccess::Create(collected->state)};
+  if (futures.empty()) {
+    collected->state->SetResult(vaf::Result<vaf::Vector<vaf::Result<T>>>{vaf::Vector<vaf::Result<T>>{}});
+  }
+  for (std::size_t index{0}; index < futures.size(); ++index) {
+    futures[index].Then([collected, index](vaf::Result<T> result) {
+      // Each continuation writes its own element, the last one sees all of them
+      collected->results[index].emplace(std::move(result));
+      if (collected->remaining.fetch_sub(1U, std::memory_order_acq_rel) == 1U) {
+        vaf::Vector<vaf::Result<T>> results{};
+        results.reserve(collected->results.size());
+        for (std::optional<vaf::Result<T>>& element : collected->results) {
+          results.push_back(std::move(*element));
+        }
+        collected->state->SetResult(vaf::Result<vaf::Vector<vaf::Result<T>>>{std::move(results)});
+      }
+    });
+  }
+  return combined;
+}
+
+/*!
+ * \brief Combines futures into one that becomes ready when the first of them is ready, the later results are dropped.
+ * The futures are invalid afterwards.
+ * \param futures Futures to wait for
+ * \return Future of the first result and its position, an error if there are no futures
+ */
+template <typename T>
+Future<WhenAnyResult<T>> WhenAny(vaf::Vector<Future<T>>&& futures) {
+  auto state{std::make_shared<internal::FutureState<WhenAnyResult<T>>>()};
+  Future<WhenAnyResult<T>> combined{internal::FutureAccess::Create(state)};
+  if (futures.empty()) {
+    state->SetResult(vaf::Result<WhenAnyResult<T>>{vaf::Error{vaf::ErrorCode::kNotOk, "WhenAny without futures"}});
+  }
+  for (std::size_t index{0}; index < futures.size(); ++index) {
+    // The first result wins in the state, the later ones are ignored
+    futures[index].Then([state, index](vaf::Result<T> result) {
+      state->SetResult(vaf::Result<WhenAnyResult<T>>{WhenAnyResult<T>{index, std::move(result)}});
+    });
+  }
+  return combined;
+}
+
 template <typename T>
 bool is_future_ready(vaf::Future<T> const& f, uint32_t timeout_ms = 0) {
   if (f.valid()) return f.wait_for(std::chrono::milliseconds(timeout_ms)) == std::future_status::ready;
@@ -16,7 +16,12 @@
 #ifndef VAF_DATA_PTR_HELPER_H_
 #define VAF_DATA_PTR_HELPER_H_
 
+#include <functional>
+#include <utility>
+
+#include "vaf/container_types.h"
 #include "vaf/data_ptr.h"
+#include "vaf/sample_trace.h"
 
 namespace vaf {
 namespace internal {
@@ -28,9 +33,84 @@ class DataPtrHelper {
   DataPtrHelper(const DataPtrHelper&) = delete;
   DataPtrHelper& operator=(const DataPtrHelper&) = delete;
 
-  static std::unique_ptr<T> getRawPtr(::vaf::DataPtr<T>& ptr) { return std::move(ptr.container_->raw_ptr_); };
+  // Moves the sample out if the pointer is the only one referring to it, otherwise the caller gets a copy
+  static std::unique_ptr<T> getRawPtr(::vaf::DataPtr<T>& ptr) {
+    if (ptr.block_ == nullptr) {
+      return std::unique_ptr<T>{};
+    }
+    std::unique_ptr<T> raw_ptr{};
+    if (ptr.block_->IsUnique()) {
+      raw_ptr = ptr.block_->ReleasePayload();
+      if (!raw_ptr) {
+        raw_ptr = std::make_unique<T>(std::move(*ptr.ptr_));
+      }
+    } else {
+      raw_ptr = std::make_unique<T>(*ptr.ptr_);
+    }
+    ptr.Reset();
+    return raw_ptr;
+  };
+
+  // Hands the sample over without copying it
+  static ::vaf::ConstDataPtr<const T> toConstDataPtr(::vaf::DataPtr<T>& ptr) {
+    ::vaf::ConstDataPtr<const T> const_ptr{};
+    const_ptr.block_ = ptr.block_;
+    const_ptr.ptr_ = ptr.ptr_;
+    ptr.block_ = nullptr;
+    ptr.ptr_ = nullptr;
+    return const_ptr;
+  };
+
+  // Creates a data pointer that takes over one reference of the block
+  static ::vaf::DataPtr<T> fromBlock(DataPtrBlock<T>* block) { return ::vaf::DataPtr<T>{block}; };
+
+  // Takes over the reference of a constant data pointer, nullptr if it is empty
+  static DataPtrBlock<T>* releaseConstBlock(::vaf::ConstDataPtr<const T>& ptr) {
+    DataPtrBlock<T>* block{ptr.block_};
+    ptr.block_ = nullptr;
+    ptr.ptr_ = nullptr;
+    return block;
+  };
+
+  // Creates a constant data pointer that takes over one reference of the block
+  static ::vaf::ConstDataPtr<const T> fromConstBlock(DataPtrBlock<T>* block) {
+    if (block == nullptr) {
+      return ::vaf::ConstDataPtr<const T>{};
+    }
+    return ::vaf::ConstDataPtr<const T>{block};
+  };
+
+  // Stamps the sample before it is published, while sample tracing is enabled
+  static void setStamp(const ::vaf::ConstDataPtr<const T>& ptr, const SampleStamp& stamp) {
+    if (ptr.block_ != nullptr) {
+      ptr.block_->SetStamp(stamp);
+    }
+  };
+
+  static SampleStamp getStamp(const ::vaf::ConstDataPtr<const T>& ptr) {
+    return (ptr.block_ != nullptr) ? ptr.block_->Stamp() : SampleStamp{};
+  };
 };
 
+/*!
+ * \brief Wraps a data element handler to record the latency of each sample it gets, while sample tracing is enabled.
+ * Otherwise the handler is returned as it is.
+ * \param name Name of the latency statistics, see vaf::GetSampleLatency
+ * \param handler The handler of the consumer
+ */
+template <typename T>
+std::function<void(const ::vaf::ConstDataPtr<const T>)> TraceHandler(
+    const vaf::String& name, std::function<void(const ::vaf::ConstDataPtr<const T>)>&& handler) {
+  if (!IsSampleTracingEnabled()) {
+    return std::move(handler);
+  }
+  SampleLatency& latency{GetSampleLatency(name)};
+  return [&latency, handler = std::move(handler)](::vaf::ConstDataPtr<const T> sample) {
+    latency.Record(DataPtrHelper<T>::getStamp(sample));
+    handler(std::move(sample));
+  };
+}
+
 }  // namespace internal
 }  // namespace vaf
 
@@ -17,27 +17,210 @@
 #define VAF_LOGGING_H_
 
 #include "vaf/output_sync_stream.h"
-#include <mutex>
-#include <list>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <new>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+/*!
+ * \brief Log levels more verbose than this one are compiled out by the VAF_LOG_* macros, for example
+ * target_compile_definitions(... VAF_LOG_COMPILED_LEVEL=3) keeps the fatal, error and warning lines only.
+ */
+#ifndef VAF_LOG_COMPILED_LEVEL
+#define VAF_LOG_COMPILED_LEVEL 6
+#endif
+
+/*!
+ * \brief Starts a log line of the logger like logger.LogWarn(), but the streamed arguments are only evaluated if the
+ * level is enabled, e.g. VAF_LOG_WARN(logger_) << "Queue " << ToString(queue) << " is full";
+ */
+#define VAF_LOG_FATAL(logger) VAF_INTERNAL_LOG(logger, FATAL, LogFatal)
+#define VAF_LOG_ERROR(logger) VAF_INTERNAL_LOG(logger, ERROR, LogError)
+#define VAF_LOG_WARN(logger) VAF_INTERNAL_LOG(logger, WARN, LogWarn)
+#define VAF_LOG_INFO(logger) VAF_INTERNAL_LOG(logger, INFO, LogInfo)
+#define VAF_LOG_DEBUG(logger) VAF_INTERNAL_LOG(logger, DEBUG, LogDebug)
+#define VAF_LOG_VERBOSE(logger) VAF_INTERNAL_LOG(logger, VERBOSE, LogVerbose)
+
+// The else branch holds the streamed arguments, the constant part of the condition removes it at compile time
+#define VAF_INTERNAL_LOG(logger, level, log_function)                                                            \
+    if ((vaf::Logger::level > VAF_LOG_COMPILED_LEVEL) || !vaf::Logger::IsEnabled(vaf::Logger::level)) {      \
+    } else                                                                                                     \
+        (logger).log_function()
 
 namespace vaf {
+    namespace internal {
+        // How the bytes of a log record are formatted by the log writer, the values are kept raw until then
+        enum class LogRecordKind : std::uint8_t {
+            kText = 0U,
+            kInt64 = 1U,
+            kUInt64 = 2U,
+            kDouble = 3U,
+            kBool = 4U,
+        };
+
+        // Fragment of a log line in the ring buffer of the logging thread
+        struct LogRecord {
+            static constexpr std::size_t kTextSize{124U};
+            LogRecordKind kind{LogRecordKind::kText};
+            std::uint8_t size{0U};
+            bool starts_line{false};
+            // Set on a line start if the line before was cut by a full ring buffer, the log writer drops that line
+            bool drops_open_line{false};
+            std::array<char, kTextSize> text{};
+        };
+
+        /*!
+         * \brief Ring buffer of the log records of one thread, written by that thread and read by the log writer.
+         * A record that does not fit is dropped and counted, so logging never waits for the output. The records up to
+         * the next line start are dropped with it, and the part of the line pushed before is dropped by the log
+         * writer, so only whole lines are lost.
+         */
+        class LogRing {
+        public:
+            static constexpr std::size_t kCapacity{512U};
+
+            // Returns true if the ring just became half full, then the log writer should not wait for its next round
+            bool Push(LogRecordKind kind, const char *text, std::size_t size, bool starts_line) noexcept {
+                if (starts_line) {
+                    dropping_line_ = false;
+                }
+                const std::size_t tail{tail_.load(std::memory_order_relaxed)};
+                const std::size_t used{tail - head_.load(std::memory_order_acquire)};
+                if (dropping_line_ || (used == kCapacity)) {
+                    if (!starts_line && !dropping_line_) {
+                        line_cut_.store(true, std::memory_order_relaxed);
+                    }
+                    dropping_line_ = true;
+                    dropped_.fetch_add(1U, std::memory_order_relaxed);
+                    return false;
+                }
+                LogRecord &record{records_[tail % kCapacity]};
+                record.kind = kind;
+                record.size = static_cast<std::uint8_t>(size);
+                record.starts_line = starts_line;
+                record.drops_open_line = starts_line && line_cut_.load(std::memory_order_relaxed);
+                std::memcpy(record.text.data(), text, size);
+                tail_.store(tail + 1U, std::memory_order_release);
+                if (record.drops_open_line) {
+                    // After the record is visible, so the log writer never writes the cut line in between
+                    line_cut_.store(false, std::memory_order_release);
+                }
+                return (used + 1U) == (kCapacity / 2U);
+            }
+
+            // Calls write with each record pushed so far, only called by the log writer
+            template<typename F>
+            void Pop(F &&write) {
+                const std::size_t tail{tail_.load(std::memory_order_acquire)};
+                for (std::size_t head{head_.load(std::memory_order_relaxed)}; head != tail; ++head) {
+                    write(records_[head % kCapacity]);
+                    head_.store(head + 1U, std::memory_order_release);
+                }
+            }
+
+            bool Empty() const noexcept {
+                return head_.load(std::memory_order_acquire) == tail_.load(std::memory_order_acquire);
+            }
+
+            std::uint64_t TakeDropped() noexcept { return dropped_.exchange(0U, std::memory_order_relaxed); }
+
+            // True while the last line pushed was cut and no line started since, then the log writer must not write it
+            bool IsLineCut() const noexcept { return line_cut_.load(std::memory_order_acquire); }
+
+            // Set when the thread ended, the log writer removes the ring once it is empty
+            std::atomic<bool> orphaned_{false};
+            // Number of the thread in the binary log output, set when the ring is registered
+            std::uint32_t id_{0U};
+            // The line the log writer formats for the thread, written to std::cout once it is complete
+            std::string open_line_{};
+
+        private:
+            std::array<LogRecord, kCapacity> records_{};
+            std::atomic<std::size_t> head_{0U};
+            std::atomic<std::size_t> tail_{0U};
+            std::atomic<std::uint64_t> dropped_{0U};
+            std::atomic<bool> line_cut_{false};
+            // Only used by the logging thread, set from a dropped record until the next line start
+            bool dropping_line_{false};
+        };
+
+        // Returns the ring buffer of the calling thread, registered with the log writer on the first call
+        LogRing &ThreadLogRing();
+        void WakeLogWriter() noexcept;
+
+        // Pushes the text as records, a text longer than one record continues in the next ones
+        inline void Log(const char *text, std::size_t size, bool starts_line = false) noexcept {
+            LogRing &ring{ThreadLogRing()};
+            do {
+                const std::size_t part{(size < LogRecord::kTextSize) ? size : LogRecord::kTextSize};
+                if (ring.Push(LogRecordKind::kText, text, part, starts_line)) {
+                    WakeLogWriter();
+                }
+                text += part;
+                size -= part;
+                starts_line = false;
+            } while (size > 0U);
+        }
+
+        // Pushes the raw bytes of a value as one record
+        template<typename T>
+        void LogValue(LogRecordKind kind, T value) noexcept {
+            static_assert(sizeof(T) <= LogRecord::kTextSize, "The value has to fit into one log record");
+            if (ThreadLogRing().Push(kind, reinterpret_cast<const char *>(&value), sizeof(T), false)) {
+                WakeLogWriter();
+            }
+        }
+
+        // Writes the records of all threads logged so far to std::cout, ends their open lines and flushes it
+        void FlushLog() noexcept;
+
+        /*!
+         * \brief Writes the following records into the binary file instead of formatting them for std::cout.
+         * The file starts with the magic "VAFLOG1" and a zero byte, followed by one entry per record, a little-endian
+         * header of thread (uint32), kind (uint8), starts line (uint8) and payload size (uint16) and the payload.
+         * Starts line is 2 if the line before of the thread was cut by a full ring buffer and is to be dropped. The
+         * kinds are the ones of LogRecordKind and the BinaryLogEntryKind ones of the log writer. Repeated texts are
+         * written once, with an id, and then referred to by that id. "vaf log decode" prints the file as text.
+         * \return False if the file could not be opened
+         */
+        bool SetBinaryLogOutput(const char *file_path) noexcept;
+    } // namespace internal
+
     class LoggerSingleton;
 
     class Logger {
     public:
+        enum LogLevel {
+            OFF = 0,
+            FATAL = 1,
+            ERROR = 2,
+            WARN = 3,
+            INFO = 4,
+            DEBUG = 5,
+            VERBOSE = 6
+        };
+
+        // True if lines of the level are logged, the level of all loggers is set through the LoggerSingleton
+        static auto IsEnabled(LogLevel level) noexcept -> bool {
+            return level <= log_level_.load(std::memory_order_relaxed);
+        }
+
         ~Logger() {
             if (previous_line_streamed) {
-                vaf::OutputSyncStream{} << std::endl;
+                internal::FlushLog();
             }
-            vaf::OutputSyncStream{} << std::flush;
         }
 
         auto LogFatal() -> Logger & {
             current_log_level_ = FATAL;
             log_start_message = true;
-            if (previous_line_streamed) {
-                vaf::OutputSyncStream{} << std::endl;
-            }
             return *this;
         }
 
@@ -45,68 +228,59 @@ namespace vaf {
         auto LogError() -> Logger & {
             current_log_level_ = ERROR;
             log_start_message = true;
-            if (previous_line_streamed) {
-                vaf::OutputSyncStream{} << std::endl;
-            }
             return *this;
         }
 
         auto LogWarn() -> Logger & {
             current_log_level_ = WARN;
             log_start_message = true;
-            if (previous_line_streamed) {
-                vaf::OutputSyncStream{} << std::endl;
-            }
             return *this;
         }
 
         auto LogInfo() -> Logger & {
             current_log_level_ = INFO;
             log_start_message = true;
-            if (previous_line_streamed) {
-                vaf::OutputSyncStream{} << std::endl;
-            }
             return *this;
         }
 
         auto LogDebug() -> Logger & {
             current_log_level_ = DEBUG;
             log_start_message = true;
-            if (previous_line_streamed) {
-                vaf::OutputSyncStream{} << std::endl;
-            }
             return *this;
         }
 
         auto LogVerbose() -> Logger & {
             current_log_level_ = VERBOSE;
             log_start_message = true;
-            if (previous_line_streamed) {
-                vaf::OutputSyncStream{} << std::endl;
-            }
             return *this;
         }
 
         auto operator<<(const char *s) noexcept -> Logger & {
-            if (current_log_level_ <= aimed_log_level_) {
-                previous_line_streamed = true;
-                if (log_start_message) {
-                    vaf::OutputSyncStream{} << "[" << ctx_id_ << ": " << ctx_description_ << "] ";
-                    log_start_message = false;
-                }
-                vaf::OutputSyncStream{} << s;
+            if (IsEnabled(current_log_level_)) {
+                LogText(s, std::strlen(s));
             }
             return *this;
         }
 
-        auto operator<<(int i) noexcept -> Logger & {
-            if (current_log_level_ <= aimed_log_level_) {
-                previous_line_streamed = true;
-                if (log_start_message) {
-                    vaf::OutputSyncStream{} << "[" << ctx_id_ << ": " << ctx_description_ << "] ";
-                    log_start_message = false;
+        // Also takes vaf::String
+        auto operator<<(std::string_view s) noexcept -> Logger & {
+            if (IsEnabled(current_log_level_)) {
+                LogText(s.data(), s.size());
+            }
+            return *this;
+        }
+
+        // Arithmetic types and enums are copied raw and formatted by the log writer, enums as their number
+        template<typename T, std::enable_if_t<std::is_arithmetic_v<T> || std::is_enum_v<T>, bool> = true>
+        auto operator<<(T value) noexcept -> Logger & {
+            if (IsEnabled(current_log_level_)) {
+                StartLine();
+                if constexpr (std::is_enum_v<T>) {
+                    LogNumber(static_cast<std::underlying_type_t<T>>(value));
+                } else {
+                    LogNumber(value);
                 }
-                vaf::OutputSyncStream{} << i;
+                EndFragment();
             }
             return *this;
         }
@@ -119,26 +293,51 @@ namespace vaf {
             this->current_log_level_ = logger_.current_log_level_;
             this->ctx_description_ = logger_.ctx_description_;
             this->ctx_id_ = logger_.ctx_id_;
-            this->aimed_log_level_ = logger_.aimed_log_level_;
         }
 
     private:
+        void LogText(const char *text, std::size_t size) noexcept {
+            StartLine();
+            internal::Log(text, size);
+            EndFragment();
+        }
 
-        enum LogLevel {
-            OFF = 0,
-            FATAL = 1,
-            ERROR = 2,
-            WARN = 3,
-            INFO = 4,
-            DEBUG = 5,
-            VERBOSE = 6
-        };
+        template<typename T>
+        void LogNumber(T value) noexcept {
+            if constexpr (std::is_same_v<T, bool>) {
+                internal::LogValue(internal::LogRecordKind::kBool, value);
+            } else if constexpr (std::is_same_v<T, char>) {
+                internal::Log(&value, 1U);
+            } else if constexpr (std::is_floating_point_v<T>) {
+                internal::LogValue(internal::LogRecordKind::kDouble, static_cast<double>(value));
+            } else if constexpr (std::is_signed_v<T>) {
+                internal::LogValue(internal::LogRecordKind::kInt64, static_cast<std::int64_t>(value));
+            } else {
+                internal::LogValue(internal::LogRecordKind::kUInt64, static_cast<std::uint64_t>(value));
+            }
+        }
+
+        void StartLine() noexcept {
+            previous_line_streamed = true;
+            if (log_start_message) {
+                // Cut to one record, so the prefix takes a single slot of the ring buffer
+                std::array<char, internal::LogRecord::kTextSize + 1U> prefix{};
+                const int prefix_size{std::snprintf(prefix.data(), prefix.size(), "[%s: %s] ", ctx_id_, ctx_description_)};
+                internal::Log(prefix.data(), std::min(static_cast<std::size_t>(std::max(prefix_size, 0)),
+                                                      internal::LogRecord::kTextSize), true);
+                log_start_message = false;
+            }
+        }
 
-        Logger(const char *ctx_id, const char *ctx_description, LogLevel aimed_log_level) : ctx_id_{ctx_id},
-                                                                                            ctx_description_{
-                                                                                                    ctx_description},
-                                                                                            aimed_log_level_{
-                                                                                                    aimed_log_level} {}
+        // The log lines are written by the log writer thread, fatal ones right away as the process ends after them
+        void EndFragment() noexcept {
+            if (current_log_level_ == FATAL) {
+                internal::FlushLog();
+            }
+        }
+
+        Logger(const char *ctx_id, const char *ctx_description) : ctx_id_{ctx_id},
+                                                                  ctx_description_{ctx_description} {}
 
         Logger() = delete;
 
@@ -148,75 +347,113 @@ namespace vaf {
 
         const char *ctx_id_;
         const char *ctx_description_;
-        LogLevel aimed_log_level_;
         LogLevel current_log_level_ = DEBUG;
         bool log_start_message = false;
         bool previous_line_streamed = false;
+
+        static inline std::atomic<LogLevel> log_level_{FATAL};
     };
 
     class LoggerSingleton {
     private:
-        LoggerSingleton() : log_level_{Logger::LogLevel::FATAL},
-                            default_logger_{CreateLogger("DL", "DefaultLogger")} {}
+        // The loggers are constructed in place in chunks that are never moved, so their references stay valid
+        static constexpr std::size_t kLoggersPerChunk{64U};
+        static constexpr std::size_t kMaxLoggerChunks{64U};
+
+        struct LoggerChunk {
+            alignas(Logger) unsigned char storage[kLoggersPerChunk * sizeof(Logger)];
+        };
+
+        LoggerSingleton() {
+            logger_chunks_[0].store(&first_logger_chunk_, std::memory_order_relaxed);
+        }
 
         LoggerSingleton(const LoggerSingleton &) = delete;
 
         LoggerSingleton &operator=(const LoggerSingleton &) = delete;
 
-        static std::mutex mtx; // Mutex for thread safety
-        static LoggerSingleton *instance;
-
-        std::list<Logger> loggers_{};
+        // Installs the chunk of the index if no other thread did so first
+        LoggerChunk &GetLoggerChunk(std::size_t chunk_index) {
+            LoggerChunk *chunk{logger_chunks_[chunk_index].load(std::memory_order_acquire)};
+            if (chunk == nullptr) {
+                auto *const created{new LoggerChunk};
+                if (logger_chunks_[chunk_index].compare_exchange_strong(chunk, created, std::memory_order_acq_rel,
+                                                                        std::memory_order_acquire)) {
+                    chunk = created;
+                } else {
+                    delete created;
+                }
+            }
+            return *chunk;
+        }
 
-        Logger::LogLevel log_level_;
+        std::atomic<std::size_t> logger_count_{0U};
+        std::array<std::atomic<LoggerChunk *>, kMaxLoggerChunks> logger_chunks_{};
+        LoggerChunk first_logger_chunk_{};
     public:
+        // Created on first use and never destroyed, so loggers can be used until the process ends
         static LoggerSingleton *getInstance() {
-            // Acquire lock before checking instance
-            std::lock_guard<std::mutex> lock(mtx); // automatically releases lock
-            if (instance == nullptr) {
-                instance = new LoggerSingleton(); // Create the instance only once
-            }
+            static LoggerSingleton *const instance{new LoggerSingleton()};
             return instance;
         }
 
+        // Safe to call from several threads, each call takes a free slot of the registry without locking
         Logger &CreateLogger(const char *ctx_id, const char *ctx_description) {
-            loggers_.push_back(std::move(Logger{ctx_id, ctx_description, log_level_}));
-            return loggers_.back();
+            const std::size_t index{logger_count_.fetch_add(1U, std::memory_order_relaxed)};
+            if (index >= (kLoggersPerChunk * kMaxLoggerChunks)) {
+                // Beyond the registry the loggers are kept until the process ends
+                return *new Logger{ctx_id, ctx_description};
+            }
+            LoggerChunk &chunk{GetLoggerChunk(index / kLoggersPerChunk)};
+            return *new(&chunk.storage[(index % kLoggersPerChunk) * sizeof(Logger)]) Logger{ctx_id, ctx_description};
         }
 
         void SetLogLevelOff() {
-            log_level_ = Logger::LogLevel::OFF;
+            Logger::log_level_.store(Logger::LogLevel::OFF, std::memory_order_relaxed);
         };
 
         void SetLogLevelFatal() {
-            log_level_ = Logger::LogLevel::FATAL;
+            Logger::log_level_.store(Logger::LogLevel::FATAL, std::memory_order_relaxed);
         };
 
         void SetLogLevelError() {
-            log_level_ = Logger::LogLevel::ERROR;
+            Logger::log_level_.store(Logger::LogLevel::ERROR, std::memory_order_relaxed);
         };
 
         void SetLogLevelWarn() {
-            log_level_ = Logger::LogLevel::WARN;
+            Logger::log_level_.store(Logger::LogLevel::WARN, std::memory_order_relaxed);
         };
 
         void SetLogLevelInfo() {
-            log_level_ = Logger::LogLevel::INFO;
+            Logger::log_level_.store(Logger::LogLevel::INFO, std::memory_order_relaxed);
         };
 
         void SetLogLevelDebug() {
-            log_level_ = Logger::LogLevel::DEBUG;
+            Logger::log_level_.store(Logger::LogLevel::DEBUG, std::memory_order_relaxed);
         };
 
         void SetLogLevelVerbose() {
-            log_level_ = Logger::LogLevel::VERBOSE;
+            Logger::log_level_.store(Logger::LogLevel::VERBOSE, std::memory_order_relaxed);
         };
 
+        // See internal::SetBinaryLogOutput for the format of the file
+        bool SetBinaryOutput(const char *file_path) {
+            return internal::SetBinaryLogOutput(file_path);
+        }
+
+        // Destroys the loggers of the registry, must not run concurrently with CreateLogger or the loggers
         void CleanLoggers() {
-            loggers_.clear();
+            const std::size_t count{std::min(logger_count_.exchange(0U, std::memory_order_acq_rel),
+                                             kLoggersPerChunk * kMaxLoggerChunks)};
+            for (std::size_t index{0U}; index < count; ++index) {
+                LoggerChunk &chunk{*logger_chunks_[index / kLoggersPerChunk].load(std::memory_order_acquire)};
+                std::launder(reinterpret_cast<Logger *>(&chunk.storage[(index % kLoggersPerChunk) * sizeof(Logger)]))
+                    ->~Logger();
+            }
         }
 
-        Logger &default_logger_;
+        // Not part of the registry, so it stays valid after CleanLoggers
+        Logger default_logger_{"DL", "DefaultLogger"};
     };
 
     Logger &CreateLogger(const char *ctx_id, const char *ctx_description);
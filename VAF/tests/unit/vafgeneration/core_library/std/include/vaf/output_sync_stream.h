@@ -16,20 +16,69 @@
 #ifndef INCLUDE_VAF_OUTPUT_SYNC_STREAM_H_
 #define INCLUDE_VAF_OUTPUT_SYNC_STREAM_H_
 
-#include <mutex>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstddef>
 #include <iostream>
-#include <sstream>
+#include <mutex>
+#include <ostream>
+#include <streambuf>
+#include <string>
 
 namespace vaf {
 
-class OutputSyncStream : public std::ostringstream {
+namespace internal {
+
+// Collects the text of the OutputSyncStreams of one thread, kept for the next ones so it is not allocated again
+class OutputLineBuffer final : public std::streambuf {
+ public:
+  std::string& Text() noexcept { return text_; }
+
+ protected:
+  int_type overflow(int_type c) override {
+    if (!traits_type::eq_int_type(c, traits_type::eof())) {
+      text_.push_back(traits_type::to_char_type(c));
+    }
+    return traits_type::not_eof(c);
+  }
+
+  std::streamsize xsputn(const char_type* s, std::streamsize count) override {
+    text_.append(s, static_cast<std::size_t>(count));
+    return count;
+  }
+
+ private:
+  std::string text_{};
+};
+
+inline OutputLineBuffer& ThreadOutputLineBuffer() {
+  static thread_local OutputLineBuffer buffer{};
+  return buffer;
+}
+
+}  // namespace internal
+
+/*!
+ * \brief Stream that writes its text at once when it is destroyed, e.g. vaf::OutputSyncStream{} << "Value: " << x << "\n";
+ * The text is collected in a buffer of the thread. For std::cout, std::cerr and std::clog it is written with one
+ * write(2) to the file descriptor, so the lines of several threads do not mix without a lock between them.
+ * Other streams are written under a mutex.
+ */
+class OutputSyncStream : public std::ostream {
 public:
-  explicit OutputSyncStream(std::ostream& ostream = std::cout) : ostream_{ostream} {}
+  explicit OutputSyncStream(std::ostream& ostream = std::cout)
+      : std::ostream{&internal::ThreadOutputLineBuffer()},
+        buffer_{internal::ThreadOutputLineBuffer()},
+        start_{buffer_.Text().size()},
+        ostream_{ostream} {}
   ~OutputSyncStream() override {
-    if(is_thread_safe_) {
-      std::unique_lock unique_lock(mutex_);
-      ostream_ << this->str();
+    // A stream created while this one was open has written and removed its text already
+    std::string& text{buffer_.Text()};
+    if (is_thread_safe_) {
+      Write(text.data() + start_, text.size() - start_);
     }
+    text.resize(start_);
   }
 
   OutputSyncStream(OutputSyncStream const&) = delete;
@@ -41,8 +90,37 @@ public:
   static auto DisableThreadSafety() -> void { is_thread_safe_ = false; }
 
 private:
+  void Write(const char* data, std::size_t size) {
+    int file_descriptor{-1};
+    if (&ostream_ == &std::cout) {
+      file_descriptor = STDOUT_FILENO;
+    } else if ((&ostream_ == &std::cerr) || (&ostream_ == &std::clog)) {
+      file_descriptor = STDERR_FILENO;
+    }
+    if (file_descriptor < 0) {
+      std::unique_lock unique_lock(mutex_);
+      ostream_.write(data, static_cast<std::streamsize>(size));
+      return;
+    }
+    // Text streamed to the stream itself was written before
+    ostream_.flush();
+    while (size > 0U) {
+      const ssize_t written{::write(file_descriptor, data, size)};
+      if (written < 0) {
+        if (errno == EINTR) {
+          continue;
+        }
+        break;
+      }
+      data += written;
+      size -= static_cast<std::size_t>(written);
+    }
+  }
+
   static inline bool is_thread_safe_{true};
   static inline std::mutex mutex_{};
+  internal::OutputLineBuffer& buffer_;
+  std::size_t start_;
   std::ostream& ostream_;
 };
 
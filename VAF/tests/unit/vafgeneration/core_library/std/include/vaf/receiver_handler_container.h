@@ -17,6 +17,7 @@
 #define INCLUDE_VAF_RECEIVER_HANDLER_CONTAINER_H_
 
 #include "vaf/container_types.h"
+#include "vaf/module_id.h"
 
 namespace vaf {
 template <typename T>
@@ -24,12 +25,13 @@ template <typename T>
 class ReceiverHandlerContainer {
  public:
   ReceiverHandlerContainer(vaf::String owner, T&& handler)
-    : owner_{std::move(owner)}, handler_{std::move(handler)}, is_active_{false} {
+    : owner_{std::move(owner)}, owner_id_{vaf::GetModuleId(owner_)}, handler_{std::move(handler)} {
   }
 
   vaf::String owner_;
+  // The handler is active while the owner is in the active module set of the providing module
+  vaf::ModuleId owner_id_;
   T handler_;
-  bool is_active_;
 };
 
 } // namespace vaf
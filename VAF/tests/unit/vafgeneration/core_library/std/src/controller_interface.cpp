@@ -21,6 +21,7 @@ namespace vaf {
 
 ControlInterface::ControlInterface(vaf::String name, vaf::Vector<vaf::String> dependencies, ExecutableControllerInterface& executable_controller_interface, vaf::Executor& executor)
   : name_{std::move(name)},
+    id_{vaf::GetModuleId(name_)},
     dependencies_{std::move(dependencies)},
     executable_controller_interface_{executable_controller_interface},
     executor_{vaf::ModuleExecutor{executor, name_, dependencies_}} {
@@ -47,6 +48,10 @@ vaf::String ControlInterface::GetName() {
   return name_;
 }
 
+vaf::ModuleId ControlInterface::GetId() const noexcept {
+  return id_;
+}
+
 vaf::Vector<vaf::String> ControlInterface::GetDependencies() {
   return dependencies_;
 }
@@ -59,12 +64,16 @@ void ControlInterface::StopExecutor() {
   executor_.Stop();
 }
 
-void ControlInterface::StartEventHandlerForModule(const vaf::String& module_name) {
-  static_cast<void>(module_name);
+void ControlInterface::StartEventHandlerForModule(vaf::ModuleId module) {
+  static_cast<void>(module);
 };
 
-void ControlInterface::StopEventHandlerForModule(const vaf::String& module_name) {
-  static_cast<void>(module_name);
+void ControlInterface::StopEventHandlerForModule(vaf::ModuleId module) {
+  static_cast<void>(module);
 };
 
+vaf::Vector<vaf::MemoryUsage> ControlInterface::GetMemoryUsage() const {
+  return vaf::Vector<vaf::MemoryUsage>{};
+}
+
 } // namespace vaf
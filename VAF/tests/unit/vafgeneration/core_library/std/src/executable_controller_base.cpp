@@ -15,13 +15,19 @@
 
 #include "vaf/executable_controller_base.h"
 #include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <csignal>
+#include <functional>
 #include "vaf/output_sync_stream.h"
 #include <memory>
+#include <string_view>
 #include <thread>
 #include <utility>
+#include "vaf/boot_profile.h"
 #include "vaf/controller_interface.h"
 #include "vaf/module_states.h"
+#include "vaf/trace.h"
 #include "vaf/user_controller_interface.h"
 
 namespace vaf {
@@ -36,7 +42,10 @@ ExecutableControllerBase::ExecutableControllerBase()
       logger_{vaf::CreateLogger("ECB", "ExecutableControllerBase")},
       modules_{},
       user_controller_{CreateUserController()},
-      signal_handler_thread_{} {}
+      signal_handler_thread_{} {
+  // The times of the boot profile count from here
+  static_cast<void>(BootProfile::GetInstance());
+}
 
 void ExecutableControllerBase::Run(bool use_exec_mgr) noexcept { Run(0, nullptr, use_exec_mgr); }
 
@@ -45,28 +54,164 @@ void ExecutableControllerBase::Run(int /*argc*/, char** /*argv*/, bool use_exec_
 
   InitializeSignalHandling();
 
+  BootProfile& boot_profile{BootProfile::GetInstance()};
   user_controller_->PreInitialize();
+  BootProfile::Clock::time_point phase_start{BootProfile::Clock::now()};
   DoInitialize();
+  boot_profile.Record("DoInitialize", phase_start);
   user_controller_->PostInitialize();
   user_controller_->PreStart();
+  phase_start = BootProfile::Clock::now();
   DoStart();
+  boot_profile.Record("DoStart", phase_start);
   user_controller_->PostStart();
 
+  // Each change of a module state wakes this loop, so dependent modules start as soon as their dependencies report
   while (!IsShutdownRequested()) {
-    std::this_thread::sleep_for(std::chrono::milliseconds{100}); // TODO magic number
     StartModules();
     CheckStartingModules();
+    if (std::all_of(modules_.begin(), modules_.end(),
+                    [](const ModuleContainer& module) { return module.state_ == ModuleStates::kOperational; })) {
+      boot_profile.Report();
+    }
+    WaitForControllerEvent();
   }
 
+  // Also reports the boots that never finished, e.g. a module that does not become operational
+  boot_profile.Report();
   user_controller_->PreShutdown();
   DoShutdown();
   user_controller_->PostShutdown();
 }
 
-void ExecutableControllerBase::InitiateShutdown() noexcept { shutdown_requested_ = true; }
+void ExecutableControllerBase::InitiateShutdown() noexcept {
+  shutdown_requested_ = true;
+  NotifyController();
+}
+
+void ExecutableControllerBase::NotifyController() {
+  {
+    std::lock_guard<std::mutex> lock{controller_mutex_};
+    controller_event_ = true;
+  }
+  controller_condition_.notify_one();
+}
+
+void ExecutableControllerBase::WaitForControllerEvent() {
+  // Without a starting module, only a state change or the shutdown can give the loop something to do
+  const std::chrono::steady_clock::time_point now{std::chrono::steady_clock::now()};
+  std::chrono::steady_clock::time_point deadline{std::chrono::steady_clock::time_point::max()};
+  for (const ModuleContainer& module : modules_) {
+    if (module.state_ == ModuleStates::kStarting) {
+      deadline = std::min(deadline, module.startup_deadline_);
+    } else if ((module.state_ == ModuleStates::kNotOperational) && (module.restart_time_ > now)) {
+      // Never restarted modules wait until time_point::max(), like without a deadline
+      deadline = std::min(deadline, module.restart_time_);
+    }
+  }
+
+  std::unique_lock<std::mutex> lock{controller_mutex_};
+  const auto has_event = [this]() { return controller_event_ || shutdown_requested_; };
+  if (deadline == std::chrono::steady_clock::time_point::max()) {
+    controller_condition_.wait(lock, has_event);
+  } else {
+    controller_condition_.wait_until(lock, deadline, has_event);
+  }
+  controller_event_ = false;
+}
+
+void ExecutableControllerBase::RegisterModule(std::shared_ptr<vaf::ControlInterface> module,
+                                              std::chrono::nanoseconds startup_time_limit) {
+  const vaf::ModuleId id{module->GetId()};
+  if (module_indices_.size() <= id) {
+    module_indices_.resize(id + 1, kUnknownModule);
+  }
+  module_indices_[id] = modules_.size();
+  modules_.emplace_back(module->GetName(), std::move(module), module->GetDependencies(), startup_time_limit);
+}
 
-void ExecutableControllerBase::RegisterModule(std::shared_ptr<vaf::ControlInterface> module) {
-  modules_.emplace_back(module->GetName(), std::move(module), module->GetDependencies());
+void ExecutableControllerBase::SetRestartPolicy(const vaf::String& name, RestartPolicy policy,
+                                                std::chrono::nanoseconds delay) {
+  const std::size_t module_index{FindModule(name)};
+  if (module_index == kUnknownModule) {
+    vaf::OutputSyncStream{std::cerr} << "ExecutableControllerBase::SetRestartPolicy: Unknown module: " << name << std::endl;
+    std::abort();
+  }
+  modules_[module_index].restart_policy_ = policy;
+  modules_[module_index].restart_delay_ = delay;
+}
+
+void ExecutableControllerBase::SetModuleTable(vaf::ModuleTableView table) noexcept { module_table_ = table; }
+
+vaf::Vector<vaf::MemoryUsage> ExecutableControllerBase::GetMemoryUsage() const {
+  vaf::Vector<vaf::MemoryUsage> usage{};
+  for (const ModuleContainer& module : modules_) {
+    vaf::Vector<vaf::MemoryUsage> module_usage{module.module_->GetMemoryUsage()};
+    usage.insert(usage.end(), module_usage.begin(), module_usage.end());
+  }
+  return usage;
+}
+
+void ExecutableControllerBase::ScheduleRestart(ModuleContainer& module) {
+  const std::chrono::steady_clock::time_point now{std::chrono::steady_clock::now()};
+  switch (module.restart_policy_) {
+    case RestartPolicy::kImmediate:
+      module.restart_time_ = now + kMinRestartInterval;
+      break;
+    case RestartPolicy::kBackoff:
+      module.restart_time_ =
+          now + std::max<std::chrono::nanoseconds>(
+                    module.restart_delay_ * (1U << std::min(module.restart_count_, kMaxRestartDoublings)),
+                    kMinRestartInterval);
+      break;
+    case RestartPolicy::kNever:
+      module.restart_time_ = std::chrono::steady_clock::time_point::max();
+      break;
+  }
+  ++module.restart_count_;
+}
+
+std::size_t ExecutableControllerBase::FindModule(const vaf::String& name) const {
+  const vaf::ModuleId id{vaf::GetModuleId(name)};
+  return (id < module_indices_.size()) ? module_indices_[id] : kUnknownModule;
+}
+
+void ExecutableControllerBase::ResolveDependencies() {
+  for (ModuleContainer& module : modules_) {
+    module.dependency_indices_.clear();
+    module.dependent_indices_.clear();
+    module.has_unknown_dependency_ = false;
+  }
+  const bool has_module_table{
+      (module_table_.count == modules_.size()) &&
+      std::equal(modules_.begin(), modules_.end(), module_table_.names,
+                 [](const ModuleContainer& module, std::string_view name) { return module.name_ == name; })};
+  if (has_module_table) {
+    // The dependencies of the table generated for the executable, without looking up their names
+    for (std::size_t index = 0; index < modules_.size(); ++index) {
+      modules_[index].has_unknown_dependency_ = module_table_.has_unknown_dependency[index];
+      for (std::size_t dependency_index = 0; dependency_index < modules_.size(); ++dependency_index) {
+        if (module_table_.DependsOn(index, dependency_index)) {
+          modules_[index].dependency_indices_.push_back(dependency_index);
+          modules_[dependency_index].dependent_indices_.push_back(index);
+        }
+      }
+    }
+    return;
+  }
+  for (std::size_t index = 0; index < modules_.size(); ++index) {
+    ModuleContainer& module{modules_[index]};
+    for (const vaf::String& dependency : module.dependencies_) {
+      const std::size_t dependency_index{FindModule(dependency)};
+      if (dependency_index == kUnknownModule) {
+        // Such a module can never be started
+        module.has_unknown_dependency_ = true;
+      } else {
+        module.dependency_indices_.push_back(dependency_index);
+        modules_[dependency_index].dependent_indices_.push_back(index);
+      }
+    }
+  }
 }
 
 void ExecutableControllerBase::ReportOperationalOfModule(vaf::String name) {
@@ -78,33 +223,43 @@ void ExecutableControllerBase::SkipStartingOfModule(vaf::String name) {
 }
 
 void ExecutableControllerBase::ReportErrorOfModule(const vaf::Error& error, vaf::String name, bool critical) {
-  user_controller_->OnError(error, name, critical);
+  {
+    // Modules that are initialized or started concurrently may report at the same time
+    std::lock_guard<std::mutex> lock{user_controller_mutex_};
+    user_controller_->OnError(error, name, critical);
+  }
   if (critical) {
     ChangeStateOfModule(name, ModuleStates::kNotOperational);
   }
 
-  for (ModuleContainer& module: modules_) {
-    if (std::find(module.dependencies_.begin(), module.dependencies_.end(), name) != module.dependencies_.end()) {
-      module.module_->OnError(error);
+  const std::size_t module_index{FindModule(name)};
+  if (module_index != kUnknownModule) {
+    for (std::size_t dependent_index : modules_[module_index].dependent_indices_) {
+      modules_[dependent_index].module_->OnError(error);
     }
   }
 }
 
 void ExecutableControllerBase::ChangeStateOfModule(vaf::String name, ModuleStates state) {
-  vaf::OutputSyncStream{} << "ExecutableControllerBase::ChangeStateOfModule: name " << name
-            << " state: " << ModuleStateToString(state) << std::endl;
+  const std::size_t module_index{FindModule(name)};
 
-  auto module_pos = std::find_if(modules_.begin(), modules_.end(), [&name](ModuleContainer& m) {
-    return m.name_ == name;
-  });
-
-  if (module_pos == modules_.end()) {
+  if (module_index == kUnknownModule) {
     vaf::OutputSyncStream{std::cerr} << "ExecutableControllerBase::ChangeStateOfModule: Unknown module: " << name << std::endl;
     std::abort();
   }
 
-  ModuleStates current_state{module_pos->state_};
-  module_pos->state_ = state;
+  ChangeStateOfModule(module_index, state);
+}
+
+void ExecutableControllerBase::ChangeStateOfModule(std::size_t module_index, ModuleStates state) {
+  ModuleContainer& module{modules_[module_index]};
+  const vaf::String& name{module.name_};
+  vaf::OutputSyncStream{} << "ExecutableControllerBase::ChangeStateOfModule: name " << name
+            << " state: " << ModuleStateToString(state) << std::endl;
+
+  ModuleStates current_state{module.state_};
+  module.state_ = state;
+  VAF_TRACE_INSTANT("vaf.state", ModuleStateToString(state).c_str(), name.c_str());
 
   switch (state) {
     case ModuleStates::kNotInitialized:
@@ -114,80 +269,108 @@ void ExecutableControllerBase::ChangeStateOfModule(vaf::String name, ModuleState
       break;
     case ModuleStates::kNotOperational:
       if (current_state == ModuleStates::kNotInitialized) {
-        module_pos->module_->Init();
+        const BootProfile::Clock::time_point init_start{BootProfile::Clock::now()};
+        module.module_->Init();
+        BootProfile::GetInstance().Record(name + " Init", init_start);
       } else {
-        StopEventHandlersForModule(module_pos->name_, module_pos->dependencies_);
-        module_pos->module_->StopExecutor();
-        module_pos->module_->Stop();
+        StopEventHandlersForModule(module_index);
+        module.module_->StopExecutor();
+        module.module_->Stop();
+        ScheduleRestart(module);
       }
       break;
     case ModuleStates::kStarting:
-      module_pos->starting_counter_ = 0;
-      module_pos->module_->Start();
-      module_pos->module_->StartExecutor();
+      module.startup_deadline_ = std::chrono::steady_clock::now() + module.startup_time_limit_;
+      module.module_->Start();
+      // A critical error or skip reported within Start() stopped the module and its executor already
+      if (module.state_ != ModuleStates::kNotOperational) {
+        module.module_->StartExecutor();
+      }
+      BootProfile::GetInstance().Record(name + " Start", module.startup_deadline_ - module.startup_time_limit_);
       break;
     case ModuleStates::kOperational:
-      StartEventHandlersForModule(module_pos->name_, module_pos->dependencies_);
+      // From Start() until the module reported operational, on the track of the module
+      BootProfile::GetInstance().Record(name + " starting", module.startup_deadline_ - module.startup_time_limit_,
+                                        std::chrono::steady_clock::now(),
+                                        BootProfile::kModuleTracks + static_cast<BootProfile::Track>(module_index));
+      module.restart_count_ = 0;
+      StartEventHandlersForModule(module_index);
       break;
     case ModuleStates::kShutdown:
-      module_pos->module_->DeInit();
+      module.module_->DeInit();
       break;
   }
+
+  NotifyController();
 }
 
 void ExecutableControllerBase::StartModules() {
-  auto canStart = [this](ModuleContainer& module) {
-    return std::all_of(module.dependencies_.begin(), module.dependencies_.end(), [this](const vaf::String& dependency) {
-      for (size_t i = 0; i < modules_.size(); ++i) {
-        if (modules_[i].name_ == dependency) {
-          if (modules_[i].state_ == ModuleStates::kOperational) {
-            return true;
-          }
-          break;
-        }
-      }
-      return false;
-    });
+  const std::chrono::steady_clock::time_point now{std::chrono::steady_clock::now()};
+  auto canStart = [this, now](ModuleContainer& module) {
+    return !module.has_unknown_dependency_ && (module.restart_time_ <= now) &&
+           std::all_of(module.dependency_indices_.begin(), module.dependency_indices_.end(),
+                       [this](std::size_t dependency_index) {
+                         return modules_[dependency_index].state_ == ModuleStates::kOperational;
+                       });
   };
 
-  for (ModuleContainer& module: modules_) {
-    if (module.state_ == ModuleStates::kNotOperational) {
-      if (canStart(module)) {
-        ChangeStateOfModule(module.name_, ModuleStates::kStarting);
+  vaf::Vector<std::size_t> startable{};
+  for (std::size_t index = 0; index < modules_.size(); ++index) {
+    if (modules_[index].state_ == ModuleStates::kNotOperational) {
+      if (canStart(modules_[index])) {
+        startable.push_back(index);
       }
     }
   }
+  // They only depend on operational modules, so none of them waits for another one
+  ForEachConcurrently(startable, [this](std::size_t index) { ChangeStateOfModule(index, ModuleStates::kStarting); });
 }
 
-void ExecutableControllerBase::StartEventHandlersForModule(const vaf::String& module_name,
-                                                           const vaf::Vector<vaf::String>& dependencies) {
-  for (const vaf::String& dependency: dependencies) {
-    auto dependency_pos{std::find_if(modules_.begin(), modules_.end(), [&dependency](ModuleContainer& module) {
-      return module.name_ == dependency;
-    })};
-
-    dependency_pos->module_->StartEventHandlerForModule(module_name);
+void ExecutableControllerBase::ForEachConcurrently(const vaf::Vector<std::size_t>& indices,
+                                                   const std::function<void(std::size_t)>& function) {
+  std::atomic<std::size_t> next{0};
+  const auto work = [&indices, &function, &next]() {
+    for (std::size_t i{next.fetch_add(1)}; i < indices.size(); i = next.fetch_add(1)) {
+      function(indices[i]);
+    }
+  };
+  // Init and Start mostly wait for files or devices, so the threads are not limited to the hardware threads
+  const std::size_t thread_count{std::min(indices.size(), kMaxConcurrentModules)};
+  vaf::Vector<std::thread> helpers{};
+  for (std::size_t i = 1; i < thread_count; ++i) {
+    helpers.emplace_back(work);
+  }
+  work();
+  for (std::thread& helper : helpers) {
+    helper.join();
   }
 }
 
-void ExecutableControllerBase::StopEventHandlersForModule(const vaf::String& module_name,
-                                                          const vaf::Vector<vaf::String>& dependencies) {
-  for (const vaf::String& dependency: dependencies) {
-    auto dependency_pos{std::find_if(modules_.begin(), modules_.end(), [&dependency](ModuleContainer& module) {
-      return module.name_ == dependency;
-    })};
+void ExecutableControllerBase::StartEventHandlersForModule(std::size_t module_index) {
+  // Dependents of the same module can become operational concurrently
+  std::lock_guard<std::mutex> lock{event_handler_mutex_};
+  const ModuleContainer& module{modules_[module_index]};
+  for (std::size_t dependency_index : module.dependency_indices_) {
+    modules_[dependency_index].module_->StartEventHandlerForModule(module.id_);
+  }
+}
 
-    dependency_pos->module_->StopEventHandlerForModule(module_name);
+void ExecutableControllerBase::StopEventHandlersForModule(std::size_t module_index) {
+  std::lock_guard<std::mutex> lock{event_handler_mutex_};
+  const ModuleContainer& module{modules_[module_index]};
+  for (std::size_t dependency_index : module.dependency_indices_) {
+    modules_[dependency_index].module_->StopEventHandlerForModule(module.id_);
   }
 }
 
 void ExecutableControllerBase::CheckStartingModules() {
-  for (ModuleContainer& module: modules_) {
+  const std::chrono::steady_clock::time_point now{std::chrono::steady_clock::now()};
+  for (std::size_t index = 0; index < modules_.size(); ++index) {
+    ModuleContainer& module{modules_[index]};
     if (module.state_ == ModuleStates::kStarting) {
-      module.starting_counter_ += 1;
-      if (module.starting_counter_ > 3000) {  // TODO: magic number must be replaced with user configuration
+      if (now >= module.startup_deadline_) {
         vaf::OutputSyncStream{} << "Module " << module.name_ << " violated its startup time limit\n";
-        ChangeStateOfModule(module.name_, ModuleStates::kNotOperational);
+        ChangeStateOfModule(index, ModuleStates::kNotOperational);
       }
     }
   }
@@ -196,26 +379,53 @@ void ExecutableControllerBase::CheckStartingModules() {
 void ExecutableControllerBase::DoInitialize() {
   SetupExecutionManager();
   signal_handler_thread_ = std::thread{&ExecutableControllerBase::SignalHandlerThread, this};
-
-  for (ModuleContainer& module: modules_) {
-    ChangeStateOfModule(module.name_, ModuleStates::kNotOperational);
+  ResolveDependencies();
+
+  // Each round initializes the modules whose dependencies are initialized, concurrently as they are independent
+  vaf::Vector<bool> initialized(modules_.size(), false);
+  std::size_t remaining{modules_.size()};
+  while (remaining > 0) {
+    vaf::Vector<std::size_t> round{};
+    for (std::size_t index = 0; index < modules_.size(); ++index) {
+      const vaf::Vector<std::size_t>& dependencies{modules_[index].dependency_indices_};
+      if (!initialized[index] && std::all_of(dependencies.begin(), dependencies.end(),
+                                             [&initialized](std::size_t dependency) { return initialized[dependency]; })) {
+        round.push_back(index);
+      }
+    }
+    if (round.empty()) {
+      // Modules on a dependency cycle, initialized one after the other in the order of registration
+      for (std::size_t index = 0; index < modules_.size(); ++index) {
+        if (!initialized[index]) {
+          round.push_back(index);
+          break;
+        }
+      }
+    }
+    ForEachConcurrently(round, [this](std::size_t index) { ChangeStateOfModule(index, ModuleStates::kNotOperational); });
+    for (std::size_t index : round) {
+      initialized[index] = true;
+    }
+    remaining -= round.size();
   }
 }
 
 void ExecutableControllerBase::DoStart() {
-  for (ModuleContainer& module: modules_) {
-    if (module.dependencies_.empty()) {
-      ChangeStateOfModule(module.name_, ModuleStates::kStarting);
+  vaf::Vector<std::size_t> independent{};
+  for (std::size_t index = 0; index < modules_.size(); ++index) {
+    if (modules_[index].dependency_indices_.empty() && !modules_[index].has_unknown_dependency_) {
+      independent.push_back(index);
     }
   }
+  ForEachConcurrently(independent, [this](std::size_t index) { ChangeStateOfModule(index, ModuleStates::kStarting); });
 }
 
 void ExecutableControllerBase::DoShutdown() {
-  for (auto iterator = modules_.rbegin(); iterator != modules_.rend(); ++iterator) {
-    ChangeStateOfModule(iterator->name_, ModuleStates::kNotOperational);
+  for (std::size_t index = modules_.size(); index > 0; --index) {
+    ChangeStateOfModule(index - 1, ModuleStates::kNotOperational);
   }
-  for (auto iterator = modules_.rbegin(); iterator != modules_.rend(); ++iterator) {
-    ChangeStateOfModule(iterator->name_, ModuleStates::kShutdown);
+  for (std::size_t index = modules_.size(); index > 0; --index) {
+    ChangeStateOfModule(index - 1, ModuleStates::kShutdown);
   }
   ReportStateToExecutionManager(false);
   signal_handler_thread_.join();
@@ -278,6 +488,7 @@ void ExecutableControllerBase::SignalHandlerThread() {
       if (!shutdown_requested_) {
         // Request application exit. (SignalHandler initiate the shutdown!)
         shutdown_requested_ = true;
+        NotifyController();
       }
     }
   } while (!shutdown_requested_);
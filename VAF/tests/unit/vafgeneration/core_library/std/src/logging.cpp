@@ -15,14 +15,300 @@
 
 #include "vaf/logging.h"
 
-namespace vaf {
+#include <chrono>
+#include <condition_variable>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
 
-// Initialize static members outside the class definition
-    std::mutex LoggerSingleton::mtx;
-    LoggerSingleton *LoggerSingleton::instance = nullptr;
+namespace vaf {
 
     Logger &CreateLogger(const char *ctx_id, const char *ctx_description) {
         return LoggerSingleton::getInstance()->CreateLogger(ctx_id, ctx_description);
     }
 
+    namespace internal {
+        namespace {
+            // How long the log writer waits between two rounds over the ring buffers, unless one is half full
+            constexpr std::chrono::milliseconds kLogWriteInterval{10};
+
+            // Entries of the binary log output in addition to the ones of LogRecordKind
+            enum class BinaryLogEntryKind : std::uint8_t {
+                kTextDefinition = 5U,  //!< uint32 id followed by the text, which is also logged
+                kTextReference = 6U,   //!< uint32 id of a text defined before
+                kDropped = 7U,         //!< uint64 number of records of the thread dropped since its last entry
+            };
+
+            constexpr std::array<char, 8U> kBinaryLogMagic{'V', 'A', 'F', 'L', 'O', 'G', '1', '\0'};
+            // Texts beyond this number are written in full each time, so changing texts do not fill the memory
+            constexpr std::size_t kMaxBinaryLogTexts{4096U};
+
+            template<typename T>
+            T ReadValue(const LogRecord &record) noexcept {
+                T value{};
+                std::memcpy(&value, record.text.data(), sizeof(T));
+                return value;
+            }
+
+            /*!
+             * \brief Writes the log records of all threads to std::cout or a binary file on its own thread.
+             * Each round takes the records of one ring buffer after the other, so the lines of a thread keep their order.
+             * The line of each thread is assembled in its ring buffer and only written once the thread starts the next
+             * one, or once it logged nothing for a round, so the lines of different threads are never mixed.
+             */
+            class LogWriter {
+            public:
+                // Never destroyed, so threads can log during the static destruction, the rest is written at exit
+                static LogWriter &Instance() {
+                    static LogWriter *writer{new LogWriter{}};
+                    return *writer;
+                }
+
+                void Register(std::shared_ptr<LogRing> ring) {
+                    std::lock_guard<std::mutex> lock{rings_mutex_};
+                    ring->id_ = next_ring_id_++;
+                    rings_.push_back(std::move(ring));
+                }
+
+                void Wake() noexcept { wake_condition_.notify_one(); }
+
+                void Flush() noexcept {
+                    std::lock_guard<std::mutex> lock{write_mutex_};
+                    FlushLocked();
+                }
+
+                bool SetBinaryOutput(const char *file_path) noexcept {
+                    std::lock_guard<std::mutex> lock{write_mutex_};
+                    FlushLocked();
+                    std::FILE *file{std::fopen(file_path, "wb")};
+                    if (file == nullptr) {
+                        return false;
+                    }
+                    if (binary_file_ != nullptr) {
+                        std::fclose(binary_file_);
+                    }
+                    binary_file_ = file;
+                    binary_texts_.clear();
+                    std::fwrite(kBinaryLogMagic.data(), 1U, kBinaryLogMagic.size(), binary_file_);
+                    return true;
+                }
+
+            private:
+                LogWriter() {
+                    std::atexit([]() { Instance().Flush(); });
+                    std::thread{[this]() { Run(); }}.detach();
+                }
+
+                void Run() {
+                    std::unique_lock<std::mutex> lock{write_mutex_};
+                    while (true) {
+                        wake_condition_.wait_for(lock, kLogWriteInterval);
+                        WriteRecords();
+                        WriteOutput();
+                    }
+                }
+
+                // write_mutex_ must be held
+                void FlushLocked() noexcept {
+                    WriteRecords();
+                    {
+                        std::lock_guard<std::mutex> lock{rings_mutex_};
+                        for (const std::shared_ptr<LogRing> &ring: rings_) {
+                            EndOpenLine(*ring);
+                        }
+                    }
+                    WriteOutput();
+                    if (binary_file_ != nullptr) {
+                        std::fflush(binary_file_);
+                    }
+                    std::cout.flush();
+                }
+
+                // Formats the records into output_ or writes them to the binary file, write_mutex_ must be held
+                void WriteRecords() {
+                    std::vector<std::shared_ptr<LogRing>> rings{};
+                    {
+                        std::lock_guard<std::mutex> lock{rings_mutex_};
+                        rings = rings_;
+                    }
+                    for (const std::shared_ptr<LogRing> &ring: rings) {
+                        bool has_records{false};
+                        ring->Pop([this, &ring, &has_records](const LogRecord &record) {
+                            has_records = true;
+                            if (binary_file_ != nullptr) {
+                                WriteBinary(ring->id_, record);
+                            } else {
+                                WriteText(*ring, record);
+                            }
+                        });
+                        const std::uint64_t dropped{ring->TakeDropped()};
+                        if ((dropped > 0U) && (binary_file_ != nullptr)) {
+                            WriteBinaryEntry(ring->id_, static_cast<std::uint8_t>(BinaryLogEntryKind::kDropped), 0U,
+                                             &dropped, sizeof(dropped));
+                        } else if (dropped > 0U) {
+                            output_.append("[vaf: " + std::to_string(dropped) + " log records dropped]\n");
+                        }
+                        // A thread that logged nothing for a round finished its line, unless the line is streamed
+                        // slower than the rounds
+                        if (!has_records && !ring->IsLineCut() && ring->Empty()) {
+                            EndOpenLine(*ring);
+                        }
+                    }
+                    std::lock_guard<std::mutex> lock{rings_mutex_};
+                    for (auto ring = rings_.begin(); ring != rings_.end();) {
+                        if ((*ring)->orphaned_.load(std::memory_order_acquire) && (*ring)->Empty()) {
+                            EndOpenLine(**ring);
+                            ring = rings_.erase(ring);
+                        } else {
+                            ++ring;
+                        }
+                    }
+                }
+
+                void WriteText(LogRing &ring, const LogRecord &record) {
+                    std::string &line{ring.open_line_};
+                    if (record.starts_line && record.drops_open_line) {
+                        line.clear();
+                    } else if (record.starts_line) {
+                        WriteLine(ring);
+                    }
+                    switch (record.kind) {
+                        case LogRecordKind::kInt64:
+                            line.append(std::to_string(ReadValue<std::int64_t>(record)));
+                            break;
+                        case LogRecordKind::kUInt64:
+                            line.append(std::to_string(ReadValue<std::uint64_t>(record)));
+                            break;
+                        case LogRecordKind::kDouble: {
+                            // Formatted like std::ostream does by default
+                            std::array<char, 32U> digits{};
+                            const int size{std::snprintf(digits.data(), digits.size(), "%g", ReadValue<double>(record))};
+                            line.append(digits.data(), static_cast<std::size_t>(std::max(size, 0)));
+                            break;
+                        }
+                        case LogRecordKind::kBool:
+                            line.append(ReadValue<bool>(record) ? "true" : "false");
+                            break;
+                        case LogRecordKind::kText:
+                        default:
+                            line.append(record.text.data(), record.size);
+                            break;
+                    }
+                }
+
+                void WriteLine(LogRing &ring) {
+                    if (!ring.open_line_.empty()) {
+                        output_.append(ring.open_line_);
+                        output_.push_back('\n');
+                        ring.open_line_.clear();
+                    }
+                }
+
+                // Ends the line of a thread without a next line start, a line cut by a full ring buffer is not written
+                void EndOpenLine(LogRing &ring) {
+                    if (!ring.IsLineCut()) {
+                        WriteLine(ring);
+                    } else if (ring.orphaned_.load(std::memory_order_acquire) && ring.Empty()) {
+                        ring.open_line_.clear();
+                    }
+                    // Otherwise the next line start of the thread drops it
+                }
+
+                void WriteBinary(std::uint32_t ring_id, const LogRecord &record) {
+                    if (record.kind != LogRecordKind::kText) {
+                        WriteBinaryEntry(ring_id, static_cast<std::uint8_t>(record.kind), StartsLineFlag(record),
+                                         record.text.data(), record.size);
+                        return;
+                    }
+                    const std::string text{record.text.data(), record.size};
+                    const auto known = binary_texts_.find(text);
+                    if (known != binary_texts_.end()) {
+                        WriteBinaryEntry(ring_id, static_cast<std::uint8_t>(BinaryLogEntryKind::kTextReference),
+                                         StartsLineFlag(record), &known->second, sizeof(known->second));
+                    } else if (binary_texts_.size() < kMaxBinaryLogTexts) {
+                        const std::uint32_t id{static_cast<std::uint32_t>(binary_texts_.size())};
+                        binary_texts_.emplace(text, id);
+                        std::array<char, sizeof(id) + LogRecord::kTextSize> payload{};
+                        std::memcpy(payload.data(), &id, sizeof(id));
+                        std::memcpy(payload.data() + sizeof(id), text.data(), text.size());
+                        WriteBinaryEntry(ring_id, static_cast<std::uint8_t>(BinaryLogEntryKind::kTextDefinition),
+                                         StartsLineFlag(record), payload.data(), sizeof(id) + text.size());
+                    } else {
+                        WriteBinaryEntry(ring_id, static_cast<std::uint8_t>(LogRecordKind::kText),
+                                         StartsLineFlag(record), text.data(), text.size());
+                    }
+                }
+
+                // 2 if the line before is to be dropped by the decoder, as it was cut by a full ring buffer
+                static std::uint8_t StartsLineFlag(const LogRecord &record) noexcept {
+                    if (!record.starts_line) {
+                        return 0U;
+                    }
+                    return record.drops_open_line ? 2U : 1U;
+                }
+
+                // The header is written in the byte order of the host, the supported targets are little-endian
+                void WriteBinaryEntry(std::uint32_t ring_id, std::uint8_t kind, std::uint8_t starts_line,
+                                      const void *payload, std::size_t size) {
+                    std::array<char, 8U> header{};
+                    const std::uint16_t payload_size{static_cast<std::uint16_t>(size)};
+                    std::memcpy(header.data(), &ring_id, sizeof(ring_id));
+                    header[4U] = static_cast<char>(kind);
+                    header[5U] = static_cast<char>(starts_line);
+                    std::memcpy(header.data() + 6U, &payload_size, sizeof(payload_size));
+                    std::fwrite(header.data(), 1U, header.size(), binary_file_);
+                    std::fwrite(payload, 1U, size, binary_file_);
+                }
+
+                // Writes the formatted output with the lock of the synchronous output, so lines are not mixed
+                void WriteOutput() {
+                    if (!output_.empty()) {
+                        vaf::OutputSyncStream{} << output_;
+                        output_.clear();
+                    }
+                }
+
+                std::mutex rings_mutex_{};
+                std::vector<std::shared_ptr<LogRing>> rings_{};
+                std::uint32_t next_ring_id_{0U};
+                std::mutex write_mutex_{};
+                std::condition_variable wake_condition_{};
+                std::string output_{};
+                std::FILE *binary_file_{nullptr};
+                std::unordered_map<std::string, std::uint32_t> binary_texts_{};
+            };
+
+            // Marks the ring buffer of a thread as orphaned when the thread ends
+            struct ThreadLogRingOwner {
+                ~ThreadLogRingOwner() {
+                    if (ring != nullptr) {
+                        ring->orphaned_.store(true, std::memory_order_release);
+                    }
+                }
+
+                std::shared_ptr<LogRing> ring{};
+            };
+        } // namespace
+
+        LogRing &ThreadLogRing() {
+            thread_local ThreadLogRingOwner owner{};
+            if (owner.ring == nullptr) {
+                owner.ring = std::make_shared<LogRing>();
+                LogWriter::Instance().Register(owner.ring);
+            }
+            return *owner.ring;
+        }
+
+        void WakeLogWriter() noexcept { LogWriter::Instance().Wake(); }
+
+        void FlushLog() noexcept { LogWriter::Instance().Flush(); }
+
+        bool SetBinaryLogOutput(const char *file_path) noexcept { return LogWriter::Instance().SetBinaryOutput(file_path); }
+    } // namespace internal
+
 } // namespace vaf
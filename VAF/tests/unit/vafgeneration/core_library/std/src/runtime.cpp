@@ -15,11 +15,13 @@
 
 #include "vaf/runtime.h"
 #include "vaf/logging.h"
+#include "vaf/trace.h"
 
 namespace vaf {
 
     Runtime::Runtime() {
         vaf::LoggerSingleton::getInstance()->SetLogLevelVerbose();
+        vaf::InitializeTracing();
     }
 
     Runtime::~Runtime() {
@@ -17,7 +17,9 @@
 #define TEST_MY_INTERFACE_CONSUMER_H
 
 #include "vaf/container_types.h"
+#include <cstdint>
 #include <functional>
+#include <utility>
 
 #include "vaf/future.h"
 #include "vaf/result.h"
@@ -35,6 +37,16 @@ public:
   virtual ::vaf::Result<::vaf::ConstDataPtr<const std::uint64_t>> GetAllocated_my_data_element() = 0;
   virtual std::uint64_t Get_my_data_element() = 0;
   virtual void RegisterDataElementHandler_my_data_element(vaf::String owner, std::function<void(const ::vaf::ConstDataPtr<const std::uint64_t>)>&& f) = 0;
+  // Calls reader with the latest sample by const reference without a copy, false if there is none
+  template <typename Reader>
+  bool Read_my_data_element(Reader&& reader) {
+    const ::vaf::Result<::vaf::ConstDataPtr<const std::uint64_t>> sample{GetAllocated_my_data_element()};
+    if (!sample.HasValue()) {
+      return false;
+    }
+    std::forward<Reader>(reader)(*sample.Value());
+    return true;
+  }
 
   virtual ::vaf::Future<test::my_function::Output> my_function(const std::uint64_t& in, const std::uint64_t& inout) = 0;
   virtual ::vaf::Future<void> my_function_void(const std::uint64_t& in) = 0;
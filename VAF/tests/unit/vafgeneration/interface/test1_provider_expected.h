@@ -21,6 +21,7 @@
 #include "vaf/future.h"
 #include "vaf/result.h"
 #include "vaf/data_ptr.h"
+#include "vaf/loan.h"
 
 #include "test/my_function.h"
 #include <cstdint>
@@ -34,6 +35,14 @@ public:
   virtual ::vaf::Result<::vaf::DataPtr<std::uint64_t>> Allocate_my_data_element() = 0;
   virtual ::vaf::Result<void> SetAllocated_my_data_element(::vaf::DataPtr<std::uint64_t>&& data) = 0;
   virtual ::vaf::Result<void> Set_my_data_element(const std::uint64_t& data) = 0;
+  virtual ::vaf::Result<::vaf::Loan<std::uint64_t>> Loan_my_data_element() {
+    ::vaf::Result<::vaf::DataPtr<std::uint64_t>> sample{Allocate_my_data_element()};
+    if (!sample.HasValue()) {
+      return ::vaf::Result<::vaf::Loan<std::uint64_t>>{sample.Error()};
+    }
+    return ::vaf::Result<::vaf::Loan<std::uint64_t>>{::vaf::Loan<std::uint64_t>{std::move(sample).Value(),
+        [this](::vaf::DataPtr<std::uint64_t>&& data) { return SetAllocated_my_data_element(std::move(data)); }}};
+  }
 
   virtual void RegisterOperationHandler_my_function(std::function<test::my_function::Output(const std::uint64_t&, const std::uint64_t&)>&& f) = 0;
   virtual void RegisterOperationHandler_my_function_void(std::function<void(const std::uint64_t&)>&& f) = 0;
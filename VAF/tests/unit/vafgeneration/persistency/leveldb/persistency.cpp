@@ -16,6 +16,9 @@
 #include "persistency/persistency.h"
 
 #include "vaf/error_domain.h"
+#include "vaf/trace.h"
+#include "leveldb/iterator.h"
+#include "leveldb/write_batch.h"
 #include "protobuf_basetypes.pb.h"
 
 namespace persistency {
@@ -24,22 +27,75 @@ Persistency::Persistency() {
 }
 
 Persistency::~Persistency() {
+  std::unique_lock<std::mutex> lock{mutex_};
+  if (writer_thread_.joinable()) {
+    stop_writer_ = true;
+    lock.unlock();
+    writer_condition_.notify_one();
+    writer_thread_.join();
+    lock.lock();
+  }
+  if (opened_) {
+    if (!WritePending(lock).ok()) {
+      logger_.LogWarn() <<  "Kvs write of pending values failed for Persistency.";
+    }
+  }
   delete db_;
 }
 
-::vaf::Result<void> Persistency::Open(const vaf::String& filename, bool sync_on_write) noexcept {
+::vaf::Result<void> Persistency::Open(const vaf::String& filename, bool sync_on_write,
+                                            std::chrono::microseconds group_commit_interval, bool cache_values,
+                                            TuningProfile tuning_profile) noexcept {
+  VAF_TRACE_SCOPE("vaf.persistency", "Open", "Persistency");
+  get_latency_ = &vaf::GetLatencyHistogram("vaf_persistency_latency_seconds",
+                                         vaf::MetricLabels{ {"file", filename}, {"operation", "get"} });
+  scan_latency_ = &vaf::GetLatencyHistogram("vaf_persistency_latency_seconds",
+                                         vaf::MetricLabels{ {"file", filename}, {"operation", "scan"} });
+  set_latency_ = &vaf::GetLatencyHistogram("vaf_persistency_latency_seconds",
+                                         vaf::MetricLabels{ {"file", filename}, {"operation", "set"} });
+  commit_latency_ = &vaf::GetLatencyHistogram("vaf_persistency_latency_seconds",
+                                         vaf::MetricLabels{ {"file", filename}, {"operation", "commit"} });
   vaf::Result<void> ret_value {
     vaf::Result<void>::FromError(vaf::ErrorCode::kNotOk, "Error creating Instance Specifier for KVS")};
 
   leveldb::Options options;
   options.create_if_missing = true;
+  switch (tuning_profile) {
+    case TuningProfile::kReadHeavy:
+      // Keeps more blocks in memory and skips the tables without the key, reads seldom go to the storage
+      block_cache_.reset(leveldb::NewLRUCache(32U * 1024U * 1024U));
+      filter_policy_.reset(leveldb::NewBloomFilterPolicy(10));
+      break;
+    case TuningProfile::kWriteHeavy:
+      // Collects more values in memory before they are written to a table, so fewer compactions run
+      options.write_buffer_size = 16U * 1024U * 1024U;
+      options.max_file_size = 8U * 1024U * 1024U;
+      filter_policy_.reset(leveldb::NewBloomFilterPolicy(10));
+      break;
+    case TuningProfile::kTiny:
+      // Small buffers and few open tables for files of a few values
+      options.write_buffer_size = 256U * 1024U;
+      options.max_open_files = 64;
+      options.block_size = 1024U;
+      block_cache_.reset(leveldb::NewLRUCache(512U * 1024U));
+      break;
+    default:
+      break;
+  }
+  options.block_cache = block_cache_.get();
+  options.filter_policy = filter_policy_.get();
 
   sync_on_write_ = sync_on_write;
+  cache_values_ = cache_values;
 
   leveldb::Status status = leveldb::DB::Open(options, filename.c_str(), &db_);
   if (true == status.ok()) {
     opened_ = true;
     ret_value = vaf::Result<void>::FromValue();
+    if (group_commit_interval > std::chrono::microseconds{0}) {
+      group_commit_interval_ = group_commit_interval;
+      writer_thread_ = std::thread{[this]() { RunWriter(); }};
+    }
   } else {
     ret_value = vaf::Result<void>::FromError(vaf::Error(vaf::ErrorCode::kUnknown,"Error creating Instance Specifier for KVS."));
     logger_.LogWarn() <<  "Error creating Instance Specifier for KVS for Persistency.";
@@ -48,11 +104,36 @@ Persistency::~Persistency() {
 };
 
 ::vaf::Result<void> Persistency::Set(const vaf::String& key, const vaf::String& value) noexcept{
+  return SetSerialized(key, std::string{std::string_view{value}});
+};
+
+::vaf::Future<void> Persistency::SetAsync(const vaf::String& key, const vaf::String& value) noexcept{
+  return SetAsyncSerialized(key, std::string{std::string_view{value}});
+};
+
+::vaf::Result<vaf::String> Persistency::Get(const vaf::String& key) noexcept{
+  std::string value;
+  vaf::Result<void> result{GetSerialized(key, value)};
+  if (!result.HasValue()) {
+    return vaf::Result<vaf::String>{result.Error()};
+  }
+  return vaf::Result<vaf::String>::FromValue(vaf::String{value.data(), value.size()});
+};
+
+::vaf::Result<void> Persistency::SetSerialized(std::string_view key, std::string&& value) noexcept{
+  VAF_TRACE_SCOPE("vaf.persistency", "Set", "Persistency");
+  vaf::LatencyHistogram::Timer latency_timer{set_latency_};
   vaf::Result<void> ret_value{vaf::Result<void>::FromError(vaf::ErrorCode::kNotOk, "Kvs not opened.")};
   if (opened_) {
-    leveldb::WriteOptions write_options;
-    write_options.sync = sync_on_write_;
-    leveldb::Status status = db_->Put(write_options, key.c_str(), value.c_str());
+    // The value is written together with the queued ones, so it cannot be overwritten by an older queued value
+    std::unique_lock<std::mutex> lock{mutex_};
+    leveldb::Status status{};
+    pending_.insert_or_assign(std::string{key}, std::move(value));
+    cache_.erase(std::string{key});
+    ++cache_generation_;
+    if (!batch_open_ && (group_commit_interval_ == std::chrono::microseconds{0})) {
+      status = WritePending(lock);
+    }
     if (true == status.ok()) {
       ret_value = vaf::Result<void>::FromValue();
     } else {
@@ -66,35 +147,240 @@ Persistency::~Persistency() {
   return ret_value;
 };
 
-::vaf::Result<vaf::String> Persistency::Get(const vaf::String& key) noexcept{
-  vaf::Result<vaf::String> ret_value{
-    vaf::Result<vaf::String>::FromError(vaf::ErrorCode::kNotOk, "Kvs not opened.")};
+::vaf::Future<void> Persistency::SetAsyncSerialized(std::string_view key, std::string&& value) noexcept{
+  VAF_TRACE_SCOPE("vaf.persistency", "SetAsync", "Persistency");
+  vaf::internal::Promise<void> promise{};
+  vaf::Future<void> future{promise.get_future()};
   if (opened_) {
-    leveldb::ReadOptions read_options;
-    std::string temp;
-    leveldb::Status status = db_->Get(read_options, key.c_str(), &temp);
+    std::lock_guard<std::mutex> lock{mutex_};
+    if (!writer_thread_.joinable()) {
+      writer_thread_ = std::thread{[this]() { RunWriter(); }};
+    }
+    pending_.insert_or_assign(std::string{key}, std::move(value));
+    cache_.erase(std::string{key});
+    ++cache_generation_;
+    pending_promises_.push_back(std::move(promise));
+    writer_condition_.notify_one();
+  } else {
+    promise.SetError(vaf::Error(vaf::ErrorCode::kUnknown,"Kvs not opened."));
+    logger_.LogWarn() <<  "Kvs not opened for Persistency.";
+  }
+  return future;
+};
+
+::vaf::Result<void> Persistency::GetSerialized(std::string_view key, std::string& value) noexcept{
+  VAF_TRACE_SCOPE("vaf.persistency", "Get", "Persistency");
+  vaf::LatencyHistogram::Timer latency_timer{get_latency_};
+  vaf::Result<void> ret_value{vaf::Result<void>::FromError(vaf::ErrorCode::kNotOk, "Kvs not opened.")};
+  if (opened_) {
+    leveldb::Status status{};
+    bool found{false};
+    {
+      std::lock_guard<std::mutex> lock{mutex_};
+      for (const auto* values : {&pending_, &in_flight_}) {
+        const auto pending = values->find(key);
+        if (pending != values->end()) {
+          value = pending->second;
+          found = true;
+          break;
+        }
+      }
+    }
+    // A value that is neither pending nor in flight is already in the file, it is read straight into value
+    if (!found) {
+      status = db_->Get(leveldb::ReadOptions{}, leveldb::Slice{key.data(), key.size()}, &value);
+    }
     if (true == status.ok()) {
-      vaf::String value(temp.c_str());
-      ret_value = vaf::Result<vaf::String>::FromValue(value);
+      ret_value = vaf::Result<void>::FromValue();
     } else {
-      ret_value = vaf::Result<vaf::String>::FromError(vaf::Error(vaf::ErrorCode::kUnknown,"Kvs get failed."));
+      ret_value = vaf::Result<void>::FromError(vaf::Error(vaf::ErrorCode::kUnknown,"Kvs get failed."));
       logger_.LogWarn() <<  "Kvs get failed for Persistency.";
     }
   } else {
-    ret_value = vaf::Result<vaf::String>::FromError(vaf::Error(vaf::ErrorCode::kUnknown,"Kvs not opened."));
+    ret_value = vaf::Result<void>::FromError(vaf::Error(vaf::ErrorCode::kUnknown,"Kvs not opened."));
     logger_.LogWarn() <<  "Kvs not opened for Persistency.";
   }
   return ret_value;
 };
 
+::vaf::Result<void> Persistency::ScanSerialized(std::string_view begin, std::string_view end,
+                                                      const std::function<void(std::string_view key, std::string_view value)>& visit) noexcept{
+  VAF_TRACE_SCOPE("vaf.persistency", "Scan", "Persistency");
+  vaf::LatencyHistogram::Timer latency_timer{scan_latency_};
+  vaf::Result<void> ret_value{vaf::Result<void>::FromError(vaf::ErrorCode::kNotOk, "Kvs not opened.")};
+  if (opened_) {
+    const auto in_range = [end](std::string_view key) { return end.empty() || (key < end); };
+    std::map<std::string, std::string, std::less<>> unwritten{};
+    std::unique_ptr<leveldb::Iterator> iterator{};
+    {
+      // A value leaves in_flight_ only after it is written, so the iterator and the copied values form one snapshot
+      std::lock_guard<std::mutex> lock{mutex_};
+      for (const auto* values : {&in_flight_, &pending_}) {
+        for (auto entry = values->lower_bound(begin); (entry != values->end()) && in_range(entry->first); ++entry) {
+          unwritten.insert_or_assign(entry->first, entry->second);
+        }
+      }
+      leveldb::ReadOptions read_options{};
+      // A bulk scan would push the often read blocks out of the block cache
+      read_options.fill_cache = false;
+      iterator.reset(db_->NewIterator(read_options));
+    }
+
+    auto next_unwritten = unwritten.begin();
+    for (iterator->Seek(leveldb::Slice{begin.data(), begin.size()}); iterator->Valid(); iterator->Next()) {
+      const std::string_view key{iterator->key().data(), iterator->key().size()};
+      if (!in_range(key)) {
+        break;
+      }
+      for (; (next_unwritten != unwritten.end()) && (next_unwritten->first < key); ++next_unwritten) {
+        visit(next_unwritten->first, next_unwritten->second);
+      }
+      if ((next_unwritten != unwritten.end()) && (next_unwritten->first == key)) {
+        visit(next_unwritten->first, next_unwritten->second);
+        ++next_unwritten;
+      } else {
+        visit(key, std::string_view{iterator->value().data(), iterator->value().size()});
+      }
+    }
+    for (; next_unwritten != unwritten.end(); ++next_unwritten) {
+      visit(next_unwritten->first, next_unwritten->second);
+    }
+
+    if (true == iterator->status().ok()) {
+      ret_value = vaf::Result<void>::FromValue();
+    } else {
+      ret_value = vaf::Result<void>::FromError(vaf::Error(vaf::ErrorCode::kUnknown,"Kvs scan failed."));
+      logger_.LogWarn() <<  "Kvs scan failed for Persistency.";
+    }
+  } else {
+    ret_value = vaf::Result<void>::FromError(vaf::Error(vaf::ErrorCode::kUnknown,"Kvs not opened."));
+    logger_.LogWarn() <<  "Kvs not opened for Persistency.";
+  }
+  return ret_value;
+}
+
+::vaf::Result<void> Persistency::BeginBatch() noexcept {
+  vaf::Result<void> ret_value{vaf::Result<void>::FromError(vaf::ErrorCode::kNotOk, "Kvs not opened.")};
+  if (opened_) {
+    std::lock_guard<std::mutex> lock{mutex_};
+    batch_open_ = true;
+    ret_value = vaf::Result<void>::FromValue();
+  } else {
+    logger_.LogWarn() <<  "Kvs not opened for Persistency.";
+  }
+  return ret_value;
+}
+
+::vaf::Result<void> Persistency::CommitBatch() noexcept {
+  VAF_TRACE_SCOPE("vaf.persistency", "Commit", "Persistency");
+  vaf::LatencyHistogram::Timer latency_timer{commit_latency_};
+  vaf::Result<void> ret_value{vaf::Result<void>::FromError(vaf::ErrorCode::kNotOk, "Kvs not opened.")};
+  if (opened_) {
+    std::unique_lock<std::mutex> lock{mutex_};
+    batch_open_ = false;
+    if (true == WritePending(lock).ok()) {
+      ret_value = vaf::Result<void>::FromValue();
+    } else {
+      ret_value = vaf::Result<void>::FromError(vaf::Error(vaf::ErrorCode::kUnknown,"Kvs batch write failed."));
+      logger_.LogWarn() <<  "Kvs batch write failed for Persistency.";
+    }
+  } else {
+    logger_.LogWarn() <<  "Kvs not opened for Persistency.";
+  }
+  return ret_value;
+}
+
+::vaf::Result<void> Persistency::Compact() noexcept {
+  VAF_TRACE_SCOPE("vaf.persistency", "Compact", "Persistency");
+  vaf::Result<void> ret_value{vaf::Result<void>::FromError(vaf::ErrorCode::kNotOk, "Kvs not opened.")};
+  if (opened_) {
+    std::unique_lock<std::mutex> lock{mutex_};
+    // The values not yet written are compacted as well, an open batch is only written as a whole by CommitBatch
+    leveldb::Status status{batch_open_ ? leveldb::Status{} : WritePending(lock)};
+    lock.unlock();
+    if (true == status.ok()) {
+      db_->CompactRange(nullptr, nullptr);
+      ret_value = vaf::Result<void>::FromValue();
+    } else {
+      ret_value = vaf::Result<void>::FromError(vaf::ErrorCode::kUnknown, "Kvs write of pending values failed.");
+      logger_.LogWarn() <<  "Kvs write of pending values failed for Persistency.";
+    }
+  } else {
+    logger_.LogWarn() <<  "Kvs not opened for Persistency.";
+  }
+  return ret_value;
+}
+
+leveldb::Status Persistency::WritePending(std::unique_lock<std::mutex>& lock) {
+  write_done_condition_.wait(lock, [this]() { return !writing_; });
+  leveldb::Status status{};
+  if (!pending_.empty()) {
+    writing_ = true;
+    in_flight_.swap(pending_);
+    std::vector<vaf::internal::Promise<void>> promises{std::move(pending_promises_)};
+    pending_promises_.clear();
+    lock.unlock();
+
+    leveldb::WriteBatch batch;
+    for (const auto& entry : in_flight_) {
+      batch.Put(entry.first, entry.second);
+    }
+    leveldb::WriteOptions write_options;
+    write_options.sync = sync_on_write_;
+    status = db_->Write(write_options, &batch);
+
+    lock.lock();
+    // Failed values are dropped like a failed single write, keeping them would let them overwrite later writes
+    in_flight_.clear();
+    writing_ = false;
+    write_done_condition_.notify_all();
+    // The promises are set without the lock, as their continuations may call into the module again
+    lock.unlock();
+    for (auto& promise : promises) {
+      if (status.ok()) {
+        promise.set_value();
+      } else {
+        promise.SetError(vaf::Error(vaf::ErrorCode::kUnknown,"Kvs set failed."));
+      }
+    }
+    lock.lock();
+  }
+  return status;
+}
+
+void Persistency::RunWriter() {
+  std::unique_lock<std::mutex> lock{mutex_};
+  while (!stop_writer_) {
+    if (group_commit_interval_ > std::chrono::microseconds{0}) {
+      writer_condition_.wait_for(lock, group_commit_interval_, [this]() { return stop_writer_; });
+    } else {
+      writer_condition_.wait(lock, [this]() { return stop_writer_ || (!batch_open_ && !pending_.empty()); });
+    }
+    // An open batch is only written as a whole by CommitBatch
+    if (!batch_open_ && !WritePending(lock).ok()) {
+      logger_.LogWarn() <<  "Kvs write of queued values failed for Persistency.";
+    }
+  }
+}
+
 ::vaf::Result<std::uint64_t> Persistency::Get_UInt64Value(const vaf::String& key) noexcept{
   vaf::Result<std::uint64_t> ret_value{vaf::Result<std::uint64_t>::FromError(vaf::ErrorCode::kNotOk, "Get failed.")};
+  std::uint64_t cache_generation{0};
+  if (cache_values_) {
+    cache_generation = FindInCache(key, ret_value);
+    if (ret_value.HasValue()) {
+      return ret_value;
+    }
+  }
 
-  vaf::Result<vaf::String> result = Get(key);
+  std::string serialized;
+  vaf::Result<void> result = GetSerialized(key, serialized);
   if (result.HasValue()) {
     protobuf::basetypes::UInt64 deserialized;
-    if (!deserialized.ParseFromString(result.Value().c_str())) {
+    if (!deserialized.ParseFromString(serialized)) {
       vaf::OutputSyncStream{std::cerr} << "ERROR: Unable to deserialize!\n";
+    } else if (cache_values_) {
+      AddToCache<std::uint64_t>(key, deserialized.vaf_value_internal(), cache_generation);
     }
     ret_value = vaf::Result<std::uint64_t>::FromValue(deserialized.vaf_value_internal());
   } else {
@@ -108,23 +394,48 @@ Persistency::~Persistency() {
 ::vaf::Result<void> Persistency::Set_UInt64Value(const vaf::String& key, const std::uint64_t& value) noexcept{
   protobuf::basetypes::UInt64 proto_message;
   proto_message.set_vaf_value_internal(value);
-  size_t nbytes = proto_message.ByteSizeLong();
-  std::string temp;
-  if (nbytes) {
-    proto_message.SerializeToString(&temp);
-  }
+  std::string serialized;
+  proto_message.SerializeToString(&serialized);
+  return SetSerialized(key, std::move(serialized));
+}
 
-  vaf::String serialized(temp.c_str());
-  return Set(key, serialized);
+::vaf::Future<void> Persistency::SetAsync_UInt64Value(const vaf::String& key, const std::uint64_t& value) noexcept{
+  protobuf::basetypes::UInt64 proto_message;
+  proto_message.set_vaf_value_internal(value);
+  std::string serialized;
+  proto_message.SerializeToString(&serialized);
+  return SetAsyncSerialized(key, std::move(serialized));
+}
+
+::vaf::Result<void> Persistency::Scan_UInt64Values(const vaf::String& begin, const vaf::String& end,
+                                                          std::function<void(const vaf::String& key, const std::uint64_t& value)> callback) noexcept{
+  return ScanSerialized(begin, end, [this, &callback](std::string_view key, std::string_view serialized) {
+    protobuf::basetypes::UInt64 deserialized;
+    if (deserialized.ParseFromArray(serialized.data(), static_cast<int>(serialized.size()))) {
+      callback(vaf::String{key.data(), key.size()}, deserialized.vaf_value_internal());
+    } else {
+      logger_.LogWarn() <<  "Kvs scan skipped a value that does not deserialize for Persistency.";
+    }
+  });
 }
 ::vaf::Result<std::uint32_t> Persistency::Get_UInt32Value(const vaf::String& key) noexcept{
   vaf::Result<std::uint32_t> ret_value{vaf::Result<std::uint32_t>::FromError(vaf::ErrorCode::kNotOk, "Get failed.")};
+  std::uint64_t cache_generation{0};
+  if (cache_values_) {
+    cache_generation = FindInCache(key, ret_value);
+    if (ret_value.HasValue()) {
+      return ret_value;
+    }
+  }
 
-  vaf::Result<vaf::String> result = Get(key);
+  std::string serialized;
+  vaf::Result<void> result = GetSerialized(key, serialized);
   if (result.HasValue()) {
     protobuf::basetypes::UInt32 deserialized;
-    if (!deserialized.ParseFromString(result.Value().c_str())) {
+    if (!deserialized.ParseFromString(serialized)) {
       vaf::OutputSyncStream{std::cerr} << "ERROR: Unable to deserialize!\n";
+    } else if (cache_values_) {
+      AddToCache<std::uint32_t>(key, deserialized.vaf_value_internal(), cache_generation);
     }
     ret_value = vaf::Result<std::uint32_t>::FromValue(deserialized.vaf_value_internal());
   } else {
@@ -138,23 +449,48 @@ Persistency::~Persistency() {
 ::vaf::Result<void> Persistency::Set_UInt32Value(const vaf::String& key, const std::uint32_t& value) noexcept{
   protobuf::basetypes::UInt32 proto_message;
   proto_message.set_vaf_value_internal(value);
-  size_t nbytes = proto_message.ByteSizeLong();
-  std::string temp;
-  if (nbytes) {
-    proto_message.SerializeToString(&temp);
-  }
+  std::string serialized;
+  proto_message.SerializeToString(&serialized);
+  return SetSerialized(key, std::move(serialized));
+}
 
-  vaf::String serialized(temp.c_str());
-  return Set(key, serialized);
+::vaf::Future<void> Persistency::SetAsync_UInt32Value(const vaf::String& key, const std::uint32_t& value) noexcept{
+  protobuf::basetypes::UInt32 proto_message;
+  proto_message.set_vaf_value_internal(value);
+  std::string serialized;
+  proto_message.SerializeToString(&serialized);
+  return SetAsyncSerialized(key, std::move(serialized));
+}
+
+::vaf::Result<void> Persistency::Scan_UInt32Values(const vaf::String& begin, const vaf::String& end,
+                                                          std::function<void(const vaf::String& key, const std::uint32_t& value)> callback) noexcept{
+  return ScanSerialized(begin, end, [this, &callback](std::string_view key, std::string_view serialized) {
+    protobuf::basetypes::UInt32 deserialized;
+    if (deserialized.ParseFromArray(serialized.data(), static_cast<int>(serialized.size()))) {
+      callback(vaf::String{key.data(), key.size()}, deserialized.vaf_value_internal());
+    } else {
+      logger_.LogWarn() <<  "Kvs scan skipped a value that does not deserialize for Persistency.";
+    }
+  });
 }
 ::vaf::Result<std::uint16_t> Persistency::Get_UInt16Value(const vaf::String& key) noexcept{
   vaf::Result<std::uint16_t> ret_value{vaf::Result<std::uint16_t>::FromError(vaf::ErrorCode::kNotOk, "Get failed.")};
+  std::uint64_t cache_generation{0};
+  if (cache_values_) {
+    cache_generation = FindInCache(key, ret_value);
+    if (ret_value.HasValue()) {
+      return ret_value;
+    }
+  }
 
-  vaf::Result<vaf::String> result = Get(key);
+  std::string serialized;
+  vaf::Result<void> result = GetSerialized(key, serialized);
   if (result.HasValue()) {
     protobuf::basetypes::UInt16 deserialized;
-    if (!deserialized.ParseFromString(result.Value().c_str())) {
+    if (!deserialized.ParseFromString(serialized)) {
       vaf::OutputSyncStream{std::cerr} << "ERROR: Unable to deserialize!\n";
+    } else if (cache_values_) {
+      AddToCache<std::uint16_t>(key, deserialized.vaf_value_internal(), cache_generation);
     }
     ret_value = vaf::Result<std::uint16_t>::FromValue(deserialized.vaf_value_internal());
   } else {
@@ -168,23 +504,48 @@ Persistency::~Persistency() {
 ::vaf::Result<void> Persistency::Set_UInt16Value(const vaf::String& key, const std::uint16_t& value) noexcept{
   protobuf::basetypes::UInt16 proto_message;
   proto_message.set_vaf_value_internal(value);
-  size_t nbytes = proto_message.ByteSizeLong();
-  std::string temp;
-  if (nbytes) {
-    proto_message.SerializeToString(&temp);
-  }
+  std::string serialized;
+  proto_message.SerializeToString(&serialized);
+  return SetSerialized(key, std::move(serialized));
+}
 
-  vaf::String serialized(temp.c_str());
-  return Set(key, serialized);
+::vaf::Future<void> Persistency::SetAsync_UInt16Value(const vaf::String& key, const std::uint16_t& value) noexcept{
+  protobuf::basetypes::UInt16 proto_message;
+  proto_message.set_vaf_value_internal(value);
+  std::string serialized;
+  proto_message.SerializeToString(&serialized);
+  return SetAsyncSerialized(key, std::move(serialized));
+}
+
+::vaf::Result<void> Persistency::Scan_UInt16Values(const vaf::String& begin, const vaf::String& end,
+                                                          std::function<void(const vaf::String& key, const std::uint16_t& value)> callback) noexcept{
+  return ScanSerialized(begin, end, [this, &callback](std::string_view key, std::string_view serialized) {
+    protobuf::basetypes::UInt16 deserialized;
+    if (deserialized.ParseFromArray(serialized.data(), static_cast<int>(serialized.size()))) {
+      callback(vaf::String{key.data(), key.size()}, deserialized.vaf_value_internal());
+    } else {
+      logger_.LogWarn() <<  "Kvs scan skipped a value that does not deserialize for Persistency.";
+    }
+  });
 }
 ::vaf::Result<std::uint8_t> Persistency::Get_UInt8Value(const vaf::String& key) noexcept{
   vaf::Result<std::uint8_t> ret_value{vaf::Result<std::uint8_t>::FromError(vaf::ErrorCode::kNotOk, "Get failed.")};
+  std::uint64_t cache_generation{0};
+  if (cache_values_) {
+    cache_generation = FindInCache(key, ret_value);
+    if (ret_value.HasValue()) {
+      return ret_value;
+    }
+  }
 
-  vaf::Result<vaf::String> result = Get(key);
+  std::string serialized;
+  vaf::Result<void> result = GetSerialized(key, serialized);
   if (result.HasValue()) {
     protobuf::basetypes::UInt8 deserialized;
-    if (!deserialized.ParseFromString(result.Value().c_str())) {
+    if (!deserialized.ParseFromString(serialized)) {
       vaf::OutputSyncStream{std::cerr} << "ERROR: Unable to deserialize!\n";
+    } else if (cache_values_) {
+      AddToCache<std::uint8_t>(key, deserialized.vaf_value_internal(), cache_generation);
     }
     ret_value = vaf::Result<std::uint8_t>::FromValue(deserialized.vaf_value_internal());
   } else {
@@ -198,23 +559,48 @@ Persistency::~Persistency() {
 ::vaf::Result<void> Persistency::Set_UInt8Value(const vaf::String& key, const std::uint8_t& value) noexcept{
   protobuf::basetypes::UInt8 proto_message;
   proto_message.set_vaf_value_internal(value);
-  size_t nbytes = proto_message.ByteSizeLong();
-  std::string temp;
-  if (nbytes) {
-    proto_message.SerializeToString(&temp);
-  }
+  std::string serialized;
+  proto_message.SerializeToString(&serialized);
+  return SetSerialized(key, std::move(serialized));
+}
 
-  vaf::String serialized(temp.c_str());
-  return Set(key, serialized);
+::vaf::Future<void> Persistency::SetAsync_UInt8Value(const vaf::String& key, const std::uint8_t& value) noexcept{
+  protobuf::basetypes::UInt8 proto_message;
+  proto_message.set_vaf_value_internal(value);
+  std::string serialized;
+  proto_message.SerializeToString(&serialized);
+  return SetAsyncSerialized(key, std::move(serialized));
+}
+
+::vaf::Result<void> Persistency::Scan_UInt8Values(const vaf::String& begin, const vaf::String& end,
+                                                          std::function<void(const vaf::String& key, const std::uint8_t& value)> callback) noexcept{
+  return ScanSerialized(begin, end, [this, &callback](std::string_view key, std::string_view serialized) {
+    protobuf::basetypes::UInt8 deserialized;
+    if (deserialized.ParseFromArray(serialized.data(), static_cast<int>(serialized.size()))) {
+      callback(vaf::String{key.data(), key.size()}, deserialized.vaf_value_internal());
+    } else {
+      logger_.LogWarn() <<  "Kvs scan skipped a value that does not deserialize for Persistency.";
+    }
+  });
 }
 ::vaf::Result<std::int64_t> Persistency::Get_Int64Value(const vaf::String& key) noexcept{
   vaf::Result<std::int64_t> ret_value{vaf::Result<std::int64_t>::FromError(vaf::ErrorCode::kNotOk, "Get failed.")};
+  std::uint64_t cache_generation{0};
+  if (cache_values_) {
+    cache_generation = FindInCache(key, ret_value);
+    if (ret_value.HasValue()) {
+      return ret_value;
+    }
+  }
 
-  vaf::Result<vaf::String> result = Get(key);
+  std::string serialized;
+  vaf::Result<void> result = GetSerialized(key, serialized);
   if (result.HasValue()) {
     protobuf::basetypes::Int64 deserialized;
-    if (!deserialized.ParseFromString(result.Value().c_str())) {
+    if (!deserialized.ParseFromString(serialized)) {
       vaf::OutputSyncStream{std::cerr} << "ERROR: Unable to deserialize!\n";
+    } else if (cache_values_) {
+      AddToCache<std::int64_t>(key, deserialized.vaf_value_internal(), cache_generation);
     }
     ret_value = vaf::Result<std::int64_t>::FromValue(deserialized.vaf_value_internal());
   } else {
@@ -228,23 +614,48 @@ Persistency::~Persistency() {
 ::vaf::Result<void> Persistency::Set_Int64Value(const vaf::String& key, const std::int64_t& value) noexcept{
   protobuf::basetypes::Int64 proto_message;
   proto_message.set_vaf_value_internal(value);
-  size_t nbytes = proto_message.ByteSizeLong();
-  std::string temp;
-  if (nbytes) {
-    proto_message.SerializeToString(&temp);
-  }
+  std::string serialized;
+  proto_message.SerializeToString(&serialized);
+  return SetSerialized(key, std::move(serialized));
+}
 
-  vaf::String serialized(temp.c_str());
-  return Set(key, serialized);
+::vaf::Future<void> Persistency::SetAsync_Int64Value(const vaf::String& key, const std::int64_t& value) noexcept{
+  protobuf::basetypes::Int64 proto_message;
+  proto_message.set_vaf_value_internal(value);
+  std::string serialized;
+  proto_message.SerializeToString(&serialized);
+  return SetAsyncSerialized(key, std::move(serialized));
+}
+
+::vaf::Result<void> Persistency::Scan_Int64Values(const vaf::String& begin, const vaf::String& end,
+                                                          std::function<void(const vaf::String& key, const std::int64_t& value)> callback) noexcept{
+  return ScanSerialized(begin, end, [this, &callback](std::string_view key, std::string_view serialized) {
+    protobuf::basetypes::Int64 deserialized;
+    if (deserialized.ParseFromArray(serialized.data(), static_cast<int>(serialized.size()))) {
+      callback(vaf::String{key.data(), key.size()}, deserialized.vaf_value_internal());
+    } else {
+      logger_.LogWarn() <<  "Kvs scan skipped a value that does not deserialize for Persistency.";
+    }
+  });
 }
 ::vaf::Result<std::int32_t> Persistency::Get_Int32Value(const vaf::String& key) noexcept{
   vaf::Result<std::int32_t> ret_value{vaf::Result<std::int32_t>::FromError(vaf::ErrorCode::kNotOk, "Get failed.")};
+  std::uint64_t cache_generation{0};
+  if (cache_values_) {
+    cache_generation = FindInCache(key, ret_value);
+    if (ret_value.HasValue()) {
+      return ret_value;
+    }
+  }
 
-  vaf::Result<vaf::String> result = Get(key);
+  std::string serialized;
+  vaf::Result<void> result = GetSerialized(key, serialized);
   if (result.HasValue()) {
     protobuf::basetypes::Int32 deserialized;
-    if (!deserialized.ParseFromString(result.Value().c_str())) {
+    if (!deserialized.ParseFromString(serialized)) {
       vaf::OutputSyncStream{std::cerr} << "ERROR: Unable to deserialize!\n";
+    } else if (cache_values_) {
+      AddToCache<std::int32_t>(key, deserialized.vaf_value_internal(), cache_generation);
     }
     ret_value = vaf::Result<std::int32_t>::FromValue(deserialized.vaf_value_internal());
   } else {
@@ -258,23 +669,48 @@ Persistency::~Persistency() {
 ::vaf::Result<void> Persistency::Set_Int32Value(const vaf::String& key, const std::int32_t& value) noexcept{
   protobuf::basetypes::Int32 proto_message;
   proto_message.set_vaf_value_internal(value);
-  size_t nbytes = proto_message.ByteSizeLong();
-  std::string temp;
-  if (nbytes) {
-    proto_message.SerializeToString(&temp);
-  }
+  std::string serialized;
+  proto_message.SerializeToString(&serialized);
+  return SetSerialized(key, std::move(serialized));
+}
 
-  vaf::String serialized(temp.c_str());
-  return Set(key, serialized);
+::vaf::Future<void> Persistency::SetAsync_Int32Value(const vaf::String& key, const std::int32_t& value) noexcept{
+  protobuf::basetypes::Int32 proto_message;
+  proto_message.set_vaf_value_internal(value);
+  std::string serialized;
+  proto_message.SerializeToString(&serialized);
+  return SetAsyncSerialized(key, std::move(serialized));
+}
+
+::vaf::Result<void> Persistency::Scan_Int32Values(const vaf::String& begin, const vaf::String& end,
+                                                          std::function<void(const vaf::String& key, const std::int32_t& value)> callback) noexcept{
+  return ScanSerialized(begin, end, [this, &callback](std::string_view key, std::string_view serialized) {
+    protobuf::basetypes::Int32 deserialized;
+    if (deserialized.ParseFromArray(serialized.data(), static_cast<int>(serialized.size()))) {
+      callback(vaf::String{key.data(), key.size()}, deserialized.vaf_value_internal());
+    } else {
+      logger_.LogWarn() <<  "Kvs scan skipped a value that does not deserialize for Persistency.";
+    }
+  });
 }
 ::vaf::Result<std::int16_t> Persistency::Get_Int16Value(const vaf::String& key) noexcept{
   vaf::Result<std::int16_t> ret_value{vaf::Result<std::int16_t>::FromError(vaf::ErrorCode::kNotOk, "Get failed.")};
+  std::uint64_t cache_generation{0};
+  if (cache_values_) {
+    cache_generation = FindInCache(key, ret_value);
+    if (ret_value.HasValue()) {
+      return ret_value;
+    }
+  }
 
-  vaf::Result<vaf::String> result = Get(key);
+  std::string serialized;
+  vaf::Result<void> result = GetSerialized(key, serialized);
   if (result.HasValue()) {
     protobuf::basetypes::Int16 deserialized;
-    if (!deserialized.ParseFromString(result.Value().c_str())) {
+    if (!deserialized.ParseFromString(serialized)) {
       vaf::OutputSyncStream{std::cerr} << "ERROR: Unable to deserialize!\n";
+    } else if (cache_values_) {
+      AddToCache<std::int16_t>(key, deserialized.vaf_value_internal(), cache_generation);
     }
     ret_value = vaf::Result<std::int16_t>::FromValue(deserialized.vaf_value_internal());
   } else {
@@ -288,23 +724,48 @@ Persistency::~Persistency() {
 ::vaf::Result<void> Persistency::Set_Int16Value(const vaf::String& key, const std::int16_t& value) noexcept{
   protobuf::basetypes::Int16 proto_message;
   proto_message.set_vaf_value_internal(value);
-  size_t nbytes = proto_message.ByteSizeLong();
-  std::string temp;
-  if (nbytes) {
-    proto_message.SerializeToString(&temp);
-  }
+  std::string serialized;
+  proto_message.SerializeToString(&serialized);
+  return SetSerialized(key, std::move(serialized));
+}
 
-  vaf::String serialized(temp.c_str());
-  return Set(key, serialized);
+::vaf::Future<void> Persistency::SetAsync_Int16Value(const vaf::String& key, const std::int16_t& value) noexcept{
+  protobuf::basetypes::Int16 proto_message;
+  proto_message.set_vaf_value_internal(value);
+  std::string serialized;
+  proto_message.SerializeToString(&serialized);
+  return SetAsyncSerialized(key, std::move(serialized));
+}
+
+::vaf::Result<void> Persistency::Scan_Int16Values(const vaf::String& begin, const vaf::String& end,
+                                                          std::function<void(const vaf::String& key, const std::int16_t& value)> callback) noexcept{
+  return ScanSerialized(begin, end, [this, &callback](std::string_view key, std::string_view serialized) {
+    protobuf::basetypes::Int16 deserialized;
+    if (deserialized.ParseFromArray(serialized.data(), static_cast<int>(serialized.size()))) {
+      callback(vaf::String{key.data(), key.size()}, deserialized.vaf_value_internal());
+    } else {
+      logger_.LogWarn() <<  "Kvs scan skipped a value that does not deserialize for Persistency.";
+    }
+  });
 }
 ::vaf::Result<std::int8_t> Persistency::Get_Int8Value(const vaf::String& key) noexcept{
   vaf::Result<std::int8_t> ret_value{vaf::Result<std::int8_t>::FromError(vaf::ErrorCode::kNotOk, "Get failed.")};
+  std::uint64_t cache_generation{0};
+  if (cache_values_) {
+    cache_generation = FindInCache(key, ret_value);
+    if (ret_value.HasValue()) {
+      return ret_value;
+    }
+  }
 
-  vaf::Result<vaf::String> result = Get(key);
+  std::string serialized;
+  vaf::Result<void> result = GetSerialized(key, serialized);
   if (result.HasValue()) {
     protobuf::basetypes::Int8 deserialized;
-    if (!deserialized.ParseFromString(result.Value().c_str())) {
+    if (!deserialized.ParseFromString(serialized)) {
       vaf::OutputSyncStream{std::cerr} << "ERROR: Unable to deserialize!\n";
+    } else if (cache_values_) {
+      AddToCache<std::int8_t>(key, deserialized.vaf_value_internal(), cache_generation);
     }
     ret_value = vaf::Result<std::int8_t>::FromValue(deserialized.vaf_value_internal());
   } else {
@@ -318,23 +779,48 @@ Persistency::~Persistency() {
 ::vaf::Result<void> Persistency::Set_Int8Value(const vaf::String& key, const std::int8_t& value) noexcept{
   protobuf::basetypes::Int8 proto_message;
   proto_message.set_vaf_value_internal(value);
-  size_t nbytes = proto_message.ByteSizeLong();
-  std::string temp;
-  if (nbytes) {
-    proto_message.SerializeToString(&temp);
-  }
+  std::string serialized;
+  proto_message.SerializeToString(&serialized);
+  return SetSerialized(key, std::move(serialized));
+}
 
-  vaf::String serialized(temp.c_str());
-  return Set(key, serialized);
+::vaf::Future<void> Persistency::SetAsync_Int8Value(const vaf::String& key, const std::int8_t& value) noexcept{
+  protobuf::basetypes::Int8 proto_message;
+  proto_message.set_vaf_value_internal(value);
+  std::string serialized;
+  proto_message.SerializeToString(&serialized);
+  return SetAsyncSerialized(key, std::move(serialized));
+}
+
+::vaf::Result<void> Persistency::Scan_Int8Values(const vaf::String& begin, const vaf::String& end,
+                                                          std::function<void(const vaf::String& key, const std::int8_t& value)> callback) noexcept{
+  return ScanSerialized(begin, end, [this, &callback](std::string_view key, std::string_view serialized) {
+    protobuf::basetypes::Int8 deserialized;
+    if (deserialized.ParseFromArray(serialized.data(), static_cast<int>(serialized.size()))) {
+      callback(vaf::String{key.data(), key.size()}, deserialized.vaf_value_internal());
+    } else {
+      logger_.LogWarn() <<  "Kvs scan skipped a value that does not deserialize for Persistency.";
+    }
+  });
 }
 ::vaf::Result<bool> Persistency::Get_BoolValue(const vaf::String& key) noexcept{
   vaf::Result<bool> ret_value{vaf::Result<bool>::FromError(vaf::ErrorCode::kNotOk, "Get failed.")};
+  std::uint64_t cache_generation{0};
+  if (cache_values_) {
+    cache_generation = FindInCache(key, ret_value);
+    if (ret_value.HasValue()) {
+      return ret_value;
+    }
+  }
 
-  vaf::Result<vaf::String> result = Get(key);
+  std::string serialized;
+  vaf::Result<void> result = GetSerialized(key, serialized);
   if (result.HasValue()) {
     protobuf::basetypes::Bool deserialized;
-    if (!deserialized.ParseFromString(result.Value().c_str())) {
+    if (!deserialized.ParseFromString(serialized)) {
       vaf::OutputSyncStream{std::cerr} << "ERROR: Unable to deserialize!\n";
+    } else if (cache_values_) {
+      AddToCache<bool>(key, deserialized.vaf_value_internal(), cache_generation);
     }
     ret_value = vaf::Result<bool>::FromValue(deserialized.vaf_value_internal());
   } else {
@@ -348,23 +834,48 @@ Persistency::~Persistency() {
 ::vaf::Result<void> Persistency::Set_BoolValue(const vaf::String& key, const bool& value) noexcept{
   protobuf::basetypes::Bool proto_message;
   proto_message.set_vaf_value_internal(value);
-  size_t nbytes = proto_message.ByteSizeLong();
-  std::string temp;
-  if (nbytes) {
-    proto_message.SerializeToString(&temp);
-  }
+  std::string serialized;
+  proto_message.SerializeToString(&serialized);
+  return SetSerialized(key, std::move(serialized));
+}
 
-  vaf::String serialized(temp.c_str());
-  return Set(key, serialized);
+::vaf::Future<void> Persistency::SetAsync_BoolValue(const vaf::String& key, const bool& value) noexcept{
+  protobuf::basetypes::Bool proto_message;
+  proto_message.set_vaf_value_internal(value);
+  std::string serialized;
+  proto_message.SerializeToString(&serialized);
+  return SetAsyncSerialized(key, std::move(serialized));
+}
+
+::vaf::Result<void> Persistency::Scan_BoolValues(const vaf::String& begin, const vaf::String& end,
+                                                          std::function<void(const vaf::String& key, const bool& value)> callback) noexcept{
+  return ScanSerialized(begin, end, [this, &callback](std::string_view key, std::string_view serialized) {
+    protobuf::basetypes::Bool deserialized;
+    if (deserialized.ParseFromArray(serialized.data(), static_cast<int>(serialized.size()))) {
+      callback(vaf::String{key.data(), key.size()}, deserialized.vaf_value_internal());
+    } else {
+      logger_.LogWarn() <<  "Kvs scan skipped a value that does not deserialize for Persistency.";
+    }
+  });
 }
 ::vaf::Result<float> Persistency::Get_FloatValue(const vaf::String& key) noexcept{
   vaf::Result<float> ret_value{vaf::Result<float>::FromError(vaf::ErrorCode::kNotOk, "Get failed.")};
+  std::uint64_t cache_generation{0};
+  if (cache_values_) {
+    cache_generation = FindInCache(key, ret_value);
+    if (ret_value.HasValue()) {
+      return ret_value;
+    }
+  }
 
-  vaf::Result<vaf::String> result = Get(key);
+  std::string serialized;
+  vaf::Result<void> result = GetSerialized(key, serialized);
   if (result.HasValue()) {
     protobuf::basetypes::Float deserialized;
-    if (!deserialized.ParseFromString(result.Value().c_str())) {
+    if (!deserialized.ParseFromString(serialized)) {
       vaf::OutputSyncStream{std::cerr} << "ERROR: Unable to deserialize!\n";
+    } else if (cache_values_) {
+      AddToCache<float>(key, deserialized.vaf_value_internal(), cache_generation);
     }
     ret_value = vaf::Result<float>::FromValue(deserialized.vaf_value_internal());
   } else {
@@ -378,23 +889,48 @@ Persistency::~Persistency() {
 ::vaf::Result<void> Persistency::Set_FloatValue(const vaf::String& key, const float& value) noexcept{
   protobuf::basetypes::Float proto_message;
   proto_message.set_vaf_value_internal(value);
-  size_t nbytes = proto_message.ByteSizeLong();
-  std::string temp;
-  if (nbytes) {
-    proto_message.SerializeToString(&temp);
-  }
+  std::string serialized;
+  proto_message.SerializeToString(&serialized);
+  return SetSerialized(key, std::move(serialized));
+}
 
-  vaf::String serialized(temp.c_str());
-  return Set(key, serialized);
+::vaf::Future<void> Persistency::SetAsync_FloatValue(const vaf::String& key, const float& value) noexcept{
+  protobuf::basetypes::Float proto_message;
+  proto_message.set_vaf_value_internal(value);
+  std::string serialized;
+  proto_message.SerializeToString(&serialized);
+  return SetAsyncSerialized(key, std::move(serialized));
+}
+
+::vaf::Result<void> Persistency::Scan_FloatValues(const vaf::String& begin, const vaf::String& end,
+                                                          std::function<void(const vaf::String& key, const float& value)> callback) noexcept{
+  return ScanSerialized(begin, end, [this, &callback](std::string_view key, std::string_view serialized) {
+    protobuf::basetypes::Float deserialized;
+    if (deserialized.ParseFromArray(serialized.data(), static_cast<int>(serialized.size()))) {
+      callback(vaf::String{key.data(), key.size()}, deserialized.vaf_value_internal());
+    } else {
+      logger_.LogWarn() <<  "Kvs scan skipped a value that does not deserialize for Persistency.";
+    }
+  });
 }
 ::vaf::Result<double> Persistency::Get_DoubleValue(const vaf::String& key) noexcept{
   vaf::Result<double> ret_value{vaf::Result<double>::FromError(vaf::ErrorCode::kNotOk, "Get failed.")};
+  std::uint64_t cache_generation{0};
+  if (cache_values_) {
+    cache_generation = FindInCache(key, ret_value);
+    if (ret_value.HasValue()) {
+      return ret_value;
+    }
+  }
 
-  vaf::Result<vaf::String> result = Get(key);
+  std::string serialized;
+  vaf::Result<void> result = GetSerialized(key, serialized);
   if (result.HasValue()) {
     protobuf::basetypes::Double deserialized;
-    if (!deserialized.ParseFromString(result.Value().c_str())) {
+    if (!deserialized.ParseFromString(serialized)) {
       vaf::OutputSyncStream{std::cerr} << "ERROR: Unable to deserialize!\n";
+    } else if (cache_values_) {
+      AddToCache<double>(key, deserialized.vaf_value_internal(), cache_generation);
     }
     ret_value = vaf::Result<double>::FromValue(deserialized.vaf_value_internal());
   } else {
@@ -408,28 +944,55 @@ Persistency::~Persistency() {
 ::vaf::Result<void> Persistency::Set_DoubleValue(const vaf::String& key, const double& value) noexcept{
   protobuf::basetypes::Double proto_message;
   proto_message.set_vaf_value_internal(value);
-  size_t nbytes = proto_message.ByteSizeLong();
-  std::string temp;
-  if (nbytes) {
-    proto_message.SerializeToString(&temp);
-  }
+  std::string serialized;
+  proto_message.SerializeToString(&serialized);
+  return SetSerialized(key, std::move(serialized));
+}
 
-  vaf::String serialized(temp.c_str());
-  return Set(key, serialized);
+::vaf::Future<void> Persistency::SetAsync_DoubleValue(const vaf::String& key, const double& value) noexcept{
+  protobuf::basetypes::Double proto_message;
+  proto_message.set_vaf_value_internal(value);
+  std::string serialized;
+  proto_message.SerializeToString(&serialized);
+  return SetAsyncSerialized(key, std::move(serialized));
+}
+
+::vaf::Result<void> Persistency::Scan_DoubleValues(const vaf::String& begin, const vaf::String& end,
+                                                          std::function<void(const vaf::String& key, const double& value)> callback) noexcept{
+  return ScanSerialized(begin, end, [this, &callback](std::string_view key, std::string_view serialized) {
+    protobuf::basetypes::Double deserialized;
+    if (deserialized.ParseFromArray(serialized.data(), static_cast<int>(serialized.size()))) {
+      callback(vaf::String{key.data(), key.size()}, deserialized.vaf_value_internal());
+    } else {
+      logger_.LogWarn() <<  "Kvs scan skipped a value that does not deserialize for Persistency.";
+    }
+  });
 }
 
 ::vaf::Result<::vaf::String> Persistency::Get_StringValue(const vaf::String& key) noexcept{
   vaf::Result<::vaf::String> ret_value{vaf::Result<::vaf::String>::FromError(vaf::ErrorCode::kNotOk, "Get failed.")};
+  std::uint64_t cache_generation{0};
+  if (cache_values_) {
+    cache_generation = FindInCache(key, ret_value);
+    if (ret_value.HasValue()) {
+      return ret_value;
+    }
+  }
 
-  vaf::Result<vaf::String> result = Get(key);
+  std::string serialized;
+  vaf::Result<void> result = GetSerialized(key, serialized);
   if (result.HasValue()) {
     protobuf::vaf::String deserialized;
-    if (!deserialized.ParseFromString(result.Value().c_str())) {
+    const bool parsed{deserialized.ParseFromString(serialized)};
+    if (!parsed) {
       vaf::OutputSyncStream{std::cerr} << "ERROR: Unable to deserialize!\n";
     }
     ::vaf::String value;
-    protobuf::vaf::StringProtoToVaf(deserialized, value);
-    ret_value = vaf::Result<::vaf::String>::FromValue(value);
+    protobuf::vaf::StringProtoToVaf(std::move(deserialized), value);
+    if (parsed && cache_values_) {
+      AddToCache(key, value, cache_generation);
+    }
+    ret_value = vaf::Result<::vaf::String>::FromValue(std::move(value));
   } else {
     ret_value = vaf::Result<::vaf::String>::FromError(vaf::Error(vaf::ErrorCode::kUnknown,"Kvs get failed."));
     logger_.LogWarn() <<  "Get failed for Persistency.";
@@ -442,27 +1005,57 @@ Persistency::~Persistency() {
                                                             const ::vaf::String& value) noexcept{
   protobuf::vaf::String proto_message;
   protobuf::vaf::StringVafToProto(value, proto_message);
-  size_t nbytes = proto_message.ByteSizeLong();
-  std::string temp;
-  if (nbytes) {
-    proto_message.SerializeToString(&temp);
-  }
+  std::string serialized;
+  proto_message.SerializeToString(&serialized);
+  return SetSerialized(key, std::move(serialized));
+}
 
-  vaf::String serialized(temp.c_str());
-  return Set(key, serialized);
+::vaf::Future<void> Persistency::SetAsync_StringValue(const vaf::String& key,
+                                                                 const ::vaf::String& value) noexcept{
+  protobuf::vaf::String proto_message;
+  protobuf::vaf::StringVafToProto(value, proto_message);
+  std::string serialized;
+  proto_message.SerializeToString(&serialized);
+  return SetAsyncSerialized(key, std::move(serialized));
+}
+
+::vaf::Result<void> Persistency::Scan_StringValues(const vaf::String& begin, const vaf::String& end,
+                                                          std::function<void(const vaf::String& key, const ::vaf::String& value)> callback) noexcept{
+  return ScanSerialized(begin, end, [this, &callback](std::string_view key, std::string_view serialized) {
+    protobuf::vaf::String deserialized;
+    if (deserialized.ParseFromArray(serialized.data(), static_cast<int>(serialized.size()))) {
+      ::vaf::String value;
+      protobuf::vaf::StringProtoToVaf(std::move(deserialized), value);
+      callback(vaf::String{key.data(), key.size()}, value);
+    } else {
+      logger_.LogWarn() <<  "Kvs scan skipped a value that does not deserialize for Persistency.";
+    }
+  });
 }
 ::vaf::Result<::test::MyArray> Persistency::Get_MyArrayValue(const vaf::String& key) noexcept{
   vaf::Result<::test::MyArray> ret_value{vaf::Result<::test::MyArray>::FromError(vaf::ErrorCode::kNotOk, "Get failed.")};
+  std::uint64_t cache_generation{0};
+  if (cache_values_) {
+    cache_generation = FindInCache(key, ret_value);
+    if (ret_value.HasValue()) {
+      return ret_value;
+    }
+  }
 
-  vaf::Result<vaf::String> result = Get(key);
+  std::string serialized;
+  vaf::Result<void> result = GetSerialized(key, serialized);
   if (result.HasValue()) {
     protobuf::test::MyArray deserialized;
-    if (!deserialized.ParseFromString(result.Value().c_str())) {
+    const bool parsed{deserialized.ParseFromString(serialized)};
+    if (!parsed) {
       vaf::OutputSyncStream{std::cerr} << "ERROR: Unable to deserialize!\n";
     }
     ::test::MyArray value;
-    protobuf::test::MyArrayProtoToVaf(deserialized, value);
-    ret_value = vaf::Result<::test::MyArray>::FromValue(value);
+    protobuf::test::MyArrayProtoToVaf(std::move(deserialized), value);
+    if (parsed && cache_values_) {
+      AddToCache(key, value, cache_generation);
+    }
+    ret_value = vaf::Result<::test::MyArray>::FromValue(std::move(value));
   } else {
     ret_value = vaf::Result<::test::MyArray>::FromError(vaf::Error(vaf::ErrorCode::kUnknown,"Kvs get failed."));
     logger_.LogWarn() <<  "Get failed for Persistency.";
@@ -475,14 +1068,32 @@ Persistency::~Persistency() {
                                                             const ::test::MyArray& value) noexcept{
   protobuf::test::MyArray proto_message;
   protobuf::test::MyArrayVafToProto(value, proto_message);
-  size_t nbytes = proto_message.ByteSizeLong();
-  std::string temp;
-  if (nbytes) {
-    proto_message.SerializeToString(&temp);
-  }
+  std::string serialized;
+  proto_message.SerializeToString(&serialized);
+  return SetSerialized(key, std::move(serialized));
+}
 
-  vaf::String serialized(temp.c_str());
-  return Set(key, serialized);
+::vaf::Future<void> Persistency::SetAsync_MyArrayValue(const vaf::String& key,
+                                                                 const ::test::MyArray& value) noexcept{
+  protobuf::test::MyArray proto_message;
+  protobuf::test::MyArrayVafToProto(value, proto_message);
+  std::string serialized;
+  proto_message.SerializeToString(&serialized);
+  return SetAsyncSerialized(key, std::move(serialized));
+}
+
+::vaf::Result<void> Persistency::Scan_MyArrayValues(const vaf::String& begin, const vaf::String& end,
+                                                          std::function<void(const vaf::String& key, const ::test::MyArray& value)> callback) noexcept{
+  return ScanSerialized(begin, end, [this, &callback](std::string_view key, std::string_view serialized) {
+    protobuf::test::MyArray deserialized;
+    if (deserialized.ParseFromArray(serialized.data(), static_cast<int>(serialized.size()))) {
+      ::test::MyArray value;
+      protobuf::test::MyArrayProtoToVaf(std::move(deserialized), value);
+      callback(vaf::String{key.data(), key.size()}, value);
+    } else {
+      logger_.LogWarn() <<  "Kvs scan skipped a value that does not deserialize for Persistency.";
+    }
+  });
 }
 
 
@@ -16,13 +16,31 @@
 #ifndef PERSISTENCY_PERSISTENCY_H
 #define PERSISTENCY_PERSISTENCY_H
 
+#include <any>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <map>
 #include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
 #include <utility>
+#include <vector>
 #include "vaf/container_types.h"
 #include "vaf/data_ptr.h"
 #include "vaf/result.h"
 #include "vaf/error_domain.h"
+#include "vaf/future.h"
+#include "vaf/internal/promise.h"
+#include "vaf/logging.h"
+#include "vaf/metrics.h"
+#include "leveldb/cache.h"
 #include "leveldb/db.h"
+#include "leveldb/filter_policy.h"
 #include "persistency/persistency_interface.h"
 #include "protobuf/vaf/protobuf_transformer.h"
 #include "protobuf/test/protobuf_transformer.h"
@@ -32,6 +50,9 @@ namespace persistency {
 
 class Persistency final : public ::persistency::PersistencyInterface {
  public:
+  // The block cache, bloom filter and write buffer of a file, kDefault keeps the ones of LevelDB
+  enum class TuningProfile { kDefault, kReadHeavy, kWriteHeavy, kTiny };
+
   explicit Persistency();
   ~Persistency() noexcept override;
   Persistency(const Persistency&) = delete;
@@ -39,40 +60,163 @@ class Persistency final : public ::persistency::PersistencyInterface {
   Persistency& operator=(const Persistency&) = delete;
   Persistency& operator=(Persistency&&) = delete;
 
-  ::vaf::Result<void> Open(const vaf::String& filename, bool sync_on_write) noexcept;
+  /*!
+   * \brief Opens the file.
+   * \param filename The path of the file
+   * \param sync_on_write Syncs each write to the storage
+   * \param group_commit_interval Collects all Set calls and writes them once per interval, if not zero
+   * \param cache_values Keeps the values read by the typed Get functions deserialized until they are set again
+   * \param tuning_profile The block cache, bloom filter and write buffer of the file
+   * \return Error if the file could not be opened
+   */
+  ::vaf::Result<void> Open(const vaf::String& filename, bool sync_on_write,
+                           std::chrono::microseconds group_commit_interval = std::chrono::microseconds{0},
+                           bool cache_values = false, TuningProfile tuning_profile = TuningProfile::kDefault) noexcept;
   ::vaf::Result<void> Set(const vaf::String& key, const vaf::String& value) noexcept;
+  ::vaf::Future<void> SetAsync(const vaf::String& key, const vaf::String& value) noexcept;
   ::vaf::Result<vaf::String> Get(const vaf::String& key) noexcept;
 
+  ::vaf::Result<void> BeginBatch() noexcept override;
+  ::vaf::Result<void> CommitBatch() noexcept override;
+  ::vaf::Result<void> Compact() noexcept override;
+
   ::vaf::Result<std::uint64_t> Get_UInt64Value(const vaf::String& key) noexcept override;
   ::vaf::Result<void> Set_UInt64Value(const vaf::String& key, const std::uint64_t& value) noexcept override;
+  ::vaf::Future<void> SetAsync_UInt64Value(const vaf::String& key, const std::uint64_t& value) noexcept override;
+  ::vaf::Result<void> Scan_UInt64Values(const vaf::String& begin, const vaf::String& end,
+                                           std::function<void(const vaf::String& key, const std::uint64_t& value)> callback) noexcept override;
   ::vaf::Result<std::uint32_t> Get_UInt32Value(const vaf::String& key) noexcept override;
   ::vaf::Result<void> Set_UInt32Value(const vaf::String& key, const std::uint32_t& value) noexcept override;
+  ::vaf::Future<void> SetAsync_UInt32Value(const vaf::String& key, const std::uint32_t& value) noexcept override;
+  ::vaf::Result<void> Scan_UInt32Values(const vaf::String& begin, const vaf::String& end,
+                                           std::function<void(const vaf::String& key, const std::uint32_t& value)> callback) noexcept override;
   ::vaf::Result<std::uint16_t> Get_UInt16Value(const vaf::String& key) noexcept override;
   ::vaf::Result<void> Set_UInt16Value(const vaf::String& key, const std::uint16_t& value) noexcept override;
+  ::vaf::Future<void> SetAsync_UInt16Value(const vaf::String& key, const std::uint16_t& value) noexcept override;
+  ::vaf::Result<void> Scan_UInt16Values(const vaf::String& begin, const vaf::String& end,
+                                           std::function<void(const vaf::String& key, const std::uint16_t& value)> callback) noexcept override;
   ::vaf::Result<std::uint8_t> Get_UInt8Value(const vaf::String& key) noexcept override;
   ::vaf::Result<void> Set_UInt8Value(const vaf::String& key, const std::uint8_t& value) noexcept override;
+  ::vaf::Future<void> SetAsync_UInt8Value(const vaf::String& key, const std::uint8_t& value) noexcept override;
+  ::vaf::Result<void> Scan_UInt8Values(const vaf::String& begin, const vaf::String& end,
+                                           std::function<void(const vaf::String& key, const std::uint8_t& value)> callback) noexcept override;
   ::vaf::Result<std::int64_t> Get_Int64Value(const vaf::String& key) noexcept override;
   ::vaf::Result<void> Set_Int64Value(const vaf::String& key, const std::int64_t& value) noexcept override;
+  ::vaf::Future<void> SetAsync_Int64Value(const vaf::String& key, const std::int64_t& value) noexcept override;
+  ::vaf::Result<void> Scan_Int64Values(const vaf::String& begin, const vaf::String& end,
+                                           std::function<void(const vaf::String& key, const std::int64_t& value)> callback) noexcept override;
   ::vaf::Result<std::int32_t> Get_Int32Value(const vaf::String& key) noexcept override;
   ::vaf::Result<void> Set_Int32Value(const vaf::String& key, const std::int32_t& value) noexcept override;
+  ::vaf::Future<void> SetAsync_Int32Value(const vaf::String& key, const std::int32_t& value) noexcept override;
+  ::vaf::Result<void> Scan_Int32Values(const vaf::String& begin, const vaf::String& end,
+                                           std::function<void(const vaf::String& key, const std::int32_t& value)> callback) noexcept override;
   ::vaf::Result<std::int16_t> Get_Int16Value(const vaf::String& key) noexcept override;
   ::vaf::Result<void> Set_Int16Value(const vaf::String& key, const std::int16_t& value) noexcept override;
+  ::vaf::Future<void> SetAsync_Int16Value(const vaf::String& key, const std::int16_t& value) noexcept override;
+  ::vaf::Result<void> Scan_Int16Values(const vaf::String& begin, const vaf::String& end,
+                                           std::function<void(const vaf::String& key, const std::int16_t& value)> callback) noexcept override;
   ::vaf::Result<std::int8_t> Get_Int8Value(const vaf::String& key) noexcept override;
   ::vaf::Result<void> Set_Int8Value(const vaf::String& key, const std::int8_t& value) noexcept override;
+  ::vaf::Future<void> SetAsync_Int8Value(const vaf::String& key, const std::int8_t& value) noexcept override;
+  ::vaf::Result<void> Scan_Int8Values(const vaf::String& begin, const vaf::String& end,
+                                           std::function<void(const vaf::String& key, const std::int8_t& value)> callback) noexcept override;
   ::vaf::Result<bool> Get_BoolValue(const vaf::String& key) noexcept override;
   ::vaf::Result<void> Set_BoolValue(const vaf::String& key, const bool& value) noexcept override;
+  ::vaf::Future<void> SetAsync_BoolValue(const vaf::String& key, const bool& value) noexcept override;
+  ::vaf::Result<void> Scan_BoolValues(const vaf::String& begin, const vaf::String& end,
+                                           std::function<void(const vaf::String& key, const bool& value)> callback) noexcept override;
   ::vaf::Result<float> Get_FloatValue(const vaf::String& key) noexcept override;
   ::vaf::Result<void> Set_FloatValue(const vaf::String& key, const float& value) noexcept override;
+  ::vaf::Future<void> SetAsync_FloatValue(const vaf::String& key, const float& value) noexcept override;
+  ::vaf::Result<void> Scan_FloatValues(const vaf::String& begin, const vaf::String& end,
+                                           std::function<void(const vaf::String& key, const float& value)> callback) noexcept override;
   ::vaf::Result<double> Get_DoubleValue(const vaf::String& key) noexcept override;
   ::vaf::Result<void> Set_DoubleValue(const vaf::String& key, const double& value) noexcept override;
+  ::vaf::Future<void> SetAsync_DoubleValue(const vaf::String& key, const double& value) noexcept override;
+  ::vaf::Result<void> Scan_DoubleValues(const vaf::String& begin, const vaf::String& end,
+                                           std::function<void(const vaf::String& key, const double& value)> callback) noexcept override;
   ::vaf::Result<::vaf::String> Get_StringValue(const vaf::String& key) noexcept override;
   ::vaf::Result<void> Set_StringValue(const vaf::String& key, const ::vaf::String& value) noexcept override;
+  ::vaf::Future<void> SetAsync_StringValue(const vaf::String& key, const ::vaf::String& value) noexcept override;
+  ::vaf::Result<void> Scan_StringValues(const vaf::String& begin, const vaf::String& end,
+                                           std::function<void(const vaf::String& key, const ::vaf::String& value)> callback) noexcept override;
   ::vaf::Result<::test::MyArray> Get_MyArrayValue(const vaf::String& key) noexcept override;
   ::vaf::Result<void> Set_MyArrayValue(const vaf::String& key, const ::test::MyArray& value) noexcept override;
+  ::vaf::Future<void> SetAsync_MyArrayValue(const vaf::String& key, const ::test::MyArray& value) noexcept override;
+  ::vaf::Result<void> Scan_MyArrayValues(const vaf::String& begin, const vaf::String& end,
+                                           std::function<void(const vaf::String& key, const ::test::MyArray& value)> callback) noexcept override;
  private:
+  /*!
+   * \brief Writes the collected values with one write batch and sets the promises of the queued ones.
+   * Waits for a running write of another thread first, so the values reach the file in the order they were set.
+   * The lock of mutex_ is released while writing, so Get and SetAsync do not wait for the storage.
+   */
+  leveldb::Status WritePending(std::unique_lock<std::mutex>& lock);
+  // Set, SetAsync and Get on the serialized values, keeping their length so embedded zero bytes are kept
+  ::vaf::Result<void> SetSerialized(std::string_view key, std::string&& value) noexcept;
+  ::vaf::Future<void> SetAsyncSerialized(std::string_view key, std::string&& value) noexcept;
+  ::vaf::Result<void> GetSerialized(std::string_view key, std::string& value) noexcept;
+  /*!
+   * \brief Calls visit with each key in [begin, end) and its serialized value in key order, without the lock of mutex_.
+   * One iterator reads the file sequentially, the values not yet written take the place of the ones in the file.
+   */
+  ::vaf::Result<void> ScanSerialized(std::string_view begin, std::string_view end,
+                                     const std::function<void(std::string_view key, std::string_view value)>& visit) noexcept;
+  void RunWriter();
+
+  // Returns the generation to pass to AddToCache, and the cached value if there is one
+  template <typename T>
+  std::uint64_t FindInCache(const vaf::String& key, ::vaf::Result<T>& value) {
+    std::lock_guard<std::mutex> lock{mutex_};
+    const auto cached = cache_.find(std::string{std::string_view{key}});
+    if (cached != cache_.end()) {
+      const T* cached_value{std::any_cast<T>(&cached->second)};
+      if (cached_value != nullptr) {
+        value = ::vaf::Result<T>::FromValue(T(*cached_value));
+      }
+    }
+    return cache_generation_;
+  }
+  // Skips the value if a Set came in since FindInCache, as it may be older than the file
+  template <typename T>
+  void AddToCache(const vaf::String& key, const T& value, std::uint64_t generation) {
+    std::lock_guard<std::mutex> lock{mutex_};
+    if (generation == cache_generation_) {
+      cache_[std::string{std::string_view{key}}] = value;
+    }
+  }
+
   leveldb::DB* db_{nullptr};
+  // Set by the tuning profile, they must outlive db_
+  std::unique_ptr<leveldb::Cache> block_cache_{};
+  std::unique_ptr<const leveldb::FilterPolicy> filter_policy_{};
   bool opened_{false};
   bool sync_on_write_{false};
+  vaf::Logger& logger_{vaf::CreateLogger("PER", "Persistency")};
+  // Latencies of the operations on the file, registered by Open
+  vaf::LatencyHistogram* get_latency_{nullptr};
+  vaf::LatencyHistogram* scan_latency_{nullptr};
+  vaf::LatencyHistogram* set_latency_{nullptr};
+  vaf::LatencyHistogram* commit_latency_{nullptr};
+
+  std::mutex mutex_{};
+  // Values set within a batch or group commit interval or queued by SetAsync, the latest per key
+  std::map<std::string, std::string, std::less<>> pending_{};
+  std::vector<vaf::internal::Promise<void>> pending_promises_{};
+  // Values taken from pending_ by the running write
+  std::map<std::string, std::string, std::less<>> in_flight_{};
+  bool writing_{false};
+  std::condition_variable write_done_condition_{};
+  bool batch_open_{false};
+  std::chrono::microseconds group_commit_interval_{0};
+  bool cache_values_{false};
+  // Deserialized values by key, a Set removes the value of its key and increments the generation
+  std::unordered_map<std::string, std::any> cache_{};
+  std::uint64_t cache_generation_{0};
+  // Writes the group commits and the values queued by SetAsync, started by Open or the first SetAsync
+  bool stop_writer_{false};
+  std::condition_variable writer_condition_{};
+  std::thread writer_thread_{};
 };
 
 } // namespace persistency
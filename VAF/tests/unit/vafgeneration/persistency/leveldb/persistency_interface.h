@@ -16,10 +16,14 @@
 #ifndef PERSISTENCY_PERSISTENCY_INTERFACE_H
 #define PERSISTENCY_PERSISTENCY_INTERFACE_H
 
+#include <functional>
+#include <utility>
+
 #include "vaf/container_types.h"
 #include "vaf/data_ptr.h"
 #include "vaf/result.h"
 #include "vaf/error_domain.h"
+#include "vaf/future.h"
 #include "test/impl_type_myarray.h"
 #include "test/impl_type_myenum.h"
 #include "test/impl_type_mymap.h"
@@ -37,32 +41,142 @@ class PersistencyInterface {
  public:
   virtual ~PersistencyInterface() = default;
 
+  /*!
+   * \brief Collects the following Set calls in memory until CommitBatch writes them with one write, and one sync,
+   * to the file. Get returns the collected values already.
+   */
+  virtual ::vaf::Result<void> BeginBatch() = 0;
+  /*!
+   * \brief Writes the values set since BeginBatch atomically to the file.
+   */
+  virtual ::vaf::Result<void> CommitBatch() = 0;
+  /*!
+   * \brief Compacts the whole file, so the overwritten values are dropped and the storage does less work in the
+   * background later. Blocks until the file is rewritten, so call it in an idle window of the module.
+   */
+  virtual ::vaf::Result<void> Compact() = 0;
+
+  // The Scan functions call the callback with each key in [begin, end) and its value, in key order, as of one
+  // snapshot of the file including the values not yet written. An empty end scans to the last key. The ScanPrefix
+  // functions scan the keys that start with prefix. A scanned range should hold values of the one type only.
+  // The SetAsync functions queue the value for a writer thread and return right away. The future is ready once the
+  // value is written, Get returns queued values already.
   virtual ::vaf::Result<std::uint64_t> Get_UInt64Value(const vaf::String& key) = 0;
   virtual ::vaf::Result<void> Set_UInt64Value(const vaf::String& key, const std::uint64_t& value) = 0;
+  virtual ::vaf::Future<void> SetAsync_UInt64Value(const vaf::String& key, const std::uint64_t& value) = 0;
+  virtual ::vaf::Result<void> Scan_UInt64Values(const vaf::String& begin, const vaf::String& end,
+                                                   std::function<void(const vaf::String& key, const std::uint64_t& value)> callback) = 0;
+  ::vaf::Result<void> ScanPrefix_UInt64Values(const vaf::String& prefix, std::function<void(const vaf::String& key, const std::uint64_t& value)> callback) {
+    return Scan_UInt64Values(prefix, PrefixEnd(prefix), std::move(callback));
+  }
   virtual ::vaf::Result<std::uint32_t> Get_UInt32Value(const vaf::String& key) = 0;
   virtual ::vaf::Result<void> Set_UInt32Value(const vaf::String& key, const std::uint32_t& value) = 0;
+  virtual ::vaf::Future<void> SetAsync_UInt32Value(const vaf::String& key, const std::uint32_t& value) = 0;
+  virtual ::vaf::Result<void> Scan_UInt32Values(const vaf::String& begin, const vaf::String& end,
+                                                   std::function<void(const vaf::String& key, const std::uint32_t& value)> callback) = 0;
+  ::vaf::Result<void> ScanPrefix_UInt32Values(const vaf::String& prefix, std::function<void(const vaf::String& key, const std::uint32_t& value)> callback) {
+    return Scan_UInt32Values(prefix, PrefixEnd(prefix), std::move(callback));
+  }
   virtual ::vaf::Result<std::uint16_t> Get_UInt16Value(const vaf::String& key) = 0;
   virtual ::vaf::Result<void> Set_UInt16Value(const vaf::String& key, const std::uint16_t& value) = 0;
+  virtual ::vaf::Future<void> SetAsync_UInt16Value(const vaf::String& key, const std::uint16_t& value) = 0;
+  virtual ::vaf::Result<void> Scan_UInt16Values(const vaf::String& begin, const vaf::String& end,
+                                                   std::function<void(const vaf::String& key, const std::uint16_t& value)> callback) = 0;
+  ::vaf::Result<void> ScanPrefix_UInt16Values(const vaf::String& prefix, std::function<void(const vaf::String& key, const std::uint16_t& value)> callback) {
+    return Scan_UInt16Values(prefix, PrefixEnd(prefix), std::move(callback));
+  }
   virtual ::vaf::Result<std::uint8_t> Get_UInt8Value(const vaf::String& key) = 0;
   virtual ::vaf::Result<void> Set_UInt8Value(const vaf::String& key, const std::uint8_t& value) = 0;
+  virtual ::vaf::Future<void> SetAsync_UInt8Value(const vaf::String& key, const std::uint8_t& value) = 0;
+  virtual ::vaf::Result<void> Scan_UInt8Values(const vaf::String& begin, const vaf::String& end,
+                                                   std::function<void(const vaf::String& key, const std::uint8_t& value)> callback) = 0;
+  ::vaf::Result<void> ScanPrefix_UInt8Values(const vaf::String& prefix, std::function<void(const vaf::String& key, const std::uint8_t& value)> callback) {
+    return Scan_UInt8Values(prefix, PrefixEnd(prefix), std::move(callback));
+  }
   virtual ::vaf::Result<std::int64_t> Get_Int64Value(const vaf::String& key) = 0;
   virtual ::vaf::Result<void> Set_Int64Value(const vaf::String& key, const std::int64_t& value) = 0;
+  virtual ::vaf::Future<void> SetAsync_Int64Value(const vaf::String& key, const std::int64_t& value) = 0;
+  virtual ::vaf::Result<void> Scan_Int64Values(const vaf::String& begin, const vaf::String& end,
+                                                   std::function<void(const vaf::String& key, const std::int64_t& value)> callback) = 0;
+  ::vaf::Result<void> ScanPrefix_Int64Values(const vaf::String& prefix, std::function<void(const vaf::String& key, const std::int64_t& value)> callback) {
+    return Scan_Int64Values(prefix, PrefixEnd(prefix), std::move(callback));
+  }
   virtual ::vaf::Result<std::int32_t> Get_Int32Value(const vaf::String& key) = 0;
   virtual ::vaf::Result<void> Set_Int32Value(const vaf::String& key, const std::int32_t& value) = 0;
+  virtual ::vaf::Future<void> SetAsync_Int32Value(const vaf::String& key, const std::int32_t& value) = 0;
+  virtual ::vaf::Result<void> Scan_Int32Values(const vaf::String& begin, const vaf::String& end,
+                                                   std::function<void(const vaf::String& key, const std::int32_t& value)> callback) = 0;
+  ::vaf::Result<void> ScanPrefix_Int32Values(const vaf::String& prefix, std::function<void(const vaf::String& key, const std::int32_t& value)> callback) {
+    return Scan_Int32Values(prefix, PrefixEnd(prefix), std::move(callback));
+  }
   virtual ::vaf::Result<std::int16_t> Get_Int16Value(const vaf::String& key) = 0;
   virtual ::vaf::Result<void> Set_Int16Value(const vaf::String& key, const std::int16_t& value) = 0;
+  virtual ::vaf::Future<void> SetAsync_Int16Value(const vaf::String& key, const std::int16_t& value) = 0;
+  virtual ::vaf::Result<void> Scan_Int16Values(const vaf::String& begin, const vaf::String& end,
+                                                   std::function<void(const vaf::String& key, const std::int16_t& value)> callback) = 0;
+  ::vaf::Result<void> ScanPrefix_Int16Values(const vaf::String& prefix, std::function<void(const vaf::String& key, const std::int16_t& value)> callback) {
+    return Scan_Int16Values(prefix, PrefixEnd(prefix), std::move(callback));
+  }
   virtual ::vaf::Result<std::int8_t> Get_Int8Value(const vaf::String& key) = 0;
   virtual ::vaf::Result<void> Set_Int8Value(const vaf::String& key, const std::int8_t& value) = 0;
+  virtual ::vaf::Future<void> SetAsync_Int8Value(const vaf::String& key, const std::int8_t& value) = 0;
+  virtual ::vaf::Result<void> Scan_Int8Values(const vaf::String& begin, const vaf::String& end,
+                                                   std::function<void(const vaf::String& key, const std::int8_t& value)> callback) = 0;
+  ::vaf::Result<void> ScanPrefix_Int8Values(const vaf::String& prefix, std::function<void(const vaf::String& key, const std::int8_t& value)> callback) {
+    return Scan_Int8Values(prefix, PrefixEnd(prefix), std::move(callback));
+  }
   virtual ::vaf::Result<bool> Get_BoolValue(const vaf::String& key) = 0;
   virtual ::vaf::Result<void> Set_BoolValue(const vaf::String& key, const bool& value) = 0;
+  virtual ::vaf::Future<void> SetAsync_BoolValue(const vaf::String& key, const bool& value) = 0;
+  virtual ::vaf::Result<void> Scan_BoolValues(const vaf::String& begin, const vaf::String& end,
+                                                   std::function<void(const vaf::String& key, const bool& value)> callback) = 0;
+  ::vaf::Result<void> ScanPrefix_BoolValues(const vaf::String& prefix, std::function<void(const vaf::String& key, const bool& value)> callback) {
+    return Scan_BoolValues(prefix, PrefixEnd(prefix), std::move(callback));
+  }
   virtual ::vaf::Result<float> Get_FloatValue(const vaf::String& key) = 0;
   virtual ::vaf::Result<void> Set_FloatValue(const vaf::String& key, const float& value) = 0;
+  virtual ::vaf::Future<void> SetAsync_FloatValue(const vaf::String& key, const float& value) = 0;
+  virtual ::vaf::Result<void> Scan_FloatValues(const vaf::String& begin, const vaf::String& end,
+                                                   std::function<void(const vaf::String& key, const float& value)> callback) = 0;
+  ::vaf::Result<void> ScanPrefix_FloatValues(const vaf::String& prefix, std::function<void(const vaf::String& key, const float& value)> callback) {
+    return Scan_FloatValues(prefix, PrefixEnd(prefix), std::move(callback));
+  }
   virtual ::vaf::Result<double> Get_DoubleValue(const vaf::String& key) = 0;
   virtual ::vaf::Result<void> Set_DoubleValue(const vaf::String& key, const double& value) = 0;
+  virtual ::vaf::Future<void> SetAsync_DoubleValue(const vaf::String& key, const double& value) = 0;
+  virtual ::vaf::Result<void> Scan_DoubleValues(const vaf::String& begin, const vaf::String& end,
+                                                   std::function<void(const vaf::String& key, const double& value)> callback) = 0;
+  ::vaf::Result<void> ScanPrefix_DoubleValues(const vaf::String& prefix, std::function<void(const vaf::String& key, const double& value)> callback) {
+    return Scan_DoubleValues(prefix, PrefixEnd(prefix), std::move(callback));
+  }
   virtual ::vaf::Result<::vaf::String> Get_StringValue(const vaf::String& key) = 0;
   virtual ::vaf::Result<void> Set_StringValue(const vaf::String& key, const ::vaf::String& value) = 0;
+  virtual ::vaf::Future<void> SetAsync_StringValue(const vaf::String& key, const ::vaf::String& value) = 0;
+  virtual ::vaf::Result<void> Scan_StringValues(const vaf::String& begin, const vaf::String& end,
+                                                   std::function<void(const vaf::String& key, const ::vaf::String& value)> callback) = 0;
+  ::vaf::Result<void> ScanPrefix_StringValues(const vaf::String& prefix, std::function<void(const vaf::String& key, const ::vaf::String& value)> callback) {
+    return Scan_StringValues(prefix, PrefixEnd(prefix), std::move(callback));
+  }
   virtual ::vaf::Result<::test::MyArray> Get_MyArrayValue(const vaf::String& key) = 0;
   virtual ::vaf::Result<void> Set_MyArrayValue(const vaf::String& key, const ::test::MyArray& value) = 0;
+  virtual ::vaf::Future<void> SetAsync_MyArrayValue(const vaf::String& key, const ::test::MyArray& value) = 0;
+  virtual ::vaf::Result<void> Scan_MyArrayValues(const vaf::String& begin, const vaf::String& end,
+                                                   std::function<void(const vaf::String& key, const ::test::MyArray& value)> callback) = 0;
+  ::vaf::Result<void> ScanPrefix_MyArrayValues(const vaf::String& prefix, std::function<void(const vaf::String& key, const ::test::MyArray& value)> callback) {
+    return Scan_MyArrayValues(prefix, PrefixEnd(prefix), std::move(callback));
+  }
+
+ protected:
+  // The smallest key after all keys that start with prefix, empty if there is none
+  static vaf::String PrefixEnd(vaf::String prefix) {
+    while (!prefix.empty() && (static_cast<unsigned char>(prefix.back()) == 0xFFU)) {
+      prefix.pop_back();
+    }
+    if (!prefix.empty()) {
+      prefix.back() = static_cast<char>(static_cast<unsigned char>(prefix.back()) + 1U);
+    }
+    return prefix;
+  }
 };
 
 } // namespace persistency
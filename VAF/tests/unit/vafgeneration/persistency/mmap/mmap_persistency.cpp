@@ -0,0 +1,1092 @@
+/*!********************************************************************************************************************
+ *  COPYRIGHT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  Copyright (c) 2024-2026 by Vector Informatik GmbH. All rights reserved.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -----------------------------------------------------------------------------------------------------------------*/
+/*!        \file  mmap_persistency.cpp
+ *         \brief
+ *
+ *********************************************************************************************************************/
+
+#include "persistency/mmap_persistency.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <cstring>
+
+#include "vaf/error_domain.h"
+#include "vaf/internal/promise.h"
+#include "protobuf_basetypes.pb.h"
+
+namespace persistency {
+
+namespace {
+
+constexpr std::array<char, 8> kMagic{'V', 'A', 'F', 'K', 'V', 'L', 'O', 'G'};
+constexpr std::size_t kInitialCapacity{64U * 1024U};
+// Set in the key size of a record that is followed by more records of the same batch
+constexpr std::uint32_t kBatchContinues{0x80000000U};
+
+struct RecordHeader {
+  std::uint32_t checksum;
+  std::uint32_t key_size;
+  std::uint32_t value_size;
+};
+
+constexpr std::array<std::uint32_t, 256> MakeCrcTable() {
+  std::array<std::uint32_t, 256> table{};
+  for (std::uint32_t i{0}; i < 256U; ++i) {
+    std::uint32_t crc{i};
+    for (int bit{0}; bit < 8; ++bit) {
+      crc = ((crc & 1U) != 0U) ? ((crc >> 1U) ^ 0xEDB88320U) : (crc >> 1U);
+    }
+    table[i] = crc;
+  }
+  return table;
+}
+
+constexpr std::array<std::uint32_t, 256> kCrcTable{MakeCrcTable()};
+
+std::uint32_t Crc32(std::uint32_t crc, const char* data, std::size_t size) {
+  for (std::size_t i{0}; i < size; ++i) {
+    crc = kCrcTable[(crc ^ static_cast<std::uint8_t>(data[i])) & 0xFFU] ^ (crc >> 8U);
+  }
+  return crc;
+}
+
+// Covers the sizes, the key and the value, so a record that was written partly does not match
+std::uint32_t Checksum(const RecordHeader& header, const char* data) {
+  std::uint32_t crc{0xFFFFFFFFU};
+  crc = Crc32(crc, reinterpret_cast<const char*>(&header.key_size), sizeof(header.key_size));
+  crc = Crc32(crc, reinterpret_cast<const char*>(&header.value_size), sizeof(header.value_size));
+  crc = Crc32(crc, data, (header.key_size & ~kBatchContinues) + std::size_t{header.value_size});
+  return ~crc;
+}
+
+std::size_t RecordSize(std::size_t key_size, std::size_t value_size) {
+  return sizeof(RecordHeader) + key_size + value_size;
+}
+
+// Writes one record at the position and returns the position after it
+std::size_t WriteRecord(char* memory, std::size_t position, std::string_view key, std::string_view value,
+                        bool batch_continues) {
+  RecordHeader header{0U, static_cast<std::uint32_t>(key.size()), static_cast<std::uint32_t>(value.size())};
+  if (batch_continues) {
+    header.key_size |= kBatchContinues;
+  }
+  char* data{memory + position + sizeof(RecordHeader)};
+  std::memcpy(data, key.data(), key.size());
+  std::memcpy(data + key.size(), value.data(), value.size());
+  header.checksum = Checksum(header, data);
+  std::memcpy(memory + position, &header, sizeof(RecordHeader));
+  return position + RecordSize(key.size(), value.size());
+}
+
+vaf::Error SystemError(const char* call, const vaf::String& filename) {
+  return vaf::Error{vaf::ErrorCode::kUnknown, vaf::String{call} + " failed for kvs file " + filename + ": " +
+                                                  std::strerror(errno)};
+}
+
+// Syncs the pages that contain the range
+bool SyncRange(char* memory, std::size_t begin, std::size_t end) {
+  const std::size_t page_size{static_cast<std::size_t>(sysconf(_SC_PAGESIZE))};
+  const std::size_t page_begin{begin / page_size * page_size};
+  return msync(memory + page_begin, end - page_begin, MS_SYNC) == 0;
+}
+
+}  // namespace
+
+MmapPersistency::MmapPersistency() {
+}
+
+MmapPersistency::~MmapPersistency() {
+  if (opened_) {
+    std::lock_guard<std::mutex> lock{mutex_};
+    Records records{pending_.begin(), pending_.end()};
+    if (!records.empty() && !Append(records).HasValue()) {
+      logger_.LogWarn() <<  "Kvs write of pending values failed for MmapPersistency.";
+    }
+  }
+  Close();
+}
+
+::vaf::Result<void> MmapPersistency::Open(const vaf::String& filename, bool sync_on_write) noexcept {
+  VAF_TRACE_SCOPE("vaf.persistency", "Open", "MmapPersistency");
+  filename_ = filename;
+  get_latency_ = &vaf::GetLatencyHistogram("vaf_persistency_latency_seconds",
+                                         vaf::MetricLabels{ {"file", filename}, {"operation", "get"} });
+  scan_latency_ = &vaf::GetLatencyHistogram("vaf_persistency_latency_seconds",
+                                         vaf::MetricLabels{ {"file", filename}, {"operation", "scan"} });
+  set_latency_ = &vaf::GetLatencyHistogram("vaf_persistency_latency_seconds",
+                                         vaf::MetricLabels{ {"file", filename}, {"operation", "set"} });
+  commit_latency_ = &vaf::GetLatencyHistogram("vaf_persistency_latency_seconds",
+                                         vaf::MetricLabels{ {"file", filename}, {"operation", "commit"} });
+  sync_on_write_ = sync_on_write;
+
+  fd_ = open(filename.c_str(), O_CREAT | O_RDWR, S_IRUSR | S_IWUSR);
+  if (fd_ < 0) {
+    vaf::Error error{SystemError("open", filename)};
+    logger_.LogWarn() <<  "Error opening the kvs file for MmapPersistency.";
+    return vaf::Result<void>{error};
+  }
+  struct stat file_stat{};
+  if (fstat(fd_, &file_stat) != 0) {
+    vaf::Error error{SystemError("fstat", filename)};
+    Close();
+    return vaf::Result<void>{error};
+  }
+  capacity_ = static_cast<std::size_t>(file_stat.st_size);
+  const bool created{capacity_ == 0};
+  if (created) {
+    capacity_ = kInitialCapacity;
+    if (ftruncate(fd_, static_cast<off_t>(capacity_)) != 0) {
+      vaf::Error error{SystemError("ftruncate", filename)};
+      Close();
+      return vaf::Result<void>{error};
+    }
+  }
+  void* memory{mmap(nullptr, capacity_, PROT_READ | PROT_WRITE, MAP_SHARED, fd_, 0)};
+  if (memory == MAP_FAILED) {
+    vaf::Error error{SystemError("mmap", filename)};
+    Close();
+    return vaf::Result<void>{error};
+  }
+  memory_ = static_cast<char*>(memory);
+
+  if (created) {
+    std::memcpy(memory_, kMagic.data(), kMagic.size());
+  } else if ((capacity_ < kMagic.size()) || (std::memcmp(memory_, kMagic.data(), kMagic.size()) != 0)) {
+    Close();
+    logger_.LogWarn() <<  "Kvs file is no key value log for MmapPersistency.";
+    return vaf::Result<void>::FromError(vaf::ErrorCode::kUnknown, "Kvs file is no key value log.");
+  }
+
+  RebuildIndex();
+  // Clears what follows the last complete batch, so that no record of an incomplete batch or part of a cut off
+  // record can follow a record appended later
+  if (std::any_of(memory_ + end_, memory_ + capacity_, [](char byte) { return byte != 0; })) {
+    std::memset(memory_ + end_, 0, capacity_ - end_);
+  }
+  opened_ = true;
+  return vaf::Result<void>::FromValue();
+};
+
+::vaf::Result<void> MmapPersistency::Set(const vaf::String& key, const vaf::String& value) noexcept{
+  return SetSerialized(key, value);
+};
+
+::vaf::Result<vaf::String> MmapPersistency::Get(const vaf::String& key) noexcept{
+  vaf::String value;
+  vaf::Result<void> result{Read(key, [&value](const char* data, std::size_t size) { value.assign(data, size); })};
+  if (!result.HasValue()) {
+    return vaf::Result<vaf::String>{result.Error()};
+  }
+  return vaf::Result<vaf::String>::FromValue(std::move(value));
+};
+
+::vaf::Result<void> MmapPersistency::BeginBatch() noexcept {
+  vaf::Result<void> ret_value{vaf::Result<void>::FromError(vaf::ErrorCode::kNotOk, "Kvs not opened.")};
+  if (opened_) {
+    std::lock_guard<std::mutex> lock{mutex_};
+    batch_open_ = true;
+    ret_value = vaf::Result<void>::FromValue();
+  } else {
+    logger_.LogWarn() <<  "Kvs not opened for MmapPersistency.";
+  }
+  return ret_value;
+}
+
+::vaf::Result<void> MmapPersistency::CommitBatch() noexcept {
+  VAF_TRACE_SCOPE("vaf.persistency", "Commit", "MmapPersistency");
+  vaf::LatencyHistogram::Timer latency_timer{commit_latency_};
+  vaf::Result<void> ret_value{vaf::Result<void>::FromError(vaf::ErrorCode::kNotOk, "Kvs not opened.")};
+  if (opened_) {
+    std::lock_guard<std::mutex> lock{mutex_};
+    batch_open_ = false;
+    Records records{pending_.begin(), pending_.end()};
+    ret_value = records.empty() ? vaf::Result<void>::FromValue() : Append(records);
+    // Failed values are dropped like a failed single write
+    pending_.clear();
+    if (!ret_value.HasValue()) {
+      logger_.LogWarn() <<  "Kvs batch write failed for MmapPersistency.";
+    }
+  } else {
+    logger_.LogWarn() <<  "Kvs not opened for MmapPersistency.";
+  }
+  return ret_value;
+}
+
+::vaf::Result<void> MmapPersistency::Compact() noexcept {
+  VAF_TRACE_SCOPE("vaf.persistency", "Compact", "MmapPersistency");
+  vaf::Result<void> ret_value{vaf::Result<void>::FromError(vaf::ErrorCode::kNotOk, "Kvs not opened.")};
+  if (opened_) {
+    // Writes the latest records to a new file of the same size, like a full log does
+    std::lock_guard<std::mutex> lock{mutex_};
+    ret_value = Rewrite(capacity_);
+    if (!ret_value.HasValue()) {
+      logger_.LogWarn() <<  "Kvs compaction failed for MmapPersistency.";
+    }
+  } else {
+    logger_.LogWarn() <<  "Kvs not opened for MmapPersistency.";
+  }
+  return ret_value;
+}
+
+::vaf::Result<void> MmapPersistency::SetSerialized(std::string_view key, std::string_view value) noexcept{
+  VAF_TRACE_SCOPE("vaf.persistency", "Set", "MmapPersistency");
+  vaf::LatencyHistogram::Timer latency_timer{set_latency_};
+  vaf::Result<void> ret_value{vaf::Result<void>::FromError(vaf::ErrorCode::kNotOk, "Kvs not opened.")};
+  if (opened_) {
+    std::lock_guard<std::mutex> lock{mutex_};
+    if (batch_open_) {
+      pending_.insert_or_assign(std::string{key}, std::string{value});
+      ret_value = vaf::Result<void>::FromValue();
+    } else {
+      ret_value = Append(Records{std::make_pair(key, value)});
+    }
+    if (!ret_value.HasValue()) {
+      logger_.LogWarn() <<  "Kvs set failed for MmapPersistency.";
+    }
+  } else {
+    logger_.LogWarn() <<  "Kvs not opened for MmapPersistency.";
+  }
+  return ret_value;
+};
+
+::vaf::Future<void> MmapPersistency::SetAsyncSerialized(std::string_view key, std::string_view value) noexcept{
+  VAF_TRACE_SCOPE("vaf.persistency", "SetAsync", "MmapPersistency");
+  vaf::internal::Promise<void> promise{};
+  vaf::Result<void> result{SetSerialized(key, value)};
+  if (result.HasValue()) {
+    promise.set_value();
+  } else {
+    promise.SetError(result.Error());
+  }
+  // Taken after the result, so the future keeps it without a shared state
+  return promise.get_future();
+};
+
+::vaf::Result<void> MmapPersistency::Append(const Records& records) {
+  std::size_t size{0};
+  for (const auto& record : records) {
+    size += RecordSize(record.first.size(), record.second.size());
+  }
+  if (end_ + size > capacity_) {
+    std::size_t live_size{kMagic.size() + size};
+    for (const auto& entry : index_) {
+      live_size += RecordSize(entry.first.size(), entry.second.size);
+    }
+    std::size_t capacity{kInitialCapacity};
+    while (capacity < 2U * live_size) {
+      capacity *= 2U;
+    }
+    vaf::Result<void> rewritten{Rewrite(capacity)};
+    if (!rewritten.HasValue()) {
+      return rewritten;
+    }
+  }
+
+  const std::size_t begin{end_};
+  std::size_t position{begin};
+  for (std::size_t i{0}; i < records.size(); ++i) {
+    const auto& record = records[i];
+    const std::size_t value_offset{position + sizeof(RecordHeader) + record.first.size()};
+    position = WriteRecord(memory_, position, record.first, record.second, i + 1U < records.size());
+    index_.insert_or_assign(std::string{record.first}, Location{value_offset, record.second.size()});
+  }
+  end_ = position;
+  if (sync_on_write_ && !SyncRange(memory_, begin, end_)) {
+    return vaf::Result<void>{SystemError("msync", filename_)};
+  }
+  return vaf::Result<void>::FromValue();
+}
+
+::vaf::Result<void> MmapPersistency::Rewrite(std::size_t capacity) {
+  VAF_TRACE_SCOPE("vaf.persistency", "Rewrite", "MmapPersistency");
+  const vaf::String temp_filename{filename_ + ".tmp"};
+  const int fd{open(temp_filename.c_str(), O_CREAT | O_RDWR | O_TRUNC, S_IRUSR | S_IWUSR)};
+  if (fd < 0) {
+    return vaf::Result<void>{SystemError("open", temp_filename)};
+  }
+  void* memory{MAP_FAILED};
+  if (ftruncate(fd, static_cast<off_t>(capacity)) == 0) {
+    memory = mmap(nullptr, capacity, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  }
+  if (memory == MAP_FAILED) {
+    vaf::Error error{SystemError("mmap", temp_filename)};
+    close(fd);
+    unlink(temp_filename.c_str());
+    return vaf::Result<void>{error};
+  }
+
+  char* new_memory{static_cast<char*>(memory)};
+  std::memcpy(new_memory, kMagic.data(), kMagic.size());
+  std::size_t position{kMagic.size()};
+  std::map<std::string, Location, std::less<>> index;
+  for (const auto& entry : index_) {
+    const std::size_t value_offset{position + sizeof(RecordHeader) + entry.first.size()};
+    position = WriteRecord(new_memory, position, entry.first,
+                           std::string_view{memory_ + entry.second.offset, entry.second.size}, false);
+    index.emplace(entry.first, Location{value_offset, entry.second.size});
+  }
+  // The new file must be complete on the storage before it replaces the old one
+  const bool synced{SyncRange(new_memory, 0, position)};
+  if (!synced || (rename(temp_filename.c_str(), filename_.c_str()) != 0)) {
+    vaf::Error error{SystemError(synced ? "rename" : "msync", temp_filename)};
+    munmap(new_memory, capacity);
+    close(fd);
+    unlink(temp_filename.c_str());
+    return vaf::Result<void>{error};
+  }
+
+  munmap(memory_, capacity_);
+  close(fd_);
+  fd_ = fd;
+  memory_ = new_memory;
+  capacity_ = capacity;
+  end_ = position;
+  index_ = std::move(index);
+  return vaf::Result<void>::FromValue();
+}
+
+void MmapPersistency::RebuildIndex() {
+  std::vector<std::pair<std::string, Location>> batch;
+  std::size_t position{kMagic.size()};
+  end_ = position;
+  while (capacity_ - position >= sizeof(RecordHeader)) {
+    RecordHeader header{};
+    std::memcpy(&header, memory_ + position, sizeof(RecordHeader));
+    const std::size_t key_size{header.key_size & ~kBatchContinues};
+    const std::size_t value_size{header.value_size};
+    if ((capacity_ - position - sizeof(RecordHeader) < key_size + value_size) ||
+        (Checksum(header, memory_ + position + sizeof(RecordHeader)) != header.checksum)) {
+      break;
+    }
+    const char* key{memory_ + position + sizeof(RecordHeader)};
+    batch.emplace_back(std::string{key, key_size}, Location{position + sizeof(RecordHeader) + key_size, value_size});
+    position += RecordSize(key_size, value_size);
+    if ((header.key_size & kBatchContinues) == 0U) {
+      for (auto& entry : batch) {
+        index_.insert_or_assign(std::move(entry.first), entry.second);
+      }
+      batch.clear();
+      end_ = position;
+    }
+  }
+}
+
+void MmapPersistency::Close() noexcept {
+  if (memory_ != nullptr) {
+    munmap(memory_, capacity_);
+    memory_ = nullptr;
+  }
+  if (fd_ >= 0) {
+    close(fd_);
+    fd_ = -1;
+  }
+  opened_ = false;
+}
+
+::vaf::Result<std::uint64_t> MmapPersistency::Get_UInt64Value(const vaf::String& key) noexcept{
+  vaf::Result<std::uint64_t> ret_value{vaf::Result<std::uint64_t>::FromError(vaf::ErrorCode::kNotOk, "Get failed.")};
+
+  protobuf::basetypes::UInt64 deserialized;
+  vaf::Result<void> result = Read(key, [&deserialized](const char* data, std::size_t size) {
+    if (!deserialized.ParseFromArray(data, static_cast<int>(size))) {
+      vaf::OutputSyncStream{std::cerr} << "ERROR: Unable to deserialize!\n";
+    }
+  });
+  if (result.HasValue()) {
+    ret_value = vaf::Result<std::uint64_t>::FromValue(deserialized.vaf_value_internal());
+  } else {
+    ret_value = vaf::Result<std::uint64_t>::FromError(vaf::Error(vaf::ErrorCode::kUnknown,"Kvs get failed."));
+    logger_.LogWarn() <<  "Get failed for MmapPersistency.";
+  }
+
+  return ret_value;
+}
+
+::vaf::Result<void> MmapPersistency::Set_UInt64Value(const vaf::String& key, const std::uint64_t& value) noexcept{
+  protobuf::basetypes::UInt64 proto_message;
+  proto_message.set_vaf_value_internal(value);
+  std::string serialized;
+  proto_message.SerializeToString(&serialized);
+  return SetSerialized(key, serialized);
+}
+
+::vaf::Future<void> MmapPersistency::SetAsync_UInt64Value(const vaf::String& key, const std::uint64_t& value) noexcept{
+  protobuf::basetypes::UInt64 proto_message;
+  proto_message.set_vaf_value_internal(value);
+  std::string serialized;
+  proto_message.SerializeToString(&serialized);
+  return SetAsyncSerialized(key, serialized);
+}
+
+::vaf::Result<void> MmapPersistency::Scan_UInt64Values(const vaf::String& begin, const vaf::String& end,
+                                                          std::function<void(const vaf::String& key, const std::uint64_t& value)> callback) noexcept{
+  // The values are parsed under the lock and passed on without it, as the callback may set values
+  std::vector<std::pair<vaf::String, std::uint64_t>> values{};
+  vaf::Result<void> result = ReadRange(begin, end, [this, &values](std::string_view key, const char* data, std::size_t size) {
+    protobuf::basetypes::UInt64 deserialized;
+    if (deserialized.ParseFromArray(data, static_cast<int>(size))) {
+      values.emplace_back(vaf::String{key.data(), key.size()}, deserialized.vaf_value_internal());
+    } else {
+      logger_.LogWarn() <<  "Kvs scan skipped a value that does not deserialize for MmapPersistency.";
+    }
+  });
+  for (const auto& value : values) {
+    callback(value.first, value.second);
+  }
+  return result;
+}
+::vaf::Result<std::uint32_t> MmapPersistency::Get_UInt32Value(const vaf::String& key) noexcept{
+  vaf::Result<std::uint32_t> ret_value{vaf::Result<std::uint32_t>::FromError(vaf::ErrorCode::kNotOk, "Get failed.")};
+
+  protobuf::basetypes::UInt32 deserialized;
+  vaf::Result<void> result = Read(key, [&deserialized](const char* data, std::size_t size) {
+    if (!deserialized.ParseFromArray(data, static_cast<int>(size))) {
+      vaf::OutputSyncStream{std::cerr} << "ERROR: Unable to deserialize!\n";
+    }
+  });
+  if (result.HasValue()) {
+    ret_value = vaf::Result<std::uint32_t>::FromValue(deserialized.vaf_value_internal());
+  } else {
+    ret_value = vaf::Result<std::uint32_t>::FromError(vaf::Error(vaf::ErrorCode::kUnknown,"Kvs get failed."));
+    logger_.LogWarn() <<  "Get failed for MmapPersistency.";
+  }
+
+  return ret_value;
+}
+
+::vaf::Result<void> MmapPersistency::Set_UInt32Value(const vaf::String& key, const std::uint32_t& value) noexcept{
+  protobuf::basetypes::UInt32 proto_message;
+  proto_message.set_vaf_value_internal(value);
+  std::string serialized;
+  proto_message.SerializeToString(&serialized);
+  return SetSerialized(key, serialized);
+}
+
+::vaf::Future<void> MmapPersistency::SetAsync_UInt32Value(const vaf::String& key, const std::uint32_t& value) noexcept{
+  protobuf::basetypes::UInt32 proto_message;
+  proto_message.set_vaf_value_internal(value);
+  std::string serialized;
+  proto_message.SerializeToString(&serialized);
+  return SetAsyncSerialized(key, serialized);
+}
+
+::vaf::Result<void> MmapPersistency::Scan_UInt32Values(const vaf::String& begin, const vaf::String& end,
+                                                          std::function<void(const vaf::String& key, const std::uint32_t& value)> callback) noexcept{
+  // The values are parsed under the lock and passed on without it, as the callback may set values
+  std::vector<std::pair<vaf::String, std::uint32_t>> values{};
+  vaf::Result<void> result = ReadRange(begin, end, [this, &values](std::string_view key, const char* data, std::size_t size) {
+    protobuf::basetypes::UInt32 deserialized;
+    if (deserialized.ParseFromArray(data, static_cast<int>(size))) {
+      values.emplace_back(vaf::String{key.data(), key.size()}, deserialized.vaf_value_internal());
+    } else {
+      logger_.LogWarn() <<  "Kvs scan skipped a value that does not deserialize for MmapPersistency.";
+    }
+  });
+  for (const auto& value : values) {
+    callback(value.first, value.second);
+  }
+  return result;
+}
+::vaf::Result<std::uint16_t> MmapPersistency::Get_UInt16Value(const vaf::String& key) noexcept{
+  vaf::Result<std::uint16_t> ret_value{vaf::Result<std::uint16_t>::FromError(vaf::ErrorCode::kNotOk, "Get failed.")};
+
+  protobuf::basetypes::UInt16 deserialized;
+  vaf::Result<void> result = Read(key, [&deserialized](const char* data, std::size_t size) {
+    if (!deserialized.ParseFromArray(data, static_cast<int>(size))) {
+      vaf::OutputSyncStream{std::cerr} << "ERROR: Unable to deserialize!\n";
+    }
+  });
+  if (result.HasValue()) {
+    ret_value = vaf::Result<std::uint16_t>::FromValue(deserialized.vaf_value_internal());
+  } else {
+    ret_value = vaf::Result<std::uint16_t>::FromError(vaf::Error(vaf::ErrorCode::kUnknown,"Kvs get failed."));
+    logger_.LogWarn() <<  "Get failed for MmapPersistency.";
+  }
+
+  return ret_value;
+}
+
+::vaf::Result<void> MmapPersistency::Set_UInt16Value(const vaf::String& key, const std::uint16_t& value) noexcept{
+  protobuf::basetypes::UInt16 proto_message;
+  proto_message.set_vaf_value_internal(value);
+  std::string serialized;
+  proto_message.SerializeToString(&serialized);
+  return SetSerialized(key, serialized);
+}
+
+::vaf::Future<void> MmapPersistency::SetAsync_UInt16Value(const vaf::String& key, const std::uint16_t& value) noexcept{
+  protobuf::basetypes::UInt16 proto_message;
+  proto_message.set_vaf_value_internal(value);
+  std::string serialized;
+  proto_message.SerializeToString(&serialized);
+  return SetAsyncSerialized(key, serialized);
+}
+
+::vaf::Result<void> MmapPersistency::Scan_UInt16Values(const vaf::String& begin, const vaf::String& end,
+                                                          std::function<void(const vaf::String& key, const std::uint16_t& value)> callback) noexcept{
+  // The values are parsed under the lock and passed on without it, as the callback may set values
+  std::vector<std::pair<vaf::String, std::uint16_t>> values{};
+  vaf::Result<void> result = ReadRange(begin, end, [this, &values](std::string_view key, const char* data, std::size_t size) {
+    protobuf::basetypes::UInt16 deserialized;
+    if (deserialized.ParseFromArray(data, static_cast<int>(size))) {
+      values.emplace_back(vaf::String{key.data(), key.size()}, deserialized.vaf_value_internal());
+    } else {
+      logger_.LogWarn() <<  "Kvs scan skipped a value that does not deserialize for MmapPersistency.";
+    }
+  });
+  for (const auto& value : values) {
+    callback(value.first, value.second);
+  }
+  return result;
+}
+::vaf::Result<std::uint8_t> MmapPersistency::Get_UInt8Value(const vaf::String& key) noexcept{
+  vaf::Result<std::uint8_t> ret_value{vaf::Result<std::uint8_t>::FromError(vaf::ErrorCode::kNotOk, "Get failed.")};
+
+  protobuf::basetypes::UInt8 deserialized;
+  vaf::Result<void> result = Read(key, [&deserialized](const char* data, std::size_t size) {
+    if (!deserialized.ParseFromArray(data, static_cast<int>(size))) {
+      vaf::OutputSyncStream{std::cerr} << "ERROR: Unable to deserialize!\n";
+    }
+  });
+  if (result.HasValue()) {
+    ret_value = vaf::Result<std::uint8_t>::FromValue(deserialized.vaf_value_internal());
+  } else {
+    ret_value = vaf::Result<std::uint8_t>::FromError(vaf::Error(vaf::ErrorCode::kUnknown,"Kvs get failed."));
+    logger_.LogWarn() <<  "Get failed for MmapPersistency.";
+  }
+
+  return ret_value;
+}
+
+::vaf::Result<void> MmapPersistency::Set_UInt8Value(const vaf::String& key, const std::uint8_t& value) noexcept{
+  protobuf::basetypes::UInt8 proto_message;
+  proto_message.set_vaf_value_internal(value);
+  std::string serialized;
+  proto_message.SerializeToString(&serialized);
+  return SetSerialized(key, serialized);
+}
+
+::vaf::Future<void> MmapPersistency::SetAsync_UInt8Value(const vaf::String& key, const std::uint8_t& value) noexcept{
+  protobuf::basetypes::UInt8 proto_message;
+  proto_message.set_vaf_value_internal(value);
+  std::string serialized;
+  proto_message.SerializeToString(&serialized);
+  return SetAsyncSerialized(key, serialized);
+}
+
+::vaf::Result<void> MmapPersistency::Scan_UInt8Values(const vaf::String& begin, const vaf::String& end,
+                                                          std::function<void(const vaf::String& key, const std::uint8_t& value)> callback) noexcept{
+  // The values are parsed under the lock and passed on without it, as the callback may set values
+  std::vector<std::pair<vaf::String, std::uint8_t>> values{};
+  vaf::Result<void> result = ReadRange(begin, end, [this, &values](std::string_view key, const char* data, std::size_t size) {
+    protobuf::basetypes::UInt8 deserialized;
+    if (deserialized.ParseFromArray(data, static_cast<int>(size))) {
+      values.emplace_back(vaf::String{key.data(), key.size()}, deserialized.vaf_value_internal());
+    } else {
+      logger_.LogWarn() <<  "Kvs scan skipped a value that does not deserialize for MmapPersistency.";
+    }
+  });
+  for (const auto& value : values) {
+    callback(value.first, value.second);
+  }
+  return result;
+}
+::vaf::Result<std::int64_t> MmapPersistency::Get_Int64Value(const vaf::String& key) noexcept{
+  vaf::Result<std::int64_t> ret_value{vaf::Result<std::int64_t>::FromError(vaf::ErrorCode::kNotOk, "Get failed.")};
+
+  protobuf::basetypes::Int64 deserialized;
+  vaf::Result<void> result = Read(key, [&deserialized](const char* data, std::size_t size) {
+    if (!deserialized.ParseFromArray(data, static_cast<int>(size))) {
+      vaf::OutputSyncStream{std::cerr} << "ERROR: Unable to deserialize!\n";
+    }
+  });
+  if (result.HasValue()) {
+    ret_value = vaf::Result<std::int64_t>::FromValue(deserialized.vaf_value_internal());
+  } else {
+    ret_value = vaf::Result<std::int64_t>::FromError(vaf::Error(vaf::ErrorCode::kUnknown,"Kvs get failed."));
+    logger_.LogWarn() <<  "Get failed for MmapPersistency.";
+  }
+
+  return ret_value;
+}
+
+::vaf::Result<void> MmapPersistency::Set_Int64Value(const vaf::String& key, const std::int64_t& value) noexcept{
+  protobuf::basetypes::Int64 proto_message;
+  proto_message.set_vaf_value_internal(value);
+  std::string serialized;
+  proto_message.SerializeToString(&serialized);
+  return SetSerialized(key, serialized);
+}
+
+::vaf::Future<void> MmapPersistency::SetAsync_Int64Value(const vaf::String& key, const std::int64_t& value) noexcept{
+  protobuf::basetypes::Int64 proto_message;
+  proto_message.set_vaf_value_internal(value);
+  std::string serialized;
+  proto_message.SerializeToString(&serialized);
+  return SetAsyncSerialized(key, serialized);
+}
+
+::vaf::Result<void> MmapPersistency::Scan_Int64Values(const vaf::String& begin, const vaf::String& end,
+                                                          std::function<void(const vaf::String& key, const std::int64_t& value)> callback) noexcept{
+  // The values are parsed under the lock and passed on without it, as the callback may set values
+  std::vector<std::pair<vaf::String, std::int64_t>> values{};
+  vaf::Result<void> result = ReadRange(begin, end, [this, &values](std::string_view key, const char* data, std::size_t size) {
+    protobuf::basetypes::Int64 deserialized;
+    if (deserialized.ParseFromArray(data, static_cast<int>(size))) {
+      values.emplace_back(vaf::String{key.data(), key.size()}, deserialized.vaf_value_internal());
+    } else {
+      logger_.LogWarn() <<  "Kvs scan skipped a value that does not deserialize for MmapPersistency.";
+    }
+  });
+  for (const auto& value : values) {
+    callback(value.first, value.second);
+  }
+  return result;
+}
+::vaf::Result<std::int32_t> MmapPersistency::Get_Int32Value(const vaf::String& key) noexcept{
+  vaf::Result<std::int32_t> ret_value{vaf::Result<std::int32_t>::FromError(vaf::ErrorCode::kNotOk, "Get failed.")};
+
+  protobuf::basetypes::Int32 deserialized;
+  vaf::Result<void> result = Read(key, [&deserialized](const char* data, std::size_t size) {
+    if (!deserialized.ParseFromArray(data, static_cast<int>(size))) {
+      vaf::OutputSyncStream{std::cerr} << "ERROR: Unable to deserialize!\n";
+    }
+  });
+  if (result.HasValue()) {
+    ret_value = vaf::Result<std::int32_t>::FromValue(deserialized.vaf_value_internal());
+  } else {
+    ret_value = vaf::Result<std::int32_t>::FromError(vaf::Error(vaf::ErrorCode::kUnknown,"Kvs get failed."));
+    logger_.LogWarn() <<  "Get failed for MmapPersistency.";
+  }
+
+  return ret_value;
+}
+
+::vaf::Result<void> MmapPersistency::Set_Int32Value(const vaf::String& key, const std::int32_t& value) noexcept{
+  protobuf::basetypes::Int32 proto_message;
+  proto_message.set_vaf_value_internal(value);
+  std::string serialized;
+  proto_message.SerializeToString(&serialized);
+  return SetSerialized(key, serialized);
+}
+
+::vaf::Future<void> MmapPersistency::SetAsync_Int32Value(const vaf::String& key, const std::int32_t& value) noexcept{
+  protobuf::basetypes::Int32 proto_message;
+  proto_message.set_vaf_value_internal(value);
+  std::string serialized;
+  proto_message.SerializeToString(&serialized);
+  return SetAsyncSerialized(key, serialized);
+}
+
+::vaf::Result<void> MmapPersistency::Scan_Int32Values(const vaf::String& begin, const vaf::String& end,
+                                                          std::function<void(const vaf::String& key, const std::int32_t& value)> callback) noexcept{
+  // The values are parsed under the lock and passed on without it, as the callback may set values
+  std::vector<std::pair<vaf::String, std::int32_t>> values{};
+  vaf::Result<void> result = ReadRange(begin, end, [this, &values](std::string_view key, const char* data, std::size_t size) {
+    protobuf::basetypes::Int32 deserialized;
+    if (deserialized.ParseFromArray(data, static_cast<int>(size))) {
+      values.emplace_back(vaf::String{key.data(), key.size()}, deserialized.vaf_value_internal());
+    } else {
+      logger_.LogWarn() <<  "Kvs scan skipped a value that does not deserialize for MmapPersistency.";
+    }
+  });
+  for (const auto& value : values) {
+    callback(value.first, value.second);
+  }
+  return result;
+}
+::vaf::Result<std::int16_t> MmapPersistency::Get_Int16Value(const vaf::String& key) noexcept{
+  vaf::Result<std::int16_t> ret_value{vaf::Result<std::int16_t>::FromError(vaf::ErrorCode::kNotOk, "Get failed.")};
+
+  protobuf::basetypes::Int16 deserialized;
+  vaf::Result<void> result = Read(key, [&deserialized](const char* data, std::size_t size) {
+    if (!deserialized.ParseFromArray(data, static_cast<int>(size))) {
+      vaf::OutputSyncStream{std::cerr} << "ERROR: Unable to deserialize!\n";
+    }
+  });
+  if (result.HasValue()) {
+    ret_value = vaf::Result<std::int16_t>::FromValue(deserialized.vaf_value_internal());
+  } else {
+    ret_value = vaf::Result<std::int16_t>::FromError(vaf::Error(vaf::ErrorCode::kUnknown,"Kvs get failed."));
+    logger_.LogWarn() <<  "Get failed for MmapPersistency.";
+  }
+
+  return ret_value;
+}
+
+::vaf::Result<void> MmapPersistency::Set_Int16Value(const vaf::String& key, const std::int16_t& value) noexcept{
+  protobuf::basetypes::Int16 proto_message;
+  proto_message.set_vaf_value_internal(value);
+  std::string serialized;
+  proto_message.SerializeToString(&serialized);
+  return SetSerialized(key, serialized);
+}
+
+::vaf::Future<void> MmapPersistency::SetAsync_Int16Value(const vaf::String& key, const std::int16_t& value) noexcept{
+  protobuf::basetypes::Int16 proto_message;
+  proto_message.set_vaf_value_internal(value);
+  std::string serialized;
+  proto_message.SerializeToString(&serialized);
+  return SetAsyncSerialized(key, serialized);
+}
+
+::vaf::Result<void> MmapPersistency::Scan_Int16Values(const vaf::String& begin, const vaf::String& end,
+                                                          std::function<void(const vaf::String& key, const std::int16_t& value)> callback) noexcept{
+  // The values are parsed under the lock and passed on without it, as the callback may set values
+  std::vector<std::pair<vaf::String, std::int16_t>> values{};
+  vaf::Result<void> result = ReadRange(begin, end, [this, &values](std::string_view key, const char* data, std::size_t size) {
+    protobuf::basetypes::Int16 deserialized;
+    if (deserialized.ParseFromArray(data, static_cast<int>(size))) {
+      values.emplace_back(vaf::String{key.data(), key.size()}, deserialized.vaf_value_internal());
+    } else {
+      logger_.LogWarn() <<  "Kvs scan skipped a value that does not deserialize for MmapPersistency.";
+    }
+  });
+  for (const auto& value : values) {
+    callback(value.first, value.second);
+  }
+  return result;
+}
+::vaf::Result<std::int8_t> MmapPersistency::Get_Int8Value(const vaf::String& key) noexcept{
+  vaf::Result<std::int8_t> ret_value{vaf::Result<std::int8_t>::FromError(vaf::ErrorCode::kNotOk, "Get failed.")};
+
+  protobuf::basetypes::Int8 deserialized;
+  vaf::Result<void> result = Read(key, [&deserialized](const char* data, std::size_t size) {
+    if (!deserialized.ParseFromArray(data, static_cast<int>(size))) {
+      vaf::OutputSyncStream{std::cerr} << "ERROR: Unable to deserialize!\n";
+    }
+  });
+  if (result.HasValue()) {
+    ret_value = vaf::Result<std::int8_t>::FromValue(deserialized.vaf_value_internal());
+  } else {
+    ret_value = vaf::Result<std::int8_t>::FromError(vaf::Error(vaf::ErrorCode::kUnknown,"Kvs get failed."));
+    logger_.LogWarn() <<  "Get failed for MmapPersistency.";
+  }
+
+  return ret_value;
+}
+
+::vaf::Result<void> MmapPersistency::Set_Int8Value(const vaf::String& key, const std::int8_t& value) noexcept{
+  protobuf::basetypes::Int8 proto_message;
+  proto_message.set_vaf_value_internal(value);
+  std::string serialized;
+  proto_message.SerializeToString(&serialized);
+  return SetSerialized(key, serialized);
+}
+
+::vaf::Future<void> MmapPersistency::SetAsync_Int8Value(const vaf::String& key, const std::int8_t& value) noexcept{
+  protobuf::basetypes::Int8 proto_message;
+  proto_message.set_vaf_value_internal(value);
+  std::string serialized;
+  proto_message.SerializeToString(&serialized);
+  return SetAsyncSerialized(key, serialized);
+}
+
+::vaf::Result<void> MmapPersistency::Scan_Int8Values(const vaf::String& begin, const vaf::String& end,
+                                                          std::function<void(const vaf::String& key, const std::int8_t& value)> callback) noexcept{
+  // The values are parsed under the lock and passed on without it, as the callback may set values
+  std::vector<std::pair<vaf::String, std::int8_t>> values{};
+  vaf::Result<void> result = ReadRange(begin, end, [this, &values](std::string_view key, const char* data, std::size_t size) {
+    protobuf::basetypes::Int8 deserialized;
+    if (deserialized.ParseFromArray(data, static_cast<int>(size))) {
+      values.emplace_back(vaf::String{key.data(), key.size()}, deserialized.vaf_value_internal());
+    } else {
+      logger_.LogWarn() <<  "Kvs scan skipped a value that does not deserialize for MmapPersistency.";
+    }
+  });
+  for (const auto& value : values) {
+    callback(value.first, value.second);
+  }
+  return result;
+}
+::vaf::Result<bool> MmapPersistency::Get_BoolValue(const vaf::String& key) noexcept{
+  vaf::Result<bool> ret_value{vaf::Result<bool>::FromError(vaf::ErrorCode::kNotOk, "Get failed.")};
+
+  protobuf::basetypes::Bool deserialized;
+  vaf::Result<void> result = Read(key, [&deserialized](const char* data, std::size_t size) {
+    if (!deserialized.ParseFromArray(data, static_cast<int>(size))) {
+      vaf::OutputSyncStream{std::cerr} << "ERROR: Unable to deserialize!\n";
+    }
+  });
+  if (result.HasValue()) {
+    ret_value = vaf::Result<bool>::FromValue(deserialized.vaf_value_internal());
+  } else {
+    ret_value = vaf::Result<bool>::FromError(vaf::Error(vaf::ErrorCode::kUnknown,"Kvs get failed."));
+    logger_.LogWarn() <<  "Get failed for MmapPersistency.";
+  }
+
+  return ret_value;
+}
+
+::vaf::Result<void> MmapPersistency::Set_BoolValue(const vaf::String& key, const bool& value) noexcept{
+  protobuf::basetypes::Bool proto_message;
+  proto_message.set_vaf_value_internal(value);
+  std::string serialized;
+  proto_message.SerializeToString(&serialized);
+  return SetSerialized(key, serialized);
+}
+
+::vaf::Future<void> MmapPersistency::SetAsync_BoolValue(const vaf::String& key, const bool& value) noexcept{
+  protobuf::basetypes::Bool proto_message;
+  proto_message.set_vaf_value_internal(value);
+  std::string serialized;
+  proto_message.SerializeToString(&serialized);
+  return SetAsyncSerialized(key, serialized);
+}
+
+::vaf::Result<void> MmapPersistency::Scan_BoolValues(const vaf::String& begin, const vaf::String& end,
+                                                          std::function<void(const vaf::String& key, const bool& value)> callback) noexcept{
+  // The values are parsed under the lock and passed on without it, as the callback may set values
+  std::vector<std::pair<vaf::String, bool>> values{};
+  vaf::Result<void> result = ReadRange(begin, end, [this, &values](std::string_view key, const char* data, std::size_t size) {
+    protobuf::basetypes::Bool deserialized;
+    if (deserialized.ParseFromArray(data, static_cast<int>(size))) {
+      values.emplace_back(vaf::String{key.data(), key.size()}, deserialized.vaf_value_internal());
+    } else {
+      logger_.LogWarn() <<  "Kvs scan skipped a value that does not deserialize for MmapPersistency.";
+    }
+  });
+  for (const auto& value : values) {
+    callback(value.first, value.second);
+  }
+  return result;
+}
+::vaf::Result<float> MmapPersistency::Get_FloatValue(const vaf::String& key) noexcept{
+  vaf::Result<float> ret_value{vaf::Result<float>::FromError(vaf::ErrorCode::kNotOk, "Get failed.")};
+
+  protobuf::basetypes::Float deserialized;
+  vaf::Result<void> result = Read(key, [&deserialized](const char* data, std::size_t size) {
+    if (!deserialized.ParseFromArray(data, static_cast<int>(size))) {
+      vaf::OutputSyncStream{std::cerr} << "ERROR: Unable to deserialize!\n";
+    }
+  });
+  if (result.HasValue()) {
+    ret_value = vaf::Result<float>::FromValue(deserialized.vaf_value_internal());
+  } else {
+    ret_value = vaf::Result<float>::FromError(vaf::Error(vaf::ErrorCode::kUnknown,"Kvs get failed."));
+    logger_.LogWarn() <<  "Get failed for MmapPersistency.";
+  }
+
+  return ret_value;
+}
+
+::vaf::Result<void> MmapPersistency::Set_FloatValue(const vaf::String& key, const float& value) noexcept{
+  protobuf::basetypes::Float proto_message;
+  proto_message.set_vaf_value_internal(value);
+  std::string serialized;
+  proto_message.SerializeToString(&serialized);
+  return SetSerialized(key, serialized);
+}
+
+::vaf::Future<void> MmapPersistency::SetAsync_FloatValue(const vaf::String& key, const float& value) noexcept{
+  protobuf::basetypes::Float proto_message;
+  proto_message.set_vaf_value_internal(value);
+  std::string serialized;
+  proto_message.SerializeToString(&serialized);
+  return SetAsyncSerialized(key, serialized);
+}
+
+::vaf::Result<void> MmapPersistency::Scan_FloatValues(const vaf::String& begin, const vaf::String& end,
+                                                          std::function<void(const vaf::String& key, const float& value)> callback) noexcept{
+  // The values are parsed under the lock and passed on without it, as the callback may set values
+  std::vector<std::pair<vaf::String, float>> values{};
+  vaf::Result<void> result = ReadRange(begin, end, [this, &values](std::string_view key, const char* data, std::size_t size) {
+    protobuf::basetypes::Float deserialized;
+    if (deserialized.ParseFromArray(data, static_cast<int>(size))) {
+      values.emplace_back(vaf::String{key.data(), key.size()}, deserialized.vaf_value_internal());
+    } else {
+      logger_.LogWarn() <<  "Kvs scan skipped a value that does not deserialize for MmapPersistency.";
+    }
+  });
+  for (const auto& value : values) {
+    callback(value.first, value.second);
+  }
+  return result;
+}
+::vaf::Result<double> MmapPersistency::Get_DoubleValue(const vaf::String& key) noexcept{
+  vaf::Result<double> ret_value{vaf::Result<double>::FromError(vaf::ErrorCode::kNotOk, "Get failed.")};
+
+  protobuf::basetypes::Double deserialized;
+  vaf::Result<void> result = Read(key, [&deserialized](const char* data, std::size_t size) {
+    if (!deserialized.ParseFromArray(data, static_cast<int>(size))) {
+      vaf::OutputSyncStream{std::cerr} << "ERROR: Unable to deserialize!\n";
+    }
+  });
+  if (result.HasValue()) {
+    ret_value = vaf::Result<double>::FromValue(deserialized.vaf_value_internal());
+  } else {
+    ret_value = vaf::Result<double>::FromError(vaf::Error(vaf::ErrorCode::kUnknown,"Kvs get failed."));
+    logger_.LogWarn() <<  "Get failed for MmapPersistency.";
+  }
+
+  return ret_value;
+}
+
+::vaf::Result<void> MmapPersistency::Set_DoubleValue(const vaf::String& key, const double& value) noexcept{
+  protobuf::basetypes::Double proto_message;
+  proto_message.set_vaf_value_internal(value);
+  std::string serialized;
+  proto_message.SerializeToString(&serialized);
+  return SetSerialized(key, serialized);
+}
+
+::vaf::Future<void> MmapPersistency::SetAsync_DoubleValue(const vaf::String& key, const double& value) noexcept{
+  protobuf::basetypes::Double proto_message;
+  proto_message.set_vaf_value_internal(value);
+  std::string serialized;
+  proto_message.SerializeToString(&serialized);
+  return SetAsyncSerialized(key, serialized);
+}
+
+::vaf::Result<void> MmapPersistency::Scan_DoubleValues(const vaf::String& begin, const vaf::String& end,
+                                                          std::function<void(const vaf::String& key, const double& value)> callback) noexcept{
+  // The values are parsed under the lock and passed on without it, as the callback may set values
+  std::vector<std::pair<vaf::String, double>> values{};
+  vaf::Result<void> result = ReadRange(begin, end, [this, &values](std::string_view key, const char* data, std::size_t size) {
+    protobuf::basetypes::Double deserialized;
+    if (deserialized.ParseFromArray(data, static_cast<int>(size))) {
+      values.emplace_back(vaf::String{key.data(), key.size()}, deserialized.vaf_value_internal());
+    } else {
+      logger_.LogWarn() <<  "Kvs scan skipped a value that does not deserialize for MmapPersistency.";
+    }
+  });
+  for (const auto& value : values) {
+    callback(value.first, value.second);
+  }
+  return result;
+}
+
+::vaf::Result<::vaf::String> MmapPersistency::Get_StringValue(const vaf::String& key) noexcept{
+  vaf::Result<::vaf::String> ret_value{vaf::Result<::vaf::String>::FromError(vaf::ErrorCode::kNotOk, "Get failed.")};
+
+  protobuf::vaf::String deserialized;
+  vaf::Result<void> result = Read(key, [&deserialized](const char* data, std::size_t size) {
+    if (!deserialized.ParseFromArray(data, static_cast<int>(size))) {
+      vaf::OutputSyncStream{std::cerr} << "ERROR: Unable to deserialize!\n";
+    }
+  });
+  if (result.HasValue()) {
+    ::vaf::String value;
+    protobuf::vaf::StringProtoToVaf(std::move(deserialized), value);
+    ret_value = vaf::Result<::vaf::String>::FromValue(std::move(value));
+  } else {
+    ret_value = vaf::Result<::vaf::String>::FromError(vaf::Error(vaf::ErrorCode::kUnknown,"Kvs get failed."));
+    logger_.LogWarn() <<  "Get failed for MmapPersistency.";
+  }
+
+  return ret_value;
+}
+
+::vaf::Result<void> MmapPersistency::Set_StringValue(const vaf::String& key,
+                                                            const ::vaf::String& value) noexcept{
+  protobuf::vaf::String proto_message;
+  protobuf::vaf::StringVafToProto(value, proto_message);
+  std::string serialized;
+  proto_message.SerializeToString(&serialized);
+  return SetSerialized(key, serialized);
+}
+
+::vaf::Future<void> MmapPersistency::SetAsync_StringValue(const vaf::String& key,
+                                                                 const ::vaf::String& value) noexcept{
+  protobuf::vaf::String proto_message;
+  protobuf::vaf::StringVafToProto(value, proto_message);
+  std::string serialized;
+  proto_message.SerializeToString(&serialized);
+  return SetAsyncSerialized(key, serialized);
+}
+
+::vaf::Result<void> MmapPersistency::Scan_StringValues(const vaf::String& begin, const vaf::String& end,
+                                                          std::function<void(const vaf::String& key, const ::vaf::String& value)> callback) noexcept{
+  // The values are parsed under the lock and passed on without it, as the callback may set values
+  std::vector<std::pair<vaf::String, ::vaf::String>> values{};
+  vaf::Result<void> result = ReadRange(begin, end, [this, &values](std::string_view key, const char* data, std::size_t size) {
+    protobuf::vaf::String deserialized;
+    if (deserialized.ParseFromArray(data, static_cast<int>(size))) {
+      ::vaf::String value;
+      protobuf::vaf::StringProtoToVaf(std::move(deserialized), value);
+      values.emplace_back(vaf::String{key.data(), key.size()}, std::move(value));
+    } else {
+      logger_.LogWarn() <<  "Kvs scan skipped a value that does not deserialize for MmapPersistency.";
+    }
+  });
+  for (const auto& value : values) {
+    callback(value.first, value.second);
+  }
+  return result;
+}
+::vaf::Result<::test::MyArray> MmapPersistency::Get_MyArrayValue(const vaf::String& key) noexcept{
+  vaf::Result<::test::MyArray> ret_value{vaf::Result<::test::MyArray>::FromError(vaf::ErrorCode::kNotOk, "Get failed.")};
+
+  protobuf::test::MyArray deserialized;
+  vaf::Result<void> result = Read(key, [&deserialized](const char* data, std::size_t size) {
+    if (!deserialized.ParseFromArray(data, static_cast<int>(size))) {
+      vaf::OutputSyncStream{std::cerr} << "ERROR: Unable to deserialize!\n";
+    }
+  });
+  if (result.HasValue()) {
+    ::test::MyArray value;
+    protobuf::test::MyArrayProtoToVaf(std::move(deserialized), value);
+    ret_value = vaf::Result<::test::MyArray>::FromValue(std::move(value));
+  } else {
+    ret_value = vaf::Result<::test::MyArray>::FromError(vaf::Error(vaf::ErrorCode::kUnknown,"Kvs get failed."));
+    logger_.LogWarn() <<  "Get failed for MmapPersistency.";
+  }
+
+  return ret_value;
+}
+
+::vaf::Result<void> MmapPersistency::Set_MyArrayValue(const vaf::String& key,
+                                                            const ::test::MyArray& value) noexcept{
+  protobuf::test::MyArray proto_message;
+  protobuf::test::MyArrayVafToProto(value, proto_message);
+  std::string serialized;
+  proto_message.SerializeToString(&serialized);
+  return SetSerialized(key, serialized);
+}
+
+::vaf::Future<void> MmapPersistency::SetAsync_MyArrayValue(const vaf::String& key,
+                                                                 const ::test::MyArray& value) noexcept{
+  protobuf::test::MyArray proto_message;
+  protobuf::test::MyArrayVafToProto(value, proto_message);
+  std::string serialized;
+  proto_message.SerializeToString(&serialized);
+  return SetAsyncSerialized(key, serialized);
+}
+
+::vaf::Result<void> MmapPersistency::Scan_MyArrayValues(const vaf::String& begin, const vaf::String& end,
+                                                          std::function<void(const vaf::String& key, const ::test::MyArray& value)> callback) noexcept{
+  // The values are parsed under the lock and passed on without it, as the callback may set values
+  std::vector<std::pair<vaf::String, ::test::MyArray>> values{};
+  vaf::Result<void> result = ReadRange(begin, end, [this, &values](std::string_view key, const char* data, std::size_t size) {
+    protobuf::test::MyArray deserialized;
+    if (deserialized.ParseFromArray(data, static_cast<int>(size))) {
+      ::test::MyArray value;
+      protobuf::test::MyArrayProtoToVaf(std::move(deserialized), value);
+      values.emplace_back(vaf::String{key.data(), key.size()}, std::move(value));
+    } else {
+      logger_.LogWarn() <<  "Kvs scan skipped a value that does not deserialize for MmapPersistency.";
+    }
+  });
+  for (const auto& value : values) {
+    callback(value.first, value.second);
+  }
+  return result;
+}
+
+
+} // namespace persistency
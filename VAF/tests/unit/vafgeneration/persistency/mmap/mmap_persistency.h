@@ -0,0 +1,241 @@
+/*!********************************************************************************************************************
+ *  COPYRIGHT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  Copyright (c) 2024-2026 by Vector Informatik GmbH. All rights reserved.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -----------------------------------------------------------------------------------------------------------------*/
+/*!        \file  mmap_persistency.h
+ *         \brief
+ *
+ *********************************************************************************************************************/
+
+#ifndef PERSISTENCY_MMAP_PERSISTENCY_H
+#define PERSISTENCY_MMAP_PERSISTENCY_H
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+#include "vaf/container_types.h"
+#include "vaf/data_ptr.h"
+#include "vaf/result.h"
+#include "vaf/error_domain.h"
+#include "vaf/future.h"
+#include "vaf/logging.h"
+#include "vaf/metrics.h"
+#include "vaf/trace.h"
+#include "persistency/persistency_interface.h"
+#include "protobuf/vaf/protobuf_transformer.h"
+#include "protobuf/test/protobuf_transformer.h"
+
+
+namespace persistency {
+
+/*!
+ * \brief Key value store in a memory mapped append log, for small files that are mostly read.
+ * Each Set appends a record with a checksum, and Open rebuilds the index of the latest records. A record that was
+ * cut off by a crash fails its checksum, so the log ends before it. The typed Get functions parse the values right
+ * from the mapped pages. When the log is full, the latest records are written to a new, larger file which replaces
+ * the old one.
+ */
+class MmapPersistency final : public ::persistency::PersistencyInterface {
+ public:
+  explicit MmapPersistency();
+  ~MmapPersistency() noexcept override;
+  MmapPersistency(const MmapPersistency&) = delete;
+  MmapPersistency(MmapPersistency&&) = delete;
+  MmapPersistency& operator=(const MmapPersistency&) = delete;
+  MmapPersistency& operator=(MmapPersistency&&) = delete;
+
+  /*!
+   * \brief Opens the file and rebuilds its index.
+   * \param filename The path of the file
+   * \param sync_on_write Syncs each write to the storage
+   * \return Error if the file could not be opened or is no key value log
+   */
+  ::vaf::Result<void> Open(const vaf::String& filename, bool sync_on_write) noexcept;
+  ::vaf::Result<void> Set(const vaf::String& key, const vaf::String& value) noexcept;
+  ::vaf::Result<vaf::String> Get(const vaf::String& key) noexcept;
+
+  ::vaf::Result<void> BeginBatch() noexcept override;
+  ::vaf::Result<void> CommitBatch() noexcept override;
+  ::vaf::Result<void> Compact() noexcept override;
+
+  ::vaf::Result<std::uint64_t> Get_UInt64Value(const vaf::String& key) noexcept override;
+  ::vaf::Result<void> Set_UInt64Value(const vaf::String& key, const std::uint64_t& value) noexcept override;
+  ::vaf::Future<void> SetAsync_UInt64Value(const vaf::String& key, const std::uint64_t& value) noexcept override;
+  ::vaf::Result<void> Scan_UInt64Values(const vaf::String& begin, const vaf::String& end,
+                                           std::function<void(const vaf::String& key, const std::uint64_t& value)> callback) noexcept override;
+  ::vaf::Result<std::uint32_t> Get_UInt32Value(const vaf::String& key) noexcept override;
+  ::vaf::Result<void> Set_UInt32Value(const vaf::String& key, const std::uint32_t& value) noexcept override;
+  ::vaf::Future<void> SetAsync_UInt32Value(const vaf::String& key, const std::uint32_t& value) noexcept override;
+  ::vaf::Result<void> Scan_UInt32Values(const vaf::String& begin, const vaf::String& end,
+                                           std::function<void(const vaf::String& key, const std::uint32_t& value)> callback) noexcept override;
+  ::vaf::Result<std::uint16_t> Get_UInt16Value(const vaf::String& key) noexcept override;
+  ::vaf::Result<void> Set_UInt16Value(const vaf::String& key, const std::uint16_t& value) noexcept override;
+  ::vaf::Future<void> SetAsync_UInt16Value(const vaf::String& key, const std::uint16_t& value) noexcept override;
+  ::vaf::Result<void> Scan_UInt16Values(const vaf::String& begin, const vaf::String& end,
+                                           std::function<void(const vaf::String& key, const std::uint16_t& value)> callback) noexcept override;
+  ::vaf::Result<std::uint8_t> Get_UInt8Value(const vaf::String& key) noexcept override;
+  ::vaf::Result<void> Set_UInt8Value(const vaf::String& key, const std::uint8_t& value) noexcept override;
+  ::vaf::Future<void> SetAsync_UInt8Value(const vaf::String& key, const std::uint8_t& value) noexcept override;
+  ::vaf::Result<void> Scan_UInt8Values(const vaf::String& begin, const vaf::String& end,
+                                           std::function<void(const vaf::String& key, const std::uint8_t& value)> callback) noexcept override;
+  ::vaf::Result<std::int64_t> Get_Int64Value(const vaf::String& key) noexcept override;
+  ::vaf::Result<void> Set_Int64Value(const vaf::String& key, const std::int64_t& value) noexcept override;
+  ::vaf::Future<void> SetAsync_Int64Value(const vaf::String& key, const std::int64_t& value) noexcept override;
+  ::vaf::Result<void> Scan_Int64Values(const vaf::String& begin, const vaf::String& end,
+                                           std::function<void(const vaf::String& key, const std::int64_t& value)> callback) noexcept override;
+  ::vaf::Result<std::int32_t> Get_Int32Value(const vaf::String& key) noexcept override;
+  ::vaf::Result<void> Set_Int32Value(const vaf::String& key, const std::int32_t& value) noexcept override;
+  ::vaf::Future<void> SetAsync_Int32Value(const vaf::String& key, const std::int32_t& value) noexcept override;
+  ::vaf::Result<void> Scan_Int32Values(const vaf::String& begin, const vaf::String& end,
+                                           std::function<void(const vaf::String& key, const std::int32_t& value)> callback) noexcept override;
+  ::vaf::Result<std::int16_t> Get_Int16Value(const vaf::String& key) noexcept override;
+  ::vaf::Result<void> Set_Int16Value(const vaf::String& key, const std::int16_t& value) noexcept override;
+  ::vaf::Future<void> SetAsync_Int16Value(const vaf::String& key, const std::int16_t& value) noexcept override;
+  ::vaf::Result<void> Scan_Int16Values(const vaf::String& begin, const vaf::String& end,
+                                           std::function<void(const vaf::String& key, const std::int16_t& value)> callback) noexcept override;
+  ::vaf::Result<std::int8_t> Get_Int8Value(const vaf::String& key) noexcept override;
+  ::vaf::Result<void> Set_Int8Value(const vaf::String& key, const std::int8_t& value) noexcept override;
+  ::vaf::Future<void> SetAsync_Int8Value(const vaf::String& key, const std::int8_t& value) noexcept override;
+  ::vaf::Result<void> Scan_Int8Values(const vaf::String& begin, const vaf::String& end,
+                                           std::function<void(const vaf::String& key, const std::int8_t& value)> callback) noexcept override;
+  ::vaf::Result<bool> Get_BoolValue(const vaf::String& key) noexcept override;
+  ::vaf::Result<void> Set_BoolValue(const vaf::String& key, const bool& value) noexcept override;
+  ::vaf::Future<void> SetAsync_BoolValue(const vaf::String& key, const bool& value) noexcept override;
+  ::vaf::Result<void> Scan_BoolValues(const vaf::String& begin, const vaf::String& end,
+                                           std::function<void(const vaf::String& key, const bool& value)> callback) noexcept override;
+  ::vaf::Result<float> Get_FloatValue(const vaf::String& key) noexcept override;
+  ::vaf::Result<void> Set_FloatValue(const vaf::String& key, const float& value) noexcept override;
+  ::vaf::Future<void> SetAsync_FloatValue(const vaf::String& key, const float& value) noexcept override;
+  ::vaf::Result<void> Scan_FloatValues(const vaf::String& begin, const vaf::String& end,
+                                           std::function<void(const vaf::String& key, const float& value)> callback) noexcept override;
+  ::vaf::Result<double> Get_DoubleValue(const vaf::String& key) noexcept override;
+  ::vaf::Result<void> Set_DoubleValue(const vaf::String& key, const double& value) noexcept override;
+  ::vaf::Future<void> SetAsync_DoubleValue(const vaf::String& key, const double& value) noexcept override;
+  ::vaf::Result<void> Scan_DoubleValues(const vaf::String& begin, const vaf::String& end,
+                                           std::function<void(const vaf::String& key, const double& value)> callback) noexcept override;
+  ::vaf::Result<::vaf::String> Get_StringValue(const vaf::String& key) noexcept override;
+  ::vaf::Result<void> Set_StringValue(const vaf::String& key, const ::vaf::String& value) noexcept override;
+  ::vaf::Future<void> SetAsync_StringValue(const vaf::String& key, const ::vaf::String& value) noexcept override;
+  ::vaf::Result<void> Scan_StringValues(const vaf::String& begin, const vaf::String& end,
+                                           std::function<void(const vaf::String& key, const ::vaf::String& value)> callback) noexcept override;
+  ::vaf::Result<::test::MyArray> Get_MyArrayValue(const vaf::String& key) noexcept override;
+  ::vaf::Result<void> Set_MyArrayValue(const vaf::String& key, const ::test::MyArray& value) noexcept override;
+  ::vaf::Future<void> SetAsync_MyArrayValue(const vaf::String& key, const ::test::MyArray& value) noexcept override;
+  ::vaf::Result<void> Scan_MyArrayValues(const vaf::String& begin, const vaf::String& end,
+                                           std::function<void(const vaf::String& key, const ::test::MyArray& value)> callback) noexcept override;
+ private:
+  struct Location {
+    std::size_t offset;
+    std::size_t size;
+  };
+  using Records = std::vector<std::pair<std::string_view, std::string_view>>;
+
+  ::vaf::Result<void> SetSerialized(std::string_view key, std::string_view value) noexcept;
+  // Appending is a copy into the mapped pages, so the future is ready right away
+  ::vaf::Future<void> SetAsyncSerialized(std::string_view key, std::string_view value) noexcept;
+
+  // Calls parse with the serialized value, from the mapped pages or from the open batch, mutex_ must not be held
+  template <typename F>
+  ::vaf::Result<void> Read(std::string_view key, F&& parse) {
+    VAF_TRACE_SCOPE("vaf.persistency", "Get", "MmapPersistency");
+    vaf::LatencyHistogram::Timer latency_timer{get_latency_};
+    ::vaf::Result<void> ret_value{::vaf::Result<void>::FromError(::vaf::ErrorCode::kNotOk, "Kvs not opened.")};
+    if (opened_) {
+      std::lock_guard<std::mutex> lock{mutex_};
+      const auto pending = pending_.find(key);
+      const auto location = index_.find(key);
+      if (pending != pending_.end()) {
+        parse(pending->second.data(), pending->second.size());
+        ret_value = ::vaf::Result<void>::FromValue();
+      } else if (location != index_.end()) {
+        parse(memory_ + location->second.offset, location->second.size);
+        ret_value = ::vaf::Result<void>::FromValue();
+      } else {
+        ret_value = ::vaf::Result<void>::FromError(::vaf::ErrorCode::kUnknown, "Kvs get failed.");
+      }
+    }
+    if (!ret_value.HasValue()) {
+      logger_.LogWarn() << "Kvs get failed for MmapPersistency.";
+    }
+    return ret_value;
+  }
+
+  // Calls parse with each key in [begin, end) and its serialized value in key order, mutex_ must not be held
+  template <typename F>
+  ::vaf::Result<void> ReadRange(std::string_view begin, std::string_view end, F&& parse) {
+    VAF_TRACE_SCOPE("vaf.persistency", "Scan", "MmapPersistency");
+    vaf::LatencyHistogram::Timer latency_timer{scan_latency_};
+    ::vaf::Result<void> ret_value{::vaf::Result<void>::FromError(::vaf::ErrorCode::kNotOk, "Kvs not opened.")};
+    if (opened_) {
+      const auto in_range = [end](std::string_view key) { return end.empty() || (key < end); };
+      std::lock_guard<std::mutex> lock{mutex_};
+      auto pending = pending_.lower_bound(begin);
+      for (auto location = index_.lower_bound(begin); (location != index_.end()) && in_range(location->first);
+           ++location) {
+        for (; (pending != pending_.end()) && in_range(pending->first) && (pending->first < location->first);
+             ++pending) {
+          parse(pending->first, pending->second.data(), pending->second.size());
+        }
+        if ((pending != pending_.end()) && (pending->first == location->first)) {
+          parse(pending->first, pending->second.data(), pending->second.size());
+          ++pending;
+        } else {
+          parse(location->first, memory_ + location->second.offset, location->second.size);
+        }
+      }
+      for (; (pending != pending_.end()) && in_range(pending->first); ++pending) {
+        parse(pending->first, pending->second.data(), pending->second.size());
+      }
+      ret_value = ::vaf::Result<void>::FromValue();
+    } else {
+      logger_.LogWarn() << "Kvs not opened for MmapPersistency.";
+    }
+    return ret_value;
+  }
+
+  // Appends the records as one batch, the log ends before them if they are not all complete, mutex_ must be held
+  ::vaf::Result<void> Append(const Records& records);
+  // Writes the latest records to a new file of the given capacity and maps it instead, mutex_ must be held
+  ::vaf::Result<void> Rewrite(std::size_t capacity);
+  // Reads the records from the start of the log, end_ becomes the end of the last complete batch
+  void RebuildIndex();
+  void Close() noexcept;
+
+  vaf::String filename_{};
+  int fd_{-1};
+  char* memory_{nullptr};
+  std::size_t capacity_{0};
+  // End of the last complete batch, the next record is appended there
+  std::size_t end_{0};
+  bool opened_{false};
+  bool sync_on_write_{false};
+  vaf::Logger& logger_{vaf::CreateLogger("PER", "MmapPersistency")};
+  // Latencies of the operations on the file, registered by Open
+  vaf::LatencyHistogram* get_latency_{nullptr};
+  vaf::LatencyHistogram* scan_latency_{nullptr};
+  vaf::LatencyHistogram* set_latency_{nullptr};
+  vaf::LatencyHistogram* commit_latency_{nullptr};
+
+  std::mutex mutex_{};
+  // Location of the latest value of each key in the mapped pages
+  std::map<std::string, Location, std::less<>> index_{};
+  // Values set within a batch, the latest per key
+  std::map<std::string, std::string, std::less<>> pending_{};
+  bool batch_open_{false};
+};
+
+} // namespace persistency
+
+#endif // PERSISTENCY_MMAP_PERSISTENCY_H
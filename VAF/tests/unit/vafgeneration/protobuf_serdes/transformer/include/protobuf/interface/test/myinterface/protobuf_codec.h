@@ -0,0 +1,267 @@
+/*!********************************************************************************************************************
+ *  COPYRIGHT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  Copyright (c) 2024-2026 by Vector Informatik GmbH. All rights reserved.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -----------------------------------------------------------------------------------------------------------------*/
+/*!        \file  protobuf_codec.h
+ *         \brief
+ *
+ *********************************************************************************************************************/
+
+#ifndef PROTOBUF_INTERFACE_TEST_MYINTERFACE_PROTOBUF_CODEC_H
+#define PROTOBUF_INTERFACE_TEST_MYINTERFACE_PROTOBUF_CODEC_H
+
+#include <cstddef>
+#include <cstdint>
+
+#include "protobuf/wire/codec.h"
+#include "test/my_operation.h"
+#include "test/my_getter.h"
+
+namespace protobuf {
+namespace interface {
+namespace test {
+namespace MyInterface {
+
+inline std::size_t my_data_element1WireSize(const ::std::uint64_t &in) {
+  return ::protobuf::wire::ScalarFieldSize(1u, in);
+}
+inline void my_data_element1WireWrite(const ::std::uint64_t &in, ::protobuf::wire::CodedOutputStream &out) {
+  ::protobuf::wire::WriteScalarField(1u, in, out);
+}
+inline bool my_data_element1WireRead(::protobuf::wire::CodedInputStream &in, ::std::uint64_t &out) {
+  bool ok{true};
+  for (std::uint32_t tag{::protobuf::wire::ReadTag(in)}; ok && (tag != 0u); tag = ::protobuf::wire::ReadTag(in)) {
+    switch (::protobuf::wire::FieldNumber(tag)) {
+      case 1u:
+        ok = ::protobuf::wire::ReadScalarField(in, tag, out);
+        break;
+      default:
+        ok = ::protobuf::wire::SkipField(in, tag);
+        break;
+    }
+  }
+  return ok && in.ConsumedEntireMessage();
+}
+inline void my_data_element1WireSerialize(const ::std::uint64_t &in, std::uint8_t* data, std::size_t size) {
+  ::protobuf::wire::SerializeToArray(data, size, [&](::protobuf::wire::CodedOutputStream& out) {
+    my_data_element1WireWrite(in, out);
+  });
+}
+inline bool my_data_element1WireParse(const std::uint8_t* data, std::size_t size, ::std::uint64_t &out) {
+  return ::protobuf::wire::ParseFromArray(data, size, [&](::protobuf::wire::CodedInputStream& in) {
+    return my_data_element1WireRead(in, out);
+  });
+}
+inline std::size_t my_data_element2WireSize(const ::std::uint64_t &in) {
+  return ::protobuf::wire::ScalarFieldSize(1u, in);
+}
+inline void my_data_element2WireWrite(const ::std::uint64_t &in, ::protobuf::wire::CodedOutputStream &out) {
+  ::protobuf::wire::WriteScalarField(1u, in, out);
+}
+inline bool my_data_element2WireRead(::protobuf::wire::CodedInputStream &in, ::std::uint64_t &out) {
+  bool ok{true};
+  for (std::uint32_t tag{::protobuf::wire::ReadTag(in)}; ok && (tag != 0u); tag = ::protobuf::wire::ReadTag(in)) {
+    switch (::protobuf::wire::FieldNumber(tag)) {
+      case 1u:
+        ok = ::protobuf::wire::ReadScalarField(in, tag, out);
+        break;
+      default:
+        ok = ::protobuf::wire::SkipField(in, tag);
+        break;
+    }
+  }
+  return ok && in.ConsumedEntireMessage();
+}
+inline void my_data_element2WireSerialize(const ::std::uint64_t &in, std::uint8_t* data, std::size_t size) {
+  ::protobuf::wire::SerializeToArray(data, size, [&](::protobuf::wire::CodedOutputStream& out) {
+    my_data_element2WireWrite(in, out);
+  });
+}
+inline bool my_data_element2WireParse(const std::uint8_t* data, std::size_t size, ::std::uint64_t &out) {
+  return ::protobuf::wire::ParseFromArray(data, size, [&](::protobuf::wire::CodedInputStream& in) {
+    return my_data_element2WireRead(in, out);
+  });
+}
+inline std::size_t MyVoidOperationInWireSize(const ::std::uint64_t& in_in) {
+  std::size_t size{0u};
+  size += ::protobuf::wire::ScalarFieldSize(1u, in_in);
+  return size;
+}
+inline void MyVoidOperationInWireWrite(const ::std::uint64_t& in_in, ::protobuf::wire::CodedOutputStream &out) {
+  ::protobuf::wire::WriteScalarField(1u, in_in, out);
+}
+inline bool MyVoidOperationInWireRead(::protobuf::wire::CodedInputStream &in, ::std::uint64_t& out_in) {
+  bool ok{true};
+  for (std::uint32_t tag{::protobuf::wire::ReadTag(in)}; ok && (tag != 0u); tag = ::protobuf::wire::ReadTag(in)) {
+    switch (::protobuf::wire::FieldNumber(tag)) {
+      case 1u:
+        ok = ::protobuf::wire::ReadScalarField(in, tag, out_in);
+        break;
+      default:
+        ok = ::protobuf::wire::SkipField(in, tag);
+        break;
+    }
+  }
+  return ok && in.ConsumedEntireMessage();
+}
+inline void MyVoidOperationInWireSerialize(const ::std::uint64_t& in_in, std::uint8_t* data, std::size_t size) {
+  ::protobuf::wire::SerializeToArray(data, size, [&](::protobuf::wire::CodedOutputStream& out) {
+    MyVoidOperationInWireWrite(in_in, out);
+  });
+}
+inline bool MyVoidOperationInWireParse(const std::uint8_t* data, std::size_t size, ::std::uint64_t& out_in) {
+  return ::protobuf::wire::ParseFromArray(data, size, [&](::protobuf::wire::CodedInputStream& in) {
+    return MyVoidOperationInWireRead(in, out_in);
+  });
+}
+inline std::size_t MyOperationOutWireSize(const ::test::MyOperation::Output &in) {
+  std::size_t size{0u};
+  size += ::protobuf::wire::ScalarFieldSize(1u, in.out);
+  size += ::protobuf::wire::ScalarFieldSize(2u, in.inout);
+  return size;
+}
+inline void MyOperationOutWireWrite(const ::test::MyOperation::Output &in, ::protobuf::wire::CodedOutputStream &out) {
+  ::protobuf::wire::WriteScalarField(1u, in.out, out);
+  ::protobuf::wire::WriteScalarField(2u, in.inout, out);
+}
+inline bool MyOperationOutWireRead(::protobuf::wire::CodedInputStream &in, ::test::MyOperation::Output &out) {
+  bool ok{true};
+  for (std::uint32_t tag{::protobuf::wire::ReadTag(in)}; ok && (tag != 0u); tag = ::protobuf::wire::ReadTag(in)) {
+    switch (::protobuf::wire::FieldNumber(tag)) {
+      case 1u:
+        ok = ::protobuf::wire::ReadScalarField(in, tag, out.out);
+        break;
+      case 2u:
+        ok = ::protobuf::wire::ReadScalarField(in, tag, out.inout);
+        break;
+      default:
+        ok = ::protobuf::wire::SkipField(in, tag);
+        break;
+    }
+  }
+  return ok && in.ConsumedEntireMessage();
+}
+inline void MyOperationOutWireSerialize(const ::test::MyOperation::Output &in, std::uint8_t* data, std::size_t size) {
+  ::protobuf::wire::SerializeToArray(data, size, [&](::protobuf::wire::CodedOutputStream& out) {
+    MyOperationOutWireWrite(in, out);
+  });
+}
+inline bool MyOperationOutWireParse(const std::uint8_t* data, std::size_t size, ::test::MyOperation::Output &out) {
+  return ::protobuf::wire::ParseFromArray(data, size, [&](::protobuf::wire::CodedInputStream& in) {
+    return MyOperationOutWireRead(in, out);
+  });
+}
+inline std::size_t MyOperationInWireSize(const ::std::uint64_t& in_in, const ::std::uint64_t& in_inout) {
+  std::size_t size{0u};
+  size += ::protobuf::wire::ScalarFieldSize(1u, in_in);
+  size += ::protobuf::wire::ScalarFieldSize(2u, in_inout);
+  return size;
+}
+inline void MyOperationInWireWrite(const ::std::uint64_t& in_in, const ::std::uint64_t& in_inout, ::protobuf::wire::CodedOutputStream &out) {
+  ::protobuf::wire::WriteScalarField(1u, in_in, out);
+  ::protobuf::wire::WriteScalarField(2u, in_inout, out);
+}
+inline bool MyOperationInWireRead(::protobuf::wire::CodedInputStream &in, ::std::uint64_t& out_in, ::std::uint64_t& out_inout) {
+  bool ok{true};
+  for (std::uint32_t tag{::protobuf::wire::ReadTag(in)}; ok && (tag != 0u); tag = ::protobuf::wire::ReadTag(in)) {
+    switch (::protobuf::wire::FieldNumber(tag)) {
+      case 1u:
+        ok = ::protobuf::wire::ReadScalarField(in, tag, out_in);
+        break;
+      case 2u:
+        ok = ::protobuf::wire::ReadScalarField(in, tag, out_inout);
+        break;
+      default:
+        ok = ::protobuf::wire::SkipField(in, tag);
+        break;
+    }
+  }
+  return ok && in.ConsumedEntireMessage();
+}
+inline void MyOperationInWireSerialize(const ::std::uint64_t& in_in, const ::std::uint64_t& in_inout, std::uint8_t* data, std::size_t size) {
+  ::protobuf::wire::SerializeToArray(data, size, [&](::protobuf::wire::CodedOutputStream& out) {
+    MyOperationInWireWrite(in_in, in_inout, out);
+  });
+}
+inline bool MyOperationInWireParse(const std::uint8_t* data, std::size_t size, ::std::uint64_t& out_in, ::std::uint64_t& out_inout) {
+  return ::protobuf::wire::ParseFromArray(data, size, [&](::protobuf::wire::CodedInputStream& in) {
+    return MyOperationInWireRead(in, out_in, out_inout);
+  });
+}
+inline std::size_t MyGetterOutWireSize(const ::test::MyGetter::Output &in) {
+  std::size_t size{0u};
+  size += ::protobuf::wire::ScalarFieldSize(1u, in.a);
+  return size;
+}
+inline void MyGetterOutWireWrite(const ::test::MyGetter::Output &in, ::protobuf::wire::CodedOutputStream &out) {
+  ::protobuf::wire::WriteScalarField(1u, in.a, out);
+}
+inline bool MyGetterOutWireRead(::protobuf::wire::CodedInputStream &in, ::test::MyGetter::Output &out) {
+  bool ok{true};
+  for (std::uint32_t tag{::protobuf::wire::ReadTag(in)}; ok && (tag != 0u); tag = ::protobuf::wire::ReadTag(in)) {
+    switch (::protobuf::wire::FieldNumber(tag)) {
+      case 1u:
+        ok = ::protobuf::wire::ReadScalarField(in, tag, out.a);
+        break;
+      default:
+        ok = ::protobuf::wire::SkipField(in, tag);
+        break;
+    }
+  }
+  return ok && in.ConsumedEntireMessage();
+}
+inline void MyGetterOutWireSerialize(const ::test::MyGetter::Output &in, std::uint8_t* data, std::size_t size) {
+  ::protobuf::wire::SerializeToArray(data, size, [&](::protobuf::wire::CodedOutputStream& out) {
+    MyGetterOutWireWrite(in, out);
+  });
+}
+inline bool MyGetterOutWireParse(const std::uint8_t* data, std::size_t size, ::test::MyGetter::Output &out) {
+  return ::protobuf::wire::ParseFromArray(data, size, [&](::protobuf::wire::CodedInputStream& in) {
+    return MyGetterOutWireRead(in, out);
+  });
+}
+inline std::size_t MySetterInWireSize(const ::std::uint64_t& in_a) {
+  std::size_t size{0u};
+  size += ::protobuf::wire::ScalarFieldSize(1u, in_a);
+  return size;
+}
+inline void MySetterInWireWrite(const ::std::uint64_t& in_a, ::protobuf::wire::CodedOutputStream &out) {
+  ::protobuf::wire::WriteScalarField(1u, in_a, out);
+}
+inline bool MySetterInWireRead(::protobuf::wire::CodedInputStream &in, ::std::uint64_t& out_a) {
+  bool ok{true};
+  for (std::uint32_t tag{::protobuf::wire::ReadTag(in)}; ok && (tag != 0u); tag = ::protobuf::wire::ReadTag(in)) {
+    switch (::protobuf::wire::FieldNumber(tag)) {
+      case 1u:
+        ok = ::protobuf::wire::ReadScalarField(in, tag, out_a);
+        break;
+      default:
+        ok = ::protobuf::wire::SkipField(in, tag);
+        break;
+    }
+  }
+  return ok && in.ConsumedEntireMessage();
+}
+inline void MySetterInWireSerialize(const ::std::uint64_t& in_a, std::uint8_t* data, std::size_t size) {
+  ::protobuf::wire::SerializeToArray(data, size, [&](::protobuf::wire::CodedOutputStream& out) {
+    MySetterInWireWrite(in_a, out);
+  });
+}
+inline bool MySetterInWireParse(const std::uint8_t* data, std::size_t size, ::std::uint64_t& out_a) {
+  return ::protobuf::wire::ParseFromArray(data, size, [&](::protobuf::wire::CodedInputStream& in) {
+    return MySetterInWireRead(in, out_a);
+  });
+}
+
+} // namespace MyInterface
+} // namespace test
+} // namespace interface
+} // namespace protobuf
+
+#endif // PROTOBUF_INTERFACE_TEST_MYINTERFACE_PROTOBUF_CODEC_H
@@ -17,6 +17,7 @@
 #define PROTOBUF_INTERFACE_TEST_MYINTERFACE_PROTOBUF_TRANSFORMER_H
 
 #include "protobuf_interface_test_MyInterface.pb.h"
+#include <utility>
 #include "test/my_operation.h"
 #include "test/my_getter.h"
 
@@ -43,6 +44,9 @@ inline void MyVoidOperationInVafToProto(const ::std::uint64_t& in_in, MyVoidOper
 inline void MyVoidOperationInProtoToVaf(const MyVoidOperation_in &in, ::std::uint64_t& out_in) {
   out_in = in.in();
 }
+inline void MyVoidOperationInProtoToVaf(MyVoidOperation_in &&in, ::std::uint64_t& out_in) {
+  out_in = in.in();
+}
 inline void MyOperationOutVafToProto(const ::test::MyOperation::Output &in, MyOperation_out &out) {
   out.set_out(in.out);
   out.set_inout(in.inout);
@@ -51,6 +55,10 @@ inline void MyOperationOutProtoToVaf(const MyOperation_out &in, ::test::MyOperat
   out.out = in.out();
   out.inout = in.inout();
 }
+inline void MyOperationOutProtoToVaf(MyOperation_out &&in, ::test::MyOperation::Output &out) {
+  out.out = in.out();
+  out.inout = in.inout();
+}
 inline void MyOperationInVafToProto(const ::std::uint64_t& in_in, const ::std::uint64_t& in_inout, MyOperation_in &out){
   out.set_in(in_in);
   out.set_inout(in_inout);
@@ -59,18 +67,28 @@ inline void MyOperationInProtoToVaf(const MyOperation_in &in, ::std::uint64_t& o
   out_in = in.in();
   out_inout = in.inout();
 }
+inline void MyOperationInProtoToVaf(MyOperation_in &&in, ::std::uint64_t& out_in, ::std::uint64_t& out_inout) {
+  out_in = in.in();
+  out_inout = in.inout();
+}
 inline void MyGetterOutVafToProto(const ::test::MyGetter::Output &in, MyGetter_out &out) {
   out.set_a(in.a);
 }
 inline void MyGetterOutProtoToVaf(const MyGetter_out &in, ::test::MyGetter::Output &out) {
   out.a = in.a();
 }
+inline void MyGetterOutProtoToVaf(MyGetter_out &&in, ::test::MyGetter::Output &out) {
+  out.a = in.a();
+}
 inline void MySetterInVafToProto(const ::std::uint64_t& in_a, MySetter_in &out){
   out.set_a(in_a);
 }
 inline void MySetterInProtoToVaf(const MySetter_in &in, ::std::uint64_t& out_a) {
   out_a = in.a();
 }
+inline void MySetterInProtoToVaf(MySetter_in &&in, ::std::uint64_t& out_a) {
+  out_a = in.a();
+}
 
 } // namespace MyInterface
 } // namespace test
@@ -26,8 +26,10 @@
 #include "test/impl_type_mytyperef.h"
 #include "test/impl_type_myvector.h"
 #include "test2/impl_type_mystruct.h"
-#include <cstdlib>
 #include "vaf/output_sync_stream.h"
+#include <algorithm>
+#include <cstdlib>
+#include <utility>
 
 namespace protobuf {
 namespace test {
@@ -38,66 +40,81 @@ void MyVectorVafToProto(const ::test::MyVector &in, MyVector &out);
 void MyVectorProtoToVaf(const MyVector &in, ::test::MyVector &out);
 void MyMapVafToProto(const ::test::MyMap &in, MyMap &out);
 void MyMapProtoToVaf(const MyMap &in, ::test::MyMap &out);
+void MyMapProtoToVaf(MyMap &&in, ::test::MyMap &out);
 void MyStringVafToProto(const ::test::MyString &in, MyString &out);
 void MyStringProtoToVaf(const MyString &in, ::test::MyString &out);
+void MyStringProtoToVaf(MyString &&in, ::test::MyString &out);
 void MyEnumVafToProto(const ::test::MyEnum &in, MyEnum &out);
 void MyEnumProtoToVaf(const MyEnum &in, ::test::MyEnum &out);
 void MyStructVafToProto(const ::test::MyStruct &in, MyStruct &out);
 void MyStructProtoToVaf(const MyStruct &in, ::test::MyStruct &out);
+void MyStructProtoToVaf(MyStruct &&in, ::test::MyStruct &out);
 void MyTypeRefVafToProto(const ::test::MyTypeRef &in, MyTypeRef &out);
 void MyTypeRefProtoToVaf(const MyTypeRef &in, ::test::MyTypeRef &out);
 inline void MyArrayVafToProto(const ::test::MyArray &in, MyArray &out) {
   out.Clear();
-  for (int i=0;i<in.size();i++) {
-    out.mutable_vaf_value_internal()->Add(in[i]);
-  }
+  out.mutable_vaf_value_internal()->Add(in.begin(), in.end());
 }
 inline void MyArrayProtoToVaf(const MyArray &in, ::test::MyArray &out) {
-  for (int i=0;i<out.size();i++) {
-    out[i]=in.vaf_value_internal()[i];
-  }
+  // Elements missing in the message keep their value
+  const std::size_t size{std::min(out.size(), static_cast<std::size_t>(in.vaf_value_internal_size()))};
+  std::copy_n(in.vaf_value_internal().data(), size, out.begin());
 }
 inline void MyVectorVafToProto(const ::test::MyVector &in, MyVector &out) {
   out.Clear();
-  for (auto element_in :in) {
-      out.mutable_vaf_value_internal()->Add(element_in);
-  }
+  out.mutable_vaf_value_internal()->Add(in.begin(), in.end());
 }
 inline void MyVectorProtoToVaf(const MyVector &in, ::test::MyVector &out) {
-  out.clear();
-  for (auto element_in :in.vaf_value_internal()) {
-    out.push_back(element_in);
-  }
+  // Packed elements are copied in one go, which is a memcpy if the element types match
+  const auto &elements_in = in.vaf_value_internal();
+  out.assign(elements_in.data(), elements_in.data() + elements_in.size());
 }
-inline void MyMapEntryVafToProto(const ::std::uint64_t &in_key, ::test::MyString &in_value,  MyMapEntry &out) {
+inline void MyMapEntryVafToProto(const ::std::uint64_t &in_key, const ::test::MyString &in_value, MyMapEntry &out) {
   out.set_vaf_key_internal(in_key);
   ::protobuf::test::MyStringVafToProto(in_value, *out.mutable_vaf_value_internal());
 }
-inline void MyMapEntryProtoToVaf(const MyMapEntry &in, ::std::uint64_t &out_key, ::test::MyString &out_value) {
-  out_key = in.vaf_key_internal();
-  ::protobuf::test::MyStringProtoToVaf(in.vaf_value_internal(), out_value);
-}
 inline void MyMapVafToProto(const ::test::MyMap &in, MyMap &out) {
   out.Clear();
-  for (auto in_entry: in) {
-    MyMapEntry out_entry{};
-    MyMapEntryVafToProto(in_entry.first, in_entry.second, out_entry);
-    out.mutable_vaf_entry_internal()->Add(std::move(out_entry));
+  auto *entries_out = out.mutable_vaf_entry_internal();
+  entries_out->Reserve(static_cast<int>(in.size()));
+  for (const auto &in_entry : in) {
+    MyMapEntryVafToProto(in_entry.first, in_entry.second, *entries_out->Add());
   }
 }
+inline void MyMapEntryProtoToVaf(const MyMapEntry &in, ::std::uint64_t &out_key, ::test::MyString &out_value) {
+  out_key = in.vaf_key_internal();
+  ::protobuf::test::MyStringProtoToVaf(in.vaf_value_internal(), out_value);
+}
 inline void MyMapProtoToVaf(const MyMap &in, ::test::MyMap &out) {
   out.clear();
-  for (auto in_entry: in.vaf_entry_internal()) {
+  for (const auto &in_entry : in.vaf_entry_internal()) {
     std::pair<::std::uint64_t, ::test::MyString> out_entry{};
     MyMapEntryProtoToVaf(in_entry, out_entry.first, out_entry.second);
-    out.insert(std::move(out_entry));
+    // Entries are sent in the order of the map, so the end is the right hint
+    out.emplace_hint(out.end(), std::move(out_entry));
+  }
+}
+inline void MyMapEntryProtoToVaf(MyMapEntry &&in, ::std::uint64_t &out_key, ::test::MyString &out_value) {
+  out_key = in.vaf_key_internal();
+  ::protobuf::test::MyStringProtoToVaf(std::move(*in.mutable_vaf_value_internal()), out_value);
+}
+inline void MyMapProtoToVaf(MyMap &&in, ::test::MyMap &out) {
+  out.clear();
+  for (auto &in_entry : *in.mutable_vaf_entry_internal()) {
+    std::pair<::std::uint64_t, ::test::MyString> out_entry{};
+    MyMapEntryProtoToVaf(std::move(in_entry), out_entry.first, out_entry.second);
+    // Entries are sent in the order of the map, so the end is the right hint
+    out.emplace_hint(out.end(), std::move(out_entry));
   }
 }
 inline void MyStringVafToProto(const ::test::MyString &in, MyString &out) {
-    (*out.mutable_vaf_value_internal()) = in.c_str();
+  out.mutable_vaf_value_internal()->assign(in.data(), in.size());
 }
 inline void MyStringProtoToVaf(const MyString &in, ::test::MyString &out) {
-    out = in.vaf_value_internal();
+  out = in.vaf_value_internal();
+}
+inline void MyStringProtoToVaf(MyString &&in, ::test::MyString &out) {
+  out = std::move(*in.mutable_vaf_value_internal());
 }
 inline void MyEnumVafToProto(const ::test::MyEnum &in, MyEnum &out) {
     out.set_vaf_value_internal(static_cast<typename std::underlying_type<::test::MyEnum>::type>(in));
@@ -113,6 +130,10 @@ inline void MyStructProtoToVaf(const MyStruct &in, ::test::MyStruct &out) {
   ::protobuf::test2::MyStructProtoToVaf(in.mysub1(), out.MySub1);
   ::protobuf::test::MyVectorProtoToVaf(in.mysub2(), out.MySub2);
 }
+inline void MyStructProtoToVaf(MyStruct &&in, ::test::MyStruct &out) {
+  ::protobuf::test2::MyStructProtoToVaf(std::move(*in.mutable_mysub1()), out.MySub1);
+  ::protobuf::test::MyVectorProtoToVaf(std::move(*in.mutable_mysub2()), out.MySub2);
+}
 inline void MyTypeRefVafToProto(const ::test::MyTypeRef &in, MyTypeRef &out) {
   out.set_vaf_value_internal(in);
 }
@@ -0,0 +1,118 @@
+/*!********************************************************************************************************************
+ *  COPYRIGHT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  Copyright (c) 2024-2026 by Vector Informatik GmbH. All rights reserved.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -----------------------------------------------------------------------------------------------------------------*/
+/*!        \file  protobuf_codec.h
+ *         \brief
+ *
+ *********************************************************************************************************************/
+
+#ifndef PROTOBUF_TEST2_PROTOBUF_CODEC_H
+#define PROTOBUF_TEST2_PROTOBUF_CODEC_H
+
+#include "protobuf/wire/codec.h"
+#include "test2/impl_type_myarray.h"
+#include "test2/impl_type_mystruct.h"
+#include "test2/impl_type_myvector.h"
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+namespace protobuf {
+namespace test2 {
+
+std::size_t MyArrayWireSize(const ::test2::MyArray &in);
+void MyArrayWireWrite(const ::test2::MyArray &in, ::protobuf::wire::CodedOutputStream &out);
+bool MyArrayWireRead(::protobuf::wire::CodedInputStream &in, ::test2::MyArray &out);
+std::size_t MyVectorWireSize(const ::test2::MyVector &in);
+void MyVectorWireWrite(const ::test2::MyVector &in, ::protobuf::wire::CodedOutputStream &out);
+bool MyVectorWireRead(::protobuf::wire::CodedInputStream &in, ::test2::MyVector &out);
+std::size_t MyStructWireSize(const ::test2::MyStruct &in);
+void MyStructWireWrite(const ::test2::MyStruct &in, ::protobuf::wire::CodedOutputStream &out);
+bool MyStructWireRead(::protobuf::wire::CodedInputStream &in, ::test2::MyStruct &out);
+inline std::size_t MyArrayWireSize(const ::test2::MyArray &in) {
+  return ::protobuf::wire::PackedFieldSize(1u, in);
+}
+inline void MyArrayWireWrite(const ::test2::MyArray &in, ::protobuf::wire::CodedOutputStream &out) {
+  ::protobuf::wire::WritePackedField(1u, in, out);
+}
+inline bool MyArrayWireRead(::protobuf::wire::CodedInputStream &in, ::test2::MyArray &out) {
+  // Elements missing in the message keep their value, elements beyond the array are dropped
+  std::size_t count{0u};
+  bool ok{true};
+  for (std::uint32_t tag{::protobuf::wire::ReadTag(in)}; ok && (tag != 0u); tag = ::protobuf::wire::ReadTag(in)) {
+    switch (::protobuf::wire::FieldNumber(tag)) {
+      case 1u:
+        ok = ::protobuf::wire::ReadRepeatedScalarArrayField(in, tag, out, count);
+        break;
+      default:
+        ok = ::protobuf::wire::SkipField(in, tag);
+        break;
+    }
+  }
+  return ok && in.ConsumedEntireMessage();
+}
+inline std::size_t MyVectorWireSize(const ::test2::MyVector &in) {
+  return ::protobuf::wire::StringFieldSize(1u, in);
+}
+inline void MyVectorWireWrite(const ::test2::MyVector &in, ::protobuf::wire::CodedOutputStream &out) {
+  ::protobuf::wire::WriteStringField(1u, in, out);
+}
+inline bool MyVectorWireRead(::protobuf::wire::CodedInputStream &in, ::test2::MyVector &out) {
+  bool ok{true};
+  for (std::uint32_t tag{::protobuf::wire::ReadTag(in)}; ok && (tag != 0u); tag = ::protobuf::wire::ReadTag(in)) {
+    switch (::protobuf::wire::FieldNumber(tag)) {
+      case 1u:
+        ok = ::protobuf::wire::ReadStringField(in, tag, out);
+        break;
+      default:
+        ok = ::protobuf::wire::SkipField(in, tag);
+        break;
+    }
+  }
+  return ok && in.ConsumedEntireMessage();
+}
+inline std::size_t MyStructWireSize(const ::test2::MyStruct &in) {
+  std::size_t size{0u};
+  size += ::protobuf::wire::MessageFieldSize(1u, ::protobuf::test2::MyStructWireSize(in.MySub1));
+  size += ::protobuf::wire::MessageFieldSize(2u, ::protobuf::test2::MyVectorWireSize(in.MySub2));
+  return size;
+}
+inline void MyStructWireWrite(const ::test2::MyStruct &in, ::protobuf::wire::CodedOutputStream &out) {
+  ::protobuf::wire::WriteMessageHeader(1u, ::protobuf::test2::MyStructWireSize(in.MySub1), out);
+  ::protobuf::test2::MyStructWireWrite(in.MySub1, out);
+  ::protobuf::wire::WriteMessageHeader(2u, ::protobuf::test2::MyVectorWireSize(in.MySub2), out);
+  ::protobuf::test2::MyVectorWireWrite(in.MySub2, out);
+}
+inline bool MyStructWireRead(::protobuf::wire::CodedInputStream &in, ::test2::MyStruct &out) {
+  bool ok{true};
+  for (std::uint32_t tag{::protobuf::wire::ReadTag(in)}; ok && (tag != 0u); tag = ::protobuf::wire::ReadTag(in)) {
+    switch (::protobuf::wire::FieldNumber(tag)) {
+      case 1u:
+        ok = ::protobuf::wire::ReadMessageField(in, tag, [&](::protobuf::wire::CodedInputStream& message_in) {
+          return ::protobuf::test2::MyStructWireRead(message_in, out.MySub1);
+        });
+        break;
+      case 2u:
+        ok = ::protobuf::wire::ReadMessageField(in, tag, [&](::protobuf::wire::CodedInputStream& message_in) {
+          return ::protobuf::test2::MyVectorWireRead(message_in, out.MySub2);
+        });
+        break;
+      default:
+        ok = ::protobuf::wire::SkipField(in, tag);
+        break;
+    }
+  }
+  return ok && in.ConsumedEntireMessage();
+}
+
+} // namespace test2
+} // namespace protobuf
+
+#endif // PROTOBUF_TEST2_PROTOBUF_CODEC_H
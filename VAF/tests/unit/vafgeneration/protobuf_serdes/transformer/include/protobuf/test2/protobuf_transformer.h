@@ -20,8 +20,6 @@
 #include "test2/impl_type_myarray.h"
 #include "test2/impl_type_mystruct.h"
 #include "test2/impl_type_myvector.h"
-#include "vaf/output_sync_stream.h"
-#include <cstdlib>
 
 namespace protobuf {
 namespace test2 {
@@ -32,37 +30,7 @@ void MyVectorVafToProto(const ::test2::MyVector &in, MyVector &out);
 void MyVectorProtoToVaf(const MyVector &in, ::test2::MyVector &out);
 void MyStructVafToProto(const ::test2::MyStruct &in, MyStruct &out);
 void MyStructProtoToVaf(const MyStruct &in, ::test2::MyStruct &out);
-inline void MyArrayVafToProto(const ::test2::MyArray &in, MyArray &out) {
-  out.Clear();
-  for (int i=0;i<in.size();i++) {
-    out.mutable_vaf_value_internal()->Add(in[i]);
-  }
-}
-inline void MyArrayProtoToVaf(const MyArray &in, ::test2::MyArray &out) {
-  for (int i=0;i<out.size();i++) {
-    out[i]=in.vaf_value_internal()[i];
-  }
-}
-inline void MyVectorVafToProto(const ::test2::MyVector &in, MyVector &out) {
-  out.Clear();
-  for (auto element_in :in) {
-      out.mutable_vaf_value_internal()->Add(element_in);
-  }
-}
-inline void MyVectorProtoToVaf(const MyVector &in, ::test2::MyVector &out) {
-  out.clear();
-  for (auto element_in :in.vaf_value_internal()) {
-    out.push_back(element_in);
-  }
-}
-inline void MyStructVafToProto(const ::test2::MyStruct &in, MyStruct &out) {
-  ::protobuf::test2::MyStructVafToProto(in.MySub1, *out.mutable_mysub1());
-  ::protobuf::test2::MyVectorVafToProto(in.MySub2, *out.mutable_mysub2());
-}
-inline void MyStructProtoToVaf(const MyStruct &in, ::test2::MyStruct &out) {
-  ::protobuf::test2::MyStructProtoToVaf(in.mysub1(), out.MySub1);
-  ::protobuf::test2::MyVectorProtoToVaf(in.mysub2(), out.MySub2);
-}
+void MyStructProtoToVaf(MyStruct &&in, ::test2::MyStruct &out);
 
 } // namespace test2
 } // namespace protobuf
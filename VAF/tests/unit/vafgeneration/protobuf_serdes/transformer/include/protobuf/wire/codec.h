@@ -0,0 +1,581 @@
+/*!********************************************************************************************************************
+ *  COPYRIGHT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  Copyright (c) 2024-2026 by Vector Informatik GmbH. All rights reserved.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -----------------------------------------------------------------------------------------------------------------*/
+/*!        \file  codec.h
+ *         \brief
+ *
+ *********************************************************************************************************************/
+
+#ifndef PROTOBUF_WIRE_CODEC_H
+#define PROTOBUF_WIRE_CODEC_H
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/io/zero_copy_stream_impl_lite.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+namespace protobuf {
+namespace wire {
+
+/*
+ * Building blocks of the direct codecs in protobuf_codec.h. They write the protobuf wire format of a VAF type
+ * without an intermediate protobuf message and produce the same bytes as the generated protobuf classes:
+ * fields in the order of their number, implicit presence fields only if they differ from the default,
+ * repeated scalars packed and sub messages always, as the transformers always set them.
+ */
+
+using google::protobuf::io::CodedInputStream;
+using google::protobuf::io::CodedOutputStream;
+
+enum class WireType : std::uint32_t {
+  kVarint = 0,
+  kFixed64 = 1,
+  kLengthDelimited = 2,
+  kStartGroup = 3,
+  kEndGroup = 4,
+  kFixed32 = 5
+};
+
+constexpr std::uint32_t MakeTag(std::uint32_t field, WireType wire_type) {
+  return (field << 3u) | static_cast<std::uint32_t>(wire_type);
+}
+
+constexpr std::uint32_t FieldNumber(std::uint32_t tag) { return tag >> 3u; }
+
+constexpr WireType WireTypeOf(std::uint32_t tag) { return static_cast<WireType>(tag & 7u); }
+
+inline std::size_t TagSize(std::uint32_t field) { return CodedOutputStream::VarintSize32(field << 3u); }
+
+/*!
+ * \brief Encoding of a C++ base type, following the protobuf type it is mapped to in the proto files.
+ */
+template <typename T>
+struct Scalar;
+
+template <typename T>
+struct UnsignedVarint32Scalar {
+  static constexpr WireType kWireType{WireType::kVarint};
+  static std::size_t Size(T value) { return CodedOutputStream::VarintSize32(static_cast<std::uint32_t>(value)); }
+  static void Write(T value, CodedOutputStream& out) { out.WriteVarint32(static_cast<std::uint32_t>(value)); }
+  static bool Read(CodedInputStream& in, T& value) {
+    std::uint32_t raw{};
+    const bool ok{in.ReadVarint32(&raw)};
+    value = static_cast<T>(raw);
+    return ok;
+  }
+};
+
+template <typename T>
+struct SignedVarint32Scalar {
+  static constexpr WireType kWireType{WireType::kVarint};
+  // Negative values are sign extended to ten bytes, like protobuf does for int32
+  static std::size_t Size(T value) {
+    return CodedOutputStream::VarintSize32SignExtended(static_cast<std::int32_t>(value));
+  }
+  static void Write(T value, CodedOutputStream& out) {
+    out.WriteVarint32SignExtended(static_cast<std::int32_t>(value));
+  }
+  static bool Read(CodedInputStream& in, T& value) {
+    std::uint32_t raw{};
+    const bool ok{in.ReadVarint32(&raw)};
+    value = static_cast<T>(static_cast<std::int32_t>(raw));
+    return ok;
+  }
+};
+
+template <typename T>
+struct Varint64Scalar {
+  static constexpr WireType kWireType{WireType::kVarint};
+  static std::size_t Size(T value) { return CodedOutputStream::VarintSize64(static_cast<std::uint64_t>(value)); }
+  static void Write(T value, CodedOutputStream& out) { out.WriteVarint64(static_cast<std::uint64_t>(value)); }
+  static bool Read(CodedInputStream& in, T& value) {
+    std::uint64_t raw{};
+    const bool ok{in.ReadVarint64(&raw)};
+    value = static_cast<T>(raw);
+    return ok;
+  }
+};
+
+template <typename T, typename Bits, WireType kType>
+struct FixedScalar {
+  static constexpr WireType kWireType{kType};
+  static std::size_t Size(T /*value*/) { return sizeof(Bits); }
+  static void Write(T value, CodedOutputStream& out) {
+    Bits bits{};
+    std::memcpy(&bits, &value, sizeof(bits));
+    if constexpr (sizeof(Bits) == 4u) {
+      out.WriteLittleEndian32(bits);
+    } else {
+      out.WriteLittleEndian64(bits);
+    }
+  }
+  static bool Read(CodedInputStream& in, T& value) {
+    Bits bits{};
+    bool ok{};
+    if constexpr (sizeof(Bits) == 4u) {
+      ok = in.ReadLittleEndian32(&bits);
+    } else {
+      ok = in.ReadLittleEndian64(&bits);
+    }
+    std::memcpy(&value, &bits, sizeof(bits));
+    return ok;
+  }
+};
+
+template <>
+struct Scalar<std::uint8_t> : UnsignedVarint32Scalar<std::uint8_t> {};
+template <>
+struct Scalar<std::uint16_t> : UnsignedVarint32Scalar<std::uint16_t> {};
+template <>
+struct Scalar<std::uint32_t> : UnsignedVarint32Scalar<std::uint32_t> {};
+template <>
+struct Scalar<std::uint64_t> : Varint64Scalar<std::uint64_t> {};
+template <>
+struct Scalar<std::int8_t> : SignedVarint32Scalar<std::int8_t> {};
+template <>
+struct Scalar<std::int16_t> : SignedVarint32Scalar<std::int16_t> {};
+template <>
+struct Scalar<std::int32_t> : SignedVarint32Scalar<std::int32_t> {};
+template <>
+struct Scalar<std::int64_t> : Varint64Scalar<std::int64_t> {};
+template <>
+struct Scalar<float> : FixedScalar<float, std::uint32_t, WireType::kFixed32> {};
+template <>
+struct Scalar<double> : FixedScalar<double, std::uint64_t, WireType::kFixed64> {};
+template <>
+struct Scalar<bool> {
+  static constexpr WireType kWireType{WireType::kVarint};
+  static std::size_t Size(bool /*value*/) { return 1u; }
+  static void Write(bool value, CodedOutputStream& out) { out.WriteVarint32(value ? 1u : 0u); }
+  static bool Read(CodedInputStream& in, bool& value) {
+    std::uint64_t raw{};
+    const bool ok{in.ReadVarint64(&raw)};
+    value = raw != 0u;
+    return ok;
+  }
+};
+
+#if defined(_WIN32) || (defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__))
+constexpr bool kLittleEndianHost{true};
+#else
+constexpr bool kLittleEndianHost{false};
+#endif
+
+/*!
+ * \brief Checks if the wire format of a scalar is its in-memory layout, which holds for the little endian fixed width
+ * types on little endian hosts. Packed fields of such scalars are copied in one go instead of element by element.
+ */
+template <typename T>
+struct IsRawScalar
+    : std::integral_constant<bool, kLittleEndianHost && ((Scalar<T>::kWireType == WireType::kFixed32) ||
+                                                         (Scalar<T>::kWireType == WireType::kFixed64))> {};
+
+/*!
+ * \brief Checks if a value is the default of an implicit presence field, which protobuf does not send.
+ * Floating point values are compared by their bits, so -0.0 is sent.
+ */
+template <typename T>
+bool IsDefault(T value) {
+  if constexpr (std::is_floating_point<T>::value) {
+    const T zero{};
+    return std::memcmp(&value, &zero, sizeof(T)) == 0;
+  } else {
+    return value == T{};
+  }
+}
+
+template <typename T>
+std::size_t ScalarFieldSize(std::uint32_t field, T value) {
+  return IsDefault(value) ? 0u : TagSize(field) + Scalar<T>::Size(value);
+}
+
+template <typename T>
+void WriteScalarField(std::uint32_t field, T value, CodedOutputStream& out) {
+  if (!IsDefault(value)) {
+    out.WriteTag(MakeTag(field, Scalar<T>::kWireType));
+    Scalar<T>::Write(value, out);
+  }
+}
+
+// Optional fields have explicit presence and are sent whenever they hold a value
+template <typename Optional>
+std::size_t OptionalScalarFieldSize(std::uint32_t field, const Optional& value) {
+  using T = typename Optional::value_type;
+  return value.has_value() ? TagSize(field) + Scalar<T>::Size(*value) : 0u;
+}
+
+template <typename Optional>
+void WriteOptionalScalarField(std::uint32_t field, const Optional& value, CodedOutputStream& out) {
+  using T = typename Optional::value_type;
+  if (value.has_value()) {
+    out.WriteTag(MakeTag(field, Scalar<T>::kWireType));
+    Scalar<T>::Write(*value, out);
+  }
+}
+
+template <typename Container>
+std::size_t PackedSize(const Container& values) {
+  using T = typename Container::value_type;
+  if constexpr (IsRawScalar<T>::value) {
+    return values.size() * sizeof(T);
+  }
+  std::size_t size{0u};
+  for (const auto value : values) {
+    size += Scalar<typename Container::value_type>::Size(value);
+  }
+  return size;
+}
+
+template <typename Container>
+std::size_t PackedFieldSize(std::uint32_t field, const Container& values) {
+  const std::size_t size{PackedSize(values)};
+  return size == 0u ? 0u : TagSize(field) + CodedOutputStream::VarintSize32(static_cast<std::uint32_t>(size)) + size;
+}
+
+template <typename Container>
+void WritePackedField(std::uint32_t field, const Container& values, CodedOutputStream& out) {
+  const std::size_t size{PackedSize(values)};
+  if (size != 0u) {
+    out.WriteTag(MakeTag(field, WireType::kLengthDelimited));
+    out.WriteVarint32(static_cast<std::uint32_t>(size));
+    if constexpr (IsRawScalar<typename Container::value_type>::value) {
+      out.WriteRaw(values.data(), static_cast<int>(size));
+    } else {
+      for (const auto value : values) {
+        Scalar<typename Container::value_type>::Write(value, out);
+      }
+    }
+  }
+}
+
+template <typename String>
+std::size_t StringFieldSize(std::uint32_t field, const String& value) {
+  return value.empty()
+             ? 0u
+             : TagSize(field) + CodedOutputStream::VarintSize32(static_cast<std::uint32_t>(value.size())) + value.size();
+}
+
+template <typename String>
+void WriteStringField(std::uint32_t field, const String& value, CodedOutputStream& out) {
+  if (!value.empty()) {
+    out.WriteTag(MakeTag(field, WireType::kLengthDelimited));
+    out.WriteVarint32(static_cast<std::uint32_t>(value.size()));
+    out.WriteRaw(value.data(), static_cast<int>(value.size()));
+  }
+}
+
+inline std::size_t MessageFieldSize(std::uint32_t field, std::size_t size) {
+  return TagSize(field) + CodedOutputStream::VarintSize32(static_cast<std::uint32_t>(size)) + size;
+}
+
+// The body of the sub message follows the header
+inline void WriteMessageHeader(std::uint32_t field, std::size_t size, CodedOutputStream& out) {
+  out.WriteTag(MakeTag(field, WireType::kLengthDelimited));
+  out.WriteVarint32(static_cast<std::uint32_t>(size));
+}
+
+/*!
+ * \brief Reads the tag of the next field, as strict as the protobuf parser, which rejects tags longer than five bytes.
+ * \param in The input stream
+ * \return Zero at the end of the message, a tag of field number zero, which SkipField rejects, for malformed input
+ */
+inline std::uint32_t ReadTag(CodedInputStream& in) {
+  constexpr int kMaxTagSize{5};
+  constexpr std::uint32_t kMalformedTag{7u};
+  if (in.ExpectAtEnd()) {
+    return 0u;
+  }
+  const int start{in.CurrentPosition()};
+  std::uint64_t tag{};
+  const bool ok{in.ReadVarint64(&tag) && ((in.CurrentPosition() - start) <= kMaxTagSize) && (tag != 0u)};
+  return ok ? static_cast<std::uint32_t>(tag) : kMalformedTag;
+}
+
+/*!
+ * \brief Reads the length of a length delimited field.
+ * \param in The input stream, which is always within a limit while parsing
+ * \param size The length
+ * \return False for malformed input and lengths beyond the enclosing message
+ */
+inline bool ReadLength(CodedInputStream& in, std::uint32_t& size) {
+  // Read all ten bytes a varint may have, a truncated overlong length must not pass as a short one
+  std::uint64_t length{};
+  const bool ok{in.ReadVarint64(&length) && (length <= static_cast<std::uint64_t>(in.BytesUntilLimit()))};
+  size = static_cast<std::uint32_t>(length);
+  return ok;
+}
+
+/*!
+ * \brief Skips a field that is unknown or does not have the expected wire type, like the protobuf parser does.
+ * \param in The input stream
+ * \param tag The tag of the field
+ * \return False for malformed input and field number zero
+ */
+inline bool SkipField(CodedInputStream& in, std::uint32_t tag) {
+  bool ok{false};
+  if (FieldNumber(tag) == 0u) {
+    return ok;
+  }
+  switch (WireTypeOf(tag)) {
+    case WireType::kVarint: {
+      std::uint64_t value{};
+      ok = in.ReadVarint64(&value);
+      break;
+    }
+    case WireType::kFixed64:
+      ok = in.Skip(8);
+      break;
+    case WireType::kLengthDelimited: {
+      std::uint32_t size{};
+      ok = ReadLength(in, size) && in.Skip(static_cast<int>(size));
+      break;
+    }
+    case WireType::kStartGroup: {
+      // The proto files do not use groups, but the protobuf parser skips unknown ones up to their end tag
+      ok = in.IncrementRecursionDepth();
+      for (std::uint32_t group_tag{ReadTag(in)}; ok; group_tag = ReadTag(in)) {
+        if (WireTypeOf(group_tag) == WireType::kEndGroup) {
+          ok = FieldNumber(group_tag) == FieldNumber(tag);
+          break;
+        }
+        ok = (group_tag != 0u) && SkipField(in, group_tag);
+      }
+      in.DecrementRecursionDepth();
+      break;
+    }
+    case WireType::kFixed32:
+      ok = in.Skip(4);
+      break;
+    default:
+      break;
+  }
+  return ok;
+}
+
+template <typename T>
+bool ReadScalarField(CodedInputStream& in, std::uint32_t tag, T& value) {
+  return WireTypeOf(tag) == Scalar<T>::kWireType ? Scalar<T>::Read(in, value) : SkipField(in, tag);
+}
+
+template <typename Optional>
+bool ReadOptionalScalarField(CodedInputStream& in, std::uint32_t tag, Optional& value) {
+  using T = typename Optional::value_type;
+  if (WireTypeOf(tag) != Scalar<T>::kWireType) {
+    return SkipField(in, tag);
+  }
+  T read{};
+  if (!Scalar<T>::Read(in, read)) {
+    return false;
+  }
+  value = read;
+  return true;
+}
+
+/*!
+ * \brief Reads the elements of a repeated scalar field, packed or not, as the protobuf parser accepts both.
+ * \param in The input stream
+ * \param tag The tag of the field
+ * \param append Called with each element
+ * \return False for malformed input
+ */
+template <typename T, typename Append>
+bool ReadRepeatedScalarField(CodedInputStream& in, std::uint32_t tag, Append&& append) {
+  bool ok{true};
+  if (WireTypeOf(tag) == WireType::kLengthDelimited) {
+    std::uint32_t size{};
+    if (!ReadLength(in, size)) {
+      return false;
+    }
+    const CodedInputStream::Limit limit{in.PushLimit(static_cast<int>(size))};
+    while (ok && in.BytesUntilLimit() > 0) {
+      T value{};
+      ok = Scalar<T>::Read(in, value);
+      if (ok) {
+        append(value);
+      }
+    }
+    in.PopLimit(limit);
+  } else if (WireTypeOf(tag) == Scalar<T>::kWireType) {
+    T value{};
+    ok = Scalar<T>::Read(in, value);
+    if (ok) {
+      append(value);
+    }
+  } else {
+    ok = SkipField(in, tag);
+  }
+  return ok;
+}
+
+// Reads count packed raw scalars of which the first stored fit into data, the others are skipped
+template <typename T>
+bool ReadRawScalars(CodedInputStream& in, T* data, std::size_t stored, std::size_t count) {
+  return (stored == 0u || in.ReadRaw(data, static_cast<int>(stored * sizeof(T)))) &&
+         (stored == count || in.Skip(static_cast<int>((count - stored) * sizeof(T))));
+}
+
+/*!
+ * \brief Reads the elements of a repeated scalar field and appends them to a vector.
+ * Packed raw scalars are copied into the vector in one go, elements beyond the capacity of a vector with a MaxSize
+ * are dropped.
+ * \param in The input stream
+ * \param tag The tag of the field
+ * \param out The vector
+ * \return False for malformed input
+ */
+template <typename Vector>
+bool ReadRepeatedScalarVectorField(CodedInputStream& in, std::uint32_t tag, Vector& out) {
+  using T = typename Vector::value_type;
+  if constexpr (IsRawScalar<T>::value) {
+    if (WireTypeOf(tag) == WireType::kLengthDelimited) {
+      std::uint32_t size{};
+      if (!ReadLength(in, size) || ((size % sizeof(T)) != 0u)) {
+        return false;
+      }
+      const std::size_t count{size / sizeof(T)};
+      const std::size_t old_size{out.size()};
+      out.resize(old_size + count);
+      return ReadRawScalars(in, out.data() + old_size, out.size() - old_size, count);
+    }
+  }
+  return ReadRepeatedScalarField<T>(in, tag, [&out](T value) { out.push_back(value); });
+}
+
+/*!
+ * \brief Reads the elements of a repeated scalar field into an array, continuing after the elements read before.
+ * Packed raw scalars are copied into the array in one go, elements beyond the array are dropped.
+ * \param in The input stream
+ * \param tag The tag of the field
+ * \param out The array
+ * \param count The number of elements read so far, updated
+ * \return False for malformed input
+ */
+template <typename Array>
+bool ReadRepeatedScalarArrayField(CodedInputStream& in, std::uint32_t tag, Array& out, std::size_t& count) {
+  using T = typename Array::value_type;
+  if constexpr (IsRawScalar<T>::value) {
+    if (WireTypeOf(tag) == WireType::kLengthDelimited) {
+      std::uint32_t size{};
+      if (!ReadLength(in, size) || ((size % sizeof(T)) != 0u)) {
+        return false;
+      }
+      const std::size_t packed{size / sizeof(T)};
+      const std::size_t stored{std::min(packed, out.size() - count)};
+      const bool ok{ReadRawScalars(in, out.data() + count, stored, packed)};
+      count += stored;
+      return ok;
+    }
+  }
+  return ReadRepeatedScalarField<T>(in, tag, [&out, &count](T value) {
+    if (count < out.size()) {
+      out[count] = value;
+      ++count;
+    }
+  });
+}
+
+template <typename String>
+bool ReadStringField(CodedInputStream& in, std::uint32_t tag, String& value) {
+  if (WireTypeOf(tag) != WireType::kLengthDelimited) {
+    return SkipField(in, tag);
+  }
+  std::uint32_t size{};
+  if (!ReadLength(in, size)) {
+    return false;
+  }
+  // A string of a fixed capacity keeps the characters that fit and drops the rest
+  value.resize(size);
+  const std::size_t stored{value.size()};
+  return (stored == 0u || in.ReadRaw(&value[0], static_cast<int>(stored))) &&
+         (stored == size || in.Skip(static_cast<int>(size - stored)));
+}
+
+/*!
+ * \brief Reads a bytes field into a buffer of a fixed size, like the one of an array.
+ * Bytes missing in the field keep their value, bytes beyond the buffer are dropped.
+ * \param in The input stream
+ * \param tag The tag of the field
+ * \param data The buffer
+ * \param size The size of the buffer
+ * \return False for malformed input
+ */
+inline bool ReadFixedBytesField(CodedInputStream& in, std::uint32_t tag, std::uint8_t* data, std::size_t size) {
+  if (WireTypeOf(tag) != WireType::kLengthDelimited) {
+    return SkipField(in, tag);
+  }
+  std::uint32_t length{};
+  if (!ReadLength(in, length)) {
+    return false;
+  }
+  const std::size_t stored{std::min(static_cast<std::size_t>(length), size)};
+  return (stored == 0u || in.ReadRaw(data, static_cast<int>(stored))) &&
+         (stored == length || in.Skip(static_cast<int>(length - stored)));
+}
+
+/*!
+ * \brief Reads a sub message within its length.
+ * \param in The input stream
+ * \param tag The tag of the field
+ * \param read Reads the body of the sub message from the stream until it returns tag 0
+ * \return False for malformed input
+ */
+template <typename Read>
+bool ReadMessageField(CodedInputStream& in, std::uint32_t tag, Read&& read) {
+  if (WireTypeOf(tag) != WireType::kLengthDelimited) {
+    return SkipField(in, tag);
+  }
+  std::uint32_t size{};
+  if (!ReadLength(in, size) || !in.IncrementRecursionDepth()) {
+    return false;
+  }
+  const CodedInputStream::Limit limit{in.PushLimit(static_cast<int>(size))};
+  const bool ok{read(in) && in.BytesUntilLimit() == 0};
+  in.PopLimit(limit);
+  in.DecrementRecursionDepth();
+  return ok;
+}
+
+/*!
+ * \brief Writes a message with a direct codec into memory of exactly its size.
+ * \param data The memory
+ * \param size The size of the message
+ * \param write Writes the message to the stream
+ */
+template <typename Write>
+void SerializeToArray(std::uint8_t* data, std::size_t size, Write&& write) {
+  google::protobuf::io::ArrayOutputStream stream{data, static_cast<int>(size)};
+  CodedOutputStream out{&stream};
+  write(out);
+}
+
+/*!
+ * \brief Reads a message with a direct codec.
+ * \param data The serialized message
+ * \param size The size of the serialized message
+ * \param read Reads the message from the stream until it returns tag 0
+ * \return False for malformed input
+ */
+template <typename Read>
+bool ParseFromArray(const std::uint8_t* data, std::size_t size, Read&& read) {
+  CodedInputStream in{data, static_cast<int>(size)};
+  const CodedInputStream::Limit limit{in.PushLimit(static_cast<int>(size))};
+  const bool ok{read(in) && in.ConsumedEntireMessage()};
+  in.PopLimit(limit);
+  return ok;
+}
+
+} // namespace wire
+} // namespace protobuf
+
+#endif // PROTOBUF_WIRE_CODEC_H
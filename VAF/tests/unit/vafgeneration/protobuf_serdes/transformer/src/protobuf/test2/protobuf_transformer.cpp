@@ -0,0 +1,58 @@
+/*!********************************************************************************************************************
+ *  COPYRIGHT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  Copyright (c) 2024-2026 by Vector Informatik GmbH. All rights reserved.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -----------------------------------------------------------------------------------------------------------------*/
+/*!        \file  protobuf_transformer.cpp
+ *         \brief
+ *
+ *********************************************************************************************************************/
+
+#include "protobuf/test2/protobuf_transformer.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <type_traits>
+#include <utility>
+
+namespace protobuf {
+namespace test2 {
+
+void MyArrayVafToProto(const ::test2::MyArray &in, MyArray &out) {
+  out.Clear();
+  out.mutable_vaf_value_internal()->Add(in.begin(), in.end());
+}
+void MyArrayProtoToVaf(const MyArray &in, ::test2::MyArray &out) {
+  // Elements missing in the message keep their value
+  const std::size_t size{std::min(out.size(), static_cast<std::size_t>(in.vaf_value_internal_size()))};
+  std::copy_n(in.vaf_value_internal().data(), size, out.begin());
+}
+void MyVectorVafToProto(const ::test2::MyVector &in, MyVector &out) {
+  out.Clear();
+  out.mutable_vaf_value_internal()->assign(reinterpret_cast<const char *>(in.data()), in.size());
+}
+void MyVectorProtoToVaf(const MyVector &in, ::test2::MyVector &out) {
+  // The bytes are copied in one go
+  const auto *bytes_in = reinterpret_cast<const std::uint8_t *>(in.vaf_value_internal().data());
+  out.assign(bytes_in, bytes_in + in.vaf_value_internal().size());
+}
+void MyStructVafToProto(const ::test2::MyStruct &in, MyStruct &out) {
+  ::protobuf::test2::MyStructVafToProto(in.MySub1, *out.mutable_mysub1());
+  ::protobuf::test2::MyVectorVafToProto(in.MySub2, *out.mutable_mysub2());
+}
+void MyStructProtoToVaf(const MyStruct &in, ::test2::MyStruct &out) {
+  ::protobuf::test2::MyStructProtoToVaf(in.mysub1(), out.MySub1);
+  ::protobuf::test2::MyVectorProtoToVaf(in.mysub2(), out.MySub2);
+}
+void MyStructProtoToVaf(MyStruct &&in, ::test2::MyStruct &out) {
+  ::protobuf::test2::MyStructProtoToVaf(std::move(*in.mutable_mysub1()), out.MySub1);
+  ::protobuf::test2::MyVectorProtoToVaf(std::move(*in.mutable_mysub2()), out.MySub2);
+}
+
+} // namespace test2
+} // namespace protobuf
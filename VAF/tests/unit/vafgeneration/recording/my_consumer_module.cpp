@@ -0,0 +1,216 @@
+/*!********************************************************************************************************************
+ *  COPYRIGHT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  Copyright (c) 2024-2026 by Vector Informatik GmbH. All rights reserved.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -----------------------------------------------------------------------------------------------------------------*/
+/*!        \file  my_consumer_module.cpp
+ *         \brief
+ *
+ *********************************************************************************************************************/
+
+#include "test/my_consumer_module.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <type_traits>
+
+#include "vaf/allocation_tracking.h"
+#include "vaf/error_domain.h"
+#include "vaf/future.h"
+#include "vaf/internal/data_ptr_helper.h"
+#include "vaf/internal/promise.h"
+#include "vaf/trace.h"
+
+namespace test {
+
+namespace {
+// Bounds how long Stop waits for the replay thread and how often it checks for the consumers to start
+constexpr std::chrono::milliseconds kReplayPollInterval{100};
+}  // namespace
+
+MyConsumerModule::MyConsumerModule(::vaf::Executor& executor, vaf::String name, ::vaf::ExecutableControllerInterface& executable_controller_interface)
+  : ::vaf::ControlInterface(std::move(name), {}, executable_controller_interface, executor),
+    executor_{ControlInterface::executor_} {
+}
+
+MyConsumerModule::~MyConsumerModule() {
+  Stop();
+}
+
+::vaf::Result<void> MyConsumerModule::Init() noexcept {
+  return ::vaf::Result<void>{};
+}
+
+void MyConsumerModule::Start() noexcept {
+  static_assert(std::is_trivially_copyable<std::uint64_t>::value,
+                "Recordings only support trivially copyable data types");
+  static_assert(std::is_trivially_copyable<std::uint64_t>::value,
+                "Recordings only support trivially copyable data types");
+  auto reader = ::vaf::internal::RecordReader::Open("/tmp/my_recording.vafr", {
+      ::vaf::internal::RecordChannel{"my_data_element1", sizeof(std::uint64_t)},
+      ::vaf::internal::RecordChannel{"my_data_element2", sizeof(std::uint64_t)},
+  });
+  if (!reader.HasValue()) {
+    ReportError(reader.Error(), true);
+    return;
+  }
+  reader_ = std::make_unique<::vaf::internal::RecordReader>(std::move(reader.Value()));
+  running_ = true;
+  replayer_ = std::thread{&MyConsumerModule::ReplayRecording, this};
+  ReportOperational();
+}
+
+void MyConsumerModule::Stop() noexcept {
+  running_ = false;
+  if (replayer_.joinable()) {
+    replayer_.join();
+  }
+  reader_.reset();
+}
+
+void MyConsumerModule::DeInit() noexcept {
+}
+
+void MyConsumerModule::StartEventHandlerForModule(vaf::ModuleId module) {
+  active_modules_.Insert(module);
+}
+
+void MyConsumerModule::StopEventHandlerForModule(vaf::ModuleId module) {
+  active_modules_.Erase(module);
+}
+
+vaf::Vector<vaf::MemoryUsage> MyConsumerModule::GetMemoryUsage() const {
+  vaf::Vector<vaf::MemoryUsage> usage{};
+  usage.push_back(vaf::MemoryUsage{name_, "my_data_element1"});
+  cached_test_my_data_element1_.AddMemoryUsage(usage.back());
+  vaf::internal::AddHandlerMemoryUsage(registered_test_my_data_element1_event_handlers_, usage.back());
+  usage.push_back(vaf::MemoryUsage{name_, "my_data_element2"});
+  cached_test_my_data_element2_.AddMemoryUsage(usage.back());
+  vaf::internal::AddHandlerMemoryUsage(registered_test_my_data_element2_event_handlers_, usage.back());
+  return usage;
+}
+
+bool MyConsumerModule::HandlerOwnersActive() const {
+  for (const auto& handler_container : registered_test_my_data_element1_event_handlers_) {
+    if (!active_modules_.Contains(handler_container.owner_id_)) {
+      return false;
+    }
+  }
+  for (const auto& handler_container : registered_test_my_data_element2_event_handlers_) {
+    if (!active_modules_.Contains(handler_container.owner_id_)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+void MyConsumerModule::ReplayRecording() {
+  // Samples replayed before the consuming modules started would be lost to their handlers
+  while (running_ && !HandlerOwnersActive()) {
+    std::this_thread::sleep_for(kReplayPollInterval);
+  }
+  const auto start = std::chrono::steady_clock::now();
+  ::vaf::internal::RecordReader::Record record{};
+  while (running_ && reader_->Next(record)) {
+    // Replays at 2.0 times the recorded pace
+    const auto due = start + std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                                 std::chrono::duration<double, std::nano>{static_cast<double>(record.time.count()) / 2.0});
+    while (running_ && (std::chrono::steady_clock::now() < due)) {
+      std::this_thread::sleep_until(std::min(due, std::chrono::steady_clock::now() + kReplayPollInterval));
+    }
+    switch (record.channel) {
+      case 0: {
+        VAF_ALLOCATION_SCOPE("MyConsumerModule.my_data_element1 Replay");
+        ::vaf::DataPtr<std::uint64_t> sample{::vaf::MakeDataPtr<std::uint64_t>()};
+        std::memcpy(&*sample, record.sample, sizeof(std::uint64_t));
+        const ::vaf::ConstDataPtr<const std::uint64_t> received{
+            ::vaf::internal::DataPtrHelper<std::uint64_t>::toConstDataPtr(sample)};
+        metric_received_test_my_data_element1_.Increment();
+        cached_test_my_data_element1_.Store(received);
+        for(auto& handler_container : registered_test_my_data_element1_event_handlers_) {
+          if(active_modules_.Contains(handler_container.owner_id_)) {
+            VAF_TRACE_SCOPE("vaf.handler", "my_data_element1", handler_container.owner_.c_str());
+            VAF_ALLOCATION_SCOPE("MyConsumerModule.my_data_element1 handler");
+            handler_container.handler_(received);
+          }
+        }
+        break;
+      }
+      case 1: {
+        VAF_ALLOCATION_SCOPE("MyConsumerModule.my_data_element2 Replay");
+        ::vaf::DataPtr<std::uint64_t> sample{::vaf::MakeDataPtr<std::uint64_t>()};
+        std::memcpy(&*sample, record.sample, sizeof(std::uint64_t));
+        const ::vaf::ConstDataPtr<const std::uint64_t> received{
+            ::vaf::internal::DataPtrHelper<std::uint64_t>::toConstDataPtr(sample)};
+        metric_received_test_my_data_element2_.Increment();
+        cached_test_my_data_element2_.Store(received);
+        for(auto& handler_container : registered_test_my_data_element2_event_handlers_) {
+          if(active_modules_.Contains(handler_container.owner_id_)) {
+            VAF_TRACE_SCOPE("vaf.handler", "my_data_element2", handler_container.owner_.c_str());
+            VAF_ALLOCATION_SCOPE("MyConsumerModule.my_data_element2 handler");
+            handler_container.handler_(received);
+          }
+        }
+        break;
+      }
+      default:
+        break;
+    }
+  }
+}
+
+::vaf::Result<::vaf::ConstDataPtr<const std::uint64_t>> MyConsumerModule::GetAllocated_my_data_element1() {
+  ::vaf::Result<::vaf::ConstDataPtr<const std::uint64_t>> result_value{
+      ::vaf::Error{::vaf::ErrorCode::kNotOk, "No sample available"}};
+  ::vaf::ConstDataPtr<const std::uint64_t> sample{cached_test_my_data_element1_.Load()};
+  if (sample) {
+    result_value = ::vaf::Result<::vaf::ConstDataPtr<const std::uint64_t>>{std::move(sample)};
+  }
+  return result_value;
+}
+
+std::uint64_t MyConsumerModule::Get_my_data_element1() {
+  std::uint64_t return_value{};
+  const ::vaf::ConstDataPtr<const std::uint64_t> sample{cached_test_my_data_element1_.Load()};
+  if (sample) {
+    return_value = *sample;
+  }
+  return return_value;
+}
+
+void MyConsumerModule::RegisterDataElementHandler_my_data_element1(vaf::String owner, std::function<void(const ::vaf::ConstDataPtr<const std::uint64_t>)>&& f) {
+  registered_test_my_data_element1_event_handlers_.emplace_back(owner, std::move(f));
+}
+
+::vaf::Result<::vaf::ConstDataPtr<const std::uint64_t>> MyConsumerModule::GetAllocated_my_data_element2() {
+  ::vaf::Result<::vaf::ConstDataPtr<const std::uint64_t>> result_value{
+      ::vaf::Error{::vaf::ErrorCode::kNotOk, "No sample available"}};
+  ::vaf::ConstDataPtr<const std::uint64_t> sample{cached_test_my_data_element2_.Load()};
+  if (sample) {
+    result_value = ::vaf::Result<::vaf::ConstDataPtr<const std::uint64_t>>{std::move(sample)};
+  }
+  return result_value;
+}
+
+std::uint64_t MyConsumerModule::Get_my_data_element2() {
+  std::uint64_t return_value{};
+  const ::vaf::ConstDataPtr<const std::uint64_t> sample{cached_test_my_data_element2_.Load()};
+  if (sample) {
+    return_value = *sample;
+  }
+  return return_value;
+}
+
+void MyConsumerModule::RegisterDataElementHandler_my_data_element2(vaf::String owner, std::function<void(const ::vaf::ConstDataPtr<const std::uint64_t>)>&& f) {
+  registered_test_my_data_element2_event_handlers_.emplace_back(owner, std::move(f));
+}
+
+
+
+} // namespace test
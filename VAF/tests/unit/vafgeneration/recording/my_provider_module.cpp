@@ -0,0 +1,108 @@
+/*!********************************************************************************************************************
+ *  COPYRIGHT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  Copyright (c) 2024-2026 by Vector Informatik GmbH. All rights reserved.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -----------------------------------------------------------------------------------------------------------------*/
+/*!        \file  my_provider_module.cpp
+ *         \brief
+ *
+ *********************************************************************************************************************/
+
+#include "test/my_provider_module.h"
+
+#include <type_traits>
+
+#include "vaf/allocation_tracking.h"
+#include "vaf/error_domain.h"
+
+namespace test {
+
+MyProviderModule::MyProviderModule(vaf::Executor& executor, vaf::String name, vaf::ExecutableControllerInterface& executable_controller_interface)
+  	: vaf::ControlInterface(std::move(name), {}, executable_controller_interface, executor) {
+}
+
+vaf::Result<void> MyProviderModule::Init() noexcept {
+  return vaf::Result<void>{};
+}
+
+void MyProviderModule::Start() noexcept {
+  static_assert(std::is_trivially_copyable<std::uint64_t>::value,
+                "Recordings only support trivially copyable data types");
+  static_assert(std::is_trivially_copyable<std::uint64_t>::value,
+                "Recordings only support trivially copyable data types");
+  auto writer = ::vaf::internal::RecordWriter::Create("/tmp/my_recording.vafr", {
+      ::vaf::internal::RecordChannel{"my_data_element1", sizeof(std::uint64_t)},
+      ::vaf::internal::RecordChannel{"my_data_element2", sizeof(std::uint64_t)},
+  });
+  if (!writer.HasValue()) {
+    ReportError(writer.Error(), true);
+    return;
+  }
+  {
+    const std::lock_guard<std::mutex> lock(writer_mutex_);
+    writer_ = std::make_unique<::vaf::internal::RecordWriter>(std::move(writer.Value()));
+  }
+  ReportOperational();
+}
+
+void MyProviderModule::Stop() noexcept {
+  // Closing the recording writes its index
+  const std::lock_guard<std::mutex> lock(writer_mutex_);
+  writer_.reset();
+}
+
+void MyProviderModule::DeInit() noexcept {
+}
+
+::vaf::Result<::vaf::DataPtr<std::uint64_t>> MyProviderModule::Allocate_my_data_element1() {
+  VAF_ALLOCATION_SCOPE("MyProviderModule.my_data_element1 Allocate");
+  return ::vaf::Result<vaf::DataPtr< std::uint64_t >>::FromValue(vaf::MakeDataPtr< std::uint64_t >());
+}
+
+::vaf::Result<void> MyProviderModule::SetAllocated_my_data_element1(::vaf::DataPtr<std::uint64_t>&& data) {
+  return Set_my_data_element1(*data);
+}
+
+::vaf::Result<void> MyProviderModule::Set_my_data_element1(const std::uint64_t& data) {
+  VAF_ALLOCATION_SCOPE("MyProviderModule.my_data_element1 Set");
+  const std::lock_guard<std::mutex> lock(writer_mutex_);
+  if (!writer_) {
+    return ::vaf::Result<void>::FromError(::vaf::ErrorCode::kNotOk, "Recording is not created yet");
+  }
+  ::vaf::Result<void> written{writer_->Write(0, &data)};
+  if (!written.HasValue()) {
+    return written;
+  }
+  metric_published_test_my_data_element1_.Increment();
+  return ::vaf::Result<void>{};
+}
+::vaf::Result<::vaf::DataPtr<std::uint64_t>> MyProviderModule::Allocate_my_data_element2() {
+  VAF_ALLOCATION_SCOPE("MyProviderModule.my_data_element2 Allocate");
+  return ::vaf::Result<vaf::DataPtr< std::uint64_t >>::FromValue(vaf::MakeDataPtr< std::uint64_t >());
+}
+
+::vaf::Result<void> MyProviderModule::SetAllocated_my_data_element2(::vaf::DataPtr<std::uint64_t>&& data) {
+  return Set_my_data_element2(*data);
+}
+
+::vaf::Result<void> MyProviderModule::Set_my_data_element2(const std::uint64_t& data) {
+  VAF_ALLOCATION_SCOPE("MyProviderModule.my_data_element2 Set");
+  const std::lock_guard<std::mutex> lock(writer_mutex_);
+  if (!writer_) {
+    return ::vaf::Result<void>::FromError(::vaf::ErrorCode::kNotOk, "Recording is not created yet");
+  }
+  ::vaf::Result<void> written{writer_->Write(1, &data)};
+  if (!written.HasValue()) {
+    return written;
+  }
+  metric_published_test_my_data_element2_.Increment();
+  return ::vaf::Result<void>{};
+}
+
+
+} // namespace test
@@ -0,0 +1,213 @@
+/*!********************************************************************************************************************
+ *  COPYRIGHT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  Copyright (c) 2024-2026 by Vector Informatik GmbH. All rights reserved.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -----------------------------------------------------------------------------------------------------------------*/
+/*!        \file  my_consumer_module.cpp
+ *         \brief
+ *
+ *********************************************************************************************************************/
+
+#include "test/my_consumer_module.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <type_traits>
+
+#include "vaf/allocation_tracking.h"
+#include "vaf/error_domain.h"
+#include "vaf/future.h"
+#include "vaf/internal/data_ptr_helper.h"
+#include "vaf/internal/promise.h"
+#include "vaf/trace.h"
+
+namespace test {
+
+namespace {
+// Bounds how long Stop waits for the receiver threads and how often a missing provider segment is looked up again
+constexpr std::chrono::milliseconds kShmPollInterval{100};
+}  // namespace
+
+MyConsumerModule::MyConsumerModule(::vaf::Executor& executor, vaf::String name, ::vaf::ExecutableControllerInterface& executable_controller_interface)
+  : ::vaf::ControlInterface(std::move(name), {}, executable_controller_interface, executor),
+    executor_{ControlInterface::executor_} {
+}
+
+MyConsumerModule::~MyConsumerModule() {
+  Stop();
+}
+
+::vaf::Result<void> MyConsumerModule::Init() noexcept {
+  return ::vaf::Result<void>{};
+}
+
+void MyConsumerModule::Start() noexcept {
+  running_ = true;
+  receiver_test_my_data_element1_ = std::thread{&MyConsumerModule::Receive_test_my_data_element1, this};
+  receiver_test_my_data_element2_ = std::thread{&MyConsumerModule::Receive_test_my_data_element2, this};
+  ReportOperational();
+}
+
+void MyConsumerModule::Stop() noexcept {
+  running_ = false;
+  if (receiver_test_my_data_element1_.joinable()) {
+    receiver_test_my_data_element1_.join();
+  }
+  if (receiver_test_my_data_element2_.joinable()) {
+    receiver_test_my_data_element2_.join();
+  }
+}
+
+void MyConsumerModule::DeInit() noexcept {
+}
+
+void MyConsumerModule::StartEventHandlerForModule(vaf::ModuleId module) {
+  active_modules_.Insert(module);
+}
+
+void MyConsumerModule::StopEventHandlerForModule(vaf::ModuleId module) {
+  active_modules_.Erase(module);
+}
+
+vaf::Vector<vaf::MemoryUsage> MyConsumerModule::GetMemoryUsage() const {
+  vaf::Vector<vaf::MemoryUsage> usage{};
+  usage.push_back(vaf::MemoryUsage{name_, "my_data_element1"});
+  cached_test_my_data_element1_.AddMemoryUsage(usage.back());
+  vaf::internal::AddHandlerMemoryUsage(registered_test_my_data_element1_event_handlers_, usage.back());
+  usage.push_back(vaf::MemoryUsage{name_, "my_data_element2"});
+  cached_test_my_data_element2_.AddMemoryUsage(usage.back());
+  vaf::internal::AddHandlerMemoryUsage(registered_test_my_data_element2_event_handlers_, usage.back());
+  return usage;
+}
+
+
+void MyConsumerModule::Receive_test_my_data_element1() {
+  static_assert(std::is_trivially_copyable<std::uint64_t>::value,
+                "Shared memory communication only supports trivially copyable data types");
+  std::uint64_t last_sequence{0};
+  while (running_) {
+    if (!channel_test_my_data_element1_) {
+      auto channel = ::vaf::internal::ShmChannel::Open("my_segment_my_data_element1", sizeof(std::uint64_t));
+      if (!channel.HasValue()) {
+        // The provider did not create the segment yet
+        std::this_thread::sleep_for(kShmPollInterval);
+        continue;
+      }
+      channel_test_my_data_element1_ = std::make_unique<::vaf::internal::ShmChannel>(std::move(channel.Value()));
+    }
+    if (!channel_test_my_data_element1_->WaitForSample(last_sequence, kShmPollInterval)) {
+      continue;
+    }
+    VAF_ALLOCATION_SCOPE("MyConsumerModule.my_data_element1 Receive");
+    ::vaf::DataPtr<std::uint64_t> sample{::vaf::MakeDataPtr<std::uint64_t>()};
+    if (!channel_test_my_data_element1_->ReadLatest(&*sample, last_sequence)) {
+      continue;
+    }
+
+    const ::vaf::ConstDataPtr<const std::uint64_t> received{
+        ::vaf::internal::DataPtrHelper<std::uint64_t>::toConstDataPtr(sample)};
+    metric_received_test_my_data_element1_.Increment();
+    cached_test_my_data_element1_.Store(received);
+    for(auto& handler_container : registered_test_my_data_element1_event_handlers_) {
+      if(active_modules_.Contains(handler_container.owner_id_)) {
+        VAF_TRACE_SCOPE("vaf.handler", "my_data_element1", handler_container.owner_.c_str());
+        VAF_ALLOCATION_SCOPE("MyConsumerModule.my_data_element1 handler");
+        handler_container.handler_(received);
+      }
+    }
+  }
+}
+
+::vaf::Result<::vaf::ConstDataPtr<const std::uint64_t>> MyConsumerModule::GetAllocated_my_data_element1() {
+  ::vaf::Result<::vaf::ConstDataPtr<const std::uint64_t>> result_value{
+      ::vaf::Error{::vaf::ErrorCode::kNotOk, "No sample available"}};
+  ::vaf::ConstDataPtr<const std::uint64_t> sample{cached_test_my_data_element1_.Load()};
+  if (sample) {
+    result_value = ::vaf::Result<::vaf::ConstDataPtr<const std::uint64_t>>{std::move(sample)};
+  }
+  return result_value;
+}
+
+std::uint64_t MyConsumerModule::Get_my_data_element1() {
+  std::uint64_t return_value{};
+  const ::vaf::ConstDataPtr<const std::uint64_t> sample{cached_test_my_data_element1_.Load()};
+  if (sample) {
+    return_value = *sample;
+  }
+  return return_value;
+}
+
+void MyConsumerModule::RegisterDataElementHandler_my_data_element1(vaf::String owner, std::function<void(const ::vaf::ConstDataPtr<const std::uint64_t>)>&& f) {
+  registered_test_my_data_element1_event_handlers_.emplace_back(owner, std::move(f));
+}
+
+
+void MyConsumerModule::Receive_test_my_data_element2() {
+  static_assert(std::is_trivially_copyable<std::uint64_t>::value,
+                "Shared memory communication only supports trivially copyable data types");
+  std::uint64_t last_sequence{0};
+  while (running_) {
+    if (!channel_test_my_data_element2_) {
+      auto channel = ::vaf::internal::ShmChannel::Open("my_segment_my_data_element2", sizeof(std::uint64_t));
+      if (!channel.HasValue()) {
+        // The provider did not create the segment yet
+        std::this_thread::sleep_for(kShmPollInterval);
+        continue;
+      }
+      channel_test_my_data_element2_ = std::make_unique<::vaf::internal::ShmChannel>(std::move(channel.Value()));
+    }
+    if (!channel_test_my_data_element2_->WaitForSample(last_sequence, kShmPollInterval)) {
+      continue;
+    }
+    VAF_ALLOCATION_SCOPE("MyConsumerModule.my_data_element2 Receive");
+    ::vaf::DataPtr<std::uint64_t> sample{::vaf::MakeDataPtr<std::uint64_t>()};
+    if (!channel_test_my_data_element2_->ReadLatest(&*sample, last_sequence)) {
+      continue;
+    }
+
+    const ::vaf::ConstDataPtr<const std::uint64_t> received{
+        ::vaf::internal::DataPtrHelper<std::uint64_t>::toConstDataPtr(sample)};
+    metric_received_test_my_data_element2_.Increment();
+    cached_test_my_data_element2_.Store(received);
+    for(auto& handler_container : registered_test_my_data_element2_event_handlers_) {
+      if(active_modules_.Contains(handler_container.owner_id_)) {
+        VAF_TRACE_SCOPE("vaf.handler", "my_data_element2", handler_container.owner_.c_str());
+        VAF_ALLOCATION_SCOPE("MyConsumerModule.my_data_element2 handler");
+        handler_container.handler_(received);
+      }
+    }
+  }
+}
+
+::vaf::Result<::vaf::ConstDataPtr<const std::uint64_t>> MyConsumerModule::GetAllocated_my_data_element2() {
+  ::vaf::Result<::vaf::ConstDataPtr<const std::uint64_t>> result_value{
+      ::vaf::Error{::vaf::ErrorCode::kNotOk, "No sample available"}};
+  ::vaf::ConstDataPtr<const std::uint64_t> sample{cached_test_my_data_element2_.Load()};
+  if (sample) {
+    result_value = ::vaf::Result<::vaf::ConstDataPtr<const std::uint64_t>>{std::move(sample)};
+  }
+  return result_value;
+}
+
+std::uint64_t MyConsumerModule::Get_my_data_element2() {
+  std::uint64_t return_value{};
+  const ::vaf::ConstDataPtr<const std::uint64_t> sample{cached_test_my_data_element2_.Load()};
+  if (sample) {
+    return_value = *sample;
+  }
+  return return_value;
+}
+
+void MyConsumerModule::RegisterDataElementHandler_my_data_element2(vaf::String owner, std::function<void(const ::vaf::ConstDataPtr<const std::uint64_t>)>&& f) {
+  registered_test_my_data_element2_event_handlers_.emplace_back(owner, std::move(f));
+}
+
+
+
+} // namespace test
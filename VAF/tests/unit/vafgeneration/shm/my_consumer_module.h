@@ -0,0 +1,88 @@
+/*!********************************************************************************************************************
+ *  COPYRIGHT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  Copyright (c) 2024-2026 by Vector Informatik GmbH. All rights reserved.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -----------------------------------------------------------------------------------------------------------------*/
+/*!        \file  my_consumer_module.h
+ *         \brief
+ *
+ *********************************************************************************************************************/
+
+#ifndef TEST_MY_CONSUMER_MODULE_H
+#define TEST_MY_CONSUMER_MODULE_H
+
+#include <atomic>
+#include <memory>
+#include <thread>
+#include "vaf/container_types.h"
+#include "vaf/receiver_handler_container.h"
+#include "vaf/controller_interface.h"
+#include "vaf/data_ptr.h"
+#include "vaf/executable_controller_interface.h"
+#include "vaf/module_id.h"
+#include "vaf/internal/latest_sample.h"
+#include "vaf/metrics.h"
+#include "vaf/internal/shm_channel.h"
+#include "vaf/result.h"
+
+#include "test/my_interface_consumer.h"
+
+
+namespace test {
+
+class MyConsumerModule final : public test::MyInterfaceConsumer, public vaf::ControlInterface {
+ public:
+  MyConsumerModule(vaf::Executor& executor, vaf::String name, vaf::ExecutableControllerInterface& executable_controller_interface);
+  ~MyConsumerModule() override;
+
+  MyConsumerModule(const MyConsumerModule&) = delete;
+  MyConsumerModule(MyConsumerModule&&) = delete;
+  MyConsumerModule& operator=(const MyConsumerModule&) = delete;
+  MyConsumerModule& operator=(MyConsumerModule&&) = delete;
+
+  // Management related operations
+  vaf::Result<void> Init() noexcept override;
+  void Start() noexcept override;
+  void Stop() noexcept override;
+  void DeInit() noexcept override;
+  void StartEventHandlerForModule(vaf::ModuleId module) override;
+  void StopEventHandlerForModule(vaf::ModuleId module) override;
+  vaf::Vector<vaf::MemoryUsage> GetMemoryUsage() const override;
+
+  ::vaf::Result<::vaf::ConstDataPtr<const std::uint64_t>> GetAllocated_my_data_element1() override;
+  std::uint64_t Get_my_data_element1() override;
+  void RegisterDataElementHandler_my_data_element1(vaf::String owner, std::function<void(const ::vaf::ConstDataPtr<const std::uint64_t>)>&& f) override;
+  ::vaf::Result<::vaf::ConstDataPtr<const std::uint64_t>> GetAllocated_my_data_element2() override;
+  std::uint64_t Get_my_data_element2() override;
+  void RegisterDataElementHandler_my_data_element2(vaf::String owner, std::function<void(const ::vaf::ConstDataPtr<const std::uint64_t>)>&& f) override;
+
+
+ private:
+  void Receive_test_my_data_element1();
+  void Receive_test_my_data_element2();
+
+  vaf::ModuleExecutor& executor_;
+  vaf::ModuleSet active_modules_{};
+  std::atomic<bool> running_{false};
+
+  ::vaf::internal::LatestSample<std::uint64_t> cached_test_my_data_element1_{};
+  vaf::Vector<::vaf::ReceiverHandlerContainer<std::function<void(const ::vaf::ConstDataPtr<const std::uint64_t>)>>> registered_test_my_data_element1_event_handlers_{};
+  vaf::Counter& metric_received_test_my_data_element1_{vaf::GetCounter("vaf_data_element_received_total", vaf::MetricLabels{ {"module", "MyConsumerModule"}, {"data_element", "my_data_element1"} })};
+  std::unique_ptr<::vaf::internal::ShmChannel> channel_test_my_data_element1_;
+  std::thread receiver_test_my_data_element1_;
+  ::vaf::internal::LatestSample<std::uint64_t> cached_test_my_data_element2_{::vaf::MakeConstDataPtr<const std::uint64_t>(std::uint64_t{64})};
+  vaf::Vector<::vaf::ReceiverHandlerContainer<std::function<void(const ::vaf::ConstDataPtr<const std::uint64_t>)>>> registered_test_my_data_element2_event_handlers_{};
+  vaf::Counter& metric_received_test_my_data_element2_{vaf::GetCounter("vaf_data_element_received_total", vaf::MetricLabels{ {"module", "MyConsumerModule"}, {"data_element", "my_data_element2"} })};
+  std::unique_ptr<::vaf::internal::ShmChannel> channel_test_my_data_element2_;
+  std::thread receiver_test_my_data_element2_;
+};
+
+
+} // namespace test
+
+#endif // TEST_MY_CONSUMER_MODULE_H
@@ -0,0 +1,109 @@
+/*!********************************************************************************************************************
+ *  COPYRIGHT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  Copyright (c) 2024-2026 by Vector Informatik GmbH. All rights reserved.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -----------------------------------------------------------------------------------------------------------------*/
+/*!        \file  my_provider_module.cpp
+ *         \brief
+ *
+ *********************************************************************************************************************/
+
+#include "test/my_provider_module.h"
+
+#include <type_traits>
+
+#include "vaf/allocation_tracking.h"
+#include "vaf/error_domain.h"
+
+namespace test {
+
+MyProviderModule::MyProviderModule(vaf::Executor& executor, vaf::String name, vaf::ExecutableControllerInterface& executable_controller_interface)
+  	: vaf::ControlInterface(std::move(name), {}, executable_controller_interface, executor) {
+}
+
+vaf::Result<void> MyProviderModule::Init() noexcept {
+  return vaf::Result<void>{};
+}
+
+void MyProviderModule::Start() noexcept {
+  static_assert(std::is_trivially_copyable<std::uint64_t>::value,
+                "Shared memory communication only supports trivially copyable data types");
+  {
+    auto channel = ::vaf::internal::ShmChannel::Create(
+        "my_segment_my_data_element1", sizeof(std::uint64_t),
+        8);
+    if (!channel.HasValue()) {
+      ReportError(channel.Error(), true);
+      return;
+    }
+    const std::lock_guard<std::mutex> lock(channel_test_my_data_element1_mutex_);
+    channel_test_my_data_element1_ = std::make_unique<::vaf::internal::ShmChannel>(std::move(channel.Value()));
+  }
+  static_assert(std::is_trivially_copyable<std::uint64_t>::value,
+                "Shared memory communication only supports trivially copyable data types");
+  {
+    auto channel = ::vaf::internal::ShmChannel::Create(
+        "my_segment_my_data_element2", sizeof(std::uint64_t),
+        8);
+    if (!channel.HasValue()) {
+      ReportError(channel.Error(), true);
+      return;
+    }
+    const std::lock_guard<std::mutex> lock(channel_test_my_data_element2_mutex_);
+    channel_test_my_data_element2_ = std::make_unique<::vaf::internal::ShmChannel>(std::move(channel.Value()));
+  }
+  ReportOperational();
+}
+
+void MyProviderModule::Stop() noexcept {
+}
+
+void MyProviderModule::DeInit() noexcept {
+}
+
+::vaf::Result<::vaf::DataPtr<std::uint64_t>> MyProviderModule::Allocate_my_data_element1() {
+  VAF_ALLOCATION_SCOPE("MyProviderModule.my_data_element1 Allocate");
+  return ::vaf::Result<vaf::DataPtr< std::uint64_t >>::FromValue(vaf::MakeDataPtr< std::uint64_t >());
+}
+
+::vaf::Result<void> MyProviderModule::SetAllocated_my_data_element1(::vaf::DataPtr<std::uint64_t>&& data) {
+  return Set_my_data_element1(*data);
+}
+
+::vaf::Result<void> MyProviderModule::Set_my_data_element1(const std::uint64_t& data) {
+  VAF_ALLOCATION_SCOPE("MyProviderModule.my_data_element1 Set");
+  const std::lock_guard<std::mutex> lock(channel_test_my_data_element1_mutex_);
+  if (!channel_test_my_data_element1_) {
+    return ::vaf::Result<void>::FromError(::vaf::ErrorCode::kNotOk, "Shared memory segment is not created yet");
+  }
+  channel_test_my_data_element1_->Write(&data);
+  metric_published_test_my_data_element1_.Increment();
+  return ::vaf::Result<void>{};
+}
+::vaf::Result<::vaf::DataPtr<std::uint64_t>> MyProviderModule::Allocate_my_data_element2() {
+  VAF_ALLOCATION_SCOPE("MyProviderModule.my_data_element2 Allocate");
+  return ::vaf::Result<vaf::DataPtr< std::uint64_t >>::FromValue(vaf::MakeDataPtr< std::uint64_t >());
+}
+
+::vaf::Result<void> MyProviderModule::SetAllocated_my_data_element2(::vaf::DataPtr<std::uint64_t>&& data) {
+  return Set_my_data_element2(*data);
+}
+
+::vaf::Result<void> MyProviderModule::Set_my_data_element2(const std::uint64_t& data) {
+  VAF_ALLOCATION_SCOPE("MyProviderModule.my_data_element2 Set");
+  const std::lock_guard<std::mutex> lock(channel_test_my_data_element2_mutex_);
+  if (!channel_test_my_data_element2_) {
+    return ::vaf::Result<void>::FromError(::vaf::ErrorCode::kNotOk, "Shared memory segment is not created yet");
+  }
+  channel_test_my_data_element2_->Write(&data);
+  metric_published_test_my_data_element2_.Increment();
+  return ::vaf::Result<void>{};
+}
+
+
+} // namespace test
@@ -0,0 +1,62 @@
+/*!********************************************************************************************************************
+ *  COPYRIGHT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  Copyright (c) 2024-2026 by Vector Informatik GmbH. All rights reserved.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -----------------------------------------------------------------------------------------------------------------*/
+/*!        \file  my_provider_module.h
+ *         \brief
+ *
+ *********************************************************************************************************************/
+
+#ifndef TEST_MY_PROVIDER_MODULE_H
+#define TEST_MY_PROVIDER_MODULE_H
+
+#include <memory>
+#include <mutex>
+#include "vaf/container_types.h"
+#include "vaf/controller_interface.h"
+#include "vaf/data_ptr.h"
+#include "vaf/executable_controller_interface.h"
+#include "vaf/internal/shm_channel.h"
+#include "vaf/metrics.h"
+#include "vaf/result.h"
+
+#include "test/my_interface_provider.h"
+
+namespace test {
+
+class MyProviderModule final : public test::MyInterfaceProvider, public vaf::ControlInterface {
+ public:
+  explicit MyProviderModule(vaf::Executor& executor, vaf::String name, vaf::ExecutableControllerInterface& executable_controller_interface);
+  ~MyProviderModule() override = default;
+
+  vaf::Result<void> Init() noexcept override;
+  void Start() noexcept override;
+  void Stop() noexcept override;
+  void DeInit() noexcept override;
+
+  ::vaf::Result<::vaf::DataPtr<std::uint64_t>> Allocate_my_data_element1() override;
+  ::vaf::Result<void> SetAllocated_my_data_element1(::vaf::DataPtr<std::uint64_t>&& data) override;
+  ::vaf::Result<void> Set_my_data_element1(const std::uint64_t& data) override;
+  ::vaf::Result<::vaf::DataPtr<std::uint64_t>> Allocate_my_data_element2() override;
+  ::vaf::Result<void> SetAllocated_my_data_element2(::vaf::DataPtr<std::uint64_t>&& data) override;
+  ::vaf::Result<void> Set_my_data_element2(const std::uint64_t& data) override;
+
+
+ private:
+  std::unique_ptr<::vaf::internal::ShmChannel> channel_test_my_data_element1_;
+  std::mutex channel_test_my_data_element1_mutex_;
+  vaf::Counter& metric_published_test_my_data_element1_{vaf::GetCounter("vaf_data_element_published_total", vaf::MetricLabels{ {"module", "MyProviderModule"}, {"data_element", "my_data_element1"} })};
+  std::unique_ptr<::vaf::internal::ShmChannel> channel_test_my_data_element2_;
+  std::mutex channel_test_my_data_element2_mutex_;
+  vaf::Counter& metric_published_test_my_data_element2_{vaf::GetCounter("vaf_data_element_published_total", vaf::MetricLabels{ {"module", "MyProviderModule"}, {"data_element", "my_data_element2"} })};
+};
+
+} // namespace test
+
+#endif // TEST_MY_PROVIDER_MODULE_H
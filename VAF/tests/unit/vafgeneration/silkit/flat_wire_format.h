@@ -0,0 +1,92 @@
+/*!********************************************************************************************************************
+ *  COPYRIGHT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  Copyright (c) 2024-2026 by Vector Informatik GmbH. All rights reserved.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -----------------------------------------------------------------------------------------------------------------*/
+/*!        \file  flat_wire_format.h
+ *         \brief
+ *
+ *********************************************************************************************************************/
+
+#ifndef VAF_SILKIT_FLAT_WIRE_FORMAT_H
+#define VAF_SILKIT_FLAT_WIRE_FORMAT_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <vector>
+
+namespace vaf {
+namespace silkit {
+
+/*!
+ * \brief Media type of samples that are sent in their in-memory layout.
+ * Publishers and subscribers only match if they use the same media type, so a peer with a different version of the
+ * layout falls back to not communicating instead of reading garbage.
+ */
+constexpr const char* kFlatMediaType{"application/vnd.vaf.flat; version=1"};
+
+// Header in front of every flat sample
+struct FlatSampleHeader {
+  std::uint32_t magic;       //!< Identifies a flat sample.
+  std::uint16_t version;     //!< Version of the flat layout.
+  std::uint16_t byte_order;  //!< kByteOrderMark as written by the provider, detects a differing byte order.
+  std::uint64_t size;        //!< Size of the sample that follows.
+};
+
+constexpr std::uint32_t kFlatSampleMagic{0x46464156U};
+constexpr std::uint16_t kFlatSampleVersion{1U};
+constexpr std::uint16_t kByteOrderMark{0x0102U};
+
+/*!
+ * \brief Writes a sample in its in-memory layout behind a FlatSampleHeader.
+ * Only used for data types of a fixed layout, so no protobuf message is built. The buffer is reused for all samples
+ * of this type on this thread, like the one of SerializeToBuffer.
+ * \param value The sample
+ * \return The serialized sample
+ */
+template <typename T>
+const std::vector<std::uint8_t>& SerializeFlat(const T& value) {
+  static_assert(std::is_trivially_copyable<T>::value, "Only trivially copyable types can be sent flat");
+  thread_local std::vector<std::uint8_t> buffer{};
+  const FlatSampleHeader header{kFlatSampleMagic, kFlatSampleVersion, kByteOrderMark, sizeof(T)};
+  buffer.resize(sizeof(FlatSampleHeader) + sizeof(T));
+  std::memcpy(buffer.data(), &header, sizeof(FlatSampleHeader));
+  std::memcpy(buffer.data() + sizeof(FlatSampleHeader), &value, sizeof(T));
+  return buffer;
+}
+
+/*!
+ * \brief Copies a flat sample out of a received buffer.
+ * The buffer of SIL Kit is not necessarily aligned for T, so the sample is copied once instead of reinterpreted.
+ * \param data The received data
+ * \param size The size of the received data
+ * \param value The sample to fill
+ * \return False if the header does not match the layout of T on this side
+ */
+template <typename T>
+bool DeserializeFlat(const std::uint8_t* data, std::size_t size, T& value) {
+  static_assert(std::is_trivially_copyable<T>::value, "Only trivially copyable types can be sent flat");
+  if (size != sizeof(FlatSampleHeader) + sizeof(T)) {
+    return false;
+  }
+  FlatSampleHeader header{};
+  std::memcpy(&header, data, sizeof(FlatSampleHeader));
+  if ((header.magic != kFlatSampleMagic) || (header.version != kFlatSampleVersion) ||
+      (header.byte_order != kByteOrderMark) || (header.size != sizeof(T))) {
+    return false;
+  }
+  std::memcpy(&value, data + sizeof(FlatSampleHeader), sizeof(T));
+  return true;
+}
+
+} // namespace silkit
+} // namespace vaf
+
+#endif // VAF_SILKIT_FLAT_WIRE_FORMAT_H
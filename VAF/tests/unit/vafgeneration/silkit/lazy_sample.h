@@ -0,0 +1,78 @@
+/*!********************************************************************************************************************
+ *  COPYRIGHT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  Copyright (c) 2024-2026 by Vector Informatik GmbH. All rights reserved.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -----------------------------------------------------------------------------------------------------------------*/
+/*!        \file  lazy_sample.h
+ *         \brief
+ *
+ *********************************************************************************************************************/
+
+#ifndef VAF_SILKIT_LAZY_SAMPLE_H
+#define VAF_SILKIT_LAZY_SAMPLE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace vaf {
+namespace silkit {
+
+/*!
+ * \brief The latest received sample of one data element of a consumer that is not deserialized yet.
+ * The reception handler keeps the serialized sample with Store if no handler of an active module needs it, and reading
+ * the data element deserializes it with Flush. A sample that is replaced unread is never parsed. The buffer keeps its
+ * capacity, so samples of a steady size do not allocate.
+ */
+class LazySample {
+ public:
+  LazySample() = default;
+
+  LazySample(const LazySample&) = delete;
+  LazySample& operator=(const LazySample&) = delete;
+
+  // Keeps a copy of a received sample, the buffer of SIL Kit is only valid during the reception handler
+  void Store(const std::uint8_t* data, std::size_t size) {
+    std::lock_guard<std::mutex> lock{mutex_};
+    buffer_.assign(data, data + size);
+    has_sample_ = true;
+  }
+
+  /*!
+   * \brief Drops the kept sample, as a newer one is deserialized right away.
+   * \return The lock to hold while the newer sample is deserialized, so a concurrent Flush cannot store the older one
+   *         after it
+   */
+  std::unique_lock<std::mutex> Discard() {
+    std::unique_lock<std::mutex> lock{mutex_};
+    has_sample_ = false;
+    return lock;
+  }
+
+  // Calls deserialize(data, size) with the kept sample if there is one, under the lock so it is deserialized once
+  template <typename Deserialize>
+  void Flush(Deserialize&& deserialize) {
+    std::lock_guard<std::mutex> lock{mutex_};
+    if (!has_sample_) {
+      return;
+    }
+    has_sample_ = false;
+    deserialize(static_cast<const std::uint8_t*>(buffer_.data()), buffer_.size());
+  }
+
+ private:
+  std::mutex mutex_{};
+  std::vector<std::uint8_t> buffer_{};
+  bool has_sample_{false};
+};
+
+} // namespace silkit
+} // namespace vaf
+
+#endif // VAF_SILKIT_LAZY_SAMPLE_H
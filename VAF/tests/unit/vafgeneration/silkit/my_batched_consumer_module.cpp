@@ -0,0 +1,439 @@
+/*!********************************************************************************************************************
+ *  COPYRIGHT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  Copyright (c) 2024-2026 by Vector Informatik GmbH. All rights reserved.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -----------------------------------------------------------------------------------------------------------------*/
+/*!        \file  my_batched_consumer_module.cpp
+ *         \brief
+ *
+ *********************************************************************************************************************/
+
+#include "test/my_batched_consumer_module.h"
+
+#include <chrono>
+#include <google/protobuf/serial_arena.h>
+
+#include "vaf/allocation_tracking.h"
+#include "vaf/error_domain.h"
+#include "vaf/logging.h"
+#include "vaf/silkit/flat_wire_format.h"
+#include "vaf/silkit/participant.h"
+#include "vaf/silkit/sample_batch.h"
+#include "vaf/silkit/sample_compression.h"
+#include "vaf/silkit/serialization_buffer.h"
+#include "vaf/future.h"
+#include "vaf/trace.h"
+#include "protobuf/interface/test/myinterface/protobuf_transformer.h"
+
+#include "silkit/SilKit.hpp"
+#include "silkit/services/all.hpp"
+#include "silkit/services/orchestration/string_utils.hpp"
+#include "silkit/util/serdes/Serialization.hpp"
+#include "protobuf_interface_test_MyInterface.pb.h"
+
+namespace test {
+
+MyBatchedConsumerModule::MyBatchedConsumerModule(::vaf::Executor& executor, vaf::String name, ::vaf::ExecutableControllerInterface& executable_controller_interface)
+  : ::vaf::ControlInterface(std::move(name), {}, executable_controller_interface, executor),
+    executor_{ControlInterface::executor_} {
+}
+
+::vaf::Result<void> MyBatchedConsumerModule::Init() noexcept {
+  return ::vaf::Result<void>{};
+}
+
+void MyBatchedConsumerModule::Start() noexcept {
+  // SIL Kit cannot remove controllers again, so a restart only reactivates the ones of the first start
+  if (!controllers_created_) {
+    CreateControllers();
+    controllers_created_ = true;
+  }
+  started_.store(true, std::memory_order_release);
+  ReportOperational();
+}
+
+void MyBatchedConsumerModule::Stop() noexcept {
+  started_.store(false, std::memory_order_release);
+  pending_calls_test_MyVoidOperation_.CancelAll();
+  pending_calls_test_MyOperation_.CancelAll();
+  pending_calls_test_MyGetter_.CancelAll();
+  pending_calls_test_MySetter_.CancelAll();
+}
+
+void MyBatchedConsumerModule::CreateControllers() {
+  // All SIL Kit modules of the executable share one participant
+  SilKit::IParticipant& participant = vaf::silkit::GetParticipant();
+
+  SilKit::Services::PubSub::PubSubSpec pubsubspec_batch{"MyInterface_Batch", vaf::silkit::kBatchMediaType};
+  pubsubspec_batch.AddLabel("Instance", "MyInterface", SilKit::Services::MatchingLabel::Kind::Mandatory);
+  auto receptionHandler_batch = [this](auto* /*subscriber*/, const auto& dataMessageEvent) {
+    const bool complete = vaf::silkit::ForEachBatchSample(dataMessageEvent.data.data(), dataMessageEvent.data.size(),
+        [this](std::uint16_t element, const std::uint8_t* data, std::size_t size) {
+      switch (element) {
+        case 0:
+          OnSample_test_my_data_element1(data, size);
+          break;
+        case 1:
+          OnSample_test_my_data_element2(data, size);
+          break;
+        case 2:
+          OnSample_test_my_data_element3(data, size);
+          break;
+        case 3:
+          OnSample_test_my_data_element4(data, size);
+          break;
+        default:
+          break;
+      }
+    });
+    if (!complete) {
+      vaf::LoggerSingleton::getInstance()->default_logger_.LogWarn() << "MyBatchedConsumerModule: Dropped the rest of a malformed batch";
+    }
+  };
+  batch_subscriber_ = participant.CreateDataSubscriber("MyBatchedConsumerModule_Subscriber_Batch", pubsubspec_batch, receptionHandler_batch);
+
+
+  SilKit::Services::Rpc::RpcSpec rpcspec_test_MyVoidOperation{"MyInterface_MyVoidOperation", "application/protobuf"};
+  rpcspec_test_MyVoidOperation.AddLabel("Instance", "MyInterface", SilKit::Services::MatchingLabel::Kind::Mandatory);
+  auto ReturnFunc_test_MyVoidOperation = [this](auto* /*client*/, const auto& event) {
+    VAF_TRACE_INSTANT("vaf.rpc", "MyVoidOperation result", "MyBatchedConsumerModule");
+    auto promise = pending_calls_test_MyVoidOperation_.Complete(event.userContext);
+    if (!promise) {
+      // The call already timed out or was cancelled
+      return;
+    }
+    if (event.callStatus == SilKit::Services::Rpc::RpcCallStatus::Success) {
+      promise->set_value();
+    } else {
+      vaf::Error error_code{::vaf::ErrorCode::kNotOk, "Rpc call failed"};
+      vaf::internal::SetVafErrorCodeToPromise(*promise, error_code);
+    }
+  };
+  rpc_client_test_MyVoidOperation_= participant.CreateRpcClient("MyBatchedConsumerModule_test_MyVoidOperation", rpcspec_test_MyVoidOperation, ReturnFunc_test_MyVoidOperation);
+
+  SilKit::Services::Rpc::RpcSpec rpcspec_test_MyOperation{"MyInterface_MyOperation", "application/protobuf"};
+  rpcspec_test_MyOperation.AddLabel("Instance", "MyInterface", SilKit::Services::MatchingLabel::Kind::Mandatory);
+  auto ReturnFunc_test_MyOperation = [this](auto* /*client*/, const auto& event) {
+    VAF_TRACE_INSTANT("vaf.rpc", "MyOperation result", "MyBatchedConsumerModule");
+    auto promise = pending_calls_test_MyOperation_.Complete(event.userContext);
+    if (!promise) {
+      // The call already timed out or was cancelled
+      return;
+    }
+    if (event.callStatus == SilKit::Services::Rpc::RpcCallStatus::Success) {
+      test::MyOperation::Output output;
+      protobuf::interface::test::MyInterface::MyOperation_out deserialized;
+      deserialized.ParseFromArray( event.resultData.data(), event.resultData.size() );
+      ::protobuf::interface::test::MyInterface::MyOperationOutProtoToVaf(std::move(deserialized), output);
+      promise->set_value(std::move(output));
+    } else {
+      vaf::Error error_code{::vaf::ErrorCode::kNotOk, "Rpc call failed"};
+      vaf::internal::SetVafErrorCodeToPromise(*promise, error_code);
+    }
+  };
+  rpc_client_test_MyOperation_= participant.CreateRpcClient("MyBatchedConsumerModule_test_MyOperation", rpcspec_test_MyOperation, ReturnFunc_test_MyOperation);
+
+  SilKit::Services::Rpc::RpcSpec rpcspec_test_MyGetter{"MyInterface_MyGetter", "application/protobuf"};
+  rpcspec_test_MyGetter.AddLabel("Instance", "MyInterface", SilKit::Services::MatchingLabel::Kind::Mandatory);
+  auto ReturnFunc_test_MyGetter = [this](auto* /*client*/, const auto& event) {
+    VAF_TRACE_INSTANT("vaf.rpc", "MyGetter result", "MyBatchedConsumerModule");
+    auto promise = pending_calls_test_MyGetter_.Complete(event.userContext);
+    if (!promise) {
+      // The call already timed out or was cancelled
+      return;
+    }
+    if (event.callStatus == SilKit::Services::Rpc::RpcCallStatus::Success) {
+      test::MyGetter::Output output;
+      protobuf::interface::test::MyInterface::MyGetter_out deserialized;
+      deserialized.ParseFromArray( event.resultData.data(), event.resultData.size() );
+      ::protobuf::interface::test::MyInterface::MyGetterOutProtoToVaf(std::move(deserialized), output);
+      promise->set_value(std::move(output));
+    } else {
+      vaf::Error error_code{::vaf::ErrorCode::kNotOk, "Rpc call failed"};
+      vaf::internal::SetVafErrorCodeToPromise(*promise, error_code);
+    }
+  };
+  rpc_client_test_MyGetter_= participant.CreateRpcClient("MyBatchedConsumerModule_test_MyGetter", rpcspec_test_MyGetter, ReturnFunc_test_MyGetter);
+
+  SilKit::Services::Rpc::RpcSpec rpcspec_test_MySetter{"MyInterface_MySetter", "application/protobuf"};
+  rpcspec_test_MySetter.AddLabel("Instance", "MyInterface", SilKit::Services::MatchingLabel::Kind::Mandatory);
+  auto ReturnFunc_test_MySetter = [this](auto* /*client*/, const auto& event) {
+    VAF_TRACE_INSTANT("vaf.rpc", "MySetter result", "MyBatchedConsumerModule");
+    auto promise = pending_calls_test_MySetter_.Complete(event.userContext);
+    if (!promise) {
+      // The call already timed out or was cancelled
+      return;
+    }
+    if (event.callStatus == SilKit::Services::Rpc::RpcCallStatus::Success) {
+      promise->set_value();
+    } else {
+      vaf::Error error_code{::vaf::ErrorCode::kNotOk, "Rpc call failed"};
+      vaf::internal::SetVafErrorCodeToPromise(*promise, error_code);
+    }
+  };
+  rpc_client_test_MySetter_= participant.CreateRpcClient("MyBatchedConsumerModule_test_MySetter", rpcspec_test_MySetter, ReturnFunc_test_MySetter);
+
+}
+
+void MyBatchedConsumerModule::DeInit() noexcept {
+}
+
+void MyBatchedConsumerModule::StartEventHandlerForModule(vaf::ModuleId module) {
+  active_modules_.Insert(module);
+}
+
+void MyBatchedConsumerModule::StopEventHandlerForModule(vaf::ModuleId module) {
+  active_modules_.Erase(module);
+}
+
+vaf::Vector<vaf::MemoryUsage> MyBatchedConsumerModule::GetMemoryUsage() const {
+  vaf::Vector<vaf::MemoryUsage> usage{};
+  usage.push_back(vaf::MemoryUsage{name_, "my_data_element1"});
+  channel_test_my_data_element1_.AddMemoryUsage(usage.back());
+  usage.push_back(vaf::MemoryUsage{name_, "my_data_element2"});
+  channel_test_my_data_element2_.AddMemoryUsage(usage.back());
+  usage.push_back(vaf::MemoryUsage{name_, "my_data_element3"});
+  channel_test_my_data_element3_.AddMemoryUsage(usage.back());
+  usage.push_back(vaf::MemoryUsage{name_, "my_data_element4"});
+  channel_test_my_data_element4_.AddMemoryUsage(usage.back());
+  return usage;
+}
+
+
+void MyBatchedConsumerModule::OnSample_test_my_data_element1(const std::uint8_t* data, std::size_t size) {
+  if (!started_.load(std::memory_order_acquire)) {
+    // Samples received while the module is stopped are dropped
+    return;
+  }
+  VAF_ALLOCATION_SCOPE("MyBatchedConsumerModule.my_data_element1 Receive");
+  std::unique_ptr< std::uint64_t > ptr;
+  ptr = std::make_unique< std::uint64_t >();
+  if (!vaf::silkit::DeserializeFlat(data, size, *ptr)) {
+    vaf::LoggerSingleton::getInstance()->default_logger_.LogWarn() << "MyBatchedConsumerModule: Dropped a sample of my_data_element1 with a different layout";
+    return;
+  }
+  vaf::ConstDataPtr<const std::uint64_t> sample{std::move(ptr)};
+  channel_test_my_data_element1_.Publish(std::move(sample), active_modules_);
+}
+
+::vaf::Result<::vaf::ConstDataPtr<const std::uint64_t>> MyBatchedConsumerModule::GetAllocated_my_data_element1() {
+  ::vaf::Result<::vaf::ConstDataPtr<const std::uint64_t>> result_value{
+      ::vaf::Error{::vaf::ErrorCode::kNotOk, "No sample available"}};
+  ::vaf::ConstDataPtr<const std::uint64_t> sample{channel_test_my_data_element1_.Load()};
+  if (sample) {
+    result_value = ::vaf::Result<::vaf::ConstDataPtr<const std::uint64_t>>{std::move(sample)};
+  }
+  return result_value;
+}
+
+std::uint64_t MyBatchedConsumerModule::Get_my_data_element1() {
+  std::uint64_t return_value{};
+  const ::vaf::ConstDataPtr<const std::uint64_t> sample{channel_test_my_data_element1_.Load()};
+  if (sample) {
+    return_value = *sample;
+  }
+  return return_value;
+}
+
+void MyBatchedConsumerModule::RegisterDataElementHandler_my_data_element1(vaf::String owner, std::function<void(const ::vaf::ConstDataPtr<const std::uint64_t>)>&& f) {
+  channel_test_my_data_element1_.AddHandler(owner, std::move(f));
+}
+
+
+void MyBatchedConsumerModule::OnSample_test_my_data_element2(const std::uint8_t* data, std::size_t size) {
+  if (!started_.load(std::memory_order_acquire)) {
+    // Samples received while the module is stopped are dropped
+    return;
+  }
+  VAF_ALLOCATION_SCOPE("MyBatchedConsumerModule.my_data_element2 Receive");
+  std::unique_ptr< std::uint64_t > ptr;
+  ptr = std::make_unique< std::uint64_t >();
+  if (!vaf::silkit::DeserializeFlat(data, size, *ptr)) {
+    vaf::LoggerSingleton::getInstance()->default_logger_.LogWarn() << "MyBatchedConsumerModule: Dropped a sample of my_data_element2 with a different layout";
+    return;
+  }
+  vaf::ConstDataPtr<const std::uint64_t> sample{std::move(ptr)};
+  channel_test_my_data_element2_.Publish(std::move(sample), active_modules_);
+}
+
+::vaf::Result<::vaf::ConstDataPtr<const std::uint64_t>> MyBatchedConsumerModule::GetAllocated_my_data_element2() {
+  ::vaf::Result<::vaf::ConstDataPtr<const std::uint64_t>> result_value{
+      ::vaf::Error{::vaf::ErrorCode::kNotOk, "No sample available"}};
+  ::vaf::ConstDataPtr<const std::uint64_t> sample{channel_test_my_data_element2_.Load()};
+  if (sample) {
+    result_value = ::vaf::Result<::vaf::ConstDataPtr<const std::uint64_t>>{std::move(sample)};
+  }
+  return result_value;
+}
+
+std::uint64_t MyBatchedConsumerModule::Get_my_data_element2() {
+  std::uint64_t return_value{};
+  const ::vaf::ConstDataPtr<const std::uint64_t> sample{channel_test_my_data_element2_.Load()};
+  if (sample) {
+    return_value = *sample;
+  }
+  return return_value;
+}
+
+void MyBatchedConsumerModule::RegisterDataElementHandler_my_data_element2(vaf::String owner, std::function<void(const ::vaf::ConstDataPtr<const std::uint64_t>)>&& f) {
+  channel_test_my_data_element2_.AddHandler(owner, std::move(f));
+}
+
+
+void MyBatchedConsumerModule::OnSample_test_my_data_element3(const std::uint8_t* data, std::size_t size) {
+  if (!started_.load(std::memory_order_acquire)) {
+    // Samples received while the module is stopped are dropped
+    return;
+  }
+  VAF_ALLOCATION_SCOPE("MyBatchedConsumerModule.my_data_element3 Receive");
+  if (!vaf::silkit::DecompressSample(data, size)) {
+    vaf::LoggerSingleton::getInstance()->default_logger_.LogWarn() << "MyBatchedConsumerModule: Dropped a malformed compressed sample of my_data_element3";
+    return;
+  }
+  std::unique_ptr< test::MyVector > ptr;
+  auto* deserialized = reception_arena_test_my_data_element3_.Create<protobuf::interface::test::MyInterface::my_data_element3>();
+  deserialized->ParseFromArray(data, static_cast<int>(size));
+  ptr = std::make_unique< test::MyVector >();
+  ::protobuf::interface::test::MyInterface::my_data_element3ProtoToVaf(std::move(*deserialized),*ptr);
+  reception_arena_test_my_data_element3_.Reset();
+  vaf::ConstDataPtr<const test::MyVector> sample{std::move(ptr)};
+  channel_test_my_data_element3_.Publish(std::move(sample), active_modules_);
+}
+
+::vaf::Result<::vaf::ConstDataPtr<const test::MyVector>> MyBatchedConsumerModule::GetAllocated_my_data_element3() {
+  ::vaf::Result<::vaf::ConstDataPtr<const test::MyVector>> result_value{
+      ::vaf::Error{::vaf::ErrorCode::kNotOk, "No sample available"}};
+  ::vaf::ConstDataPtr<const test::MyVector> sample{channel_test_my_data_element3_.Load()};
+  if (sample) {
+    result_value = ::vaf::Result<::vaf::ConstDataPtr<const test::MyVector>>{std::move(sample)};
+  }
+  return result_value;
+}
+
+test::MyVector MyBatchedConsumerModule::Get_my_data_element3() {
+  test::MyVector return_value{};
+  const ::vaf::ConstDataPtr<const test::MyVector> sample{channel_test_my_data_element3_.Load()};
+  if (sample) {
+    return_value = *sample;
+  }
+  return return_value;
+}
+
+void MyBatchedConsumerModule::RegisterDataElementHandler_my_data_element3(vaf::String owner, std::function<void(const ::vaf::ConstDataPtr<const test::MyVector>)>&& f) {
+  channel_test_my_data_element3_.AddHandler(owner, std::move(f));
+}
+
+
+void MyBatchedConsumerModule::OnSample_test_my_data_element4(const std::uint8_t* data, std::size_t size) {
+  if (!started_.load(std::memory_order_acquire)) {
+    // Samples received while the module is stopped are dropped
+    return;
+  }
+  VAF_ALLOCATION_SCOPE("MyBatchedConsumerModule.my_data_element4 Receive");
+  if (!delta_decoder_test_my_data_element4_.Decode(data, size)) {
+    vaf::LoggerSingleton::getInstance()->default_logger_.LogWarn() << "MyBatchedConsumerModule: Dropped a sample of my_data_element4 without its keyframe";
+    return;
+  }
+  std::unique_ptr< test::MyState > ptr;
+  auto* deserialized = reception_arena_test_my_data_element4_.Create<protobuf::interface::test::MyInterface::my_data_element4>();
+  deserialized->ParseFromArray(data, static_cast<int>(size));
+  ptr = std::make_unique< test::MyState >();
+  ::protobuf::interface::test::MyInterface::my_data_element4ProtoToVaf(std::move(*deserialized),*ptr);
+  reception_arena_test_my_data_element4_.Reset();
+  vaf::ConstDataPtr<const test::MyState> sample{std::move(ptr)};
+  channel_test_my_data_element4_.Publish(std::move(sample), active_modules_);
+}
+
+::vaf::Result<::vaf::ConstDataPtr<const test::MyState>> MyBatchedConsumerModule::GetAllocated_my_data_element4() {
+  ::vaf::Result<::vaf::ConstDataPtr<const test::MyState>> result_value{
+      ::vaf::Error{::vaf::ErrorCode::kNotOk, "No sample available"}};
+  ::vaf::ConstDataPtr<const test::MyState> sample{channel_test_my_data_element4_.Load()};
+  if (sample) {
+    result_value = ::vaf::Result<::vaf::ConstDataPtr<const test::MyState>>{std::move(sample)};
+  }
+  return result_value;
+}
+
+test::MyState MyBatchedConsumerModule::Get_my_data_element4() {
+  test::MyState return_value{};
+  const ::vaf::ConstDataPtr<const test::MyState> sample{channel_test_my_data_element4_.Load()};
+  if (sample) {
+    return_value = *sample;
+  }
+  return return_value;
+}
+
+void MyBatchedConsumerModule::RegisterDataElementHandler_my_data_element4(vaf::String owner, std::function<void(const ::vaf::ConstDataPtr<const test::MyState>)>&& f) {
+  channel_test_my_data_element4_.AddHandler(owner, std::move(f));
+}
+
+
+
+::vaf::Future<void> MyBatchedConsumerModule::MyVoidOperation(const std::uint64_t& in) {
+  ::vaf::Future<void> return_value;
+  void* call_context = pending_calls_test_MyVoidOperation_.Begin(return_value);
+  if (call_context == nullptr) {
+    return return_value;
+  }
+  protobuf::interface::test::MyInterface::MyVoidOperation_in request;
+  protobuf::interface::test::MyInterface::MyVoidOperationInVafToProto(in, request);
+  const std::vector<std::uint8_t>& serialized = vaf::silkit::SerializeToBuffer(request);
+  VAF_TRACE_INSTANT("vaf.rpc", "MyVoidOperation call", "MyBatchedConsumerModule");
+  rpc_client_test_MyVoidOperation_->Call(serialized, call_context);
+
+  return return_value;
+}
+::vaf::Future<test::MyOperation::Output> MyBatchedConsumerModule::MyOperation(const std::uint64_t& in, const std::uint64_t& inout) {
+  ::vaf::Future<test::MyOperation::Output> return_value;
+  void* call_context = pending_calls_test_MyOperation_.Begin(return_value);
+  if (call_context == nullptr) {
+    return return_value;
+  }
+  protobuf::interface::test::MyInterface::MyOperation_in request;
+  protobuf::interface::test::MyInterface::MyOperationInVafToProto(in, inout, request);
+  const std::vector<std::uint8_t>& serialized = vaf::silkit::SerializeToBuffer(request);
+  VAF_TRACE_INSTANT("vaf.rpc", "MyOperation call", "MyBatchedConsumerModule");
+  rpc_client_test_MyOperation_->Call(serialized, call_context);
+
+  return return_value;
+}
+::vaf::Future<test::MyGetter::Output> MyBatchedConsumerModule::MyGetter() {
+  // The field is answered from its latest notification, the provider is only called until the first one
+  if (channel_test_my_data_element1_.HasPublished()) {
+    ::vaf::internal::Promise<test::MyGetter::Output> cached;
+    cached.set_value(test::MyGetter::Output{*channel_test_my_data_element1_.Load()});
+    return ::vaf::internal::CreateVafFutureFromVafPromise<test::MyGetter::Output>(cached);
+  }
+  ::vaf::Future<test::MyGetter::Output> return_value;
+  void* call_context = pending_calls_test_MyGetter_.Begin(return_value);
+  if (call_context == nullptr) {
+    return return_value;
+  }
+  protobuf::interface::test::MyInterface::MyGetter_in request;
+  const std::vector<std::uint8_t>& serialized = vaf::silkit::SerializeToBuffer(request);
+  VAF_TRACE_INSTANT("vaf.rpc", "MyGetter call", "MyBatchedConsumerModule");
+  rpc_client_test_MyGetter_->Call(serialized, call_context);
+
+  return return_value;
+}
+::vaf::Future<void> MyBatchedConsumerModule::MySetter(const std::uint64_t& a) {
+  ::vaf::Future<void> return_value;
+  void* call_context = pending_calls_test_MySetter_.Begin(return_value);
+  if (call_context == nullptr) {
+    return return_value;
+  }
+  protobuf::interface::test::MyInterface::MySetter_in request;
+  protobuf::interface::test::MyInterface::MySetterInVafToProto(a, request);
+  const std::vector<std::uint8_t>& serialized = vaf::silkit::SerializeToBuffer(request);
+  VAF_TRACE_INSTANT("vaf.rpc", "MySetter call", "MyBatchedConsumerModule");
+  rpc_client_test_MySetter_->Call(serialized, call_context);
+
+  return return_value;
+}
+
+} // namespace test
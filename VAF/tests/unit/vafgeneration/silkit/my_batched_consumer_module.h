@@ -0,0 +1,123 @@
+/*!********************************************************************************************************************
+ *  COPYRIGHT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  Copyright (c) 2024-2026 by Vector Informatik GmbH. All rights reserved.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -----------------------------------------------------------------------------------------------------------------*/
+/*!        \file  my_batched_consumer_module.h
+ *         \brief
+ *
+ *********************************************************************************************************************/
+
+#ifndef TEST_MY_BATCHED_CONSUMER_MODULE_H
+#define TEST_MY_BATCHED_CONSUMER_MODULE_H
+
+#include <atomic>
+#include <memory>
+#include "vaf/container_types.h"
+#include "vaf/controller_interface.h"
+#include "vaf/data_element_channel.h"
+#include "vaf/data_ptr.h"
+#include "vaf/executable_controller_interface.h"
+#include "vaf/module_id.h"
+#include "vaf/result.h"
+#include "vaf/silkit/lazy_sample.h"
+#include "vaf/silkit/pending_calls.h"
+#include "vaf/silkit/reception_arena.h"
+#include "vaf/silkit/sample_delta.h"
+
+#include "test/my_interface_consumer.h"
+
+// The SIL Kit services are only held by pointer, so including SIL Kit and protobuf is left to the source file
+namespace SilKit {
+namespace Services {
+namespace PubSub {
+class IDataSubscriber;
+}  // namespace PubSub
+namespace Rpc {
+class IRpcClient;
+}  // namespace Rpc
+}  // namespace Services
+}  // namespace SilKit
+
+
+namespace test {
+
+class MyBatchedConsumerModule final : public test::MyInterfaceConsumer, public vaf::ControlInterface {
+ public:
+  MyBatchedConsumerModule(vaf::Executor& executor, vaf::String name, vaf::ExecutableControllerInterface& executable_controller_interface);
+  ~MyBatchedConsumerModule() override = default;
+
+  MyBatchedConsumerModule(const MyBatchedConsumerModule&) = delete;
+  MyBatchedConsumerModule(MyBatchedConsumerModule&&) = delete;
+  MyBatchedConsumerModule& operator=(const MyBatchedConsumerModule&) = delete;
+  MyBatchedConsumerModule& operator=(MyBatchedConsumerModule&&) = delete;
+
+  // Management related operations
+  vaf::Result<void> Init() noexcept override;
+  void Start() noexcept override;
+  void Stop() noexcept override;
+  void DeInit() noexcept override;
+  void StartEventHandlerForModule(vaf::ModuleId module) override;
+  void StopEventHandlerForModule(vaf::ModuleId module) override;
+  vaf::Vector<vaf::MemoryUsage> GetMemoryUsage() const override;
+
+  ::vaf::Result<::vaf::ConstDataPtr<const std::uint64_t>> GetAllocated_my_data_element1() override;
+  std::uint64_t Get_my_data_element1() override;
+  void RegisterDataElementHandler_my_data_element1(vaf::String owner, std::function<void(const ::vaf::ConstDataPtr<const std::uint64_t>)>&& f) override;
+  ::vaf::Result<::vaf::ConstDataPtr<const std::uint64_t>> GetAllocated_my_data_element2() override;
+  std::uint64_t Get_my_data_element2() override;
+  void RegisterDataElementHandler_my_data_element2(vaf::String owner, std::function<void(const ::vaf::ConstDataPtr<const std::uint64_t>)>&& f) override;
+  ::vaf::Result<::vaf::ConstDataPtr<const test::MyVector>> GetAllocated_my_data_element3() override;
+  test::MyVector Get_my_data_element3() override;
+  void RegisterDataElementHandler_my_data_element3(vaf::String owner, std::function<void(const ::vaf::ConstDataPtr<const test::MyVector>)>&& f) override;
+  ::vaf::Result<::vaf::ConstDataPtr<const test::MyState>> GetAllocated_my_data_element4() override;
+  test::MyState Get_my_data_element4() override;
+  void RegisterDataElementHandler_my_data_element4(vaf::String owner, std::function<void(const ::vaf::ConstDataPtr<const test::MyState>)>&& f) override;
+
+  ::vaf::Future<void> MyVoidOperation(const std::uint64_t& in) override;
+  ::vaf::Future<test::MyOperation::Output> MyOperation(const std::uint64_t& in, const std::uint64_t& inout) override;
+  ::vaf::Future<test::MyGetter::Output> MyGetter() override;
+  ::vaf::Future<void> MySetter(const std::uint64_t& a) override;
+
+ private:
+  // Create the subscribers and Rpc clients on the shared participant, called by the first Start() only
+  void CreateControllers();
+  // Deserialize a received sample, store it and call the registered handlers
+  void OnSample_test_my_data_element1(const std::uint8_t* data, std::size_t size);
+  void OnSample_test_my_data_element2(const std::uint8_t* data, std::size_t size);
+  void OnSample_test_my_data_element3(const std::uint8_t* data, std::size_t size);
+  void OnSample_test_my_data_element4(const std::uint8_t* data, std::size_t size);
+
+  vaf::ModuleExecutor& executor_;
+  vaf::ModuleSet active_modules_{};
+  bool controllers_created_{false};
+  std::atomic<bool> started_{false};
+  // The provider sends all data elements set within one of its executor time slots as one message
+  SilKit::Services::PubSub::IDataSubscriber* batch_subscriber_;
+
+  vaf::DataElementChannel<std::uint64_t, vaf::ReceivedChannelPolicy> channel_test_my_data_element1_{"my_data_element1", vaf::MetricLabels{ {"module", "MyBatchedConsumerModule"}, {"data_element", "my_data_element1"} } };
+  vaf::DataElementChannel<std::uint64_t, vaf::ReceivedChannelPolicy> channel_test_my_data_element2_{"my_data_element2", vaf::MetricLabels{ {"module", "MyBatchedConsumerModule"}, {"data_element", "my_data_element2"} }, ::vaf::MakeConstDataPtr<const std::uint64_t>(std::uint64_t{64})};
+  vaf::DataElementChannel<test::MyVector, vaf::ReceivedChannelPolicy> channel_test_my_data_element3_{"my_data_element3", vaf::MetricLabels{ {"module", "MyBatchedConsumerModule"}, {"data_element", "my_data_element3"} } };
+  vaf::silkit::ReceptionArena reception_arena_test_my_data_element3_{};
+  vaf::DataElementChannel<test::MyState, vaf::ReceivedChannelPolicy> channel_test_my_data_element4_{"my_data_element4", vaf::MetricLabels{ {"module", "MyBatchedConsumerModule"}, {"data_element", "my_data_element4"} } };
+  vaf::silkit::ReceptionArena reception_arena_test_my_data_element4_{};
+  vaf::silkit::DeltaDecoder delta_decoder_test_my_data_element4_{vaf::silkit::DeltaLayout::kProtobuf};
+  SilKit::Services::Rpc::IRpcClient* rpc_client_test_MyVoidOperation_;
+  vaf::silkit::PendingCalls<void> pending_calls_test_MyVoidOperation_{ 16, std::chrono::nanoseconds::zero() };
+  SilKit::Services::Rpc::IRpcClient* rpc_client_test_MyOperation_;
+  vaf::silkit::PendingCalls<test::MyOperation::Output> pending_calls_test_MyOperation_{ 16, std::chrono::nanoseconds::zero() };
+  SilKit::Services::Rpc::IRpcClient* rpc_client_test_MyGetter_;
+  vaf::silkit::PendingCalls<test::MyGetter::Output> pending_calls_test_MyGetter_{ 16, std::chrono::nanoseconds::zero() };
+  SilKit::Services::Rpc::IRpcClient* rpc_client_test_MySetter_;
+  vaf::silkit::PendingCalls<void> pending_calls_test_MySetter_{ 16, std::chrono::nanoseconds::zero() };
+};
+
+
+} // namespace test
+
+#endif // TEST_MY_BATCHED_CONSUMER_MODULE_H
@@ -0,0 +1,108 @@
+/*!********************************************************************************************************************
+ *  COPYRIGHT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  Copyright (c) 2024-2026 by Vector Informatik GmbH. All rights reserved.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -----------------------------------------------------------------------------------------------------------------*/
+/*!        \file  my_batched_provider_module.h
+ *         \brief
+ *
+ *********************************************************************************************************************/
+
+#ifndef TEST_MY_BATCHED_PROVIDER_MODULE_H
+#define TEST_MY_BATCHED_PROVIDER_MODULE_H
+
+#include <atomic>
+#include <memory>
+#include "vaf/container_types.h"
+#include "vaf/controller_interface.h"
+#include "vaf/data_ptr.h"
+#include "vaf/executable_controller_interface.h"
+#include "vaf/metrics.h"
+#include "vaf/result.h"
+#include "vaf/silkit/publish_throttle.h"
+#include "vaf/silkit/rpc_dispatch.h"
+#include "vaf/silkit/sample_batch.h"
+#include "vaf/silkit/sample_delta.h"
+
+#include "test/my_interface_provider.h"
+
+// The SIL Kit services are only held by pointer, so including SIL Kit and protobuf is left to the source file
+namespace SilKit {
+namespace Services {
+namespace PubSub {
+class IDataPublisher;
+}  // namespace PubSub
+namespace Rpc {
+class IRpcServer;
+}  // namespace Rpc
+}  // namespace Services
+}  // namespace SilKit
+
+namespace test {
+
+class MyBatchedProviderModule final : public test::MyInterfaceProvider, public vaf::ControlInterface {
+ public:
+  explicit MyBatchedProviderModule(vaf::Executor& executor, vaf::String name, vaf::ExecutableControllerInterface& executable_controller_interface);
+  ~MyBatchedProviderModule() override = default;
+
+  vaf::Result<void> Init() noexcept override;
+  void Start() noexcept override;
+  void Stop() noexcept override;
+  void DeInit() noexcept override;
+
+  ::vaf::Result<::vaf::DataPtr<std::uint64_t>> Allocate_my_data_element1() override;
+  ::vaf::Result<void> SetAllocated_my_data_element1(::vaf::DataPtr<std::uint64_t>&& data) override;
+  ::vaf::Result<void> Set_my_data_element1(const std::uint64_t& data) override;
+  ::vaf::Result<::vaf::DataPtr<std::uint64_t>> Allocate_my_data_element2() override;
+  ::vaf::Result<void> SetAllocated_my_data_element2(::vaf::DataPtr<std::uint64_t>&& data) override;
+  ::vaf::Result<void> Set_my_data_element2(const std::uint64_t& data) override;
+  ::vaf::Result<::vaf::DataPtr<test::MyVector>> Allocate_my_data_element3() override;
+  ::vaf::Result<void> SetAllocated_my_data_element3(::vaf::DataPtr<test::MyVector>&& data) override;
+  ::vaf::Result<void> Set_my_data_element3(const test::MyVector& data) override;
+  ::vaf::Result<::vaf::DataPtr<test::MyState>> Allocate_my_data_element4() override;
+  ::vaf::Result<void> SetAllocated_my_data_element4(::vaf::DataPtr<test::MyState>&& data) override;
+  ::vaf::Result<void> Set_my_data_element4(const test::MyState& data) override;
+
+  void RegisterOperationHandler_MyVoidOperation(std::function<void(const std::uint64_t&)>&& f) override;
+  void RegisterOperationHandler_MyOperation(std::function<test::MyOperation::Output(const std::uint64_t&, const std::uint64_t&)>&& f) override;
+  void RegisterOperationHandler_MyGetter(std::function<test::MyGetter::Output()>&& f) override;
+  void RegisterOperationHandler_MySetter(std::function<void(const std::uint64_t&)>&& f) override;
+
+ private:
+  // Create the publishers and Rpc servers on the shared participant, called by the first Start() only
+  void CreateControllers();
+
+  bool controllers_created_{false};
+  std::atomic<bool> started_{false};
+  // All data elements set within one executor time slot are sent as one message
+  SilKit::Services::PubSub::IDataPublisher* batch_publisher_;
+  vaf::silkit::SampleBatch sample_batch_{};
+  vaf::Counter& metric_published_test_my_data_element1_{vaf::GetCounter("vaf_data_element_published_total", vaf::MetricLabels{ {"module", "MyBatchedProviderModule"}, {"data_element", "my_data_element1"} })};
+  vaf::Counter& metric_published_test_my_data_element2_{vaf::GetCounter("vaf_data_element_published_total", vaf::MetricLabels{ {"module", "MyBatchedProviderModule"}, {"data_element", "my_data_element2"} })};
+  vaf::silkit::PublishThrottle publish_throttle_test_my_data_element2_{ false, std::chrono::microseconds{ 20000 } };
+  vaf::Counter& metric_published_test_my_data_element3_{vaf::GetCounter("vaf_data_element_published_total", vaf::MetricLabels{ {"module", "MyBatchedProviderModule"}, {"data_element", "my_data_element3"} })};
+  vaf::silkit::PublishThrottle publish_throttle_test_my_data_element3_{ true, std::chrono::microseconds{ 0 } };
+  vaf::Counter& metric_published_test_my_data_element4_{vaf::GetCounter("vaf_data_element_published_total", vaf::MetricLabels{ {"module", "MyBatchedProviderModule"}, {"data_element", "my_data_element4"} })};
+  vaf::silkit::DeltaEncoder delta_encoder_test_my_data_element4_{vaf::silkit::DeltaLayout::kProtobuf, 10U};
+
+  std::function<void(const std::uint64_t&)> CbkFunction_test_MyVoidOperation_{};
+  SilKit::Services::Rpc::IRpcServer* server_test_MyVoidOperation_;
+  std::function<test::MyOperation::Output(const std::uint64_t&, const std::uint64_t&)> CbkFunction_test_MyOperation_{};
+  SilKit::Services::Rpc::IRpcServer* server_test_MyOperation_;
+  // Declared after the handler, so the worker threads are joined before it is destroyed
+  vaf::silkit::RpcWorkerPool worker_pool_test_MyOperation_{4U, 32U};
+  std::function<test::MyGetter::Output()> CbkFunction_test_MyGetter_{};
+  SilKit::Services::Rpc::IRpcServer* server_test_MyGetter_;
+  std::function<void(const std::uint64_t&)> CbkFunction_test_MySetter_{};
+  SilKit::Services::Rpc::IRpcServer* server_test_MySetter_;
+  vaf::silkit::RpcCallLimit call_limit_test_MySetter_{16U};
+};
+
+} // namespace test
+
+#endif // TEST_MY_BATCHED_PROVIDER_MODULE_H
@@ -16,19 +16,37 @@
 #include "test/my_consumer_module.h"
 
 #include <chrono>
-#include <cstdlib>
 #include <google/protobuf/serial_arena.h>
 
+#include "vaf/allocation_tracking.h"
 #include "vaf/error_domain.h"
+#include "vaf/logging.h"
+#include "vaf/silkit/flat_wire_format.h"
+#include "vaf/silkit/participant.h"
+#include "vaf/silkit/sample_batch.h"
+#include "vaf/silkit/sample_compression.h"
+#include "vaf/silkit/serialization_buffer.h"
 #include "vaf/future.h"
-#include "vaf/internal/promise.h"
+#include "vaf/trace.h"
 #include "protobuf/interface/test/myinterface/protobuf_transformer.h"
 
+#include "silkit/SilKit.hpp"
+#include "silkit/services/all.hpp"
+#include "silkit/services/orchestration/string_utils.hpp"
+#include "silkit/util/serdes/Serialization.hpp"
+#include "protobuf_interface_test_MyInterface.pb.h"
+
 namespace test {
 
 MyConsumerModule::MyConsumerModule(::vaf::Executor& executor, vaf::String name, ::vaf::ExecutableControllerInterface& executable_controller_interface)
   : ::vaf::ControlInterface(std::move(name), {}, executable_controller_interface, executor),
     executor_{ControlInterface::executor_} {
+  executor_.RunPeriodic("RpcTimeouts", vaf::silkit::RpcTimeoutSweepPeriod(std::chrono::milliseconds{ 100 }, executor_.RunningPeriod()), [this]() {
+    pending_calls_test_MyVoidOperation_.ExpireTimedOut();
+    pending_calls_test_MyOperation_.ExpireTimedOut();
+    pending_calls_test_MyGetter_.ExpireTimedOut();
+    pending_calls_test_MySetter_.ExpireTimedOut();
+  });
 }
 
 ::vaf::Result<void> MyConsumerModule::Init() noexcept {
@@ -36,289 +54,390 @@ MyConsumerModule::MyConsumerModule(::vaf::Executor& executor, vaf::String name,
 }
 
 void MyConsumerModule::Start() noexcept {
-  const char* value = std::getenv("SILKIT_REGISTRY_URI");
-  const auto registry_uri = (value != nullptr) ? std::string(value) : "silkit://localhost:8501";
-
-  const std::string participant_config_text = R"(
-  Description: My participant configuration
-  Logging:
-      Sinks:
-      - Type: Stdout
-        Level: Info
-  )";
-  auto config = SilKit::Config::ParticipantConfigurationFromString(participant_config_text);
-  participant_ = SilKit::CreateParticipant(config, "test_MyConsumerModule", registry_uri);
-
-  SilKit::Services::PubSub::PubSubSpec pubsubspec_test_my_data_element1{"MyInterface_my_data_element1", "application/protobuf"};
+  // SIL Kit cannot remove controllers again, so a restart only reactivates the ones of the first start
+  if (!controllers_created_) {
+    CreateControllers();
+    controllers_created_ = true;
+  }
+  started_.store(true, std::memory_order_release);
+  ReportOperational();
+}
+
+void MyConsumerModule::Stop() noexcept {
+  started_.store(false, std::memory_order_release);
+  pending_calls_test_MyVoidOperation_.CancelAll();
+  pending_calls_test_MyOperation_.CancelAll();
+  pending_calls_test_MyGetter_.CancelAll();
+  pending_calls_test_MySetter_.CancelAll();
+}
+
+void MyConsumerModule::CreateControllers() {
+  // All SIL Kit modules of the executable share one participant
+  SilKit::IParticipant& participant = vaf::silkit::GetParticipant();
+
+  SilKit::Services::PubSub::PubSubSpec pubsubspec_test_my_data_element1{"MyInterface_my_data_element1", vaf::silkit::kFlatMediaType};
   pubsubspec_test_my_data_element1.AddLabel("Instance", "MyInterface", SilKit::Services::MatchingLabel::Kind::Mandatory);
-  auto receptionHandler_test_my_data_element1 = [&](auto* subscriber, const auto& dataMessageEvent) {
-    const std::lock_guard<std::mutex> lock(cached_test_my_data_element1_mutex_);
-
-    std::unique_ptr< std::uint64_t > ptr;
-    protobuf::interface::test::MyInterface::my_data_element1  deserialized;
-    deserialized.ParseFromArray( dataMessageEvent.data.data(), dataMessageEvent.data.size() );
-    ptr = std::make_unique< std::uint64_t >();
-    ::protobuf::interface::test::MyInterface::my_data_element1ProtoToVaf(deserialized,*ptr);
-    this->cached_test_my_data_element1_ = vaf::ConstDataPtr<const std::uint64_t>{std::move(ptr)};
-
-    for(auto& handler_container : registered_test_my_data_element1_event_handlers_) {
-      if(handler_container.is_active_) {
-        handler_container.handler_(cached_test_my_data_element1_);
-      }
-    }
+  auto receptionHandler_test_my_data_element1 = [this](auto* /*subscriber*/, const auto& dataMessageEvent) {
+    OnSample_test_my_data_element1(dataMessageEvent.data.data(), dataMessageEvent.data.size());
   };
-  subscriber_test_my_data_element1_= participant_->CreateDataSubscriber("Subscriber_test_my_data_element1", pubsubspec_test_my_data_element1, receptionHandler_test_my_data_element1);
+  subscriber_test_my_data_element1_= participant.CreateDataSubscriber("MyConsumerModule_Subscriber_test_my_data_element1", pubsubspec_test_my_data_element1, receptionHandler_test_my_data_element1);
 
-  SilKit::Services::PubSub::PubSubSpec pubsubspec_test_my_data_element2{"MyInterface_my_data_element2", "application/protobuf"};
+  SilKit::Services::PubSub::PubSubSpec pubsubspec_test_my_data_element2{"MyInterface_my_data_element2", vaf::silkit::kFlatMediaType};
   pubsubspec_test_my_data_element2.AddLabel("Instance", "MyInterface", SilKit::Services::MatchingLabel::Kind::Mandatory);
-  auto receptionHandler_test_my_data_element2 = [&](auto* subscriber, const auto& dataMessageEvent) {
-    const std::lock_guard<std::mutex> lock(cached_test_my_data_element2_mutex_);
-
-    std::unique_ptr< std::uint64_t > ptr;
-    protobuf::interface::test::MyInterface::my_data_element2  deserialized;
-    deserialized.ParseFromArray( dataMessageEvent.data.data(), dataMessageEvent.data.size() );
-    ptr = std::make_unique< std::uint64_t >();
-    ::protobuf::interface::test::MyInterface::my_data_element2ProtoToVaf(deserialized,*ptr);
-    this->cached_test_my_data_element2_ = vaf::ConstDataPtr<const std::uint64_t>{std::move(ptr)};
-
-    for(auto& handler_container : registered_test_my_data_element2_event_handlers_) {
-      if(handler_container.is_active_) {
-        handler_container.handler_(cached_test_my_data_element2_);
-      }
-    }
+  auto receptionHandler_test_my_data_element2 = [this](auto* /*subscriber*/, const auto& dataMessageEvent) {
+    OnSample_test_my_data_element2(dataMessageEvent.data.data(), dataMessageEvent.data.size());
+  };
+  subscriber_test_my_data_element2_= participant.CreateDataSubscriber("MyConsumerModule_Subscriber_test_my_data_element2", pubsubspec_test_my_data_element2, receptionHandler_test_my_data_element2);
+
+  SilKit::Services::PubSub::PubSubSpec pubsubspec_test_my_data_element3{"MyInterface_my_data_element3", vaf::silkit::CompressedMediaType("application/protobuf", vaf::silkit::Compression::kLz4)};
+  pubsubspec_test_my_data_element3.AddLabel("Instance", "MyInterface", SilKit::Services::MatchingLabel::Kind::Mandatory);
+  auto receptionHandler_test_my_data_element3 = [this](auto* /*subscriber*/, const auto& dataMessageEvent) {
+    OnSample_test_my_data_element3(dataMessageEvent.data.data(), dataMessageEvent.data.size());
+  };
+  subscriber_test_my_data_element3_= participant.CreateDataSubscriber("MyConsumerModule_Subscriber_test_my_data_element3", pubsubspec_test_my_data_element3, receptionHandler_test_my_data_element3);
+
+  SilKit::Services::PubSub::PubSubSpec pubsubspec_test_my_data_element4{"MyInterface_my_data_element4", vaf::silkit::DeltaMediaType("application/protobuf")};
+  pubsubspec_test_my_data_element4.AddLabel("Instance", "MyInterface", SilKit::Services::MatchingLabel::Kind::Mandatory);
+  auto receptionHandler_test_my_data_element4 = [this](auto* /*subscriber*/, const auto& dataMessageEvent) {
+    OnSample_test_my_data_element4(dataMessageEvent.data.data(), dataMessageEvent.data.size());
   };
-  subscriber_test_my_data_element2_= participant_->CreateDataSubscriber("Subscriber_test_my_data_element2", pubsubspec_test_my_data_element2, receptionHandler_test_my_data_element2);
+  subscriber_test_my_data_element4_= participant.CreateDataSubscriber("MyConsumerModule_Subscriber_test_my_data_element4", pubsubspec_test_my_data_element4, receptionHandler_test_my_data_element4);
 
 
   SilKit::Services::Rpc::RpcSpec rpcspec_test_MyVoidOperation{"MyInterface_MyVoidOperation", "application/protobuf"};
   rpcspec_test_MyVoidOperation.AddLabel("Instance", "MyInterface", SilKit::Services::MatchingLabel::Kind::Mandatory);
-  auto ReturnFunc_test_MyVoidOperation = [&](auto* /*client*/, const auto& event) {
-    ::vaf::internal::Promise<void>*
-        promise_pointer = static_cast<
-          ::vaf::internal::Promise<void>*>(
-            event.userContext);
+  auto ReturnFunc_test_MyVoidOperation = [this](auto* /*client*/, const auto& event) {
+    VAF_TRACE_INSTANT("vaf.rpc", "MyVoidOperation result", "MyConsumerModule");
+    auto promise = pending_calls_test_MyVoidOperation_.Complete(event.userContext);
+    if (!promise) {
+      // The call already timed out or was cancelled
+      return;
+    }
     if (event.callStatus == SilKit::Services::Rpc::RpcCallStatus::Success) {
-      promise_pointer->set_value();
+      promise->set_value();
     } else {
       vaf::Error error_code{::vaf::ErrorCode::kNotOk, "Rpc call failed"};
-      vaf::internal::SetVafErrorCodeToPromise(*promise_pointer, error_code);
+      vaf::internal::SetVafErrorCodeToPromise(*promise, error_code);
     }
-    delete promise_pointer;
   };
-  rpc_client_test_MyVoidOperation_= participant_->CreateRpcClient("test_MyVoidOperation", rpcspec_test_MyVoidOperation, ReturnFunc_test_MyVoidOperation);
+  rpc_client_test_MyVoidOperation_= participant.CreateRpcClient("MyConsumerModule_test_MyVoidOperation", rpcspec_test_MyVoidOperation, ReturnFunc_test_MyVoidOperation);
 
   SilKit::Services::Rpc::RpcSpec rpcspec_test_MyOperation{"MyInterface_MyOperation", "application/protobuf"};
   rpcspec_test_MyOperation.AddLabel("Instance", "MyInterface", SilKit::Services::MatchingLabel::Kind::Mandatory);
-  auto ReturnFunc_test_MyOperation = [&](auto* /*client*/, const auto& event) {
-    ::vaf::internal::Promise<test::MyOperation::Output>*
-        promise_pointer = static_cast<
-          ::vaf::internal::Promise<test::MyOperation::Output>*>(
-            event.userContext);
+  auto ReturnFunc_test_MyOperation = [this](auto* /*client*/, const auto& event) {
+    VAF_TRACE_INSTANT("vaf.rpc", "MyOperation result", "MyConsumerModule");
+    auto promise = pending_calls_test_MyOperation_.Complete(event.userContext);
+    if (!promise) {
+      // The call already timed out or was cancelled
+      return;
+    }
     if (event.callStatus == SilKit::Services::Rpc::RpcCallStatus::Success) {
       test::MyOperation::Output output;
       protobuf::interface::test::MyInterface::MyOperation_out deserialized;
       deserialized.ParseFromArray( event.resultData.data(), event.resultData.size() );
-      ::protobuf::interface::test::MyInterface::MyOperationOutProtoToVaf(deserialized, output);
-      promise_pointer->set_value(output);
+      ::protobuf::interface::test::MyInterface::MyOperationOutProtoToVaf(std::move(deserialized), output);
+      promise->set_value(std::move(output));
     } else {
       vaf::Error error_code{::vaf::ErrorCode::kNotOk, "Rpc call failed"};
-      vaf::internal::SetVafErrorCodeToPromise(*promise_pointer, error_code);
+      vaf::internal::SetVafErrorCodeToPromise(*promise, error_code);
     }
-    delete promise_pointer;
   };
-  rpc_client_test_MyOperation_= participant_->CreateRpcClient("test_MyOperation", rpcspec_test_MyOperation, ReturnFunc_test_MyOperation);
+  rpc_client_test_MyOperation_= participant.CreateRpcClient("MyConsumerModule_test_MyOperation", rpcspec_test_MyOperation, ReturnFunc_test_MyOperation);
 
   SilKit::Services::Rpc::RpcSpec rpcspec_test_MyGetter{"MyInterface_MyGetter", "application/protobuf"};
   rpcspec_test_MyGetter.AddLabel("Instance", "MyInterface", SilKit::Services::MatchingLabel::Kind::Mandatory);
-  auto ReturnFunc_test_MyGetter = [&](auto* /*client*/, const auto& event) {
-    ::vaf::internal::Promise<test::MyGetter::Output>*
-        promise_pointer = static_cast<
-          ::vaf::internal::Promise<test::MyGetter::Output>*>(
-            event.userContext);
+  auto ReturnFunc_test_MyGetter = [this](auto* /*client*/, const auto& event) {
+    VAF_TRACE_INSTANT("vaf.rpc", "MyGetter result", "MyConsumerModule");
+    auto promise = pending_calls_test_MyGetter_.Complete(event.userContext);
+    if (!promise) {
+      // The call already timed out or was cancelled
+      return;
+    }
     if (event.callStatus == SilKit::Services::Rpc::RpcCallStatus::Success) {
       test::MyGetter::Output output;
       protobuf::interface::test::MyInterface::MyGetter_out deserialized;
       deserialized.ParseFromArray( event.resultData.data(), event.resultData.size() );
-      ::protobuf::interface::test::MyInterface::MyGetterOutProtoToVaf(deserialized, output);
-      promise_pointer->set_value(output);
+      ::protobuf::interface::test::MyInterface::MyGetterOutProtoToVaf(std::move(deserialized), output);
+      promise->set_value(std::move(output));
     } else {
       vaf::Error error_code{::vaf::ErrorCode::kNotOk, "Rpc call failed"};
-      vaf::internal::SetVafErrorCodeToPromise(*promise_pointer, error_code);
+      vaf::internal::SetVafErrorCodeToPromise(*promise, error_code);
     }
-    delete promise_pointer;
   };
-  rpc_client_test_MyGetter_= participant_->CreateRpcClient("test_MyGetter", rpcspec_test_MyGetter, ReturnFunc_test_MyGetter);
+  rpc_client_test_MyGetter_= participant.CreateRpcClient("MyConsumerModule_test_MyGetter", rpcspec_test_MyGetter, ReturnFunc_test_MyGetter);
 
   SilKit::Services::Rpc::RpcSpec rpcspec_test_MySetter{"MyInterface_MySetter", "application/protobuf"};
   rpcspec_test_MySetter.AddLabel("Instance", "MyInterface", SilKit::Services::MatchingLabel::Kind::Mandatory);
-  auto ReturnFunc_test_MySetter = [&](auto* /*client*/, const auto& event) {
-    ::vaf::internal::Promise<void>*
-        promise_pointer = static_cast<
-          ::vaf::internal::Promise<void>*>(
-            event.userContext);
+  auto ReturnFunc_test_MySetter = [this](auto* /*client*/, const auto& event) {
+    VAF_TRACE_INSTANT("vaf.rpc", "MySetter result", "MyConsumerModule");
+    auto promise = pending_calls_test_MySetter_.Complete(event.userContext);
+    if (!promise) {
+      // The call already timed out or was cancelled
+      return;
+    }
     if (event.callStatus == SilKit::Services::Rpc::RpcCallStatus::Success) {
-      promise_pointer->set_value();
+      promise->set_value();
     } else {
       vaf::Error error_code{::vaf::ErrorCode::kNotOk, "Rpc call failed"};
-      vaf::internal::SetVafErrorCodeToPromise(*promise_pointer, error_code);
+      vaf::internal::SetVafErrorCodeToPromise(*promise, error_code);
     }
-    delete promise_pointer;
   };
-  rpc_client_test_MySetter_= participant_->CreateRpcClient("test_MySetter", rpcspec_test_MySetter, ReturnFunc_test_MySetter);
+  rpc_client_test_MySetter_= participant.CreateRpcClient("MyConsumerModule_test_MySetter", rpcspec_test_MySetter, ReturnFunc_test_MySetter);
 
-  ReportOperational();
 }
 
-void MyConsumerModule::Stop() noexcept {
+void MyConsumerModule::DeInit() noexcept {
 }
 
-void MyConsumerModule::DeInit() noexcept {
+void MyConsumerModule::StartEventHandlerForModule(vaf::ModuleId module) {
+  active_modules_.Insert(module);
 }
 
-void MyConsumerModule::StartEventHandlerForModule(const vaf::String& module) {
-  for(auto& handler_container : registered_test_my_data_element1_event_handlers_) {
-    if(handler_container.owner_ == module) {
-      handler_container.is_active_ = true;
-    }
-  }
-  for(auto& handler_container : registered_test_my_data_element2_event_handlers_) {
-    if(handler_container.owner_ == module) {
-      handler_container.is_active_ = true;
-    }
-  }
-  active_modules_.push_back(module);
+void MyConsumerModule::StopEventHandlerForModule(vaf::ModuleId module) {
+  active_modules_.Erase(module);
 }
 
-void MyConsumerModule::StopEventHandlerForModule(const vaf::String& module) {
-  for(auto& handler_container : registered_test_my_data_element1_event_handlers_) {
-    if(handler_container.owner_ == module) {
-      handler_container.is_active_ = false;
-    }
+vaf::Vector<vaf::MemoryUsage> MyConsumerModule::GetMemoryUsage() const {
+  vaf::Vector<vaf::MemoryUsage> usage{};
+  usage.push_back(vaf::MemoryUsage{name_, "my_data_element1"});
+  channel_test_my_data_element1_.AddMemoryUsage(usage.back());
+  usage.push_back(vaf::MemoryUsage{name_, "my_data_element2"});
+  channel_test_my_data_element2_.AddMemoryUsage(usage.back());
+  usage.push_back(vaf::MemoryUsage{name_, "my_data_element3"});
+  channel_test_my_data_element3_.AddMemoryUsage(usage.back());
+  usage.push_back(vaf::MemoryUsage{name_, "my_data_element4"});
+  channel_test_my_data_element4_.AddMemoryUsage(usage.back());
+  return usage;
+}
+
+
+void MyConsumerModule::OnSample_test_my_data_element1(const std::uint8_t* data, std::size_t size) {
+  if (!started_.load(std::memory_order_acquire)) {
+    // Samples received while the module is stopped are dropped
+    return;
   }
-  for(auto& handler_container : registered_test_my_data_element2_event_handlers_) {
-    if(handler_container.owner_ == module) {
-      handler_container.is_active_ = false;
-    }
+  VAF_ALLOCATION_SCOPE("MyConsumerModule.my_data_element1 Receive");
+  std::unique_ptr< std::uint64_t > ptr;
+  ptr = std::make_unique< std::uint64_t >();
+  if (!vaf::silkit::DeserializeFlat(data, size, *ptr)) {
+    vaf::LoggerSingleton::getInstance()->default_logger_.LogWarn() << "MyConsumerModule: Dropped a sample of my_data_element1 with a different layout";
+    return;
   }
-  active_modules_.erase(std::remove(active_modules_.begin(), active_modules_.end(), module));
+  vaf::ConstDataPtr<const std::uint64_t> sample{std::move(ptr)};
+  channel_test_my_data_element1_.Publish(std::move(sample), active_modules_);
 }
 
-
 ::vaf::Result<::vaf::ConstDataPtr<const std::uint64_t>> MyConsumerModule::GetAllocated_my_data_element1() {
   ::vaf::Result<::vaf::ConstDataPtr<const std::uint64_t>> result_value{
       ::vaf::Error{::vaf::ErrorCode::kNotOk, "No sample available"}};
-  const std::lock_guard<std::mutex> lock(cached_test_my_data_element1_mutex_);
-  if (cached_test_my_data_element1_) {
-    result_value = ::vaf::Result<::vaf::ConstDataPtr<const std::uint64_t>>{cached_test_my_data_element1_};
+  ::vaf::ConstDataPtr<const std::uint64_t> sample{channel_test_my_data_element1_.Load()};
+  if (sample) {
+    result_value = ::vaf::Result<::vaf::ConstDataPtr<const std::uint64_t>>{std::move(sample)};
   }
   return result_value;
 }
 
 std::uint64_t MyConsumerModule::Get_my_data_element1() {
   std::uint64_t return_value{};
-  const std::lock_guard<std::mutex> lock(cached_test_my_data_element1_mutex_);
-  if (cached_test_my_data_element1_) {
-    return_value = *cached_test_my_data_element1_;
+  const ::vaf::ConstDataPtr<const std::uint64_t> sample{channel_test_my_data_element1_.Load()};
+  if (sample) {
+    return_value = *sample;
   }
   return return_value;
 }
 
 void MyConsumerModule::RegisterDataElementHandler_my_data_element1(vaf::String owner, std::function<void(const ::vaf::ConstDataPtr<const std::uint64_t>)>&& f) {
-  registered_test_my_data_element1_event_handlers_.emplace_back(owner, std::move(f));
-  if(std::find(active_modules_.begin(), active_modules_.end(), owner) != active_modules_.end()) {
-    registered_test_my_data_element1_event_handlers_.back().is_active_ = true;
-  }
+  channel_test_my_data_element1_.AddHandler(owner, std::move(f));
 }
 
 
+void MyConsumerModule::OnSample_test_my_data_element2(const std::uint8_t* data, std::size_t size) {
+  if (!started_.load(std::memory_order_acquire)) {
+    // Samples received while the module is stopped are dropped
+    return;
+  }
+  VAF_ALLOCATION_SCOPE("MyConsumerModule.my_data_element2 Receive");
+  std::unique_ptr< std::uint64_t > ptr;
+  ptr = std::make_unique< std::uint64_t >();
+  if (!vaf::silkit::DeserializeFlat(data, size, *ptr)) {
+    vaf::LoggerSingleton::getInstance()->default_logger_.LogWarn() << "MyConsumerModule: Dropped a sample of my_data_element2 with a different layout";
+    return;
+  }
+  vaf::ConstDataPtr<const std::uint64_t> sample{std::move(ptr)};
+  channel_test_my_data_element2_.Publish(std::move(sample), active_modules_);
+}
+
 ::vaf::Result<::vaf::ConstDataPtr<const std::uint64_t>> MyConsumerModule::GetAllocated_my_data_element2() {
   ::vaf::Result<::vaf::ConstDataPtr<const std::uint64_t>> result_value{
       ::vaf::Error{::vaf::ErrorCode::kNotOk, "No sample available"}};
-  const std::lock_guard<std::mutex> lock(cached_test_my_data_element2_mutex_);
-  if (cached_test_my_data_element2_) {
-    result_value = ::vaf::Result<::vaf::ConstDataPtr<const std::uint64_t>>{cached_test_my_data_element2_};
+  ::vaf::ConstDataPtr<const std::uint64_t> sample{channel_test_my_data_element2_.Load()};
+  if (sample) {
+    result_value = ::vaf::Result<::vaf::ConstDataPtr<const std::uint64_t>>{std::move(sample)};
   }
   return result_value;
 }
 
 std::uint64_t MyConsumerModule::Get_my_data_element2() {
   std::uint64_t return_value{};
-  const std::lock_guard<std::mutex> lock(cached_test_my_data_element2_mutex_);
-  if (cached_test_my_data_element2_) {
-    return_value = *cached_test_my_data_element2_;
+  const ::vaf::ConstDataPtr<const std::uint64_t> sample{channel_test_my_data_element2_.Load()};
+  if (sample) {
+    return_value = *sample;
   }
   return return_value;
 }
 
 void MyConsumerModule::RegisterDataElementHandler_my_data_element2(vaf::String owner, std::function<void(const ::vaf::ConstDataPtr<const std::uint64_t>)>&& f) {
-  registered_test_my_data_element2_event_handlers_.emplace_back(owner, std::move(f));
-  if(std::find(active_modules_.begin(), active_modules_.end(), owner) != active_modules_.end()) {
-    registered_test_my_data_element2_event_handlers_.back().is_active_ = true;
+  channel_test_my_data_element2_.AddHandler(owner, std::move(f));
+}
+
+
+void MyConsumerModule::OnSample_test_my_data_element3(const std::uint8_t* data, std::size_t size) {
+  if (!started_.load(std::memory_order_acquire)) {
+    // Samples received while the module is stopped are dropped
+    return;
+  }
+  VAF_ALLOCATION_SCOPE("MyConsumerModule.my_data_element3 Receive");
+  if (!vaf::silkit::DecompressSample(data, size)) {
+    vaf::LoggerSingleton::getInstance()->default_logger_.LogWarn() << "MyConsumerModule: Dropped a malformed compressed sample of my_data_element3";
+    return;
+  }
+  std::unique_ptr< test::MyVector > ptr;
+  auto* deserialized = reception_arena_test_my_data_element3_.Create<protobuf::interface::test::MyInterface::my_data_element3>();
+  deserialized->ParseFromArray(data, static_cast<int>(size));
+  ptr = std::make_unique< test::MyVector >();
+  ::protobuf::interface::test::MyInterface::my_data_element3ProtoToVaf(std::move(*deserialized),*ptr);
+  reception_arena_test_my_data_element3_.Reset();
+  vaf::ConstDataPtr<const test::MyVector> sample{std::move(ptr)};
+  channel_test_my_data_element3_.Publish(std::move(sample), active_modules_);
+}
+
+::vaf::Result<::vaf::ConstDataPtr<const test::MyVector>> MyConsumerModule::GetAllocated_my_data_element3() {
+  ::vaf::Result<::vaf::ConstDataPtr<const test::MyVector>> result_value{
+      ::vaf::Error{::vaf::ErrorCode::kNotOk, "No sample available"}};
+  ::vaf::ConstDataPtr<const test::MyVector> sample{channel_test_my_data_element3_.Load()};
+  if (sample) {
+    result_value = ::vaf::Result<::vaf::ConstDataPtr<const test::MyVector>>{std::move(sample)};
+  }
+  return result_value;
+}
+
+test::MyVector MyConsumerModule::Get_my_data_element3() {
+  test::MyVector return_value{};
+  const ::vaf::ConstDataPtr<const test::MyVector> sample{channel_test_my_data_element3_.Load()};
+  if (sample) {
+    return_value = *sample;
   }
+  return return_value;
+}
+
+void MyConsumerModule::RegisterDataElementHandler_my_data_element3(vaf::String owner, std::function<void(const ::vaf::ConstDataPtr<const test::MyVector>)>&& f) {
+  channel_test_my_data_element3_.AddHandler(owner, std::move(f));
+}
+
+
+void MyConsumerModule::OnSample_test_my_data_element4(const std::uint8_t* data, std::size_t size) {
+  if (!started_.load(std::memory_order_acquire)) {
+    // Samples received while the module is stopped are dropped
+    return;
+  }
+  VAF_ALLOCATION_SCOPE("MyConsumerModule.my_data_element4 Receive");
+  if (!delta_decoder_test_my_data_element4_.Decode(data, size)) {
+    vaf::LoggerSingleton::getInstance()->default_logger_.LogWarn() << "MyConsumerModule: Dropped a sample of my_data_element4 without its keyframe";
+    return;
+  }
+  std::unique_ptr< test::MyState > ptr;
+  auto* deserialized = reception_arena_test_my_data_element4_.Create<protobuf::interface::test::MyInterface::my_data_element4>();
+  deserialized->ParseFromArray(data, static_cast<int>(size));
+  ptr = std::make_unique< test::MyState >();
+  ::protobuf::interface::test::MyInterface::my_data_element4ProtoToVaf(std::move(*deserialized),*ptr);
+  reception_arena_test_my_data_element4_.Reset();
+  vaf::ConstDataPtr<const test::MyState> sample{std::move(ptr)};
+  channel_test_my_data_element4_.Publish(std::move(sample), active_modules_);
+}
+
+::vaf::Result<::vaf::ConstDataPtr<const test::MyState>> MyConsumerModule::GetAllocated_my_data_element4() {
+  ::vaf::Result<::vaf::ConstDataPtr<const test::MyState>> result_value{
+      ::vaf::Error{::vaf::ErrorCode::kNotOk, "No sample available"}};
+  ::vaf::ConstDataPtr<const test::MyState> sample{channel_test_my_data_element4_.Load()};
+  if (sample) {
+    result_value = ::vaf::Result<::vaf::ConstDataPtr<const test::MyState>>{std::move(sample)};
+  }
+  return result_value;
+}
+
+test::MyState MyConsumerModule::Get_my_data_element4() {
+  test::MyState return_value{};
+  const ::vaf::ConstDataPtr<const test::MyState> sample{channel_test_my_data_element4_.Load()};
+  if (sample) {
+    return_value = *sample;
+  }
+  return return_value;
+}
+
+void MyConsumerModule::RegisterDataElementHandler_my_data_element4(vaf::String owner, std::function<void(const ::vaf::ConstDataPtr<const test::MyState>)>&& f) {
+  channel_test_my_data_element4_.AddHandler(owner, std::move(f));
 }
 
 
 
 ::vaf::Future<void> MyConsumerModule::MyVoidOperation(const std::uint64_t& in) {
   ::vaf::Future<void> return_value;
-  ::vaf::internal::Promise<void>* promise_pointer =
-                  new ::vaf::internal::Promise<void>();
-  return_value = ::vaf::internal::CreateVafFutureFromVafPromise<void>(*promise_pointer);
+  void* call_context = pending_calls_test_MyVoidOperation_.Begin(return_value);
+  if (call_context == nullptr) {
+    return return_value;
+  }
   protobuf::interface::test::MyInterface::MyVoidOperation_in request;
   protobuf::interface::test::MyInterface::MyVoidOperationInVafToProto(in, request);
-  size_t nbytes = request.ByteSizeLong();
-  std::vector<std::uint8_t> serialized(nbytes);
-  if (nbytes != 0u) {
-    request.SerializeToArray(serialized.data(), nbytes);
-  }
-  rpc_client_test_MyVoidOperation_->Call(serialized, promise_pointer);
+  const std::vector<std::uint8_t>& serialized = vaf::silkit::SerializeToBuffer(request);
+  VAF_TRACE_INSTANT("vaf.rpc", "MyVoidOperation call", "MyConsumerModule");
+  rpc_client_test_MyVoidOperation_->Call(serialized, call_context);
 
   return return_value;
 }
 ::vaf::Future<test::MyOperation::Output> MyConsumerModule::MyOperation(const std::uint64_t& in, const std::uint64_t& inout) {
   ::vaf::Future<test::MyOperation::Output> return_value;
-  ::vaf::internal::Promise<test::MyOperation::Output>* promise_pointer =
-                  new ::vaf::internal::Promise<test::MyOperation::Output>();
-  return_value = ::vaf::internal::CreateVafFutureFromVafPromise<test::MyOperation::Output>(*promise_pointer);
+  void* call_context = pending_calls_test_MyOperation_.Begin(return_value);
+  if (call_context == nullptr) {
+    return return_value;
+  }
   protobuf::interface::test::MyInterface::MyOperation_in request;
   protobuf::interface::test::MyInterface::MyOperationInVafToProto(in, inout, request);
-  size_t nbytes = request.ByteSizeLong();
-  std::vector<std::uint8_t> serialized(nbytes);
-  if (nbytes != 0u) {
-    request.SerializeToArray(serialized.data(), nbytes);
-  }
-  rpc_client_test_MyOperation_->Call(serialized, promise_pointer);
+  const std::vector<std::uint8_t>& serialized = vaf::silkit::SerializeToBuffer(request);
+  VAF_TRACE_INSTANT("vaf.rpc", "MyOperation call", "MyConsumerModule");
+  rpc_client_test_MyOperation_->Call(serialized, call_context);
 
   return return_value;
 }
 ::vaf::Future<test::MyGetter::Output> MyConsumerModule::MyGetter() {
+  // The field is answered from its latest notification, the provider is only called until the first one
+  if (channel_test_my_data_element1_.HasPublished()) {
+    ::vaf::internal::Promise<test::MyGetter::Output> cached;
+    cached.set_value(test::MyGetter::Output{*channel_test_my_data_element1_.Load()});
+    return ::vaf::internal::CreateVafFutureFromVafPromise<test::MyGetter::Output>(cached);
+  }
   ::vaf::Future<test::MyGetter::Output> return_value;
-  ::vaf::internal::Promise<test::MyGetter::Output>* promise_pointer =
-                  new ::vaf::internal::Promise<test::MyGetter::Output>();
-  return_value = ::vaf::internal::CreateVafFutureFromVafPromise<test::MyGetter::Output>(*promise_pointer);
-  protobuf::interface::test::MyInterface::MyGetter_in request;
-  size_t nbytes = request.ByteSizeLong();
-  std::vector<std::uint8_t> serialized(nbytes);
-  if (nbytes != 0u) {
-    request.SerializeToArray(serialized.data(), nbytes);
+  void* call_context = pending_calls_test_MyGetter_.Begin(return_value);
+  if (call_context == nullptr) {
+    return return_value;
   }
-  rpc_client_test_MyGetter_->Call(serialized, promise_pointer);
+  protobuf::interface::test::MyInterface::MyGetter_in request;
+  const std::vector<std::uint8_t>& serialized = vaf::silkit::SerializeToBuffer(request);
+  VAF_TRACE_INSTANT("vaf.rpc", "MyGetter call", "MyConsumerModule");
+  rpc_client_test_MyGetter_->Call(serialized, call_context);
 
   return return_value;
 }
 ::vaf::Future<void> MyConsumerModule::MySetter(const std::uint64_t& a) {
   ::vaf::Future<void> return_value;
-  ::vaf::internal::Promise<void>* promise_pointer =
-                  new ::vaf::internal::Promise<void>();
-  return_value = ::vaf::internal::CreateVafFutureFromVafPromise<void>(*promise_pointer);
+  void* call_context = pending_calls_test_MySetter_.Begin(return_value);
+  if (call_context == nullptr) {
+    return return_value;
+  }
   protobuf::interface::test::MyInterface::MySetter_in request;
   protobuf::interface::test::MyInterface::MySetterInVafToProto(a, request);
-  size_t nbytes = request.ByteSizeLong();
-  std::vector<std::uint8_t> serialized(nbytes);
-  if (nbytes != 0u) {
-    request.SerializeToArray(serialized.data(), nbytes);
-  }
-  rpc_client_test_MySetter_->Call(serialized, promise_pointer);
+  const std::vector<std::uint8_t>& serialized = vaf::silkit::SerializeToBuffer(request);
+  VAF_TRACE_INSTANT("vaf.rpc", "MySetter call", "MyConsumerModule");
+  rpc_client_test_MySetter_->Call(serialized, call_context);
 
   return return_value;
 }
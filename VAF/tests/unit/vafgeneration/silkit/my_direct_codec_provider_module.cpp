@@ -0,0 +1,319 @@
+/*!********************************************************************************************************************
+ *  COPYRIGHT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  Copyright (c) 2024-2026 by Vector Informatik GmbH. All rights reserved.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -----------------------------------------------------------------------------------------------------------------*/
+/*!        \file  my_direct_codec_provider_module.cpp
+ *         \brief
+ *
+ *********************************************************************************************************************/
+
+#include "test/my_direct_codec_provider_module.h"
+
+#include <google/protobuf/serial_arena.h>
+#include <memory>
+
+#include "vaf/internal/data_ptr_helper.h"
+#include "vaf/result.h"
+#include "vaf/controller_interface.h"
+#include "vaf/error_domain.h"
+#include "vaf/logging.h"
+#include "vaf/allocation_tracking.h"
+#include "vaf/silkit/flat_wire_format.h"
+#include "vaf/silkit/participant.h"
+#include "vaf/silkit/sample_batch.h"
+#include "vaf/silkit/sample_compression.h"
+#include "vaf/silkit/serialization_buffer.h"
+#include "vaf/trace.h"
+#include "protobuf/interface/test/myinterface/protobuf_transformer.h"
+#include "protobuf/interface/test/myinterface/protobuf_codec.h"
+
+#include "silkit/SilKit.hpp"
+#include "silkit/services/all.hpp"
+#include "silkit/services/orchestration/string_utils.hpp"
+#include "silkit/util/serdes/Serialization.hpp"
+#include "protobuf_interface_test_MyInterface.pb.h"
+
+namespace test {
+
+MyDirectCodecProviderModule::MyDirectCodecProviderModule(vaf::Executor& executor, vaf::String name, vaf::ExecutableControllerInterface& executable_controller_interface)
+  	: vaf::ControlInterface(std::move(name), {}, executable_controller_interface, executor) {
+  // Publishes the latest sample held back by the maximum publish rate
+  executor_.RunPeriodic("PublishThrottle_my_data_element2", std::chrono::microseconds{ 20000 }, [this]() {
+    publish_throttle_test_my_data_element2_.Flush([this](const std::vector<std::uint8_t>& sample) { publisher_test_my_data_element2_->Publish(sample); });
+  });
+}
+
+vaf::Result<void> MyDirectCodecProviderModule::Init() noexcept {
+  return vaf::Result<void>{};
+}
+
+void MyDirectCodecProviderModule::Start() noexcept {
+  // SIL Kit cannot remove controllers again, so a restart only reactivates the ones of the first start
+  if (!controllers_created_) {
+    CreateControllers();
+    controllers_created_ = true;
+  }
+  started_.store(true, std::memory_order_release);
+  ReportOperational();
+}
+
+void MyDirectCodecProviderModule::Stop() noexcept {
+  started_.store(false, std::memory_order_release);
+}
+
+void MyDirectCodecProviderModule::CreateControllers() {
+  // All SIL Kit modules of the executable share one participant
+  SilKit::IParticipant& participant = vaf::silkit::GetParticipant();
+
+  SilKit::Services::PubSub::PubSubSpec pubsubspec_test_my_data_element1{"MyInterface_my_data_element1", vaf::silkit::kFlatMediaType};
+  pubsubspec_test_my_data_element1.AddLabel("Instance", "MyInterface", SilKit::Services::MatchingLabel::Kind::Mandatory);
+  publisher_test_my_data_element1_= participant.CreateDataPublisher("MyDirectCodecProviderModule_Publisher_test_my_data_element1", pubsubspec_test_my_data_element1);
+
+  SilKit::Services::PubSub::PubSubSpec pubsubspec_test_my_data_element2{"MyInterface_my_data_element2", vaf::silkit::kFlatMediaType};
+  pubsubspec_test_my_data_element2.AddLabel("Instance", "MyInterface", SilKit::Services::MatchingLabel::Kind::Mandatory);
+  publisher_test_my_data_element2_= participant.CreateDataPublisher("MyDirectCodecProviderModule_Publisher_test_my_data_element2", pubsubspec_test_my_data_element2);
+
+  SilKit::Services::PubSub::PubSubSpec pubsubspec_test_my_data_element3{"MyInterface_my_data_element3", vaf::silkit::CompressedMediaType("application/protobuf", vaf::silkit::Compression::kLz4)};
+  pubsubspec_test_my_data_element3.AddLabel("Instance", "MyInterface", SilKit::Services::MatchingLabel::Kind::Mandatory);
+  publisher_test_my_data_element3_= participant.CreateDataPublisher("MyDirectCodecProviderModule_Publisher_test_my_data_element3", pubsubspec_test_my_data_element3);
+
+  SilKit::Services::PubSub::PubSubSpec pubsubspec_test_my_data_element4{"MyInterface_my_data_element4", vaf::silkit::DeltaMediaType("application/protobuf")};
+  pubsubspec_test_my_data_element4.AddLabel("Instance", "MyInterface", SilKit::Services::MatchingLabel::Kind::Mandatory);
+  publisher_test_my_data_element4_= participant.CreateDataPublisher("MyDirectCodecProviderModule_Publisher_test_my_data_element4", pubsubspec_test_my_data_element4);
+
+
+  SilKit::Services::Rpc::RpcSpec rpcspec_test_MyVoidOperation{"MyInterface_MyVoidOperation", "application/protobuf"};
+  rpcspec_test_MyVoidOperation.AddLabel("Instance", "MyInterface", SilKit::Services::MatchingLabel::Kind::Mandatory);
+  auto RemoteFunc_test_MyVoidOperation = [this](auto* server, const auto& event) {
+    if (!started_.load(std::memory_order_acquire)) {
+      // Without a result, the call fails on the consumer side once it times out
+      return;
+    }
+    VAF_TRACE_SCOPE("vaf.rpc", "MyVoidOperation", "MyDirectCodecProviderModule");
+    std::uint64_t in{};
+    if (!protobuf::interface::test::MyInterface::MyVoidOperationInWireParse(event.argumentData.data(), event.argumentData.size(), in)) {
+      // Without a result, the call fails on the consumer side once it times out
+      vaf::LoggerSingleton::getInstance()->default_logger_.LogWarn() << "MyDirectCodecProviderModule: Dropped a malformed call of MyVoidOperation";
+      return;
+    }
+    if (CbkFunction_test_MyVoidOperation_) {
+      CbkFunction_test_MyVoidOperation_(in);
+    }
+    const std::vector<std::uint8_t> serialized{};
+    server->SubmitResult(event.callHandle, serialized);
+  };
+  server_test_MyVoidOperation_= participant.CreateRpcServer("MyDirectCodecProviderModule_test_MyVoidOperation", rpcspec_test_MyVoidOperation, RemoteFunc_test_MyVoidOperation);
+
+  SilKit::Services::Rpc::RpcSpec rpcspec_test_MyOperation{"MyInterface_MyOperation", "application/protobuf"};
+  rpcspec_test_MyOperation.AddLabel("Instance", "MyInterface", SilKit::Services::MatchingLabel::Kind::Mandatory);
+  auto RemoteFunc_test_MyOperation = [this](auto* server, const auto& event) {
+    if (!started_.load(std::memory_order_acquire)) {
+      // Without a result, the call fails on the consumer side once it times out
+      return;
+    }
+    VAF_TRACE_SCOPE("vaf.rpc", "MyOperation", "MyDirectCodecProviderModule");
+    std::uint64_t in{};
+    std::uint64_t inout{};
+    if (!protobuf::interface::test::MyInterface::MyOperationInWireParse(event.argumentData.data(), event.argumentData.size(), in, inout)) {
+      // Without a result, the call fails on the consumer side once it times out
+      vaf::LoggerSingleton::getInstance()->default_logger_.LogWarn() << "MyDirectCodecProviderModule: Dropped a malformed call of MyOperation";
+      return;
+    }
+    // The handler runs in a worker thread of the operation, the reply is submitted from there
+    const bool queued{worker_pool_test_MyOperation_.TryPost([this, server, call_handle = event.callHandle, in = std::move(in), inout = std::move(inout)]() {
+      VAF_TRACE_SCOPE("vaf.rpc", "MyOperation handler", "MyDirectCodecProviderModule");
+      test::MyOperation::Output result;
+      if (CbkFunction_test_MyOperation_) {
+        result = CbkFunction_test_MyOperation_(in, inout);
+      }
+      const std::vector<std::uint8_t>& serialized = vaf::silkit::SerializeToBuffer(
+          protobuf::interface::test::MyInterface::MyOperationOutWireSize(result),
+          [&result](std::uint8_t* buffer, std::size_t size) {
+            protobuf::interface::test::MyInterface::MyOperationOutWireSerialize(result, buffer, size);
+          });
+      server->SubmitResult(call_handle, serialized);
+    })};
+    if (!queued) {
+      // Without a result, the call fails on the consumer side once it times out
+      vaf::LoggerSingleton::getInstance()->default_logger_.LogWarn() << "MyDirectCodecProviderModule: Dropped a call of MyOperation, the handler queue is full";
+    }
+  };
+  server_test_MyOperation_= participant.CreateRpcServer("MyDirectCodecProviderModule_test_MyOperation", rpcspec_test_MyOperation, RemoteFunc_test_MyOperation);
+
+  SilKit::Services::Rpc::RpcSpec rpcspec_test_MyGetter{"MyInterface_MyGetter", "application/protobuf"};
+  rpcspec_test_MyGetter.AddLabel("Instance", "MyInterface", SilKit::Services::MatchingLabel::Kind::Mandatory);
+  auto RemoteFunc_test_MyGetter = [this](auto* server, const auto& event) {
+    if (!started_.load(std::memory_order_acquire)) {
+      // Without a result, the call fails on the consumer side once it times out
+      return;
+    }
+    VAF_TRACE_SCOPE("vaf.rpc", "MyGetter", "MyDirectCodecProviderModule");
+    test::MyGetter::Output result;
+    if (CbkFunction_test_MyGetter_) {
+      result = CbkFunction_test_MyGetter_();
+    }
+    const std::vector<std::uint8_t>& serialized = vaf::silkit::SerializeToBuffer(
+        protobuf::interface::test::MyInterface::MyGetterOutWireSize(result),
+        [&result](std::uint8_t* buffer, std::size_t size) {
+          protobuf::interface::test::MyInterface::MyGetterOutWireSerialize(result, buffer, size);
+        });
+    server->SubmitResult(event.callHandle, serialized);
+  };
+  server_test_MyGetter_= participant.CreateRpcServer("MyDirectCodecProviderModule_test_MyGetter", rpcspec_test_MyGetter, RemoteFunc_test_MyGetter);
+
+  SilKit::Services::Rpc::RpcSpec rpcspec_test_MySetter{"MyInterface_MySetter", "application/protobuf"};
+  rpcspec_test_MySetter.AddLabel("Instance", "MyInterface", SilKit::Services::MatchingLabel::Kind::Mandatory);
+  auto RemoteFunc_test_MySetter = [this](auto* server, const auto& event) {
+    if (!started_.load(std::memory_order_acquire)) {
+      // Without a result, the call fails on the consumer side once it times out
+      return;
+    }
+    VAF_TRACE_SCOPE("vaf.rpc", "MySetter", "MyDirectCodecProviderModule");
+    std::uint64_t a{};
+    if (!protobuf::interface::test::MyInterface::MySetterInWireParse(event.argumentData.data(), event.argumentData.size(), a)) {
+      // Without a result, the call fails on the consumer side once it times out
+      vaf::LoggerSingleton::getInstance()->default_logger_.LogWarn() << "MyDirectCodecProviderModule: Dropped a malformed call of MySetter";
+      return;
+    }
+    if (!call_limit_test_MySetter_.TryAcquire()) {
+      // Without a result, the call fails on the consumer side once it times out
+      vaf::LoggerSingleton::getInstance()->default_logger_.LogWarn() << "MyDirectCodecProviderModule: Dropped a call of MySetter, the handler queue is full";
+      return;
+    }
+    // The handler runs in the executor of the module, the reply is submitted from there
+    executor_.Post([this, server, call_handle = event.callHandle, a = std::move(a)]() {
+      VAF_TRACE_SCOPE("vaf.rpc", "MySetter handler", "MyDirectCodecProviderModule");
+      if (CbkFunction_test_MySetter_) {
+        CbkFunction_test_MySetter_(a);
+      }
+      const std::vector<std::uint8_t> serialized{};
+      server->SubmitResult(call_handle, serialized);
+      call_limit_test_MySetter_.Release();
+    });
+  };
+  server_test_MySetter_= participant.CreateRpcServer("MyDirectCodecProviderModule_test_MySetter", rpcspec_test_MySetter, RemoteFunc_test_MySetter);
+
+}
+
+void MyDirectCodecProviderModule::DeInit() noexcept {
+}
+
+::vaf::Result<::vaf::DataPtr<std::uint64_t>> MyDirectCodecProviderModule::Allocate_my_data_element1() {
+  VAF_ALLOCATION_SCOPE("MyDirectCodecProviderModule.my_data_element1 Allocate");
+  return ::vaf::Result<vaf::DataPtr< std::uint64_t >>::FromValue(vaf::MakeDataPtr< std::uint64_t >());
+}
+
+::vaf::Result<void> MyDirectCodecProviderModule::SetAllocated_my_data_element1(::vaf::DataPtr<std::uint64_t>&& data) {
+  VAF_ALLOCATION_SCOPE("MyDirectCodecProviderModule.my_data_element1 Set");
+  metric_published_test_my_data_element1_.Increment();
+  publisher_test_my_data_element1_->Publish(vaf::silkit::SerializeFlat(*data));
+
+  return ::vaf::Result<void>{};
+}
+
+::vaf::Result<void> MyDirectCodecProviderModule::Set_my_data_element1(const std::uint64_t& data) {
+  VAF_ALLOCATION_SCOPE("MyDirectCodecProviderModule.my_data_element1 Set");
+  metric_published_test_my_data_element1_.Increment();
+  publisher_test_my_data_element1_->Publish(vaf::silkit::SerializeFlat(data));
+
+  return ::vaf::Result<void>{};
+}
+::vaf::Result<::vaf::DataPtr<std::uint64_t>> MyDirectCodecProviderModule::Allocate_my_data_element2() {
+  VAF_ALLOCATION_SCOPE("MyDirectCodecProviderModule.my_data_element2 Allocate");
+  return ::vaf::Result<vaf::DataPtr< std::uint64_t >>::FromValue(vaf::MakeDataPtr< std::uint64_t >());
+}
+
+::vaf::Result<void> MyDirectCodecProviderModule::SetAllocated_my_data_element2(::vaf::DataPtr<std::uint64_t>&& data) {
+  VAF_ALLOCATION_SCOPE("MyDirectCodecProviderModule.my_data_element2 Set");
+  metric_published_test_my_data_element2_.Increment();
+  publish_throttle_test_my_data_element2_.Offer(vaf::silkit::SerializeFlat(*data), [this](const std::vector<std::uint8_t>& sample) { publisher_test_my_data_element2_->Publish(sample); });
+
+  return ::vaf::Result<void>{};
+}
+
+::vaf::Result<void> MyDirectCodecProviderModule::Set_my_data_element2(const std::uint64_t& data) {
+  VAF_ALLOCATION_SCOPE("MyDirectCodecProviderModule.my_data_element2 Set");
+  metric_published_test_my_data_element2_.Increment();
+  publish_throttle_test_my_data_element2_.Offer(vaf::silkit::SerializeFlat(data), [this](const std::vector<std::uint8_t>& sample) { publisher_test_my_data_element2_->Publish(sample); });
+
+  return ::vaf::Result<void>{};
+}
+::vaf::Result<::vaf::DataPtr<test::MyVector>> MyDirectCodecProviderModule::Allocate_my_data_element3() {
+  VAF_ALLOCATION_SCOPE("MyDirectCodecProviderModule.my_data_element3 Allocate");
+  return ::vaf::Result<vaf::DataPtr< test::MyVector >>::FromValue(vaf::MakeDataPtr< test::MyVector >());
+}
+
+::vaf::Result<void> MyDirectCodecProviderModule::SetAllocated_my_data_element3(::vaf::DataPtr<test::MyVector>&& data) {
+  VAF_ALLOCATION_SCOPE("MyDirectCodecProviderModule.my_data_element3 Set");
+  const test::MyVector& value{*vaf::internal::DataPtrHelper<test::MyVector>::getRawPtr(data)};
+  const std::vector<std::uint8_t>& serialized = vaf::silkit::SerializeToBuffer(
+      protobuf::interface::test::MyInterface::my_data_element3WireSize(value),
+      [&value](std::uint8_t* buffer, std::size_t size) { protobuf::interface::test::MyInterface::my_data_element3WireSerialize(value, buffer, size); });
+  metric_published_test_my_data_element3_.Increment();
+  publish_throttle_test_my_data_element3_.Offer(serialized, [this](const std::vector<std::uint8_t>& sample) { publisher_test_my_data_element3_->Publish(vaf::silkit::CompressSample(sample, vaf::silkit::Compression::kLz4, 256U)); });
+
+  return ::vaf::Result<void>{};
+}
+
+::vaf::Result<void> MyDirectCodecProviderModule::Set_my_data_element3(const test::MyVector& data) {
+  VAF_ALLOCATION_SCOPE("MyDirectCodecProviderModule.my_data_element3 Set");
+  const std::vector<std::uint8_t>& serialized = vaf::silkit::SerializeToBuffer(
+      protobuf::interface::test::MyInterface::my_data_element3WireSize(data),
+      [&data](std::uint8_t* buffer, std::size_t size) { protobuf::interface::test::MyInterface::my_data_element3WireSerialize(data, buffer, size); });
+  metric_published_test_my_data_element3_.Increment();
+  publish_throttle_test_my_data_element3_.Offer(serialized, [this](const std::vector<std::uint8_t>& sample) { publisher_test_my_data_element3_->Publish(vaf::silkit::CompressSample(sample, vaf::silkit::Compression::kLz4, 256U)); });
+
+  return ::vaf::Result<void>{};
+}
+::vaf::Result<::vaf::DataPtr<test::MyState>> MyDirectCodecProviderModule::Allocate_my_data_element4() {
+  VAF_ALLOCATION_SCOPE("MyDirectCodecProviderModule.my_data_element4 Allocate");
+  return ::vaf::Result<vaf::DataPtr< test::MyState >>::FromValue(vaf::MakeDataPtr< test::MyState >());
+}
+
+::vaf::Result<void> MyDirectCodecProviderModule::SetAllocated_my_data_element4(::vaf::DataPtr<test::MyState>&& data) {
+  VAF_ALLOCATION_SCOPE("MyDirectCodecProviderModule.my_data_element4 Set");
+  const test::MyState& value{*vaf::internal::DataPtrHelper<test::MyState>::getRawPtr(data)};
+  const std::vector<std::uint8_t>& serialized = vaf::silkit::SerializeToBuffer(
+      protobuf::interface::test::MyInterface::my_data_element4WireSize(value),
+      [&value](std::uint8_t* buffer, std::size_t size) { protobuf::interface::test::MyInterface::my_data_element4WireSerialize(value, buffer, size); });
+  metric_published_test_my_data_element4_.Increment();
+  delta_encoder_test_my_data_element4_.Encode(serialized, [this](const std::vector<std::uint8_t>& delta) { publisher_test_my_data_element4_->Publish(delta); });
+
+  return ::vaf::Result<void>{};
+}
+
+::vaf::Result<void> MyDirectCodecProviderModule::Set_my_data_element4(const test::MyState& data) {
+  VAF_ALLOCATION_SCOPE("MyDirectCodecProviderModule.my_data_element4 Set");
+  const std::vector<std::uint8_t>& serialized = vaf::silkit::SerializeToBuffer(
+      protobuf::interface::test::MyInterface::my_data_element4WireSize(data),
+      [&data](std::uint8_t* buffer, std::size_t size) { protobuf::interface::test::MyInterface::my_data_element4WireSerialize(data, buffer, size); });
+  metric_published_test_my_data_element4_.Increment();
+  delta_encoder_test_my_data_element4_.Encode(serialized, [this](const std::vector<std::uint8_t>& delta) { publisher_test_my_data_element4_->Publish(delta); });
+
+  return ::vaf::Result<void>{};
+}
+
+void MyDirectCodecProviderModule::RegisterOperationHandler_MyVoidOperation(std::function<void(const std::uint64_t&)>&& f) {
+  CbkFunction_test_MyVoidOperation_ = std::move(f);
+}
+
+void MyDirectCodecProviderModule::RegisterOperationHandler_MyOperation(std::function<test::MyOperation::Output(const std::uint64_t&, const std::uint64_t&)>&& f) {
+  CbkFunction_test_MyOperation_ = std::move(f);
+}
+
+void MyDirectCodecProviderModule::RegisterOperationHandler_MyGetter(std::function<test::MyGetter::Output()>&& f) {
+  CbkFunction_test_MyGetter_ = std::move(f);
+}
+
+void MyDirectCodecProviderModule::RegisterOperationHandler_MySetter(std::function<void(const std::uint64_t&)>&& f) {
+  CbkFunction_test_MySetter_ = std::move(f);
+}
+
+
+} // namespace test
@@ -0,0 +1,550 @@
+/*!********************************************************************************************************************
+ *  COPYRIGHT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  Copyright (c) 2024-2026 by Vector Informatik GmbH. All rights reserved.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -----------------------------------------------------------------------------------------------------------------*/
+/*!        \file  my_lazy_consumer_module.cpp
+ *         \brief
+ *
+ *********************************************************************************************************************/
+
+#include "test/my_lazy_consumer_module.h"
+
+#include <chrono>
+#include <google/protobuf/serial_arena.h>
+
+#include "vaf/allocation_tracking.h"
+#include "vaf/error_domain.h"
+#include "vaf/logging.h"
+#include "vaf/silkit/flat_wire_format.h"
+#include "vaf/silkit/participant.h"
+#include "vaf/silkit/sample_batch.h"
+#include "vaf/silkit/sample_compression.h"
+#include "vaf/silkit/serialization_buffer.h"
+#include "vaf/future.h"
+#include "vaf/trace.h"
+#include "protobuf/interface/test/myinterface/protobuf_transformer.h"
+
+#include "silkit/SilKit.hpp"
+#include "silkit/services/all.hpp"
+#include "silkit/services/orchestration/string_utils.hpp"
+#include "silkit/util/serdes/Serialization.hpp"
+#include "protobuf_interface_test_MyInterface.pb.h"
+
+namespace test {
+
+MyLazyConsumerModule::MyLazyConsumerModule(::vaf::Executor& executor, vaf::String name, ::vaf::ExecutableControllerInterface& executable_controller_interface)
+  : ::vaf::ControlInterface(std::move(name), {}, executable_controller_interface, executor),
+    executor_{ControlInterface::executor_} {
+  executor_.RunPeriodic("RpcTimeouts", vaf::silkit::RpcTimeoutSweepPeriod(std::chrono::milliseconds{ 100 }, executor_.RunningPeriod()), [this]() {
+    pending_calls_test_MyVoidOperation_.ExpireTimedOut();
+    pending_calls_test_MyOperation_.ExpireTimedOut();
+    pending_calls_test_MyGetter_.ExpireTimedOut();
+    pending_calls_test_MySetter_.ExpireTimedOut();
+  });
+}
+
+::vaf::Result<void> MyLazyConsumerModule::Init() noexcept {
+  return ::vaf::Result<void>{};
+}
+
+void MyLazyConsumerModule::Start() noexcept {
+  // SIL Kit cannot remove controllers again, so a restart only reactivates the ones of the first start
+  if (!controllers_created_) {
+    CreateControllers();
+    controllers_created_ = true;
+  }
+  started_.store(true, std::memory_order_release);
+  ReportOperational();
+}
+
+void MyLazyConsumerModule::Stop() noexcept {
+  started_.store(false, std::memory_order_release);
+  pending_calls_test_MyVoidOperation_.CancelAll();
+  pending_calls_test_MyOperation_.CancelAll();
+  pending_calls_test_MyGetter_.CancelAll();
+  pending_calls_test_MySetter_.CancelAll();
+}
+
+void MyLazyConsumerModule::CreateControllers() {
+  // All SIL Kit modules of the executable share one participant
+  SilKit::IParticipant& participant = vaf::silkit::GetParticipant();
+
+  SilKit::Services::PubSub::PubSubSpec pubsubspec_test_my_data_element1{"MyInterface_my_data_element1", vaf::silkit::kFlatMediaType};
+  pubsubspec_test_my_data_element1.AddLabel("Instance", "MyInterface", SilKit::Services::MatchingLabel::Kind::Mandatory);
+  auto receptionHandler_test_my_data_element1 = [this](auto* /*subscriber*/, const auto& dataMessageEvent) {
+    OnSample_test_my_data_element1(dataMessageEvent.data.data(), dataMessageEvent.data.size());
+  };
+  subscriber_test_my_data_element1_= participant.CreateDataSubscriber("MyLazyConsumerModule_Subscriber_test_my_data_element1", pubsubspec_test_my_data_element1, receptionHandler_test_my_data_element1);
+
+  SilKit::Services::PubSub::PubSubSpec pubsubspec_test_my_data_element2{"MyInterface_my_data_element2", vaf::silkit::kFlatMediaType};
+  pubsubspec_test_my_data_element2.AddLabel("Instance", "MyInterface", SilKit::Services::MatchingLabel::Kind::Mandatory);
+  auto receptionHandler_test_my_data_element2 = [this](auto* /*subscriber*/, const auto& dataMessageEvent) {
+    OnSample_test_my_data_element2(dataMessageEvent.data.data(), dataMessageEvent.data.size());
+  };
+  subscriber_test_my_data_element2_= participant.CreateDataSubscriber("MyLazyConsumerModule_Subscriber_test_my_data_element2", pubsubspec_test_my_data_element2, receptionHandler_test_my_data_element2);
+
+  SilKit::Services::PubSub::PubSubSpec pubsubspec_test_my_data_element3{"MyInterface_my_data_element3", vaf::silkit::CompressedMediaType("application/protobuf", vaf::silkit::Compression::kLz4)};
+  pubsubspec_test_my_data_element3.AddLabel("Instance", "MyInterface", SilKit::Services::MatchingLabel::Kind::Mandatory);
+  auto receptionHandler_test_my_data_element3 = [this](auto* /*subscriber*/, const auto& dataMessageEvent) {
+    OnSample_test_my_data_element3(dataMessageEvent.data.data(), dataMessageEvent.data.size());
+  };
+  subscriber_test_my_data_element3_= participant.CreateDataSubscriber("MyLazyConsumerModule_Subscriber_test_my_data_element3", pubsubspec_test_my_data_element3, receptionHandler_test_my_data_element3);
+
+  SilKit::Services::PubSub::PubSubSpec pubsubspec_test_my_data_element4{"MyInterface_my_data_element4", vaf::silkit::DeltaMediaType("application/protobuf")};
+  pubsubspec_test_my_data_element4.AddLabel("Instance", "MyInterface", SilKit::Services::MatchingLabel::Kind::Mandatory);
+  auto receptionHandler_test_my_data_element4 = [this](auto* /*subscriber*/, const auto& dataMessageEvent) {
+    OnSample_test_my_data_element4(dataMessageEvent.data.data(), dataMessageEvent.data.size());
+  };
+  subscriber_test_my_data_element4_= participant.CreateDataSubscriber("MyLazyConsumerModule_Subscriber_test_my_data_element4", pubsubspec_test_my_data_element4, receptionHandler_test_my_data_element4);
+
+
+  SilKit::Services::Rpc::RpcSpec rpcspec_test_MyVoidOperation{"MyInterface_MyVoidOperation", "application/protobuf"};
+  rpcspec_test_MyVoidOperation.AddLabel("Instance", "MyInterface", SilKit::Services::MatchingLabel::Kind::Mandatory);
+  auto ReturnFunc_test_MyVoidOperation = [this](auto* /*client*/, const auto& event) {
+    VAF_TRACE_INSTANT("vaf.rpc", "MyVoidOperation result", "MyLazyConsumerModule");
+    auto promise = pending_calls_test_MyVoidOperation_.Complete(event.userContext);
+    if (!promise) {
+      // The call already timed out or was cancelled
+      return;
+    }
+    if (event.callStatus == SilKit::Services::Rpc::RpcCallStatus::Success) {
+      promise->set_value();
+    } else {
+      vaf::Error error_code{::vaf::ErrorCode::kNotOk, "Rpc call failed"};
+      vaf::internal::SetVafErrorCodeToPromise(*promise, error_code);
+    }
+  };
+  rpc_client_test_MyVoidOperation_= participant.CreateRpcClient("MyLazyConsumerModule_test_MyVoidOperation", rpcspec_test_MyVoidOperation, ReturnFunc_test_MyVoidOperation);
+
+  SilKit::Services::Rpc::RpcSpec rpcspec_test_MyOperation{"MyInterface_MyOperation", "application/protobuf"};
+  rpcspec_test_MyOperation.AddLabel("Instance", "MyInterface", SilKit::Services::MatchingLabel::Kind::Mandatory);
+  auto ReturnFunc_test_MyOperation = [this](auto* /*client*/, const auto& event) {
+    VAF_TRACE_INSTANT("vaf.rpc", "MyOperation result", "MyLazyConsumerModule");
+    auto promise = pending_calls_test_MyOperation_.Complete(event.userContext);
+    if (!promise) {
+      // The call already timed out or was cancelled
+      return;
+    }
+    if (event.callStatus == SilKit::Services::Rpc::RpcCallStatus::Success) {
+      test::MyOperation::Output output;
+      protobuf::interface::test::MyInterface::MyOperation_out deserialized;
+      deserialized.ParseFromArray( event.resultData.data(), event.resultData.size() );
+      ::protobuf::interface::test::MyInterface::MyOperationOutProtoToVaf(std::move(deserialized), output);
+      promise->set_value(std::move(output));
+    } else {
+      vaf::Error error_code{::vaf::ErrorCode::kNotOk, "Rpc call failed"};
+      vaf::internal::SetVafErrorCodeToPromise(*promise, error_code);
+    }
+  };
+  rpc_client_test_MyOperation_= participant.CreateRpcClient("MyLazyConsumerModule_test_MyOperation", rpcspec_test_MyOperation, ReturnFunc_test_MyOperation);
+
+  SilKit::Services::Rpc::RpcSpec rpcspec_test_MyGetter{"MyInterface_MyGetter", "application/protobuf"};
+  rpcspec_test_MyGetter.AddLabel("Instance", "MyInterface", SilKit::Services::MatchingLabel::Kind::Mandatory);
+  auto ReturnFunc_test_MyGetter = [this](auto* /*client*/, const auto& event) {
+    VAF_TRACE_INSTANT("vaf.rpc", "MyGetter result", "MyLazyConsumerModule");
+    auto promise = pending_calls_test_MyGetter_.Complete(event.userContext);
+    if (!promise) {
+      // The call already timed out or was cancelled
+      return;
+    }
+    if (event.callStatus == SilKit::Services::Rpc::RpcCallStatus::Success) {
+      test::MyGetter::Output output;
+      protobuf::interface::test::MyInterface::MyGetter_out deserialized;
+      deserialized.ParseFromArray( event.resultData.data(), event.resultData.size() );
+      ::protobuf::interface::test::MyInterface::MyGetterOutProtoToVaf(std::move(deserialized), output);
+      promise->set_value(std::move(output));
+    } else {
+      vaf::Error error_code{::vaf::ErrorCode::kNotOk, "Rpc call failed"};
+      vaf::internal::SetVafErrorCodeToPromise(*promise, error_code);
+    }
+  };
+  rpc_client_test_MyGetter_= participant.CreateRpcClient("MyLazyConsumerModule_test_MyGetter", rpcspec_test_MyGetter, ReturnFunc_test_MyGetter);
+
+  SilKit::Services::Rpc::RpcSpec rpcspec_test_MySetter{"MyInterface_MySetter", "application/protobuf"};
+  rpcspec_test_MySetter.AddLabel("Instance", "MyInterface", SilKit::Services::MatchingLabel::Kind::Mandatory);
+  auto ReturnFunc_test_MySetter = [this](auto* /*client*/, const auto& event) {
+    VAF_TRACE_INSTANT("vaf.rpc", "MySetter result", "MyLazyConsumerModule");
+    auto promise = pending_calls_test_MySetter_.Complete(event.userContext);
+    if (!promise) {
+      // The call already timed out or was cancelled
+      return;
+    }
+    if (event.callStatus == SilKit::Services::Rpc::RpcCallStatus::Success) {
+      promise->set_value();
+    } else {
+      vaf::Error error_code{::vaf::ErrorCode::kNotOk, "Rpc call failed"};
+      vaf::internal::SetVafErrorCodeToPromise(*promise, error_code);
+    }
+  };
+  rpc_client_test_MySetter_= participant.CreateRpcClient("MyLazyConsumerModule_test_MySetter", rpcspec_test_MySetter, ReturnFunc_test_MySetter);
+
+}
+
+void MyLazyConsumerModule::DeInit() noexcept {
+}
+
+void MyLazyConsumerModule::StartEventHandlerForModule(vaf::ModuleId module) {
+  active_modules_.Insert(module);
+}
+
+void MyLazyConsumerModule::StopEventHandlerForModule(vaf::ModuleId module) {
+  active_modules_.Erase(module);
+}
+
+vaf::Vector<vaf::MemoryUsage> MyLazyConsumerModule::GetMemoryUsage() const {
+  vaf::Vector<vaf::MemoryUsage> usage{};
+  usage.push_back(vaf::MemoryUsage{name_, "my_data_element1"});
+  channel_test_my_data_element1_.AddMemoryUsage(usage.back());
+  usage.push_back(vaf::MemoryUsage{name_, "my_data_element2"});
+  channel_test_my_data_element2_.AddMemoryUsage(usage.back());
+  usage.push_back(vaf::MemoryUsage{name_, "my_data_element3"});
+  channel_test_my_data_element3_.AddMemoryUsage(usage.back());
+  usage.push_back(vaf::MemoryUsage{name_, "my_data_element4"});
+  channel_test_my_data_element4_.AddMemoryUsage(usage.back());
+  return usage;
+}
+
+
+void MyLazyConsumerModule::OnSample_test_my_data_element1(const std::uint8_t* data, std::size_t size) {
+  if (!started_.load(std::memory_order_acquire)) {
+    // Samples received while the module is stopped are dropped
+    return;
+  }
+  VAF_ALLOCATION_SCOPE("MyLazyConsumerModule.my_data_element1 Receive");
+  if (!channel_test_my_data_element1_.HasActiveHandlers(active_modules_)) {
+    // Deserialized by the first read of the data element, unless a newer sample replaces it before
+    lazy_sample_test_my_data_element1_.Store(data, size);
+    return;
+  }
+  vaf::ConstDataPtr<const std::uint64_t> sample{};
+  {
+    const std::unique_lock<std::mutex> lock{lazy_sample_test_my_data_element1_.Discard()};
+    sample = Deserialize_test_my_data_element1(data, size);
+  }
+  if (sample) {
+    channel_test_my_data_element1_.Publish(std::move(sample), active_modules_);
+  }
+}
+
+::vaf::ConstDataPtr<const std::uint64_t> MyLazyConsumerModule::Deserialize_test_my_data_element1(const std::uint8_t* data, std::size_t size) {
+  std::unique_ptr< std::uint64_t > ptr;
+  ptr = std::make_unique< std::uint64_t >();
+  if (!vaf::silkit::DeserializeFlat(data, size, *ptr)) {
+    vaf::LoggerSingleton::getInstance()->default_logger_.LogWarn() << "MyLazyConsumerModule: Dropped a sample of my_data_element1 with a different layout";
+    return {};
+  }
+  return ::vaf::ConstDataPtr<const std::uint64_t>{std::move(ptr)};
+}
+
+void MyLazyConsumerModule::Flush_test_my_data_element1() {
+  lazy_sample_test_my_data_element1_.Flush([this](const std::uint8_t* data, std::size_t size) {
+    ::vaf::ConstDataPtr<const std::uint64_t> sample{Deserialize_test_my_data_element1(data, size)};
+    if (sample) {
+      channel_test_my_data_element1_.Store(std::move(sample));
+    }
+  });
+}
+
+::vaf::Result<::vaf::ConstDataPtr<const std::uint64_t>> MyLazyConsumerModule::GetAllocated_my_data_element1() {
+  ::vaf::Result<::vaf::ConstDataPtr<const std::uint64_t>> result_value{
+      ::vaf::Error{::vaf::ErrorCode::kNotOk, "No sample available"}};
+  Flush_test_my_data_element1();
+  ::vaf::ConstDataPtr<const std::uint64_t> sample{channel_test_my_data_element1_.Load()};
+  if (sample) {
+    result_value = ::vaf::Result<::vaf::ConstDataPtr<const std::uint64_t>>{std::move(sample)};
+  }
+  return result_value;
+}
+
+std::uint64_t MyLazyConsumerModule::Get_my_data_element1() {
+  std::uint64_t return_value{};
+  Flush_test_my_data_element1();
+  const ::vaf::ConstDataPtr<const std::uint64_t> sample{channel_test_my_data_element1_.Load()};
+  if (sample) {
+    return_value = *sample;
+  }
+  return return_value;
+}
+
+void MyLazyConsumerModule::RegisterDataElementHandler_my_data_element1(vaf::String owner, std::function<void(const ::vaf::ConstDataPtr<const std::uint64_t>)>&& f) {
+  channel_test_my_data_element1_.AddHandler(owner, std::move(f));
+}
+
+
+void MyLazyConsumerModule::OnSample_test_my_data_element2(const std::uint8_t* data, std::size_t size) {
+  if (!started_.load(std::memory_order_acquire)) {
+    // Samples received while the module is stopped are dropped
+    return;
+  }
+  VAF_ALLOCATION_SCOPE("MyLazyConsumerModule.my_data_element2 Receive");
+  if (!channel_test_my_data_element2_.HasActiveHandlers(active_modules_)) {
+    // Deserialized by the first read of the data element, unless a newer sample replaces it before
+    lazy_sample_test_my_data_element2_.Store(data, size);
+    return;
+  }
+  vaf::ConstDataPtr<const std::uint64_t> sample{};
+  {
+    const std::unique_lock<std::mutex> lock{lazy_sample_test_my_data_element2_.Discard()};
+    sample = Deserialize_test_my_data_element2(data, size);
+  }
+  if (sample) {
+    channel_test_my_data_element2_.Publish(std::move(sample), active_modules_);
+  }
+}
+
+::vaf::ConstDataPtr<const std::uint64_t> MyLazyConsumerModule::Deserialize_test_my_data_element2(const std::uint8_t* data, std::size_t size) {
+  std::unique_ptr< std::uint64_t > ptr;
+  ptr = std::make_unique< std::uint64_t >();
+  if (!vaf::silkit::DeserializeFlat(data, size, *ptr)) {
+    vaf::LoggerSingleton::getInstance()->default_logger_.LogWarn() << "MyLazyConsumerModule: Dropped a sample of my_data_element2 with a different layout";
+    return {};
+  }
+  return ::vaf::ConstDataPtr<const std::uint64_t>{std::move(ptr)};
+}
+
+void MyLazyConsumerModule::Flush_test_my_data_element2() {
+  lazy_sample_test_my_data_element2_.Flush([this](const std::uint8_t* data, std::size_t size) {
+    ::vaf::ConstDataPtr<const std::uint64_t> sample{Deserialize_test_my_data_element2(data, size)};
+    if (sample) {
+      channel_test_my_data_element2_.Store(std::move(sample));
+    }
+  });
+}
+
+::vaf::Result<::vaf::ConstDataPtr<const std::uint64_t>> MyLazyConsumerModule::GetAllocated_my_data_element2() {
+  ::vaf::Result<::vaf::ConstDataPtr<const std::uint64_t>> result_value{
+      ::vaf::Error{::vaf::ErrorCode::kNotOk, "No sample available"}};
+  Flush_test_my_data_element2();
+  ::vaf::ConstDataPtr<const std::uint64_t> sample{channel_test_my_data_element2_.Load()};
+  if (sample) {
+    result_value = ::vaf::Result<::vaf::ConstDataPtr<const std::uint64_t>>{std::move(sample)};
+  }
+  return result_value;
+}
+
+std::uint64_t MyLazyConsumerModule::Get_my_data_element2() {
+  std::uint64_t return_value{};
+  Flush_test_my_data_element2();
+  const ::vaf::ConstDataPtr<const std::uint64_t> sample{channel_test_my_data_element2_.Load()};
+  if (sample) {
+    return_value = *sample;
+  }
+  return return_value;
+}
+
+void MyLazyConsumerModule::RegisterDataElementHandler_my_data_element2(vaf::String owner, std::function<void(const ::vaf::ConstDataPtr<const std::uint64_t>)>&& f) {
+  channel_test_my_data_element2_.AddHandler(owner, std::move(f));
+}
+
+
+void MyLazyConsumerModule::OnSample_test_my_data_element3(const std::uint8_t* data, std::size_t size) {
+  if (!started_.load(std::memory_order_acquire)) {
+    // Samples received while the module is stopped are dropped
+    return;
+  }
+  VAF_ALLOCATION_SCOPE("MyLazyConsumerModule.my_data_element3 Receive");
+  if (!vaf::silkit::DecompressSample(data, size)) {
+    vaf::LoggerSingleton::getInstance()->default_logger_.LogWarn() << "MyLazyConsumerModule: Dropped a malformed compressed sample of my_data_element3";
+    return;
+  }
+  if (!channel_test_my_data_element3_.HasActiveHandlers(active_modules_)) {
+    // Deserialized by the first read of the data element, unless a newer sample replaces it before
+    lazy_sample_test_my_data_element3_.Store(data, size);
+    return;
+  }
+  vaf::ConstDataPtr<const test::MyVector> sample{};
+  {
+    const std::unique_lock<std::mutex> lock{lazy_sample_test_my_data_element3_.Discard()};
+    sample = Deserialize_test_my_data_element3(data, size);
+  }
+  if (sample) {
+    channel_test_my_data_element3_.Publish(std::move(sample), active_modules_);
+  }
+}
+
+::vaf::ConstDataPtr<const test::MyVector> MyLazyConsumerModule::Deserialize_test_my_data_element3(const std::uint8_t* data, std::size_t size) {
+  std::unique_ptr< test::MyVector > ptr;
+  auto* deserialized = reception_arena_test_my_data_element3_.Create<protobuf::interface::test::MyInterface::my_data_element3>();
+  deserialized->ParseFromArray(data, static_cast<int>(size));
+  ptr = std::make_unique< test::MyVector >();
+  ::protobuf::interface::test::MyInterface::my_data_element3ProtoToVaf(std::move(*deserialized),*ptr);
+  reception_arena_test_my_data_element3_.Reset();
+  return ::vaf::ConstDataPtr<const test::MyVector>{std::move(ptr)};
+}
+
+void MyLazyConsumerModule::Flush_test_my_data_element3() {
+  lazy_sample_test_my_data_element3_.Flush([this](const std::uint8_t* data, std::size_t size) {
+    ::vaf::ConstDataPtr<const test::MyVector> sample{Deserialize_test_my_data_element3(data, size)};
+    if (sample) {
+      channel_test_my_data_element3_.Store(std::move(sample));
+    }
+  });
+}
+
+::vaf::Result<::vaf::ConstDataPtr<const test::MyVector>> MyLazyConsumerModule::GetAllocated_my_data_element3() {
+  ::vaf::Result<::vaf::ConstDataPtr<const test::MyVector>> result_value{
+      ::vaf::Error{::vaf::ErrorCode::kNotOk, "No sample available"}};
+  Flush_test_my_data_element3();
+  ::vaf::ConstDataPtr<const test::MyVector> sample{channel_test_my_data_element3_.Load()};
+  if (sample) {
+    result_value = ::vaf::Result<::vaf::ConstDataPtr<const test::MyVector>>{std::move(sample)};
+  }
+  return result_value;
+}
+
+test::MyVector MyLazyConsumerModule::Get_my_data_element3() {
+  test::MyVector return_value{};
+  Flush_test_my_data_element3();
+  const ::vaf::ConstDataPtr<const test::MyVector> sample{channel_test_my_data_element3_.Load()};
+  if (sample) {
+    return_value = *sample;
+  }
+  return return_value;
+}
+
+void MyLazyConsumerModule::RegisterDataElementHandler_my_data_element3(vaf::String owner, std::function<void(const ::vaf::ConstDataPtr<const test::MyVector>)>&& f) {
+  channel_test_my_data_element3_.AddHandler(owner, std::move(f));
+}
+
+
+void MyLazyConsumerModule::OnSample_test_my_data_element4(const std::uint8_t* data, std::size_t size) {
+  if (!started_.load(std::memory_order_acquire)) {
+    // Samples received while the module is stopped are dropped
+    return;
+  }
+  VAF_ALLOCATION_SCOPE("MyLazyConsumerModule.my_data_element4 Receive");
+  if (!delta_decoder_test_my_data_element4_.Decode(data, size)) {
+    vaf::LoggerSingleton::getInstance()->default_logger_.LogWarn() << "MyLazyConsumerModule: Dropped a sample of my_data_element4 without its keyframe";
+    return;
+  }
+  if (!channel_test_my_data_element4_.HasActiveHandlers(active_modules_)) {
+    // Deserialized by the first read of the data element, unless a newer sample replaces it before
+    lazy_sample_test_my_data_element4_.Store(data, size);
+    return;
+  }
+  vaf::ConstDataPtr<const test::MyState> sample{};
+  {
+    const std::unique_lock<std::mutex> lock{lazy_sample_test_my_data_element4_.Discard()};
+    sample = Deserialize_test_my_data_element4(data, size);
+  }
+  if (sample) {
+    channel_test_my_data_element4_.Publish(std::move(sample), active_modules_);
+  }
+}
+
+::vaf::ConstDataPtr<const test::MyState> MyLazyConsumerModule::Deserialize_test_my_data_element4(const std::uint8_t* data, std::size_t size) {
+  std::unique_ptr< test::MyState > ptr;
+  auto* deserialized = reception_arena_test_my_data_element4_.Create<protobuf::interface::test::MyInterface::my_data_element4>();
+  deserialized->ParseFromArray(data, static_cast<int>(size));
+  ptr = std::make_unique< test::MyState >();
+  ::protobuf::interface::test::MyInterface::my_data_element4ProtoToVaf(std::move(*deserialized),*ptr);
+  reception_arena_test_my_data_element4_.Reset();
+  return ::vaf::ConstDataPtr<const test::MyState>{std::move(ptr)};
+}
+
+void MyLazyConsumerModule::Flush_test_my_data_element4() {
+  lazy_sample_test_my_data_element4_.Flush([this](const std::uint8_t* data, std::size_t size) {
+    ::vaf::ConstDataPtr<const test::MyState> sample{Deserialize_test_my_data_element4(data, size)};
+    if (sample) {
+      channel_test_my_data_element4_.Store(std::move(sample));
+    }
+  });
+}
+
+::vaf::Result<::vaf::ConstDataPtr<const test::MyState>> MyLazyConsumerModule::GetAllocated_my_data_element4() {
+  ::vaf::Result<::vaf::ConstDataPtr<const test::MyState>> result_value{
+      ::vaf::Error{::vaf::ErrorCode::kNotOk, "No sample available"}};
+  Flush_test_my_data_element4();
+  ::vaf::ConstDataPtr<const test::MyState> sample{channel_test_my_data_element4_.Load()};
+  if (sample) {
+    result_value = ::vaf::Result<::vaf::ConstDataPtr<const test::MyState>>{std::move(sample)};
+  }
+  return result_value;
+}
+
+test::MyState MyLazyConsumerModule::Get_my_data_element4() {
+  test::MyState return_value{};
+  Flush_test_my_data_element4();
+  const ::vaf::ConstDataPtr<const test::MyState> sample{channel_test_my_data_element4_.Load()};
+  if (sample) {
+    return_value = *sample;
+  }
+  return return_value;
+}
+
+void MyLazyConsumerModule::RegisterDataElementHandler_my_data_element4(vaf::String owner, std::function<void(const ::vaf::ConstDataPtr<const test::MyState>)>&& f) {
+  channel_test_my_data_element4_.AddHandler(owner, std::move(f));
+}
+
+
+
+::vaf::Future<void> MyLazyConsumerModule::MyVoidOperation(const std::uint64_t& in) {
+  ::vaf::Future<void> return_value;
+  void* call_context = pending_calls_test_MyVoidOperation_.Begin(return_value);
+  if (call_context == nullptr) {
+    return return_value;
+  }
+  protobuf::interface::test::MyInterface::MyVoidOperation_in request;
+  protobuf::interface::test::MyInterface::MyVoidOperationInVafToProto(in, request);
+  const std::vector<std::uint8_t>& serialized = vaf::silkit::SerializeToBuffer(request);
+  VAF_TRACE_INSTANT("vaf.rpc", "MyVoidOperation call", "MyLazyConsumerModule");
+  rpc_client_test_MyVoidOperation_->Call(serialized, call_context);
+
+  return return_value;
+}
+::vaf::Future<test::MyOperation::Output> MyLazyConsumerModule::MyOperation(const std::uint64_t& in, const std::uint64_t& inout) {
+  ::vaf::Future<test::MyOperation::Output> return_value;
+  void* call_context = pending_calls_test_MyOperation_.Begin(return_value);
+  if (call_context == nullptr) {
+    return return_value;
+  }
+  protobuf::interface::test::MyInterface::MyOperation_in request;
+  protobuf::interface::test::MyInterface::MyOperationInVafToProto(in, inout, request);
+  const std::vector<std::uint8_t>& serialized = vaf::silkit::SerializeToBuffer(request);
+  VAF_TRACE_INSTANT("vaf.rpc", "MyOperation call", "MyLazyConsumerModule");
+  rpc_client_test_MyOperation_->Call(serialized, call_context);
+
+  return return_value;
+}
+::vaf::Future<test::MyGetter::Output> MyLazyConsumerModule::MyGetter() {
+  // The field is answered from its latest notification, the provider is only called until the first one
+  Flush_test_my_data_element1();
+  if (channel_test_my_data_element1_.HasPublished()) {
+    ::vaf::internal::Promise<test::MyGetter::Output> cached;
+    cached.set_value(test::MyGetter::Output{*channel_test_my_data_element1_.Load()});
+    return ::vaf::internal::CreateVafFutureFromVafPromise<test::MyGetter::Output>(cached);
+  }
+  ::vaf::Future<test::MyGetter::Output> return_value;
+  void* call_context = pending_calls_test_MyGetter_.Begin(return_value);
+  if (call_context == nullptr) {
+    return return_value;
+  }
+  protobuf::interface::test::MyInterface::MyGetter_in request;
+  const std::vector<std::uint8_t>& serialized = vaf::silkit::SerializeToBuffer(request);
+  VAF_TRACE_INSTANT("vaf.rpc", "MyGetter call", "MyLazyConsumerModule");
+  rpc_client_test_MyGetter_->Call(serialized, call_context);
+
+  return return_value;
+}
+::vaf::Future<void> MyLazyConsumerModule::MySetter(const std::uint64_t& a) {
+  ::vaf::Future<void> return_value;
+  void* call_context = pending_calls_test_MySetter_.Begin(return_value);
+  if (call_context == nullptr) {
+    return return_value;
+  }
+  protobuf::interface::test::MyInterface::MySetter_in request;
+  protobuf::interface::test::MyInterface::MySetterInVafToProto(a, request);
+  const std::vector<std::uint8_t>& serialized = vaf::silkit::SerializeToBuffer(request);
+  VAF_TRACE_INSTANT("vaf.rpc", "MySetter call", "MyLazyConsumerModule");
+  rpc_client_test_MySetter_->Call(serialized, call_context);
+
+  return return_value;
+}
+
+} // namespace test
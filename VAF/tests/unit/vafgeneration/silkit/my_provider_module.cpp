@@ -15,7 +15,6 @@
 
 #include "test/my_provider_module.h"
 
-#include <cstdlib>
 #include <google/protobuf/serial_arena.h>
 #include <memory>
 
@@ -23,12 +22,30 @@
 #include "vaf/result.h"
 #include "vaf/controller_interface.h"
 #include "vaf/error_domain.h"
+#include "vaf/logging.h"
+#include "vaf/allocation_tracking.h"
+#include "vaf/silkit/flat_wire_format.h"
+#include "vaf/silkit/participant.h"
+#include "vaf/silkit/sample_batch.h"
+#include "vaf/silkit/sample_compression.h"
+#include "vaf/silkit/serialization_buffer.h"
+#include "vaf/trace.h"
 #include "protobuf/interface/test/myinterface/protobuf_transformer.h"
 
+#include "silkit/SilKit.hpp"
+#include "silkit/services/all.hpp"
+#include "silkit/services/orchestration/string_utils.hpp"
+#include "silkit/util/serdes/Serialization.hpp"
+#include "protobuf_interface_test_MyInterface.pb.h"
+
 namespace test {
 
 MyProviderModule::MyProviderModule(vaf::Executor& executor, vaf::String name, vaf::ExecutableControllerInterface& executable_controller_interface)
   	: vaf::ControlInterface(std::move(name), {}, executable_controller_interface, executor) {
+  // Publishes the latest sample held back by the maximum publish rate
+  executor_.RunPeriodic("PublishThrottle_my_data_element2", std::chrono::microseconds{ 20000 }, [this]() {
+    publish_throttle_test_my_data_element2_.Flush([this](const std::vector<std::uint8_t>& sample) { publisher_test_my_data_element2_->Publish(sample); });
+  });
 }
 
 vaf::Result<void> MyProviderModule::Init() noexcept {
@@ -36,74 +53,101 @@ vaf::Result<void> MyProviderModule::Init() noexcept {
 }
 
 void MyProviderModule::Start() noexcept {
-  const char* value = std::getenv("SILKIT_REGISTRY_URI");
-  const auto registry_uri = (value != nullptr) ? std::string(value) : "silkit://localhost:8501";
-
-  const std::string participant_config_text = R"(
-  Description: My participant configuration
-  Logging:
-      Sinks:
-      - Type: Stdout
-        Level: Info
-  )";
-  auto config = SilKit::Config::ParticipantConfigurationFromString(participant_config_text);
-  participant_ = SilKit::CreateParticipant(config, "test_MyProviderModule", registry_uri);
-
-  SilKit::Services::PubSub::PubSubSpec pubsubspec_test_my_data_element1{"MyInterface_my_data_element1", "application/protobuf"};
+  // SIL Kit cannot remove controllers again, so a restart only reactivates the ones of the first start
+  if (!controllers_created_) {
+    CreateControllers();
+    controllers_created_ = true;
+  }
+  started_.store(true, std::memory_order_release);
+  ReportOperational();
+}
+
+void MyProviderModule::Stop() noexcept {
+  started_.store(false, std::memory_order_release);
+}
+
+void MyProviderModule::CreateControllers() {
+  // All SIL Kit modules of the executable share one participant
+  SilKit::IParticipant& participant = vaf::silkit::GetParticipant();
+
+  SilKit::Services::PubSub::PubSubSpec pubsubspec_test_my_data_element1{"MyInterface_my_data_element1", vaf::silkit::kFlatMediaType};
   pubsubspec_test_my_data_element1.AddLabel("Instance", "MyInterface", SilKit::Services::MatchingLabel::Kind::Mandatory);
-  publisher_test_my_data_element1_= participant_->CreateDataPublisher("Publisher_test_my_data_element1", pubsubspec_test_my_data_element1);
+  publisher_test_my_data_element1_= participant.CreateDataPublisher("MyProviderModule_Publisher_test_my_data_element1", pubsubspec_test_my_data_element1);
 
-  SilKit::Services::PubSub::PubSubSpec pubsubspec_test_my_data_element2{"MyInterface_my_data_element2", "application/protobuf"};
+  SilKit::Services::PubSub::PubSubSpec pubsubspec_test_my_data_element2{"MyInterface_my_data_element2", vaf::silkit::kFlatMediaType};
   pubsubspec_test_my_data_element2.AddLabel("Instance", "MyInterface", SilKit::Services::MatchingLabel::Kind::Mandatory);
-  publisher_test_my_data_element2_= participant_->CreateDataPublisher("Publisher_test_my_data_element2", pubsubspec_test_my_data_element2);
+  publisher_test_my_data_element2_= participant.CreateDataPublisher("MyProviderModule_Publisher_test_my_data_element2", pubsubspec_test_my_data_element2);
+
+  SilKit::Services::PubSub::PubSubSpec pubsubspec_test_my_data_element3{"MyInterface_my_data_element3", vaf::silkit::CompressedMediaType("application/protobuf", vaf::silkit::Compression::kLz4)};
+  pubsubspec_test_my_data_element3.AddLabel("Instance", "MyInterface", SilKit::Services::MatchingLabel::Kind::Mandatory);
+  publisher_test_my_data_element3_= participant.CreateDataPublisher("MyProviderModule_Publisher_test_my_data_element3", pubsubspec_test_my_data_element3);
+
+  SilKit::Services::PubSub::PubSubSpec pubsubspec_test_my_data_element4{"MyInterface_my_data_element4", vaf::silkit::DeltaMediaType("application/protobuf")};
+  pubsubspec_test_my_data_element4.AddLabel("Instance", "MyInterface", SilKit::Services::MatchingLabel::Kind::Mandatory);
+  publisher_test_my_data_element4_= participant.CreateDataPublisher("MyProviderModule_Publisher_test_my_data_element4", pubsubspec_test_my_data_element4);
 
 
   SilKit::Services::Rpc::RpcSpec rpcspec_test_MyVoidOperation{"MyInterface_MyVoidOperation", "application/protobuf"};
   rpcspec_test_MyVoidOperation.AddLabel("Instance", "MyInterface", SilKit::Services::MatchingLabel::Kind::Mandatory);
-  auto RemoteFunc_test_MyVoidOperation = [&](auto* server, const auto& event) {
+  auto RemoteFunc_test_MyVoidOperation = [this](auto* server, const auto& event) {
+    if (!started_.load(std::memory_order_acquire)) {
+      // Without a result, the call fails on the consumer side once it times out
+      return;
+    }
+    VAF_TRACE_SCOPE("vaf.rpc", "MyVoidOperation", "MyProviderModule");
     protobuf::interface::test::MyInterface::MyVoidOperation_in deserialized;
     deserialized.ParseFromArray(event.argumentData.data(), event.argumentData.size());
     std::uint64_t in{};
-    protobuf::interface::test::MyInterface::MyVoidOperationInProtoToVaf(deserialized, in);
+    protobuf::interface::test::MyInterface::MyVoidOperationInProtoToVaf(std::move(deserialized), in);
     if (CbkFunction_test_MyVoidOperation_) {
       CbkFunction_test_MyVoidOperation_(in);
     }
     protobuf::interface::test::MyInterface::MyVoidOperation_out request;
-    size_t nbytes = request.ByteSizeLong();
-    std::vector<std::uint8_t> serialized(nbytes);
-    if (nbytes != 0u) {
-      request.SerializeToArray(serialized.data(), nbytes);
-    }
+    const std::vector<std::uint8_t>& serialized = vaf::silkit::SerializeToBuffer(request);
     server->SubmitResult(event.callHandle, serialized);
   };
-  server_test_MyVoidOperation_= participant_->CreateRpcServer("test::MyVoidOperation", rpcspec_test_MyVoidOperation, RemoteFunc_test_MyVoidOperation);
+  server_test_MyVoidOperation_= participant.CreateRpcServer("MyProviderModule_test_MyVoidOperation", rpcspec_test_MyVoidOperation, RemoteFunc_test_MyVoidOperation);
 
   SilKit::Services::Rpc::RpcSpec rpcspec_test_MyOperation{"MyInterface_MyOperation", "application/protobuf"};
   rpcspec_test_MyOperation.AddLabel("Instance", "MyInterface", SilKit::Services::MatchingLabel::Kind::Mandatory);
-  auto RemoteFunc_test_MyOperation = [&](auto* server, const auto& event) {
+  auto RemoteFunc_test_MyOperation = [this](auto* server, const auto& event) {
+    if (!started_.load(std::memory_order_acquire)) {
+      // Without a result, the call fails on the consumer side once it times out
+      return;
+    }
+    VAF_TRACE_SCOPE("vaf.rpc", "MyOperation", "MyProviderModule");
     protobuf::interface::test::MyInterface::MyOperation_in deserialized;
     deserialized.ParseFromArray(event.argumentData.data(), event.argumentData.size());
     std::uint64_t in{};
     std::uint64_t inout{};
-    protobuf::interface::test::MyInterface::MyOperationInProtoToVaf(deserialized, in, inout);
-    test::MyOperation::Output result;
-    if (CbkFunction_test_MyOperation_) {
-      result = CbkFunction_test_MyOperation_(in, inout);
-    }
-    protobuf::interface::test::MyInterface::MyOperation_out request;
-    protobuf::interface::test::MyInterface::MyOperationOutVafToProto(result, request);
-    size_t nbytes = request.ByteSizeLong();
-    std::vector<std::uint8_t> serialized(nbytes);
-    if (nbytes != 0u) {
-      request.SerializeToArray(serialized.data(), nbytes);
+    protobuf::interface::test::MyInterface::MyOperationInProtoToVaf(std::move(deserialized), in, inout);
+    // The handler runs in a worker thread of the operation, the reply is submitted from there
+    const bool queued{worker_pool_test_MyOperation_.TryPost([this, server, call_handle = event.callHandle, in = std::move(in), inout = std::move(inout)]() {
+      VAF_TRACE_SCOPE("vaf.rpc", "MyOperation handler", "MyProviderModule");
+      test::MyOperation::Output result;
+      if (CbkFunction_test_MyOperation_) {
+        result = CbkFunction_test_MyOperation_(in, inout);
+      }
+      protobuf::interface::test::MyInterface::MyOperation_out request;
+      protobuf::interface::test::MyInterface::MyOperationOutVafToProto(result, request);
+      const std::vector<std::uint8_t>& serialized = vaf::silkit::SerializeToBuffer(request);
+      server->SubmitResult(call_handle, serialized);
+    })};
+    if (!queued) {
+      // Without a result, the call fails on the consumer side once it times out
+      vaf::LoggerSingleton::getInstance()->default_logger_.LogWarn() << "MyProviderModule: Dropped a call of MyOperation, the handler queue is full";
     }
-    server->SubmitResult(event.callHandle, serialized);
   };
-  server_test_MyOperation_= participant_->CreateRpcServer("test::MyOperation", rpcspec_test_MyOperation, RemoteFunc_test_MyOperation);
+  server_test_MyOperation_= participant.CreateRpcServer("MyProviderModule_test_MyOperation", rpcspec_test_MyOperation, RemoteFunc_test_MyOperation);
 
   SilKit::Services::Rpc::RpcSpec rpcspec_test_MyGetter{"MyInterface_MyGetter", "application/protobuf"};
   rpcspec_test_MyGetter.AddLabel("Instance", "MyInterface", SilKit::Services::MatchingLabel::Kind::Mandatory);
-  auto RemoteFunc_test_MyGetter = [&](auto* server, const auto& event) {
+  auto RemoteFunc_test_MyGetter = [this](auto* server, const auto& event) {
+    if (!started_.load(std::memory_order_acquire)) {
+      // Without a result, the call fails on the consumer side once it times out
+      return;
+    }
+    VAF_TRACE_SCOPE("vaf.rpc", "MyGetter", "MyProviderModule");
     protobuf::interface::test::MyInterface::MyGetter_in deserialized;
     deserialized.ParseFromArray(event.argumentData.data(), event.argumentData.size());
     test::MyGetter::Output result;
@@ -112,103 +156,136 @@ void MyProviderModule::Start() noexcept {
     }
     protobuf::interface::test::MyInterface::MyGetter_out request;
     protobuf::interface::test::MyInterface::MyGetterOutVafToProto(result, request);
-    size_t nbytes = request.ByteSizeLong();
-    std::vector<std::uint8_t> serialized(nbytes);
-    if (nbytes != 0u) {
-      request.SerializeToArray(serialized.data(), nbytes);
-    }
+    const std::vector<std::uint8_t>& serialized = vaf::silkit::SerializeToBuffer(request);
     server->SubmitResult(event.callHandle, serialized);
   };
-  server_test_MyGetter_= participant_->CreateRpcServer("test::MyGetter", rpcspec_test_MyGetter, RemoteFunc_test_MyGetter);
+  server_test_MyGetter_= participant.CreateRpcServer("MyProviderModule_test_MyGetter", rpcspec_test_MyGetter, RemoteFunc_test_MyGetter);
 
   SilKit::Services::Rpc::RpcSpec rpcspec_test_MySetter{"MyInterface_MySetter", "application/protobuf"};
   rpcspec_test_MySetter.AddLabel("Instance", "MyInterface", SilKit::Services::MatchingLabel::Kind::Mandatory);
-  auto RemoteFunc_test_MySetter = [&](auto* server, const auto& event) {
+  auto RemoteFunc_test_MySetter = [this](auto* server, const auto& event) {
+    if (!started_.load(std::memory_order_acquire)) {
+      // Without a result, the call fails on the consumer side once it times out
+      return;
+    }
+    VAF_TRACE_SCOPE("vaf.rpc", "MySetter", "MyProviderModule");
     protobuf::interface::test::MyInterface::MySetter_in deserialized;
     deserialized.ParseFromArray(event.argumentData.data(), event.argumentData.size());
     std::uint64_t a{};
-    protobuf::interface::test::MyInterface::MySetterInProtoToVaf(deserialized, a);
-    if (CbkFunction_test_MySetter_) {
-      CbkFunction_test_MySetter_(a);
-    }
-    protobuf::interface::test::MyInterface::MySetter_out request;
-    size_t nbytes = request.ByteSizeLong();
-    std::vector<std::uint8_t> serialized(nbytes);
-    if (nbytes != 0u) {
-      request.SerializeToArray(serialized.data(), nbytes);
+    protobuf::interface::test::MyInterface::MySetterInProtoToVaf(std::move(deserialized), a);
+    if (!call_limit_test_MySetter_.TryAcquire()) {
+      // Without a result, the call fails on the consumer side once it times out
+      vaf::LoggerSingleton::getInstance()->default_logger_.LogWarn() << "MyProviderModule: Dropped a call of MySetter, the handler queue is full";
+      return;
     }
-    server->SubmitResult(event.callHandle, serialized);
+    // The handler runs in the executor of the module, the reply is submitted from there
+    executor_.Post([this, server, call_handle = event.callHandle, a = std::move(a)]() {
+      VAF_TRACE_SCOPE("vaf.rpc", "MySetter handler", "MyProviderModule");
+      if (CbkFunction_test_MySetter_) {
+        CbkFunction_test_MySetter_(a);
+      }
+      protobuf::interface::test::MyInterface::MySetter_out request;
+      const std::vector<std::uint8_t>& serialized = vaf::silkit::SerializeToBuffer(request);
+      server->SubmitResult(call_handle, serialized);
+      call_limit_test_MySetter_.Release();
+    });
   };
-  server_test_MySetter_= participant_->CreateRpcServer("test::MySetter", rpcspec_test_MySetter, RemoteFunc_test_MySetter);
+  server_test_MySetter_= participant.CreateRpcServer("MyProviderModule_test_MySetter", rpcspec_test_MySetter, RemoteFunc_test_MySetter);
 
-  ReportOperational();
-}
-
-void MyProviderModule::Stop() noexcept {
 }
 
 void MyProviderModule::DeInit() noexcept {
 }
 
 ::vaf::Result<::vaf::DataPtr<std::uint64_t>> MyProviderModule::Allocate_my_data_element1() {
-  std::unique_ptr< std::uint64_t > ptr{
-      std::make_unique< std::uint64_t >()};
-  return ::vaf::Result<vaf::DataPtr< std::uint64_t >>::FromValue(std::move(ptr));
+  VAF_ALLOCATION_SCOPE("MyProviderModule.my_data_element1 Allocate");
+  return ::vaf::Result<vaf::DataPtr< std::uint64_t >>::FromValue(vaf::MakeDataPtr< std::uint64_t >());
 }
 
 ::vaf::Result<void> MyProviderModule::SetAllocated_my_data_element1(::vaf::DataPtr<std::uint64_t>&& data) {
-  protobuf::interface::test::MyInterface::my_data_element1 request;
-  protobuf::interface::test::MyInterface::my_data_element1VafToProto(*vaf::internal::DataPtrHelper<std::uint64_t>::getRawPtr(data), request);
-  size_t nbytes = request.ByteSizeLong();
-  std::vector<std::uint8_t> serialized(nbytes);
-  if (nbytes != 0u) {
-    request.SerializeToArray(serialized.data(), nbytes);
-  }
-  publisher_test_my_data_element1_->Publish(serialized);
+  VAF_ALLOCATION_SCOPE("MyProviderModule.my_data_element1 Set");
+  metric_published_test_my_data_element1_.Increment();
+  publisher_test_my_data_element1_->Publish(vaf::silkit::SerializeFlat(*data));
 
   return ::vaf::Result<void>{};
 }
 
 ::vaf::Result<void> MyProviderModule::Set_my_data_element1(const std::uint64_t& data) {
-  protobuf::interface::test::MyInterface::my_data_element1 request;
-  protobuf::interface::test::MyInterface::my_data_element1VafToProto(data, request);
-  size_t nbytes = request.ByteSizeLong();
-  std::vector<std::uint8_t> serialized(nbytes);
-  if (nbytes != 0u) {
-    request.SerializeToArray(serialized.data(), nbytes);
-  }
-  publisher_test_my_data_element1_->Publish(serialized);
+  VAF_ALLOCATION_SCOPE("MyProviderModule.my_data_element1 Set");
+  metric_published_test_my_data_element1_.Increment();
+  publisher_test_my_data_element1_->Publish(vaf::silkit::SerializeFlat(data));
 
   return ::vaf::Result<void>{};
 }
 ::vaf::Result<::vaf::DataPtr<std::uint64_t>> MyProviderModule::Allocate_my_data_element2() {
-  std::unique_ptr< std::uint64_t > ptr{
-      std::make_unique< std::uint64_t >()};
-  return ::vaf::Result<vaf::DataPtr< std::uint64_t >>::FromValue(std::move(ptr));
+  VAF_ALLOCATION_SCOPE("MyProviderModule.my_data_element2 Allocate");
+  return ::vaf::Result<vaf::DataPtr< std::uint64_t >>::FromValue(vaf::MakeDataPtr< std::uint64_t >());
 }
 
 ::vaf::Result<void> MyProviderModule::SetAllocated_my_data_element2(::vaf::DataPtr<std::uint64_t>&& data) {
-  protobuf::interface::test::MyInterface::my_data_element2 request;
-  protobuf::interface::test::MyInterface::my_data_element2VafToProto(*vaf::internal::DataPtrHelper<std::uint64_t>::getRawPtr(data), request);
-  size_t nbytes = request.ByteSizeLong();
-  std::vector<std::uint8_t> serialized(nbytes);
-  if (nbytes != 0u) {
-    request.SerializeToArray(serialized.data(), nbytes);
-  }
-  publisher_test_my_data_element2_->Publish(serialized);
+  VAF_ALLOCATION_SCOPE("MyProviderModule.my_data_element2 Set");
+  metric_published_test_my_data_element2_.Increment();
+  publish_throttle_test_my_data_element2_.Offer(vaf::silkit::SerializeFlat(*data), [this](const std::vector<std::uint8_t>& sample) { publisher_test_my_data_element2_->Publish(sample); });
 
   return ::vaf::Result<void>{};
 }
 
 ::vaf::Result<void> MyProviderModule::Set_my_data_element2(const std::uint64_t& data) {
-  protobuf::interface::test::MyInterface::my_data_element2 request;
-  protobuf::interface::test::MyInterface::my_data_element2VafToProto(data, request);
-  size_t nbytes = request.ByteSizeLong();
-  std::vector<std::uint8_t> serialized(nbytes);
-  if (nbytes != 0u) {
-    request.SerializeToArray(serialized.data(), nbytes);
-  }
-  publisher_test_my_data_element2_->Publish(serialized);
+  VAF_ALLOCATION_SCOPE("MyProviderModule.my_data_element2 Set");
+  metric_published_test_my_data_element2_.Increment();
+  publish_throttle_test_my_data_element2_.Offer(vaf::silkit::SerializeFlat(data), [this](const std::vector<std::uint8_t>& sample) { publisher_test_my_data_element2_->Publish(sample); });
+
+  return ::vaf::Result<void>{};
+}
+::vaf::Result<::vaf::DataPtr<test::MyVector>> MyProviderModule::Allocate_my_data_element3() {
+  VAF_ALLOCATION_SCOPE("MyProviderModule.my_data_element3 Allocate");
+  return ::vaf::Result<vaf::DataPtr< test::MyVector >>::FromValue(vaf::MakeDataPtr< test::MyVector >());
+}
+
+::vaf::Result<void> MyProviderModule::SetAllocated_my_data_element3(::vaf::DataPtr<test::MyVector>&& data) {
+  VAF_ALLOCATION_SCOPE("MyProviderModule.my_data_element3 Set");
+  protobuf::interface::test::MyInterface::my_data_element3 request;
+  protobuf::interface::test::MyInterface::my_data_element3VafToProto(*vaf::internal::DataPtrHelper<test::MyVector>::getRawPtr(data), request);
+  const std::vector<std::uint8_t>& serialized = vaf::silkit::SerializeToBuffer(request);
+  metric_published_test_my_data_element3_.Increment();
+  publish_throttle_test_my_data_element3_.Offer(serialized, [this](const std::vector<std::uint8_t>& sample) { publisher_test_my_data_element3_->Publish(vaf::silkit::CompressSample(sample, vaf::silkit::Compression::kLz4, 256U)); });
+
+  return ::vaf::Result<void>{};
+}
+
+::vaf::Result<void> MyProviderModule::Set_my_data_element3(const test::MyVector& data) {
+  VAF_ALLOCATION_SCOPE("MyProviderModule.my_data_element3 Set");
+  protobuf::interface::test::MyInterface::my_data_element3 request;
+  protobuf::interface::test::MyInterface::my_data_element3VafToProto(data, request);
+  const std::vector<std::uint8_t>& serialized = vaf::silkit::SerializeToBuffer(request);
+  metric_published_test_my_data_element3_.Increment();
+  publish_throttle_test_my_data_element3_.Offer(serialized, [this](const std::vector<std::uint8_t>& sample) { publisher_test_my_data_element3_->Publish(vaf::silkit::CompressSample(sample, vaf::silkit::Compression::kLz4, 256U)); });
+
+  return ::vaf::Result<void>{};
+}
+::vaf::Result<::vaf::DataPtr<test::MyState>> MyProviderModule::Allocate_my_data_element4() {
+  VAF_ALLOCATION_SCOPE("MyProviderModule.my_data_element4 Allocate");
+  return ::vaf::Result<vaf::DataPtr< test::MyState >>::FromValue(vaf::MakeDataPtr< test::MyState >());
+}
+
+::vaf::Result<void> MyProviderModule::SetAllocated_my_data_element4(::vaf::DataPtr<test::MyState>&& data) {
+  VAF_ALLOCATION_SCOPE("MyProviderModule.my_data_element4 Set");
+  protobuf::interface::test::MyInterface::my_data_element4 request;
+  protobuf::interface::test::MyInterface::my_data_element4VafToProto(*vaf::internal::DataPtrHelper<test::MyState>::getRawPtr(data), request);
+  const std::vector<std::uint8_t>& serialized = vaf::silkit::SerializeToBuffer(request);
+  metric_published_test_my_data_element4_.Increment();
+  delta_encoder_test_my_data_element4_.Encode(serialized, [this](const std::vector<std::uint8_t>& delta) { publisher_test_my_data_element4_->Publish(delta); });
+
+  return ::vaf::Result<void>{};
+}
+
+::vaf::Result<void> MyProviderModule::Set_my_data_element4(const test::MyState& data) {
+  VAF_ALLOCATION_SCOPE("MyProviderModule.my_data_element4 Set");
+  protobuf::interface::test::MyInterface::my_data_element4 request;
+  protobuf::interface::test::MyInterface::my_data_element4VafToProto(data, request);
+  const std::vector<std::uint8_t>& serialized = vaf::silkit::SerializeToBuffer(request);
+  metric_published_test_my_data_element4_.Increment();
+  delta_encoder_test_my_data_element4_.Encode(serialized, [this](const std::vector<std::uint8_t>& delta) { publisher_test_my_data_element4_->Publish(delta); });
 
   return ::vaf::Result<void>{};
 }
@@ -0,0 +1,318 @@
+/*!********************************************************************************************************************
+ *  COPYRIGHT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  Copyright (c) 2024-2026 by Vector Informatik GmbH. All rights reserved.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -----------------------------------------------------------------------------------------------------------------*/
+/*!        \file  my_usage_consumer_module.cpp
+ *         \brief
+ *
+ *********************************************************************************************************************/
+
+#include "test/my_usage_consumer_module.h"
+
+#include <chrono>
+#include <google/protobuf/serial_arena.h>
+
+#include "vaf/allocation_tracking.h"
+#include "vaf/error_domain.h"
+#include "vaf/logging.h"
+#include "vaf/silkit/flat_wire_format.h"
+#include "vaf/silkit/participant.h"
+#include "vaf/silkit/sample_batch.h"
+#include "vaf/silkit/sample_compression.h"
+#include "vaf/silkit/serialization_buffer.h"
+#include "vaf/future.h"
+#include "vaf/trace.h"
+#include "protobuf/interface/test/myinterface/protobuf_transformer.h"
+
+#include "silkit/SilKit.hpp"
+#include "silkit/services/all.hpp"
+#include "silkit/services/orchestration/string_utils.hpp"
+#include "silkit/util/serdes/Serialization.hpp"
+#include "protobuf_interface_test_MyInterface.pb.h"
+
+namespace test {
+
+MyUsageConsumerModule::MyUsageConsumerModule(::vaf::Executor& executor, vaf::String name, ::vaf::ExecutableControllerInterface& executable_controller_interface)
+  : ::vaf::ControlInterface(std::move(name), {}, executable_controller_interface, executor),
+    executor_{ControlInterface::executor_} {
+  executor_.RunPeriodic("RpcTimeouts", vaf::silkit::RpcTimeoutSweepPeriod(std::chrono::milliseconds{ 100 }, executor_.RunningPeriod()), [this]() {
+    pending_calls_test_MyVoidOperation_.ExpireTimedOut();
+    pending_calls_test_MyGetter_.ExpireTimedOut();
+  });
+}
+
+::vaf::Result<void> MyUsageConsumerModule::Init() noexcept {
+  return ::vaf::Result<void>{};
+}
+
+void MyUsageConsumerModule::Start() noexcept {
+  // SIL Kit cannot remove controllers again, so a restart only reactivates the ones of the first start
+  if (!controllers_created_) {
+    CreateControllers();
+    controllers_created_ = true;
+  }
+  started_.store(true, std::memory_order_release);
+  ReportOperational();
+}
+
+void MyUsageConsumerModule::Stop() noexcept {
+  started_.store(false, std::memory_order_release);
+  pending_calls_test_MyVoidOperation_.CancelAll();
+  pending_calls_test_MyGetter_.CancelAll();
+}
+
+void MyUsageConsumerModule::CreateControllers() {
+  // All SIL Kit modules of the executable share one participant
+  SilKit::IParticipant& participant = vaf::silkit::GetParticipant();
+
+  SilKit::Services::PubSub::PubSubSpec pubsubspec_test_my_data_element1{"MyInterface_my_data_element1", vaf::silkit::kFlatMediaType};
+  pubsubspec_test_my_data_element1.AddLabel("Instance", "MyInterface", SilKit::Services::MatchingLabel::Kind::Mandatory);
+  auto receptionHandler_test_my_data_element1 = [this](auto* /*subscriber*/, const auto& dataMessageEvent) {
+    OnSample_test_my_data_element1(dataMessageEvent.data.data(), dataMessageEvent.data.size());
+  };
+  subscriber_test_my_data_element1_= participant.CreateDataSubscriber("MyUsageConsumerModule_Subscriber_test_my_data_element1", pubsubspec_test_my_data_element1, receptionHandler_test_my_data_element1);
+
+  SilKit::Services::PubSub::PubSubSpec pubsubspec_test_my_data_element3{"MyInterface_my_data_element3", vaf::silkit::CompressedMediaType("application/protobuf", vaf::silkit::Compression::kLz4)};
+  pubsubspec_test_my_data_element3.AddLabel("Instance", "MyInterface", SilKit::Services::MatchingLabel::Kind::Mandatory);
+  auto receptionHandler_test_my_data_element3 = [this](auto* /*subscriber*/, const auto& dataMessageEvent) {
+    OnSample_test_my_data_element3(dataMessageEvent.data.data(), dataMessageEvent.data.size());
+  };
+  subscriber_test_my_data_element3_= participant.CreateDataSubscriber("MyUsageConsumerModule_Subscriber_test_my_data_element3", pubsubspec_test_my_data_element3, receptionHandler_test_my_data_element3);
+
+
+  SilKit::Services::Rpc::RpcSpec rpcspec_test_MyVoidOperation{"MyInterface_MyVoidOperation", "application/protobuf"};
+  rpcspec_test_MyVoidOperation.AddLabel("Instance", "MyInterface", SilKit::Services::MatchingLabel::Kind::Mandatory);
+  auto ReturnFunc_test_MyVoidOperation = [this](auto* /*client*/, const auto& event) {
+    VAF_TRACE_INSTANT("vaf.rpc", "MyVoidOperation result", "MyUsageConsumerModule");
+    auto promise = pending_calls_test_MyVoidOperation_.Complete(event.userContext);
+    if (!promise) {
+      // The call already timed out or was cancelled
+      return;
+    }
+    if (event.callStatus == SilKit::Services::Rpc::RpcCallStatus::Success) {
+      promise->set_value();
+    } else {
+      vaf::Error error_code{::vaf::ErrorCode::kNotOk, "Rpc call failed"};
+      vaf::internal::SetVafErrorCodeToPromise(*promise, error_code);
+    }
+  };
+  rpc_client_test_MyVoidOperation_= participant.CreateRpcClient("MyUsageConsumerModule_test_MyVoidOperation", rpcspec_test_MyVoidOperation, ReturnFunc_test_MyVoidOperation);
+
+  SilKit::Services::Rpc::RpcSpec rpcspec_test_MyGetter{"MyInterface_MyGetter", "application/protobuf"};
+  rpcspec_test_MyGetter.AddLabel("Instance", "MyInterface", SilKit::Services::MatchingLabel::Kind::Mandatory);
+  auto ReturnFunc_test_MyGetter = [this](auto* /*client*/, const auto& event) {
+    VAF_TRACE_INSTANT("vaf.rpc", "MyGetter result", "MyUsageConsumerModule");
+    auto promise = pending_calls_test_MyGetter_.Complete(event.userContext);
+    if (!promise) {
+      // The call already timed out or was cancelled
+      return;
+    }
+    if (event.callStatus == SilKit::Services::Rpc::RpcCallStatus::Success) {
+      test::MyGetter::Output output;
+      protobuf::interface::test::MyInterface::MyGetter_out deserialized;
+      deserialized.ParseFromArray( event.resultData.data(), event.resultData.size() );
+      ::protobuf::interface::test::MyInterface::MyGetterOutProtoToVaf(std::move(deserialized), output);
+      promise->set_value(std::move(output));
+    } else {
+      vaf::Error error_code{::vaf::ErrorCode::kNotOk, "Rpc call failed"};
+      vaf::internal::SetVafErrorCodeToPromise(*promise, error_code);
+    }
+  };
+  rpc_client_test_MyGetter_= participant.CreateRpcClient("MyUsageConsumerModule_test_MyGetter", rpcspec_test_MyGetter, ReturnFunc_test_MyGetter);
+
+}
+
+void MyUsageConsumerModule::DeInit() noexcept {
+}
+
+void MyUsageConsumerModule::StartEventHandlerForModule(vaf::ModuleId module) {
+  active_modules_.Insert(module);
+}
+
+void MyUsageConsumerModule::StopEventHandlerForModule(vaf::ModuleId module) {
+  active_modules_.Erase(module);
+}
+
+vaf::Vector<vaf::MemoryUsage> MyUsageConsumerModule::GetMemoryUsage() const {
+  vaf::Vector<vaf::MemoryUsage> usage{};
+  usage.push_back(vaf::MemoryUsage{name_, "my_data_element1"});
+  channel_test_my_data_element1_.AddMemoryUsage(usage.back());
+  usage.push_back(vaf::MemoryUsage{name_, "my_data_element3"});
+  channel_test_my_data_element3_.AddMemoryUsage(usage.back());
+  return usage;
+}
+
+
+void MyUsageConsumerModule::OnSample_test_my_data_element1(const std::uint8_t* data, std::size_t size) {
+  if (!started_.load(std::memory_order_acquire)) {
+    // Samples received while the module is stopped are dropped
+    return;
+  }
+  VAF_ALLOCATION_SCOPE("MyUsageConsumerModule.my_data_element1 Receive");
+  std::unique_ptr< std::uint64_t > ptr;
+  ptr = std::make_unique< std::uint64_t >();
+  if (!vaf::silkit::DeserializeFlat(data, size, *ptr)) {
+    vaf::LoggerSingleton::getInstance()->default_logger_.LogWarn() << "MyUsageConsumerModule: Dropped a sample of my_data_element1 with a different layout";
+    return;
+  }
+  vaf::ConstDataPtr<const std::uint64_t> sample{std::move(ptr)};
+  channel_test_my_data_element1_.Publish(std::move(sample), active_modules_);
+}
+
+::vaf::Result<::vaf::ConstDataPtr<const std::uint64_t>> MyUsageConsumerModule::GetAllocated_my_data_element1() {
+  ::vaf::Result<::vaf::ConstDataPtr<const std::uint64_t>> result_value{
+      ::vaf::Error{::vaf::ErrorCode::kNotOk, "No sample available"}};
+  ::vaf::ConstDataPtr<const std::uint64_t> sample{channel_test_my_data_element1_.Load()};
+  if (sample) {
+    result_value = ::vaf::Result<::vaf::ConstDataPtr<const std::uint64_t>>{std::move(sample)};
+  }
+  return result_value;
+}
+
+std::uint64_t MyUsageConsumerModule::Get_my_data_element1() {
+  std::uint64_t return_value{};
+  const ::vaf::ConstDataPtr<const std::uint64_t> sample{channel_test_my_data_element1_.Load()};
+  if (sample) {
+    return_value = *sample;
+  }
+  return return_value;
+}
+
+void MyUsageConsumerModule::RegisterDataElementHandler_my_data_element1(vaf::String owner, std::function<void(const ::vaf::ConstDataPtr<const std::uint64_t>)>&& f) {
+  channel_test_my_data_element1_.AddHandler(owner, std::move(f));
+}
+
+
+// my_data_element2 is not used by the application modules mapped to this module, so it is not subscribed to
+::vaf::Result<::vaf::ConstDataPtr<const std::uint64_t>> MyUsageConsumerModule::GetAllocated_my_data_element2() {
+  return ::vaf::Result<::vaf::ConstDataPtr<const std::uint64_t>>{
+      ::vaf::Error{::vaf::ErrorCode::kNotOk, "my_data_element2 is not used"}};
+}
+
+std::uint64_t MyUsageConsumerModule::Get_my_data_element2() {
+  return std::uint64_t{64};
+}
+
+void MyUsageConsumerModule::RegisterDataElementHandler_my_data_element2(vaf::String owner, std::function<void(const ::vaf::ConstDataPtr<const std::uint64_t>)>&& f) {
+  static_cast<void>(owner);
+  static_cast<void>(f);
+}
+
+
+void MyUsageConsumerModule::OnSample_test_my_data_element3(const std::uint8_t* data, std::size_t size) {
+  if (!started_.load(std::memory_order_acquire)) {
+    // Samples received while the module is stopped are dropped
+    return;
+  }
+  VAF_ALLOCATION_SCOPE("MyUsageConsumerModule.my_data_element3 Receive");
+  if (!vaf::silkit::DecompressSample(data, size)) {
+    vaf::LoggerSingleton::getInstance()->default_logger_.LogWarn() << "MyUsageConsumerModule: Dropped a malformed compressed sample of my_data_element3";
+    return;
+  }
+  std::unique_ptr< test::MyVector > ptr;
+  auto* deserialized = reception_arena_test_my_data_element3_.Create<protobuf::interface::test::MyInterface::my_data_element3>();
+  deserialized->ParseFromArray(data, static_cast<int>(size));
+  ptr = std::make_unique< test::MyVector >();
+  ::protobuf::interface::test::MyInterface::my_data_element3ProtoToVaf(std::move(*deserialized),*ptr);
+  reception_arena_test_my_data_element3_.Reset();
+  vaf::ConstDataPtr<const test::MyVector> sample{std::move(ptr)};
+  channel_test_my_data_element3_.Publish(std::move(sample), active_modules_);
+}
+
+::vaf::Result<::vaf::ConstDataPtr<const test::MyVector>> MyUsageConsumerModule::GetAllocated_my_data_element3() {
+  ::vaf::Result<::vaf::ConstDataPtr<const test::MyVector>> result_value{
+      ::vaf::Error{::vaf::ErrorCode::kNotOk, "No sample available"}};
+  ::vaf::ConstDataPtr<const test::MyVector> sample{channel_test_my_data_element3_.Load()};
+  if (sample) {
+    result_value = ::vaf::Result<::vaf::ConstDataPtr<const test::MyVector>>{std::move(sample)};
+  }
+  return result_value;
+}
+
+test::MyVector MyUsageConsumerModule::Get_my_data_element3() {
+  test::MyVector return_value{};
+  const ::vaf::ConstDataPtr<const test::MyVector> sample{channel_test_my_data_element3_.Load()};
+  if (sample) {
+    return_value = *sample;
+  }
+  return return_value;
+}
+
+void MyUsageConsumerModule::RegisterDataElementHandler_my_data_element3(vaf::String owner, std::function<void(const ::vaf::ConstDataPtr<const test::MyVector>)>&& f) {
+  channel_test_my_data_element3_.AddHandler(owner, std::move(f));
+}
+
+
+// my_data_element4 is not used by the application modules mapped to this module, so it is not subscribed to
+::vaf::Result<::vaf::ConstDataPtr<const test::MyState>> MyUsageConsumerModule::GetAllocated_my_data_element4() {
+  return ::vaf::Result<::vaf::ConstDataPtr<const test::MyState>>{
+      ::vaf::Error{::vaf::ErrorCode::kNotOk, "my_data_element4 is not used"}};
+}
+
+test::MyState MyUsageConsumerModule::Get_my_data_element4() {
+  return test::MyState{};
+}
+
+void MyUsageConsumerModule::RegisterDataElementHandler_my_data_element4(vaf::String owner, std::function<void(const ::vaf::ConstDataPtr<const test::MyState>)>&& f) {
+  static_cast<void>(owner);
+  static_cast<void>(f);
+}
+
+
+
+::vaf::Future<void> MyUsageConsumerModule::MyVoidOperation(const std::uint64_t& in) {
+  ::vaf::Future<void> return_value;
+  void* call_context = pending_calls_test_MyVoidOperation_.Begin(return_value);
+  if (call_context == nullptr) {
+    return return_value;
+  }
+  protobuf::interface::test::MyInterface::MyVoidOperation_in request;
+  protobuf::interface::test::MyInterface::MyVoidOperationInVafToProto(in, request);
+  const std::vector<std::uint8_t>& serialized = vaf::silkit::SerializeToBuffer(request);
+  VAF_TRACE_INSTANT("vaf.rpc", "MyVoidOperation call", "MyUsageConsumerModule");
+  rpc_client_test_MyVoidOperation_->Call(serialized, call_context);
+
+  return return_value;
+}
+// MyOperation is not used by the application modules mapped to this module, so it has no client
+::vaf::Future<test::MyOperation::Output> MyUsageConsumerModule::MyOperation(const std::uint64_t& in, const std::uint64_t& inout) {
+  static_cast<void>(in);
+  static_cast<void>(inout);
+  ::vaf::internal::Promise<test::MyOperation::Output> failed;
+  ::vaf::internal::SetVafErrorCodeToPromise(failed, ::vaf::Error{::vaf::ErrorCode::kNotOk, "MyOperation is not used"});
+  return ::vaf::internal::CreateVafFutureFromVafPromise<test::MyOperation::Output>(failed);
+}
+::vaf::Future<test::MyGetter::Output> MyUsageConsumerModule::MyGetter() {
+  // The field is answered from its latest notification, the provider is only called until the first one
+  if (channel_test_my_data_element1_.HasPublished()) {
+    ::vaf::internal::Promise<test::MyGetter::Output> cached;
+    cached.set_value(test::MyGetter::Output{*channel_test_my_data_element1_.Load()});
+    return ::vaf::internal::CreateVafFutureFromVafPromise<test::MyGetter::Output>(cached);
+  }
+  ::vaf::Future<test::MyGetter::Output> return_value;
+  void* call_context = pending_calls_test_MyGetter_.Begin(return_value);
+  if (call_context == nullptr) {
+    return return_value;
+  }
+  protobuf::interface::test::MyInterface::MyGetter_in request;
+  const std::vector<std::uint8_t>& serialized = vaf::silkit::SerializeToBuffer(request);
+  VAF_TRACE_INSTANT("vaf.rpc", "MyGetter call", "MyUsageConsumerModule");
+  rpc_client_test_MyGetter_->Call(serialized, call_context);
+
+  return return_value;
+}
+// MySetter is not used by the application modules mapped to this module, so it has no client
+::vaf::Future<void> MyUsageConsumerModule::MySetter(const std::uint64_t& a) {
+  static_cast<void>(a);
+  ::vaf::internal::Promise<void> failed;
+  ::vaf::internal::SetVafErrorCodeToPromise(failed, ::vaf::Error{::vaf::ErrorCode::kNotOk, "MySetter is not used"});
+  return ::vaf::internal::CreateVafFutureFromVafPromise<void>(failed);
+}
+
+} // namespace test
@@ -0,0 +1,149 @@
+/*!********************************************************************************************************************
+ *  COPYRIGHT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  Copyright (c) 2024-2026 by Vector Informatik GmbH. All rights reserved.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -----------------------------------------------------------------------------------------------------------------*/
+/*!        \file  participant.cpp
+ *         \brief
+ *
+ *********************************************************************************************************************/
+
+#include "vaf/silkit/participant.h"
+
+#include <condition_variable>
+#include <cstdlib>
+#include <memory>
+#include <mutex>
+
+namespace vaf {
+namespace silkit {
+
+namespace {
+
+// Hands the simulation steps of SIL Kit to the executor thread, each step grants the time slots that start in it
+class VirtualTimeSource final : public vaf::TimeSource {
+ public:
+  explicit VirtualTimeSource(SilKit::Services::Orchestration::ITimeSyncService& time_sync) : time_sync_{time_sync} {}
+
+  // Called by SIL Kit at the start of every simulation step
+  void BeginStep(std::chrono::nanoseconds now, std::chrono::nanoseconds duration) {
+    {
+      std::lock_guard<std::mutex> lock{mutex_};
+      step_end_ = now + duration;
+      step_granted_ = true;
+    }
+    condition_.notify_all();
+  }
+
+  bool WaitUntil(std::chrono::nanoseconds time) override {
+    std::unique_lock<std::mutex> lock{mutex_};
+    while (!interrupted_) {
+      if (step_granted_) {
+        if (time < step_end_) {
+          return true;
+        }
+        // The executor is done with the current step, SIL Kit may call BeginStep from within the completion
+        step_granted_ = false;
+        completing_ = true;
+        lock.unlock();
+        time_sync_.CompleteSimulationStep();
+        lock.lock();
+        completing_ = false;
+        condition_.notify_all();
+      }
+      condition_.wait(lock, [this]() { return step_granted_ || interrupted_; });
+    }
+    return false;
+  }
+
+  void Interrupt() override {
+    std::unique_lock<std::mutex> lock{mutex_};
+    interrupted_ = true;
+    condition_.notify_all();
+    // The time synchronization service must outlive a running completion
+    condition_.wait(lock, [this]() { return !completing_; });
+  }
+
+ private:
+  SilKit::Services::Orchestration::ITimeSyncService& time_sync_;
+  std::mutex mutex_{};
+  std::condition_variable condition_{};
+  std::chrono::nanoseconds step_end_{0};
+  bool step_granted_{false};
+  bool completing_{false};
+  bool interrupted_{false};
+};
+
+std::mutex participant_mutex{};
+std::unique_ptr<SilKit::IParticipant> participant{};
+std::shared_ptr<VirtualTimeSource> virtual_time_source{};
+
+void CreateParticipantLocked(const std::string& name) {
+  if (participant) {
+    return;
+  }
+  const char* value = std::getenv("SILKIT_REGISTRY_URI");
+  const auto registry_uri = (value != nullptr) ? std::string(value) : "silkit://localhost:8501";
+
+  const std::string participant_config_text = R"(
+  Description: My participant configuration
+  Logging:
+      Sinks:
+      - Type: Stdout
+        Level: Info
+  )";
+  auto config = SilKit::Config::ParticipantConfigurationFromString(participant_config_text);
+  participant = SilKit::CreateParticipant(config, name, registry_uri);
+}
+
+}  // namespace
+
+void CreateParticipant(const std::string& name) {
+  std::lock_guard<std::mutex> lock{participant_mutex};
+  CreateParticipantLocked(name);
+}
+
+SilKit::IParticipant& GetParticipant() {
+  std::lock_guard<std::mutex> lock{participant_mutex};
+  CreateParticipantLocked("VafParticipant");
+  return *participant;
+}
+
+std::shared_ptr<vaf::TimeSource> CreateVirtualTimeSource(std::chrono::nanoseconds step_duration) {
+  std::lock_guard<std::mutex> lock{participant_mutex};
+  CreateParticipantLocked("VafParticipant");
+  auto* lifecycle = participant->CreateLifecycleService(
+      SilKit::Services::Orchestration::LifecycleConfiguration{SilKit::Services::Orchestration::OperationMode::Autonomous});
+  auto* time_sync = lifecycle->CreateTimeSyncService();
+  virtual_time_source = std::make_shared<VirtualTimeSource>(*time_sync);
+  time_sync->SetSimulationStepHandlerAsync(
+      [time_source = virtual_time_source.get()](std::chrono::nanoseconds now, std::chrono::nanoseconds duration) {
+        time_source->BeginStep(now, duration);
+      },
+      step_duration);
+  // The lifecycle runs on the threads of SIL Kit until the participant is destroyed
+  static_cast<void>(lifecycle->StartLifecycle());
+  return virtual_time_source;
+}
+
+void DestroyParticipant() noexcept {
+  std::unique_ptr<SilKit::IParticipant> destroyed{};
+  std::shared_ptr<VirtualTimeSource> time_source{};
+  {
+    std::lock_guard<std::mutex> lock{participant_mutex};
+    destroyed = std::move(participant);
+    time_source = std::move(virtual_time_source);
+  }
+  if (time_source) {
+    // Without the participant the time does not advance anymore, the executor stops executing time slots
+    time_source->Interrupt();
+  }
+}
+
+} // namespace silkit
+} // namespace vaf
@@ -0,0 +1,65 @@
+/*!********************************************************************************************************************
+ *  COPYRIGHT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  Copyright (c) 2024-2026 by Vector Informatik GmbH. All rights reserved.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -----------------------------------------------------------------------------------------------------------------*/
+/*!        \file  participant.h
+ *         \brief
+ *
+ *********************************************************************************************************************/
+
+#ifndef VAF_SILKIT_PARTICIPANT_H
+#define VAF_SILKIT_PARTICIPANT_H
+
+#include <chrono>
+#include <memory>
+#include <string>
+
+#include "silkit/SilKit.hpp"
+#include "vaf/executor.h"
+
+namespace vaf {
+namespace silkit {
+
+/*!
+ * \brief Creates the SIL Kit participant shared by all SIL Kit platform modules of this executable.
+ * The executable controller calls this once before the modules are started, so there is only one registry
+ * connection per executable. Further calls have no effect. The registry URI is taken from SILKIT_REGISTRY_URI.
+ * \param name The participant name, usually the name of the executable
+ */
+void CreateParticipant(const std::string& name);
+
+/*!
+ * \brief Returns the shared participant.
+ * If the executable controller did not create it, it is created under a default name.
+ * \return The shared participant
+ */
+SilKit::IParticipant& GetParticipant();
+
+/*!
+ * \brief Creates a time source that lets the executor follow the virtual time of the SIL Kit simulation.
+ * Starts an autonomous lifecycle with time synchronization on the shared participant. Every simulation step grants the
+ * executor time slot that starts in it, and the step is only completed once the executor waits for a later time slot.
+ * So the simulation runs as fast as the tasks allow, and the tasks of a time slot always see the same simulation step.
+ * Called by the executable controller before the executor is created, if the executable uses the SIL Kit virtual
+ * time. Must only be called once.
+ * \param step_duration Duration of one simulation step, the period of the executor
+ * \return The time source to pass to the executor
+ */
+std::shared_ptr<vaf::TimeSource> CreateVirtualTimeSource(std::chrono::nanoseconds step_duration);
+
+/*!
+ * \brief Destroys the shared participant together with all its publishers, subscribers, clients and servers.
+ * Called by the executable controller on shutdown. A virtual time source stops granting time slots.
+ */
+void DestroyParticipant() noexcept;
+
+} // namespace silkit
+} // namespace vaf
+
+#endif // VAF_SILKIT_PARTICIPANT_H
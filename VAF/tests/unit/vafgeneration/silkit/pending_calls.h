@@ -0,0 +1,168 @@
+/*!********************************************************************************************************************
+ *  COPYRIGHT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  Copyright (c) 2024-2026 by Vector Informatik GmbH. All rights reserved.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -----------------------------------------------------------------------------------------------------------------*/
+/*!        \file  pending_calls.h
+ *         \brief
+ *
+ *********************************************************************************************************************/
+
+#ifndef VAF_SILKIT_PENDING_CALLS_H
+#define VAF_SILKIT_PENDING_CALLS_H
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "vaf/error_domain.h"
+#include "vaf/future.h"
+#include "vaf/internal/promise.h"
+
+namespace vaf {
+namespace silkit {
+
+/*!
+ * \brief Period of the task that fails the timed out calls, a quarter of the timeout in whole executor time slots.
+ * A call so fails at most a quarter of the timeout late, instead of up to twice the timeout after it started.
+ * \param timeout Timeout of the calls
+ * \param running_period Period of one time slot of the module executor
+ */
+inline std::chrono::microseconds RpcTimeoutSweepPeriod(std::chrono::nanoseconds timeout,
+                                                       std::chrono::microseconds running_period) {
+  const std::chrono::microseconds quarter{std::chrono::duration_cast<std::chrono::microseconds>(timeout / 4)};
+  const std::chrono::microseconds::rep time_slots{quarter / running_period};
+  return running_period * (time_slots > 0 ? time_slots : 1);
+}
+
+/*!
+ * \brief Bounded set of the calls of one RPC client that wait for their reply.
+ * Each call occupies one of max_in_flight slots that are allocated once, so a call fails right away instead of queueing
+ * when the server falls behind. The slot index and a generation counter are passed to SIL Kit as user context, so a
+ * reply that arrives after its call timed out or was cancelled is recognized and dropped.
+ */
+template <typename T>
+class PendingCalls {
+ public:
+  PendingCalls(std::size_t max_in_flight, std::chrono::nanoseconds timeout)
+      : timeout_{timeout}, slots_(max_in_flight < kMaxSlots ? max_in_flight : kMaxSlots) {}
+
+  PendingCalls(const PendingCalls&) = delete;
+  PendingCalls& operator=(const PendingCalls&) = delete;
+
+  /*!
+   * \brief Reserves a slot for a new call.
+   * \param future Receives the future that completes with the reply.
+   * \return The user context to pass to IRpcClient::Call, or nullptr if all slots are in use. The future then already
+   *         holds an error.
+   */
+  void* Begin(vaf::Future<T>& future) {
+    std::lock_guard<std::mutex> lock{mutex_};
+    for (std::size_t i{0}; i < slots_.size(); ++i) {
+      const std::size_t index{(next_ + i) % slots_.size()};
+      Slot& slot = slots_[index];
+      if (!slot.busy) {
+        slot.busy = true;
+        slot.generation = slot.generation < kGenerationMask ? slot.generation + 1 : 1;
+        slot.promise = vaf::internal::Promise<T>{};
+        slot.deadline = std::chrono::steady_clock::now() + timeout_;
+        future = slot.promise.get_future();
+        next_ = index + 1;
+        return ToContext(index, slot.generation);
+      }
+    }
+    vaf::internal::Promise<T> rejected{};
+    rejected.SetError(vaf::Error{vaf::ErrorCode::kNotOk, "Too many pending calls"});
+    future = rejected.get_future();
+    return nullptr;
+  }
+
+  /*!
+   * \brief Frees the slot of a call that got its reply.
+   * \return The promise to complete, or an empty optional if the call already timed out or was cancelled.
+   */
+  std::optional<vaf::internal::Promise<T>> Complete(void* context) {
+    const std::uintptr_t value{reinterpret_cast<std::uintptr_t>(context)};
+    const std::size_t index{static_cast<std::size_t>(value & kIndexMask)};
+    std::lock_guard<std::mutex> lock{mutex_};
+    if (index >= slots_.size() || !slots_[index].busy || slots_[index].generation != (value >> kIndexBits)) {
+      return std::nullopt;
+    }
+    return Release(slots_[index]);
+  }
+
+  // Fails the calls that are pending longer than the timeout, a timeout of zero disables this
+  void ExpireTimedOut() {
+    if (timeout_ == std::chrono::nanoseconds::zero()) {
+      return;
+    }
+    const std::chrono::steady_clock::time_point now{std::chrono::steady_clock::now()};
+    FailIf([now](const Slot& slot) { return slot.deadline <= now; },
+           vaf::Error{vaf::ErrorCode::kNotOk, "Rpc call timed out"});
+  }
+
+  // Fails all pending calls, e.g. when the module stops
+  void CancelAll() {
+    FailIf([](const Slot&) { return true; }, vaf::Error{vaf::ErrorCode::kNotOk, "Rpc call cancelled"});
+  }
+
+ private:
+  static constexpr std::size_t kIndexBits{16};
+  static constexpr std::size_t kMaxSlots{std::size_t{1} << kIndexBits};
+  static constexpr std::uintptr_t kIndexMask{kMaxSlots - 1};
+  static constexpr std::uintptr_t kGenerationMask{~std::uintptr_t{0} >> kIndexBits};
+
+  struct Slot {
+    vaf::internal::Promise<T> promise{};
+    std::chrono::steady_clock::time_point deadline{};
+    std::uintptr_t generation{0};
+    bool busy{false};
+  };
+
+  static void* ToContext(std::size_t index, std::uintptr_t generation) {
+    // Generations start at 1, so the context is never nullptr
+    return reinterpret_cast<void*>((generation << kIndexBits) | index);
+  }
+
+  static vaf::internal::Promise<T> Release(Slot& slot) {
+    slot.busy = false;
+    return std::move(slot.promise);
+  }
+
+  // The promises are completed outside the lock, so continuations can start new calls
+  template <typename Predicate>
+  void FailIf(Predicate predicate, const vaf::Error& error) {
+    for (std::size_t index{0}; index < slots_.size(); ++index) {
+      std::optional<vaf::internal::Promise<T>> promise{};
+      {
+        std::lock_guard<std::mutex> lock{mutex_};
+        Slot& slot = slots_[index];
+        if (slot.busy && predicate(slot)) {
+          promise = Release(slot);
+        }
+      }
+      if (promise) {
+        promise->SetError(error);
+      }
+    }
+  }
+
+  const std::chrono::nanoseconds timeout_;
+  std::mutex mutex_{};
+  std::vector<Slot> slots_;
+  std::size_t next_{0};
+};
+
+} // namespace silkit
+} // namespace vaf
+
+#endif // VAF_SILKIT_PENDING_CALLS_H
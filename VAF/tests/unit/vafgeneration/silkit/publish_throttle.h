@@ -0,0 +1,94 @@
+/*!********************************************************************************************************************
+ *  COPYRIGHT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  Copyright (c) 2024-2026 by Vector Informatik GmbH. All rights reserved.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -----------------------------------------------------------------------------------------------------------------*/
+/*!        \file  publish_throttle.h
+ *         \brief
+ *
+ *********************************************************************************************************************/
+
+#ifndef VAF_SILKIT_PUBLISH_THROTTLE_H
+#define VAF_SILKIT_PUBLISH_THROTTLE_H
+
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace vaf {
+namespace silkit {
+
+/*!
+ * \brief Decides which serialized samples of one data element a publisher sends.
+ * With publish on change, a sample that equals the last published one is not sent. With a minimum interval, a sample
+ * offered earlier than the interval after the last publish is held back and sent by Flush, so the latest value still
+ * reaches the subscribers. Samples are compared in their serialized form, as VAF data types have no equality operators.
+ */
+class PublishThrottle {
+ public:
+  PublishThrottle(bool publish_on_change, std::chrono::nanoseconds min_interval)
+      : publish_on_change_{publish_on_change}, min_interval_{min_interval} {}
+
+  PublishThrottle(const PublishThrottle&) = delete;
+  PublishThrottle& operator=(const PublishThrottle&) = delete;
+
+  // Calls publish with the sample unless it is unchanged or the minimum interval has not passed yet
+  template <typename Publish>
+  void Offer(const std::vector<std::uint8_t>& sample, Publish&& publish) {
+    std::lock_guard<std::mutex> lock{mutex_};
+    if (publish_on_change_ && has_last_ && (sample == last_)) {
+      // The subscribers already have this value, a held back sample is outdated
+      has_pending_ = false;
+      return;
+    }
+    const std::chrono::steady_clock::time_point now{std::chrono::steady_clock::now()};
+    if (has_last_ && ((now - last_time_) < min_interval_)) {
+      pending_.assign(sample.begin(), sample.end());
+      has_pending_ = true;
+      return;
+    }
+    publish(sample);
+    last_.assign(sample.begin(), sample.end());
+    Published(now);
+  }
+
+  // Calls publish with the held back sample once the minimum interval has passed, called periodically by the module
+  template <typename Publish>
+  void Flush(Publish&& publish) {
+    std::lock_guard<std::mutex> lock{mutex_};
+    const std::chrono::steady_clock::time_point now{std::chrono::steady_clock::now()};
+    if (!has_pending_ || ((now - last_time_) < min_interval_)) {
+      return;
+    }
+    publish(static_cast<const std::vector<std::uint8_t>&>(pending_));
+    last_.swap(pending_);
+    Published(now);
+  }
+
+ private:
+  void Published(std::chrono::steady_clock::time_point now) {
+    last_time_ = now;
+    has_last_ = true;
+    has_pending_ = false;
+  }
+
+  const bool publish_on_change_;
+  const std::chrono::nanoseconds min_interval_;
+  std::mutex mutex_{};
+  std::vector<std::uint8_t> last_{};
+  std::vector<std::uint8_t> pending_{};
+  std::chrono::steady_clock::time_point last_time_{};
+  bool has_last_{false};
+  bool has_pending_{false};
+};
+
+} // namespace silkit
+} // namespace vaf
+
+#endif // VAF_SILKIT_PUBLISH_THROTTLE_H
@@ -0,0 +1,67 @@
+/*!********************************************************************************************************************
+ *  COPYRIGHT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  Copyright (c) 2024-2026 by Vector Informatik GmbH. All rights reserved.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -----------------------------------------------------------------------------------------------------------------*/
+/*!        \file  reception_arena.h
+ *         \brief
+ *
+ *********************************************************************************************************************/
+
+#ifndef VAF_SILKIT_RECEPTION_ARENA_H
+#define VAF_SILKIT_RECEPTION_ARENA_H
+
+#include <array>
+#include <cstddef>
+
+#include <google/protobuf/arena.h>
+
+namespace vaf {
+namespace silkit {
+
+/*!
+ * \brief Arena for parsing the messages received by one subscriber.
+ * The arena starts with a block inside this object, so messages that fit into it are parsed without any heap
+ * allocation. Larger messages get additional blocks from the heap. Reset frees the message and these blocks after each
+ * message. SIL Kit calls the reception handler of a subscriber from one thread at a time, so no lock is needed.
+ */
+class ReceptionArena {
+ public:
+  ReceptionArena() : arena_{Options(initial_block_)} {}
+
+  ReceptionArena(const ReceptionArena&) = delete;
+  ReceptionArena& operator=(const ReceptionArena&) = delete;
+
+  // Creates an empty message on the arena, valid until Reset is called
+  template <typename Message>
+  Message* Create() {
+    return google::protobuf::Arena::Create<Message>(&arena_);
+  }
+
+  // Destroys all messages created since the last reset
+  void Reset() { arena_.Reset(); }
+
+ private:
+  static constexpr std::size_t kInitialBlockSize{4096};
+
+  static google::protobuf::ArenaOptions Options(std::array<char, kInitialBlockSize>& initial_block) {
+    google::protobuf::ArenaOptions options{};
+    options.initial_block = initial_block.data();
+    options.initial_block_size = initial_block.size();
+    return options;
+  }
+
+  // Declared before the arena, which uses it from construction on
+  alignas(std::max_align_t) std::array<char, kInitialBlockSize> initial_block_{};
+  google::protobuf::Arena arena_;
+};
+
+} // namespace silkit
+} // namespace vaf
+
+#endif // VAF_SILKIT_RECEPTION_ARENA_H
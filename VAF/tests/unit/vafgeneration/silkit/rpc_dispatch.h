@@ -0,0 +1,137 @@
+/*!********************************************************************************************************************
+ *  COPYRIGHT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  Copyright (c) 2024-2026 by Vector Informatik GmbH. All rights reserved.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -----------------------------------------------------------------------------------------------------------------*/
+/*!        \file  rpc_dispatch.h
+ *         \brief
+ *
+ *********************************************************************************************************************/
+
+#ifndef VAF_SILKIT_RPC_DISPATCH_H
+#define VAF_SILKIT_RPC_DISPATCH_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace vaf {
+namespace silkit {
+
+/*!
+ * \brief Bounds the calls of one operation that wait for or run in the executor of a provider module.
+ * A call beyond the limit is not answered and fails at the consumer once it times out, so a slow handler does not
+ * queue calls without bound.
+ */
+class RpcCallLimit {
+ public:
+  explicit RpcCallLimit(std::size_t limit) noexcept : limit_{limit} {}
+
+  RpcCallLimit(const RpcCallLimit&) = delete;
+  RpcCallLimit& operator=(const RpcCallLimit&) = delete;
+
+  // Reserves a place for a call, false if limit calls are pending
+  bool TryAcquire() noexcept {
+    std::size_t pending{pending_.load(std::memory_order_relaxed)};
+    while (pending < limit_) {
+      if (pending_.compare_exchange_weak(pending, pending + 1U, std::memory_order_relaxed)) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  // Frees the place of a call once it is answered
+  void Release() noexcept { pending_.fetch_sub(1U, std::memory_order_relaxed); }
+
+ private:
+  const std::size_t limit_;
+  std::atomic<std::size_t> pending_{0U};
+};
+
+/*!
+ * \brief Worker threads of a provider module that run the handler of one operation.
+ * The SIL Kit thread that receives a call only queues it, so a slow handler neither blocks the other operations and
+ * subscriptions of the participant nor limits the calls to one at a time. The queue is allocated once, a call that
+ * finds it full is not answered and fails at the consumer once it times out.
+ */
+class RpcWorkerPool {
+ public:
+  RpcWorkerPool(std::size_t threads, std::size_t queue_size) : queue_(queue_size) {
+    threads_.reserve(threads);
+    for (std::size_t i{0U}; i < threads; ++i) {
+      threads_.emplace_back([this]() { Run(); });
+    }
+  }
+
+  RpcWorkerPool(const RpcWorkerPool&) = delete;
+  RpcWorkerPool& operator=(const RpcWorkerPool&) = delete;
+
+  // Waits for the running calls, the queued ones are not answered
+  ~RpcWorkerPool() {
+    {
+      std::lock_guard<std::mutex> lock{mutex_};
+      exit_requested_ = true;
+    }
+    ready_.notify_all();
+    for (std::thread& thread : threads_) {
+      thread.join();
+    }
+  }
+
+  // Queues a call for the next free worker thread, false if the queue is full
+  bool TryPost(std::function<void()> call) {
+    {
+      std::lock_guard<std::mutex> lock{mutex_};
+      if (queued_ == queue_.size()) {
+        return false;
+      }
+      queue_[(head_ + queued_) % queue_.size()] = std::move(call);
+      ++queued_;
+    }
+    ready_.notify_one();
+    return true;
+  }
+
+ private:
+  void Run() {
+    std::unique_lock<std::mutex> lock{mutex_};
+    while (true) {
+      ready_.wait(lock, [this]() { return exit_requested_ || (queued_ != 0U); });
+      if (exit_requested_) {
+        return;
+      }
+      std::function<void()> call{std::move(queue_[head_])};
+      queue_[head_] = nullptr;
+      head_ = (head_ + 1U) % queue_.size();
+      --queued_;
+      lock.unlock();
+      call();
+      lock.lock();
+    }
+  }
+
+  std::mutex mutex_{};
+  std::condition_variable ready_{};
+  // Ring buffer of the queued calls, starting at head_
+  std::vector<std::function<void()>> queue_;
+  std::size_t head_{0U};
+  std::size_t queued_{0U};
+  bool exit_requested_{false};
+  std::vector<std::thread> threads_{};
+};
+
+} // namespace silkit
+} // namespace vaf
+
+#endif // VAF_SILKIT_RPC_DISPATCH_H
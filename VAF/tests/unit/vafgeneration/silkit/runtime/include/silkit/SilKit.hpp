@@ -0,0 +1,235 @@
+// Copyright (c) 2024-2026 by Vector Informatik GmbH. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+// Test double of the parts of the SIL Kit API used by the generated SIL Kit modules. The participant connects its
+// publishers to its subscribers and its Rpc clients to its servers in process, and delivers synchronously. Like SIL
+// Kit, it rejects a second controller of the same name and has no way to remove a controller again.
+
+#ifndef SILKIT_TEST_DOUBLE_SILKIT_HPP
+#define SILKIT_TEST_DOUBLE_SILKIT_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace SilKit {
+
+class ConfigurationError : public std::runtime_error {
+ public:
+  using std::runtime_error::runtime_error;
+};
+
+namespace Util {
+
+template <typename T>
+class Span {
+ public:
+  Span() = default;
+  Span(T* data, std::size_t size) : data_{data}, size_{size} {}
+  template <typename Container>
+  Span(const Container& container) : data_{container.data()}, size_{container.size()} {}
+
+  T* data() const { return data_; }
+  std::size_t size() const { return size_; }
+
+ private:
+  T* data_{nullptr};
+  std::size_t size_{0};
+};
+
+}  // namespace Util
+
+namespace Services {
+
+struct MatchingLabel {
+  enum class Kind : std::uint32_t { Optional = 1, Mandatory = 2 };
+};
+
+class Spec {
+ public:
+  Spec(std::string name, std::string media_type) : name_{std::move(name)}, media_type_{std::move(media_type)} {}
+  void AddLabel(const std::string& key, const std::string& value, MatchingLabel::Kind /*kind*/) {
+    labels_ += key + "=" + value + ";";
+  }
+  // Controllers only match if name, media type and labels are all equal
+  std::string Key() const { return name_ + "|" + media_type_ + "|" + labels_; }
+
+ private:
+  std::string name_;
+  std::string media_type_;
+  std::string labels_{};
+};
+
+namespace PubSub {
+
+using PubSubSpec = Spec;
+
+struct DataMessageEvent {
+  Util::Span<const std::uint8_t> data;
+};
+
+class IDataPublisher {
+ public:
+  virtual ~IDataPublisher() = default;
+  virtual void Publish(Util::Span<const std::uint8_t> data) = 0;
+};
+
+class IDataSubscriber {
+ public:
+  virtual ~IDataSubscriber() = default;
+};
+
+using DataMessageHandler = std::function<void(IDataSubscriber*, const DataMessageEvent&)>;
+
+}  // namespace PubSub
+
+namespace Rpc {
+
+using RpcSpec = Spec;
+
+enum class RpcCallStatus : std::uint8_t { Success, ServerNotReachable, UndefinedError, InternalServerError, Timeout };
+
+class IRpcClient;
+
+class IRpcCallHandle {
+ public:
+  IRpcCallHandle(IRpcClient* client, void* user_context) : client_{client}, user_context_{user_context} {}
+  IRpcClient* client_;
+  void* user_context_;
+};
+
+struct RpcCallEvent {
+  IRpcCallHandle* callHandle;
+  Util::Span<const std::uint8_t> argumentData;
+};
+
+struct RpcCallResultEvent {
+  void* userContext;
+  RpcCallStatus callStatus;
+  Util::Span<const std::uint8_t> resultData;
+};
+
+class IRpcClient {
+ public:
+  virtual ~IRpcClient() = default;
+  virtual void Call(Util::Span<const std::uint8_t> data, void* userContext = nullptr) = 0;
+};
+
+class IRpcServer {
+ public:
+  virtual ~IRpcServer() = default;
+  virtual void SubmitResult(IRpcCallHandle* callHandle, Util::Span<const std::uint8_t> resultData) = 0;
+};
+
+using RpcCallResultHandler = std::function<void(IRpcClient*, const RpcCallResultEvent&)>;
+using RpcCallHandler = std::function<void(IRpcServer*, const RpcCallEvent&)>;
+
+}  // namespace Rpc
+}  // namespace Services
+
+class IParticipant {
+ public:
+  Services::PubSub::IDataPublisher* CreateDataPublisher(const std::string& name,
+                                                        const Services::PubSub::PubSubSpec& spec,
+                                                        std::size_t /*history*/ = 0) {
+    return Add(publishers_, name, std::make_unique<Publisher>(*this, spec.Key()));
+  }
+
+  Services::PubSub::IDataSubscriber* CreateDataSubscriber(const std::string& name,
+                                                          const Services::PubSub::PubSubSpec& spec,
+                                                          Services::PubSub::DataMessageHandler handler) {
+    return Add(subscribers_, name, std::make_unique<Subscriber>(spec.Key(), std::move(handler)));
+  }
+
+  Services::Rpc::IRpcClient* CreateRpcClient(const std::string& name, const Services::Rpc::RpcSpec& spec,
+                                             Services::Rpc::RpcCallResultHandler handler) {
+    return Add(clients_, name, std::make_unique<Client>(*this, spec.Key(), std::move(handler)));
+  }
+
+  Services::Rpc::IRpcServer* CreateRpcServer(const std::string& name, const Services::Rpc::RpcSpec& spec,
+                                             Services::Rpc::RpcCallHandler handler) {
+    return Add(servers_, name, std::make_unique<Server>(spec.Key(), std::move(handler)));
+  }
+
+  std::size_t ControllerCount() const { return names_.size(); }
+
+ private:
+  class Publisher : public Services::PubSub::IDataPublisher {
+   public:
+    Publisher(IParticipant& participant, std::string key) : participant_{participant}, key_{std::move(key)} {}
+    void Publish(Util::Span<const std::uint8_t> data) override {
+      for (const auto& subscriber : participant_.subscribers_) {
+        if (subscriber->key_ == key_) {
+          subscriber->handler_(subscriber.get(), Services::PubSub::DataMessageEvent{data});
+        }
+      }
+    }
+
+   private:
+    IParticipant& participant_;
+    std::string key_;
+  };
+
+  class Subscriber : public Services::PubSub::IDataSubscriber {
+   public:
+    Subscriber(std::string key, Services::PubSub::DataMessageHandler handler)
+        : key_{std::move(key)}, handler_{std::move(handler)} {}
+    std::string key_;
+    Services::PubSub::DataMessageHandler handler_;
+  };
+
+  class Client : public Services::Rpc::IRpcClient {
+   public:
+    Client(IParticipant& participant, std::string key, Services::Rpc::RpcCallResultHandler handler)
+        : participant_{participant}, key_{std::move(key)}, handler_{std::move(handler)} {}
+    void Call(Util::Span<const std::uint8_t> data, void* userContext) override {
+      Services::Rpc::IRpcCallHandle call_handle{this, userContext};
+      for (const auto& server : participant_.servers_) {
+        if (server->key_ == key_) {
+          server->handler_(server.get(), Services::Rpc::RpcCallEvent{&call_handle, data});
+        }
+      }
+    }
+    IParticipant& participant_;
+    std::string key_;
+    Services::Rpc::RpcCallResultHandler handler_;
+  };
+
+  class Server : public Services::Rpc::IRpcServer {
+   public:
+    Server(std::string key, Services::Rpc::RpcCallHandler handler) : key_{std::move(key)}, handler_{std::move(handler)} {}
+    void SubmitResult(Services::Rpc::IRpcCallHandle* callHandle, Util::Span<const std::uint8_t> resultData) override {
+      auto* client = static_cast<Client*>(callHandle->client_);
+      client->handler_(client, Services::Rpc::RpcCallResultEvent{callHandle->user_context_,
+                                                                  Services::Rpc::RpcCallStatus::Success, resultData});
+    }
+    std::string key_;
+    Services::Rpc::RpcCallHandler handler_;
+  };
+
+  template <typename Controller>
+  Controller* Add(std::vector<std::unique_ptr<Controller>>& controllers, const std::string& name,
+                  std::unique_ptr<Controller> controller) {
+    if (!names_.insert(name).second) {
+      throw ConfigurationError{"A controller named " + name + " already exists"};
+    }
+    controllers.push_back(std::move(controller));
+    return controllers.back().get();
+  }
+
+  std::set<std::string> names_{};
+  std::vector<std::unique_ptr<Publisher>> publishers_{};
+  std::vector<std::unique_ptr<Subscriber>> subscribers_{};
+  std::vector<std::unique_ptr<Client>> clients_{};
+  std::vector<std::unique_ptr<Server>> servers_{};
+};
+
+}  // namespace SilKit
+
+#endif  // SILKIT_TEST_DOUBLE_SILKIT_HPP
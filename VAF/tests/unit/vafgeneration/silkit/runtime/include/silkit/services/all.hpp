@@ -0,0 +1,11 @@
+// Copyright (c) 2024-2026 by Vector Informatik GmbH. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+// Part of the SIL Kit test double, all of it is declared in silkit/SilKit.hpp
+
+#ifndef SILKIT_TEST_DOUBLE_SERVICES_ALL_HPP
+#define SILKIT_TEST_DOUBLE_SERVICES_ALL_HPP
+
+#include "silkit/SilKit.hpp"
+
+#endif  // SILKIT_TEST_DOUBLE_SERVICES_ALL_HPP
@@ -0,0 +1,81 @@
+// Copyright (c) 2024-2026 by Vector Informatik GmbH. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+// SIL Kit modules create their controllers once and can be started again after a stop. Samples and calls are only
+// handled while the modules are started, and neither is handled twice after a restart.
+
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+
+#include "demo/counter_consumer_module.h"
+#include "demo/counter_provider_module.h"
+#include "silkit/SilKit.hpp"
+#include "vaf/executable_controller_interface.h"
+#include "vaf/executor.h"
+#include "vaf/silkit/participant.h"
+
+namespace vaf {
+namespace silkit {
+
+SilKit::IParticipant& GetParticipant() {
+  static SilKit::IParticipant participant{};
+  return participant;
+}
+
+}  // namespace silkit
+}  // namespace vaf
+
+namespace {
+
+class Controller : public vaf::ExecutableControllerInterface {
+ public:
+  void ReportOperationalOfModule(vaf::String /*name*/) override { ++operational_; }
+  void SkipStartingOfModule(vaf::String /*name*/) override {}
+  void ReportErrorOfModule(const vaf::Error& /*error*/, vaf::String /*name*/, bool /*critical*/) override {
+    ++errors_;
+  }
+
+  int operational_{0};
+  int errors_{0};
+};
+
+}  // namespace
+
+int main() {
+  vaf::Executor executor{std::chrono::milliseconds{1}};
+  Controller controller{};
+  demo::CounterProviderModule provider{executor, "Provider", controller};
+  demo::CounterConsumerModule consumer{executor, "Consumer", controller};
+  int calls{0};
+  provider.RegisterOperationHandler_Add([&calls](const std::uint64_t& a) {
+    ++calls;
+    return demo::Add::Output{a + 40U};
+  });
+
+  bool ok{provider.Init().HasValue() && consumer.Init().HasValue()};
+  for (std::uint64_t round{1U}; round <= 3U; ++round) {
+    provider.Start();
+    consumer.Start();
+    static_cast<void>(provider.Set_count(round));
+    const std::uint64_t received{consumer.Get_count()};
+    const int calls_before{calls};
+    auto future = consumer.Add(round);
+    const bool answered{future.is_ready() && (future.get().sum == round + 40U)};
+    const int handled_calls{calls - calls_before};
+
+    provider.Stop();
+    consumer.Stop();
+    // Samples arriving while the consumer is stopped are dropped
+    static_cast<void>(provider.Set_count(100U));
+    const std::uint64_t received_stopped{consumer.Get_count()};
+
+    std::cout << "round=" << round << " received=" << received << " answered=" << answered
+              << " handled_calls=" << handled_calls << " received_stopped=" << received_stopped
+              << " controllers=" << vaf::silkit::GetParticipant().ControllerCount() << std::endl;
+    ok = ok && (received == round) && answered && (handled_calls == 1) && (received_stopped == round) &&
+         (vaf::silkit::GetParticipant().ControllerCount() == 4U);
+  }
+  std::cout << "operational=" << controller.operational_ << " errors=" << controller.errors_ << std::endl;
+  return (ok && (controller.operational_ == 6) && (controller.errors_ == 0)) ? 0 : 1;
+}
@@ -0,0 +1,122 @@
+// Copyright (c) 2024-2026 by Vector Informatik GmbH. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+// Compressed samples decompress to the original sample, and samples with a truncated header, a wrong uncompressed
+// size or a corrupt payload are rejected.
+
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <vector>
+
+#include "vaf/silkit/sample_compression.h"
+
+namespace {
+
+using vaf::silkit::Compression;
+
+int failures{0};
+
+void Check(bool condition, const char* what) {
+  if (!condition) {
+    std::cout << "failed: " << what << std::endl;
+    ++failures;
+  }
+}
+
+// Compressible sample with repeating content
+std::vector<std::uint8_t> Repeating(std::size_t size) {
+  std::vector<std::uint8_t> sample(size);
+  for (std::size_t i{0U}; i < size; ++i) {
+    sample[i] = static_cast<std::uint8_t>(i % 16U);
+  }
+  return sample;
+}
+
+// Incompressible sample from a linear congruential generator
+std::vector<std::uint8_t> Noise(std::size_t size) {
+  std::vector<std::uint8_t> sample(size);
+  std::uint32_t state{12345U};
+  for (std::uint8_t& byte : sample) {
+    state = (state * 1103515245U) + 12345U;
+    byte = static_cast<std::uint8_t>(state >> 24U);
+  }
+  return sample;
+}
+
+bool Decompresses(const std::vector<std::uint8_t>& message, std::vector<std::uint8_t>& sample) {
+  const std::uint8_t* data{message.data()};
+  std::size_t size{message.size()};
+  if (!vaf::silkit::DecompressSample(data, size)) {
+    return false;
+  }
+  sample.assign(data, data + size);
+  return true;
+}
+
+bool RoundTrips(const std::vector<std::uint8_t>& sample, Compression compression, std::size_t threshold,
+                Compression expected) {
+  // CompressSample reuses its buffer, so the message is copied before the next call
+  const std::vector<std::uint8_t> message{vaf::silkit::CompressSample(sample, compression, threshold)};
+  std::vector<std::uint8_t> decompressed{};
+  return (message.size() >= vaf::silkit::kCompressionHeaderSize) &&
+         (message[0] == static_cast<std::uint8_t>(expected)) && Decompresses(message, decompressed) &&
+         (decompressed == sample);
+}
+
+void CheckCompression(Compression compression, const char* name) {
+  std::cout << "checking " << name << std::endl;
+  const std::vector<std::uint8_t> repeating{Repeating(4096U)};
+  Check(RoundTrips(repeating, compression, 64U, compression), "compressed sample");
+  Check(vaf::silkit::CompressSample(repeating, compression, 64U).size() < repeating.size(), "compressed size");
+  Check(RoundTrips(Repeating(32U), compression, 64U, Compression::kStored), "sample below the threshold is stored");
+  Check(RoundTrips(Noise(256U), compression, 64U, Compression::kStored), "incompressible sample is stored");
+  Check(RoundTrips({}, compression, 0U, Compression::kStored), "empty sample is stored");
+
+  const std::vector<std::uint8_t> message{vaf::silkit::CompressSample(repeating, compression, 64U)};
+  std::vector<std::uint8_t> decompressed{};
+
+  std::vector<std::uint8_t> truncated_header(message.begin(), message.begin() + 4);
+  Check(!Decompresses(truncated_header, decompressed), "truncated header is rejected");
+
+  std::vector<std::uint8_t> wrong_size{message};
+  wrong_size[1] = static_cast<std::uint8_t>(wrong_size[1] + 1U);
+  Check(!Decompresses(wrong_size, decompressed), "wrong uncompressed size is rejected");
+
+  std::vector<std::uint8_t> implausible_size{message};
+  implausible_size[4] = 0x7FU;
+  Check(!Decompresses(implausible_size, decompressed), "implausible uncompressed size is rejected");
+
+  std::vector<std::uint8_t> corrupt{message};
+  for (std::size_t i{vaf::silkit::kCompressionHeaderSize}; i < corrupt.size(); ++i) {
+    corrupt[i] = 0xFFU;
+  }
+  Check(!Decompresses(corrupt, decompressed), "corrupt payload is rejected");
+
+  std::vector<std::uint8_t> truncated_payload(message.begin(), message.end() - 8);
+  Check(!Decompresses(truncated_payload, decompressed), "truncated payload is rejected");
+}
+
+}  // namespace
+
+int main() {
+  CheckCompression(Compression::kLz4, "lz4");
+  CheckCompression(Compression::kZstd, "zstd");
+
+  // A stored sample is handed out in place, its header size has to match the payload
+  const std::vector<std::uint8_t> stored{vaf::silkit::CompressSample(Repeating(16U), Compression::kLz4, 64U)};
+  const std::uint8_t* data{stored.data()};
+  std::size_t size{stored.size()};
+  Check(vaf::silkit::DecompressSample(data, size) && (data == stored.data() + vaf::silkit::kCompressionHeaderSize) &&
+            (size == 16U),
+        "stored sample is handed out in place");
+  std::vector<std::uint8_t> decompressed{};
+  std::vector<std::uint8_t> wrong_stored_size{stored};
+  wrong_stored_size[1] = 17U;
+  Check(!Decompresses(wrong_stored_size, decompressed), "wrong size of a stored sample is rejected");
+  std::vector<std::uint8_t> unknown{stored};
+  unknown[0] = 7U;
+  Check(!Decompresses(unknown, decompressed), "unknown compression is rejected");
+
+  return failures == 0 ? 0 : 1;
+}
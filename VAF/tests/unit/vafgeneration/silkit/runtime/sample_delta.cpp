@@ -0,0 +1,193 @@
+// Copyright (c) 2024-2026 by Vector Informatik GmbH. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+// Keyframes and deltas of flat and protobuf samples restore the published samples, also if a sample lacks a member of
+// its keyframe. Deltas of a keyframe that was not received and malformed deltas are rejected.
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "demo/counter_consumer_module.h"
+#include "demo/counter_provider_module.h"
+#include "silkit/SilKit.hpp"
+#include "vaf/executable_controller_interface.h"
+#include "vaf/executor.h"
+#include "vaf/silkit/flat_wire_format.h"
+#include "vaf/silkit/participant.h"
+#include "vaf/silkit/sample_delta.h"
+
+namespace vaf {
+namespace silkit {
+
+SilKit::IParticipant& GetParticipant() {
+  static SilKit::IParticipant participant{};
+  return participant;
+}
+
+}  // namespace silkit
+}  // namespace vaf
+
+namespace {
+
+using vaf::silkit::DeltaDecoder;
+using vaf::silkit::DeltaLayout;
+using vaf::silkit::DeltaSampleKind;
+using Message = std::vector<std::uint8_t>;
+
+int failures{0};
+
+void Check(bool condition, const std::string& what) {
+  if (!condition) {
+    std::cout << "failed: " << what << std::endl;
+    ++failures;
+  }
+}
+
+class Controller : public vaf::ExecutableControllerInterface {
+ public:
+  void ReportOperationalOfModule(vaf::String /*name*/) override {}
+  void SkipStartingOfModule(vaf::String /*name*/) override {}
+  void ReportErrorOfModule(const vaf::Error& /*error*/, vaf::String /*name*/, bool /*critical*/) override {}
+};
+
+// Records the messages of a data element as they are published, next to the subscriber of the consumer module
+class Capture {
+ public:
+  Capture(const std::string& data_element, const std::string& media_type) {
+    SilKit::Services::PubSub::PubSubSpec spec{"Counter_" + data_element, vaf::silkit::DeltaMediaType(media_type)};
+    spec.AddLabel("Instance", "Counter", SilKit::Services::MatchingLabel::Kind::Mandatory);
+    vaf::silkit::GetParticipant().CreateDataSubscriber(
+        "Capture_" + data_element, spec, [this](auto* /*subscriber*/, const auto& event) {
+          messages_.emplace_back(event.data.data(), event.data.data() + event.data.size());
+        });
+  }
+
+  const Message& At(std::size_t index) const { return messages_.at(index); }
+  const Message& Last() const { return messages_.back(); }
+  bool LastIs(DeltaSampleKind kind) const {
+    return !messages_.empty() && (Last()[0] == static_cast<std::uint8_t>(kind));
+  }
+
+ private:
+  std::vector<Message> messages_{};
+};
+
+bool Decodes(DeltaDecoder& decoder, const Message& message) {
+  const std::uint8_t* data{message.data()};
+  std::size_t size{message.size()};
+  return decoder.Decode(data, size);
+}
+
+bool Equal(const demo::Pose& lhs, const demo::Pose& rhs) {
+  return (lhs.x == rhs.x) && (lhs.y == rhs.y) && (lhs.z == rhs.z) && (lhs.w == rhs.w);
+}
+
+bool Equal(const demo::Track& lhs, const demo::Track& rhs) {
+  return (lhs.id == rhs.id) && (lhs.points == rhs.points) && (lhs.label == rhs.label);
+}
+
+demo::Track MakeTrack(std::uint64_t id, std::uint8_t point, std::uint64_t label) {
+  demo::Track track{};
+  track.id = id;
+  for (std::uint8_t i{0U}; i < 24U; ++i) {
+    track.points.push_back(static_cast<std::uint8_t>(point + i));
+  }
+  track.label = label;
+  return track;
+}
+
+// Publishes the samples in turn, the first and every keyframe_interval-th thereafter is a keyframe
+void CheckFlat(demo::CounterProviderModule& provider, demo::CounterConsumerModule& consumer, const Capture& capture) {
+  std::cout << "checking flat" << std::endl;
+  const std::vector<demo::Pose> poses{{1U, 2U, 3U, 4U}, {1U, 2U, 3U, 5U}, {9U, 2U, 3U, 5U}, {1U, 2U, 3U, 4U},
+                                      {6U, 7U, 8U, 9U}};
+  for (std::size_t i{0U}; i < poses.size(); ++i) {
+    static_cast<void>(provider.Set_pose(poses[i]));
+    const bool keyframe{(i % 4U) == 0U};
+    const std::string sample{"flat sample " + std::to_string(i)};
+    Check(capture.LastIs(keyframe ? DeltaSampleKind::kKeyframe : DeltaSampleKind::kDelta), sample + " kind");
+    Check(Equal(consumer.Get_pose(), poses[i]), sample + " round trip");
+    if (!keyframe) {
+      Check(capture.Last().size() < vaf::silkit::SerializeFlat(poses[i]).size(), sample + " is smaller");
+    }
+  }
+}
+
+void CheckProtobuf(demo::CounterProviderModule& provider, demo::CounterConsumerModule& consumer,
+                   const Capture& capture) {
+  std::cout << "checking protobuf" << std::endl;
+  const demo::Track keyframe{MakeTrack(7U, 10U, 3U)};
+  static_cast<void>(provider.Set_track(keyframe));
+  Check(capture.LastIs(DeltaSampleKind::kKeyframe), "protobuf keyframe kind");
+  Check(Equal(consumer.Get_track(), keyframe), "protobuf keyframe round trip");
+
+  const demo::Track changed{MakeTrack(8U, 10U, 3U)};
+  static_cast<void>(provider.Set_track(changed));
+  Check(capture.LastIs(DeltaSampleKind::kDelta), "protobuf delta kind");
+  Check(capture.Last().size() < 16U, "protobuf delta only holds the changed member");
+  Check(Equal(consumer.Get_track(), changed), "protobuf delta round trip");
+
+  // Proto3 does not write a member of value zero, so the sample lacks the label of the keyframe
+  const demo::Track without_label{MakeTrack(7U, 10U, 0U)};
+  static_cast<void>(provider.Set_track(without_label));
+  Check(capture.LastIs(DeltaSampleKind::kDelta), "protobuf delta without a member kind");
+  Check(Equal(consumer.Get_track(), without_label), "protobuf delta without a member round trip");
+}
+
+// Replays the published messages to a decoder of its own, like a consumer that started late
+void CheckRejected(const Message& keyframe, const Message& delta) {
+  std::cout << "checking rejections" << std::endl;
+  DeltaDecoder decoder{DeltaLayout::kProtobuf};
+  Check(!Decodes(decoder, delta), "delta without a keyframe is dropped");
+  Check(Decodes(decoder, keyframe) && Decodes(decoder, delta), "delta after its keyframe is applied");
+
+  Message other_keyframe{keyframe};
+  other_keyframe[1] = static_cast<std::uint8_t>(other_keyframe[1] + 1U);
+  Check(Decodes(decoder, other_keyframe), "other keyframe is received");
+  Check(!Decodes(decoder, delta), "delta of an unknown keyframe id is dropped");
+  Check(Decodes(decoder, keyframe), "keyframe is received again");
+
+  const Message truncated_header(delta.begin(), delta.begin() + 4);
+  Check(!Decodes(decoder, truncated_header), "truncated header is rejected");
+  Message unknown_kind{delta};
+  unknown_kind[0] = 7U;
+  Check(!Decodes(decoder, unknown_kind), "unknown kind is rejected");
+  const Message truncated_member(delta.begin(), delta.end() - 1);
+  Check(!Decodes(decoder, truncated_member), "truncated member is rejected");
+  Message descending_keys(delta.begin(), delta.begin() + vaf::silkit::kDeltaHeaderSize);
+  // Member 3 of size zero followed by member 1 of size zero
+  descending_keys.insert(descending_keys.end(), {3U, 0U, 1U, 0U});
+  Check(!Decodes(decoder, descending_keys), "members in descending order are rejected");
+  Message truncated_varint(delta.begin(), delta.begin() + vaf::silkit::kDeltaHeaderSize);
+  truncated_varint.push_back(0x80U);
+  Check(!Decodes(decoder, truncated_varint), "truncated key is rejected");
+
+  Check(Decodes(decoder, delta), "delta is applied after rejected deltas");
+}
+
+}  // namespace
+
+int main() {
+  vaf::Executor executor{std::chrono::milliseconds{1}};
+  Controller controller{};
+  demo::CounterProviderModule provider{executor, "Provider", controller};
+  demo::CounterConsumerModule consumer{executor, "Consumer", controller};
+  const bool initialized{provider.Init().HasValue() && consumer.Init().HasValue()};
+  Check(initialized, "modules are initialized");
+  provider.Start();
+  consumer.Start();
+  const Capture pose_capture{"pose", vaf::silkit::kFlatMediaType};
+  const Capture track_capture{"track", "application/protobuf"};
+
+  CheckFlat(provider, consumer, pose_capture);
+  CheckProtobuf(provider, consumer, track_capture);
+  CheckRejected(track_capture.At(0U), track_capture.At(1U));
+
+  provider.Stop();
+  consumer.Stop();
+  return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,131 @@
+/*!********************************************************************************************************************
+ *  COPYRIGHT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  Copyright (c) 2024-2026 by Vector Informatik GmbH. All rights reserved.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -----------------------------------------------------------------------------------------------------------------*/
+/*!        \file  sample_batch.h
+ *         \brief
+ *
+ *********************************************************************************************************************/
+
+#ifndef VAF_SILKIT_SAMPLE_BATCH_H
+#define VAF_SILKIT_SAMPLE_BATCH_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+#include <vector>
+
+namespace vaf {
+namespace silkit {
+
+/*!
+ * \brief Media type of the messages that carry the samples of several data elements of one module interface.
+ * Publishers and subscribers only match if both batch the data elements, see SILKITConnectionPoint::BatchDataElements.
+ */
+constexpr const char* kBatchMediaType{"application/vnd.vaf.batch; version=1"};
+
+// Header in front of every sample of a batch, a batch starts with kBatchMagic
+struct BatchRecordHeader {
+  std::uint16_t element;   //!< Index of the data element in its module interface.
+  std::uint16_t reserved;  //!< Always zero.
+  std::uint32_t size;      //!< Size of the serialized sample that follows.
+};
+
+// Written in the byte order of the provider, so a differing byte order is detected
+constexpr std::uint32_t kBatchMagic{0x42464156U};
+
+/*!
+ * \brief Collects the serialized samples that a provider module sets within one executor time slot.
+ * Add is called by the tasks that set the data elements and Flush by a periodic task of the module once per time slot.
+ * The buffer keeps its capacity, so batches of a steady size do not allocate.
+ */
+class SampleBatch {
+ public:
+  SampleBatch() = default;
+
+  SampleBatch(const SampleBatch&) = delete;
+  SampleBatch& operator=(const SampleBatch&) = delete;
+
+  // Appends a serialized sample of the data element with the given index
+  void Add(std::uint16_t element, const std::vector<std::uint8_t>& sample) {
+    std::lock_guard<std::mutex> lock{mutex_};
+    if (buffer_.empty()) {
+      Append(&kBatchMagic, sizeof(kBatchMagic));
+    }
+    const BatchRecordHeader header{element, 0U, static_cast<std::uint32_t>(sample.size())};
+    Append(&header, sizeof(header));
+    Append(sample.data(), sample.size());
+  }
+
+  // Calls publish with the collected samples if there are any and starts a new batch
+  template <typename Publish>
+  void Flush(Publish&& publish) {
+    std::lock_guard<std::mutex> lock{mutex_};
+    if (buffer_.empty()) {
+      return;
+    }
+    publish(static_cast<const std::vector<std::uint8_t>&>(buffer_));
+    buffer_.clear();
+  }
+
+ private:
+  void Append(const void* data, std::size_t size) {
+    if (size == 0U) {
+      // The data of an empty vector may be nullptr, which memcpy does not accept
+      return;
+    }
+    const std::size_t offset{buffer_.size()};
+    buffer_.resize(offset + size);
+    std::memcpy(buffer_.data() + offset, data, size);
+  }
+
+  std::mutex mutex_{};
+  std::vector<std::uint8_t> buffer_{};
+};
+
+/*!
+ * \brief Calls handle(element, data, size) for every sample of a received batch in the order they were added.
+ * The buffer of SIL Kit is not necessarily aligned, so the headers are copied out instead of reinterpreted.
+ * \param data The received data
+ * \param size The size of the received data
+ * \param handle The function to call for every sample
+ * \return False if the batch is malformed, the samples after the malformed part are skipped
+ */
+template <typename Handle>
+bool ForEachBatchSample(const std::uint8_t* data, std::size_t size, Handle&& handle) {
+  std::uint32_t magic{0U};
+  if (size < sizeof(magic)) {
+    return false;
+  }
+  std::memcpy(&magic, data, sizeof(magic));
+  if (magic != kBatchMagic) {
+    return false;
+  }
+  std::size_t offset{sizeof(magic)};
+  while (offset < size) {
+    BatchRecordHeader header{};
+    if ((size - offset) < sizeof(header)) {
+      return false;
+    }
+    std::memcpy(&header, data + offset, sizeof(header));
+    offset += sizeof(header);
+    if ((size - offset) < header.size) {
+      return false;
+    }
+    handle(header.element, data + offset, static_cast<std::size_t>(header.size));
+    offset += header.size;
+  }
+  return true;
+}
+
+} // namespace silkit
+} // namespace vaf
+
+#endif // VAF_SILKIT_SAMPLE_BATCH_H
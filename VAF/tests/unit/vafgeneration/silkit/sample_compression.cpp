@@ -0,0 +1,143 @@
+/*!********************************************************************************************************************
+ *  COPYRIGHT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  Copyright (c) 2024-2026 by Vector Informatik GmbH. All rights reserved.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -----------------------------------------------------------------------------------------------------------------*/
+/*!        \file  sample_compression.cpp
+ *         \brief
+ *
+ *********************************************************************************************************************/
+
+#include "vaf/silkit/sample_compression.h"
+
+#include <cstring>
+#include <limits>
+
+#include <lz4.h>
+
+namespace vaf {
+namespace silkit {
+
+namespace {
+
+constexpr std::size_t kLz4MaxRatio{255U};
+
+// Maximum size of the compressed sample, zero if the algorithm is not available
+std::size_t CompressBound(Compression compression, std::size_t size) {
+  switch (compression) {
+    case Compression::kLz4:
+      return static_cast<std::size_t>(LZ4_compressBound(static_cast<int>(size)));
+    default:
+      return 0U;
+  }
+}
+
+// Size of the compressed sample, zero if it could not be compressed
+std::size_t Compress(Compression compression, const std::uint8_t* data, std::size_t size, std::uint8_t* out,
+                     std::size_t capacity) {
+  switch (compression) {
+    case Compression::kLz4: {
+      const int compressed{LZ4_compress_default(reinterpret_cast<const char*>(data), reinterpret_cast<char*>(out),
+                                                static_cast<int>(size), static_cast<int>(capacity))};
+      return compressed > 0 ? static_cast<std::size_t>(compressed) : 0U;
+    }
+    default:
+      return 0U;
+  }
+}
+
+// Checks the uncompressed size in the header before the buffer is resized to it
+bool IsPlausibleSize(Compression compression, const std::uint8_t* data, std::size_t size,
+                     std::size_t uncompressed_size) {
+  switch (compression) {
+    case Compression::kLz4:
+      // LZ4 does not compress by more than this factor, its blocks do not hold their uncompressed size
+      static_cast<void>(data);
+      return uncompressed_size <= (size * kLz4MaxRatio);
+    default:
+      return false;
+  }
+}
+
+// Decompresses exactly uncompressed_size bytes
+bool Decompress(Compression compression, const std::uint8_t* data, std::size_t size, std::uint8_t* out,
+                std::size_t uncompressed_size) {
+  switch (compression) {
+    case Compression::kLz4:
+      return LZ4_decompress_safe(reinterpret_cast<const char*>(data), reinterpret_cast<char*>(out),
+                                 static_cast<int>(size), static_cast<int>(uncompressed_size)) ==
+             static_cast<int>(uncompressed_size);
+    default:
+      return false;
+  }
+}
+
+}  // namespace
+
+std::string CompressedMediaType(const char* media_type, Compression compression) {
+  return std::string{media_type} + (compression == Compression::kZstd ? "; compression=zstd" : "; compression=lz4");
+}
+
+const std::vector<std::uint8_t>& CompressSample(const std::vector<std::uint8_t>& sample, Compression compression,
+                                                std::size_t threshold) {
+  thread_local std::vector<std::uint8_t> buffer{};
+  const std::size_t size{sample.size()};
+  std::size_t compressed{0U};
+  if ((size >= threshold) && (size <= static_cast<std::size_t>(std::numeric_limits<int>::max()))) {
+    buffer.resize(kCompressionHeaderSize + CompressBound(compression, size));
+    compressed = Compress(compression, sample.data(), size, buffer.data() + kCompressionHeaderSize,
+                          buffer.size() - kCompressionHeaderSize);
+  }
+  if ((compressed == 0U) || (compressed >= size)) {
+    compression = Compression::kStored;
+    compressed = size;
+    buffer.resize(kCompressionHeaderSize + size);
+    if (size != 0U) {
+      std::memcpy(buffer.data() + kCompressionHeaderSize, sample.data(), size);
+    }
+  }
+  buffer.resize(kCompressionHeaderSize + compressed);
+  // The uncompressed size is little endian, so hosts of any byte order read it
+  buffer[0] = static_cast<std::uint8_t>(compression);
+  for (std::size_t i{0U}; i < 4U; ++i) {
+    buffer[1U + i] = static_cast<std::uint8_t>(static_cast<std::uint32_t>(size) >> (8U * i));
+  }
+  return buffer;
+}
+
+bool DecompressSample(const std::uint8_t*& data, std::size_t& size) {
+  thread_local std::vector<std::uint8_t> buffer{};
+  if (size < kCompressionHeaderSize) {
+    return false;
+  }
+  const auto compression = static_cast<Compression>(data[0]);
+  std::size_t uncompressed_size{0U};
+  for (std::size_t i{0U}; i < 4U; ++i) {
+    uncompressed_size |= static_cast<std::size_t>(data[1U + i]) << (8U * i);
+  }
+  const std::uint8_t* const payload{data + kCompressionHeaderSize};
+  const std::size_t payload_size{size - kCompressionHeaderSize};
+  if (compression == Compression::kStored) {
+    data = payload;
+    size = payload_size;
+    return payload_size == uncompressed_size;
+  }
+  if (!IsPlausibleSize(compression, payload, payload_size, uncompressed_size)) {
+    return false;
+  }
+  buffer.resize(uncompressed_size);
+  if (!Decompress(compression, payload, payload_size, buffer.data(), uncompressed_size)) {
+    return false;
+  }
+  data = buffer.data();
+  size = uncompressed_size;
+  return true;
+}
+
+} // namespace silkit
+} // namespace vaf
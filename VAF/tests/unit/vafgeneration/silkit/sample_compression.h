@@ -0,0 +1,66 @@
+/*!********************************************************************************************************************
+ *  COPYRIGHT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  Copyright (c) 2024-2026 by Vector Informatik GmbH. All rights reserved.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -----------------------------------------------------------------------------------------------------------------*/
+/*!        \file  sample_compression.h
+ *         \brief
+ *
+ *********************************************************************************************************************/
+
+#ifndef VAF_SILKIT_SAMPLE_COMPRESSION_H
+#define VAF_SILKIT_SAMPLE_COMPRESSION_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace vaf {
+namespace silkit {
+
+// Algorithm that compressed a sample, see DataElement::Compression
+enum class Compression : std::uint8_t {
+  kStored = 0U,  //!< The sample is sent as it is, as it is small or does not get smaller.
+  kLz4 = 1U,
+  kZstd = 2U
+};
+
+// Header in front of every sample of a data element with compression: the Compression, then the uncompressed size
+constexpr std::size_t kCompressionHeaderSize{5U};
+
+/*!
+ * \brief Media type of the samples of a data element with compression.
+ * The compression is appended to the media type of the serialized samples, so publishers and subscribers only match
+ * if both use the same setting.
+ */
+std::string CompressedMediaType(const char* media_type, Compression compression);
+
+/*!
+ * \brief Compresses a serialized sample.
+ * \param sample The serialized sample
+ * \param compression The algorithm, the sample is stored as it is if it is smaller than threshold or does not get
+ *        smaller
+ * \param threshold Size from which on samples are compressed
+ * \return The sample with the compression header, valid until the next call of the thread
+ */
+const std::vector<std::uint8_t>& CompressSample(const std::vector<std::uint8_t>& sample, Compression compression,
+                                                std::size_t threshold);
+
+/*!
+ * \brief Decompresses a sample written by CompressSample.
+ * \param data The received sample, set to the decompressed sample which is valid until the next call of the thread
+ * \param size The size of the received sample, set to the size of the decompressed sample
+ * \return False for malformed samples and algorithms the executable is built without
+ */
+bool DecompressSample(const std::uint8_t*& data, std::size_t& size);
+
+} // namespace silkit
+} // namespace vaf
+
+#endif // VAF_SILKIT_SAMPLE_COMPRESSION_H
@@ -0,0 +1,371 @@
+/*!********************************************************************************************************************
+ *  COPYRIGHT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  Copyright (c) 2024-2026 by Vector Informatik GmbH. All rights reserved.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -----------------------------------------------------------------------------------------------------------------*/
+/*!        \file  sample_delta.h
+ *         \brief
+ *
+ *********************************************************************************************************************/
+
+#ifndef VAF_SILKIT_SAMPLE_DELTA_H
+#define VAF_SILKIT_SAMPLE_DELTA_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace vaf {
+namespace silkit {
+
+// Kind of a sample of a data element with DataElement::DeltaKeyframeInterval, the first byte of the sample
+enum class DeltaSampleKind : std::uint8_t {
+  kKeyframe = 0U,  //!< The full serialized sample.
+  kDelta = 1U      //!< The members that differ from the keyframe.
+};
+
+// Header in front of every sample of a data element with delta publication: the kind, then the keyframe id
+constexpr std::size_t kDeltaHeaderSize{5U};
+
+// Serialization of the samples a delta is computed over
+enum class DeltaLayout : std::uint8_t {
+  kProtobuf = 0U,  //!< A data element message, the members are the fields of its value.
+  kFlat = 1U       //!< A flat sample, the members are blocks of kFlatDeltaBlockSize bytes.
+};
+
+constexpr std::size_t kFlatDeltaBlockSize{8U};
+
+/*!
+ * \brief Media type of the samples of a data element with delta publication.
+ * A subscriber without the setting cannot read the deltas, so publishers and subscribers only match if both use it.
+ */
+inline std::string DeltaMediaType(const std::string& media_type) { return media_type + "; delta=1"; }
+
+namespace internal {
+
+// Member of a serialized sample that a delta replaces as a whole
+struct DeltaMember {
+  std::uint32_t key;    //!< The field number or block index, ascending within a sample.
+  std::size_t offset;   //!< Offset of the member in the sample.
+  std::size_t size;     //!< Size of the member, never zero.
+};
+
+inline void WriteDeltaVarint(std::vector<std::uint8_t>& out, std::uint64_t value) {
+  while (value >= 0x80U) {
+    out.push_back(static_cast<std::uint8_t>(value | 0x80U));
+    value >>= 7U;
+  }
+  out.push_back(static_cast<std::uint8_t>(value));
+}
+
+inline bool ReadDeltaVarint(const std::uint8_t*& data, const std::uint8_t* end, std::uint64_t& value) {
+  value = 0U;
+  for (std::uint32_t shift{0U}; (data != end) && (shift < 64U); shift += 7U) {
+    const std::uint8_t byte{*data++};
+    value |= static_cast<std::uint64_t>(byte & 0x7FU) << shift;
+    if ((byte & 0x80U) == 0U) {
+      return true;
+    }
+  }
+  return false;
+}
+
+inline void WriteDeltaHeader(std::vector<std::uint8_t>& out, DeltaSampleKind kind, std::uint32_t keyframe_id) {
+  out.push_back(static_cast<std::uint8_t>(kind));
+  for (std::uint32_t i{0U}; i < 4U; ++i) {
+    out.push_back(static_cast<std::uint8_t>(keyframe_id >> (8U * i)));
+  }
+}
+
+/*!
+ * \brief Splits a serialized sample into its members.
+ * A protobuf sample is the field of the value of the data element, the members are the runs of fields with the same
+ * number within the value, as repeated fields are written one after the other. The fields are written in ascending
+ * order of their numbers, any other order is not split.
+ * \return False if the sample cannot be split, it is then only sent as keyframe
+ */
+inline bool SplitDeltaMembers(DeltaLayout layout, const std::uint8_t* data, std::size_t size,
+                              std::vector<DeltaMember>& members) {
+  members.clear();
+  if (layout == DeltaLayout::kFlat) {
+    for (std::size_t offset{0U}; offset < size; offset += kFlatDeltaBlockSize) {
+      const std::size_t block{(size - offset) < kFlatDeltaBlockSize ? (size - offset) : kFlatDeltaBlockSize};
+      members.push_back(DeltaMember{static_cast<std::uint32_t>(offset / kFlatDeltaBlockSize), offset, block});
+    }
+    return true;
+  }
+  const std::uint8_t* const begin{data};
+  const std::uint8_t* const end{data + size};
+  std::uint64_t value_size{0U};
+  // Field 1 of wire type LEN, the value
+  if ((size == 0U) || (*data++ != 0x0AU) || !ReadDeltaVarint(data, end, value_size) ||
+      (value_size != static_cast<std::uint64_t>(end - data))) {
+    return false;
+  }
+  while (data != end) {
+    const std::uint8_t* const field{data};
+    std::uint64_t tag{0U};
+    std::uint64_t length{0U};
+    if (!ReadDeltaVarint(data, end, tag) || ((tag >> 3U) == 0U) || ((tag >> 3U) > 0x1FFFFFFFU)) {
+      return false;
+    }
+    switch (tag & 0x7U) {
+      case 0U:
+        if (!ReadDeltaVarint(data, end, length)) {
+          return false;
+        }
+        length = 0U;
+        break;
+      case 1U:
+        length = 8U;
+        break;
+      case 2U:
+        if (!ReadDeltaVarint(data, end, length)) {
+          return false;
+        }
+        break;
+      case 5U:
+        length = 4U;
+        break;
+      default:
+        // Groups are not written by proto3
+        return false;
+    }
+    if (length > static_cast<std::uint64_t>(end - data)) {
+      return false;
+    }
+    data += length;
+    const auto key = static_cast<std::uint32_t>(tag >> 3U);
+    const auto offset = static_cast<std::size_t>(field - begin);
+    const auto field_size = static_cast<std::size_t>(data - field);
+    if (!members.empty() && (members.back().key == key)) {
+      members.back().size += field_size;
+    } else if (members.empty() || (members.back().key < key)) {
+      members.push_back(DeltaMember{key, offset, field_size});
+    } else {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Writes the prefix of a protobuf sample whose value has the given size
+inline void WriteDeltaPrefix(DeltaLayout layout, std::vector<std::uint8_t>& out, std::size_t value_size) {
+  if (layout == DeltaLayout::kProtobuf) {
+    out.push_back(0x0AU);
+    WriteDeltaVarint(out, value_size);
+  }
+}
+
+inline void AppendDeltaBytes(std::vector<std::uint8_t>& out, const std::uint8_t* data, std::size_t size) {
+  out.insert(out.end(), data, data + size);
+}
+
+}  // namespace internal
+
+/*!
+ * \brief Sends the serialized samples of one data element of a provider as deltas to the last keyframe.
+ * A delta holds the members of a sample that differ from the keyframe, each behind its key and size, and a member of
+ * size zero for each member of the keyframe that the sample does not have. Deltas refer to the keyframe instead of the
+ * previous sample, so a subscriber only needs the keyframe to apply them. A keyframe is sent every keyframe_interval
+ * samples and whenever a delta would not be smaller than the sample. The buffers keep their capacity, so samples of a
+ * steady size do not allocate.
+ */
+class DeltaEncoder {
+ public:
+  DeltaEncoder(DeltaLayout layout, std::uint32_t keyframe_interval)
+      : layout_{layout}, keyframe_interval_{keyframe_interval}, keyframe_id_{std::random_device{}()} {}
+
+  DeltaEncoder(const DeltaEncoder&) = delete;
+  DeltaEncoder& operator=(const DeltaEncoder&) = delete;
+
+  // Calls publish with the keyframe or delta of the serialized sample
+  template <typename Publish>
+  void Encode(const std::vector<std::uint8_t>& sample, Publish&& publish) {
+    std::lock_guard<std::mutex> lock{mutex_};
+    out_.clear();
+    const bool split{internal::SplitDeltaMembers(layout_, sample.data(), sample.size(), members_)};
+    if (!split || !has_keyframe_ || ((since_keyframe_ + 1U) >= keyframe_interval_) || !WriteDelta(sample)) {
+      WriteKeyframe(sample, split);
+    } else {
+      ++since_keyframe_;
+    }
+    publish(static_cast<const std::vector<std::uint8_t>&>(out_));
+  }
+
+ private:
+  // Writes the delta to the keyframe, false if it is not smaller than the sample
+  bool WriteDelta(const std::vector<std::uint8_t>& sample) {
+    internal::WriteDeltaHeader(out_, DeltaSampleKind::kDelta, keyframe_id_);
+    std::size_t k{0U};
+    std::size_t s{0U};
+    while (((k < keyframe_members_.size()) || (s < members_.size())) && (out_.size() < sample.size())) {
+      const bool from_keyframe{k < keyframe_members_.size()};
+      const bool from_sample{s < members_.size()};
+      if (from_sample && (!from_keyframe || (members_[s].key < keyframe_members_[k].key))) {
+        WriteMember(members_[s].key, sample.data() + members_[s].offset, members_[s].size);
+        ++s;
+      } else if (!from_sample || (keyframe_members_[k].key < members_[s].key)) {
+        WriteMember(keyframe_members_[k].key, nullptr, 0U);
+        ++k;
+      } else {
+        const internal::DeltaMember& old_member{keyframe_members_[k]};
+        const internal::DeltaMember& new_member{members_[s]};
+        if ((old_member.size != new_member.size) ||
+            (std::memcmp(keyframe_.data() + old_member.offset, sample.data() + new_member.offset, new_member.size) !=
+             0)) {
+          WriteMember(new_member.key, sample.data() + new_member.offset, new_member.size);
+        }
+        ++k;
+        ++s;
+      }
+    }
+    if (out_.size() < sample.size()) {
+      return true;
+    }
+    out_.clear();
+    return false;
+  }
+
+  void WriteMember(std::uint32_t key, const std::uint8_t* data, std::size_t size) {
+    internal::WriteDeltaVarint(out_, key);
+    internal::WriteDeltaVarint(out_, size);
+    internal::AppendDeltaBytes(out_, data, size);
+  }
+
+  void WriteKeyframe(const std::vector<std::uint8_t>& sample, bool split) {
+    ++keyframe_id_;
+    internal::WriteDeltaHeader(out_, DeltaSampleKind::kKeyframe, keyframe_id_);
+    internal::AppendDeltaBytes(out_, sample.data(), sample.size());
+    // A sample that cannot be split is no base for deltas, the next sample is sent as keyframe again
+    has_keyframe_ = split;
+    since_keyframe_ = 0U;
+    keyframe_.assign(sample.begin(), sample.end());
+    keyframe_members_.swap(members_);
+  }
+
+  const DeltaLayout layout_;
+  const std::uint32_t keyframe_interval_;
+  std::mutex mutex_{};
+  std::uint32_t keyframe_id_;
+  std::uint32_t since_keyframe_{0U};
+  bool has_keyframe_{false};
+  std::vector<std::uint8_t> keyframe_{};
+  std::vector<internal::DeltaMember> keyframe_members_{};
+  std::vector<internal::DeltaMember> members_{};
+  std::vector<std::uint8_t> out_{};
+};
+
+/*!
+ * \brief Restores the serialized samples of one data element of a consumer from keyframes and deltas.
+ * The last keyframe is kept and a delta is applied to it, deltas of another keyframe are dropped, e.g. for a consumer
+ * that started after the keyframe was sent. Called by the reception handler of the data element only, which SIL Kit
+ * does not call concurrently.
+ */
+class DeltaDecoder {
+ public:
+  explicit DeltaDecoder(DeltaLayout layout) : layout_{layout} {}
+
+  DeltaDecoder(const DeltaDecoder&) = delete;
+  DeltaDecoder& operator=(const DeltaDecoder&) = delete;
+
+  /*!
+   * \brief Restores a received sample.
+   * \param data The received sample, set to the serialized sample which is valid until the next call
+   * \param size The size of the received sample, set to the size of the serialized sample
+   * \return False for malformed samples and deltas of a keyframe that was not received
+   */
+  bool Decode(const std::uint8_t*& data, std::size_t& size) {
+    if (size < kDeltaHeaderSize) {
+      return false;
+    }
+    const auto kind = static_cast<DeltaSampleKind>(data[0]);
+    std::uint32_t keyframe_id{0U};
+    for (std::uint32_t i{0U}; i < 4U; ++i) {
+      keyframe_id |= static_cast<std::uint32_t>(data[1U + i]) << (8U * i);
+    }
+    const std::uint8_t* const payload{data + kDeltaHeaderSize};
+    const std::size_t payload_size{size - kDeltaHeaderSize};
+    if (kind == DeltaSampleKind::kKeyframe) {
+      keyframe_.assign(payload, payload + payload_size);
+      has_keyframe_ = internal::SplitDeltaMembers(layout_, keyframe_.data(), keyframe_.size(), keyframe_members_);
+      keyframe_id_ = keyframe_id;
+      data = keyframe_.data();
+      size = keyframe_.size();
+      return true;
+    }
+    if ((kind != DeltaSampleKind::kDelta) || !has_keyframe_ || (keyframe_id != keyframe_id_) ||
+        !Apply(payload, payload + payload_size)) {
+      return false;
+    }
+    data = out_.data() + begin_;
+    size = out_.size() - begin_;
+    return true;
+  }
+
+ private:
+  bool Apply(const std::uint8_t* data, const std::uint8_t* end) {
+    // The members are collected behind the space of the largest prefix, which is filled in once the size is known
+    constexpr std::size_t kMaxPrefixSize{11U};
+    out_.assign(kMaxPrefixSize, 0U);
+    std::size_t k{0U};
+    std::uint64_t previous_key{0U};
+    bool first{true};
+    while (data != end) {
+      std::uint64_t key{0U};
+      std::uint64_t member_size{0U};
+      if (!internal::ReadDeltaVarint(data, end, key) || !internal::ReadDeltaVarint(data, end, member_size) ||
+          (!first && (key <= previous_key)) || (member_size > static_cast<std::uint64_t>(end - data))) {
+        return false;
+      }
+      for (; (k < keyframe_members_.size()) && (keyframe_members_[k].key < key); ++k) {
+        AppendKeyframeMember(k);
+      }
+      if ((k < keyframe_members_.size()) && (keyframe_members_[k].key == key)) {
+        ++k;
+      }
+      internal::AppendDeltaBytes(out_, data, static_cast<std::size_t>(member_size));
+      data += member_size;
+      previous_key = key;
+      first = false;
+    }
+    for (; k < keyframe_members_.size(); ++k) {
+      AppendKeyframeMember(k);
+    }
+    prefix_.clear();
+    internal::WriteDeltaPrefix(layout_, prefix_, out_.size() - kMaxPrefixSize);
+    begin_ = kMaxPrefixSize - prefix_.size();
+    if (!prefix_.empty()) {
+      std::memcpy(out_.data() + begin_, prefix_.data(), prefix_.size());
+    }
+    return true;
+  }
+
+  void AppendKeyframeMember(std::size_t index) {
+    const internal::DeltaMember& member{keyframe_members_[index]};
+    internal::AppendDeltaBytes(out_, keyframe_.data() + member.offset, member.size);
+  }
+
+  const DeltaLayout layout_;
+  std::uint32_t keyframe_id_{0U};
+  bool has_keyframe_{false};
+  std::vector<std::uint8_t> keyframe_{};
+  std::vector<internal::DeltaMember> keyframe_members_{};
+  std::vector<std::uint8_t> out_{};
+  std::size_t begin_{0U};
+  std::vector<std::uint8_t> prefix_{};
+};
+
+} // namespace silkit
+} // namespace vaf
+
+#endif // VAF_SILKIT_SAMPLE_DELTA_H
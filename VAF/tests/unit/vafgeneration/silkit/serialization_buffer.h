@@ -0,0 +1,65 @@
+/*!********************************************************************************************************************
+ *  COPYRIGHT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  Copyright (c) 2024-2026 by Vector Informatik GmbH. All rights reserved.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -----------------------------------------------------------------------------------------------------------------*/
+/*!        \file  serialization_buffer.h
+ *         \brief
+ *
+ *********************************************************************************************************************/
+
+#ifndef VAF_SILKIT_SERIALIZATION_BUFFER_H
+#define VAF_SILKIT_SERIALIZATION_BUFFER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace vaf {
+namespace silkit {
+
+/*!
+ * \brief Serializes a protobuf message into a buffer that is reused for all messages of this type on this thread.
+ * The buffer keeps its capacity, so publishing, calling and replying do not allocate once it grew to the largest
+ * message. The returned buffer is only valid until the next message of the same type is serialized on this thread,
+ * which is fine for SIL Kit as it copies the data before Publish, Call and SubmitResult return.
+ * \param message The message to serialize
+ * \return The serialized message
+ */
+template <typename Message>
+const std::vector<std::uint8_t>& SerializeToBuffer(const Message& message) {
+  thread_local std::vector<std::uint8_t> buffer{};
+  const std::size_t nbytes{message.ByteSizeLong()};
+  buffer.resize(nbytes);
+  if (nbytes != 0u) {
+    message.SerializeToArray(buffer.data(), static_cast<int>(nbytes));
+  }
+  return buffer;
+}
+
+/*!
+ * \brief Serializes a message with a direct codec into a buffer that is reused for this call site on this thread,
+ * with the same lifetime as the buffer of a protobuf message.
+ * \param nbytes The size of the serialized message
+ * \param serialize Writes exactly nbytes into the memory it gets
+ * \return The serialized message
+ */
+template <typename Serialize>
+const std::vector<std::uint8_t>& SerializeToBuffer(std::size_t nbytes, Serialize&& serialize) {
+  thread_local std::vector<std::uint8_t> buffer{};
+  buffer.resize(nbytes);
+  if (nbytes != 0u) {
+    serialize(buffer.data(), nbytes);
+  }
+  return buffer;
+}
+
+} // namespace silkit
+} // namespace vaf
+
+#endif // VAF_SILKIT_SERIALIZATION_BUFFER_H
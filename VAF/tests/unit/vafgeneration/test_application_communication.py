@@ -37,6 +37,9 @@ class TestIntegration:
             vafmodel.DataElement(
                 Name="my_data_element2",
                 TypeRef=vafmodel.DataType(Name="uint64_t", Namespace=""),
+                HistoryDepth=4,
+                HandlerQueueSize=8,
+                HandlerQueueOverflowPolicy=vafmodel.HandlerQueuePolicy.DROP_NEWEST,
             )
         )
 
@@ -65,6 +68,19 @@ class TestIntegration:
             )
         )
         operations.append(vafmodel.Operation(Name="MyOperation", Parameters=parameters))
+        operations.append(
+            vafmodel.Operation(
+                Name="my_data_element1_FieldGetter",
+                Parameters=[
+                    vafmodel.Parameter(
+                        Name="data",
+                        TypeRef=vafmodel.DataType(Name="uint64_t", Namespace=""),
+                        Direction=vafmodel.ParameterDirection.OUT,
+                    )
+                ],
+                FieldNotifier="my_data_element1",
+            )
+        )
 
         m.ModuleInterfaces.append(
             vafmodel.ModuleInterface(
@@ -0,0 +1,113 @@
+# Copyright (c) 2024-2026 by Vector Informatik GmbH. All rights reserved.
+# SPDX-License-Identifier: Apache-2.0
+
+"""Benchmark generator test."""
+
+# pylint: disable=duplicate-code
+# pylint: disable=missing-param-doc
+# pylint: disable=missing-type-doc
+# pylint: disable=too-few-public-methods
+# mypy: disable-error-code="no-untyped-def"
+import filecmp
+import os
+from pathlib import Path
+
+from vaf import vafmodel
+from vaf.core.common import constants
+from vaf.vafgeneration import vaf_benchmark
+
+
+class TestIntegration:
+    """Basic generation test class"""
+
+    def test_basic_generation(self, tmp_path) -> None:
+        """Basic test for benchmark generation"""
+        m = vafmodel.MainModel()
+
+        m.DataTypeDefinitions = vafmodel.DataTypeDefinition()
+        m.DataTypeDefinitions.Vectors.append(
+            vafmodel.Vector(
+                Name="MyVector",
+                Namespace="test",
+                TypeRef=vafmodel.DataType(Name="uint8_t", Namespace=""),
+            )
+        )
+        m.DataTypeDefinitions.Structs.append(
+            vafmodel.Struct(
+                Name="MyStruct",
+                Namespace="test",
+                SubElements=[
+                    vafmodel.SubElement(
+                        Name="MySub",
+                        TypeRef=vafmodel.DataType(Name="MyVector", Namespace="test"),
+                    )
+                ],
+            )
+        )
+
+        m.ModuleInterfaces.append(
+            vafmodel.ModuleInterface(
+                Name="MyInterface",
+                Namespace="test",
+                DataElements=[
+                    vafmodel.DataElement(
+                        Name="my_data_element",
+                        TypeRef=vafmodel.DataType(Name="MyStruct", Namespace="test"),
+                    )
+                ],
+                Operations=[],
+            )
+        )
+
+        m.ApplicationModules.append(
+            vafmodel.ApplicationModule(
+                Name="MyApp",
+                Namespace="test",
+                ConsumedInterfaces=[],
+                ProvidedInterfaces=[],
+                PersistencyFiles=["MyFile"],
+                Tasks=[],
+            )
+        )
+
+        m.Executables.append(
+            vafmodel.Executable(
+                Name="my_executable",
+                ExecutorPeriod="10ms",
+                PersistencyModule=vafmodel.ExecutablePersistencyMapping(
+                    PersistencyLibrary=constants.PersistencyLibrary.MMAP,
+                    PersistencyFiles=[
+                        vafmodel.PersistencyFileMapping(
+                            AppModuleName="MyApp",
+                            FileName="MyFile",
+                            FilePath="./MyFile.db",
+                            Sync="false",
+                        )
+                    ],
+                ),
+                InternalCommunicationModules=[
+                    vafmodel.PlatformModule(
+                        Name="MyServiceModule",
+                        Namespace="test",
+                        ModuleInterfaceRef=m.ModuleInterfaces[0],
+                    )
+                ],
+                ApplicationModules=[],
+            )
+        )
+
+        vaf_benchmark.generate(m, tmp_path)
+
+        script_dir = Path(os.path.realpath(__file__)).parent
+
+        for file in [
+            "CMakeLists.txt",
+            "src/core_benchmark.cpp",
+            "src/communication_benchmark.cpp",
+            "src/protobuf_benchmark.cpp",
+            "src/persistency_benchmark.cpp",
+        ]:
+            assert filecmp.cmp(
+                tmp_path / "test-gen/benchmark" / file,
+                script_dir / "benchmark" / Path(file).name,
+            )
@@ -160,14 +160,18 @@ class TestIntegration:
                 vafmodel.ExecutableTaskMapping(TaskName="R1", Offset=0, Budget="10ms"),
                 vafmodel.ExecutableTaskMapping(TaskName="R2"),
             ],
+            NumaNode=0,
         )
         mapping2 = vafmodel.ExecutableApplicationModuleMapping(
             ApplicationModuleRef=m.ApplicationModules[1],
             InterfaceInstanceToModuleMappings=[],
             TaskMapping=[
                 vafmodel.ExecutableTaskMapping(TaskName="R1", Offset=0, Budget="10ms"),
-                vafmodel.ExecutableTaskMapping(TaskName="R2"),
+                vafmodel.ExecutableTaskMapping(TaskName="R2", Executor="Fast"),
             ],
+            StartupTimeLimit="500ms",
+            RestartPolicy=vafmodel.ModuleRestartPolicy.BACKOFF,
+            RestartDelay="50ms",
         )
 
         persistencyfile1mapping = vafmodel.PersistencyFileMapping(
@@ -175,24 +179,30 @@ class TestIntegration:
             FileName="MyFile1",
             FilePath="./MyFile1.db",
             Sync="true",
+            GroupCommitInterval="100ms",
         )
         persistencyfile2mapping = vafmodel.PersistencyFileMapping(
             AppModuleName="MyApp1",
             FileName="MyFileShared",
             FilePath="./MyFileShared.db",
             Sync="false",
+            TuningProfile=vafmodel.PersistencyTuningProfile.READ_HEAVY,
         )
         persistencyfile3mapping = vafmodel.PersistencyFileMapping(
             AppModuleName="MyApp2",
             FileName="MyFile2",
             FilePath="./MyFile2.db",
             Sync="true",
+            CacheValues=True,
+            TuningProfile=vafmodel.PersistencyTuningProfile.TINY,
         )
         persistencyfile4mapping = vafmodel.PersistencyFileMapping(
             AppModuleName="MyApp2",
             FileName="MyFileShared",
             FilePath="./MyFileShared.db",
             Sync="true",
+            TuningProfile=vafmodel.PersistencyTuningProfile.READ_HEAVY,
+            CompactOnShutdown=True,
         )
 
         persistencyfilemapping = [
@@ -209,8 +219,18 @@ class TestIntegration:
                     PersistencyLibrary=constants.PersistencyLibrary.LEVELDB,
                     PersistencyFiles=persistencyfilemapping,
                 ),
+                Executors=[
+                    vafmodel.ExecutableExecutor(
+                        Name="Fast",
+                        ExecutorPeriod="1ms",
+                        ExecutorSchedulingPolicy=vafmodel.SchedulingPolicy.FIFO,
+                        ExecutorThreadPriority=60,
+                        ExecutorNumaNode=1,
+                    )
+                ],
                 ApplicationModules=[mapping1, mapping2],
                 InternalCommunicationModules=[vaf_module],
+                MetricsExport=vafmodel.ExecutableMetricsExport(FilePath="/dev/shm/my_executable.prom"),
             )
         )
 
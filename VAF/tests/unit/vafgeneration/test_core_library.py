@@ -4,8 +4,12 @@
 """example tests"""
 
 import os
+import shutil
+import subprocess
 from pathlib import Path
 
+import pytest
+
 from vaf.vafgeneration import vaf_core_library
 
 # pylint: disable=too-few-public-methods
@@ -32,6 +36,10 @@ class TestIntegration:
             tmp_path / "src-gen/libs/core_library/CMakeLists.txt",
             script_dir / "core_library/std/CMakeLists.txt",
         )
+        self.__assert_files_identical(
+            tmp_path / "src-gen/libs/core_library/conanfile.py",
+            script_dir / "core_library/std/conanfile.py",
+        )
 
         # src
         self.__assert_files_identical(
@@ -120,3 +128,68 @@ class TestIntegration:
             tmp_path / "src-gen/libs/core_library/include/vaf/internal/data_ptr_helper.h",
             script_dir / "core_library/std/include/vaf/internal/data_ptr_helper.h",
         )
+
+        # PMR
+        vaf_core_library.generate(tmp_path / "pmr", "pmr")
+        for file in [
+            "CMakeLists.txt",
+            "src/runtime.cpp",
+            "src/executor.cpp",
+            "include/vaf/container_types.h",
+            "include/vaf/data_ptr.h",
+        ]:
+            self.__assert_files_identical(
+                tmp_path / "pmr/src-gen/libs/core_library" / file,
+                script_dir / "core_library/pmr" / file,
+            )
+
+
+@pytest.mark.skipif(shutil.which("g++") is None, reason="g++ is not available")
+class TestRuntime:
+    """Runtime tests of the generated core library"""
+
+    @staticmethod
+    def __build_and_run(tmp_path: Path, program: str, standard: str = "c++17") -> None:
+        script_dir = Path(os.path.realpath(__file__)).parent
+        vaf_core_library.generate(tmp_path, "std")
+        library = tmp_path / "src-gen/libs/core_library"
+        objects = tmp_path / "obj"
+        objects.mkdir()
+        # A static library, so a program only links the parts of the core library it uses
+        subprocess.run(
+            ["g++", f"-std={standard}", "-pthread", "-I", str(library / "include"), "-c"]
+            + sorted(str(source) for source in (library / "src").glob("*.cpp")),
+            cwd=objects,
+            check=True,
+        )
+        subprocess.run(
+            ["ar", "rcs", str(tmp_path / "libvaf_core.a")] + sorted(str(o) for o in objects.glob("*.o")), check=True
+        )
+        executable = tmp_path / Path(program).stem
+        subprocess.run(
+            ["g++", f"-std={standard}", "-pthread", "-I", str(library / "include"), "-o", str(executable)]
+            + [str(script_dir / "core_library/runtime" / program), str(tmp_path / "libvaf_core.a")],
+            check=True,
+        )
+        result = subprocess.run([str(executable)], capture_output=True, text=True, check=False, timeout=60)
+        assert result.returncode == 0, result.stdout + result.stderr
+
+    def test_executor_module_tasks(self, tmp_path) -> None:
+        """Tasks of one module never overlap, also if only some of them are due in a time slot"""
+        self.__build_and_run(tmp_path, "executor_module_tasks.cpp")
+
+    def test_executor_short_period(self, tmp_path) -> None:
+        """Periods shorter than the executor period run once per time slot, also without a schedule table"""
+        self.__build_and_run(tmp_path, "executor_short_period.cpp")
+
+    def test_executable_controller_restart(self, tmp_path) -> None:
+        """Modules failing in Start() are restarted by their restart policy, never in a busy loop"""
+        self.__build_and_run(tmp_path, "executable_controller_restart.cpp")
+
+    def test_logging_lines(self, tmp_path) -> None:
+        """Lines logged by several threads are written whole, also if their ring buffers overflow"""
+        self.__build_and_run(tmp_path, "logging_lines.cpp")
+
+    def test_coroutine_sample(self, tmp_path) -> None:
+        """A module coroutine builds with C++20 and awaits futures, also future variables"""
+        self.__build_and_run(tmp_path, "coroutine_sample.cpp", "c++20")
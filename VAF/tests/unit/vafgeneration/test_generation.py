@@ -5,16 +5,24 @@
 
 from pathlib import Path
 
+import pytest
+
 from vaf import vafmodel
 from vaf.core.common.utils import to_camel_case, to_snake_case
 from vaf.vafgeneration.generation import (
     FileHelper,
+    Generator,
     data_type_to_str,
     get_data_type_include,
+    get_generated_files,
     is_data_type_base_type,
     is_data_type_cstdint_type,
+    parallel_rendering,
+    remove_stale_files,
     split_full_type,
+    start_generation,
 )
+from vaf.vafgeneration.vaf_generate_common import GenerationManifest
 
 
 def test_to_camel_case() -> None:
@@ -202,3 +210,87 @@ def test_is_data_type_cstdint_type() -> None:
     assert not is_data_type_cstdint_type("test", "test")
     assert not is_data_type_cstdint_type("test", "")
     assert not is_data_type_cstdint_type("int64_t", "test")
+
+
+def _generate_subdirs(base_dir: Path, subdirs: list[str]) -> None:
+    generator = Generator()
+    generator.set_base_directory(base_dir)
+    generator.generate_to_file(
+        FileHelper("CMakeLists", "", True), ".txt", "common/cmake_subdirs.jinja", subdirs=subdirs
+    )
+
+
+def test_unchanged_files_are_not_written(tmp_path: Path) -> None:
+    """Test that generating the same content again keeps the file and removing stale files"""
+    start_generation()
+    _generate_subdirs(tmp_path / "src-gen", ["a"])
+    _generate_subdirs(tmp_path / "src-gen/old", ["b"])
+    cmake = tmp_path / "src-gen/CMakeLists.txt"
+    modification_time = cmake.stat().st_mtime_ns
+
+    start_generation()
+    _generate_subdirs(tmp_path / "src-gen", ["a"])
+    assert cmake.stat().st_mtime_ns == modification_time
+    # The file of the old directory was not generated again
+    remove_stale_files(tmp_path / "src-gen")
+    assert cmake.is_file()
+    assert not (tmp_path / "src-gen/old").exists()
+
+    start_generation()
+    _generate_subdirs(tmp_path / "src-gen", ["a", "c"])
+    assert "add_subdirectory(c)" in cmake.read_text(encoding="utf-8")
+
+
+def test_generation_manifest(tmp_path: Path) -> None:
+    """Test that generators with unchanged inputs and files are skipped"""
+    calls: list[list[str]] = []
+
+    def generate(subdirs: list[str]) -> None:
+        calls.append(subdirs)
+        _generate_subdirs(tmp_path / "src-gen", subdirs)
+
+    def run(inputs: list[str]) -> None:
+        start_generation()
+        manifest = GenerationManifest(tmp_path)
+        manifest.run("subdirs", ",".join(inputs), lambda: generate(inputs))
+        manifest.save()
+        remove_stale_files(tmp_path / "src-gen")
+
+    run(["a"])
+    run(["a"])
+    assert calls == [["a"]]
+    # The files of the skipped generator are kept
+    assert (tmp_path / "src-gen/CMakeLists.txt").is_file()
+
+    run(["b"])
+    assert calls == [["a"], ["b"]]
+
+    # A changed or missing file runs the generator again
+    (tmp_path / "src-gen/CMakeLists.txt").unlink()
+    run(["b"])
+    assert calls == [["a"], ["b"], ["b"]]
+
+
+def test_parallel_rendering(tmp_path: Path, monkeypatch: pytest.MonkeyPatch) -> None:
+    """Test that files rendered by worker processes match the files rendered in the generating process"""
+    subdirs = [[f"dir_{i}", f"dir_{i + 1}"] for i in range(40)]
+
+    start_generation()
+    for i, s in enumerate(subdirs):
+        _generate_subdirs(tmp_path / "sequential" / str(i), s)
+    sequential = get_generated_files()
+
+    monkeypatch.setenv("VAF_GENERATION_JOBS", "3")
+    start_generation()
+    with parallel_rendering():
+        for i, s in enumerate(subdirs):
+            _generate_subdirs(tmp_path / "parallel" / str(i), s)
+        # Files are rendered when the context ends
+        assert not (tmp_path / "parallel").exists()
+    parallel = get_generated_files()
+
+    assert [p.relative_to(tmp_path / "parallel") for p in parallel] == [
+        p.relative_to(tmp_path / "sequential") for p in sequential
+    ]
+    for p, s in zip(parallel, sequential):
+        assert p.read_text(encoding="utf-8") == s.read_text(encoding="utf-8")
@@ -0,0 +1,166 @@
+# Copyright (c) 2024-2026 by Vector Informatik GmbH. All rights reserved.
+# SPDX-License-Identifier: Apache-2.0
+
+"""Memory estimate generator test."""
+
+# pylint: disable=duplicate-code
+# pylint: disable=missing-param-doc
+# pylint: disable=missing-type-doc
+# pylint: disable=too-few-public-methods
+# mypy: disable-error-code="no-untyped-def"
+import json
+
+from vaf import vafmodel
+from vaf.vafgeneration import vaf_memory_estimate
+
+
+class TestIntegration:
+    """Basic generation test class"""
+
+    def test_basic_generation(self, tmp_path) -> None:
+        """Basic test for memory estimate generation"""
+        m = vafmodel.MainModel()
+
+        m.DataTypeDefinitions = vafmodel.DataTypeDefinition()
+        m.DataTypeDefinitions.Vectors.append(
+            vafmodel.Vector(
+                Name="MyVector",
+                Namespace="test",
+                TypeRef=vafmodel.DataType(Name="uint8_t", Namespace=""),
+            )
+        )
+        m.DataTypeDefinitions.Vectors.append(
+            vafmodel.Vector(
+                Name="MyFixedVector",
+                Namespace="test",
+                TypeRef=vafmodel.DataType(Name="uint16_t", Namespace=""),
+                MaxSize=12,
+            )
+        )
+        m.DataTypeDefinitions.Maps.append(
+            vafmodel.Map(
+                Name="MyHashMap",
+                Namespace="test",
+                MapKeyTypeRef=vafmodel.DataType(Name="uint32_t", Namespace=""),
+                MapValueTypeRef=vafmodel.DataType(Name="uint64_t", Namespace=""),
+                Container=vafmodel.MapContainer.HASH,
+            )
+        )
+        m.DataTypeDefinitions.Structs.append(
+            vafmodel.Struct(
+                Name="MyStruct",
+                Namespace="test",
+                SubElements=[
+                    vafmodel.SubElement(Name="MyFlag", TypeRef=vafmodel.DataType(Name="uint8_t", Namespace="")),
+                    vafmodel.SubElement(Name="MyValue", TypeRef=vafmodel.DataType(Name="double", Namespace="")),
+                ],
+            )
+        )
+
+        m.ModuleInterfaces.append(
+            vafmodel.ModuleInterface(
+                Name="MyInterface",
+                Namespace="test",
+                DataElements=[
+                    vafmodel.DataElement(
+                        Name="my_struct",
+                        TypeRef=vafmodel.DataType(Name="MyStruct", Namespace="test"),
+                    ),
+                    vafmodel.DataElement(
+                        Name="my_vector",
+                        TypeRef=vafmodel.DataType(Name="MyVector", Namespace="test"),
+                    ),
+                    vafmodel.DataElement(
+                        Name="my_counter",
+                        TypeRef=vafmodel.DataType(Name="uint64_t", Namespace=""),
+                        SamplePoolSize=2,
+                        HistoryDepth=3,
+                    ),
+                    vafmodel.DataElement(
+                        Name="my_fixed_vector",
+                        TypeRef=vafmodel.DataType(Name="MyFixedVector", Namespace="test"),
+                    ),
+                    vafmodel.DataElement(
+                        Name="my_hash_map",
+                        TypeRef=vafmodel.DataType(Name="MyHashMap", Namespace="test"),
+                    ),
+                ],
+                Operations=[],
+            )
+        )
+
+        m.ApplicationModules.append(
+            vafmodel.ApplicationModule(
+                Name="MyApp",
+                Namespace="test",
+                ConsumedInterfaces=[
+                    vafmodel.ApplicationModuleConsumedInterface(
+                        InstanceName="my_instance", ModuleInterfaceRef=m.ModuleInterfaces[0]
+                    )
+                ],
+                ProvidedInterfaces=[],
+                PersistencyFiles=[],
+                Tasks=[],
+            )
+        )
+
+        service_module = vafmodel.PlatformModule(
+            Name="MyServiceModule",
+            Namespace="test",
+            ModuleInterfaceRef=m.ModuleInterfaces[0],
+        )
+        m.Executables.append(
+            vafmodel.Executable(
+                Name="my_executable",
+                ExecutorPeriod="10ms",
+                InternalCommunicationModules=[service_module],
+                ApplicationModules=[
+                    vafmodel.ExecutableApplicationModuleMapping(
+                        ApplicationModuleRef=m.ApplicationModules[0],
+                        InterfaceInstanceToModuleMappings=[
+                            vafmodel.InterfaceInstanceToModuleMapping(
+                                InstanceName="my_instance", ModuleRef=service_module
+                            )
+                        ],
+                    )
+                ],
+            )
+        )
+
+        vaf_memory_estimate.generate(m, tmp_path)
+
+        estimate = json.loads((tmp_path / "src-gen/memory_estimate.json").read_text(encoding="utf-8"))
+        executable = estimate["Executables"][0]
+        assert executable["Name"] == "my_executable"
+        module = executable["Modules"][0]
+        assert module["Name"] == "MyServiceModule"
+        my_struct, my_vector, my_counter, my_fixed_vector, my_hash_map = module["DataElements"]
+
+        # Flat and small, so stored inline next to its stamp
+        assert my_struct["SampleBytes"] == 16
+        assert not my_struct["Dynamic"]
+        assert my_struct["Bytes"] == 24
+        assert my_struct["Consumers"] == 1
+
+        # The elements of the vector are not part of the estimate
+        assert my_vector["SampleBytes"] == 24
+        assert my_vector["Dynamic"]
+        assert my_vector["Bytes"] == 64
+
+        assert my_counter["Samples"] == 6
+        assert my_counter["PoolCapacity"] == 2
+        assert my_counter["HistoryDepth"] == 3
+        assert my_counter["Bytes"] == 16 + 2 * 48 + 3 * (24 + 48)
+
+        # The size followed by the inline elements, small enough to be stored inline as well
+        assert my_fixed_vector["SampleBytes"] == 8 + 24
+        assert not my_fixed_vector["Dynamic"]
+        assert my_fixed_vector["Bytes"] == 8 + 32
+
+        # The vector of the entries and the one of the hash table, their content is not part of the estimate
+        assert my_hash_map["SampleBytes"] == 2 * 24
+        assert my_hash_map["Dynamic"]
+        assert my_hash_map["Bytes"] == 88
+
+        assert module["Bytes"] == 24 + 64 + 328 + 40 + 88
+        assert executable["Bytes"] == module["Bytes"]
@@ -294,6 +294,19 @@ class TestIntegration:
             )
         )
 
+        m.Executables.append(
+            vafmodel.Executable(
+                Name="MyExecutable2",
+                ExecutorPeriod="10ms",
+                PersistencyModule=vafmodel.ExecutablePersistencyMapping(
+                    PersistencyLibrary=constants.PersistencyLibrary.MMAP,
+                    PersistencyFiles=[persistencyfile1mapping],
+                ),
+                ApplicationModules=[],
+                InternalCommunicationModules=[],
+            )
+        )
+
         vaf_persistency.generate(m, tmp_path)
 
         script_dir = Path(os.path.realpath(__file__)).parent
@@ -313,6 +326,14 @@ class TestIntegration:
             pm_path / "src/persistency/persistency.cpp",
             script_dir / "persistency/leveldb/persistency.cpp",
         )
+        assert filecmp.cmp(
+            pm_path / "include/persistency/mmap_persistency.h",
+            script_dir / "persistency/mmap/mmap_persistency.h",
+        )
+        assert filecmp.cmp(
+            pm_path / "src/persistency/mmap_persistency.cpp",
+            script_dir / "persistency/mmap/mmap_persistency.cpp",
+        )
 
 
 # pylint: enable=too-many-statements
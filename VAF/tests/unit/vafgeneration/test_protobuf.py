@@ -10,7 +10,7 @@ import os
 from pathlib import Path
 
 from vaf import vafmodel
-from vaf.vafgeneration import vaf_protobuf_serdes
+from vaf.vafgeneration import vaf_protobuf_serdes, vaf_std_data_types
 from vaf.vafpy import import_model
 
 
@@ -288,6 +288,22 @@ class TestIntegration:
             pm_path / "include/protobuf/test2/protobuf_transformer.h",
             script_dir / "protobuf_serdes/transformer/include/protobuf/test2/protobuf_transformer.h",
         )
+        assert filecmp.cmp(
+            pm_path / "src/protobuf/test2/protobuf_transformer.cpp",
+            script_dir / "protobuf_serdes/transformer/src/protobuf/test2/protobuf_transformer.cpp",
+        )
+        assert filecmp.cmp(
+            pm_path / "include/protobuf/interface/test/myinterface/protobuf_codec.h",
+            script_dir / "protobuf_serdes/transformer/include/protobuf/interface/test/myinterface/protobuf_codec.h",
+        )
+        assert filecmp.cmp(
+            pm_path / "include/protobuf/test2/protobuf_codec.h",
+            script_dir / "protobuf_serdes/transformer/include/protobuf/test2/protobuf_codec.h",
+        )
+        assert filecmp.cmp(
+            pm_path / "include/protobuf/wire/codec.h",
+            script_dir / "protobuf_serdes/transformer/include/protobuf/wire/codec.h",
+        )
 
     def test_optional_struct_fields_protobuf_generation(self, tmp_path: Path) -> None:
         """
@@ -432,5 +448,73 @@ class TestIntegration:
         assert "optional uint64 field1" not in proto_content
         assert "optional uint32 field2" not in proto_content
 
+    def test_byte_sequences(self, tmp_path: Path) -> None:
+        """Test that uint8_t vectors and arrays are bytes fields unless ProtobufBytes is switched off"""
+        m = vafmodel.MainModel()
+        m.DataTypeDefinitions = vafmodel.DataTypeDefinition()
+        uint8 = vafmodel.DataType(Name="uint8_t", Namespace="")
+
+        m.DataTypeDefinitions.Vectors.append(vafmodel.Vector(Name="Channel", Namespace="test::bytes", TypeRef=uint8))
+        m.DataTypeDefinitions.Vectors.append(
+            vafmodel.Vector(Name="LegacyChannel", Namespace="test::bytes", TypeRef=uint8, ProtobufBytes=False)
+        )
+        m.DataTypeDefinitions.Arrays.append(vafmodel.Array(Name="Mac", Namespace="test::bytes", TypeRef=uint8, Size=6))
+
+        with open(tmp_path / "model.json", "w", encoding="utf-8") as file:
+            file.write(m.model_dump_json(indent=2, exclude_none=True, exclude_defaults=True, by_alias=True))
+        import_model(str(tmp_path / "model.json"))
+
+        vaf_protobuf_serdes.generate(tmp_path)
+
+        proto_content = (tmp_path / "src-gen/libs/protobuf_serdes/proto/protobuf_test_bytes.proto").read_text()
+        assert "message Channel {\n  bytes vaf_value_internal = 1;" in proto_content
+        assert "message LegacyChannel {\n  repeated uint32 vaf_value_internal = 1;" in proto_content
+        assert "message Mac {\n  bytes vaf_value_internal = 1;" in proto_content
+
+        codec_content = (
+            tmp_path / "src-gen/libs/protobuf_serdes/transformer/include/protobuf/test/bytes/protobuf_codec.h"
+        ).read_text()
+        assert "ReadFixedBytesField(in, tag, out.data(), out.size())" in codec_content
+
+    def test_struct_of_arrays(self, tmp_path: Path) -> None:
+        """Test that a vector with StructOfArrays has one column per member and is read element by element"""
+        m = vafmodel.MainModel()
+        m.DataTypeDefinitions = vafmodel.DataTypeDefinition()
+        point = vafmodel.Struct(
+            Name="Point",
+            Namespace="test::soa",
+            SubElements=[
+                vafmodel.SubElement(Name="x", TypeRef=vafmodel.DataType(Name="float", Namespace="")),
+                vafmodel.SubElement(Name="y", TypeRef=vafmodel.DataType(Name="float", Namespace=""), IsOptional=True),
+            ],
+        )
+        m.DataTypeDefinitions.Structs.append(point)
+        m.DataTypeDefinitions.Vectors.append(
+            vafmodel.Vector(
+                Name="Cloud",
+                Namespace="test::soa",
+                TypeRef=vafmodel.DataType(Name="Point", Namespace="test::soa"),
+                StructOfArrays=True,
+            )
+        )
+
+        with open(tmp_path / "model.json", "w", encoding="utf-8") as file:
+            file.write(m.model_dump_json(indent=2, exclude_none=True, exclude_defaults=True, by_alias=True))
+        import_model(str(tmp_path / "model.json"))
+
+        vaf_std_data_types.generate(tmp_path)
+        vaf_protobuf_serdes.generate(tmp_path)
+
+        header_content = (tmp_path / "src-gen/libs/data_types/include/test/soa/impl_type_cloud.h").read_text()
+        assert "class Cloud {" in header_content
+        assert "vaf::Vector<float> x_{};" in header_content
+        assert "vaf::Vector<std::optional<float>> y_{};" in header_content
+        assert "return reference{x_[pos], y_[pos]};" in header_content
+
+        transformer_content = (
+            tmp_path / "src-gen/libs/protobuf_serdes/transformer/src/protobuf/test/soa/protobuf_transformer.cpp"
+        ).read_text()
+        assert "out.push_back(std::move(element_out));" in transformer_content
+
 
 # pylint: enable=too-many-statements
@@ -0,0 +1,120 @@
+# Copyright (c) 2024-2026 by Vector Informatik GmbH. All rights reserved.
+# SPDX-License-Identifier: Apache-2.0
+
+"""Shared memory generator test."""
+
+# pylint: disable=duplicate-code
+import copy
+import filecmp
+import os
+from pathlib import Path
+
+from vaf import vafmodel
+from vaf.vafgeneration import vaf_shm
+
+
+# pylint: disable=missing-any-param-doc
+# pylint: disable=missing-param-doc
+# pylint: disable=missing-type-doc
+# pylint: disable=too-few-public-methods
+# mypy: disable-error-code="no-untyped-def"
+class TestIntegration:
+    """Basic generation test class"""
+
+    def test_basic_generation(self, tmp_path) -> None:
+        """Basic test for shared memory generation"""
+        m = vafmodel.MainModel()
+
+        data_elements: list[vafmodel.DataElement] = []
+        data_elements.append(
+            vafmodel.DataElement(
+                Name="my_data_element1",
+                TypeRef=vafmodel.DataType(Name="uint64_t", Namespace=""),
+            )
+        )
+        data_elements.append(
+            vafmodel.DataElement(
+                Name="my_data_element2",
+                TypeRef=vafmodel.DataType(Name="uint64_t", Namespace=""),
+                InitialValue="{64}",
+            )
+        )
+
+        m.ModuleInterfaces.append(
+            vafmodel.ModuleInterface(
+                Name="MyInterface",
+                Namespace="test",
+                DataElements=data_elements,
+                Operations=[],
+            )
+        )
+        amci = vafmodel.ApplicationModuleConsumedInterface(
+            ModuleInterfaceRef=m.ModuleInterfaces[0], InstanceName="ConsumedInstance"
+        )
+        ampi = vafmodel.ApplicationModuleProvidedInterface(
+            ModuleInterfaceRef=m.ModuleInterfaces[0], InstanceName="ProvidedInstance"
+        )
+
+        am = vafmodel.ApplicationModule(
+            Name="MyApplicationModule",
+            Namespace="test",
+            ConsumedInterfaces=[amci],
+            ProvidedInterfaces=[ampi],
+            PersistencyFiles=[],
+        )
+
+        m.ApplicationModules.append(am)
+
+        m.PlatformProviderModules.append(
+            vafmodel.PlatformModule(
+                Name="MyProviderModule",
+                Namespace="test",
+                ModuleInterfaceRef=m.ModuleInterfaces[0],
+                OriginalEcoSystem=vafmodel.OriginalEcoSystemEnum.SHM,
+                ConnectionPointRef=vafmodel.SHMConnectionPoint(Name="CPoint", SegmentName="my_segment", SlotCount=8),
+            )
+        )
+
+        m.PlatformConsumerModules.append(copy.deepcopy(m.PlatformProviderModules[0]))
+        m.PlatformConsumerModules[0].Name = "MyConsumerModule"
+
+        iitmm1 = vafmodel.InterfaceInstanceToModuleMapping(
+            InstanceName="ConsumedInstance", ModuleRef=m.PlatformConsumerModules[0]
+        )
+        iitmm2 = vafmodel.InterfaceInstanceToModuleMapping(
+            InstanceName="ProvidedInstance", ModuleRef=m.PlatformProviderModules[0]
+        )
+
+        eap = vafmodel.ExecutableApplicationModuleMapping(
+            ApplicationModuleRef=am, InterfaceInstanceToModuleMappings=[iitmm1, iitmm2], TaskMapping=[]
+        )
+
+        e = vafmodel.Executable(Name="MyExecutable", ExecutorPeriod="10ms", ApplicationModules=[eap])
+
+        m.Executables.append(e)
+
+        vaf_shm.generate(m, tmp_path)
+
+        script_dir = Path(os.path.realpath(__file__)).parent
+
+        cm_path = tmp_path / "src-gen/libs/platform_shm/platform_consumer_modules/my_consumer_module"
+        assert filecmp.cmp(
+            cm_path / "include/test/my_consumer_module.h",
+            script_dir / "shm/my_consumer_module.h",
+        )
+
+        assert filecmp.cmp(
+            cm_path / "src/test/my_consumer_module.cpp",
+            script_dir / "shm/my_consumer_module.cpp",
+        )
+
+        pm_path = tmp_path / "src-gen/libs/platform_shm/platform_provider_modules/my_provider_module"
+        assert filecmp.cmp(
+            pm_path / "include/test/my_provider_module.h",
+            script_dir / "shm/my_provider_module.h",
+        )
+
+        assert filecmp.cmp(
+            pm_path / "src/test/my_provider_module.cpp",
+            script_dir / "shm/my_provider_module.cpp",
+        )
@@ -7,10 +7,22 @@
 import copy
 import filecmp
 import os
+import shutil
+import subprocess
 from pathlib import Path
 
+import pytest
+
 from vaf import vafmodel
-from vaf.vafgeneration import vaf_silkit
+from vaf.vafgeneration import (
+    vaf_core_library,
+    vaf_interface,
+    vaf_protobuf_serdes,
+    vaf_silkit,
+    vaf_std_data_types,
+)
+from vaf.vafpy import import_model
+from vaf.vafpy.model_runtime import ModelRuntime
 
 
 # pylint: disable=too-many-statements
@@ -18,6 +30,8 @@ from vaf.vafgeneration import vaf_silkit
 # pylint: disable=missing-param-doc
 # pylint: disable=missing-type-doc
 # pylint: disable=too-few-public-methods
+# pylint: disable=missing-yield-doc
+# pylint: disable=missing-yield-type-doc
 # mypy: disable-error-code="no-untyped-def"
 class TestIntegration:
     """Basic generation test class"""
@@ -57,6 +71,16 @@ class TestIntegration:
                 SubElements=[sub1, sub2],
             )
         )
+        m.DataTypeDefinitions.Structs.append(
+            vafmodel.Struct(
+                Name="MyState",
+                Namespace="test",
+                SubElements=[
+                    vafmodel.SubElement(Name="MyPosition", TypeRef=vafmodel.DataType(Name="uint64_t", Namespace="")),
+                    vafmodel.SubElement(Name="MyHistory", TypeRef=vafmodel.DataType(Name="MyVector", Namespace="test")),
+                ],
+            )
+        )
         m.DataTypeDefinitions.Strings.append(
             vafmodel.String(
                 Name="MyString",
@@ -144,6 +168,25 @@ class TestIntegration:
                 Name="my_data_element2",
                 TypeRef=vafmodel.DataType(Name="uint64_t", Namespace=""),
                 InitialValue="{64}",
+                MaxPublishRate=50,
+            )
+        )
+
+        data_elements.append(
+            vafmodel.DataElement(
+                Name="my_data_element3",
+                TypeRef=vafmodel.DataType(Name="MyVector", Namespace="test"),
+                PublishOnChange=True,
+                Compression=vafmodel.SampleCompression.LZ4,
+                CompressionThreshold=256,
+            )
+        )
+
+        data_elements.append(
+            vafmodel.DataElement(
+                Name="my_data_element4",
+                TypeRef=vafmodel.DataType(Name="MyState", Namespace="test"),
+                DeltaKeyframeInterval=10,
             )
         )
 
@@ -171,7 +214,15 @@ class TestIntegration:
                 Direction=vafmodel.ParameterDirection.INOUT,
             )
         )
-        operations.append(vafmodel.Operation(Name="MyOperation", Parameters=parameters))
+        operations.append(
+            vafmodel.Operation(
+                Name="MyOperation",
+                Parameters=parameters,
+                HandlerDispatch=vafmodel.OperationHandlerDispatch.WORKER_POOL,
+                HandlerConcurrency=4,
+                HandlerQueueSize=32,
+            )
+        )
 
         operations.append(
             vafmodel.Operation(
@@ -183,6 +234,7 @@ class TestIntegration:
                         Direction=vafmodel.ParameterDirection.OUT,
                     )
                 ],
+                FieldNotifier="my_data_element1",
             )
         )
 
@@ -196,6 +248,7 @@ class TestIntegration:
                         Direction=vafmodel.ParameterDirection.IN,
                     )
                 ],
+                HandlerDispatch=vafmodel.OperationHandlerDispatch.EXECUTOR,
             )
         )
 
@@ -238,6 +291,54 @@ class TestIntegration:
 
         m.PlatformConsumerModules.append(copy.deepcopy(m.PlatformProviderModules[0]))
         m.PlatformConsumerModules[0].Name = "MyConsumerModule"
+        assert isinstance(m.PlatformConsumerModules[0].ConnectionPointRef, vafmodel.SILKITConnectionPoint)
+        m.PlatformConsumerModules[0].ConnectionPointRef.RpcMaxInFlight = 8
+        m.PlatformConsumerModules[0].ConnectionPointRef.RpcTimeout = "100ms"
+
+        batched_provider = copy.deepcopy(m.PlatformProviderModules[0])
+        batched_provider.Name = "MyBatchedProviderModule"
+        assert isinstance(batched_provider.ConnectionPointRef, vafmodel.SILKITConnectionPoint)
+        batched_provider.ConnectionPointRef.BatchDataElements = True
+        m.PlatformProviderModules.append(batched_provider)
+        batched_consumer = copy.deepcopy(batched_provider)
+        batched_consumer.Name = "MyBatchedConsumerModule"
+        m.PlatformConsumerModules.append(batched_consumer)
+
+        direct_codec_provider = copy.deepcopy(m.PlatformProviderModules[0])
+        direct_codec_provider.Name = "MyDirectCodecProviderModule"
+        assert isinstance(direct_codec_provider.ConnectionPointRef, vafmodel.SILKITConnectionPoint)
+        direct_codec_provider.ConnectionPointRef.DirectProtobufCodec = True
+        m.PlatformProviderModules.append(direct_codec_provider)
+        direct_codec_consumer = copy.deepcopy(m.PlatformConsumerModules[0])
+        direct_codec_consumer.Name = "MyDirectCodecConsumerModule"
+        assert isinstance(direct_codec_consumer.ConnectionPointRef, vafmodel.SILKITConnectionPoint)
+        direct_codec_consumer.ConnectionPointRef.DirectProtobufCodec = True
+        m.PlatformConsumerModules.append(direct_codec_consumer)
+
+        lazy_consumer = copy.deepcopy(m.PlatformConsumerModules[0])
+        lazy_consumer.Name = "MyLazyConsumerModule"
+        assert isinstance(lazy_consumer.ConnectionPointRef, vafmodel.SILKITConnectionPoint)
+        lazy_consumer.ConnectionPointRef.LazyDeserialization = True
+        m.PlatformConsumerModules.append(lazy_consumer)
+
+        usage_consumer = copy.deepcopy(m.PlatformConsumerModules[0])
+        usage_consumer.Name = "MyUsageConsumerModule"
+        m.PlatformConsumerModules.append(usage_consumer)
+        monitor = vafmodel.ApplicationModule(
+            Name="MyMonitorModule",
+            Namespace="test",
+            ConsumedInterfaces=[
+                vafmodel.ApplicationModuleConsumedInterface(
+                    ModuleInterfaceRef=m.ModuleInterfaces[0],
+                    InstanceName="MonitoredInstance",
+                    UsedDataElements=["my_data_element3"],
+                    UsedOperations=["MyVoidOperation", "MyGetter"],
+                )
+            ],
+            ProvidedInterfaces=[],
+            PersistencyFiles=[],
+        )
+        m.ApplicationModules.append(monitor)
 
         iitmm1 = vafmodel.InterfaceInstanceToModuleMapping(
             InstanceName="ConsumedInstance", ModuleRef=m.PlatformConsumerModules[0]
@@ -249,8 +350,17 @@ class TestIntegration:
         eap = vafmodel.ExecutableApplicationModuleMapping(
             ApplicationModuleRef=am, InterfaceInstanceToModuleMappings=[iitmm1, iitmm2], TaskMapping=[]
         )
+        monitor_mapping = vafmodel.ExecutableApplicationModuleMapping(
+            ApplicationModuleRef=monitor,
+            InterfaceInstanceToModuleMappings=[
+                vafmodel.InterfaceInstanceToModuleMapping(InstanceName="MonitoredInstance", ModuleRef=usage_consumer)
+            ],
+            TaskMapping=[],
+        )
 
-        e = vafmodel.Executable(Name="MyExecutable", ExecutorPeriod="10ms", ApplicationModules=[eap])
+        e = vafmodel.Executable(
+            Name="MyExecutable", ExecutorPeriod="10ms", ApplicationModules=[eap, monitor_mapping]
+        )
 
         m.Executables.append(e)
 
@@ -281,5 +391,321 @@ class TestIntegration:
             script_dir / "silkit/my_provider_module.cpp",
         )
 
+        bcm_path = tmp_path / "src-gen/libs/platform_silkit/platform_consumer_modules/my_batched_consumer_module"
+        assert filecmp.cmp(
+            bcm_path / "include/test/my_batched_consumer_module.h",
+            script_dir / "silkit/my_batched_consumer_module.h",
+        )
+
+        assert filecmp.cmp(
+            bcm_path / "src/test/my_batched_consumer_module.cpp",
+            script_dir / "silkit/my_batched_consumer_module.cpp",
+        )
+
+        bpm_path = tmp_path / "src-gen/libs/platform_silkit/platform_provider_modules/my_batched_provider_module"
+        assert filecmp.cmp(
+            bpm_path / "include/test/my_batched_provider_module.h",
+            script_dir / "silkit/my_batched_provider_module.h",
+        )
+
+        assert filecmp.cmp(
+            bpm_path / "src/test/my_batched_provider_module.cpp",
+            script_dir / "silkit/my_batched_provider_module.cpp",
+        )
+
+        dcm_path = tmp_path / "src-gen/libs/platform_silkit/platform_consumer_modules/my_direct_codec_consumer_module"
+        assert filecmp.cmp(
+            dcm_path / "src/test/my_direct_codec_consumer_module.cpp",
+            script_dir / "silkit/my_direct_codec_consumer_module.cpp",
+        )
+
+        lcm_path = tmp_path / "src-gen/libs/platform_silkit/platform_consumer_modules/my_lazy_consumer_module"
+        assert filecmp.cmp(
+            lcm_path / "include/test/my_lazy_consumer_module.h",
+            script_dir / "silkit/my_lazy_consumer_module.h",
+        )
+
+        assert filecmp.cmp(
+            lcm_path / "src/test/my_lazy_consumer_module.cpp",
+            script_dir / "silkit/my_lazy_consumer_module.cpp",
+        )
+
+        ucm_path = tmp_path / "src-gen/libs/platform_silkit/platform_consumer_modules/my_usage_consumer_module"
+        assert filecmp.cmp(
+            ucm_path / "include/test/my_usage_consumer_module.h",
+            script_dir / "silkit/my_usage_consumer_module.h",
+        )
+
+        assert filecmp.cmp(
+            ucm_path / "src/test/my_usage_consumer_module.cpp",
+            script_dir / "silkit/my_usage_consumer_module.cpp",
+        )
+
+        dpm_path = tmp_path / "src-gen/libs/platform_silkit/platform_provider_modules/my_direct_codec_provider_module"
+        assert filecmp.cmp(
+            dpm_path / "src/test/my_direct_codec_provider_module.cpp",
+            script_dir / "silkit/my_direct_codec_provider_module.cpp",
+        )
+
+        participant_path = tmp_path / "src-gen/libs/platform_silkit/participant"
+        assert filecmp.cmp(
+            participant_path / "include/vaf/silkit/participant.h",
+            script_dir / "silkit/participant.h",
+        )
+
+        assert filecmp.cmp(
+            participant_path / "src/vaf/silkit/participant.cpp",
+            script_dir / "silkit/participant.cpp",
+        )
+
+        assert filecmp.cmp(
+            participant_path / "include/vaf/silkit/serialization_buffer.h",
+            script_dir / "silkit/serialization_buffer.h",
+        )
+
+        assert filecmp.cmp(
+            participant_path / "include/vaf/silkit/reception_arena.h",
+            script_dir / "silkit/reception_arena.h",
+        )
+
+        assert filecmp.cmp(
+            participant_path / "include/vaf/silkit/flat_wire_format.h",
+            script_dir / "silkit/flat_wire_format.h",
+        )
+
+        assert filecmp.cmp(
+            participant_path / "include/vaf/silkit/pending_calls.h",
+            script_dir / "silkit/pending_calls.h",
+        )
+        assert filecmp.cmp(
+            participant_path / "include/vaf/silkit/rpc_dispatch.h",
+            script_dir / "silkit/rpc_dispatch.h",
+        )
+
+        assert filecmp.cmp(
+            participant_path / "include/vaf/silkit/publish_throttle.h",
+            script_dir / "silkit/publish_throttle.h",
+        )
+
+        assert filecmp.cmp(
+            participant_path / "include/vaf/silkit/sample_batch.h",
+            script_dir / "silkit/sample_batch.h",
+        )
+
+        assert filecmp.cmp(
+            participant_path / "include/vaf/silkit/lazy_sample.h",
+            script_dir / "silkit/lazy_sample.h",
+        )
+
+        assert filecmp.cmp(
+            participant_path / "include/vaf/silkit/sample_delta.h",
+            script_dir / "silkit/sample_delta.h",
+        )
+
+        assert filecmp.cmp(
+            participant_path / "include/vaf/silkit/sample_compression.h",
+            script_dir / "silkit/sample_compression.h",
+        )
+
+        assert filecmp.cmp(
+            participant_path / "src/vaf/silkit/sample_compression.cpp",
+            script_dir / "silkit/sample_compression.cpp",
+        )
+
+
+@pytest.fixture(autouse=True)
+def reset_model_runtime():
+    """Reset ModelRuntime singleton between tests, so every runtime test generates its own model"""
+    yield
+    ModelRuntime.reset()
+
+
+def _compiles(code: str) -> bool:
+    """Checks whether g++ compiles the code, e.g. whether the headers of a library are installed"""
+    if shutil.which("g++") is None:
+        return False
+    result = subprocess.run(
+        ["g++", "-std=c++17", "-fsyntax-only", "-x", "c++", "-"], input=code, text=True, capture_output=True, check=False
+    )
+    return result.returncode == 0
+
+
+@pytest.mark.skipif(
+    shutil.which("g++") is None or shutil.which("protoc") is None, reason="g++ or protoc is not available"
+)
+class TestRuntime:
+    """Runtime tests of the generated SIL Kit modules against the SIL Kit test double in silkit/runtime/include"""
+
+    @staticmethod
+    def __counter_model(data_elements: list[vafmodel.DataElement] | None = None) -> vafmodel.MainModel:
+        m = vafmodel.MainModel()
+        m.DataTypeDefinitions = vafmodel.DataTypeDefinition()
+        m.DataTypeDefinitions.Vectors.append(
+            vafmodel.Vector(Name="Bytes", Namespace="demo", TypeRef=vafmodel.DataType(Name="uint8_t", Namespace=""))
+        )
+        uint64 = vafmodel.DataType(Name="uint64_t", Namespace="")
+        m.ModuleInterfaces.append(
+            vafmodel.ModuleInterface(
+                Name="Counter",
+                Namespace="demo",
+                DataElements=[vafmodel.DataElement(Name="count", TypeRef=uint64)] + (data_elements or []),
+                Operations=[
+                    vafmodel.Operation(
+                        Name="Add",
+                        Parameters=[
+                            vafmodel.Parameter(Name="a", TypeRef=uint64, Direction=vafmodel.ParameterDirection.IN),
+                            vafmodel.Parameter(Name="sum", TypeRef=uint64, Direction=vafmodel.ParameterDirection.OUT),
+                        ],
+                    )
+                ],
+            )
+        )
+        connection_point = vafmodel.SILKITConnectionPoint(Name="CPoint", SilkitInstance="Counter", RpcTimeout="100ms")
+        m.SILKITAdditionalConfiguration = vafmodel.SILKITAdditionalConfigurationType(
+            ConnectionPoints=[connection_point]
+        )
+        for modules, name in [
+            (m.PlatformProviderModules, "CounterProviderModule"),
+            (m.PlatformConsumerModules, "CounterConsumerModule"),
+        ]:
+            modules.append(
+                vafmodel.PlatformModule(
+                    Name=name,
+                    Namespace="demo",
+                    ModuleInterfaceRef=m.ModuleInterfaces[0],
+                    OriginalEcoSystem=vafmodel.OriginalEcoSystemEnum.SILKIT,
+                    ConnectionPointRef=connection_point,
+                )
+            )
+        return m
+
+    @staticmethod
+    def __archive(tmp_path: Path, name: str, sources: list[Path], includes: list[str]) -> Path:
+        """Compiles the sources into a static library, so a program only links the parts it uses"""
+        objects = tmp_path / f"{name}_obj"
+        objects.mkdir()
+        subprocess.run(
+            ["g++", "-std=c++17", "-pthread", "-c"]
+            + [f"-I{include}" for include in includes]
+            + ["-idirafter", str(tmp_path / "compat")]
+            + sorted(str(source) for source in sources),
+            cwd=objects,
+            check=True,
+        )
+        archive = tmp_path / f"lib{name}.a"
+        subprocess.run(["ar", "rcs", str(archive)] + sorted(str(o) for o in objects.glob("*.o")), check=True)
+        return archive
+
+    def __build_and_run(
+        self, tmp_path: Path, model: vafmodel.MainModel, program: str, libraries: list[str] | None = None
+    ) -> None:
+        script_dir = Path(os.path.realpath(__file__)).parent
+        model_file = tmp_path / "model.json"
+        model_file.write_text(
+            model.model_dump_json(indent=2, exclude_none=True, exclude_defaults=True, by_alias=True), "utf-8"
+        )
+        import_model(str(model_file))
+        vaf_core_library.generate(tmp_path, "std")
+        vaf_std_data_types.generate(tmp_path)
+        vaf_interface.generate_module_interfaces(model, tmp_path)
+        vaf_protobuf_serdes.generate(tmp_path)
+        vaf_silkit.generate(model, tmp_path)
+
+        libs = tmp_path / "src-gen/libs"
+        proto = libs / "protobuf_serdes/proto"
+        protobuf_out = tmp_path / "protobuf"
+        protobuf_out.mkdir()
+        subprocess.run(
+            ["protoc", "-I", str(proto), f"--cpp_out={protobuf_out}"] + sorted(str(p) for p in proto.glob("*.proto")),
+            check=True,
+        )
+        # Protobuf before 22 has no serial_arena.h, the modules only need arena.h from it
+        compat = tmp_path / "compat/google/protobuf"
+        compat.mkdir(parents=True)
+        (compat / "serial_arena.h").touch()
+
+        includes = sorted(str(include) for include in libs.glob("**/include")) + [
+            str(protobuf_out),
+            str(script_dir / "silkit/runtime/include"),
+        ]
+        core = self.__archive(
+            tmp_path, "vaf_core", list((libs / "core_library/src").glob("*.cpp")), [str(libs / "core_library/include")]
+        )
+        # The participant itself needs the SIL Kit orchestration, a program provides the participant to the modules
+        generated = self.__archive(
+            tmp_path,
+            "generated",
+            [
+                source
+                for source in libs.glob("**/src/**/*.cpp")
+                if source.name != "participant.cpp" and "core_library" not in source.parts
+            ]
+            + list(protobuf_out.glob("*.pb.cc")),
+            includes,
+        )
+        executable = tmp_path / Path(program).stem
+        subprocess.run(
+            ["g++", "-std=c++17", "-pthread", "-o", str(executable)]
+            + [f"-I{include}" for include in includes]
+            + ["-idirafter", str(tmp_path / "compat"), str(script_dir / "silkit/runtime" / program)]
+            + [str(generated), str(core), "-lprotobuf"]
+            + [f"-l{library}" for library in libraries or []],
+            check=True,
+        )
+        result = subprocess.run([str(executable)], capture_output=True, text=True, check=False, timeout=60)
+        assert result.returncode == 0, result.stdout + result.stderr
+
+    def test_module_restart(self, tmp_path) -> None:
+        """Restarted modules reuse their controllers and only handle samples and calls while started"""
+        self.__build_and_run(tmp_path, self.__counter_model(), "module_restart.cpp")
+
+    @pytest.mark.skipif(
+        not _compiles("#include <lz4.h>\n#include <zstd.h>\n"), reason="LZ4 or Zstandard is not available"
+    )
+    def test_sample_compression(self, tmp_path) -> None:
+        """Compressed and stored samples decompress, truncated, wrongly sized and corrupt ones are rejected"""
+        data_elements = [
+            vafmodel.DataElement(
+                Name=f"{compression.name.lower()}_bytes",
+                TypeRef=vafmodel.DataType(Name="Bytes", Namespace="demo"),
+                Compression=compression,
+            )
+            for compression in vafmodel.SampleCompression
+        ]
+        self.__build_and_run(tmp_path, self.__counter_model(data_elements), "sample_compression.cpp", ["lz4", "zstd"])
+
+    def test_sample_delta(self, tmp_path) -> None:
+        """Keyframes and deltas of flat and protobuf samples restore the samples, deltas of another keyframe and
+        malformed deltas are rejected"""
+        uint64 = vafmodel.DataType(Name="uint64_t", Namespace="")
+        model = self.__counter_model(
+            [
+                vafmodel.DataElement(
+                    Name="pose", TypeRef=vafmodel.DataType(Name="Pose", Namespace="demo"), DeltaKeyframeInterval=4
+                ),
+                vafmodel.DataElement(
+                    Name="track", TypeRef=vafmodel.DataType(Name="Track", Namespace="demo"), DeltaKeyframeInterval=4
+                ),
+            ]
+        )
+        assert model.DataTypeDefinitions is not None
+        model.DataTypeDefinitions.Structs += [
+            vafmodel.Struct(
+                Name="Pose",
+                Namespace="demo",
+                SubElements=[vafmodel.SubElement(Name=name, TypeRef=uint64) for name in ["x", "y", "z", "w"]],
+            ),
+            vafmodel.Struct(
+                Name="Track",
+                Namespace="demo",
+                SubElements=[
+                    vafmodel.SubElement(Name="id", TypeRef=uint64),
+                    vafmodel.SubElement(Name="points", TypeRef=vafmodel.DataType(Name="Bytes", Namespace="demo")),
+                    vafmodel.SubElement(Name="label", TypeRef=uint64),
+                ],
+            ),
+        ]
+        self.__build_and_run(tmp_path, model, "sample_delta.cpp")
+
 
 # pylint: enable=too-many-statements
@@ -13,7 +13,10 @@ import json
 from copy import deepcopy
 from pathlib import Path
 
+import pytest
+
 from vaf import vafmodel
+from vaf.vafmodel import vafmodel as vafmodel_module
 
 from ...utils.test_helpers import Brahma
 
@@ -76,3 +79,70 @@ class TestMain:
         assert not mock_model.is_persistency_used
         mock_model.ApplicationModules.append(mock_am_per)
         assert mock_model.is_persistency_used
+
+    def test_load_json_references(self, tmp_path: Path, monkeypatch: pytest.MonkeyPatch) -> None:
+        """References resolve to one validated element each, the second load reads the snapshot"""
+        monkeypatch.setenv("VAF_MODEL_CACHE_DIR", str(tmp_path / "cache"))
+        interface = {
+            "Name": "If",
+            "Namespace": "test",
+            "DataElements": [{"Name": "de", "TypeRef": "test::MyStruct"}],
+            "Operations": [],
+        }
+        module = {
+            "Name": "App",
+            "Namespace": "test",
+            "ConsumedInterfaces": [{"InstanceName": "c", "ModuleInterfaceRef": "test::If"}],
+            "ProvidedInterfaces": [{"InstanceName": "p", "ModuleInterfaceRef": "test::If"}],
+            "PersistencyFiles": [],
+        }
+        raw_model = {
+            "DataTypeDefinitions": {
+                "Structs": [{"Name": "MyStruct", "Namespace": "test", "SubElements": [{"Name": "a", "TypeRef": "bool"}]}]
+            },
+            "ModuleInterfaces": [interface],
+            "ApplicationModules": [module],
+        }
+        model_path = tmp_path / "model.json"
+        model_path.write_text(json.dumps(raw_model), encoding="utf-8")
+
+        m = vafmodel.load_json(model_path)
+        consumed = m.ApplicationModules[0].ConsumedInterfaces[0].ModuleInterfaceRef
+        assert consumed.DataElements[0].TypeRef == vafmodel.DataType(Name="MyStruct", Namespace="test")
+        assert consumed is m.ApplicationModules[0].ProvidedInterfaces[0].ModuleInterfaceRef
+        assert len(list((tmp_path / "cache").glob("*.pickle"))) == 1
+        assert vafmodel.load_json(model_path).model_dump_json() == m.model_dump_json()
+
+        interface["DataElements"][0]["TypeRef"] = "test::Unknown"
+        model_path.write_text(json.dumps(raw_model), encoding="utf-8")
+        with pytest.raises(Exception, match="Reference not found: test::Unknown"):
+            vafmodel.load_json(model_path)
+
+    def test_load_json_snapshots(self, tmp_path: Path, monkeypatch: pytest.MonkeyPatch) -> None:
+        """Snapshots are only kept if enabled, unreadable ones are replaced and the least recently used are removed"""
+        monkeypatch.setenv("XDG_CACHE_HOME", str(tmp_path / "xdg"))
+        monkeypatch.setenv("HOME", str(tmp_path / "home"))
+        monkeypatch.delenv("VAF_MODEL_CACHE_DIR", raising=False)
+        model_paths = []
+        for index in range(3):
+            model_path = tmp_path / f"model{index}.json"
+            model_path.write_text(json.dumps({"ModuleInterfaces": []}) + " " * index, encoding="utf-8")
+            model_paths.append(model_path)
+
+        vafmodel.load_json(model_paths[0])
+        assert not list(tmp_path.glob("**/*.pickle"))
+
+        cache_dir = tmp_path / "cache"
+        monkeypatch.setenv("VAF_MODEL_CACHE_DIR", str(cache_dir))
+        monkeypatch.setattr(vafmodel_module, "_MAX_SNAPSHOTS", 2)
+        vafmodel.load_json(model_paths[0])
+        (snapshot,) = cache_dir.glob("*.pickle")
+        snapshot.write_bytes(b"truncated")
+        assert vafmodel.load_json(model_paths[0]).ModuleInterfaces == []
+        assert isinstance(vafmodel.load_json(model_paths[0]), vafmodel.MainModel)
+
+        vafmodel.load_json(model_paths[1])
+        vafmodel.load_json(model_paths[2])
+        snapshots = {path.name for path in cache_dir.glob("*.pickle")}
+        assert len(snapshots) == 2
+        assert snapshot.name not in snapshots
@@ -144,6 +144,25 @@ class TestExportStringEnums(unittest.TestCase):
             else:
                 self.assertEqual(1, 0)
 
+    def test_export_filtered_structs(self) -> None:
+        """Test that only the selected signals and the branches leading to them are exported."""
+
+        vss_model = VSS(self.mock_vss_data_nested, signal_filter=["SeatConfiguration.Acceleration.L*"])
+        derived_model = vss_model.export()
+
+        structs = {struct.Name: struct for struct in derived_model.DataTypeDefinitions.Structs}
+        self.assertEqual(sorted(structs), ["Acceleration", "SeatConfiguration"])
+        self.assertEqual([s.Name for s in structs["SeatConfiguration"].SubElements], ["Acceleration"])
+        self.assertEqual(
+            sorted(s.Name for s in structs["Acceleration"].SubElements), ["Lateral", "Longitudinal"]
+        )
+        self.assertEqual(derived_model.DataTypeDefinitions.Enums, [])
+
+        # A selected branch is exported with all its children
+        vss_model = VSS(self.mock_vss_data_nested, signal_filter=["SeatConfiguration.Acceleration"])
+        structs = {struct.Name: struct for struct in vss_model.export().DataTypeDefinitions.Structs}
+        self.assertEqual(len(structs["Acceleration"].SubElements), 3)
+
 
 if __name__ == "__main__":
     unittest.main()